@@ -0,0 +1,1172 @@
+// allocbench.m.cpp                                                   -*-C++-*-
+
+//@PURPOSE: Benchmark BDE allocators on N4468/P0089-style workloads.
+//
+//@DESCRIPTION: This program measures the run time of a matrix of allocation
+// strategies, container types, and usage patterns, in the manner of the
+// WG21 papers N4468, P0089R0, and P0089R1 ("On Quantifying Memory-Allocation
+// Strategies"), and writes one record per configuration in CSV or JSON
+// format, so that results may be archived and compared over time.
+//
+///Allocators
+///----------
+//: 'newdelete':
+//:   'bslma::NewDeleteAllocator::singleton()', i.e., the global heap.
+//:
+//: 'multipool':
+//:   'bdlma::MultipoolAllocator'.
+//:
+//: 'sequential':
+//:   'bdlma::SequentialAllocator'.
+//:
+//: 'concurrentmultipool':
+//:   'bdlma::ConcurrentMultipoolAllocator'.
+//:
+//: 'localsequential':
+//:   'bdlma::LocalSequentialAllocator' with a 16K arena on the stack.
+//
+// All allocators other than 'newdelete' obtain their memory from a
+// 'bdlma::CountingAllocator' (layered on the global heap), which allows the
+// memory held from the upstream allocator to be reported.
+//
+///Containers
+///----------
+//: 'list':          'bsl::list<int>'
+//: 'set':           'bsl::set<int>'
+//: 'unordered_set': 'bsl::unordered_set<int>'
+//: 'vector_string': 'bsl::vector<bsl::string>' (strings too long for SSO)
+//: 'vector_vector': 'bsl::vector<bsl::vector<int> >'
+//
+///Patterns
+///--------
+//: 'create-destroy':
+//:   Each iteration creates an allocator and a container using it, inserts
+//:   '--elements' elements, traverses the container, and destroys both
+//:   (N4468, "Benchmark I").  In 'shared' mode, a single allocator serves
+//:   every iteration of every thread.
+//:
+//: 'churn':
+//:   A single long-lived container of '--elements' elements has
+//:   '--iterations * --elements' randomly chosen elements replaced, which
+//:   scatters the elements across the memory supplied by the allocator
+//:   (P0089, "diffusion").  Locality is then measured as the time to
+//:   traverse the container, in nanoseconds per element.
+//
+///Threads
+///-------
+// Each configuration is run for every thread count supplied to '--threads'.
+// Each thread runs the same workload independently ('per-thread' sharing),
+// each with its own allocator.  Thread-safe allocators ('concurrentmultipool'
+// and, necessarily, 'newdelete') are additionally (respectively, only) run
+// with one allocator shared by all threads ('shared' sharing).
+//
+///Output
+///------
+// Each record holds the following fields:
+//..
+//  allocator       allocator name (see above)
+//  container       container name (see above)
+//  pattern         pattern name (see above)
+//  threads         number of threads
+//  sharing         'per-thread' or 'shared'
+//  iterations      value of '--iterations'
+//  elements        value of '--elements'
+//  seconds         median over '--repetitions' of the slowest thread's time
+//  ops_per_sec     element operations per second, summed over all threads
+//  traverse_ns     nanoseconds per element traversed ('churn' only)
+//  upstream_bytes  bytes held from the upstream allocator at the end of the
+//                  workload ('churn' only; not tracked for 'newdelete')
+//  upstream_total  total bytes ever requested from the upstream allocator
+//                  (not tracked for 'newdelete')
+//..
+// Fields that do not apply are empty in CSV and 'null' in JSON.
+//
+///Usage
+///-----
+//..
+//  allocbench [--format=csv|json] [--threads=1,2,4] [--iterations=N]
+//             [--elements=N] [--repetitions=N] [--seed=N]
+//             [--allocators=a,b,...] [--containers=a,b,...]
+//             [--patterns=a,b,...]
+//..
+// For example, to compare the pooled allocators on node-based containers
+// with up to eight threads (shown on several lines for readability):
+//..
+//  $ allocbench --format=json --threads=1,2,4,8
+//               --allocators=newdelete,multipool,concurrentmultipool
+//               --containers=list,set,unordered_set > results.json
+//..
+
+#include <bdlma_concurrentmultipoolallocator.h>
+#include <bdlma_countingallocator.h>
+#include <bdlma_localsequentialallocator.h>
+#include <bdlma_multipoolallocator.h>
+#include <bdlma_sequentialallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_newdeleteallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_assert.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_list.h>
+#include <bsl_set.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+namespace u {
+
+typedef bsls::Types::Int64 Int64;
+
+                              // ============
+                              // class Random
+                              // ============
+
+class Random {
+    // This class implements a small, fast, deterministic pseudo-random number
+    // generator ("xorshift32"), so that workloads are reproducible across
+    // platforms and standard libraries.
+
+    // DATA
+    unsigned int d_state;  // current state (never 0)
+
+  public:
+    // CREATORS
+    explicit Random(unsigned int seed)
+    : d_state(seed ? seed : 0x9E3779B9u)
+        // Create a generator seeded with the specified 'seed'.
+    {
+    }
+
+    // MANIPULATORS
+    unsigned int operator()()
+        // Return the next pseudo-random number.
+    {
+        d_state ^= d_state << 13;
+        d_state ^= d_state >> 17;
+        d_state ^= d_state << 5;
+        return d_state;
+    }
+
+    int uniform(int limit)
+        // Return a pseudo-random number in the range '[0 .. limit)'.  The
+        // behavior is undefined unless '0 < limit'.
+    {
+        return static_cast<int>((*this)() % static_cast<unsigned int>(limit));
+    }
+};
+
+                          // =====================
+                          // Container Descriptions
+                          // =====================
+
+// Each container description provides the container 'Type', its 'name', a
+// function to 'insert' one new element, a function to 'traverse' the
+// container touching every element, and a 'Churner' that replaces one
+// element per 'step' while keeping the size of the container constant.
+
+struct ListDescription {
+    typedef bsl::list<int> Type;
+
+    static const char *name() { return "list"; }
+
+    static void insert(Type *container, Random *random)
+    {
+        container->push_back(static_cast<int>((*random)()));
+    }
+
+    static Int64 traverse(const Type& container)
+    {
+        Int64 sum = 0;
+        for (Type::const_iterator it = container.begin();
+             it != container.end();
+             ++it) {
+            sum += *it;
+        }
+        return sum;
+    }
+
+    class Churner {
+        // Replace elements near a cursor that moves through the list by a
+        // random stride, so that nodes are freed and reused out of order.
+
+        Type           *d_container_p;
+        Type::iterator  d_cursor;
+
+        void advance(Random *random)
+        {
+            for (int n = random->uniform(4); 0 < n; --n) {
+                if (++d_cursor == d_container_p->end()) {
+                    d_cursor = d_container_p->begin();
+                }
+            }
+        }
+
+      public:
+        explicit Churner(Type *container)
+        : d_container_p(container)
+        , d_cursor(container->begin())
+        {
+        }
+
+        void step(Random *random)
+        {
+            advance(random);
+            d_cursor = d_container_p->erase(d_cursor);
+            if (d_cursor == d_container_p->end()) {
+                d_cursor = d_container_p->begin();
+            }
+            advance(random);
+            d_container_p->insert(d_cursor, static_cast<int>((*random)()));
+        }
+    };
+};
+
+struct SetDescription {
+    typedef bsl::set<int> Type;
+
+    static const char *name() { return "set"; }
+
+    static void insert(Type *container, Random *random)
+    {
+        while (!container->insert(static_cast<int>((*random)())).second) {
+        }
+    }
+
+    static Int64 traverse(const Type& container)
+    {
+        Int64 sum = 0;
+        for (Type::const_iterator it = container.begin();
+             it != container.end();
+             ++it) {
+            sum += *it;
+        }
+        return sum;
+    }
+
+    class Churner {
+        // Erase the element at or after a random key, and insert a new
+        // element with a random key.
+
+        Type *d_container_p;
+
+      public:
+        explicit Churner(Type *container)
+        : d_container_p(container)
+        {
+        }
+
+        void step(Random *random)
+        {
+            Type::iterator it =
+                  d_container_p->lower_bound(static_cast<int>((*random)()));
+            d_container_p->erase(it == d_container_p->end()
+                                 ? d_container_p->begin()
+                                 : it);
+            insert(d_container_p, random);
+        }
+    };
+};
+
+struct UnorderedSetDescription {
+    typedef bsl::unordered_set<int> Type;
+
+    static const char *name() { return "unordered_set"; }
+
+    static void insert(Type *container, Random *random)
+    {
+        while (!container->insert(static_cast<int>((*random)())).second) {
+        }
+    }
+
+    static Int64 traverse(const Type& container)
+    {
+        Int64 sum = 0;
+        for (Type::const_iterator it = container.begin();
+             it != container.end();
+             ++it) {
+            sum += *it;
+        }
+        return sum;
+    }
+
+    class Churner {
+        // Erase the element having a randomly chosen key among those in the
+        // container, and insert a new element with a random key.  The keys
+        // are tracked in a vector supplied by the default allocator, whose
+        // size does not change once constructed.
+
+        Type             *d_container_p;
+        bsl::vector<int>  d_keys;
+
+      public:
+        explicit Churner(Type *container)
+        : d_container_p(container)
+        , d_keys(container->begin(), container->end())
+        {
+        }
+
+        void step(Random *random)
+        {
+            const int index = random->uniform(static_cast<int>(d_keys.size()));
+            d_container_p->erase(d_keys[index]);
+
+            int key;
+            do {
+                key = static_cast<int>((*random)());
+            } while (!d_container_p->insert(key).second);
+            d_keys[index] = key;
+        }
+    };
+};
+
+struct VectorStringDescription {
+    typedef bsl::vector<bsl::string> Type;
+
+    static const char *name() { return "vector_string"; }
+
+    static void insert(Type *container, Random *random)
+    {
+        // Strings of 24 to 87 characters never fit in the short-string
+        // buffer, so each element owns memory from the allocator.
+
+        container->push_back(bsl::string());
+        container->back().assign(24 + random->uniform(64),
+                                 static_cast<char>('a' + random->uniform(26)));
+    }
+
+    static Int64 traverse(const Type& container)
+    {
+        Int64 sum = 0;
+        for (Type::const_iterator it = container.begin();
+             it != container.end();
+             ++it) {
+            sum += static_cast<Int64>(it->size()) + (*it)[it->size() / 2];
+        }
+        return sum;
+    }
+
+    class Churner {
+        // Destroy a randomly chosen element, and append a new one.
+
+        Type *d_container_p;
+
+      public:
+        explicit Churner(Type *container)
+        : d_container_p(container)
+        {
+        }
+
+        void step(Random *random)
+        {
+            const int index = random->uniform(
+                                   static_cast<int>(d_container_p->size()));
+            (*d_container_p)[index].swap(d_container_p->back());
+            d_container_p->pop_back();
+            insert(d_container_p, random);
+        }
+    };
+};
+
+struct VectorVectorDescription {
+    typedef bsl::vector<bsl::vector<int> > Type;
+
+    static const char *name() { return "vector_vector"; }
+
+    static void insert(Type *container, Random *random)
+    {
+        container->push_back(bsl::vector<int>());
+        container->back().resize(1 + random->uniform(16),
+                                 static_cast<int>((*random)()));
+    }
+
+    static Int64 traverse(const Type& container)
+    {
+        Int64 sum = 0;
+        for (Type::const_iterator it = container.begin();
+             it != container.end();
+             ++it) {
+            for (bsl::vector<int>::const_iterator jt = it->begin();
+                 jt != it->end();
+                 ++jt) {
+                sum += *jt;
+            }
+        }
+        return sum;
+    }
+
+    class Churner {
+        // Destroy a randomly chosen element, and append a new one.
+
+        Type *d_container_p;
+
+      public:
+        explicit Churner(Type *container)
+        : d_container_p(container)
+        {
+        }
+
+        void step(Random *random)
+        {
+            const int index = random->uniform(
+                                   static_cast<int>(d_container_p->size()));
+            (*d_container_p)[index].swap(d_container_p->back());
+            d_container_p->pop_back();
+            insert(d_container_p, random);
+        }
+    };
+};
+
+                         // ======================
+                         // Allocator Construction
+                         // ======================
+
+enum AllocatorKind {
+    e_NEW_DELETE,
+    e_MULTIPOOL,
+    e_SEQUENTIAL,
+    e_CONCURRENT_MULTIPOOL,
+    e_LOCAL_SEQUENTIAL
+};
+
+struct AllocatorDescription {
+    AllocatorKind  d_kind;
+    const char    *d_name;
+    bool           d_isThreadSafe;  // may be shared by several threads
+    bool           d_isGlobal;      // the single, process-wide allocator
+};
+
+static const AllocatorDescription k_ALLOCATORS[] = {
+    { e_NEW_DELETE,           "newdelete",           true,  true  },
+    { e_MULTIPOOL,            "multipool",           false, false },
+    { e_SEQUENTIAL,           "sequential",          false, false },
+    { e_CONCURRENT_MULTIPOOL, "concurrentmultipool", true,  false },
+    { e_LOCAL_SEQUENTIAL,     "localsequential",     false, false }
+};
+
+enum { k_NUM_ALLOCATORS = sizeof k_ALLOCATORS / sizeof *k_ALLOCATORS };
+
+enum { k_LOCAL_ARENA_SIZE = 16 * 1024 };
+
+template <class WORK>
+void withAllocator(AllocatorKind     kind,
+                   bslma::Allocator *upstream,
+                   WORK             *work)
+    // Create an allocator of the specified 'kind' that obtains its memory
+    // from the specified 'upstream' allocator, invoke the specified 'work'
+    // with its address, and destroy the allocator.
+{
+    switch (kind) {
+      case e_NEW_DELETE: {
+        (*work)(&bslma::NewDeleteAllocator::singleton());
+      } break;
+      case e_MULTIPOOL: {
+        bdlma::MultipoolAllocator allocator(upstream);
+        (*work)(&allocator);
+      } break;
+      case e_SEQUENTIAL: {
+        bdlma::SequentialAllocator allocator(upstream);
+        (*work)(&allocator);
+      } break;
+      case e_CONCURRENT_MULTIPOOL: {
+        bdlma::ConcurrentMultipoolAllocator allocator(upstream);
+        (*work)(&allocator);
+      } break;
+      case e_LOCAL_SEQUENTIAL: {
+        bdlma::LocalSequentialAllocator<k_LOCAL_ARENA_SIZE> allocator(
+                                                                     upstream);
+        (*work)(&allocator);
+      } break;
+    }
+}
+
+                             // ==============
+                             // Thread Context
+                             // ==============
+
+enum Pattern {
+    e_CREATE_DESTROY,
+    e_CHURN
+};
+
+static const char *const k_PATTERNS[] = { "create-destroy", "churn" };
+
+enum { k_NUM_PATTERNS = sizeof k_PATTERNS / sizeof *k_PATTERNS };
+
+struct Config {
+    // This 'struct' holds the parameters shared by every run.
+
+    int          d_iterations;   // iterations (or churn passes) per thread
+    int          d_elements;     // elements per container
+    int          d_traversals;   // traversals for the locality measurement
+    unsigned int d_seed;         // seed for the first thread
+};
+
+struct ThreadContext {
+    // This 'struct' holds the inputs and outputs of one benchmark thread.
+
+    // INPUTS
+    const Config             *d_config_p;
+    Pattern                   d_pattern;
+    AllocatorKind             d_allocatorKind;
+    bslma::Allocator         *d_sharedAllocator_p;  // 0 unless 'shared'
+    bdlma::CountingAllocator *d_upstream_p;         // 0 for 'newdelete'
+    bslmt::Barrier           *d_barrier_p;
+    unsigned int              d_seed;
+
+    // OUTPUTS
+    Int64                     d_elapsedNs;          // timed work
+    double                    d_traverseNs;         // per element
+    Int64                     d_upstreamBytes;      // at end of 'churn'
+    Int64                     d_checksum;           // defeats optimizer
+};
+
+template <class DESC>
+struct CreateDestroyWork {
+    // Fill, traverse, and destroy one container.
+
+    ThreadContext *d_context_p;
+    Random        *d_random_p;
+
+    void operator()(bslma::Allocator *allocator)
+    {
+        typename DESC::Type container(allocator);
+        for (int i = 0; i < d_context_p->d_config_p->d_elements; ++i) {
+            DESC::insert(&container, d_random_p);
+        }
+        d_context_p->d_checksum += DESC::traverse(container);
+    }
+};
+
+template <class DESC>
+struct ChurnWork {
+    // Fill one container, churn it, and measure the cost of traversing it.
+
+    ThreadContext *d_context_p;
+    Random        *d_random_p;
+
+    void operator()(bslma::Allocator *allocator)
+    {
+        ThreadContext& context = *d_context_p;
+        const Config&  config  = *context.d_config_p;
+
+        typename DESC::Type container(allocator);
+        for (int i = 0; i < config.d_elements; ++i) {
+            DESC::insert(&container, d_random_p);
+        }
+
+        typename DESC::Churner churner(&container);
+
+        const Int64 numSteps = static_cast<Int64>(config.d_iterations)
+                                                          * config.d_elements;
+
+        const Int64 start = bsls::TimeUtil::getTimer();
+        for (Int64 i = 0; i < numSteps; ++i) {
+            churner.step(d_random_p);
+        }
+        context.d_elapsedNs = bsls::TimeUtil::getTimer() - start;
+
+        const Int64 traverseStart = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < config.d_traversals; ++i) {
+            context.d_checksum += DESC::traverse(container);
+        }
+        context.d_traverseNs =
+            static_cast<double>(bsls::TimeUtil::getTimer() - traverseStart)
+          / (static_cast<double>(config.d_traversals) * config.d_elements);
+
+        if (context.d_upstream_p) {
+            context.d_upstreamBytes = context.d_upstream_p->numBytesInUse();
+        }
+    }
+};
+
+template <class DESC>
+void runThread(ThreadContext *context)
+    // Run the workload described by the specified 'context' on a container
+    // described by 'DESC'.
+{
+    Random random(context->d_seed);
+
+    context->d_barrier_p->wait();
+
+    if (e_CHURN == context->d_pattern) {
+        ChurnWork<DESC> work = { context, &random };
+        if (context->d_sharedAllocator_p) {
+            work(context->d_sharedAllocator_p);
+        }
+        else {
+            withAllocator(context->d_allocatorKind,
+                          context->d_upstream_p,
+                          &work);
+        }
+        return;                                                       // RETURN
+    }
+
+    CreateDestroyWork<DESC> work = { context, &random };
+    const int               numIterations = context->d_config_p->d_iterations;
+
+    const Int64 start = bsls::TimeUtil::getTimer();
+    if (context->d_sharedAllocator_p) {
+        for (int i = 0; i < numIterations; ++i) {
+            work(context->d_sharedAllocator_p);
+        }
+    }
+    else {
+        for (int i = 0; i < numIterations; ++i) {
+            withAllocator(context->d_allocatorKind,
+                          context->d_upstream_p,
+                          &work);
+        }
+    }
+    context->d_elapsedNs = bsls::TimeUtil::getTimer() - start;
+}
+
+typedef void (*RunThreadFunction)(ThreadContext *);
+
+struct ContainerEntry {
+    const char        *d_name;
+    RunThreadFunction  d_run;
+};
+
+static const ContainerEntry k_CONTAINERS[] = {
+    { ListDescription::name(),         &runThread<ListDescription>         },
+    { SetDescription::name(),          &runThread<SetDescription>          },
+    { UnorderedSetDescription::name(), &runThread<UnorderedSetDescription> },
+    { VectorStringDescription::name(), &runThread<VectorStringDescription> },
+    { VectorVectorDescription::name(), &runThread<VectorVectorDescription> }
+};
+
+enum { k_NUM_CONTAINERS = sizeof k_CONTAINERS / sizeof *k_CONTAINERS };
+
+struct ThreadFunctor {
+    // Invoke a 'RunThreadFunction' on a 'ThreadContext' in a new thread.
+
+    RunThreadFunction  d_run;
+    ThreadContext     *d_context_p;
+
+    void operator()() const
+    {
+        d_run(d_context_p);
+    }
+};
+
+                                // ==========
+                                // Benchmarks
+                                // ==========
+
+struct Result {
+    // This 'struct' holds the measurements of one run of one configuration.
+
+    double d_seconds;
+    double d_opsPerSecond;
+    double d_traverseNs;     // negative if not measured
+    Int64  d_upstreamBytes;  // negative if not measured
+    Int64  d_upstreamTotal;  // negative if not measured
+
+    bool operator<(const Result& rhs) const
+    {
+        return d_seconds < rhs.d_seconds;
+    }
+};
+
+struct Run {
+    // This 'struct' identifies one configuration to be measured.
+
+    const AllocatorDescription *d_allocator_p;
+    const ContainerEntry       *d_container_p;
+    Pattern                     d_pattern;
+    int                         d_numThreads;
+    bool                        d_isShared;
+};
+
+struct SharedRunWork {
+    // Start the threads of a 'shared' run, using the supplied allocator for
+    // every thread.
+
+    const Run                   *d_run_p;
+    bsl::vector<ThreadContext>  *d_contexts_p;
+
+    void operator()(bslma::Allocator *allocator)
+    {
+        bslmt::ThreadGroup group;
+        for (bsl::size_t i = 0; i < d_contexts_p->size(); ++i) {
+            (*d_contexts_p)[i].d_sharedAllocator_p = allocator;
+            ThreadFunctor functor = { d_run_p->d_container_p->d_run,
+                                      &(*d_contexts_p)[i] };
+            int rc = group.addThread(functor);
+            BSLS_ASSERT_OPT(0 == rc);  (void)rc;
+        }
+        group.joinAll();
+    }
+};
+
+Result measure(const Run& run, const Config& config, int repetition)
+    // Run the specified 'run' once with the specified 'config', seeding the
+    // threads based on the specified 'repetition', and return the results.
+{
+    const int numThreads = run.d_numThreads;
+
+    bslmt::Barrier                            barrier(numThreads);
+    bsl::vector<ThreadContext>                contexts(numThreads);
+    bsl::vector<bdlma::CountingAllocator *>   upstreams;
+
+    const bool isTracked = !run.d_allocator_p->d_isGlobal;
+    const int  numUpstreams = !isTracked   ? 0
+                            : run.d_isShared ? 1
+                            : numThreads;
+
+    for (int i = 0; i < numUpstreams; ++i) {
+        upstreams.push_back(new bdlma::CountingAllocator(
+                                 &bslma::NewDeleteAllocator::singleton()));
+    }
+
+    for (int i = 0; i < numThreads; ++i) {
+        ThreadContext& context = contexts[i];
+
+        context.d_config_p          = &config;
+        context.d_pattern           = run.d_pattern;
+        context.d_allocatorKind     = run.d_allocator_p->d_kind;
+        context.d_sharedAllocator_p = 0;
+        context.d_upstream_p        = !isTracked     ? 0
+                                    : run.d_isShared ? upstreams[0]
+                                    : upstreams[i];
+        context.d_barrier_p         = &barrier;
+        context.d_seed              = config.d_seed
+                                    + 7919u * static_cast<unsigned>(i)
+                                    + 104729u
+                                         * static_cast<unsigned>(repetition);
+        context.d_elapsedNs         = 0;
+        context.d_traverseNs        = 0;
+        context.d_upstreamBytes     = 0;
+        context.d_checksum          = 0;
+    }
+
+    if (run.d_isShared) {
+        SharedRunWork work = { &run, &contexts };
+        withAllocator(run.d_allocator_p->d_kind,
+                      numUpstreams ? upstreams[0] : 0,
+                      &work);
+    }
+    else {
+        bslmt::ThreadGroup group;
+        for (int i = 0; i < numThreads; ++i) {
+            ThreadFunctor functor = { run.d_container_p->d_run,
+                                      &contexts[i] };
+            int rc = group.addThread(functor);
+            BSLS_ASSERT_OPT(0 == rc);  (void)rc;
+        }
+        group.joinAll();
+    }
+
+    static volatile Int64 sink;
+
+    Int64  maxElapsedNs  = 0;
+    double traverseNs    = 0;
+    Int64  upstreamBytes = 0;
+    for (int i = 0; i < numThreads; ++i) {
+        maxElapsedNs   = bsl::max(maxElapsedNs, contexts[i].d_elapsedNs);
+        traverseNs    += contexts[i].d_traverseNs;
+        upstreamBytes  = run.d_isShared
+                         ? bsl::max(upstreamBytes,
+                                    contexts[i].d_upstreamBytes)
+                         : upstreamBytes + contexts[i].d_upstreamBytes;
+        sink           = sink + contexts[i].d_checksum;
+    }
+
+    Int64 upstreamTotal = 0;
+    for (int i = 0; i < numUpstreams; ++i) {
+        upstreamTotal += upstreams[i]->numBytesTotal();
+        delete upstreams[i];
+    }
+
+    const double numOps = static_cast<double>(numThreads)
+                        * config.d_iterations
+                        * config.d_elements;
+
+    Result result;
+    result.d_seconds       = static_cast<double>(maxElapsedNs) / 1.0e9;
+    result.d_opsPerSecond  = result.d_seconds > 0
+                             ? numOps / result.d_seconds
+                             : 0;
+    result.d_traverseNs    = e_CHURN == run.d_pattern
+                             ? traverseNs / numThreads
+                             : -1;
+    result.d_upstreamBytes = e_CHURN == run.d_pattern && isTracked
+                             ? upstreamBytes
+                             : -1;
+    result.d_upstreamTotal = isTracked ? upstreamTotal : -1;
+    return result;
+}
+
+                                // ======
+                                // Output
+                                // ======
+
+class Writer {
+    // This class writes benchmark records as CSV or as a JSON array.
+
+    // DATA
+    bsl::ostream& d_stream;
+    bool          d_isJson;
+    int           d_numRecords;
+
+  public:
+    // CREATORS
+    Writer(bsl::ostream& stream, bool isJson)
+    : d_stream(stream)
+    , d_isJson(isJson)
+    , d_numRecords(0)
+    {
+        if (d_isJson) {
+            d_stream << "[\n";
+        }
+        else {
+            d_stream << "allocator,container,pattern,threads,sharing,"
+                        "iterations,elements,seconds,ops_per_sec,"
+                        "traverse_ns,upstream_bytes,upstream_total\n";
+        }
+    }
+
+    ~Writer()
+    {
+        if (d_isJson) {
+            d_stream << (d_numRecords ? "\n]\n" : "]\n");
+        }
+        d_stream.flush();
+    }
+
+    // MANIPULATORS
+    void write(const Run& run, const Config& config, const Result& result)
+    {
+        bsl::ostringstream traverseNs;
+        bsl::ostringstream upstreamBytes;
+        bsl::ostringstream upstreamTotal;
+
+        const char *none = d_isJson ? "null" : "";
+
+        if (0 <= result.d_traverseNs)    traverseNs << result.d_traverseNs;
+        else                             traverseNs << none;
+        if (0 <= result.d_upstreamBytes) upstreamBytes
+                                                  << result.d_upstreamBytes;
+        else                             upstreamBytes << none;
+        if (0 <= result.d_upstreamTotal) upstreamTotal
+                                                  << result.d_upstreamTotal;
+        else                             upstreamTotal << none;
+
+        const char *sharing = run.d_isShared ? "shared" : "per-thread";
+
+        if (d_isJson) {
+            d_stream << (d_numRecords ? ",\n" : "")
+                     << "  {\"allocator\": \""
+                     << run.d_allocator_p->d_name << "\""
+                     << ", \"container\": \""
+                     << run.d_container_p->d_name << "\""
+                     << ", \"pattern\": \""
+                     << k_PATTERNS[run.d_pattern] << "\""
+                     << ", \"threads\": " << run.d_numThreads
+                     << ", \"sharing\": \"" << sharing << "\""
+                     << ", \"iterations\": " << config.d_iterations
+                     << ", \"elements\": " << config.d_elements
+                     << ", \"seconds\": " << result.d_seconds
+                     << ", \"ops_per_sec\": " << result.d_opsPerSecond
+                     << ", \"traverse_ns\": " << traverseNs.str()
+                     << ", \"upstream_bytes\": " << upstreamBytes.str()
+                     << ", \"upstream_total\": " << upstreamTotal.str()
+                     << "}";
+        }
+        else {
+            d_stream << run.d_allocator_p->d_name << ','
+                     << run.d_container_p->d_name << ','
+                     << k_PATTERNS[run.d_pattern] << ','
+                     << run.d_numThreads << ','
+                     << sharing << ','
+                     << config.d_iterations << ','
+                     << config.d_elements << ','
+                     << result.d_seconds << ','
+                     << result.d_opsPerSecond << ','
+                     << traverseNs.str() << ','
+                     << upstreamBytes.str() << ','
+                     << upstreamTotal.str() << '\n';
+        }
+        d_stream.flush();
+        ++d_numRecords;
+    }
+};
+
+                          // ======================
+                          // Command-Line Arguments
+                          // ======================
+
+bool parseList(bsl::vector<bsl::string> *result, const char *text)
+    // Load into the specified 'result' the comma-separated items in the
+    // specified 'text'.  Return 'true' if at least one item was found, and
+    // 'false' otherwise.
+{
+    result->clear();
+    bsl::string item;
+    for (const char *p = text; ; ++p) {
+        if (',' == *p || 0 == *p) {
+            if (!item.empty()) {
+                result->push_back(item);
+            }
+            item.clear();
+            if (0 == *p) {
+                break;
+            }
+        }
+        else {
+            item += *p;
+        }
+    }
+    return !result->empty();
+}
+
+bool parsePositive(int *result, const char *text)
+    // Load into the specified 'result' the positive integer in the specified
+    // 'text'.  Return 'true' on success, and 'false' otherwise.
+{
+    char *end;
+    long  value = bsl::strtol(text, &end, 10);
+    if (end == text || *end || value <= 0 || value > 1000000000L) {
+        return false;                                                 // RETURN
+    }
+    *result = static_cast<int>(value);
+    return true;
+}
+
+bool contains(const bsl::vector<bsl::string>& names, const char *name)
+    // Return 'true' if the specified 'names' is empty or contains the
+    // specified 'name', and 'false' otherwise.
+{
+    return names.empty()
+        || names.end() != bsl::find(names.begin(), names.end(), name);
+}
+
+template <class ENTRY>
+bool validate(const bsl::vector<bsl::string>&  names,
+              const ENTRY                     *entries,
+              int                              numEntries,
+              const char                      *what)
+    // Return 'true' if every one of the specified 'names' is the 'd_name' of
+    // one of the specified 'numEntries' 'entries', and otherwise report the
+    // unknown name as the specified 'what' and return 'false'.
+{
+    for (bsl::size_t i = 0; i < names.size(); ++i) {
+        bool found = false;
+        for (int j = 0; j < numEntries; ++j) {
+            found = found || names[i] == entries[j].d_name;
+        }
+        if (!found) {
+            bsl::cerr << "Unknown " << what << " '" << names[i] << "'\n";
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+void usage(const char *program)
+    // Write the usage of this program, invoked as the specified 'program',
+    // to 'bsl::cerr'.
+{
+    bsl::cerr
+        << "usage: " << program << " [options]\n"
+           "  --format=csv|json        output format (default: csv)\n"
+           "  --threads=N[,N...]       thread counts (default: 1)\n"
+           "  --iterations=N           iterations per thread (default: 100)\n"
+           "  --elements=N             elements per container "
+                                                          "(default: 1000)\n"
+           "  --repetitions=N          runs per configuration, reporting "
+                                                          "the median\n"
+           "                           (default: 3)\n"
+           "  --seed=N                 random seed (default: 1)\n"
+           "  --allocators=a[,b...]    newdelete, multipool, sequential,\n"
+           "                           concurrentmultipool, localsequential\n"
+           "  --containers=a[,b...]    list, set, unordered_set, "
+                                                            "vector_string,\n"
+           "                           vector_vector\n"
+           "  --patterns=a[,b...]      create-destroy, churn\n";
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+//=============================================================================
+//                                 MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    bsls::TimeUtil::initialize();
+
+    u::Config config;
+    config.d_iterations = 100;
+    config.d_elements   = 1000;
+    config.d_traversals = 20;
+    config.d_seed       = 1;
+
+    bool                     isJson         = false;
+    int                      numRepetitions = 3;
+    bsl::vector<int>         threadCounts(1, 1);
+    bsl::vector<bsl::string> allocators;
+    bsl::vector<bsl::string> containers;
+    bsl::vector<bsl::string> patterns;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg   = argv[i];
+        const char *value = bsl::strchr(arg, '=');
+        if (0 == bsl::strncmp(arg, "--", 2) && value) {
+            ++value;
+        }
+        else {
+            u::usage(argv[0]);
+            return 1;                                                 // RETURN
+        }
+
+        const bsl::string name(arg + 2, value - 1);
+        bool              isValid = true;
+        int               seed    = 0;
+
+        bsl::vector<bsl::string> items;
+
+        if ("format" == name) {
+            isJson  = 0 == bsl::strcmp(value, "json");
+            isValid = isJson || 0 == bsl::strcmp(value, "csv");
+        }
+        else if ("threads" == name) {
+            isValid = u::parseList(&items, value);
+            threadCounts.clear();
+            for (bsl::size_t j = 0; isValid && j < items.size(); ++j) {
+                int count;
+                isValid = u::parsePositive(&count, items[j].c_str());
+                threadCounts.push_back(count);
+            }
+        }
+        else if ("iterations" == name) {
+            isValid = u::parsePositive(&config.d_iterations, value);
+        }
+        else if ("elements" == name) {
+            isValid = u::parsePositive(&config.d_elements, value);
+        }
+        else if ("repetitions" == name) {
+            isValid = u::parsePositive(&numRepetitions, value);
+        }
+        else if ("seed" == name) {
+            isValid = u::parsePositive(&seed, value);
+            config.d_seed = static_cast<unsigned int>(seed);
+        }
+        else if ("allocators" == name) {
+            isValid = u::parseList(&allocators, value)
+                   && u::validate(allocators,
+                                  u::k_ALLOCATORS,
+                                  u::k_NUM_ALLOCATORS,
+                                  "allocator");
+        }
+        else if ("containers" == name) {
+            isValid = u::parseList(&containers, value)
+                   && u::validate(containers,
+                                  u::k_CONTAINERS,
+                                  u::k_NUM_CONTAINERS,
+                                  "container");
+        }
+        else if ("patterns" == name) {
+            isValid = u::parseList(&patterns, value);
+            for (bsl::size_t j = 0; isValid && j < patterns.size(); ++j) {
+                isValid = "create-destroy" == patterns[j]
+                       || "churn"          == patterns[j];
+            }
+        }
+        else {
+            isValid = false;
+        }
+
+        if (!isValid) {
+            bsl::cerr << "Invalid argument '" << arg << "'\n";
+            u::usage(argv[0]);
+            return 1;                                                 // RETURN
+        }
+    }
+
+    u::Writer writer(bsl::cout, isJson);
+
+    for (int a = 0; a < u::k_NUM_ALLOCATORS; ++a) {
+        const u::AllocatorDescription& allocator = u::k_ALLOCATORS[a];
+        if (!u::contains(allocators, allocator.d_name)) {
+            continue;                                               // CONTINUE
+        }
+        for (int c = 0; c < u::k_NUM_CONTAINERS; ++c) {
+            const u::ContainerEntry& container = u::k_CONTAINERS[c];
+            if (!u::contains(containers, container.d_name)) {
+                continue;                                           // CONTINUE
+            }
+            for (int p = 0; p < u::k_NUM_PATTERNS; ++p) {
+                if (!u::contains(patterns, u::k_PATTERNS[p])) {
+                    continue;                                       // CONTINUE
+                }
+                for (bsl::size_t t = 0; t < threadCounts.size(); ++t) {
+                    for (int s = 0; s < 2; ++s) {
+                        const bool isShared = 1 == s;
+
+                        // The global allocator is always shared; others are
+                        // shared only if they are thread-safe and there is
+                        // more than one thread to share them.
+
+                        const bool isApplicable = allocator.d_isGlobal
+                                                ? isShared
+                                                : !isShared
+                                               || (allocator.d_isThreadSafe
+                                                && 1 < threadCounts[t]);
+                        if (!isApplicable) {
+                            continue;                               // CONTINUE
+                        }
+
+                        u::Run run = { &allocator,
+                                       &container,
+                                       static_cast<u::Pattern>(p),
+                                       threadCounts[t],
+                                       isShared };
+
+                        bsl::vector<u::Result> results;
+                        for (int r = 0; r < numRepetitions; ++r) {
+                            results.push_back(u::measure(run, config, r));
+                        }
+                        bsl::sort(results.begin(), results.end());
+
+                        writer.write(run, config, results[results.size() / 2]);
+                    }
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
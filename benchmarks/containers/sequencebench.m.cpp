@@ -0,0 +1,679 @@
+// sequencebench.m.cpp                                                -*-C++-*-
+
+//@PURPOSE: Benchmark bulk insertion and erasure in 'bsl' sequence containers.
+//
+//@DESCRIPTION: This program measures the run time of bulk operations (fill,
+// range insertion, and range erasure) on 'bsl::vector' and 'bsl::deque' of
+// bit-wise copyable element types, for container sizes ranging from a few
+// cache lines to many times the size of the last-level cache.  These
+// operations are dominated by the bit-wise kernels of
+// 'bslalg::ArrayPrimitives' (fill, 'memmove', and rotate), so this program is
+// the reference for measuring changes to those kernels.  One record is written
+// per configuration in CSV or JSON format, so that results may be archived and
+// compared over time.
+//
+///Containers
+///----------
+//: 'vector': 'bsl::vector<TYPE>'
+//: 'deque':  'bsl::deque<TYPE>'
+//
+///Element Types
+///-------------
+//: 'int':    'int' (4 bytes)
+//: 'double': 'double' (8 bytes)
+//: 'record': a trivially copyable 'struct' of 24 bytes, whose size does not
+//:           divide the 64 bytes stored per iteration of the vectorized fill
+//:           kernel, and which therefore uses the scalar fill
+//
+///Operations
+///----------
+// Every operation other than 'assign-fill' is applied to a container of
+// '--elements' elements, at its middle, on a batch of 'elements / 16' (but at
+// least one) elements.  The container is restored to its original size after
+// each operation, outside of the timed region.
+//: 'assign-fill':  'assign(elements, value)' on a container of 'elements'
+//:                 elements
+//:
+//: 'insert-fill':  'insert(middle, batch, value)'
+//:
+//: 'insert-range': 'insert(middle, first, last)' from a range of pointers
+//:
+//: 'insert-input': 'insert(middle, first, last)' from a range of input
+//:                 iterators, which, for 'bsl::vector', appends the new
+//:                 elements and rotates them into place
+//:
+//: 'erase-range':  'erase(middle, middle + batch)'
+//
+///Output
+///------
+// Each record holds the following fields:
+//..
+//  container   container name (see above)
+//  type        element type name (see above)
+//  operation   operation name (see above)
+//  elements    number of elements in the container
+//  batch       number of elements inserted or erased per operation
+//  iterations  number of operations timed
+//  seconds     median over '--repetitions' of the total time of the timed
+//              operations
+//  ns_per_op   nanoseconds per operation
+//  gb_per_sec  approximate rate at which the operation moves or writes
+//              elements: the bytes in the batch and in the half of the
+//              container that is displaced ('elements' bytes for
+//              'assign-fill'), per operation, in units of 10^9 bytes per
+//              second
+//..
+//
+///Usage
+///-----
+//..
+//  sequencebench [--format=csv|json] [--elements=N[,N...]]
+//                [--iterations=N] [--repetitions=N]
+//                [--containers=a,b,...] [--types=a,b,...]
+//                [--operations=a,b,...]
+//..
+// For example, to measure the fill and rotate kernels on large vectors of
+// 'int' (shown on several lines for readability):
+//..
+//  $ sequencebench --format=json --elements=1000000,16000000
+//                  --containers=vector --types=int
+//                  --operations=assign-fill,insert-fill,insert-input
+//..
+
+#include <bslmf_istriviallycopyable.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_deque.h>
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+namespace u {
+
+typedef bsls::Types::Int64 Int64;
+
+                              // =============
+                              // Element Types
+                              // =============
+
+struct Record {
+    // This trivially copyable 'struct' has a size (24 bytes) that does not
+    // divide 64.
+
+    int d_fields[6];
+
+    BSLMF_NESTED_TRAIT_DECLARATION(Record, bsl::is_trivially_copyable);
+};
+
+template <class TYPE>
+struct ElementType;
+    // This 'struct' template provides the 'name' of the (template parameter)
+    // 'TYPE', and a function to 'make' a value of that type from an 'int'.
+
+template <>
+struct ElementType<int> {
+    static const char *name() { return "int"; }
+    static int make(int i) { return i; }
+};
+
+template <>
+struct ElementType<double> {
+    static const char *name() { return "double"; }
+    static double make(int i) { return 0.5 * i; }
+};
+
+template <>
+struct ElementType<Record> {
+    static const char *name() { return "record"; }
+    static Record make(int i)
+    {
+        Record result;
+        for (int j = 0; j < 6; ++j) {
+            result.d_fields[j] = i + j;
+        }
+        return result;
+    }
+};
+
+                            // ===================
+                            // class InputIterator
+                            // ===================
+
+template <class TYPE>
+class InputIterator {
+    // This class adapts a pointer to a single-pass input iterator, so that
+    // range insertion cannot compute the length of the range in advance.
+
+    // DATA
+    const TYPE *d_current_p;
+
+  public:
+    // TYPES
+    typedef bsl::input_iterator_tag iterator_category;
+    typedef TYPE                    value_type;
+    typedef bsl::ptrdiff_t          difference_type;
+    typedef const TYPE             *pointer;
+    typedef const TYPE&             reference;
+
+    // CREATORS
+    explicit InputIterator(const TYPE *current)
+    : d_current_p(current)
+    {
+    }
+
+    // MANIPULATORS
+    InputIterator& operator++()
+    {
+        ++d_current_p;
+        return *this;
+    }
+
+    InputIterator operator++(int)
+    {
+        InputIterator result(*this);
+        ++d_current_p;
+        return result;
+    }
+
+    // ACCESSORS
+    reference operator*() const
+    {
+        return *d_current_p;
+    }
+
+    pointer operator->() const
+    {
+        return d_current_p;
+    }
+
+    bool operator==(const InputIterator& rhs) const
+    {
+        return d_current_p == rhs.d_current_p;
+    }
+
+    bool operator!=(const InputIterator& rhs) const
+    {
+        return d_current_p != rhs.d_current_p;
+    }
+};
+
+                                // ==========
+                                // Benchmarks
+                                // ==========
+
+enum Operation {
+    e_ASSIGN_FILL,
+    e_INSERT_FILL,
+    e_INSERT_RANGE,
+    e_INSERT_INPUT,
+    e_ERASE_RANGE
+};
+
+static const char *const k_OPERATIONS[] = {
+    "assign-fill",
+    "insert-fill",
+    "insert-range",
+    "insert-input",
+    "erase-range"
+};
+
+enum { k_NUM_OPERATIONS = sizeof k_OPERATIONS / sizeof *k_OPERATIONS };
+
+enum { k_BATCH_DIVISOR = 16 };
+
+struct Config {
+    // This 'struct' holds the parameters of one configuration.
+
+    Operation   d_operation;
+    bsl::size_t d_elements;    // elements per container
+    bsl::size_t d_batch;       // elements inserted or erased per operation
+    int         d_iterations;  // operations timed
+};
+
+struct Result {
+    // This 'struct' holds the measurements of one run of one configuration.
+
+    double d_seconds;
+    double d_nsPerOp;
+    double d_gbPerSecond;
+
+    bool operator<(const Result& rhs) const
+    {
+        return d_seconds < rhs.d_seconds;
+    }
+};
+
+template <class CONTAINER>
+Result measure(const Config& config)
+    // Run the operation described by the specified 'config' on a container of
+    // type 'CONTAINER', and return the results.
+{
+    typedef typename CONTAINER::value_type VALUE;
+    typedef ElementType<VALUE>             Element;
+
+    const bsl::size_t numElements = config.d_elements;
+    const bsl::size_t batch       = config.d_batch;
+    const bsl::size_t middle      = numElements / 2;
+
+    CONTAINER container;
+    for (bsl::size_t i = 0; i < numElements; ++i) {
+        container.push_back(Element::make(static_cast<int>(i)));
+    }
+
+    bsl::vector<VALUE> source;
+    for (bsl::size_t i = 0; i < batch; ++i) {
+        source.push_back(Element::make(-static_cast<int>(i)));
+    }
+    const VALUE *first = source.data();
+    const VALUE *last  = first + batch;
+    const VALUE  value = Element::make(7);
+
+    Int64 elapsedNs = 0;
+
+    for (int i = 0; i < config.d_iterations; ++i) {
+        const Int64 start = bsls::TimeUtil::getTimer();
+
+        switch (config.d_operation) {
+          case e_ASSIGN_FILL: {
+            container.assign(numElements, value);
+          } break;
+          case e_INSERT_FILL: {
+            container.insert(container.begin() + middle, batch, value);
+          } break;
+          case e_INSERT_RANGE: {
+            container.insert(container.begin() + middle, first, last);
+          } break;
+          case e_INSERT_INPUT: {
+            container.insert(container.begin() + middle,
+                             InputIterator<VALUE>(first),
+                             InputIterator<VALUE>(last));
+          } break;
+          case e_ERASE_RANGE: {
+            container.erase(container.begin() + middle,
+                            container.begin() + middle + batch);
+          } break;
+        }
+
+        elapsedNs += bsls::TimeUtil::getTimer() - start;
+
+        // Restore the original size.
+
+        if (e_ERASE_RANGE == config.d_operation) {
+            container.insert(container.begin() + middle, first, last);
+        }
+        else if (e_ASSIGN_FILL != config.d_operation) {
+            container.erase(container.begin() + middle,
+                            container.begin() + middle + batch);
+        }
+    }
+
+    const double bytesPerOp = static_cast<double>(sizeof(VALUE))
+                            * (e_ASSIGN_FILL == config.d_operation
+                               ? static_cast<double>(numElements)
+                               : static_cast<double>(numElements - middle
+                                                                   + batch));
+
+    Result result;
+    result.d_seconds     = static_cast<double>(elapsedNs) / 1.0e9;
+    result.d_nsPerOp     = static_cast<double>(elapsedNs)
+                         / config.d_iterations;
+    result.d_gbPerSecond = 0 < elapsedNs
+                         ? bytesPerOp * config.d_iterations / elapsedNs
+                         : 0;
+    return result;
+}
+
+typedef Result (*MeasureFunction)(const Config&);
+
+struct Entry {
+    // This 'struct' describes one combination of container and element type.
+
+    const char      *d_container;
+    const char      *d_type;
+    MeasureFunction  d_measure;
+};
+
+static const Entry k_ENTRIES[] = {
+    { "vector", "int",    &measure<bsl::vector<int> >    },
+    { "vector", "double", &measure<bsl::vector<double> > },
+    { "vector", "record", &measure<bsl::vector<Record> > },
+    { "deque",  "int",    &measure<bsl::deque<int> >     },
+    { "deque",  "double", &measure<bsl::deque<double> >  },
+    { "deque",  "record", &measure<bsl::deque<Record> >  }
+};
+
+enum { k_NUM_ENTRIES = sizeof k_ENTRIES / sizeof *k_ENTRIES };
+
+static const char *const k_CONTAINERS[] = { "vector", "deque" };
+static const char *const k_TYPES[]      = { "int", "double", "record" };
+
+enum {
+    k_NUM_CONTAINERS = sizeof k_CONTAINERS / sizeof *k_CONTAINERS,
+    k_NUM_TYPES      = sizeof k_TYPES      / sizeof *k_TYPES
+};
+
+int defaultIterations(bsl::size_t numElements)
+    // Return the number of operations to time on a container of the specified
+    // 'numElements' elements if '--iterations' is not supplied, chosen so that
+    // every configuration takes a comparable amount of time.
+{
+    const bsl::size_t k_ELEMENT_BUDGET = 20 * 1000 * 1000;
+
+    const bsl::size_t iterations = k_ELEMENT_BUDGET / numElements;
+    return iterations < 5 ? 5 : static_cast<int>(iterations);
+}
+
+                                // ======
+                                // Output
+                                // ======
+
+class Writer {
+    // This class writes benchmark records as CSV or as a JSON array.
+
+    // DATA
+    bsl::ostream& d_stream;
+    bool          d_isJson;
+    int           d_numRecords;
+
+  public:
+    // CREATORS
+    Writer(bsl::ostream& stream, bool isJson)
+    : d_stream(stream)
+    , d_isJson(isJson)
+    , d_numRecords(0)
+    {
+        if (d_isJson) {
+            d_stream << "[\n";
+        }
+        else {
+            d_stream << "container,type,operation,elements,batch,"
+                        "iterations,seconds,ns_per_op,gb_per_sec\n";
+        }
+    }
+
+    ~Writer()
+    {
+        if (d_isJson) {
+            d_stream << (d_numRecords ? "\n]\n" : "]\n");
+        }
+        d_stream.flush();
+    }
+
+    // MANIPULATORS
+    void write(const Entry& entry, const Config& config, const Result& result)
+    {
+        if (d_isJson) {
+            d_stream << (d_numRecords ? ",\n" : "")
+                     << "  {\"container\": \"" << entry.d_container << "\""
+                     << ", \"type\": \"" << entry.d_type << "\""
+                     << ", \"operation\": \""
+                     << k_OPERATIONS[config.d_operation] << "\""
+                     << ", \"elements\": " << config.d_elements
+                     << ", \"batch\": " << config.d_batch
+                     << ", \"iterations\": " << config.d_iterations
+                     << ", \"seconds\": " << result.d_seconds
+                     << ", \"ns_per_op\": " << result.d_nsPerOp
+                     << ", \"gb_per_sec\": " << result.d_gbPerSecond
+                     << "}";
+        }
+        else {
+            d_stream << entry.d_container << ','
+                     << entry.d_type << ','
+                     << k_OPERATIONS[config.d_operation] << ','
+                     << config.d_elements << ','
+                     << config.d_batch << ','
+                     << config.d_iterations << ','
+                     << result.d_seconds << ','
+                     << result.d_nsPerOp << ','
+                     << result.d_gbPerSecond << '\n';
+        }
+        d_stream.flush();
+        ++d_numRecords;
+    }
+};
+
+                          // ======================
+                          // Command-Line Arguments
+                          // ======================
+
+bool parseList(bsl::vector<bsl::string> *result, const char *text)
+    // Load into the specified 'result' the comma-separated items in the
+    // specified 'text'.  Return 'true' if at least one item was found, and
+    // 'false' otherwise.
+{
+    result->clear();
+    bsl::string item;
+    for (const char *p = text; ; ++p) {
+        if (',' == *p || 0 == *p) {
+            if (!item.empty()) {
+                result->push_back(item);
+            }
+            item.clear();
+            if (0 == *p) {
+                break;
+            }
+        }
+        else {
+            item += *p;
+        }
+    }
+    return !result->empty();
+}
+
+bool parsePositive(int *result, const char *text)
+    // Load into the specified 'result' the positive integer in the specified
+    // 'text'.  Return 'true' on success, and 'false' otherwise.
+{
+    char *end;
+    long  value = bsl::strtol(text, &end, 10);
+    if (end == text || *end || value <= 0 || value > 1000000000L) {
+        return false;                                                 // RETURN
+    }
+    *result = static_cast<int>(value);
+    return true;
+}
+
+bool contains(const bsl::vector<bsl::string>& names, const char *name)
+    // Return 'true' if the specified 'names' is empty or contains the
+    // specified 'name', and 'false' otherwise.
+{
+    return names.empty()
+        || names.end() != bsl::find(names.begin(), names.end(), name);
+}
+
+bool validate(const bsl::vector<bsl::string>&  names,
+              const char *const               *known,
+              int                              numKnown,
+              const char                      *what)
+    // Return 'true' if every one of the specified 'names' is one of the
+    // specified 'numKnown' 'known' names, and otherwise report the unknown
+    // name as the specified 'what' and return 'false'.
+{
+    for (bsl::size_t i = 0; i < names.size(); ++i) {
+        bool found = false;
+        for (int j = 0; j < numKnown; ++j) {
+            found = found || names[i] == known[j];
+        }
+        if (!found) {
+            bsl::cerr << "Unknown " << what << " '" << names[i] << "'\n";
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+void usage(const char *program)
+    // Write the usage of this program, invoked as the specified 'program',
+    // to 'bsl::cerr'.
+{
+    bsl::cerr
+        << "usage: " << program << " [options]\n"
+           "  --format=csv|json        output format (default: csv)\n"
+           "  --elements=N[,N...]      elements per container\n"
+           "                           (default: 1000,100000,4000000)\n"
+           "  --iterations=N           operations timed per configuration\n"
+           "                           (default: 20000000 / elements, "
+                                                           "at least 5)\n"
+           "  --repetitions=N          runs per configuration, reporting "
+                                                          "the median\n"
+           "                           (default: 3)\n"
+           "  --containers=a[,b...]    vector, deque\n"
+           "  --types=a[,b...]         int, double, record\n"
+           "  --operations=a[,b...]    assign-fill, insert-fill, "
+                                                           "insert-range,\n"
+           "                           insert-input, erase-range\n";
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+//=============================================================================
+//                                 MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    bsls::TimeUtil::initialize();
+
+    bool                     isJson         = false;
+    int                      numIterations  = 0;  // 0 means default
+    int                      numRepetitions = 3;
+    bsl::vector<int>         sizes;
+    bsl::vector<bsl::string> containers;
+    bsl::vector<bsl::string> types;
+    bsl::vector<bsl::string> operations;
+
+    sizes.push_back(1000);
+    sizes.push_back(100000);
+    sizes.push_back(4000000);
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg   = argv[i];
+        const char *value = bsl::strchr(arg, '=');
+        if (0 == bsl::strncmp(arg, "--", 2) && value) {
+            ++value;
+        }
+        else {
+            u::usage(argv[0]);
+            return 1;                                                 // RETURN
+        }
+
+        const bsl::string name(arg + 2, value - 1);
+        bool              isValid = true;
+
+        bsl::vector<bsl::string> items;
+
+        if ("format" == name) {
+            isJson  = 0 == bsl::strcmp(value, "json");
+            isValid = isJson || 0 == bsl::strcmp(value, "csv");
+        }
+        else if ("elements" == name) {
+            isValid = u::parseList(&items, value);
+            sizes.clear();
+            for (bsl::size_t j = 0; isValid && j < items.size(); ++j) {
+                int size;
+                isValid = u::parsePositive(&size, items[j].c_str());
+                sizes.push_back(size);
+            }
+        }
+        else if ("iterations" == name) {
+            isValid = u::parsePositive(&numIterations, value);
+        }
+        else if ("repetitions" == name) {
+            isValid = u::parsePositive(&numRepetitions, value);
+        }
+        else if ("containers" == name) {
+            isValid = u::parseList(&containers, value)
+                   && u::validate(containers,
+                                  u::k_CONTAINERS,
+                                  u::k_NUM_CONTAINERS,
+                                  "container");
+        }
+        else if ("types" == name) {
+            isValid = u::parseList(&types, value)
+                   && u::validate(types,
+                                  u::k_TYPES,
+                                  u::k_NUM_TYPES,
+                                  "type");
+        }
+        else if ("operations" == name) {
+            isValid = u::parseList(&operations, value)
+                   && u::validate(operations,
+                                  u::k_OPERATIONS,
+                                  u::k_NUM_OPERATIONS,
+                                  "operation");
+        }
+        else {
+            isValid = false;
+        }
+
+        if (!isValid) {
+            bsl::cerr << "Invalid argument '" << arg << "'\n";
+            u::usage(argv[0]);
+            return 1;                                                 // RETURN
+        }
+    }
+
+    u::Writer writer(bsl::cout, isJson);
+
+    for (int e = 0; e < u::k_NUM_ENTRIES; ++e) {
+        const u::Entry& entry = u::k_ENTRIES[e];
+        if (!u::contains(containers, entry.d_container)
+         || !u::contains(types, entry.d_type)) {
+            continue;                                               // CONTINUE
+        }
+        for (int o = 0; o < u::k_NUM_OPERATIONS; ++o) {
+            if (!u::contains(operations, u::k_OPERATIONS[o])) {
+                continue;                                           // CONTINUE
+            }
+            for (bsl::size_t s = 0; s < sizes.size(); ++s) {
+                u::Config config;
+                config.d_operation  = static_cast<u::Operation>(o);
+                config.d_elements   = sizes[s];
+                config.d_batch      = bsl::max<bsl::size_t>(
+                                          1,
+                                          sizes[s] / u::k_BATCH_DIVISOR);
+                config.d_iterations = numIterations
+                                    ? numIterations
+                                    : u::defaultIterations(sizes[s]);
+
+                bsl::vector<u::Result> results;
+                for (int r = 0; r < numRepetitions; ++r) {
+                    results.push_back(entry.d_measure(config));
+                }
+                bsl::sort(results.begin(), results.end());
+
+                writer.write(entry, config, results[results.size() / 2]);
+            }
+        }
+    }
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
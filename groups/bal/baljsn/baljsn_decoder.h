@@ -15,11 +15,16 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component provides a class, 'baljsn::Decoder', for
 // decoding value-semantic objects in the JSON format.  In particular, the
 // 'class' contains a parameterized 'decode' function that decodes an object
-// from a specified stream.  There are two overloaded versions of this
-// function:
+// from a specified stream or buffer.  There are three overloaded versions of
+// this function:
 //
 //: o one that reads from a 'bsl::streambuf'
 //: o one that reads from a 'bsl::istream'
+//: o one that reads directly from contiguous memory, a 'bsl::string_view'
+//
+// The last avoids copying the input through an intermediate buffer, and is the
+// preferred choice when the entire document is already in memory (e.g., when
+// it is held in a string or in a memory-mapped file).
 //
 // This component can be used with types that support the 'bdeat' framework
 // (see the 'bdeat' package for details), which is a compile-time interface for
@@ -152,6 +157,7 @@ BSLS_IDENT("$Id: $")
 #include <bsl_sstream.h>
 #include <bsl_streambuf.h>
 #include <bsl_string.h>
+#include <bsl_string_view.h>
 
 namespace BloombergLP {
 namespace baljsn {
@@ -214,6 +220,13 @@ class Decoder {
         // formatting mode as specified in 'bdlat_FormattingMode'.  Note that
         // 'ANY_CATEGORY' shall be a tag-type defined in 'bdlat_TypeCategory'.
 
+    template <class TYPE>
+    int decodeDocument(TYPE *value, const DecoderOptions& options);
+        // Decode into the specified 'value', of a (template parameter) 'TYPE',
+        // the JSON document from which the tokenizer owned by this object has
+        // been reset to read, using the specified 'options'.  Return 0 on
+        // success, and a non-zero value otherwise.
+
     bsl::ostream& logTokenizerError(const char *alternateString);
         // Log the latest tokenizer error to 'd_logStream'.  If the tokenizer
         // did not have an error, log the specified 'alternateString'.  Return
@@ -275,6 +288,24 @@ class Decoder {
         // if decoding is successful, will attempt to update the input position
         // of 'stream' to the last unprocessed byte.
 
+    template <class TYPE>
+    int decode(const bsl::string_view&  input,
+               TYPE                    *value,
+               const DecoderOptions&    options);
+    template <class TYPE>
+    int decode(const bsl::string_view&  input,
+               TYPE                    *value,
+               const DecoderOptions    *options);
+        // Decode into the specified 'value', of a (template parameter) 'TYPE',
+        // the JSON data in the specified 'input' and using the specified
+        // 'options'.  'TYPE' shall be a 'bdeat'-compatible sequence, choice,
+        // or array type, or a 'bdeat'-compatible dynamic type referring to one
+        // of those types.  Specifying a nullptr 'options' is equivalent to
+        // passing a default-constructed DecoderOptions in 'options'.  Return 0
+        // on success, and a non-zero value otherwise.  Note that 'input' is
+        // tokenized in place, without being copied, so this operation is
+        // typically faster than decoding the same data from a 'streambuf'.
+
     template <class TYPE>
     int decode(bsl::streambuf *streamBuf, TYPE *value);
         // Decode an object of (template parameter) 'TYPE' from the specified
@@ -872,27 +903,9 @@ int Decoder::decodeImp(TYPE *, ANY_CATEGORY)
     return -1;
 }
 
-// CREATORS
-inline
-Decoder::Decoder(bslma::Allocator *basicAllocator)
-: d_logStream(basicAllocator)
-, d_tokenizer(basicAllocator)
-, d_elementName(basicAllocator)
-, d_currentDepth(0)
-, d_maxDepth(0)
-, d_skipUnknownElements(false)
-{
-}
-
-// MANIPULATORS
 template <class TYPE>
-int Decoder::decode(bsl::streambuf        *streamBuf,
-                    TYPE                  *value,
-                    const DecoderOptions&  options)
+int Decoder::decodeDocument(TYPE *value, const DecoderOptions& options)
 {
-    BSLS_ASSERT(streamBuf);
-    BSLS_ASSERT(value);
-
     d_logStream.clear();
     d_logStream.str("");
 
@@ -907,7 +920,6 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
         return -1;                                                    // RETURN
     }
 
-    d_tokenizer.reset(streamBuf);
     d_tokenizer.setAllowStandAloneValues(false);
     d_tokenizer.setAllowHeterogenousArrays(false);
     d_tokenizer.setAllowNonUTF8Tokens(!options.validateInputIsUtf8());
@@ -933,6 +945,32 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
     return rc;
 }
 
+// CREATORS
+inline
+Decoder::Decoder(bslma::Allocator *basicAllocator)
+: d_logStream(basicAllocator)
+, d_tokenizer(basicAllocator)
+, d_elementName(basicAllocator)
+, d_currentDepth(0)
+, d_maxDepth(0)
+, d_skipUnknownElements(false)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+int Decoder::decode(bsl::streambuf        *streamBuf,
+                    TYPE                  *value,
+                    const DecoderOptions&  options)
+{
+    BSLS_ASSERT(streamBuf);
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(streamBuf);
+
+    return decodeDocument(value, options);
+}
+
 template <class TYPE>
 int Decoder::decode(bsl::streambuf        *streamBuf,
                     TYPE                  *value,
@@ -968,6 +1006,27 @@ int Decoder::decode(bsl::istream&          stream,
     return decode(stream, value, options ? *options : localOpts);
 }
 
+template <class TYPE>
+int Decoder::decode(const bsl::string_view&  input,
+                    TYPE                    *value,
+                    const DecoderOptions&    options)
+{
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(input);
+
+    return decodeDocument(value, options);
+}
+
+template <class TYPE>
+int Decoder::decode(const bsl::string_view&  input,
+                    TYPE                    *value,
+                    const DecoderOptions    *options)
+{
+    DecoderOptions localOpts;
+    return decode(input, value, options ? *options : localOpts);
+}
+
 template <class TYPE>
 int Decoder::decode(bsl::streambuf *streamBuf, TYPE *value)
 {
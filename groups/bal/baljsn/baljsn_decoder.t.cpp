@@ -34,6 +34,7 @@
 #include <bslmt_threadutil.h>
 
 #include <bsl_string.h>
+#include <bsl_string_view.h>
 #include <bsl_vector.h>
 #include <bsl_sstream.h>
 #include <bsl_cstdlib.h>
@@ -71,12 +72,14 @@ namespace test = BloombergLP::s_baltst;
 // [ 4] int decode(bsl::istream& stream, TYPE *v, options);
 // [ 4] int decode(bsl::streambuf *streamBuf, TYPE *v, &options);
 // [ 4] int decode(bsl::istream& stream, TYPE *v, &options);
+// [10] int decode(const bsl::string_view& input, TYPE *v, options);
+// [10] int decode(const bsl::string_view& input, TYPE *v, &options);
 //
 // ACCESSORS
 // [ 4] bsl::string loggedMessages() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [11] USAGE EXAMPLE
 // [ 5] MULTI-THREADING TEST CASE
 // [ 6] DRQS 43702912
 
@@ -36508,7 +36511,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -36615,6 +36618,147 @@ int main(int argc, char *argv[])
     ASSERT(21              == employee.age());
 //..
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING DECODING FROM CONTIGUOUS INPUT
+        //
+        // Concerns:
+        //: 1 Decoding from a 'bsl::string_view' yields the same value, return
+        //:   code, and logged messages as decoding the same text from a
+        //:   stream, for valid and invalid input, with and without UTF-8
+        //:   validation.
+        //:
+        //: 2 Only the characters within the view are read, so the input need
+        //:   not be null-terminated.
+        //:
+        //: 3 Values longer than the tokenizer's internal buffer are decoded.
+        //:
+        //: 4 Options may be passed by reference or by address, and a null
+        //:   address is equivalent to default options.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, decode valid and invalid JSON
+        //:   text from a 'bsl::istringstream' and from a 'bsl::string_view'
+        //:   over the same text followed by characters that would change the
+        //:   result if read, passing options by reference and by address, and
+        //:   verify that the results agree.  (C-1..2, 4)
+        //:
+        //: 2 Decode an object whose name is longer than the tokenizer's
+        //:   internal buffer from a 'bsl::string_view'.  (C-3)
+        //
+        // Testing:
+        //   int decode(const bsl::string_view& input, TYPE *v, options);
+        //   int decode(const bsl::string_view& input, TYPE *v, &options);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING DECODING FROM CONTIGUOUS INPUT" << endl
+                          << "======================================" << endl;
+
+        static const struct {
+            int         d_line;   // source line number
+            const char *d_text_p; // JSON text
+        } DATA[] = {
+            { L_, "" },
+            { L_, "   " },
+            { L_, "{}" },
+            { L_, "{\"name\":\"Bob\",\"homeAddress\":{\"street\":"
+                  "\"Lexington Ave\",\"city\":\"New York City\","
+                  "\"state\":\"New York\"},\"age\":21}" },
+            { L_, "  {  \"name\"  :  \"B\\\"o\\\\b\\u00e9\"  ,  \"age\"  :  21"
+                  "  }  " },
+            { L_, "{\"name\":\"Bob\",\"id\":[1,{\"a\":2}],\"age\":21}" },
+            { L_, "{\"name\":\"Bob\"" },
+            { L_, "{\"name\":\"Bob" },
+            { L_, "{\"name\":\"Bob\",\"age\":" },
+            { L_, "{\"name\":\"Bob\",\"age\":\"abc\"}" },
+            { L_, "{\"name\":\"Bob\",\"age\":21]" },
+            { L_, "{\"name\":\"B\xc3\xb6\x62\",\"age\":21}" },
+            { L_, "{\"name\":\"B\xff\x62\",\"age\":21}" },
+            { L_, "{\"name\":\"B\xc3\"}" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < 2 * NUM_DATA; ++ti) {
+            const int          tj   = ti / 2;
+            const bool         UTF8 = ti & 1;
+            const int          LINE = DATA[tj].d_line;
+            const bsl::string  TEXT = DATA[tj].d_text_p;
+
+            if (veryVerbose) {
+                P_(LINE);    P_(UTF8);    P(TEXT);
+            }
+
+            const bsl::string BUFFER = TEXT + "}]\"}";
+
+            baljsn::DecoderOptions options;
+            options.setSkipUnknownElements(true);
+            options.setValidateInputIsUtf8(UTF8);
+
+            test::Employee     expected;
+            bsl::istringstream iss(TEXT);
+            baljsn::Decoder    streamDecoder;
+            const int          EXP_RC = streamDecoder.decode(iss,
+                                                             &expected,
+                                                             options);
+
+            for (int byAddress = 0; byAddress < 2; ++byAddress) {
+                const bsl::string_view INPUT(BUFFER.data(), TEXT.length());
+
+                test::Employee  bob;
+                baljsn::Decoder decoder;
+
+                const int rc = byAddress
+                             ? decoder.decode(INPUT, &bob, &options)
+                             : decoder.decode(INPUT, &bob, options);
+
+                ASSERTV(LINE, UTF8, EXP_RC, rc, (0 == EXP_RC) == (0 == rc));
+                ASSERTV(LINE, UTF8, expected, bob, expected == bob);
+                ASSERTV(LINE,
+                        UTF8,
+                        streamDecoder.loggedMessages(),
+                        decoder.loggedMessages(),
+                        streamDecoder.loggedMessages() ==
+                                                     decoder.loggedMessages());
+            }
+
+            if (!UTF8) {
+                // A null options address is equivalent to default options,
+                // which do not skip unknown elements.
+
+                const bsl::string_view INPUT(BUFFER.data(), TEXT.length());
+
+                baljsn::DecoderOptions defaultOptions;
+                test::Employee         bob1;
+                test::Employee         bob2;
+                baljsn::Decoder        decoder;
+
+                const int rc1 = decoder.decode(INPUT, &bob1, defaultOptions);
+                const int rc2 = decoder.decode(
+                                     INPUT,
+                                     &bob2,
+                                     static_cast<baljsn::DecoderOptions *>(0));
+
+                ASSERTV(LINE, rc1, rc2, rc1 == rc2);
+                ASSERTV(LINE, bob1, bob2, bob1 == bob2);
+            }
+        }
+
+        if (verbose) cout << "\nTesting values longer than the buffer."
+                          << endl;
+        {
+            const bsl::string NAME(20000, 'x');
+            const bsl::string TEXT = "{\"name\":\"" + NAME + "\",\"age\":21}";
+
+            test::Employee         bob;
+            baljsn::Decoder        decoder;
+            baljsn::DecoderOptions options;
+
+            ASSERT(0 == decoder.decode(bsl::string_view(TEXT), &bob, options));
+            ASSERT(NAME == bob.name());
+            ASSERT(21   == bob.age());
+        }
+      } break;
       case 9: {
         // ------------------------------------------------------------------
         // TESTING UTF-8 DETECTION
@@ -621,25 +621,29 @@ int ParserUtil::getValue(bsl::vector<char> *value,
         return -1;                                                    // RETURN
     }
 
-    value->clear();
-
-    bdlde::Base64Decoder base64Decoder(true);
-    bsl::back_insert_iterator<bsl::vector<char> > outputIterator(*value);
-
-    rc = base64Decoder.convert(outputIterator,
-                               base64String.begin(),
-                               base64String.end());
-
-    if (rc < 0) {
-        return rc;                                                    // RETURN
+    value->resize(bdlde::Base64Decoder::maxDecodedLength(
+                                      static_cast<int>(base64String.size())));
+    if (value->empty()) {
+        return 0;                                                     // RETURN
     }
 
-    rc = base64Decoder.endConvert(outputIterator);
+    const char *begin = base64String.data();
+    int         numOut;
+    int         numIn;
 
+    rc = bdlde::Base64Decoder::decodeBuffer(&(*value)[0],
+                                            &numOut,
+                                            &numIn,
+                                            begin,
+                                            begin + base64String.size(),
+                                            true);
     if (rc < 0) {
+        value->clear();
         return rc;                                                    // RETURN
     }
 
+    value->resize(numOut);
+
     return 0;
 }
 }  // close package namespace
@@ -6,13 +6,29 @@ BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 
 #include <baljsn_parserutil.h>                 // for testing only
 
-#include <bdlb_chartype.h>
+#include <bdlb_bitutil.h>
 #include <bdlde_utf8util.h>
 #include <bdlsb_fixedmemoutstreambuf.h>
 
+#include <bsls_platform.h>
+
+#include <bsl_cstdint.h>
 #include <bsl_cstring.h>
 #include <bsl_ios.h>
 
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86_64) ||                                      \
+    (defined(BSLS_PLATFORM_CPU_X86) && defined(__SSE2__))
+#define BALJSN_TOKENIZER_SSE2
+#include <emmintrin.h>
+
+#if defined(BSLS_PLATFORM_CMP_CLANG) ||                                       \
+    (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900)
+#define BALJSN_TOKENIZER_AVX2
+#include <immintrin.h>
+#endif
+#endif
+
 // IMPLEMENTATION NOTES
 // --------------------
 // The following table provides the various transitions that need to be handled
@@ -53,13 +69,341 @@ BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 //   END_OBJECT                   '}'         ']'              END_ARRAY
 //   END_ARRAY                    ']'         ']'              END_ARRAY
 //..
+//
+// The three scanning loops of the tokenizer (skipping whitespace, finding the
+// closing quote of a string, and finding the end of a non-string value) are
+// implemented by the 'find*' functions below, which examine 16 bytes (SSE2)
+// or 32 bytes (AVX2) at a time.  SSE2 is part of the x86-64 baseline and is
+// used unconditionally on that platform; AVX2 is used only if the processor
+// supports it, which is determined once during static initialization.  (Until
+// then, 's_useAvx2' is zero-initialized, so that the SSE2 code is used if the
+// tokenizer is invoked by another static initializer.)  Every function
+// returns exactly the position that the equivalent byte-at-a-time loop would,
+// so tokens and 'readOffset' values do not depend on the code path taken.
+// Loads never extend past the end of the range being scanned.
 
 namespace BloombergLP {
 namespace {
 
-    static const char *WHITESPACE = " \n\t\v\f\r";
     static const char *TOKENS     = "{}[]:,";
 
+inline
+bool isWhitespace(char character)
+    // Return 'true' if the specified 'character' is one of " \n\t\v\f\r", and
+    // 'false' otherwise.
+{
+    return ' ' == character || ('\t' <= character && character <= '\r');
+}
+
+inline
+bool isDelimiter(char character)
+    // Return 'true' if the specified 'character' terminates a non-string
+    // value, that is if it is whitespace, one of "{}[]:,", or the null
+    // character, and 'false' otherwise.
+{
+    return isWhitespace(character) || bsl::strchr(TOKENS, character);
+}
+
+const char *findNonWhitespaceScalar(const char *begin, const char *end)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that is not whitespace, or 'end' if there is no such
+    // character.
+{
+    while (begin != end && isWhitespace(*begin)) {
+        ++begin;
+    }
+    return begin;
+}
+
+const char *findQuoteOrBackslashScalar(const char *begin, const char *end)
+    // Return the address of the first '"' or '\' character in the specified
+    // range '[begin, end)', or 'end' if there is no such character.
+{
+    while (begin != end && '"' != *begin && '\\' != *begin) {
+        ++begin;
+    }
+    return begin;
+}
+
+const char *findDelimiterScalar(const char *begin, const char *end)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' for which 'isDelimiter' returns 'true', or 'end' if there
+    // is no such character.
+{
+    while (begin != end && !isDelimiter(*begin)) {
+        ++begin;
+    }
+    return begin;
+}
+
+#if defined(BALJSN_TOKENIZER_SSE2)
+
+inline
+__m128i whitespaceSse2(__m128i chars)
+    // Return a mask having all bits set in each byte for which the
+    // corresponding byte of the specified 'chars' is whitespace.
+{
+    const __m128i space = _mm_cmpeq_epi8(chars, _mm_set1_epi8(' '));
+    const __m128i ctrl  = _mm_and_si128(
+                             _mm_cmpgt_epi8(chars, _mm_set1_epi8('\t' - 1)),
+                             _mm_cmplt_epi8(chars, _mm_set1_epi8('\r' + 1)));
+    return _mm_or_si128(space, ctrl);
+}
+
+inline
+unsigned int delimiterMaskSse2(const char *address)
+    // Return a bit mask, of which bit 'i' is set if 'isDelimiter' is 'true'
+    // for the character at 'address + i', for each 'i' in '[0 .. 16)'.
+{
+    const __m128i chars = _mm_loadu_si128(
+                                  reinterpret_cast<const __m128i *>(address));
+
+    // '[' and ']' differ from '{' and '}' only by the 0x20 bit.
+
+    const __m128i folded = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+
+    __m128i match = whitespaceSse2(chars);
+    match = _mm_or_si128(match, _mm_cmpeq_epi8(chars, _mm_setzero_si128()));
+    match = _mm_or_si128(match, _mm_cmpeq_epi8(chars, _mm_set1_epi8(':')));
+    match = _mm_or_si128(match, _mm_cmpeq_epi8(chars, _mm_set1_epi8(',')));
+    match = _mm_or_si128(match, _mm_cmpeq_epi8(folded, _mm_set1_epi8('{')));
+    match = _mm_or_si128(match, _mm_cmpeq_epi8(folded, _mm_set1_epi8('}')));
+    return static_cast<unsigned int>(_mm_movemask_epi8(match));
+}
+
+const char *findNonWhitespaceSse2(const char *begin, const char *end)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that is not whitespace, or 'end' if there is no such
+    // character.
+{
+    while (end - begin >= 16) {
+        const __m128i chars = _mm_loadu_si128(
+                                    reinterpret_cast<const __m128i *>(begin));
+        const unsigned int mask = ~static_cast<unsigned int>(
+                                    _mm_movemask_epi8(whitespaceSse2(chars)))
+                                & 0xFFFFu;
+        if (mask) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(
+                                             static_cast<bsl::uint32_t>(mask));
+                                                                      // RETURN
+        }
+        begin += 16;
+    }
+    return findNonWhitespaceScalar(begin, end);
+}
+
+const char *findQuoteOrBackslashSse2(const char *begin, const char *end)
+    // Return the address of the first '"' or '\' character in the specified
+    // range '[begin, end)', or 'end' if there is no such character.
+{
+    const __m128i quote     = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+
+    while (end - begin >= 16) {
+        const __m128i chars = _mm_loadu_si128(
+                                    reinterpret_cast<const __m128i *>(begin));
+        const __m128i match = _mm_or_si128(_mm_cmpeq_epi8(chars, quote),
+                                           _mm_cmpeq_epi8(chars, backslash));
+        const unsigned int mask = static_cast<unsigned int>(
+                                                     _mm_movemask_epi8(match));
+        if (mask) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(
+                                             static_cast<bsl::uint32_t>(mask));
+                                                                      // RETURN
+        }
+        begin += 16;
+    }
+    return findQuoteOrBackslashScalar(begin, end);
+}
+
+const char *findDelimiterSse2(const char *begin, const char *end)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' for which 'isDelimiter' returns 'true', or 'end' if there
+    // is no such character.
+{
+    while (end - begin >= 16) {
+        const unsigned int mask = delimiterMaskSse2(begin);
+        if (mask) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(
+                                             static_cast<bsl::uint32_t>(mask));
+                                                                      // RETURN
+        }
+        begin += 16;
+    }
+    return findDelimiterScalar(begin, end);
+}
+
+#endif  // BALJSN_TOKENIZER_SSE2
+
+#if defined(BALJSN_TOKENIZER_AVX2)
+
+__attribute__((target("avx2")))
+inline
+__m256i whitespaceAvx2(__m256i chars)
+    // Return a mask having all bits set in each byte for which the
+    // corresponding byte of the specified 'chars' is whitespace.
+{
+    const __m256i space = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(' '));
+    const __m256i low   = _mm256_set1_epi8('\t' - 1);
+    const __m256i high  = _mm256_set1_epi8('\r' + 1);
+    const __m256i ctrl  = _mm256_and_si256(_mm256_cmpgt_epi8(chars, low),
+                                           _mm256_cmpgt_epi8(high, chars));
+    return _mm256_or_si256(space, ctrl);
+}
+
+__attribute__((target("avx2")))
+const char *findNonWhitespaceAvx2(const char *begin, const char *end)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that is not whitespace, or 'end' if there is no such
+    // character.
+{
+    while (end - begin >= 32) {
+        const __m256i chars = _mm256_loadu_si256(
+                                    reinterpret_cast<const __m256i *>(begin));
+        const bsl::uint32_t mask = ~static_cast<bsl::uint32_t>(
+                                  _mm256_movemask_epi8(whitespaceAvx2(chars)));
+        if (mask) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(mask);
+                                                                      // RETURN
+        }
+        begin += 32;
+    }
+    return findNonWhitespaceSse2(begin, end);
+}
+
+__attribute__((target("avx2")))
+const char *findQuoteOrBackslashAvx2(const char *begin, const char *end)
+    // Return the address of the first '"' or '\' character in the specified
+    // range '[begin, end)', or 'end' if there is no such character.
+{
+    const __m256i quote     = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+
+    while (end - begin >= 32) {
+        const __m256i chars = _mm256_loadu_si256(
+                                    reinterpret_cast<const __m256i *>(begin));
+        const __m256i match = _mm256_or_si256(
+                                        _mm256_cmpeq_epi8(chars, quote),
+                                        _mm256_cmpeq_epi8(chars, backslash));
+        const bsl::uint32_t mask = static_cast<bsl::uint32_t>(
+                                                  _mm256_movemask_epi8(match));
+        if (mask) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(mask);
+                                                                      // RETURN
+        }
+        begin += 32;
+    }
+    return findQuoteOrBackslashSse2(begin, end);
+}
+
+__attribute__((target("avx2")))
+const char *findDelimiterAvx2(const char *begin, const char *end)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' for which 'isDelimiter' returns 'true', or 'end' if there
+    // is no such character.
+{
+    while (end - begin >= 32) {
+        const __m256i chars = _mm256_loadu_si256(
+                                    reinterpret_cast<const __m256i *>(begin));
+        const __m256i folded = _mm256_or_si256(chars,
+                                               _mm256_set1_epi8(0x20));
+
+        __m256i match = whitespaceAvx2(chars);
+        match = _mm256_or_si256(
+                   match,
+                   _mm256_cmpeq_epi8(chars, _mm256_setzero_si256()));
+        match = _mm256_or_si256(
+                   match,
+                   _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(':')));
+        match = _mm256_or_si256(
+                   match,
+                   _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(',')));
+        match = _mm256_or_si256(
+                   match,
+                   _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('{')));
+        match = _mm256_or_si256(
+                   match,
+                   _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('}')));
+
+        const bsl::uint32_t mask = static_cast<bsl::uint32_t>(
+                                                  _mm256_movemask_epi8(match));
+        if (mask) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(mask);
+                                                                      // RETURN
+        }
+        begin += 32;
+    }
+    return findDelimiterSse2(begin, end);
+}
+
+bool detectAvx2()
+    // Return 'true' if the processor and the operating system support AVX2
+    // instructions, and 'false' otherwise.
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+static const bool s_useAvx2 = detectAvx2();
+
+#endif  // BALJSN_TOKENIZER_AVX2
+
+const char *findNonWhitespace(const char *begin, const char *end)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that is not whitespace, or 'end' if there is no such
+    // character.
+{
+    // Most tokens are not preceded by whitespace, or by a single space.
+
+    if (begin != end && !isWhitespace(*begin)) {
+        return begin;                                                 // RETURN
+    }
+
+#if defined(BALJSN_TOKENIZER_AVX2)
+    if (s_useAvx2) {
+        return findNonWhitespaceAvx2(begin, end);                     // RETURN
+    }
+#endif
+#if defined(BALJSN_TOKENIZER_SSE2)
+    return findNonWhitespaceSse2(begin, end);
+#else
+    return findNonWhitespaceScalar(begin, end);
+#endif
+}
+
+const char *findQuoteOrBackslash(const char *begin, const char *end)
+    // Return the address of the first '"' or '\' character in the specified
+    // range '[begin, end)', or 'end' if there is no such character.
+{
+#if defined(BALJSN_TOKENIZER_AVX2)
+    if (s_useAvx2) {
+        return findQuoteOrBackslashAvx2(begin, end);                  // RETURN
+    }
+#endif
+#if defined(BALJSN_TOKENIZER_SSE2)
+    return findQuoteOrBackslashSse2(begin, end);
+#else
+    return findQuoteOrBackslashScalar(begin, end);
+#endif
+}
+
+const char *findDelimiter(const char *begin, const char *end)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' for which 'isDelimiter' returns 'true', or 'end' if there
+    // is no such character.
+{
+#if defined(BALJSN_TOKENIZER_AVX2)
+    if (s_useAvx2) {
+        return findDelimiterAvx2(begin, end);                         // RETURN
+    }
+#endif
+#if defined(BALJSN_TOKENIZER_SSE2)
+    return findDelimiterSse2(begin, end);
+#else
+    return findDelimiterScalar(begin, end);
+#endif
+}
+
 }  // close unnamed namespace
 
 namespace baljsn {
@@ -69,8 +413,48 @@ namespace baljsn {
                               // ----------------
 
 // PRIVATE MANIPULATORS
+int Tokenizer::loadInput()
+{
+    BSLS_ASSERT(!d_streambuf_p);
+
+    bsl::size_t numRead = 0;
+    if (0 == d_readStatus && 0 == d_bufEndStatus && 0 == d_inputLength) {
+        numRead = d_inputSize;
+
+        if (!d_allowNonUTF8Tokens) {
+            int         sts = 0;
+            const char *end = d_input_p;
+            bdlde::Utf8Util::advanceIfValid(&sts,
+                                            &end,
+                                            d_input_p,
+                                            d_inputSize,
+                                            static_cast<IntPtr>(d_inputSize));
+            numRead = end - d_input_p;
+
+            if (sts < 0) {
+                d_bufEndStatus = sts;
+            }
+        }
+
+        d_inputLength = numRead;
+    }
+
+    if (0 == d_readStatus && 0 == numRead) {
+        d_readStatus = 0 == d_bufEndStatus
+                     ? k_EOF
+                     : d_bufEndStatus;
+    }
+
+    d_readOffset += numRead;
+    return numRead ? 1 : 0;
+}
+
 int Tokenizer::reloadStringBuffer()
 {
+    if (!d_streambuf_p) {
+        return loadInput();                                           // RETURN
+    }
+
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
 
     bsl::size_t numRead;
@@ -113,6 +497,10 @@ int Tokenizer::reloadStringBuffer()
 
 int Tokenizer::expandBufferForLargeValue()
 {
+    if (!d_streambuf_p) {
+        return loadInput() ? 0 : -1;                                  // RETURN
+    }
+
     const bsl::string::size_type currLength = d_stringBuffer.length();
     d_stringBuffer.resize(currLength + k_MAX_STRING_SIZE);
 
@@ -154,6 +542,10 @@ int Tokenizer::expandBufferForLargeValue()
 
 int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 {
+    if (!d_streambuf_p) {
+        return loadInput();                                           // RETURN
+    }
+
     d_stringBuffer.erase(d_stringBuffer.begin(),
                          d_stringBuffer.begin() + d_valueBegin);
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
@@ -205,21 +597,29 @@ int Tokenizer::extractStringValue()
     char previousChar = 0;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && '"' != d_stringBuffer[d_valueIter]) {
-
-            if ('\\' == d_stringBuffer[d_valueIter]
-             && '\\' == previousChar) {
-                previousChar = 0;
+        const char        *data   = bufferData();
+        const bsl::size_t  length = bufferLength();
+
+        while (d_valueIter < length) {
+            const char *next = findQuoteOrBackslash(data + d_valueIter,
+                                                    data + length);
+            if (next != data + d_valueIter) {
+                previousChar = next[-1];
             }
-            else {
-                previousChar = d_stringBuffer[d_valueIter];
+            d_valueIter = next - data;
+
+            if (d_valueIter >= length || '"' == *next) {
+                break;
             }
 
+            // A backslash escapes the next character, unless it is itself
+            // escaped.
+
+            previousChar = '\\' == previousChar ? 0 : '\\';
             ++d_valueIter;
         }
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        if (d_valueIter >= length) {
 
             // There isn't enough room in the internal buffer to hold the
             // value.  If this is the first time through the loop, we move the
@@ -266,13 +666,15 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
     bool firstTime = true;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && !bdlb::CharType::isSpace(d_stringBuffer[d_valueIter])
-            && !bsl::strchr(TOKENS, d_stringBuffer[d_valueIter])) {
-            ++d_valueIter;
+        const bsl::size_t length = bufferLength();
+
+        if (d_valueIter < length) {
+            const char *data = bufferData();
+            d_valueIter = findDelimiter(data + d_valueIter, data + length)
+                        - data;
         }
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        if (d_valueIter >= length) {
 
             // There isn't enough room in the internal buffer to hold the
             // value.  If this is the first time through the loop, we move the
@@ -310,11 +712,14 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
 int Tokenizer::skipWhitespace()
 {
     while (true) {
-        bsl::size_t pos = d_stringBuffer.find_first_not_of(WHITESPACE,
-                                                           d_cursor);
-        if (bsl::string::npos != pos) {
-            d_cursor = pos;
-            break;
+        if (d_cursor < bufferLength()) {
+            const char *data = bufferData();
+            const char *end  = data + bufferLength();
+            const char *pos  = findNonWhitespace(data + d_cursor, end);
+            if (end != pos) {
+                d_cursor = pos - data;
+                break;
+            }
         }
 
         const int numRead = reloadStringBuffer();
@@ -332,7 +737,7 @@ int Tokenizer::advanceToNextToken()
         return -1;                                                    // RETURN
     }
 
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (d_cursor >= bufferLength()) {
         const int numRead = reloadStringBuffer();
         if (0 == numRead) {
             d_tokenType = e_ERROR;
@@ -351,7 +756,7 @@ int Tokenizer::advanceToNextToken()
             return -1;                                                // RETURN
         }
 
-        switch (d_stringBuffer[d_cursor]) {
+        switch (bufferData()[d_cursor]) {
           case '{': {
             if ((e_ELEMENT_NAME == d_tokenType && ':' == previousChar)
              || e_START_ARRAY   == d_tokenType
@@ -665,7 +1070,7 @@ int Tokenizer::advanceToNextToken()
 
 int Tokenizer::resetStreamBufGetPointer()
 {
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (!d_streambuf_p || d_cursor >= d_stringBuffer.size()) {
         return 0;                                                     // RETURN
     }
 
@@ -687,8 +1092,8 @@ int Tokenizer::value(bslstl::StringRef *data) const
 {
     if ((e_ELEMENT_NAME == d_tokenType || e_ELEMENT_VALUE == d_tokenType) &&
         d_valueBegin != d_valueEnd) {
-        data->assign(&d_stringBuffer[d_valueBegin],
-                     &d_stringBuffer[d_valueEnd]);
+        data->assign(bufferData() + d_valueBegin,
+                     bufferData() + d_valueEnd);
         return 0;                                                     // RETURN
     }
     return -1;
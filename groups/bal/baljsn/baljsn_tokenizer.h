@@ -23,6 +23,19 @@ BSLS_IDENT("$Id: $")
 // package and in most cases clients should use the 'baljsn_decoder' component
 // instead of using this 'class'.
 //
+///Tokenizing Contiguous Input
+///---------------------------
+// When the entire JSON document is already in memory (e.g., in a string or a
+// memory-mapped file), a tokenizer can instead be associated with that memory
+// by calling the 'reset' overload taking a 'bsl::string_view'.  In that mode
+// no data is copied into the tokenizer's internal buffer: the string
+// references loaded by 'value' refer directly into the supplied input, and
+// remain valid for as long as the input does, rather than only until the next
+// call to 'advanceToNextToken'.  The tokens, values, and error statuses
+// reported are the same as if the input had been supplied through a
+// 'streambuf'.  Note that the tokenizer does not unescape string values in
+// either mode; that is done by 'baljsn::ParserUtil::getValue'.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -131,9 +144,11 @@ BSLS_IDENT("$Id: $")
 #include <bsls_assert.h>
 #include <bsls_types.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_ios.h>
 #include <bsl_streambuf.h>
 #include <bsl_string.h>
+#include <bsl_string_view.h>
 #include <bsl_vector.h>
 
 namespace BloombergLP {
@@ -145,8 +160,9 @@ namespace baljsn {
 
 class Tokenizer {
     // This 'class' provides a mechanism for traversing JSON data stored in a
-    // 'bsl::streambuf' one node at a time and allows clients to access the
-    // data associated with that node, including its type and data value.
+    // 'bsl::streambuf', or in contiguous memory, one node at a time and allows
+    // clients to access the data associated with that node, including its
+    // type and data value.
 
   public:
     // TYPES
@@ -215,7 +231,22 @@ class Tokenizer {
 
     bsl::string         d_stringBuffer;     // string buffer
 
-    bsl::streambuf     *d_streambuf_p;      // streambuf (held, not owned)
+    bsl::streambuf     *d_streambuf_p;      // streambuf (held, not owned),
+                                            // or 0 if tokenizing contiguous
+                                            // input
+
+    const char         *d_input_p;          // contiguous input (held, not
+                                            // owned), unused unless
+                                            // 'd_streambuf_p' is 0
+
+    bsl::size_t         d_inputSize;        // length of the contiguous input
+
+    bsl::size_t         d_inputLength;      // length of the prefix of the
+                                            // contiguous input made available
+                                            // for tokenizing -- 0 until the
+                                            // first load, then either
+                                            // 'd_inputSize' or the length of
+                                            // its valid UTF-8 prefix
 
     bsl::size_t         d_cursor;           // current cursor
 
@@ -262,6 +293,14 @@ class Tokenizer {
         // end of the extracted string.  Return 0 on success and a non-zero
         // value otherwise.
 
+    int loadInput();
+        // Make the contiguous input supplied to 'reset' available for
+        // tokenizing if it has not been already, validating it first if UTF-8
+        // checking is enabled, and update the read status and offset as if
+        // that input had been read from a 'streambuf'.  Return 1 if input was
+        // made available by this call, and 0 otherwise.  The behavior is
+        // undefined unless this tokenizer is tokenizing contiguous input.
+
     int moveValueCharsToStartAndReloadBuffer();
         // Move the current sequence of characters being tokenized to the front
         // of the internal string buffer, 'd_stringBuffer', and then append
@@ -271,19 +310,24 @@ class Tokenizer {
         // of bytes read from the 'streambuf'.  Note that if 0 is returned, it
         // may mean end of file or, if UTF-8 checking is set, that invalid
         // UTF-8 was encountered, so it may be necessary to call
-        // 'utf8ErrorIsSet()' to tell the difference.
+        // 'utf8ErrorIsSet()' to tell the difference.  Also note that, if
+        // tokenizing contiguous input, this function is equivalent to
+        // 'loadInput'.
 
     int reloadStringBuffer();
         // Reload the string buffer with new data read from the underlying
         // 'streambuf' and overwriting the current buffer.  After reading
         // update the cursor to the new read location.  Return the number of
-        // bytes read from the 'streambuf'.
+        // bytes read from the 'streambuf'.  Note that, if tokenizing
+        // contiguous input, this function is equivalent to 'loadInput'.
 
     int expandBufferForLargeValue();
         // Increase the size of the string buffer, 'd_stringBuffer', and then
         // append additional characters, from the internally-held 'streambuf' (
         // 'd_streambuf_p') to the end of the current sequence of characters.
-        // Return 0 on success and a non-zero value otherwise.
+        // Return 0 on success and a non-zero value otherwise.  Note that, if
+        // tokenizing contiguous input, this function fails unless 'loadInput'
+        // makes input available.
 
     ContextType popContext();
         // Pop the top context from the 'd_contextStack' stack, and return it.
@@ -303,6 +347,15 @@ class Tokenizer {
         // value otherwise.
 
     // PRIVATE ACCESSOR
+    const char *bufferData() const;
+        // Return the address of the data being tokenized: the internal string
+        // buffer if reading from a 'streambuf', and the contiguous input
+        // supplied to 'reset' otherwise.
+
+    bsl::size_t bufferLength() const;
+        // Return the number of characters available for tokenizing at
+        // 'bufferData()'.
+
     ContextType context() const;
         // Returns the top context from the 'd_contextStack' stack without
         // popping.  The behavior is undefined if 'd_contextStack' is empty.
@@ -330,11 +383,22 @@ class Tokenizer {
         // change the value of the 'allowStandAloneValues',
         // 'allowHeterogenousArrays', or 'allowNonUTF8Tokens' options.
 
+    void reset(const bsl::string_view& input);
+        // Reset this tokenizer to read data directly from the specified
+        // 'input' without copying it.  String references loaded by 'value'
+        // refer into 'input'.  The behavior is undefined unless 'input'
+        // remains valid and unmodified while this tokenizer is used or until
+        // 'reset' is next called.  Note that the reader will not be on a valid
+        // node until 'advanceToNextToken' is called.  Note that this function
+        // does not change the value of the 'allowStandAloneValues',
+        // 'allowHeterogenousArrays', or 'allowNonUTF8Tokens' options.
+
     int advanceToNextToken();
         // Move to the next token in the data steam.  Return 0 on success and a
-        // non-zero value otherwise.  Note that each call to
-        // 'advanceToNextToken' invalidates the string references returned by
-        // the 'value' accessor for prior nodes.
+        // non-zero value otherwise.  Note that, unless this tokenizer is
+        // reading contiguous input, each call to 'advanceToNextToken'
+        // invalidates the string references returned by the 'value' accessor
+        // for prior nodes.
 
     int resetStreamBufGetPointer();
         // Reset the get pointer of the 'streambuf' held by this object to
@@ -346,7 +410,9 @@ class Tokenizer {
         // from where this object stopped.  Also note that this call implies
         // the end of processing for this object and any subsequent methods
         // invoked on this object should only be done after calling 'reset' and
-        // specifying a new 'streambuf'.
+        // specifying a new 'streambuf'.  Also note that this function has no
+        // effect, and returns 0, if this tokenizer is reading contiguous
+        // input.
 
     void setAllowHeterogenousArrays(bool value);
         // Set the 'allowHeterogenousArrays' option to the specified 'value'.
@@ -411,7 +477,8 @@ class Tokenizer {
         // Load into the specified 'data' the value of the specified token if
         // the current token's type is 'e_ELEMENT_NAME' or 'e_ELEMENT_VALUE' or
         // leave 'data' unmodified otherwise.  Return 0 on success and a
-        // non-zero value otherwise.
+        // non-zero value otherwise.  Note that, if this tokenizer is reading
+        // contiguous input, 'data' refers into that input.
 };
 
 // ============================================================================
@@ -437,6 +504,18 @@ void Tokenizer::pushContext(ContextType context)
 }
 
 // PRIVATE ACCESSOR
+inline
+const char *Tokenizer::bufferData() const
+{
+    return d_streambuf_p ? d_stringBuffer.data() : d_input_p;
+}
+
+inline
+bsl::size_t Tokenizer::bufferLength() const
+{
+    return d_streambuf_p ? d_stringBuffer.length() : d_inputLength;
+}
+
 inline
 Tokenizer::ContextType Tokenizer::context() const
 {
@@ -454,6 +533,9 @@ Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
 , d_stackAllocator(d_stackBuffer.buffer(), k_STACKBUFSIZE, basicAllocator)
 , d_stringBuffer(&d_allocator)
 , d_streambuf_p(0)
+, d_input_p(0)
+, d_inputSize(0)
+, d_inputLength(0)
 , d_cursor(0)
 , d_valueBegin(0)
 , d_valueEnd(0)
@@ -482,6 +564,30 @@ inline
 void Tokenizer::reset(bsl::streambuf *streambuf)
 {
     d_streambuf_p  = streambuf;
+    d_input_p      = 0;
+    d_inputSize    = 0;
+    d_inputLength  = 0;
+    d_stringBuffer.clear();
+    d_cursor       = 0;
+    d_valueBegin   = 0;
+    d_valueEnd     = 0;
+    d_valueIter    = 0;
+    d_readOffset   = 0;
+    d_tokenType    = e_BEGIN;
+    d_readStatus   = 0;
+    d_bufEndStatus = 0;
+
+    d_contextStack.clear();
+    pushContext(e_OBJECT_CONTEXT);
+}
+
+inline
+void Tokenizer::reset(const bsl::string_view& input)
+{
+    d_streambuf_p  = 0;
+    d_input_p      = input.data();
+    d_inputSize    = input.length();
+    d_inputLength  = 0;
     d_stringBuffer.clear();
     d_cursor       = 0;
     d_valueBegin   = 0;
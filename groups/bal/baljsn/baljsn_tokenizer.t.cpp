@@ -11,8 +11,11 @@
 #include <bslim_testutil.h>
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
 #include <bslma_testallocator.h>
 
+#include <bsls_stopwatch.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_cfloat.h>
 #include <bsl_climits.h>
@@ -20,6 +23,7 @@
 #include <bsl_limits.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_string_view.h>
 #include <bsl_vector.h>
 
 #include <bsl_cstring.h>
@@ -50,6 +54,7 @@ using bsl::endl;
 //
 // MANIPULATORS
 // [ 9] void reset(bsl::streambuf &streamBuf);
+// [19] void reset(const bsl::string_view& input);
 // [12] void resetStreamBufGetPointer();
 // [13] void setAllowStandAloneValues(bool value);
 // [14] void setAllowHeterogenousArrays(bool value);
@@ -64,7 +69,9 @@ using bsl::endl;
 // [17} const char *utf8ErrorMessage(const char *) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [18] USAGE EXAMPLE
+// [18] SCANNING ACROSS ALIGNMENTS AND BUFFER BOUNDARIES
+// [20] USAGE EXAMPLE
+// [-1] PERFORMANCE: TOKENIZING THROUGHPUT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -469,6 +476,235 @@ static const struct Utf8Data {
 };
 enum { k_NUM_UTF8_DATA = sizeof UTF8_DATA / sizeof *UTF8_DATA };
 
+// ============================================================================
+//                       GENERATED DOCUMENTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+class DocumentGenerator {
+    // This class generates pseudo-random JSON objects whose structure is
+    // recorded as they are generated, so that the tokens reported by a
+    // tokenizer reading a generated document can be verified.  The documents
+    // exercise runs of whitespace, string escapes, and value lengths that
+    // straddle the 16 and 32 byte blocks scanned by the implementation and
+    // the boundaries of the tokenizer's internal buffer.
+
+    // DATA
+    unsigned int              d_seed;     // linear congruential state
+    bsl::string              *d_document_p;
+    bsl::vector<bsl::string> *d_names_p;
+    bsl::vector<bsl::string> *d_values_p;
+
+    // PRIVATE MANIPULATORS
+    int random(int range)
+        // Return a pseudo-random integer in the range '[0 .. range)'.
+    {
+        d_seed = d_seed * 1103515245u + 12345u;
+        return static_cast<int>((d_seed >> 8) % range);
+    }
+
+    void appendWhitespace(int maxLength)
+        // Append to the document a run of between 0 and the specified
+        // 'maxLength' whitespace characters.
+    {
+        static const char k_WS[] = " \t\n\v\f\r";
+
+        const int length = random(maxLength + 1);
+        for (int i = 0; i < length; ++i) {
+            *d_document_p += k_WS[random(sizeof k_WS - 1)];
+        }
+    }
+
+    void appendString(bsl::string *result, int minLength, int maxLength)
+        // Append to the specified 'result' a quoted JSON string whose content
+        // has between the specified 'minLength' and 'maxLength' characters,
+        // some of which are escape sequences.
+    {
+        static const char *const k_ESCAPES[] = {
+            "\\\\", "\\\"", "\\\\\\\"", "\\n", "\\/", "\\u00e9"
+        };
+        static const char k_PLAIN[] = "abcdefghijklmnopqrstuvwxyz 0123456789"
+                                      "{}[]:,.-+'";
+
+        const int length = minLength + random(maxLength - minLength + 1);
+        *result += '"';
+        for (int i = 0; i < length; ++i) {
+            if (0 == random(12)) {
+                *result += k_ESCAPES[random(sizeof k_ESCAPES /
+                                                      sizeof *k_ESCAPES)];
+            }
+            else {
+                *result += k_PLAIN[random(sizeof k_PLAIN - 1)];
+            }
+        }
+        *result += '"';
+    }
+
+    void appendSimpleValue(bsl::string *result)
+        // Append to the specified 'result' a non-string value (a number or a
+        // literal) of varying length.
+    {
+        static const char k_DIGITS[] = "0123456789";
+
+        switch (random(4)) {
+          case 0: {
+            *result += 0 == random(2) ? "true" : "false";
+          } break;
+          case 1: {
+            *result += "null";
+          } break;
+          default: {
+            if (random(2)) {
+                *result += '-';
+            }
+            const int length = 1 + random(40);
+            for (int i = 0; i < length; ++i) {
+                *result += k_DIGITS[random(10)];
+            }
+            if (random(2)) {
+                *result += ".5e-7";
+            }
+          }
+        }
+    }
+
+  public:
+    // CREATORS
+    DocumentGenerator(bsl::string              *document,
+                      bsl::vector<bsl::string> *names,
+                      bsl::vector<bsl::string> *values,
+                      unsigned int              seed)
+        // Create a generator that appends to the specified 'document' and
+        // records the expected name and value of each element in the
+        // specified 'names' and 'values' respectively, using the specified
+        // 'seed' to initialize the sequence of pseudo-random choices.
+    : d_seed(seed)
+    , d_document_p(document)
+    , d_names_p(names)
+    , d_values_p(values)
+    {
+    }
+
+    // MANIPULATORS
+    void generate(int numElements, int maxWhitespace)
+        // Append to the document a JSON object having the specified
+        // 'numElements' elements whose values are strings, numbers, or
+        // literals, separated by runs of at most the specified
+        // 'maxWhitespace' whitespace characters.  Names are never empty, as
+        // the tokenizer does not report a value for an empty name.  Note that
+        // the expected value of a name excludes its enclosing quotes whereas
+        // the expected value of a string value includes them, as reported by
+        // the tokenizer.
+    {
+        appendWhitespace(maxWhitespace);
+        *d_document_p += '{';
+        for (int i = 0; i < numElements; ++i) {
+            if (i) {
+                *d_document_p += ',';
+            }
+            appendWhitespace(maxWhitespace);
+
+            bsl::string name(d_document_p->get_allocator());
+            appendString(&name, 1, 70);
+            *d_document_p += name;
+            d_names_p->push_back(name.substr(1, name.length() - 2));
+
+            appendWhitespace(maxWhitespace);
+            *d_document_p += ':';
+            appendWhitespace(maxWhitespace);
+
+            bsl::string value(d_document_p->get_allocator());
+            if (random(2)) {
+                appendString(&value, 0, 70);
+            }
+            else {
+                appendSimpleValue(&value);
+            }
+            *d_document_p += value;
+            d_values_p->push_back(value);
+
+            appendWhitespace(maxWhitespace);
+        }
+        *d_document_p += '}';
+    }
+};
+
+void verifyContiguousInput(int                line,
+                           const bsl::string& input,
+                           bool               checkUtf8,
+                           bool               allowStandAloneValues)
+    // Tokenize the specified 'input' both from a 'streambuf' and as
+    // contiguous input, and verify that the same sequence of tokens, values,
+    // and final read status and offset is reported, that each value reported
+    // from contiguous input refers into that input, and that no memory is
+    // allocated when tokenizing contiguous input.  Use the specified
+    // 'checkUtf8' and 'allowStandAloneValues' to configure the tokenizers,
+    // and the specified 'line' to identify any failures.  Note that the
+    // contiguous input is followed by additional characters that would change
+    // the result if they were read.
+{
+    bslma::TestAllocator sa("stream",     false);
+    bslma::TestAllocator ca("contiguous", false);
+
+    bsl::string buffer(input, &sa);
+    buffer += "}]\"} x";
+
+    bdlsb::FixedMemInStreamBuf isb(input.data(), input.length());
+
+    Obj mS(&sa);  const Obj& S = mS;
+    Obj mC(&ca);  const Obj& C = mC;
+
+    mS.setAllowNonUTF8Tokens(!checkUtf8);
+    mC.setAllowNonUTF8Tokens(!checkUtf8);
+    mS.setAllowStandAloneValues(allowStandAloneValues);
+    mC.setAllowStandAloneValues(allowStandAloneValues);
+
+    mS.reset(&isb);
+    mC.reset(bsl::string_view(buffer.data(), input.length()));
+
+    const Int64 numBlocks = ca.numBlocksTotal();
+
+    for (int i = 0; ; ++i) {
+        const int rcS = mS.advanceToNextToken();
+        const int rcC = mC.advanceToNextToken();
+
+        ASSERTV(line, i, rcS, rcC, rcS == rcC);
+        ASSERTV(line, i, S.tokenType(), C.tokenType(),
+                S.tokenType() == C.tokenType());
+
+        bslstl::StringRef valueS, valueC;
+        const int vrcS = S.value(&valueS);
+        const int vrcC = C.value(&valueC);
+
+        ASSERTV(line, i, vrcS, vrcC, vrcS == vrcC);
+        ASSERTV(line, i, valueS, valueC, valueS == valueC);
+
+        if (0 == vrcC) {
+            ASSERTV(line, i, buffer.data() <= valueC.data());
+            ASSERTV(line, i, valueC.data() + valueC.length() <=
+                                              buffer.data() + input.length());
+        }
+
+        if (rcS || rcC || testStatus) {
+            break;
+        }
+    }
+
+    ASSERTV(line, S.readStatus(), C.readStatus(),
+            S.readStatus() == C.readStatus());
+    ASSERTV(line, S.readOffset(), C.readOffset(),
+            S.readOffset() == C.readOffset());
+    ASSERTV(line, numBlocks, ca.numBlocksTotal(),
+            numBlocks == ca.numBlocksTotal());
+
+    ASSERTV(line, 0 == mC.resetStreamBufGetPointer());
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -487,7 +723,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 18: {
+      case 20: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -609,6 +845,314 @@ int main(int argc, char *argv[])
     ASSERT(10022           == address.d_zipcode);
 //..
       } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // TESTING CONTIGUOUS INPUT
+        //
+        // Concerns:
+        //: 1 Tokenizing contiguous input reports the same tokens, values, read
+        //:   status, and read offset as tokenizing the same data from a
+        //:   'streambuf', for valid and invalid JSON, with and without UTF-8
+        //:   checking, and for documents and values larger than the internal
+        //:   buffer.
+        //:
+        //: 2 The values reported refer into the input, and no memory is
+        //:   allocated.
+        //:
+        //: 3 Only the characters within the supplied input are read, so the
+        //:   input need not be null-terminated.
+        //:
+        //: 4 'resetStreamBufGetPointer' has no effect, and returns 0.
+        //:
+        //: 5 A tokenizer can be reset between contiguous input and a
+        //:   'streambuf'.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, tokenize valid and invalid JSON
+        //:   text, stand-alone values, text containing invalid UTF-8, and
+        //:   generated documents both from a 'streambuf' and as contiguous
+        //:   input followed by additional characters, and verify that the
+        //:   results agree, that values refer into the input, and that no
+        //:   memory is allocated.  (C-1..4)
+        //:
+        //: 2 Repeat P-1 for documents containing string and non-string values
+        //:   longer than the internal buffer, and directly verify a
+        //:   stand-alone value longer than the internal buffer.  (C-1..4)
+        //:
+        //: 3 Alternately reset a tokenizer to contiguous input and to a
+        //:   'streambuf' holding the same text, and verify the first two
+        //:   tokens each time.  (C-5)
+        //
+        // Testing:
+        //   void reset(const bsl::string_view& input);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CONTIGUOUS INPUT" << endl
+                          << "========================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        static const struct {
+            int         d_line;        // source line number
+            const char *d_input_p;     // JSON text
+            bool        d_standAlone;  // allow stand-alone values
+        } DATA[] = {
+            //LINE  INPUT                                        STAND ALONE
+            //----  -----                                        -----------
+            { L_,   "",                                          false      },
+            { L_,   "   ",                                       false      },
+            { L_,   "{}",                                        false      },
+            { L_,   "[]",                                        false      },
+            { L_,   " { \"a\" : 1 } ",                           false      },
+            { L_,   "{\"a\":\"b\",\"c\":[1,2,{\"d\":null}]}",    false      },
+            { L_,   "{\"a\":\"x\\\"y\\\\\",\"b\":\"\\\\\"}",     false      },
+            { L_,   "[\"a\", 1.5e-7, true, false, null]",        false      },
+            { L_,   "{\"a\":1",                                  false      },
+            { L_,   "{\"a\":\"unterminated",                     false      },
+            { L_,   "{\"a\"",                                    false      },
+            { L_,   "{\"a\" 1}",                                 false      },
+            { L_,   "{]",                                        false      },
+            { L_,   "\"stand-alone\"",                           true       },
+            { L_,   "\"stand-alone\"",                           false      },
+            { L_,   "12345",                                     true       },
+            { L_,   "  12345  ",                                 true       },
+            { L_,   "{\"a\":\"\xc3\xa9\xe2\x82\xac\"}",          false      },
+            { L_,   "{\"a\":\"\xc3\"}",                          false      },
+            { L_,   "{\"a\":\"abc\xff\"}",                       false      },
+            { L_,   "{\"a\":\"\xed\xa0\x80\"}",                  false      },
+            { L_,   "{\"a\":\"abc\xf0\x9f\x98",                  false      },
+        };
+        enum { k_NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        if (verbose) cout << "\nTesting table-driven input." << endl;
+
+        for (int ti = 0; ti < k_NUM_DATA; ++ti) {
+            const int         LINE        = DATA[ti].d_line;
+            const bsl::string INPUT(DATA[ti].d_input_p, &ta);
+            const bool        STAND_ALONE = DATA[ti].d_standAlone;
+
+            if (veryVerbose) { P_(LINE) P(INPUT) }
+
+            for (int utf8 = 0; utf8 < 2; ++utf8) {
+                u::verifyContiguousInput(LINE, INPUT, utf8, STAND_ALONE);
+            }
+        }
+
+        if (verbose) cout << "\nTesting generated documents." << endl;
+
+        for (unsigned int seed = 1; seed <= 4; ++seed) {
+            bsl::string              document(&ta);
+            bsl::vector<bsl::string> names(&ta);
+            bsl::vector<bsl::string> values(&ta);
+
+            u::DocumentGenerator generator(&document, &names, &values, seed);
+            generator.generate(500, 20);
+
+            for (int utf8 = 0; utf8 < 2; ++utf8) {
+                u::verifyContiguousInput(L_, document, utf8, false);
+            }
+        }
+
+        if (verbose) cout << "\nTesting values larger than the buffer."
+                          << endl;
+        {
+            const bsl::string LONG_STRING(20000, 'x', &ta);
+            const bsl::string LONG_NUMBER(20000, '7', &ta);
+
+            const bsl::string DOCUMENTS[] = {
+                "{\"" + LONG_STRING + "\":\"" + LONG_STRING + "\"}",
+                "{\"a\":[" + LONG_NUMBER + "," + LONG_NUMBER + "]}",
+                "{\"a\":\"" + LONG_STRING,
+                "\"" + LONG_STRING + "\""
+            };
+            enum { k_NUM_DOCUMENTS = sizeof DOCUMENTS / sizeof *DOCUMENTS };
+
+            for (int ti = 0; ti < k_NUM_DOCUMENTS; ++ti) {
+                for (int utf8 = 0; utf8 < 2; ++utf8) {
+                    u::verifyContiguousInput(L_, DOCUMENTS[ti], utf8, true);
+                }
+            }
+
+            // A stand-alone non-string value is reported whole, without
+            // reading past the end of the input.
+
+            const bsl::string BUFFER = LONG_NUMBER + "8";
+
+            for (int utf8 = 0; utf8 < 2; ++utf8) {
+                Obj mX(&ta);  const Obj& X = mX;
+                mX.setAllowNonUTF8Tokens(!utf8);
+                mX.reset(bsl::string_view(BUFFER.data(),
+                                          LONG_NUMBER.length()));
+
+                bslstl::StringRef value;
+
+                ASSERTV(utf8, 0 == mX.advanceToNextToken());
+                ASSERTV(utf8, Obj::e_ELEMENT_VALUE == X.tokenType());
+                ASSERTV(utf8, 0 == X.value(&value));
+                ASSERTV(utf8, LONG_NUMBER == value);
+                ASSERTV(utf8, BUFFER.data() == value.data());
+                ASSERTV(utf8, 0 != mX.advanceToNextToken());
+                ASSERTV(utf8, Obj::k_EOF == X.readStatus());
+            }
+        }
+
+        if (verbose) cout << "\nTesting alternating 'reset' overloads."
+                          << endl;
+        {
+            const char        INPUT[] = "{\"name\":\"value\"}";
+            bslstl::StringRef value;
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 4; ++i) {
+                bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof INPUT - 1);
+
+                if (i & 1) {
+                    mX.reset(&isb);
+                }
+                else {
+                    mX.reset(bsl::string_view(INPUT, sizeof INPUT - 1));
+                }
+
+                ASSERTV(i, 0 == mX.advanceToNextToken());
+                ASSERTV(i, Obj::e_START_OBJECT == X.tokenType());
+                ASSERTV(i, 0 == mX.advanceToNextToken());
+                ASSERTV(i, Obj::e_ELEMENT_NAME == X.tokenType());
+                ASSERTV(i, 0 == X.value(&value));
+                ASSERTV(i, value, "name" == value);
+                ASSERTV(i, (0 == (i & 1)) == (INPUT + 2 == value.data()));
+            }
+        }
+      } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // SCANNING ACROSS ALIGNMENTS AND BUFFER BOUNDARIES
+        //
+        // Concerns:
+        //: 1 Runs of whitespace of any length, starting at any offset, are
+        //:   skipped, including runs that span the tokenizer's internal
+        //:   buffer.
+        //:
+        //: 2 The end of a string is found regardless of where quotes and
+        //:   escape sequences fall relative to the blocks scanned at once,
+        //:   and an escaped quote (but not a quote following an escaped
+        //:   backslash) never ends a string.
+        //:
+        //: 3 Non-string values of any length are terminated by each kind of
+        //:   delimiter.
+        //:
+        //: 4 The behavior is the same whether or not UTF-8 checking is
+        //:   enabled, and in UTF-8 mode 'readOffset' reports the length of the
+        //:   entire document after it has been read.
+        //
+        // Plan:
+        //: 1 Using a pseudo-random generator with several seeds, create JSON
+        //:   objects larger than the tokenizer's buffer containing randomly
+        //:   sized whitespace runs, strings with escape sequences at random
+        //:   positions, and values of random length, recording the expected
+        //:   name and value of each element.  (C-1..3)
+        //:
+        //: 2 Tokenize each document with and without UTF-8 checking, and
+        //:   verify the type and value of each token and, in UTF-8 mode, the
+        //:   final 'readOffset'.  (C-1..4)
+        //
+        // Testing:
+        //   SCANNING ACROSS ALIGNMENTS AND BUFFER BOUNDARIES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "SCANNING ACROSS ALIGNMENTS AND BUFFER BOUNDARIES" << endl
+                 << "================================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        static const struct {
+            int d_line;           // source line number
+            int d_numElements;    // number of elements in the object
+            int d_maxWhitespace;  // longest whitespace run
+        } DATA[] = {
+            //LINE  NUM ELEMENTS  MAX WHITESPACE
+            //----  ------------  --------------
+            { L_,              0,              0 },
+            { L_,              1,             40 },
+            { L_,             10,              3 },
+            { L_,            200,              0 },
+            { L_,            200,             17 },
+            { L_,            400,             40 },
+            { L_,            100,            300 },
+        };
+        enum { k_NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        for (int ti = 0; ti < k_NUM_DATA; ++ti) {
+            const int LINE           = DATA[ti].d_line;
+            const int NUM_ELEMENTS   = DATA[ti].d_numElements;
+            const int MAX_WHITESPACE = DATA[ti].d_maxWhitespace;
+
+            for (unsigned int seed = 1; seed <= 8; ++seed) {
+                bsl::string              document(&ta);
+                bsl::vector<bsl::string> names(&ta);
+                bsl::vector<bsl::string> values(&ta);
+
+                u::DocumentGenerator generator(&document,
+                                               &names,
+                                               &values,
+                                               seed);
+                generator.generate(NUM_ELEMENTS, MAX_WHITESPACE);
+
+                if (veryVerbose) {
+                    P_(LINE) P_(seed) P(document.length());
+                }
+
+                for (int utf8 = 0; utf8 < 2; ++utf8) {
+                    bdlsb::FixedMemInStreamBuf isb(document.data(),
+                                                   document.length());
+
+                    Obj mX(&ta);  const Obj& X = mX;
+                    mX.setAllowNonUTF8Tokens(!utf8);
+                    mX.reset(&isb);
+
+                    bslstl::StringRef value;
+
+                    ASSERTV(LINE, seed, utf8, 0 == mX.advanceToNextToken());
+                    ASSERTV(LINE, seed, utf8, X.tokenType(),
+                            Obj::e_START_OBJECT == X.tokenType());
+
+                    for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                        ASSERTV(LINE, seed, utf8, i,
+                                0 == mX.advanceToNextToken());
+                        ASSERTV(LINE, seed, utf8, i, X.tokenType(),
+                                Obj::e_ELEMENT_NAME == X.tokenType());
+                        ASSERTV(LINE, seed, utf8, i, 0 == X.value(&value));
+                        ASSERTV(LINE, seed, utf8, i, names[i], value,
+                                names[i] == value);
+
+                        ASSERTV(LINE, seed, utf8, i,
+                                0 == mX.advanceToNextToken());
+                        ASSERTV(LINE, seed, utf8, i, X.tokenType(),
+                                Obj::e_ELEMENT_VALUE == X.tokenType());
+                        ASSERTV(LINE, seed, utf8, i, 0 == X.value(&value));
+                        ASSERTV(LINE, seed, utf8, i, values[i], value,
+                                values[i] == value);
+
+                        if (testStatus) {
+                            break;
+                        }
+                    }
+
+                    ASSERTV(LINE, seed, utf8, 0 == mX.advanceToNextToken());
+                    ASSERTV(LINE, seed, utf8, X.tokenType(),
+                            Obj::e_END_OBJECT == X.tokenType());
+
+                    if (utf8) {
+                        ASSERTV(LINE, seed, X.readOffset(), document.length(),
+                                static_cast<bsl::size_t>(X.readOffset()) ==
+                                                            document.length());
+                    }
+                }
+            }
+        }
+      } break;
       case 17: {
         // --------------------------------------------------------------------
         // TESTING UTF8
@@ -7262,6 +7806,89 @@ int main(int argc, char *argv[])
         Obj mX;  const Obj& X = mX;
         ASSERTV(X.tokenType(), Obj::e_BEGIN == X.tokenType());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: TOKENIZING THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Report the rate at which documents dominated by whitespace,
+        //:   strings, and numbers are tokenized, from a 'streambuf' and as
+        //:   contiguous input.
+        //
+        // Plan:
+        //: 1 Generate documents with little and with much whitespace,
+        //:   tokenize each repeatedly from a 'streambuf' and as contiguous
+        //:   input, with and without UTF-8 checking, and report the
+        //:   throughput in MB/s as CSV.
+        //
+        // Testing:
+        //   PERFORMANCE: TOKENIZING THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: TOKENIZING THROUGHPUT" << endl
+                          << "==================================" << endl;
+
+        bslma::Allocator *alloc = &bslma::NewDeleteAllocator::singleton();
+        bslma::DefaultAllocatorGuard guard(alloc);
+
+        const int k_ITERATIONS = argc > 2 ? atoi(argv[2]) : 20;
+
+        cout << "maxWhitespace,contiguous,utf8,documentBytes,MBPerSecond"
+             << endl;
+
+        static const int MAX_WHITESPACE[] = { 1, 8, 64 };
+
+        for (int wi = 0; wi < 3; ++wi) {
+            bsl::string              document(alloc);
+            bsl::vector<bsl::string> names(alloc);
+            bsl::vector<bsl::string> values(alloc);
+
+            u::DocumentGenerator generator(&document, &names, &values, 7);
+            generator.generate(20000, MAX_WHITESPACE[wi]);
+
+            for (int mode = 0; mode < 4; ++mode) {
+                const bool contiguous = mode & 2;
+                const bool utf8       = mode & 1;
+
+                bsls::Stopwatch timer;
+                timer.start();
+
+                Int64 numTokens = 0;
+                for (int iter = 0; iter < k_ITERATIONS; ++iter) {
+                    bdlsb::FixedMemInStreamBuf isb(document.data(),
+                                                   document.length());
+
+                    Obj mX(alloc);
+                    mX.setAllowNonUTF8Tokens(!utf8);
+                    if (contiguous) {
+                        mX.reset(bsl::string_view(document));
+                    }
+                    else {
+                        mX.reset(&isb);
+                    }
+
+                    while (0 == mX.advanceToNextToken()
+                        && Obj::e_END_OBJECT != mX.tokenType()) {
+                        ++numTokens;
+                    }
+                }
+
+                timer.stop();
+
+                ASSERTV(numTokens,
+                        (2 * 20000 + 1) * Int64(k_ITERATIONS) == numTokens);
+
+                const double mb = static_cast<double>(document.length())
+                                * k_ITERATIONS / (1024.0 * 1024.0);
+
+                cout << MAX_WHITESPACE[wi] << ',' << contiguous << ','
+                     << utf8 << ','
+                     << document.length() << ','
+                     << mb / timer.elapsedTime() << endl;
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
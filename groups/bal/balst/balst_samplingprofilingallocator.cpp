@@ -0,0 +1,490 @@
+// balst_samplingprofilingallocator.cpp                               -*-C++-*-
+#include <balst_samplingprofilingallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balst_samplingprofilingallocator_cpp,"$Id$ $CSID$")
+
+#include <balst_stacktrace.h>
+#include <balst_stacktraceframe.h>
+#include <balst_stacktraceutil.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bslma_default.h>
+#include <bslma_deallocatorproctor.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_stackaddressutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_fstream.h>
+#include <bsl_iomanip.h>
+#include <bsl_ios.h>
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+
+namespace {
+
+typedef bsls::StackAddressUtil AddressUtil;
+
+enum {
+    k_SKIPPED_FRAMES = AddressUtil::k_IGNORE_FRAMES + 1
+        // On some platforms, gathering the stack pointers wastes one frame
+        // gathering the address of 'AddressUtil::getStackAddresses', which is
+        // reflected in whether 'AddressUtil::k_IGNORE_FRAMES' is 0 or 1.  The
+        // frame of 'SamplingProfilingAllocator::allocate' follows it.  Neither
+        // frame is of any interest to the user, and neither is recorded.
+};
+
+double scaleFactor(bsls::Types::Int64 count,
+                   bsls::Types::Int64 bytes,
+                   bsls::Types::Int64 sampleInterval)
+    // Return the factor by which the specified 'count' sampled allocations
+    // totalling the specified 'bytes' must be multiplied to estimate the
+    // values for all allocations made from the same call stack, given the
+    // specified 'sampleInterval'.  An allocation of 'size' bytes is sampled
+    // with probability '1 - exp(-size / sampleInterval)'; the average size of
+    // the sampled allocations stands for 'size'.
+{
+    if (sampleInterval <= 1 || 0 >= count) {
+        return 1.0;                                                   // RETURN
+    }
+
+    const double averageSize = static_cast<double>(bytes)
+                             / static_cast<double>(count);
+
+    return 1.0 / (1.0 - bsl::exp(-averageSize
+                                 / static_cast<double>(sampleInterval)));
+}
+
+void writeAddress(bsl::ostream& stream, const void *address)
+    // Write the specified 'address' to the specified 'stream' in hexadecimal,
+    // prefixed with "0x".
+{
+    stream << "0x" << bsl::hex
+           << reinterpret_cast<bsls::Types::UintPtr>(address)
+           << bsl::dec;
+}
+
+}  // close unnamed namespace
+
+namespace balst {
+
+                      // ---------------------------------------------
+                      // struct SamplingProfilingAllocator::BlockHeader
+                      // ---------------------------------------------
+
+struct SamplingProfilingAllocator::BlockHeader {
+    // This 'struct' is stored at the beginning of each block dispensed by a
+    // 'SamplingProfilingAllocator', and is padded to maximal alignment, so
+    // that the memory following it is maximally aligned.
+
+    union {
+        struct {
+            Record    *d_record_p;  // statistics of the call stack at which
+                                    // the block was allocated, or 0 if the
+                                    // block was not sampled
+
+            size_type  d_size;      // size requested by the client
+        }                                  d_info;
+
+        bsls::AlignmentUtil::MaxAlignedType d_alignment;
+                                                 // force maximal alignment
+    };
+};
+
+                      // --------------------------------
+                      // class SamplingProfilingAllocator
+                      // --------------------------------
+
+// PRIVATE MANIPULATORS
+bsls::Types::Int64 SamplingProfilingAllocator::nextSampleDistance()
+{
+    if (1 == d_sampleInterval) {
+        return 1;                                                     // RETURN
+    }
+
+    // 'xorshift64*', producing a uniform variate in '(0, 1]', transformed
+    // into an exponential variate by inversion.
+
+    d_randomState ^= d_randomState >> 12;
+    d_randomState ^= d_randomState << 25;
+    d_randomState ^= d_randomState >> 27;
+
+    const bsls::Types::Uint64 bits = (d_randomState * 0x2545F4914F6CDD1DULL)
+                                                                        >> 11;
+    const double              u    = (static_cast<double>(bits) + 1.0)
+                                   / 9007199254740992.0;   // 2^53
+
+    const double distance = -bsl::log(u)
+                          * static_cast<double>(d_sampleInterval);
+
+    return distance < 1.0 ? 1 : static_cast<bsls::Types::Int64>(distance);
+}
+
+// PRIVATE ACCESSORS
+void SamplingProfilingAllocator::snapshot(
+                         bsl::vector<bsl::pair<Stack, Record> > *result) const
+{
+    BSLS_ASSERT(result);
+
+    result->clear();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    result->reserve(d_records.size());
+    for (RecordMap::const_iterator it = d_records.begin();
+         it != d_records.end();
+         ++it) {
+        result->push_back(*it);
+    }
+}
+
+// CREATORS
+SamplingProfilingAllocator::SamplingProfilingAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_bytesUntilSample(0)
+, d_numBytesInUse(0)
+, d_numSamples(0)
+, d_sampleInterval(k_DEFAULT_SAMPLE_INTERVAL)
+, d_numRecordedFrames(k_DEFAULT_NUM_RECORDED_FRAMES)
+, d_randomState(reinterpret_cast<bsls::Types::UintPtr>(this)
+                                                     ^ 0x9E3779B97F4A7C15ULL)
+, d_records(basicAllocator)
+, d_demangleFlag(true)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_bytesUntilSample = nextSampleDistance();
+}
+
+SamplingProfilingAllocator::SamplingProfilingAllocator(
+                                     bsls::Types::Int64  sampleInterval,
+                                     bslma::Allocator   *basicAllocator)
+: d_bytesUntilSample(0)
+, d_numBytesInUse(0)
+, d_numSamples(0)
+, d_sampleInterval(sampleInterval)
+, d_numRecordedFrames(k_DEFAULT_NUM_RECORDED_FRAMES)
+, d_randomState(reinterpret_cast<bsls::Types::UintPtr>(this)
+                                                     ^ 0x9E3779B97F4A7C15ULL)
+, d_records(basicAllocator)
+, d_demangleFlag(true)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= sampleInterval);
+
+    d_bytesUntilSample = nextSampleDistance();
+}
+
+SamplingProfilingAllocator::SamplingProfilingAllocator(
+                                     bsls::Types::Int64  sampleInterval,
+                                     int                 numRecordedFrames,
+                                     bslma::Allocator   *basicAllocator)
+: d_bytesUntilSample(0)
+, d_numBytesInUse(0)
+, d_numSamples(0)
+, d_sampleInterval(sampleInterval)
+, d_numRecordedFrames(numRecordedFrames)
+, d_randomState(reinterpret_cast<bsls::Types::UintPtr>(this)
+                                                     ^ 0x9E3779B97F4A7C15ULL)
+, d_records(basicAllocator)
+, d_demangleFlag(true)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= sampleInterval);
+    BSLS_ASSERT(1 <= numRecordedFrames);
+    BSLS_ASSERT(     numRecordedFrames <= k_MAX_NUM_RECORDED_FRAMES);
+
+    d_bytesUntilSample = nextSampleDistance();
+}
+
+SamplingProfilingAllocator::~SamplingProfilingAllocator()
+{
+}
+
+// MANIPULATORS
+void *SamplingProfilingAllocator::allocate(size_type size)
+{
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    BlockHeader *header = static_cast<BlockHeader *>(
+                          d_allocator_p->allocate(sizeof(BlockHeader) + size));
+
+    header->d_info.d_record_p = 0;
+    header->d_info.d_size     = size;
+
+    const bsls::Types::Int64 signedSize =
+                                       static_cast<bsls::Types::Int64>(size);
+
+    if (d_bytesUntilSample.addRelaxed(-signedSize) <= 0) {
+        // This allocation is sampled.  Note that the stack is walked here,
+        // rather than in a helper function, so that exactly one frame
+        // ('allocate') is to be skipped in addition to the ignored frames.
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(header,
+                                                            d_allocator_p);
+
+        void *addresses[k_MAX_NUM_RECORDED_FRAMES + k_SKIPPED_FRAMES];
+
+        int numAddresses = AddressUtil::getStackAddresses(
+                                      addresses,
+                                      d_numRecordedFrames + k_SKIPPED_FRAMES);
+
+        numAddresses = bsl::max(numAddresses, static_cast<int>(
+                                                            k_SKIPPED_FRAMES));
+
+        const Stack stack(addresses + k_SKIPPED_FRAMES,
+                          addresses + numAddresses,
+                          d_allocator_p);
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        // Several threads may observe a non-positive countdown concurrently;
+        // only the first of them to acquire the mutex draws a new distance.
+
+        if (d_bytesUntilSample.loadRelaxed() <= 0) {
+            d_bytesUntilSample.storeRelaxed(nextSampleDistance());
+        }
+
+        const Record zero = { 0, 0, 0, 0 };
+
+        Record& record =
+                  d_records.insert(bsl::make_pair(stack, zero)).first->second;
+
+        ++record.d_allocCount;
+        ++record.d_liveCount;
+        record.d_allocBytes += signedSize;
+        record.d_liveBytes  += signedSize;
+
+        header->d_info.d_record_p = &record;
+
+        d_numSamples.addRelaxed(1);
+
+        proctor.release();
+    }
+
+    d_numBytesInUse.addRelaxed(signedSize);
+
+    return header + 1;
+}
+
+void SamplingProfilingAllocator::deallocate(void *address)
+{
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    BlockHeader *header = static_cast<BlockHeader *>(address) - 1;
+
+    const bsls::Types::Int64 signedSize =
+                        static_cast<bsls::Types::Int64>(header->d_info.d_size);
+
+    d_numBytesInUse.addRelaxed(-signedSize);
+
+    if (header->d_info.d_record_p) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        --header->d_info.d_record_p->d_liveCount;
+        header->d_info.d_record_p->d_liveBytes -= signedSize;
+    }
+
+    d_allocator_p->deallocate(header);
+}
+
+void SamplingProfilingAllocator::setDemanglingPreferredFlag(bool value)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_demangleFlag = value;
+}
+
+// ACCESSORS
+int SamplingProfilingAllocator::numStacks() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return static_cast<int>(d_records.size());
+}
+
+bsl::ostream& SamplingProfilingAllocator::writeFoldedStacks(
+                                                   bsl::ostream& stream,
+                                                   Metric        metric) const
+{
+    bsl::vector<bsl::pair<Stack, Record> > records(d_allocator_p);
+    snapshot(&records);
+
+    bool demangleFlag;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        demangleFlag = d_demangleFlag;
+    }
+
+    StackTrace  st(d_allocator_p);
+    bsl::string name(d_allocator_p);
+
+    for (bsl::size_t i = 0; i < records.size(); ++i) {
+        const Stack&  stack  = records[i].first;
+        const Record& record = records[i].second;
+
+        bsls::Types::Int64 count;
+        bsls::Types::Int64 bytes;
+        bool               reportBytes;
+
+        switch (metric) {
+          case e_IN_USE_BYTES: {
+            count       = record.d_liveCount;
+            bytes       = record.d_liveBytes;
+            reportBytes = true;
+          } break;
+          case e_IN_USE_COUNT: {
+            count       = record.d_liveCount;
+            bytes       = record.d_liveBytes;
+            reportBytes = false;
+          } break;
+          case e_ALLOCATED_BYTES: {
+            count       = record.d_allocCount;
+            bytes       = record.d_allocBytes;
+            reportBytes = true;
+          } break;
+          default: {
+            BSLS_ASSERT(e_ALLOCATED_COUNT == metric);
+
+            count       = record.d_allocCount;
+            bytes       = record.d_allocBytes;
+            reportBytes = false;
+          } break;
+        }
+
+        const double scale = scaleFactor(count, bytes, d_sampleInterval);
+        const bsls::Types::Int64 value = static_cast<bsls::Types::Int64>(
+                     static_cast<double>(reportBytes ? bytes : count) * scale
+                                                                       + 0.5);
+
+        if (0 >= value || stack.empty()) {
+            continue;
+        }
+
+        st.removeAll();
+        const int numFrames = static_cast<int>(stack.size());
+
+        int rc = StackTraceUtil::loadStackTraceFromAddressArray(
+                                                               &st,
+                                                               &stack.front(),
+                                                               numFrames,
+                                                               demangleFlag);
+
+        if (0 != rc || st.length() != numFrames) {
+            st.removeAll();
+        }
+
+        // Frames are written from the outermost to the innermost, as expected
+        // by flame graph tools.  A ';' is the frame separator of the format,
+        // and is replaced where it occurs in a symbol name.
+
+        for (int j = numFrames - 1; 0 <= j; --j) {
+            if (j != numFrames - 1) {
+                stream << ';';
+            }
+
+            if (st.length() && !st[j].symbolName().empty()) {
+                name = st[j].symbolName();
+                bsl::replace(name.begin(), name.end(), ';', ':');
+                stream << name;
+            }
+            else {
+                writeAddress(stream, stack[j]);
+            }
+        }
+
+        stream << ' ' << value << '\n';
+    }
+
+    return stream;
+}
+
+bsl::ostream& SamplingProfilingAllocator::writeHeapProfile(
+                                                   bsl::ostream& stream) const
+{
+    bsl::vector<bsl::pair<Stack, Record> > records(d_allocator_p);
+    snapshot(&records);
+
+    bsls::Types::Int64 liveCount  = 0;
+    bsls::Types::Int64 liveBytes  = 0;
+    bsls::Types::Int64 allocCount = 0;
+    bsls::Types::Int64 allocBytes = 0;
+
+    for (bsl::size_t i = 0; i < records.size(); ++i) {
+        liveCount  += records[i].second.d_liveCount;
+        liveBytes  += records[i].second.d_liveBytes;
+        allocCount += records[i].second.d_allocCount;
+        allocBytes += records[i].second.d_allocBytes;
+    }
+
+    // The header and each entry are of the form:
+    //..
+    //  <in use count>: <in use bytes> [<alloc count>: <alloc bytes>] @ ...
+    //..
+    // where the header ends with the sampling interval, and each entry with
+    // the addresses of the frames of its call stack, innermost first.
+
+    stream << "heap profile: "
+           << bsl::setw(6) << liveCount  << ": "
+           << bsl::setw(8) << liveBytes  << " ["
+           << bsl::setw(6) << allocCount << ": "
+           << bsl::setw(8) << allocBytes << "] @ heap_v2/"
+           << d_sampleInterval << '\n';
+
+    for (bsl::size_t i = 0; i < records.size(); ++i) {
+        const Stack&  stack  = records[i].first;
+        const Record& record = records[i].second;
+
+        stream << bsl::setw(6) << record.d_liveCount  << ": "
+               << bsl::setw(8) << record.d_liveBytes  << " ["
+               << bsl::setw(6) << record.d_allocCount << ": "
+               << bsl::setw(8) << record.d_allocBytes << "] @";
+
+        for (bsl::size_t j = 0; j < stack.size(); ++j) {
+            stream << ' ';
+            writeAddress(stream, stack[j]);
+        }
+        stream << '\n';
+    }
+
+    stream << "\nMAPPED_LIBRARIES:\n";
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    bsl::ifstream maps("/proc/self/maps");
+    if (maps) {
+        stream << maps.rdbuf();
+    }
+#endif
+
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
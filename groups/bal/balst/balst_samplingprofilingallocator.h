@@ -0,0 +1,439 @@
+// balst_samplingprofilingallocator.h                                 -*-C++-*-
+#ifndef INCLUDED_BALST_SAMPLINGPROFILINGALLOCATOR
+#define INCLUDED_BALST_SAMPLINGPROFILINGALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator that samples allocations per call stack.
+//
+//@CLASSES:
+//  balst::SamplingProfilingAllocator: heap-profiling allocator
+//
+//@SEE_ALSO: balst_stacktracetestallocator, bdlma_countingallocator
+//
+//@DESCRIPTION: This component provides an instrumented allocator,
+// 'balst::SamplingProfilingAllocator', that implements the 'bslma::Allocator'
+// protocol and builds a heap profile of the memory allocated through it:
+// allocation requests are sampled, and, for each distinct call stack at which
+// a sampled allocation was made, the number of blocks and bytes allocated
+// (cumulatively) and currently in use are recorded.  At any time, the profile
+// can be written in either of two text formats:
+//: o 'writeHeapProfile' writes the legacy heap profile format of
+//:   'gperftools', which is read by 'pprof'.
+//:
+//: o 'writeFoldedStacks' writes one line per call stack, listing the
+//:   (resolved) frames from the outermost to the innermost, separated by ';',
+//:   followed by a value; this "folded stack" format is read by
+//:   'flamegraph.pl' and similar flame graph tools.
+//..
+//              ,---------------------------------.
+//             ( balst::SamplingProfilingAllocator )
+//              `---------------------------------'
+//                               |         ctor/dtor
+//                               |         numBytesInUse
+//                               |         numSamples
+//                               |         numStacks
+//                               |         numRecordedFrames
+//                               |         sampleInterval
+//                               |         setDemanglingPreferredFlag
+//                               |         writeFoldedStacks
+//                               |         writeHeapProfile
+//                               V
+//                       ,----------------.
+//                      ( bslma::Allocator )
+//                       `----------------'
+//                                         allocate
+//                                         deallocate
+//..
+// Whereas 'bdlma::CountingAllocator' and 'bslma::TestAllocator' only track
+// totals, and 'balst::StackTraceTestAllocator' records a stack trace for
+// every block (at a cost that limits it to test drivers), a
+// 'balst::SamplingProfilingAllocator' is cheap enough to be left in place in
+// production code, and attributes memory usage to the code that caused it.
+//
+///Sampling
+///--------
+// Sampling is performed in the style of 'tcmalloc': on average, one
+// allocation is sampled for every 'sampleInterval' bytes allocated, with the
+// distance (in bytes) between two consecutive samples drawn from an
+// exponential distribution.  The probability that an allocation of 'size'
+// bytes is sampled is therefore '1 - exp(-size / sampleInterval)', which
+// makes large allocations (that is, allocations of 'sampleInterval' bytes or
+// more) almost certain to be sampled, and allows the sampled values to be
+// scaled back to unbiased estimates of the actual values.  'writeHeapProfile'
+// writes the raw sampled values, along with the sampling interval, leaving
+// the scaling to 'pprof'; 'writeFoldedStacks' writes scaled values.
+//
+// A 'sampleInterval' of 1 samples every allocation, in which case the
+// recorded values are exact.
+//
+///Overhead / Efficiency
+///---------------------
+// Each block dispensed by a 'balst::SamplingProfilingAllocator' is preceded
+// by a maximally-aligned header of two words, recording the size of the block
+// and, if the block was sampled, the call stack at which the block was
+// allocated.  Allocating or deallocating a block that is not sampled involves
+// no locking and no stack walk, and costs a few atomic operations in addition
+// to the cost of the underlying allocator.  Allocating or deallocating a
+// sampled block acquires a mutex and, on allocation, walks the stack.
+// Resolving the stack addresses of a profile to symbol names is expensive, and
+// is put off until 'writeFoldedStacks' is called; it is performed without
+// holding the mutex, so that a 'balst::SamplingProfilingAllocator' may be
+// installed as the default allocator.
+//
+///Thread Safety
+///-------------
+// 'balst::SamplingProfilingAllocator' is fully thread-safe, meaning any
+// operation on the same object can be safely invoked from any thread.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding Out Where Memory Is Used
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service keeps a cache of strings, and we wish to find out
+// which part of the service accounts for most of its memory usage.
+//
+// First, we define two functions that allocate memory, one of which allocates
+// considerably more than the other:
+//..
+//  void loadCache(bsl::vector<bsl::string> *cache)
+//      // Append a large number of long strings to the specified 'cache'.
+//  {
+//      for (int i = 0; i < 1000; ++i) {
+//          cache->push_back(bsl::string(1000, 'x'));
+//      }
+//  }
+//
+//  void loadIndex(bsl::vector<int> *index)
+//      // Append a small number of integers to the specified 'index'.
+//  {
+//      for (int i = 0; i < 100; ++i) {
+//          index->push_back(i);
+//      }
+//  }
+//..
+// Then, we create a sampling profiling allocator that samples, on average,
+// one allocation per 4096 bytes allocated, and supply it to the containers
+// used by the service:
+//..
+//  balst::SamplingProfilingAllocator profiler(4096);
+//
+//  bsl::vector<bsl::string> cache(&profiler);
+//  bsl::vector<int>         index(&profiler);
+//
+//  loadCache(&cache);
+//  loadIndex(&index);
+//..
+// Next, we observe that, although only some of the allocations were sampled,
+// the total amount of memory in use is tracked exactly:
+//..
+//  assert(0 < profiler.numSamples());
+//  assert(1000 * 1000 < profiler.numBytesInUse());
+//..
+// Then, we write the profile of the memory currently in use, in a format that
+// can be rendered as a flame graph:
+//..
+//  bsl::ostringstream folded;
+//  profiler.writeFoldedStacks(
+//                         folded,
+//                         balst::SamplingProfilingAllocator::e_IN_USE_BYTES);
+//..
+// Each line of 'folded' lists the frames of one call stack, separated by ';',
+// followed by the (estimated) number of bytes in use that were allocated from
+// that stack.  Piping the output into 'flamegraph.pl' will show that almost
+// all of the memory in use is attributable to 'loadCache'.
+//
+// Finally, we write the same profile in a format that can be read by 'pprof',
+// which resolves the call stacks itself using the list of mapped libraries
+// that is appended to the profile:
+//..
+//  bsl::ostringstream heap;
+//  profiler.writeHeapProfile(heap);
+//
+//  assert(0 == heap.str().find("heap profile: "));
+//..
+// Saved to a file, the profile can be examined with, e.g.:
+//..
+//  $ pprof --text ./service service.heap
+//..
+
+#include <balscm_version.h>
+
+#include <bslmt_mutex.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_iosfwd.h>
+#include <bsl_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balst {
+
+                      // ================================
+                      // class SamplingProfilingAllocator
+                      // ================================
+
+class SamplingProfilingAllocator : public bslma::Allocator {
+    // This class defines a concrete allocator mechanism that implements the
+    // 'bslma::Allocator' protocol, forwarding allocation requests to an
+    // underlying allocator and sampling them to build a heap profile, keyed by
+    // the call stack at which each sampled allocation was made.  See
+    // {Sampling}.  This class is fully thread-safe.
+
+  public:
+    // PUBLIC TYPES
+    enum Metric {
+        // Enumerate the values that can be reported for each call stack by
+        // 'writeFoldedStacks'.
+
+        e_IN_USE_BYTES,      // bytes allocated and not yet deallocated
+        e_IN_USE_COUNT,      // blocks allocated and not yet deallocated
+        e_ALLOCATED_BYTES,   // bytes allocated since construction
+        e_ALLOCATED_COUNT    // blocks allocated since construction
+    };
+
+    enum {
+        k_DEFAULT_SAMPLE_INTERVAL      = 512 * 1024,
+                                      // average number of bytes allocated
+                                      // between two samples, if not specified
+
+        k_DEFAULT_NUM_RECORDED_FRAMES  = 32,
+                                      // number of frames recorded per sample,
+                                      // if not specified
+
+        k_MAX_NUM_RECORDED_FRAMES      = 64
+                                      // maximum number of frames recorded per
+                                      // sample
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Record {
+        // This 'struct' holds the statistics gathered for one call stack.
+
+        bsls::Types::Int64 d_allocCount;  // number of sampled allocations
+        bsls::Types::Int64 d_allocBytes;  // bytes of sampled allocations
+        bsls::Types::Int64 d_liveCount;   // sampled blocks in use
+        bsls::Types::Int64 d_liveBytes;   // bytes of sampled blocks in use
+    };
+
+    typedef bsl::vector<void *>           Stack;
+    typedef bsl::map<Stack, Record>       RecordMap;
+
+    struct BlockHeader;                   // information stored in each block
+                                          // (defined in .cpp)
+
+    // DATA
+    bsls::AtomicInt64   d_bytesUntilSample;   // countdown, in bytes, to the
+                                              // next sampled allocation
+
+    bsls::AtomicInt64   d_numBytesInUse;      // bytes currently allocated
+
+    bsls::AtomicInt64   d_numSamples;         // number of sampled allocations
+
+    const bsls::Types::Int64
+                        d_sampleInterval;     // mean distance, in bytes,
+                                              // between two samples
+
+    const int           d_numRecordedFrames;  // max number of frames recorded
+                                              // per sample
+
+    bsls::Types::Uint64 d_randomState;        // state of the generator of
+                                              // sampling distances
+
+    RecordMap           d_records;            // statistics per call stack
+
+    bool                d_demangleFlag;       // if 'true', demangling of
+                                              // symbol names is attempted
+
+    mutable bslmt::Mutex
+                        d_mutex;              // synchronize access to
+                                              // 'd_records', 'd_randomState'
+
+    bslma::Allocator   *d_allocator_p;        // held, not owned
+
+  private:
+    // NOT IMPLEMENTED
+    SamplingProfilingAllocator(const SamplingProfilingAllocator&);
+    SamplingProfilingAllocator& operator=(const SamplingProfilingAllocator&);
+
+    // PRIVATE MANIPULATORS
+    bsls::Types::Int64 nextSampleDistance();
+        // Return a distance, in bytes, to the next sampled allocation, drawn
+        // from an exponential distribution having a mean of
+        // 'd_sampleInterval'.  The behavior is undefined unless 'd_mutex' is
+        // locked by the calling thread.
+
+    void snapshot(bsl::vector<bsl::pair<Stack, Record> > *result) const;
+        // Load into the specified 'result' a copy of the statistics recorded
+        // for each call stack.
+
+  public:
+    // CREATORS
+    explicit
+    SamplingProfilingAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit
+    SamplingProfilingAllocator(bsls::Types::Int64  sampleInterval,
+                               bslma::Allocator   *basicAllocator = 0);
+    SamplingProfilingAllocator(bsls::Types::Int64  sampleInterval,
+                               int                 numRecordedFrames,
+                               bslma::Allocator   *basicAllocator = 0);
+        // Create a sampling profiling allocator.  Optionally specify a
+        // 'sampleInterval', the average number of bytes allocated between two
+        // sampled allocations; if 'sampleInterval' is not specified,
+        // 'k_DEFAULT_SAMPLE_INTERVAL' is used, and if 'sampleInterval' is 1,
+        // every allocation is sampled.  Optionally specify
+        // 'numRecordedFrames', the maximum number of stack frames recorded for
+        // each sampled allocation; if 'numRecordedFrames' is not specified,
+        // 'k_DEFAULT_NUM_RECORDED_FRAMES' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '1 <= sampleInterval', and
+        // '1 <= numRecordedFrames <= k_MAX_NUM_RECORDED_FRAMES'.
+
+    virtual ~SamplingProfilingAllocator();
+        // Destroy this allocator.  The behavior is undefined unless all memory
+        // allocated from this allocator has been deallocated.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return a newly allocated block of memory of (at least) the specified
+        // positive 'size' (in bytes), obtained from the underlying allocator,
+        // and, if the allocation is sampled, record the call stack at which
+        // it was made.  If 'size' is 0, a null pointer is returned with no
+        // other effect.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' to the
+        // underlying allocator, and, if the block was sampled, update the
+        // statistics of the call stack at which it was allocated.  If
+        // 'address' is 0, this function has no effect.  The behavior is
+        // undefined unless 'address' was allocated using this allocator
+        // object and has not already been deallocated.
+
+    void setDemanglingPreferredFlag(bool value);
+        // Set the 'demanglingPreferredFlag' attribute, which is used to
+        // determine whether demangling of symbols is to be attempted by
+        // 'writeFoldedStacks', to the specified 'value'.  The default value
+        // of the flag is 'true'.  However the flag is ignored on some
+        // platforms; demangling never happens on some platforms and always
+        // happens on others.
+
+    // ACCESSORS
+    bsls::Types::Int64 numBytesInUse() const;
+        // Return the number of bytes currently allocated from this object.
+        // Note that this value is exact, and does not depend on sampling.
+
+    bsls::Types::Int64 numSamples() const;
+        // Return the number of allocations that have been sampled since the
+        // construction of this object.
+
+    int numStacks() const;
+        // Return the number of distinct call stacks at which sampled
+        // allocations have been made.
+
+    int numRecordedFrames() const;
+        // Return the maximum number of stack frames recorded for each sampled
+        // allocation.
+
+    bsls::Types::Int64 sampleInterval() const;
+        // Return the average number of bytes allocated between two sampled
+        // allocations.
+
+    bsl::ostream& writeFoldedStacks(bsl::ostream& stream,
+                                    Metric        metric) const;
+        // Write to the specified 'stream' the profile of this allocator in
+        // folded stack format, reporting the specified 'metric' for each call
+        // stack, and return a reference to 'stream'.  Each line of the output
+        // holds the symbol names of the frames of one call stack, outermost
+        // first, separated by ';', followed by a space and the value of
+        // 'metric' for that stack, scaled to estimate the value for all (not
+        // only the sampled) allocations.  Call stacks for which the value is
+        // 0 are omitted.  Frames whose symbol cannot be resolved are written
+        // as their hexadecimal address.
+
+    bsl::ostream& writeHeapProfile(bsl::ostream& stream) const;
+        // Write to the specified 'stream' the profile of this allocator in the
+        // legacy 'gperftools' heap profile format ('heap_v2'), which is read
+        // by 'pprof', and return a reference to 'stream'.  The values written
+        // are the raw sampled values; 'pprof' scales them using the sampling
+        // interval that is written in the header of the profile.  Where the
+        // platform makes it available, the list of memory mappings of the
+        // process is appended to the profile, allowing 'pprof' to resolve the
+        // stack addresses to symbols.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                      // --------------------------------
+                      // class SamplingProfilingAllocator
+                      // --------------------------------
+
+// ACCESSORS
+inline
+bsls::Types::Int64 SamplingProfilingAllocator::numBytesInUse() const
+{
+    return d_numBytesInUse.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 SamplingProfilingAllocator::numSamples() const
+{
+    return d_numSamples.loadRelaxed();
+}
+
+inline
+int SamplingProfilingAllocator::numRecordedFrames() const
+{
+    return d_numRecordedFrames;
+}
+
+inline
+bsls::Types::Int64 SamplingProfilingAllocator::sampleInterval() const
+{
+    return d_sampleInterval;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *SamplingProfilingAllocator::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,871 @@
+// balst_samplingprofilingallocator.t.cpp                             -*-C++-*-
+#include <balst_samplingprofilingallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an instrumented allocator,
+// 'balst::SamplingProfilingAllocator', that forwards allocations to an
+// underlying allocator, and samples them to build a profile keyed by call
+// stack.  We must verify that blocks are correctly forwarded, sized, and
+// aligned; that the exact totals are maintained regardless of sampling; that,
+// when every allocation is sampled, the per-stack statistics are exact and
+// written correctly in both output formats; that, with a larger interval, the
+// number of samples and the scaled estimates agree with the sampling model;
+// and that the allocator can be used concurrently from several threads.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] SamplingProfilingAllocator(bslma::Allocator *basicAllocator = 0);
+// [ 2] SamplingProfilingAllocator(Int64 sampleInterval, Allocator *ba = 0);
+// [ 2] SamplingProfilingAllocator(Int64, int numRecordedFrames, ba = 0);
+// [ 2] ~SamplingProfilingAllocator();
+//
+// MANIPULATORS
+// [ 2] void *allocate(size_type size);
+// [ 2] void deallocate(void *address);
+// [ 4] void setDemanglingPreferredFlag(bool value);
+//
+// ACCESSORS
+// [ 2] bsls::Types::Int64 numBytesInUse() const;
+// [ 3] bsls::Types::Int64 numSamples() const;
+// [ 3] int numStacks() const;
+// [ 2] int numRecordedFrames() const;
+// [ 2] bsls::Types::Int64 sampleInterval() const;
+// [ 4] ostream& writeFoldedStacks(ostream& stream, Metric metric) const;
+// [ 3] ostream& writeHeapProfile(ostream& stream) const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] SAMPLING RATE
+// [ 6] CONCURRENCY
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balst::SamplingProfilingAllocator Obj;
+typedef bsls::Types::Int64                Int64;
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+void *allocateFromCache(bslma::Allocator *allocator, int size)
+    // Return a block of the specified 'size' allocated from the specified
+    // 'allocator'.  Note that this function is called through a 'volatile'
+    // function pointer, so that it has its own frame in the call stack.
+{
+    return allocator->allocate(size);
+}
+
+void *allocateFromIndex(bslma::Allocator *allocator, int size)
+    // Return a block of the specified 'size' allocated from the specified
+    // 'allocator'.  Note that this function is called through a 'volatile'
+    // function pointer, so that it has its own frame in the call stack.
+{
+    return allocator->allocate(size);
+}
+
+typedef void *(*AllocateFunction)(bslma::Allocator *, int);
+
+AllocateFunction volatile fromCache = &allocateFromCache;
+AllocateFunction volatile fromIndex = &allocateFromIndex;
+
+void fillStacks(vector<void *> *blocks, bslma::Allocator *allocator)
+    // Allocate from the specified 'allocator', appending the allocated blocks
+    // to the specified 'blocks': 3 blocks of 100 bytes from one call stack
+    // (through 'allocateFromCache'), and 2 blocks of 50 bytes from another
+    // (through 'allocateFromIndex').
+{
+    for (int i = 0; i < 3; ++i) {
+        blocks->push_back(fromCache(allocator, 100));
+    }
+    for (int i = 0; i < 2; ++i) {
+        blocks->push_back(fromIndex(allocator, 50));
+    }
+}
+
+Int64 valueOf(const string& folded, const char *symbol)
+    // Return the value on the line of the specified 'folded' output that
+    // contains the specified 'symbol', or -1 if there is no such line.
+{
+    istringstream in(folded);
+    string        line;
+
+    while (getline(in, line)) {
+        if (string::npos != line.find(symbol)) {
+            return atoi(line.c_str() + line.rfind(' ') + 1);
+        }
+    }
+    return -1;
+}
+
+                              // ==============
+                              // struct Churner
+                              // ==============
+
+struct Churner {
+    // This 'struct' is a thread function object that repeatedly allocates
+    // and deallocates blocks of varying size.
+
+    Obj *d_obj_p;  // allocator under test
+    int  d_seed;   // seed for the sizes allocated
+
+    void operator()() const
+        // Allocate and deallocate blocks from 'd_obj_p', leaving no block
+        // allocated on return.
+    {
+        enum { k_NUM_BLOCKS = 64 };
+
+        void *blocks[k_NUM_BLOCKS] = { 0 };
+        unsigned int state = d_seed;
+
+        for (int i = 0; i < 20000; ++i) {
+            state = state * 1103515245 + 12345;
+
+            const int slot = (state >> 8) % k_NUM_BLOCKS;
+
+            d_obj_p->deallocate(blocks[slot]);
+            blocks[slot] = d_obj_p->allocate(1 + (state >> 16) % 512);
+        }
+        for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+            d_obj_p->deallocate(blocks[i]);
+        }
+    }
+};
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding Out Where Memory Is Used
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service keeps a cache of strings, and we wish to find out
+// which part of the service accounts for most of its memory usage.
+//
+// First, we define two functions that allocate memory, one of which allocates
+// considerably more than the other:
+//..
+    void loadCache(bsl::vector<bsl::string> *cache)
+        // Append a large number of long strings to the specified 'cache'.
+    {
+        for (int i = 0; i < 1000; ++i) {
+            cache->push_back(bsl::string(1000, 'x'));
+        }
+    }
+
+    void loadIndex(bsl::vector<int> *index)
+        // Append a small number of integers to the specified 'index'.
+    {
+        for (int i = 0; i < 100; ++i) {
+            index->push_back(i);
+        }
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create a sampling profiling allocator that samples, on average,
+// one allocation per 4096 bytes allocated, and supply it to the containers
+// used by the service:
+//..
+    balst::SamplingProfilingAllocator profiler(4096);
+
+    bsl::vector<bsl::string> cache(&profiler);
+    bsl::vector<int>         index(&profiler);
+
+    loadCache(&cache);
+    loadIndex(&index);
+//..
+// Next, we observe that, although only some of the allocations were sampled,
+// the total amount of memory in use is tracked exactly:
+//..
+    ASSERT(0 < profiler.numSamples());
+    ASSERT(1000 * 1000 < profiler.numBytesInUse());
+//..
+// Then, we write the profile of the memory currently in use, in a format that
+// can be rendered as a flame graph:
+//..
+    bsl::ostringstream folded;
+    profiler.writeFoldedStacks(
+                           folded,
+                           balst::SamplingProfilingAllocator::e_IN_USE_BYTES);
+//..
+// Each line of 'folded' lists the frames of one call stack, separated by ';',
+// followed by the (estimated) number of bytes in use that were allocated from
+// that stack.  Piping the output into 'flamegraph.pl' will show that almost
+// all of the memory in use is attributable to 'loadCache'.
+//
+// Finally, we write the same profile in a format that can be read by 'pprof',
+// which resolves the call stacks itself using the list of mapped libraries
+// that is appended to the profile:
+//..
+    bsl::ostringstream heap;
+    profiler.writeHeapProfile(heap);
+
+    ASSERT(0 == heap.str().find("heap profile: "));
+//..
+// Saved to a file, the profile can be examined with, e.g.:
+//..
+//  $ pprof --text ./service service.heap
+//..
+
+        if (veryVerbose) {
+            cout << folded.str();
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Allocations and deallocations, sampled or not, may be performed
+        //:   concurrently from several threads.
+        //:
+        //: 2 Once all blocks are deallocated, the exact and the sampled
+        //:   in-use values are all 0.
+        //
+        // Plan:
+        //: 1 Start several threads that each allocate and deallocate blocks of
+        //:   varying size from the same object, with a small sampling
+        //:   interval, and join them.  Verify that no memory is in use in the
+        //:   object or in the underlying allocator, and that the in-use
+        //:   profile is empty.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        enum { k_NUM_THREADS = 4 };
+
+        bslma::TestAllocator ta("supplied", veryVeryVerbose);
+        {
+            Obj mX(256, &ta);  const Obj& X = mX;
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                Churner churner = { &mX, i + 1 };
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], churner));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            if (veryVerbose) { P_(X.numSamples()) P(X.numStacks()) }
+
+            ASSERT(0 <  X.numSamples());
+            ASSERT(0 == X.numBytesInUse());
+
+            ostringstream folded;
+            X.writeFoldedStacks(folded, Obj::e_IN_USE_COUNT);
+            ASSERTV(folded.str(), folded.str().empty());
+
+            ostringstream heap;
+            X.writeHeapProfile(heap);
+            ASSERTV(heap.str(),
+                    0 == heap.str().find("heap profile: "
+                                         "     0:        0 ["));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // SAMPLING RATE
+        //
+        // Concerns:
+        //: 1 On average, one allocation is sampled per 'sampleInterval' bytes
+        //:   allocated.
+        //:
+        //: 2 The scaled values written by 'writeFoldedStacks' estimate the
+        //:   actual values.
+        //:
+        //: 3 Allocations larger than the sampling interval are almost always
+        //:   sampled.
+        //
+        // Plan:
+        //: 1 Allocate a large number of small blocks from a single call stack
+        //:   with a sampling interval much larger than the blocks, and verify
+        //:   that the number of samples is within 10% of the number expected.
+        //:   (C-1)
+        //:
+        //: 2 Verify that the number of allocated bytes reported in folded
+        //:   format is within 10% of the actual number.  (C-2)
+        //:
+        //: 3 Allocate blocks 16 times the size of the sampling interval, and
+        //:   verify that each is sampled.  (C-3)
+        //
+        // Testing:
+        //   SAMPLING RATE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SAMPLING RATE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator ta("supplied", veryVeryVerbose);
+
+        if (verbose) cout << "\tSmall blocks." << endl;
+        {
+            enum { k_INTERVAL = 1024, k_NUM_BLOCKS = 200000, k_SIZE = 64 };
+
+            Obj mX(k_INTERVAL, &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                mX.deallocate(fromCache(&mX, k_SIZE));
+            }
+
+            const Int64 TOTAL    = static_cast<Int64>(k_NUM_BLOCKS) * k_SIZE;
+            const Int64 EXPECTED = TOTAL / k_INTERVAL;
+
+            if (veryVerbose) { P_(EXPECTED) P(X.numSamples()) }
+
+            ASSERTV(X.numSamples(), EXPECTED * 9 / 10 < X.numSamples());
+            ASSERTV(X.numSamples(), EXPECTED * 11 / 10 > X.numSamples());
+
+            ostringstream folded;
+            X.writeFoldedStacks(folded, Obj::e_ALLOCATED_BYTES);
+
+            const Int64 ESTIMATE = valueOf(folded.str(), "allocateFromCache");
+
+            if (veryVerbose) { P_(TOTAL) P(ESTIMATE) }
+
+            ASSERTV(ESTIMATE, TOTAL * 9 / 10 < ESTIMATE);
+            ASSERTV(ESTIMATE, TOTAL * 11 / 10 > ESTIMATE);
+
+            ASSERT(0 == X.numBytesInUse());
+        }
+
+        if (verbose) cout << "\tLarge blocks." << endl;
+        {
+            enum { k_INTERVAL = 1024, k_NUM_BLOCKS = 100 };
+
+            Obj mX(k_INTERVAL, &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                mX.deallocate(mX.allocate(16 * k_INTERVAL));
+            }
+
+            // Each block is sampled with probability '1 - exp(-16)'.
+
+            ASSERTV(X.numSamples(), k_NUM_BLOCKS == X.numSamples());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // FOLDED STACKS
+        //
+        // Concerns:
+        //: 1 Each call stack is written on one line, as a sequence of symbol
+        //:   names separated by ';', from the outermost frame to the
+        //:   innermost, followed by a space and the value of the requested
+        //:   metric.
+        //:
+        //: 2 Each metric reports the corresponding value, and stacks for
+        //:   which the value is 0 are omitted.
+        //:
+        //: 3 When every allocation is sampled, the values are exact.
+        //:
+        //: 4 The demangling preference may be changed.
+        //
+        // Plan:
+        //: 1 With a sampling interval of 1, allocate blocks from two call
+        //:   stacks, then deallocate the blocks from one of them.  Write the
+        //:   folded stacks for each metric, and verify the value reported on
+        //:   the line mentioning each allocating function.  (C-2..3)
+        //:
+        //: 2 Verify that frames are separated by ';', that the line
+        //:   ends with the value, and that 'main' precedes the allocating
+        //:   function.  (C-1)
+        //:
+        //: 3 Turn demangling off and verify that output is still produced.
+        //:   (C-4)
+        //
+        // Testing:
+        //   void setDemanglingPreferredFlag(bool value);
+        //   ostream& writeFoldedStacks(ostream& stream, Metric metric) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FOLDED STACKS" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator ta("supplied", veryVeryVerbose);
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            vector<void *> blocks;
+            fillStacks(&blocks, &mX);
+
+            for (int i = 3; i < 5; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            blocks.resize(3);
+
+            ostringstream inUseBytes;
+            ostringstream inUseCount;
+            ostringstream allocBytes;
+            ostringstream allocCount;
+
+            X.writeFoldedStacks(inUseBytes, Obj::e_IN_USE_BYTES);
+            X.writeFoldedStacks(inUseCount, Obj::e_IN_USE_COUNT);
+            X.writeFoldedStacks(allocBytes, Obj::e_ALLOCATED_BYTES);
+            X.writeFoldedStacks(allocCount, Obj::e_ALLOCATED_COUNT);
+
+            if (veryVerbose) { cout << allocBytes.str(); }
+
+            ASSERTV(inUseBytes.str(),
+                    300 == valueOf(inUseBytes.str(), "allocateFromCache"));
+            ASSERTV(inUseBytes.str(),
+                    -1  == valueOf(inUseBytes.str(), "allocateFromIndex"));
+            ASSERTV(inUseCount.str(),
+                    3   == valueOf(inUseCount.str(), "allocateFromCache"));
+            ASSERTV(allocBytes.str(),
+                    300 == valueOf(allocBytes.str(), "allocateFromCache"));
+            ASSERTV(allocBytes.str(),
+                    100 == valueOf(allocBytes.str(), "allocateFromIndex"));
+            ASSERTV(allocCount.str(),
+                    2   == valueOf(allocCount.str(), "allocateFromIndex"));
+
+            const string LINE = inUseBytes.str();
+
+            ASSERTV(LINE, 1 == count(LINE.begin(), LINE.end(), '\n'));
+            ASSERTV(LINE, string::npos != LINE.find(';'));
+            ASSERTV(LINE, string::npos != LINE.find(" 300\n"));
+            ASSERTV(LINE, LINE.find("main") < LINE.find("allocateFromCache"));
+
+            mX.setDemanglingPreferredFlag(false);
+
+            ostringstream mangled;
+            X.writeFoldedStacks(mangled, Obj::e_ALLOCATED_COUNT);
+            const string MANGLED = mangled.str();
+
+            ASSERTV(MANGLED,
+                    2 == count(MANGLED.begin(), MANGLED.end(), '\n'));
+
+            for (int i = 0; i < 3; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // HEAP PROFILE
+        //
+        // Concerns:
+        //: 1 Each distinct call stack of a sampled allocation is recorded
+        //:   once, and allocations from the same call stack are aggregated.
+        //:
+        //: 2 When every allocation is sampled, the counts and bytes allocated
+        //:   and in use are exact.
+        //:
+        //: 3 The heap profile is written in the 'heap_v2' format: a header
+        //:   holding the totals and the sampling interval, one line per call
+        //:   stack, and the list of mapped libraries.
+        //:
+        //: 4 No more than 'numRecordedFrames' frames are recorded.
+        //
+        // Plan:
+        //: 1 With a sampling interval of 1, allocate blocks from two call
+        //:   stacks, and verify 'numSamples' and 'numStacks'.  (C-1)
+        //:
+        //: 2 Deallocate some blocks, write the heap profile, and verify the
+        //:   header and the entries against the expected values.  (C-2..3)
+        //:
+        //: 3 Repeat with 'numRecordedFrames' of 1, and verify that each entry
+        //:   has a single address, and, since the innermost frames differ,
+        //:   that two stacks are still distinguished.  (C-4)
+        //
+        // Testing:
+        //   bsls::Types::Int64 numSamples() const;
+        //   int numStacks() const;
+        //   ostream& writeHeapProfile(ostream& stream) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "HEAP PROFILE" << endl
+                          << "============" << endl;
+
+        bslma::TestAllocator ta("supplied", veryVeryVerbose);
+
+        for (int numFrames = 1; numFrames <= 32; numFrames += 31) {
+            Obj mX(1, numFrames, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == X.numSamples());
+            ASSERT(0 == X.numStacks());
+
+            vector<void *> blocks;
+            fillStacks(&blocks, &mX);
+
+            ASSERTV(numFrames, X.numSamples(), 5 == X.numSamples());
+            ASSERTV(numFrames, X.numStacks(),  2 == X.numStacks());
+
+            mX.deallocate(blocks[0]);
+            mX.deallocate(blocks[3]);
+
+            ostringstream heap;
+            X.writeHeapProfile(heap);
+
+            if (veryVerbose) { cout << heap.str().substr(0, 400) << endl; }
+
+            const string PROFILE = heap.str();
+
+            ASSERTV(PROFILE,
+                    0 == PROFILE.find("heap profile: "
+                                      "     3:      250 "
+                                      "[     5:      400] @ heap_v2/1\n"));
+            ASSERTV(PROFILE,
+                    string::npos != PROFILE.find(
+                                   "\n     2:      200 [     3:      300] @"));
+            ASSERTV(PROFILE,
+                    string::npos != PROFILE.find(
+                                   "\n     1:       50 [     2:      100] @"));
+            ASSERTV(PROFILE,
+                    string::npos != PROFILE.find("\n\nMAPPED_LIBRARIES:\n"));
+
+            if (1 == numFrames) {
+                // Each entry holds a single address.
+
+                const bsl::size_t entry = PROFILE.find("] @ 0x", 40);
+
+                ASSERTV(PROFILE, string::npos != entry);
+                ASSERTV(PROFILE,
+                        PROFILE.find('\n', entry) < PROFILE.find(' ',
+                                                                 entry + 4));
+            }
+
+            mX.deallocate(blocks[1]);
+            mX.deallocate(blocks[2]);
+            mX.deallocate(blocks[4]);
+
+            ASSERT(0 == X.numBytesInUse());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CTORS, ALLOCATE, AND DEALLOCATE
+        //
+        // Concerns:
+        //: 1 Each constructor sets the sampling interval and the number of
+        //:   recorded frames to the specified or the default values.
+        //:
+        //: 2 Memory is supplied by the specified allocator, or by the default
+        //:   allocator if none is specified, and is all returned once the
+        //:   blocks are deallocated and the object destroyed.
+        //:
+        //: 3 Blocks are maximally aligned, can be written in full, and
+        //:   'numBytesInUse' reports the exact number of bytes in use.
+        //:
+        //: 4 Allocating 0 bytes returns 0, and deallocating 0 has no effect.
+        //
+        // Plan:
+        //: 1 Using each constructor, with and without an allocator, create an
+        //:   object and verify its attributes and 'allocator'.  (C-1)
+        //:
+        //: 2 Allocate blocks of sizes from 1 to 100, verify their alignment,
+        //:   write over them, and verify 'numBytesInUse' of the object.
+        //:   Deallocate them, and verify that no memory is in use in the
+        //:   object or in the allocator that supplied it.  (C-2..3)
+        //:
+        //: 3 Allocate 0 bytes and deallocate 0.  (C-4)
+        //
+        // Testing:
+        //   SamplingProfilingAllocator(bslma::Allocator *basicAllocator = 0);
+        //   SamplingProfilingAllocator(Int64 sampleInterval, Allocator *ba);
+        //   SamplingProfilingAllocator(Int64, int numRecordedFrames, ba);
+        //   ~SamplingProfilingAllocator();
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   bsls::Types::Int64 numBytesInUse() const;
+        //   int numRecordedFrames() const;
+        //   bsls::Types::Int64 sampleInterval() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CTORS, ALLOCATE, AND DEALLOCATE" << endl
+                          << "===============================" << endl;
+
+        for (char cfg = 'a'; cfg <= 'f'; ++cfg) {
+            const char CONFIG = cfg;
+
+            bslma::TestAllocator ta("supplied", veryVeryVerbose);
+
+            Obj *objPtr = 0;
+            bslma::TestAllocator *expAlloc = &ta;
+
+            Int64 expInterval = Obj::k_DEFAULT_SAMPLE_INTERVAL;
+            int   expFrames   = Obj::k_DEFAULT_NUM_RECORDED_FRAMES;
+
+            switch (CONFIG) {
+              case 'a': {
+                objPtr = new Obj();
+                expAlloc = &defaultAllocator;
+              } break;
+              case 'b': {
+                objPtr = new Obj(&ta);
+              } break;
+              case 'c': {
+                objPtr = new Obj(100);
+                expAlloc = &defaultAllocator;
+                expInterval = 100;
+              } break;
+              case 'd': {
+                objPtr = new Obj(1, &ta);
+                expInterval = 1;
+              } break;
+              case 'e': {
+                objPtr = new Obj(100, 4);
+                expAlloc = &defaultAllocator;
+                expInterval = 100;
+                expFrames   = 4;
+              } break;
+              case 'f': {
+                objPtr = new Obj(1, Obj::k_MAX_NUM_RECORDED_FRAMES, &ta);
+                expInterval = 1;
+                expFrames   = Obj::k_MAX_NUM_RECORDED_FRAMES;
+              } break;
+            }
+
+            Obj& mX = *objPtr;  const Obj& X = mX;
+
+            ASSERTV(CONFIG, expAlloc    == X.allocator());
+            ASSERTV(CONFIG, expInterval == X.sampleInterval());
+            ASSERTV(CONFIG, expFrames   == X.numRecordedFrames());
+
+            const Int64 numBytes = expAlloc->numBytesInUse();
+
+            ASSERTV(CONFIG, 0 == X.numBytesInUse());
+
+            void  *blocks[100];
+            Int64  total = 0;
+
+            for (int i = 0; i < 100; ++i) {
+                blocks[i] = mX.allocate(i + 1);
+                total += i + 1;
+
+                ASSERTV(CONFIG, i, 0 ==
+                          reinterpret_cast<bsls::Types::UintPtr>(blocks[i])
+                                % bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+
+                bsl::memset(blocks[i], 0xa5, i + 1);
+            }
+
+            ASSERTV(CONFIG, X.numBytesInUse(), total == X.numBytesInUse());
+            ASSERTV(CONFIG, total < expAlloc->numBytesInUse() - numBytes);
+
+            ASSERTV(CONFIG, 0 == mX.allocate(0));
+            mX.deallocate(0);
+
+            for (int i = 0; i < 100; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+
+            ASSERTV(CONFIG, 0 == X.numBytesInUse());
+
+            delete objPtr;
+
+            ASSERTV(CONFIG, 0 == ta.numBytesInUse());
+            ASSERTV(CONFIG, 0 == defaultAllocator.numBytesInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate a few blocks, sampling each, and write
+        //:   both profile formats.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("supplied", veryVeryVerbose);
+        {
+            Obj allocator(1, &ta);
+
+            void *p = allocator.allocate(8);
+            void *q = allocator.allocate(1000);
+
+            ASSERT(p && q);
+            ASSERT(1008 == allocator.numBytesInUse());
+            ASSERT(2    == allocator.numSamples());
+
+            allocator.deallocate(p);
+
+            ostringstream heap;
+            allocator.writeHeapProfile(heap);
+            if (veryVerbose) { cout << heap.str(); }
+
+            ostringstream folded;
+            allocator.writeFoldedStacks(folded, Obj::e_IN_USE_BYTES);
+            if (veryVerbose) { cout << folded.str(); }
+
+            ASSERT(string::npos != folded.str().find(" 1000\n"));
+
+            allocator.deallocate(q);
+            ASSERT(0 == allocator.numBytesInUse());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
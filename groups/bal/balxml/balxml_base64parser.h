@@ -103,6 +103,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlat_valuetypefunctions.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_iterator.h>
 
 #include <bsls_assert.h>
@@ -161,6 +162,15 @@ class Base64Parser {
         // 'INPUT_ITERATOR' must be dereferenceable to a 'char' value.  The
         // behavior is undefined unless an object is associated with this
         // parser.
+
+    int pushCharacters(const char *begin, const char *end);
+        // Push the characters ranging from the specified 'begin' up to (but
+        // not including) the specified 'end' into this parser.  Return 0 if
+        // successful and non-zero otherwise.  The behavior is undefined unless
+        // an object is associated with this parser.  Note that this overload
+        // decodes directly into the associated object using
+        // 'bdlde::Base64Decoder's contiguous-buffer fast path, and is
+        // considerably faster on large inputs than the iterator overload.
 };
 
 // ============================================================================
@@ -239,6 +249,40 @@ int Base64Parser<TYPE>::pushCharacters(INPUT_ITERATOR begin,
     return k_SUCCESS;
 }
 
+template <class TYPE>
+int Base64Parser<TYPE>::pushCharacters(const char *begin, const char *end)
+{
+    BSLS_ASSERT(d_object_p);
+
+    enum { k_SUCCESS = 0, k_FAILURE = -1 };
+
+    // Make room for the largest possible output, including that of up to 3
+    // characters retained by the decoder from earlier calls.
+
+    const bsl::size_t length  = d_object_p->size();
+    const int         maxSize = bdlde::Base64Decoder::maxDecodedLength(
+                                           static_cast<int>(end - begin) + 3);
+    d_object_p->resize(length + maxSize);
+
+    int numOut;
+    int numIn;
+    int status = d_base64Decoder.convert(&(*d_object_p)[0] + length,
+                                         &numOut,
+                                         &numIn,
+                                         begin,
+                                         end);
+
+    d_object_p->resize(length + numOut);
+
+    if (0 > status) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    BSLS_ASSERT(0 == status);  // nothing should be retained by decoder
+
+    return k_SUCCESS;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -4,9 +4,11 @@
 #include <bslim_testutil.h>
 
 #include <bdlb_printmethods.h>
+#include <bdlde_base64encoder.h>
 
 #include <bsls_review.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
@@ -14,6 +16,7 @@
 #include <bsl_istream.h>
 #include <bsl_iterator.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
 #include <bsl_vector.h>
 
 using namespace BloombergLP;
@@ -447,7 +450,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 3: {
+      case 4: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -461,6 +464,101 @@ int main(int argc, char *argv[])
         usageExample();
 
       } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'pushCharacters' OVERLOADS
+        //
+        // Concerns:
+        //: 1 The 'const char *' overload of 'pushCharacters' and the iterator
+        //:   overload produce the same value, for both supported types,
+        //:   however the input is divided into pushes.
+        //:
+        //: 2 Large inputs with line breaks are decoded correctly.
+        //
+        // Plan:
+        //: 1 Encode several kilobytes of arbitrary data with MIME line
+        //:   breaks.  For each of a set of chunk sizes, push the encoded text
+        //:   in chunks of that size into parsers for 'bsl::vector<char>' and
+        //:   'bsl::string', using both overloads, and verify that each result
+        //:   is the original data.  (C-1..2)
+        //
+        // Testing:
+        //   int pushCharacters(const char *begin, const char *end);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'pushCharacters' OVERLOADS"
+                          << "\n==================================" << endl;
+
+        const int DATA_SIZE = 5000;
+
+        bsl::string data(DATA_SIZE, '\0');
+        for (int i = 0; i < DATA_SIZE; ++i) {
+            data[i] = static_cast<char>(i * 7 + i / 256);
+        }
+
+        bsl::string encoded(bdlde::Base64Encoder::encodedLength(DATA_SIZE, 76),
+                            '\0');
+        bdlde::Base64Encoder::encodeBuffer(&encoded[0],
+                                           data.data(),
+                                           data.data() + DATA_SIZE,
+                                           76);
+
+        const int CHUNK_SIZES[] = { 1, 2, 3, 5, 77, 1000, 100000 };
+        const int NUM_CHUNK_SIZES = sizeof CHUNK_SIZES / sizeof *CHUNK_SIZES;
+
+        for (int ti = 0; ti < NUM_CHUNK_SIZES; ++ti) {
+            const bsl::size_t CHUNK_SIZE = CHUNK_SIZES[ti];
+
+            if (veryVerbose) { T_ P(CHUNK_SIZE) }
+
+            bsl::vector<char> vector1, vector2;
+            bsl::string       string1, string2;
+
+            balxml::Base64Parser<bsl::vector<char> > vectorParser1;
+            balxml::Base64Parser<bsl::vector<char> > vectorParser2;
+            balxml::Base64Parser<bsl::string>        stringParser1;
+            balxml::Base64Parser<bsl::string>        stringParser2;
+
+            ASSERT(0 == vectorParser1.beginParse(&vector1));
+            ASSERT(0 == vectorParser2.beginParse(&vector2));
+            ASSERT(0 == stringParser1.beginParse(&string1));
+            ASSERT(0 == stringParser2.beginParse(&string2));
+
+            for (bsl::size_t pos = 0; pos < encoded.size();
+                                                          pos += CHUNK_SIZE) {
+                const bsl::size_t length = bsl::min(CHUNK_SIZE,
+                                                    encoded.size() - pos);
+
+                const char *begin = encoded.data() + pos;
+                const char *end   = begin + length;
+
+                bsl::string::const_iterator first = encoded.begin() + pos;
+                bsl::string::const_iterator last  = first + length;
+
+                LOOP2_ASSERT(CHUNK_SIZE, pos,
+                             0 == vectorParser1.pushCharacters(begin, end));
+                LOOP2_ASSERT(CHUNK_SIZE, pos,
+                             0 == vectorParser2.pushCharacters(first, last));
+                LOOP2_ASSERT(CHUNK_SIZE, pos,
+                             0 == stringParser1.pushCharacters(begin, end));
+                LOOP2_ASSERT(CHUNK_SIZE, pos,
+                             0 == stringParser2.pushCharacters(first, last));
+            }
+
+            ASSERT(0 == vectorParser1.endParse());
+            ASSERT(0 == vectorParser2.endParse());
+            ASSERT(0 == stringParser1.endParse());
+            ASSERT(0 == stringParser2.endParse());
+
+            LOOP_ASSERT(CHUNK_SIZE, data == string1);
+            LOOP_ASSERT(CHUNK_SIZE, data == string2);
+
+            const bsl::vector<char> EXPECTED(data.begin(), data.end());
+
+            LOOP_ASSERT(CHUNK_SIZE, EXPECTED == vector1);
+            LOOP_ASSERT(CHUNK_SIZE, EXPECTED == vector2);
+        }
+      } break;
       case 2: {
         // --------------------------------------------------------------------
         // THOROUGH TEST
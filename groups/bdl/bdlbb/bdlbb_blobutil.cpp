@@ -696,6 +696,42 @@ int BlobUtil::compare(const Blob& a, const Blob& b)
 
     return lhsLen - rhsLen;
 }
+
+unsigned int BlobUtil::crc32c(const Blob& blob, unsigned int crc)
+{
+    return crc32c(blob, 0, blob.length(), crc);
+}
+
+unsigned int BlobUtil::crc32c(const Blob&  blob,
+                              int          offset,
+                              int          length,
+                              unsigned int crc)
+{
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(offset <= blob.length() - length);
+
+    if (0 == length) {
+        return crc;                                                   // RETURN
+    }
+
+    bsl::pair<int, int> place = findBufferIndexAndOffset(blob, offset);
+
+    while (0 < length) {
+        const BlobBuffer& buffer = blob.buffer(place.first);
+        const int         size   = bsl::min(length,
+                                            buffer.size() - place.second);
+
+        crc = bdlde::Crc32c::calculate(buffer.data() + place.second,
+                                       size,
+                                       crc);
+
+        length -= size;
+        ++place.first;
+        place.second = 0;
+    }
+    return crc;
+}
 }  // close package namespace
 
 }  // close enterprise namespace
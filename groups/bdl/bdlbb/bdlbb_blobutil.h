@@ -16,13 +16,15 @@ BSLS_IDENT("$Id: $")
 //@SEE_ALSO: bdlbb_blob
 //
 //@DESCRIPTION: This 'struct' provides a variety of utilities for 'bdlbb::Blob'
-// objects, 'bdlbb::BlobUtil', such as I/O functions, comparison functions, and
-// streaming functions.
+// objects, 'bdlbb::BlobUtil', such as I/O functions, comparison functions,
+// checksum functions, and streaming functions.
 
 #include <bdlscm_version.h>
 
 #include <bdlbb_blob.h>
 
+#include <bdlde_crc32c.h>
+
 #include <bslma_allocator.h>
 
 #include <bsls_assert.h>
@@ -226,6 +228,25 @@ struct BlobUtil {
         // lexicographically less than 'b', and a positive value if 'a' is
         // lexicographically greater than 'b'.
 
+    static unsigned int crc32c(
+                        const Blob&  blob,
+                        unsigned int crc = bdlde::Crc32c::k_NULL_CRC32C);
+    static unsigned int crc32c(
+                        const Blob&  blob,
+                        int          offset,
+                        int          length,
+                        unsigned int crc = bdlde::Crc32c::k_NULL_CRC32C);
+        // Return the CRC32-C checksum of the data held by the specified
+        // 'blob', using the optionally specified 'crc' value as the starting
+        // point for the calculation.  Optionally specify 'offset' and
+        // 'length' to checksum only the 'length' bytes of 'blob' starting at
+        // 'offset'; otherwise, all 'blob.length()' bytes are checksummed.
+        // The behavior is undefined unless '0 <= offset', '0 <= length', and
+        // 'offset + length <= blob.length()'.  Note that each buffer of 'blob'
+        // is checksummed in place, without copying the data to a contiguous
+        // area, and that the result is the same as that of
+        // 'bdlde::Crc32c::calculate' on a contiguous copy of the data.
+
     // ---------- DEPRECATED FUNCTIONS ------------- //
 
     // DEPRECATED FUNCTIONS: basicAllocator is no longer used
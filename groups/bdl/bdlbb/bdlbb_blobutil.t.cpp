@@ -12,6 +12,8 @@
 #include <bdlbb_blob.h>
 #include <bdlbb_simpleblobbufferfactory.h>
 
+#include <bdlde_crc32c.h>
+
 #include <bdlsb_fixedmemoutstreambuf.h>
 
 #include <bslim_testutil.h>
@@ -42,6 +44,8 @@ using namespace bsl;  // automatically added by script
 //=============================================================================
 //                                  TEST PLAN
 //-----------------------------------------------------------------------------
+// [13] crc32c(const Blob&, unsigned int);
+// [13] crc32c(const Blob&, int, int, unsigned int);
 // [12] padToAlignment(Blob *, int, char = 0);
 // [10] Testing copy to a blob
 // [ 9] Testing getContiguousRangeOrCopy
@@ -387,6 +391,122 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING CRC32C
+        //
+        // Concerns:
+        //: 1 'crc32c' returns the same value as 'bdlde::Crc32c::calculate'
+        //:   applied to a contiguous copy of the same bytes, for any buffer
+        //:   size, offset, and length, including ranges that start, end, or
+        //:   lie entirely within a single buffer.
+        //:
+        //: 2 The optional 'crc' argument is used as the starting point.
+        //:
+        //: 3 Bytes beyond 'blob.length()' in the last data buffer, and any
+        //:   capacity buffers, are ignored.
+        //:
+        //: 4 That 'assert's detect the undefined behavior in the contract.
+        //
+        // Plan:
+        //: 1 For a variety of buffer sizes and blob lengths, fill a blob with
+        //:   pseudo-random bytes, keeping a contiguous copy, and add capacity
+        //:   buffers filled with other bytes.  For many combinations of
+        //:   'offset' and 'length', compare 'crc32c' with the checksum of the
+        //:   contiguous copy, with and without a starting 'crc'.  (C-1..3)
+        //:
+        //: 2 Do negative testing to verify that asserts catch all the
+        //:   undefined behavior in the contract.  (C-4)
+        //
+        // Testing:
+        //   unsigned int crc32c(const Blob&, unsigned int);
+        //   unsigned int crc32c(const Blob&, int, int, unsigned int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING CRC32C\n"
+                             "==============\n";
+
+        const int BUFFER_SIZES[] = { 1, 3, 8, 64, 1000 };
+        const int LENGTHS[]      = { 0, 1, 7, 100, 3000 };
+        enum {
+            k_NUM_BUFFER_SIZES = sizeof BUFFER_SIZES / sizeof *BUFFER_SIZES,
+            k_NUM_LENGTHS      = sizeof LENGTHS      / sizeof *LENGTHS
+        };
+
+        const unsigned int SEED = 0x12345678;
+
+        for (int ti = 0; ti < k_NUM_BUFFER_SIZES; ++ti) {
+            const int BUFFER_SIZE = BUFFER_SIZES[ti];
+
+            for (int tj = 0; tj < k_NUM_LENGTHS; ++tj) {
+                const int LENGTH = LENGTHS[tj];
+
+                bslma::TestAllocator           ta("ta", veryVeryVerbose);
+                bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &ta);
+                bdlbb::Blob                    blob(&factory, &ta);
+
+                bsl::string data(&ta);
+                for (int i = 0; i < LENGTH; ++i) {
+                    data += static_cast<char>(i * 37 + i / 7);
+                }
+                if (LENGTH) {
+                    bdlbb::BlobUtil::append(&blob, data.data(), LENGTH);
+                }
+
+                // Fill any unused capacity with bytes that would change the
+                // checksum if they were included.
+
+                blob.setLength(blob.totalSize() + BUFFER_SIZE);
+                const bsl::string filler(blob.length() - LENGTH, '\xff', &ta);
+                bdlbb::BlobUtil::copy(&blob,
+                                      LENGTH,
+                                      filler.data(),
+                                      static_cast<int>(filler.length()));
+                blob.setLength(LENGTH);
+
+                ASSERTV(BUFFER_SIZE, LENGTH,
+                        bdlde::Crc32c::calculate(data.data(), LENGTH) ==
+                                               bdlbb::BlobUtil::crc32c(blob));
+                ASSERTV(BUFFER_SIZE, LENGTH,
+                        bdlde::Crc32c::calculate(data.data(), LENGTH, SEED) ==
+                                         bdlbb::BlobUtil::crc32c(blob, SEED));
+
+                const int STEP = LENGTH < 128 ? 1 : 13;
+                for (int offset = 0; offset <= LENGTH; offset += STEP) {
+                    for (int length = 0; offset + length <= LENGTH;
+                                                            length += STEP) {
+                        const char *BEGIN = data.data() + offset;
+
+                        ASSERTV(BUFFER_SIZE, LENGTH, offset, length,
+                                bdlde::Crc32c::calculate(BEGIN, length) ==
+                                bdlbb::BlobUtil::crc32c(blob, offset, length));
+                        ASSERTV(BUFFER_SIZE, LENGTH, offset, length,
+                                bdlde::Crc32c::calculate(BEGIN, length, SEED)
+                                       == bdlbb::BlobUtil::crc32c(blob,
+                                                                  offset,
+                                                                  length,
+                                                                  SEED));
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "Negative testing\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(8);
+            bdlbb::Blob                    blob(&factory);
+            bdlbb::BlobUtil::append(&blob, "0123456789", 10);
+
+            ASSERT_PASS(bdlbb::BlobUtil::crc32c(blob,  0, 10));
+            ASSERT_PASS(bdlbb::BlobUtil::crc32c(blob, 10,  0));
+            ASSERT_FAIL(bdlbb::BlobUtil::crc32c(blob, -1,  1));
+            ASSERT_FAIL(bdlbb::BlobUtil::crc32c(blob,  0, -1));
+            ASSERT_FAIL(bdlbb::BlobUtil::crc32c(blob,  1, 10));
+            ASSERT_FAIL(bdlbb::BlobUtil::crc32c(blob, 11,  0));
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // TESTING PADTOALIGNMENT
@@ -0,0 +1,1110 @@
+// bdlc_flathashmap.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashmap.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_stdexcept.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bdlc::FlatHashMap' is a thin adapter of 'bdlc::FlatHashTable', which is
+// tested thoroughly in its own component.  This test driver therefore
+// concentrates on the forwarding of each method to the table, on the map
+// semantics added by the adapter ('operator[]', 'at', and the entry
+// utility), and on the propagation of the allocator to the elements.
+//-----------------------------------------------------------------------------
+// FlatHashMap_EntryUtil
+// [ 2] void constructFromKey(ENTRY *, Allocator *, KEY_TYPE&& key);
+// [ 2] const KEY& key(const ENTRY& entry);
+//
+// FlatHashMap
+// [ 3] FlatHashMap();
+// [ 3] FlatHashMap(Allocator *basicAllocator);
+// [ 3] FlatHashMap(size_t capacity);
+// [ 3] FlatHashMap(size_t capacity, Allocator *basicAllocator);
+// [ 3] FlatHashMap(size_t capacity, const HASH& hash, Allocator *ba = 0);
+// [ 3] FlatHashMap(size_t, const HASH&, const EQUAL&, Allocator *ba = 0);
+// [ 3] FlatHashMap(INPUT_ITERATOR first, INPUT_ITERATOR last, ba = 0);
+// [ 3] FlatHashMap(INPUT_ITERATOR, INPUT_ITERATOR, size_t, ba = 0);
+// [ 3] FlatHashMap(INPUT_ITERATOR, INPUT_ITERATOR, size_t, HASH, ba = 0);
+// [ 3] FlatHashMap(INPUT_ITERATOR, INPUT_ITERATOR, size_t, H, E, ba);
+// [ 3] FlatHashMap(initializer_list<value_type> values, ba = 0);
+// [ 3] FlatHashMap(initializer_list<value_type>, size_t, ba = 0);
+// [ 3] FlatHashMap(initializer_list<value_type>, size_t, HASH, ba = 0);
+// [ 3] FlatHashMap(initializer_list<value_type>, size_t, H, E, ba);
+// [ 5] FlatHashMap(const FlatHashMap& original, Allocator *ba = 0);
+// [ 5] FlatHashMap(MovableRef<FlatHashMap> original);
+// [ 5] FlatHashMap(MovableRef<FlatHashMap> original, Allocator *ba);
+// [ 3] ~FlatHashMap();
+// [ 5] FlatHashMap& operator=(const FlatHashMap& rhs);
+// [ 5] FlatHashMap& operator=(MovableRef<FlatHashMap> rhs);
+// [ 5] FlatHashMap& operator=(initializer_list<value_type> values);
+// [ 4] VALUE& operator[](const KEY& key);
+// [ 4] VALUE& operator[](MovableRef<KEY> key);
+// [ 4] VALUE& at(const KEY& key);
+// [ 4] void clear();
+// [ 4] pair<iterator, iterator> equal_range(const KEY& key);
+// [ 4] size_t erase(const KEY& key);
+// [ 4] iterator erase(const_iterator position);
+// [ 4] iterator erase(iterator position);
+// [ 4] iterator erase(const_iterator first, const_iterator last);
+// [ 4] iterator find(const KEY& key);
+// [ 4] pair<iterator, bool> insert(const value_type& value);
+// [ 4] pair<iterator, bool> insert(MovableRef<value_type> value);
+// [ 4] iterator insert(const_iterator hint, const value_type& value);
+// [ 4] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 4] void insert(initializer_list<value_type> values);
+// [ 4] pair<iterator, bool> try_emplace(KEY_TYPE&& key);
+// [ 4] void rehash(size_t minimumCapacity);
+// [ 4] void reserve(size_t numEntries);
+// [ 4] void reset();
+// [ 4] iterator begin();
+// [ 4] iterator end();
+// [ 5] void swap(FlatHashMap& other);
+// [ 4] const VALUE& at(const KEY& key) const;
+// [ 3] size_t capacity() const;
+// [ 4] bool contains(const KEY& key) const;
+// [ 4] size_t count(const KEY& key) const;
+// [ 3] bool empty() const;
+// [ 4] pair<CI, CI> equal_range(const KEY& key) const;
+// [ 4] const_iterator find(const KEY& key) const;
+// [ 3] HASH hash_function() const;
+// [ 3] EQUAL key_eq() const;
+// [ 4] float load_factor() const;
+// [ 3] float max_load_factor() const;
+// [ 3] size_t size() const;
+// [ 4] const_iterator begin() const;
+// [ 4] const_iterator cbegin() const;
+// [ 4] const_iterator end() const;
+// [ 4] const_iterator cend() const;
+// [ 3] Allocator *allocator() const;
+// [ 3] bsl::allocator<value_type> get_allocator() const;
+//
+// [ 5] bool operator==(const FlatHashMap& lhs, const FlatHashMap& rhs);
+// [ 5] bool operator!=(const FlatHashMap& lhs, const FlatHashMap& rhs);
+// [ 5] void swap(FlatHashMap& a, FlatHashMap& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct ModHash {
+    // This functor returns the hash value of an integer key modulo a value
+    // supplied at construction.
+
+    // DATA
+    int d_modulus;  // modulus of the hash values
+
+    // CREATORS
+    explicit ModHash(int modulus = 1000)
+    : d_modulus(modulus)
+    {
+    }
+
+    // ACCESSORS
+    bsl::size_t operator()(int key) const
+    {
+        return static_cast<bsl::size_t>(key % d_modulus);
+    }
+};
+
+struct ModEqual {
+    // This functor compares integer keys modulo a value supplied at
+    // construction.
+
+    // DATA
+    int d_modulus;  // modulus of the comparison
+
+    // CREATORS
+    explicit ModEqual(int modulus = 1 << 30)
+    : d_modulus(modulus)
+    {
+    }
+
+    // ACCESSORS
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs % d_modulus == rhs % d_modulus;
+    }
+};
+
+typedef bdlc::FlatHashMap<int, int>                     Obj;
+typedef bdlc::FlatHashMap<int, int, ModHash, ModEqual>  ModObj;
+typedef bdlc::FlatHashMap<bsl::string, bsl::string>     StrObj;
+typedef Obj::value_type                                 Value;
+typedef StrObj::value_type                              StrValue;
+
+typedef bslmf::MovableRefUtil                           MoveUtil;
+
+const char *const LONG = "a string long enough to require an allocation: ";
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Gathering Document Statistics
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we wish to count the number of occurrences of each word in a
+// document, and later to look up the counts of some words.  Since lookups
+// dominate, 'bdlc::FlatHashMap' is a good choice of container.
+//
+// First, we define a document as a set of words:
+//..
+    const char *document[] = { "the", "quick", "brown", "fox", "jumps",
+                               "over", "the", "lazy", "dog", "the", "end" };
+
+    const bsl::size_t NUM_WORDS = sizeof document / sizeof *document;
+//..
+// Then, we create a map from each word to its number of occurrences:
+//..
+    bdlc::FlatHashMap<bsl::string, int> wordCounts;
+
+    for (bsl::size_t i = 0; i < NUM_WORDS; ++i) {
+        ++wordCounts[document[i]];
+    }
+//..
+// Next, we verify the number of distinct words:
+//..
+    ASSERT(9 == wordCounts.size());
+//..
+// Finally, we look up the counts of some words:
+//..
+    ASSERT(3 == wordCounts["the"]);
+    ASSERT(1 == wordCounts.find("fox")->second);
+    ASSERT(wordCounts.end() == wordCounts.find("cat"));
+    ASSERT(false == wordCounts.contains("cat"));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Copies have the value of the original and use the allocator
+        //:   supplied to them, or the default allocator.
+        //:
+        //: 2 Moves with the same allocator do not allocate, and moves with a
+        //:   different allocator produce elements using that allocator.
+        //:
+        //: 3 Assignment (copy, move, and from an initializer list) gives the
+        //:   target the value of the source and retains the allocator of the
+        //:   target.
+        //:
+        //: 4 'swap' exchanges the values of the maps.
+        //:
+        //: 5 Equality compares the elements, including the mapped values.
+        //
+        // Plan:
+        //: 1 Exercise each operation on maps of 'bsl::string' having various
+        //:   sizes, and verify the values and the allocators in use.
+        //:   (C-1..5)
+        //
+        // Testing:
+        //   FlatHashMap(const FlatHashMap& original, Allocator *ba = 0);
+        //   FlatHashMap(MovableRef<FlatHashMap> original);
+        //   FlatHashMap(MovableRef<FlatHashMap> original, Allocator *ba);
+        //   FlatHashMap& operator=(const FlatHashMap& rhs);
+        //   FlatHashMap& operator=(MovableRef<FlatHashMap> rhs);
+        //   FlatHashMap& operator=(initializer_list<value_type> values);
+        //   void swap(FlatHashMap& other);
+        //   bool operator==(const FlatHashMap& lhs, const FlatHashMap& rhs);
+        //   bool operator!=(const FlatHashMap& lhs, const FlatHashMap& rhs);
+        //   void swap(FlatHashMap& a, FlatHashMap& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                    << "COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY" << endl
+                    << "==========================================" << endl;
+
+        const int SIZES[] = { 0, 1, 5, 14, 15, 100 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N = SIZES[ti];
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+            bslma::TestAllocator oa("other",    veryVeryVeryVerbose);
+
+            StrObj mX(&sa);  const StrObj& X = mX;
+
+            for (int i = 0; i < N; ++i) {
+                mX[bsl::string(LONG) + char('A' + i % 26) + char('a' + i / 26)]
+                                                                 = LONG;
+            }
+
+            if (veryVerbose) { P_(N) P(X.size()) }
+
+            {
+                StrObj mY(X);  const StrObj& Y = mY;
+
+                ASSERTV(N, X == Y);
+                ASSERTV(N, !(X != Y));
+                ASSERTV(N, &defaultAllocator == Y.allocator());
+
+                StrObj mZ(X, &oa);  const StrObj& Z = mZ;
+
+                ASSERTV(N, X == Z);
+                ASSERTV(N, &oa == Z.allocator());
+
+                for (StrObj::const_iterator it = Z.begin();
+                     it != Z.end();
+                     ++it) {
+                    ASSERTV(N, &oa == it->first.allocator());
+                    ASSERTV(N, &oa == it->second.allocator());
+                }
+            }
+            ASSERTV(N, 0 == oa.numBlocksInUse());
+            ASSERTV(N, 0 == defaultAllocator.numBlocksInUse());
+
+            {
+                StrObj mY(X, &sa);
+
+                bslma::TestAllocatorMonitor sam(&sa);
+
+                StrObj mZ(MoveUtil::move(mY));  const StrObj& Z = mZ;
+
+                ASSERTV(N, sam.isTotalSame());
+                ASSERTV(N, X == Z);
+                ASSERTV(N, mY.empty());
+
+                StrObj mW(MoveUtil::move(mZ), &oa);  const StrObj& W = mW;
+
+                ASSERTV(N, X == W);
+                ASSERTV(N, &oa == W.allocator());
+
+                for (StrObj::const_iterator it = W.begin();
+                     it != W.end();
+                     ++it) {
+                    ASSERTV(N, &oa == it->first.allocator());
+                }
+            }
+            ASSERTV(N, 0 == oa.numBlocksInUse());
+
+            {
+                StrObj mY(&oa);  const StrObj& Y = mY;
+
+                mY["x"] = "y";
+
+                StrObj *mR = &(mY = X);
+
+                ASSERTV(N, mR == &mY);
+                ASSERTV(N, X == Y);
+                ASSERTV(N, &oa == Y.allocator());
+
+                StrObj mZ(X, &sa);
+
+                mY["x"] = "y";
+                mR = &(mY = MoveUtil::move(mZ));
+
+                ASSERTV(N, mR == &mY);
+                ASSERTV(N, X == Y);
+                ASSERTV(N, &oa == Y.allocator());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+                mR = &(mY = { StrValue("a", "b"), StrValue("c", "d") });
+
+                ASSERTV(N, mR == &mY);
+                ASSERTV(N, 2 == Y.size());
+                ASSERTV(N, "b" == Y.at("a"));
+                ASSERTV(N, "d" == Y.at("c"));
+                ASSERTV(N, &oa == Y.allocator());
+#endif
+            }
+            ASSERTV(N, 0 == oa.numBlocksInUse());
+
+            {
+                StrObj mY(&sa);  const StrObj& Y = mY;
+
+                mY["x"] = "y";
+
+                const StrObj XX(X, &sa);
+                const StrObj YY(Y, &sa);
+
+                bslma::TestAllocatorMonitor sam(&sa);
+
+                mX.swap(mY);
+
+                ASSERTV(N, sam.isTotalSame());
+                ASSERTV(N, XX == Y);
+                ASSERTV(N, YY == X);
+
+                swap(mX, mY);
+
+                ASSERTV(N, sam.isTotalSame());
+                ASSERTV(N, XX == X);
+                ASSERTV(N, YY == Y);
+            }
+
+            if (N) {
+                StrObj mY(X, &sa);  const StrObj& Y = mY;
+
+                mY.begin()->second = "different";
+
+                ASSERTV(N, X != Y);
+                ASSERTV(N, !(X == Y));
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 'operator[]' and 'try_emplace' insert a default-constructed
+        //:   mapped value if and only if the key is absent, and 'insert'
+        //:   inserts its argument if and only if the key is absent.
+        //:
+        //: 2 'at' returns the mapped value, and throws 'std::out_of_range' if
+        //:   the key is absent.
+        //:
+        //: 3 'erase', 'find', 'contains', 'count', and 'equal_range' forward
+        //:   to the table, and the key-equality functor is used.
+        //:
+        //: 4 The elements use the allocator of the map, and rvalue keys and
+        //:   values are moved.
+        //:
+        //: 5 'clear', 'reset', 'rehash', and 'reserve' forward to the table.
+        //:
+        //: 6 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Exercise each method and verify the result and the state of the
+        //:   map, using integer keys with a hasher and key-equality functor
+        //:   that identify keys modulo a constant, and using 'bsl::string'
+        //:   keys and values to verify allocator propagation.  (C-1..5)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-6)
+        //
+        // Testing:
+        //   VALUE& operator[](const KEY& key);
+        //   VALUE& operator[](MovableRef<KEY> key);
+        //   VALUE& at(const KEY& key);
+        //   void clear();
+        //   pair<iterator, iterator> equal_range(const KEY& key);
+        //   size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator find(const KEY& key);
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   pair<iterator, bool> insert(MovableRef<value_type> value);
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void insert(initializer_list<value_type> values);
+        //   pair<iterator, bool> try_emplace(KEY_TYPE&& key);
+        //   void rehash(size_t minimumCapacity);
+        //   void reserve(size_t numEntries);
+        //   void reset();
+        //   iterator begin();
+        //   iterator end();
+        //   const VALUE& at(const KEY& key) const;
+        //   bool contains(const KEY& key) const;
+        //   size_t count(const KEY& key) const;
+        //   pair<CI, CI> equal_range(const KEY& key) const;
+        //   const_iterator find(const KEY& key) const;
+        //   float load_factor() const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANIPULATORS AND ACCESSORS" << endl
+                          << "==========================" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nTesting insertion and lookup." << endl;
+        {
+            // Keys are equal modulo 100, and hash values are keys modulo 10,
+            // so that many distinct keys collide.
+
+            ModObj mX(0, ModHash(10), ModEqual(100), &sa);
+            const ModObj& X = mX;
+
+            ASSERT(0 == mX[5]);
+            ASSERT(1 == X.size());
+
+            mX[105] = 50;
+
+            ASSERT(1  == X.size());
+            ASSERT(50 == X.at(5));
+            ASSERT(50 == mX.at(205));
+
+            ASSERT(false == mX.try_emplace(305).second);
+            ASSERT(true  == mX.try_emplace(6).second);
+            ASSERT(0     == X.at(6));
+
+            bsl::pair<ModObj::iterator, bool> result = mX.insert(Value(7, 70));
+
+            ASSERT(true == result.second);
+            ASSERT(7    == result.first->first);
+            ASSERT(70   == result.first->second);
+
+            result = mX.insert(Value(107, 0));
+
+            ASSERT(false == result.second);
+            ASSERT(70    == result.first->second);
+
+            Value value(8, 80);
+
+            result = mX.insert(MoveUtil::move(value));
+
+            ASSERT(true == result.second);
+
+            ModObj::iterator it = mX.insert(X.begin(), Value(9, 90));
+
+            ASSERT(9 == it->first);
+
+            it = mX.insert(X.begin(), Value(109, 0));
+
+            ASSERT(90 == it->second);
+
+            const Value VALUES[] = { Value(10, 1),
+                                     Value(11, 1),
+                                     Value(10, 2) };
+
+            mX.insert(VALUES, VALUES + 3);
+
+            ASSERT(7 == X.size());
+            ASSERT(1 == X.at(10));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX.insert({ Value(12, 1), Value(13, 1), Value(112, 2) });
+
+            ASSERT(9 == X.size());
+            ASSERT(1 == X.at(12));
+#else
+            mX[12] = 1;
+            mX[13] = 1;
+#endif
+
+            ASSERT(X.contains(112));
+            ASSERT(1 == X.count(113));
+            ASSERT(0 == X.count(14));
+            ASSERT(X.end() == X.find(14));
+            ASSERT(X.find(13) != X.end());
+            ASSERT(mX.find(13) == X.find(113));
+
+            bsl::pair<ModObj::const_iterator, ModObj::const_iterator> cr =
+                                                           X.equal_range(10);
+            bsl::pair<ModObj::iterator, ModObj::iterator> r =
+                                                          mX.equal_range(110);
+
+            ASSERT(cr.first  == r.first);
+            ASSERT(cr.second == r.second);
+            ASSERT(10 == cr.first->first);
+
+            cr = X.equal_range(14);
+
+            ASSERT(cr.first  == X.end());
+            ASSERT(cr.second == X.end());
+
+            bsl::size_t count = 0;
+            for (ModObj::const_iterator it = X.cbegin();
+                 it != X.cend();
+                 ++it) {
+                ASSERTV(it->first, X.contains(it->first));
+                ++count;
+            }
+            ASSERT(X.size() == count);
+
+            ASSERT(0.0f < X.load_factor());
+            ASSERT(X.load_factor() <= X.max_load_factor());
+        }
+
+        if (verbose) cout << "\nTesting 'at' on absent keys." << endl;
+        {
+            Obj mX(&sa);  const Obj& X = mX;
+
+            mX[1] = 1;
+
+            bool caught = false;
+            try {
+                mX.at(2);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                X.at(2);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(1 == X.size());
+        }
+
+        if (verbose) cout << "\nTesting erasure." << endl;
+        {
+            Obj mX(&sa);  const Obj& X = mX;
+
+            for (int i = 0; i < 50; ++i) {
+                mX[i] = i;
+            }
+
+            ASSERT(1 == mX.erase(10));
+            ASSERT(0 == mX.erase(10));
+
+            Obj::iterator it = mX.find(11);
+            Obj::iterator next = it;
+            ++next;
+
+            ASSERT(next == mX.erase(it));
+            ASSERT(!X.contains(11));
+
+            Obj::const_iterator cit = X.find(12);
+            Obj::const_iterator cnext = cit;
+            ++cnext;
+
+            ASSERT(cnext == mX.erase(cit));
+            ASSERT(47 == X.size());
+
+            ASSERT(X.end() == mX.erase(X.begin(), X.end()));
+            ASSERT(X.empty());
+        }
+
+        if (verbose) cout << "\nTesting allocator propagation." << endl;
+        {
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            StrObj mX(&sa);  const StrObj& X = mX;
+
+            mX[LONG] = LONG;
+
+            bsl::string key(LONG, &sa);
+            key += "moved";
+
+            const char *KEY_DATA = key.data();
+
+            mX[MoveUtil::move(key)] = LONG;
+
+            ASSERT(X.find(bsl::string(LONG) + "moved")->first.data()
+                                                                 == KEY_DATA);
+
+            StrValue value(bsl::string(LONG) + "value", LONG, &sa);
+
+            mX.insert(MoveUtil::move(value));
+            mX.try_emplace(bsl::string(LONG) + "emplaced");
+
+            for (StrObj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(it->first, &sa == it->first.allocator());
+                ASSERTV(it->first, &sa == it->second.allocator());
+            }
+
+            ASSERT(dam.isInUseSame());
+        }
+
+        if (verbose) cout << "\nTesting capacity management." << endl;
+        {
+            Obj mX(&sa);  const Obj& X = mX;
+
+            mX.reserve(100);
+
+            const bsl::size_t CAPACITY = X.capacity();
+
+            ASSERT(100 <= CAPACITY);
+
+            for (int i = 0; i < 100; ++i) {
+                mX[i] = i;
+            }
+
+            ASSERT(CAPACITY == X.capacity());
+
+            mX.rehash(4 * CAPACITY);
+
+            ASSERT(4 * CAPACITY == X.capacity());
+            ASSERT(100 == X.size());
+
+            mX.clear();
+
+            ASSERT(4 * CAPACITY == X.capacity());
+            ASSERT(X.empty());
+
+            mX[1] = 1;
+            mX.reset();
+
+            ASSERT(0 == X.capacity());
+            ASSERT(X.empty());
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&sa);
+
+            mX[1] = 1;
+            mX[2] = 2;
+
+            ASSERT_SAFE_FAIL(mX.erase(mX.end()));
+            ASSERT_SAFE_FAIL(mX.erase(mX.cend()));
+            ASSERT_SAFE_PASS(mX.erase(mX.begin()));
+            ASSERT_SAFE_PASS(mX.erase(mX.cbegin()));
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a map having the specified elements,
+        //:   hasher, key-equality functor, and allocator, and at least the
+        //:   specified capacity.
+        //:
+        //: 2 If no allocator is supplied, the default allocator is used, and
+        //:   a map created without a capacity or elements allocates no
+        //:   memory.
+        //
+        // Plan:
+        //: 1 Create maps using each constructor and verify the state of each
+        //:   with the basic accessors.  (C-1..2)
+        //
+        // Testing:
+        //   FlatHashMap();
+        //   FlatHashMap(Allocator *basicAllocator);
+        //   FlatHashMap(size_t capacity);
+        //   FlatHashMap(size_t capacity, Allocator *basicAllocator);
+        //   FlatHashMap(size_t capacity, const HASH& hash, Allocator *ba = 0);
+        //   FlatHashMap(size_t, const HASH&, const EQUAL&, Allocator *ba = 0);
+        //   FlatHashMap(INPUT_ITERATOR first, INPUT_ITERATOR last, ba = 0);
+        //   FlatHashMap(INPUT_ITERATOR, INPUT_ITERATOR, size_t, ba = 0);
+        //   FlatHashMap(INPUT_ITERATOR, INPUT_ITERATOR, size_t, HASH, ba = 0);
+        //   FlatHashMap(INPUT_ITERATOR, INPUT_ITERATOR, size_t, H, E, ba);
+        //   FlatHashMap(initializer_list<value_type> values, ba = 0);
+        //   FlatHashMap(initializer_list<value_type>, size_t, ba = 0);
+        //   FlatHashMap(initializer_list<value_type>, size_t, HASH, ba = 0);
+        //   FlatHashMap(initializer_list<value_type>, size_t, H, E, ba);
+        //   ~FlatHashMap();
+        //   size_t capacity() const;
+        //   bool empty() const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   Allocator *allocator() const;
+        //   bsl::allocator<value_type> get_allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTORS AND BASIC ACCESSORS" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        const Value VALUES[] = { Value(1, 1), Value(2, 2), Value(101, 3) };
+        const int   NUM_VALUES = static_cast<int>(sizeof VALUES
+                                                  / sizeof *VALUES);
+
+        if (verbose) cout << "\nTesting empty maps." << endl;
+        {
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            {
+                const Obj X;
+
+                ASSERT(X.empty());
+                ASSERT(0 == X.size());
+                ASSERT(0 == X.capacity());
+                ASSERT(&defaultAllocator == X.allocator());
+                ASSERT(&defaultAllocator == X.get_allocator().mechanism());
+                ASSERT(0.875f == X.max_load_factor());
+            }
+            {
+                const Obj X(&sa);
+
+                ASSERT(0 == X.capacity());
+                ASSERT(&sa == X.allocator());
+            }
+            ASSERT(dam.isTotalSame());
+            ASSERT(0 == sa.numBlocksTotal());
+
+            {
+                const Obj X(20);
+
+                ASSERT(32 == X.capacity());
+                ASSERT(&defaultAllocator == X.allocator());
+            }
+            {
+                const Obj X(20, &sa);
+
+                ASSERT(32 == X.capacity());
+                ASSERT(&sa == X.allocator());
+            }
+            {
+                const ModObj X(20, ModHash(3), &sa);
+
+                ASSERT(32 == X.capacity());
+                ASSERT(3  == X.hash_function().d_modulus);
+                ASSERT(&sa == X.allocator());
+            }
+            {
+                const ModObj X(20, ModHash(3), ModEqual(6), &sa);
+
+                ASSERT(32 == X.capacity());
+                ASSERT(3  == X.hash_function().d_modulus);
+                ASSERT(6  == X.key_eq().d_modulus);
+                ASSERT(&sa == X.allocator());
+            }
+        }
+
+        if (verbose) cout << "\nTesting range constructors." << endl;
+        {
+            {
+                const Obj X(VALUES, VALUES + NUM_VALUES, &sa);
+
+                ASSERT(3 == X.size());
+                ASSERT(&sa == X.allocator());
+            }
+            {
+                const Obj X(VALUES, VALUES + NUM_VALUES, 100, &sa);
+
+                ASSERT(3   == X.size());
+                ASSERT(128 == X.capacity());
+            }
+            {
+                const ModObj X(VALUES,
+                               VALUES + NUM_VALUES,
+                               0,
+                               ModHash(3),
+                               &sa);
+
+                ASSERT(3 == X.size());
+                ASSERT(3 == X.hash_function().d_modulus);
+            }
+            {
+                const ModObj X(VALUES,
+                               VALUES + NUM_VALUES,
+                               0,
+                               ModHash(10),
+                               ModEqual(100),
+                               &sa);
+
+                ASSERT(2 == X.size());
+                ASSERT(1 == X.at(101));
+            }
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        if (verbose) cout << "\nTesting 'initializer_list' constructors."
+                          << endl;
+        {
+            {
+                const Obj X({ Value(1, 1), Value(2, 2) }, &sa);
+
+                ASSERT(2 == X.size());
+                ASSERT(&sa == X.allocator());
+            }
+            {
+                const Obj X({ Value(1, 1), Value(2, 2) }, 100, &sa);
+
+                ASSERT(2   == X.size());
+                ASSERT(128 == X.capacity());
+            }
+            {
+                const ModObj X({ Value(1, 1) }, 0, ModHash(3), &sa);
+
+                ASSERT(1 == X.size());
+                ASSERT(3 == X.hash_function().d_modulus);
+            }
+            {
+                const ModObj X({ Value(1, 1), Value(101, 2) },
+                               0,
+                               ModHash(10),
+                               ModEqual(100),
+                               &sa);
+
+                ASSERT(1 == X.size());
+                ASSERT(1 == X.at(1));
+            }
+        }
+#endif
+
+        ASSERT(0 == sa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'FlatHashMap_EntryUtil'
+        //
+        // Concerns:
+        //: 1 'constructFromKey' creates a pair having the specified key and a
+        //:   default-constructed value, both using the specified allocator.
+        //:
+        //: 2 'constructFromKey' moves an rvalue key.
+        //:
+        //: 3 'key' returns a reference to the key of the entry.
+        //
+        // Plan:
+        //: 1 Construct entries of 'bsl::string' keys and values in a buffer,
+        //:   and verify their values and allocators.  (C-1..3)
+        //
+        // Testing:
+        //   void constructFromKey(ENTRY *, Allocator *, KEY_TYPE&& key);
+        //   const KEY& key(const ENTRY& entry);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'FlatHashMap_EntryUtil'" << endl
+                          << "=======================" << endl;
+
+        typedef bdlc::FlatHashMap_EntryUtil<bsl::string,
+                                            bsl::string,
+                                            StrValue> Util;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bsls::ObjectBuffer<StrValue> buffer;
+
+        const bsl::string KEY(LONG, &sa);
+
+        Util::constructFromKey(buffer.address(), &sa, KEY);
+
+        ASSERT(KEY == buffer.object().first);
+        ASSERT(""  == buffer.object().second);
+        ASSERT(&sa == buffer.object().first.allocator());
+        ASSERT(&sa == buffer.object().second.allocator());
+        ASSERT(&buffer.object().first == &Util::key(buffer.object()));
+
+        buffer.object().~StrValue();
+
+        bsl::string key(LONG, &sa);
+
+        const char *KEY_DATA = key.data();
+
+        Util::constructFromKey(buffer.address(), &sa, MoveUtil::move(key));
+
+        ASSERT(KEY      == buffer.object().first);
+        ASSERT(KEY_DATA == buffer.object().first.data());
+
+        buffer.object().~StrValue();
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a map, insert, find, and erase elements, and compare
+        //:   copies.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&sa);  const Obj& X = mX;
+
+            ASSERT(X.empty());
+
+            for (int i = 0; i < 1000; ++i) {
+                mX[i] = -i;
+            }
+
+            ASSERT(1000 == X.size());
+
+            for (int i = 0; i < 1000; ++i) {
+                ASSERTV(i, -i == X.at(i));
+            }
+
+            Obj mY(X, &sa);  const Obj& Y = mY;
+
+            ASSERT(X == Y);
+
+            for (int i = 0; i < 1000; i += 2) {
+                ASSERTV(i, 1 == mX.erase(i));
+            }
+
+            ASSERT(500 == X.size());
+            ASSERT(X != Y);
+            ASSERT(!X.contains(0));
+            ASSERT( X.contains(1));
+        }
+
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
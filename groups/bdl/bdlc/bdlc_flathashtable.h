@@ -0,0 +1,1581 @@
+// bdlc_flathashtable.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHTABLE
+#define INCLUDED_BDLC_FLATHASHTABLE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed hash table like Abseil 'flat_hash_map'.
+//
+//@CLASSES:
+//  bdlc::FlatHashTable: open-addressed hash table like Abseil 'flat_hash_map'
+//  bdlc::FlatHashTable_IteratorImp: iterator implementation for the table
+//  bdlc::FlatHashTable_ImplUtil: utilities shared by all table instantiations
+//
+//@SEE_ALSO: bdlc_flathashmap, bdlc_flathashset
+//
+//@DESCRIPTION: This component provides the class template
+// 'bdlc::FlatHashTable', the implementation of 'bdlc::FlatHashMap' and
+// 'bdlc::FlatHashSet'.  A flat hash table is an open-addressed ("closed
+// hashing") hash table, in the style of the Abseil "Swiss table", that stores
+// its entries in a single contiguous array of slots rather than in separately
+// allocated nodes.  Consequently, insertion does not allocate (except when the
+// table grows), and a lookup typically touches one cache line of control
+// values and one entry, rather than chasing a bucket pointer and a chain of
+// nodes.
+//
+// The slots of the table are partitioned into groups of 16 (see
+// 'bdlc_flathashtable_groupcontrol').  Each slot has a one-byte control value
+// that is either "empty", "erased", or holds 7 bits of the hash value of the
+// key of the entry in the slot (the "fingerprint").  The remaining bits of the
+// hash value select the group at which the search for a key begins.  To find
+// a key, the control values of a group are compared to the fingerprint of the
+// key in parallel (using SSE2 where available), the entries whose control
+// value matches are compared to the key, and, if the key is not found and the
+// group has no empty slot, the search continues with the next group in a
+// triangular probe sequence.  Since a 7-bit fingerprint has a false-positive
+// rate of 1/128, the key comparison is almost always invoked only for the
+// entry that is sought.
+//
+// The hash value supplied by the 'HASH' functor is mixed by the table before
+// use, so hashers of poor quality (e.g., the identity function for integral
+// types, as provided by 'bsl::hash') are tolerated.
+//
+///Capacity and Load Factor
+///------------------------
+// The capacity of a flat hash table, i.e., the number of slots, is either 0 or
+// a power of 2 that is at least 16.  The table grows (doubling its capacity)
+// when an insertion into an empty slot would cause the number of entries plus
+// the number of erased slots to exceed 7/8 of the capacity; if enough of the
+// slots are merely erased, the table is instead rehashed at its current
+// capacity.  Rehashing moves the entries into new storage, using bit-wise
+// moves for types that are bitwise moveable, and invalidates all iterators
+// and references to entries.  Insertions that do not cause a rehash, and
+// erasures, invalidate only the iterators and references to the erased
+// entries.
+//
+///Requirements on the Template Parameters
+///---------------------------------------
+// 'ENTRY_UTIL' must provide the following static member functions:
+//..
+//  static const KEY& key(const ENTRY& entry);
+//      // Return a 'const' reference to the key of the specified 'entry'.
+//
+//  template <class KEY_TYPE>
+//  static void constructFromKey(
+//                         ENTRY                                       *entry,
+//                         bslma::Allocator                            *alloc,
+//                         BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key);
+//      // Create, at the specified 'entry' location, an entry having the
+//      // specified 'key' (and a default-constructed value, if any), using
+//      // the specified 'alloc' to supply memory.
+//..
+// 'HASH' must be a copy-constructible functor returning a 'bsl::size_t' hash
+// value for a 'KEY' (e.g., 'bslh::Hash<>' or 'bsl::hash<KEY>'), and 'EQUAL'
+// must be a copy-constructible functor returning 'true' if two 'KEY' objects
+// are equal.
+//
+///Usage
+///-----
+// There is no usage example for this component since it is not meant for
+// direct client use.
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flathashtable_groupcontrol.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslalg_swaputil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bslstl_forwarditerator.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                      // ===============================
+                      // class FlatHashTable_IteratorImp
+                      // ===============================
+
+template <class ENTRY>
+class FlatHashTable_IteratorImp {
+    // This class implements the methods required by 'bslstl::ForwardIterator'
+    // to provide an iterator over the entries of a flat hash table.  An
+    // iterator refers to a slot (an entry and its control value) and the
+    // number of slots following it; the past-the-end iterator is the
+    // default-constructed value.
+
+    // DATA
+    ENTRY              *d_entries_p;        // current entry
+    const bsl::uint8_t *d_controls_p;       // control value of current entry
+    bsl::size_t         d_additionalLength; // number of slots after current
+
+    // FRIENDS
+    template <class OTHER_ENTRY>
+    friend bool operator==(const FlatHashTable_IteratorImp<OTHER_ENTRY>&,
+                           const FlatHashTable_IteratorImp<OTHER_ENTRY>&);
+
+  public:
+    // CREATORS
+    FlatHashTable_IteratorImp();
+        // Create a past-the-end iterator.
+
+    FlatHashTable_IteratorImp(ENTRY              *entries,
+                              const bsl::uint8_t *controls,
+                              bsl::size_t         additionalLength);
+        // Create an iterator referring to the slot having the specified
+        // 'entries' and 'controls' addresses, followed by the specified
+        // 'additionalLength' slots.  The behavior is undefined unless the
+        // slot is in use.
+
+    //! FlatHashTable_IteratorImp(
+    //!                  const FlatHashTable_IteratorImp& original) = default;
+        // Create an iterator having the value of the specified 'original'.
+
+    //! ~FlatHashTable_IteratorImp() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! FlatHashTable_IteratorImp& operator=(
+    //!                       const FlatHashTable_IteratorImp& rhs) = default;
+        // Assign to this iterator the value of the specified 'rhs', and return
+        // a reference providing modifiable access to this iterator.
+
+    void operator++();
+        // Advance this iterator to the next slot in use, or to the
+        // past-the-end value if there is none.  The behavior is undefined
+        // unless this iterator refers to a slot.
+
+    // ACCESSORS
+    ENTRY& operator*() const;
+        // Return a reference to the entry referred to by this iterator.  The
+        // behavior is undefined unless this iterator refers to a slot.
+};
+
+// FREE OPERATORS
+template <class ENTRY>
+bool operator==(const FlatHashTable_IteratorImp<ENTRY>& lhs,
+                const FlatHashTable_IteratorImp<ENTRY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators refer to the
+    // same slot, or are both past-the-end, and 'false' otherwise.
+
+                        // =============================
+                        // struct FlatHashTable_ImplUtil
+                        // =============================
+
+struct FlatHashTable_ImplUtil {
+    // This 'struct' provides a namespace for the non-template utilities used
+    // by 'FlatHashTable'.
+
+    // CLASS METHODS
+    static bsl::size_t capacityForEntries(bsl::size_t numEntries);
+        // Return the least capacity (0, or a power of 2 that is at least 16)
+        // whose maximum load accommodates the specified 'numEntries'.
+
+    static bsl::size_t maxLoad(bsl::size_t capacity);
+        // Return the maximum number of slots, in use or erased, of a table
+        // having the specified 'capacity'.
+
+    static bsl::size_t mixHash(bsl::size_t hashValue);
+        // Return the result of mixing the bits of the specified 'hashValue',
+        // such that every bit of the result depends on every bit of
+        // 'hashValue'.
+
+    static bsl::size_t roundUpCapacity(bsl::size_t minimumCapacity);
+        // Return the least power of 2 that is at least the specified
+        // 'minimumCapacity' and at least 'FlatHashTable_GroupControl::k_SIZE'.
+        // The behavior is undefined unless '0 < minimumCapacity'.
+};
+
+                           // ===================
+                           // class FlatHashTable
+                           // ===================
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+class FlatHashTable {
+    // This class template implements an open-addressed, value-semantic hash
+    // table of unique 'KEY's, storing 'ENTRY' objects in a contiguous array of
+    // slots and the key of each 'ENTRY' as given by 'ENTRY_UTIL::key'.  See
+    // {Requirements on the Template Parameters}.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable_GroupControl        GroupControl;
+    typedef FlatHashTable_ImplUtil            ImplUtil;
+    typedef bslmf::MovableRefUtil             MoveUtil;
+
+    // DATA
+    ENTRY            *d_entries_p;    // array of 'd_capacity' slots (owned)
+
+    bsl::uint8_t     *d_controls_p;   // array of 'd_capacity' control values
+                                      // (owned)
+
+    bsl::size_t       d_size;         // number of entries
+
+    bsl::size_t       d_numErased;    // number of erased slots
+
+    bsl::size_t       d_capacity;     // number of slots
+
+    HASH              d_hasher;       // hash functor
+
+    EQUAL             d_equal;        // key-equality functor
+
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+    // PRIVATE CLASS METHODS
+    static bsl::uint8_t fingerprint(bsl::size_t hashValue);
+        // Return the control value for a key having the specified (mixed)
+        // 'hashValue'.
+
+    // PRIVATE MANIPULATORS
+    void allocateArrays(bsl::size_t capacity);
+        // Set the capacity of this table to the specified 'capacity', with
+        // all slots empty, allocating new arrays of slots and control values
+        // (if 'capacity' is not 0) without releasing the current arrays.  If
+        // an exception is thrown, this table is unchanged.  The behavior is
+        // undefined unless 'capacity' is 0 or a power of 2 that is at least
+        // 'GroupControl::k_SIZE'.
+
+    void destroyEntriesAndDeallocate();
+        // Destroy the entries of this table and release its arrays, without
+        // otherwise changing the state of this table.
+
+    bsl::size_t findAvailable(bsl::size_t hashValue) const;
+        // Return the index of the first available (empty or erased) slot in
+        // the probe sequence for the specified (mixed) 'hashValue'.  The
+        // behavior is undefined unless this table has an empty slot.
+
+    bsl::size_t indexOfKey(bool        *notFound,
+                           bsl::size_t *hashValue,
+                           const KEY&   key);
+        // Return the index of the slot holding the specified 'key', loading
+        // 'false' into the specified 'notFound', if 'key' is in this table;
+        // otherwise, return the index of the slot into which 'key' should be
+        // inserted, loading 'true' into 'notFound' and growing this table if
+        // necessary.  Load the mixed hash value of 'key' into the specified
+        // 'hashValue'.
+
+    void moveEntriesInto(bsl::size_t capacity);
+        // Move the entries of this table into newly allocated arrays having
+        // the specified 'capacity', and release the current arrays.  The
+        // behavior is undefined unless 'capacity' accommodates 'size()'
+        // entries.
+
+    void occupySlot(bsl::size_t index, bsl::size_t hashValue);
+        // Mark the available slot at the specified 'index' as holding an
+        // entry whose key has the specified (mixed) 'hashValue'.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t findKey(const KEY& key, bsl::size_t hashValue) const;
+        // Return the index of the slot holding the specified 'key' having the
+        // specified (mixed) 'hashValue', or 'd_capacity' if 'key' is not in
+        // this table.
+
+    bsl::size_t hashOf(const KEY& key) const;
+        // Return the mixed hash value of the specified 'key'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashTable, bslma::UsesBslmaAllocator);
+
+    // PUBLIC TYPES
+    typedef ENTRY                                               entry_type;
+
+    typedef bslstl::ForwardIterator<ENTRY,
+                                    FlatHashTable_IteratorImp<ENTRY> >
+                                                                iterator;
+
+    typedef bslstl::ForwardIterator<const ENTRY,
+                                    FlatHashTable_IteratorImp<ENTRY> >
+                                                                const_iterator;
+
+    // PUBLIC CONSTANTS
+    static const bsl::size_t k_MIN_CAPACITY = 16;  // least non-zero capacity
+
+    // CREATORS
+    FlatHashTable(bsl::size_t       capacity,
+                  const HASH&       hash,
+                  const EQUAL&      equal,
+                  bslma::Allocator *basicAllocator = 0);
+        // Create an empty table having at least the specified 'capacity',
+        // that will use the specified 'hash' to generate hash values for the
+        // keys of the entries, and the specified 'equal' to verify that two
+        // keys are equal.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  If 'capacity' is 0, no memory is
+        // allocated.
+
+    FlatHashTable(const FlatHashTable&  original,
+                  bslma::Allocator     *basicAllocator = 0);
+        // Create a table having the same value, hasher, key-equality functor,
+        // and capacity as the specified 'original' table.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    FlatHashTable(bslmf::MovableRef<FlatHashTable> original);
+        // Create a table having the same value, hasher, key-equality functor,
+        // capacity, and allocator as the specified 'original' table, by
+        // moving its contents; 'original' is left empty, with capacity 0.
+
+    FlatHashTable(bslmf::MovableRef<FlatHashTable>  original,
+                  bslma::Allocator                 *basicAllocator);
+        // Create a table having the same value, hasher, key-equality functor,
+        // and capacity as the specified 'original' table, using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  The contents of
+        // 'original' are moved to the new table if 'basicAllocator' is the
+        // allocator of 'original' (in which case 'original' is left empty),
+        // and the entries are moved individually otherwise (in which case
+        // 'original' is left in a valid but unspecified state).
+
+    ~FlatHashTable();
+        // Destroy this table.
+
+    // MANIPULATORS
+    FlatHashTable& operator=(const FlatHashTable& rhs);
+        // Assign to this table the value, hasher, and key-equality functor of
+        // the specified 'rhs' table, and return a reference providing
+        // modifiable access to this table.
+
+    FlatHashTable& operator=(bslmf::MovableRef<FlatHashTable> rhs);
+        // Assign to this table the value, hasher, and key-equality functor of
+        // the specified 'rhs' table, and return a reference providing
+        // modifiable access to this table.  The contents of 'rhs' are moved
+        // to this table if the two tables have the same allocator, and the
+        // entries are moved individually otherwise.  'rhs' is left in a valid
+        // but unspecified state.
+
+    void clear();
+        // Remove all entries from this table.  Note that the capacity is not
+        // changed.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return a pair of iterators defining the sequence of entries in this
+        // table having the specified 'key', which is empty if there is none.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this table the entry having the specified 'key', if it
+        // exists, and return the number of entries removed (0 or 1).
+
+    iterator erase(const_iterator position);
+        // Remove from this table the entry at the specified 'position', and
+        // return an iterator referring to the entry following it (or the
+        // past-the-end iterator).  The behavior is undefined unless
+        // 'position' refers to an entry in this table.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this table the entries in the specified range
+        // '[first, last)', and return an iterator referring to 'last'.  The
+        // behavior is undefined unless '[first, last)' is a valid range of
+        // entries in this table.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the entry in this table having the
+        // specified 'key', or the past-the-end iterator if there is none.
+
+    bsl::pair<iterator, bool> insert(const ENTRY& entry);
+    bsl::pair<iterator, bool> insert(bslmf::MovableRef<ENTRY> entry);
+        // Insert into this table a copy of (or, for the second overload, the
+        // value moved from) the specified 'entry' if its key is not already
+        // in this table.  Return a pair whose first member is an iterator
+        // referring to the (possibly newly inserted) entry having the key of
+        // 'entry', and whose second member is 'true' if 'entry' was inserted
+        // and 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this table the entries in the specified range
+        // '[first, last)' whose keys are not already in this table (or in an
+        // earlier entry of the range).
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this table to the least capacity that is at
+        // least the specified 'minimumCapacity' and that accommodates the
+        // entries of this table, moving the entries and removing any erased
+        // slots.  Note that the capacity may decrease.
+
+    void reserve(bsl::size_t numEntries);
+        // Change the capacity of this table, if necessary, such that at least
+        // the specified 'numEntries' can be inserted without rehashing.
+
+    void reset();
+        // Remove all entries from this table and release its memory, leaving
+        // it with capacity 0.
+
+    template <class KEY_TYPE>
+    bsl::pair<iterator, bool> tryEmplace(
+                               BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key)
+    {
+        // Insert into this table an entry created by
+        // 'ENTRY_UTIL::constructFromKey' from the specified 'key' if 'key' is
+        // not already in this table.  Return a pair whose first member is an
+        // iterator referring to the (possibly newly inserted) entry having
+        // 'key', and whose second member is 'true' if an entry was inserted
+        // and 'false' otherwise.  Note that this method is defined inline to
+        // work around compiler issues with out-of-line definitions of
+        // templates having forwarding references.
+
+        bool              notFound;
+        bsl::size_t       hashValue;
+        const KEY&        k     = key;
+        const bsl::size_t index = indexOfKey(&notFound, &hashValue, k);
+
+        if (notFound) {
+            ENTRY_UTIL::constructFromKey(
+                                  d_entries_p + index,
+                                 d_allocator_p,
+                                 BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key));
+            occupySlot(index, hashValue);
+        }
+
+        return bsl::pair<iterator, bool>(
+                   iterator(FlatHashTable_IteratorImp<ENTRY>(
+                                               d_entries_p + index,
+                                               d_controls_p + index,
+                                               d_capacity - index - 1)),
+                   notFound);
+    }
+
+    iterator begin();
+        // Return an iterator referring to the first entry in this table, or
+        // the past-the-end iterator if this table is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this table.
+
+                                  // Aspects
+
+    void swap(FlatHashTable& other);
+        // Exchange the value, hasher, key-equality functor, and capacity of
+        // this table with those of the specified 'other' table.  This method
+        // provides the no-throw exception-safety guarantee if the hasher and
+        // key-equality functor swaps do not throw.  The behavior is undefined
+        // unless this table and 'other' have the same allocator.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the number of slots of this table.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this table contains an entry having the specified
+        // 'key', and 'false' otherwise.
+
+    const bsl::uint8_t *controls() const;
+        // Return the address of the array of control values of this table.
+        // Note that this method is provided for white-box testing.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of entries in this table having the specified
+        // 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this table has no entries, and 'false' otherwise.
+
+    const ENTRY *entries() const;
+        // Return the address of the array of slots of this table.  Note that
+        // this method is provided for white-box testing.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(const KEY& key)
+                                                                        const;
+        // Return a pair of iterators defining the sequence of entries in this
+        // table having the specified 'key', which is empty if there is none.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the entry in this table having the
+        // specified 'key', or the past-the-end iterator if there is none.
+
+    const HASH& hash_function() const;
+        // Return a reference to the hash functor of this table.
+
+    const EQUAL& key_eq() const;
+        // Return a reference to the key-equality functor of this table.
+
+    float load_factor() const;
+        // Return the ratio of the number of entries to the capacity of this
+        // table, or 0 if the capacity is 0.
+
+    float max_load_factor() const;
+        // Return the maximum ratio, in use or erased, of slots to capacity
+        // before this table grows (i.e., 0.875).
+
+    bsl::size_t size() const;
+        // Return the number of entries in this table.
+
+    const_iterator begin() const;
+        // Return an iterator referring to the first entry in this table, or
+        // the past-the-end iterator if this table is empty.
+
+    const_iterator end() const;
+        // Return the past-the-end iterator of this table.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this table to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator==(const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+                const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables have the same
+    // value, and 'false' otherwise.  Two tables have the same value if they
+    // have the same number of entries, and, for each entry of 'lhs', 'rhs'
+    // has an entry having the same key that compares equal to it.  Note that
+    // the capacities, hashers, and key-equality functors are not compared.
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator!=(const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+                const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
+          FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' tables.  If the tables
+    // have different allocators, the exchange is made by copying.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                      // -------------------------------
+                      // class FlatHashTable_IteratorImp
+                      // -------------------------------
+
+// CREATORS
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp()
+: d_entries_p(0)
+, d_controls_p(0)
+, d_additionalLength(0)
+{
+}
+
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp(
+                                         ENTRY              *entries,
+                                         const bsl::uint8_t *controls,
+                                         bsl::size_t         additionalLength)
+: d_entries_p(entries)
+, d_controls_p(controls)
+, d_additionalLength(additionalLength)
+{
+    BSLS_ASSERT_SAFE(entries);
+    BSLS_ASSERT_SAFE(controls);
+    BSLS_ASSERT_SAFE(0 == (*controls & 0x80));
+}
+
+// MANIPULATORS
+template <class ENTRY>
+inline
+void FlatHashTable_IteratorImp<ENTRY>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_entries_p);
+
+    while (d_additionalLength) {
+        ++d_entries_p;
+        ++d_controls_p;
+        --d_additionalLength;
+
+        if (0 == (*d_controls_p & 0x80)) {
+            return;                                                   // RETURN
+        }
+    }
+
+    d_entries_p  = 0;
+    d_controls_p = 0;
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+ENTRY& FlatHashTable_IteratorImp<ENTRY>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_entries_p);
+
+    return *d_entries_p;
+}
+
+// FREE OPERATORS
+template <class ENTRY>
+inline
+bool operator==(const FlatHashTable_IteratorImp<ENTRY>& lhs,
+                const FlatHashTable_IteratorImp<ENTRY>& rhs)
+{
+    return lhs.d_entries_p == rhs.d_entries_p;
+}
+
+                        // -----------------------------
+                        // struct FlatHashTable_ImplUtil
+                        // -----------------------------
+
+// CLASS METHODS
+inline
+bsl::size_t FlatHashTable_ImplUtil::maxLoad(bsl::size_t capacity)
+{
+    return capacity - capacity / 8;
+}
+
+inline
+bsl::size_t FlatHashTable_ImplUtil::mixHash(bsl::size_t hashValue)
+{
+    // Apply the finalizer of MurmurHash3, which is a bijection in which every
+    // output bit depends on every input bit.
+
+#if defined(BSLS_PLATFORM_CPU_64_BIT)
+    bsls::Types::Uint64 h = hashValue;
+
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+
+    return static_cast<bsl::size_t>(h);
+#else
+    bsl::uint32_t h = static_cast<bsl::uint32_t>(hashValue);
+
+    h ^= h >> 16;
+    h *= 0x85ebca6bU;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35U;
+    h ^= h >> 16;
+
+    return h;
+#endif
+}
+
+                           // -------------------
+                           // class FlatHashTable
+                           // -------------------
+
+// PUBLIC CONSTANTS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+const bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::k_MIN_CAPACITY;
+
+// PRIVATE CLASS METHODS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::uint8_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::fingerprint(
+                                                         bsl::size_t hashValue)
+{
+    return static_cast<bsl::uint8_t>(hashValue & 0x7f);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocateArrays(
+                                                          bsl::size_t capacity)
+{
+    BSLS_ASSERT_SAFE(0 == capacity
+                  || (k_MIN_CAPACITY <= capacity
+                   && 0 == (capacity & (capacity - 1))));
+
+    if (0 == capacity) {
+        d_entries_p  = 0;
+        d_controls_p = 0;
+    }
+    else {
+        // Assign the members only after both allocations succeed, so that
+        // this table is unchanged if an allocation throws.
+
+        ENTRY *entries = static_cast<ENTRY *>(
+                            d_allocator_p->allocate(sizeof(ENTRY) * capacity));
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(entries,
+                                                            d_allocator_p);
+
+        d_controls_p = static_cast<bsl::uint8_t *>(
+                                            d_allocator_p->allocate(capacity));
+        d_entries_p  = entries;
+        proctor.release();
+
+        bsl::memset(d_controls_p, GroupControl::k_EMPTY, capacity);
+    }
+
+    d_capacity  = capacity;
+    d_numErased = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                                  destroyEntriesAndDeallocate()
+{
+    if (d_entries_p) {
+        for (bsl::size_t i = 0; d_size && i < d_capacity; ++i) {
+            if (0 == (d_controls_p[i] & 0x80)) {
+                bslma::DestructionUtil::destroy(d_entries_p + i);
+            }
+        }
+
+        d_allocator_p->deallocate(d_controls_p);
+        d_allocator_p->deallocate(d_entries_p);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::indexOfKey(
+                                                      bool        *notFound,
+                                                      bsl::size_t *hashValue,
+                                                      const KEY&   key)
+{
+    BSLS_ASSERT_SAFE(notFound);
+    BSLS_ASSERT_SAFE(hashValue);
+
+    *hashValue = hashOf(key);
+
+    bsl::size_t index = findKey(key, *hashValue);
+
+    if (index != d_capacity) {
+        *notFound = false;
+        return index;                                                 // RETURN
+    }
+
+    if (0 != d_capacity) {
+        index = findAvailable(*hashValue);
+
+        if (GroupControl::k_ERASED == d_controls_p[index]
+         || d_size + d_numErased < ImplUtil::maxLoad(d_capacity)) {
+            *notFound = true;
+            return index;                                             // RETURN
+        }
+    }
+
+    // Taking an empty slot would exceed the maximum load: grow this table,
+    // unless the erased slots account for at least half of the maximum load,
+    // in which case rehashing at the current capacity suffices.
+
+    moveEntriesInto(0 == d_capacity
+                    ? k_MIN_CAPACITY
+                    : d_size < ImplUtil::maxLoad(d_capacity) / 2
+                      ? d_capacity
+                      : d_capacity * 2);
+
+    *notFound = true;
+    return findAvailable(*hashValue);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::moveEntriesInto(
+                                                          bsl::size_t capacity)
+{
+    BSLS_ASSERT_SAFE(d_size <= ImplUtil::maxLoad(capacity));
+
+    ENTRY        *entries     = d_entries_p;
+    bsl::uint8_t *controls    = d_controls_p;
+    bsl::size_t   oldCapacity = d_capacity;
+
+    allocateArrays(capacity);
+
+    for (bsl::size_t i = 0; i < oldCapacity; ++i) {
+        if (0 == (controls[i] & 0x80)) {
+            const bsl::size_t hashValue =
+                                          hashOf(ENTRY_UTIL::key(entries[i]));
+            const bsl::size_t index     = findAvailable(hashValue);
+
+            bslma::ConstructionUtil::destructiveMove(d_entries_p + index,
+                                                     d_allocator_p,
+                                                     entries + i);
+            d_controls_p[index] = fingerprint(hashValue);
+        }
+    }
+
+    if (entries) {
+        d_allocator_p->deallocate(controls);
+        d_allocator_p->deallocate(entries);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::occupySlot(
+                                                     bsl::size_t index,
+                                                     bsl::size_t hashValue)
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+    BSLS_ASSERT_SAFE(0 != (d_controls_p[index] & 0x80));
+
+    if (GroupControl::k_ERASED == d_controls_p[index]) {
+        --d_numErased;
+    }
+    d_controls_p[index] = fingerprint(hashValue);
+    ++d_size;
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findAvailable(
+                                                   bsl::size_t hashValue) const
+{
+    BSLS_ASSERT_SAFE(0 != d_capacity);
+
+    const bsl::size_t mask  = d_capacity / GroupControl::k_SIZE - 1;
+    bsl::size_t       group = (hashValue >> 7) & mask;
+
+    for (bsl::size_t step = 1; ; ++step) {
+        const bsl::size_t   offset = group * GroupControl::k_SIZE;
+        const bsl::uint32_t available =
+                         GroupControl(d_controls_p + offset).available();
+
+        if (available) {
+            return offset + bdlb::BitUtil::numTrailingUnsetBits(available);
+                                                                      // RETURN
+        }
+
+        group = (group + step) & mask;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKey(
+                                                 const KEY&  key,
+                                                 bsl::size_t hashValue) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == d_capacity)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::uint8_t fp    = fingerprint(hashValue);
+    const bsl::size_t  mask  = d_capacity / GroupControl::k_SIZE - 1;
+    bsl::size_t        group = (hashValue >> 7) & mask;
+
+    // The triangular probe sequence visits every group, and the maximum load
+    // guarantees that some group has an empty slot, so the loop terminates.
+
+    for (bsl::size_t step = 1; ; ++step) {
+        const bsl::size_t  offset = group * GroupControl::k_SIZE;
+        const GroupControl control(d_controls_p + offset);
+
+        for (bsl::uint32_t candidates = control.match(fp);
+             candidates;
+             candidates &= candidates - 1) {
+            const bsl::size_t index =
+                 offset + bdlb::BitUtil::numTrailingUnsetBits(candidates);
+
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                          d_equal(key, ENTRY_UTIL::key(d_entries_p[index])))) {
+                return index;                                         // RETURN
+            }
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(control.neverFull())) {
+            return d_capacity;                                        // RETURN
+        }
+
+        group = (group + step) & mask;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hashOf(
+                                                          const KEY& key) const
+{
+    return ImplUtil::mixHash(d_hasher(key));
+}
+
+// CREATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                            bsl::size_t       capacity,
+                                            const HASH&       hash,
+                                            const EQUAL&      equal,
+                                            bslma::Allocator *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_hasher(hash)
+, d_equal(equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (capacity) {
+        allocateArrays(ImplUtil::roundUpCapacity(capacity));
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                          const FlatHashTable&  original,
+                                          bslma::Allocator     *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_hasher(original.d_hasher)
+, d_equal(original.d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    allocateArrays(original.d_capacity);
+
+    // Copy the layout of 'original', so that no key need be hashed.  Should
+    // a copy throw, the destructor of the proctor destroys the entries copied
+    // so far.
+
+    struct Proctor {
+        FlatHashTable *d_table_p;
+
+        ~Proctor()
+        {
+            if (d_table_p) {
+                d_table_p->destroyEntriesAndDeallocate();
+            }
+        }
+    } proctor = { this };
+
+    for (bsl::size_t i = 0; i < d_capacity; ++i) {
+        if (0 == (original.d_controls_p[i] & 0x80)) {
+            bslma::ConstructionUtil::construct(d_entries_p + i,
+                                               d_allocator_p,
+                                               original.d_entries_p[i]);
+            d_controls_p[i] = original.d_controls_p[i];
+            ++d_size;
+        }
+    }
+
+    proctor.d_table_p = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                     bslmf::MovableRef<FlatHashTable> original)
+: d_entries_p(MoveUtil::access(original).d_entries_p)
+, d_controls_p(MoveUtil::access(original).d_controls_p)
+, d_size(MoveUtil::access(original).d_size)
+, d_numErased(MoveUtil::access(original).d_numErased)
+, d_capacity(MoveUtil::access(original).d_capacity)
+, d_hasher(MoveUtil::access(original).d_hasher)
+, d_equal(MoveUtil::access(original).d_equal)
+, d_allocator_p(MoveUtil::access(original).d_allocator_p)
+{
+    FlatHashTable& lvalue = original;
+
+    lvalue.d_entries_p  = 0;
+    lvalue.d_controls_p = 0;
+    lvalue.d_size       = 0;
+    lvalue.d_numErased  = 0;
+    lvalue.d_capacity   = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                             bslmf::MovableRef<FlatHashTable>  original,
+                             bslma::Allocator                 *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_hasher(MoveUtil::access(original).d_hasher)
+, d_equal(MoveUtil::access(original).d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    FlatHashTable& lvalue = original;
+
+    if (d_allocator_p == lvalue.d_allocator_p) {
+        bslalg::SwapUtil::swap(&d_entries_p,  &lvalue.d_entries_p);
+        bslalg::SwapUtil::swap(&d_controls_p, &lvalue.d_controls_p);
+        bslalg::SwapUtil::swap(&d_size,       &lvalue.d_size);
+        bslalg::SwapUtil::swap(&d_numErased,  &lvalue.d_numErased);
+        bslalg::SwapUtil::swap(&d_capacity,   &lvalue.d_capacity);
+        return;                                                       // RETURN
+    }
+
+    allocateArrays(lvalue.d_capacity);
+
+    struct Proctor {
+        FlatHashTable *d_table_p;
+
+        ~Proctor()
+        {
+            if (d_table_p) {
+                d_table_p->destroyEntriesAndDeallocate();
+            }
+        }
+    } proctor = { this };
+
+    for (bsl::size_t i = 0; i < d_capacity; ++i) {
+        if (0 == (lvalue.d_controls_p[i] & 0x80)) {
+            bslma::ConstructionUtil::construct(
+                                       d_entries_p + i,
+                                       d_allocator_p,
+                                       MoveUtil::move(lvalue.d_entries_p[i]));
+            d_controls_p[i] = lvalue.d_controls_p[i];
+            ++d_size;
+        }
+    }
+
+    proctor.d_table_p = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::~FlatHashTable()
+{
+    destroyEntriesAndDeallocate();
+}
+
+// MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                                      const FlatHashTable& rhs)
+{
+    if (this != &rhs) {
+        FlatHashTable other(rhs, d_allocator_p);
+
+        swap(other);
+    }
+
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                          bslmf::MovableRef<FlatHashTable> rhs)
+{
+    FlatHashTable& lvalue = rhs;
+
+    if (this != &lvalue) {
+        FlatHashTable other(MoveUtil::move(lvalue), d_allocator_p);
+
+        swap(other);
+    }
+
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::clear()
+{
+    if (d_size) {
+        for (bsl::size_t i = 0; i < d_capacity; ++i) {
+            if (0 == (d_controls_p[i] & 0x80)) {
+                bslma::DestructionUtil::destroy(d_entries_p + i);
+            }
+        }
+    }
+
+    if (d_controls_p) {
+        bsl::memset(d_controls_p, GroupControl::k_EMPTY, d_capacity);
+    }
+
+    d_size      = 0;
+    d_numErased = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::pair<
+        typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+        typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::equal_range(const KEY& key)
+{
+    iterator first = find(key);
+    iterator last  = first;
+
+    if (last != end()) {
+        ++last;
+    }
+
+    return bsl::pair<iterator, iterator>(first, last);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                                const KEY& key)
+{
+    const bsl::size_t index = findKey(key, hashOf(key));
+
+    if (index == d_capacity) {
+        return 0;                                                     // RETURN
+    }
+
+    erase(const_iterator(FlatHashTable_IteratorImp<ENTRY>(
+                                                      d_entries_p + index,
+                                                      d_controls_p + index,
+                                                      0)));
+    return 1;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    const bsl::size_t index = &*position - d_entries_p;
+
+    BSLS_ASSERT_SAFE(index < d_capacity);
+    BSLS_ASSERT_SAFE(0 == (d_controls_p[index] & 0x80));
+
+    bslma::DestructionUtil::destroy(d_entries_p + index);
+    --d_size;
+
+    // A search passing through the group of this slot stops there if the
+    // group has an empty slot, so the slot may be marked empty in that case;
+    // otherwise, it must be marked erased so that searches continue past it.
+
+    const bsl::size_t offset = index & ~(GroupControl::k_SIZE - 1);
+
+    if (GroupControl(d_controls_p + offset).neverFull()) {
+        d_controls_p[index] = GroupControl::k_EMPTY;
+    }
+    else {
+        d_controls_p[index] = GroupControl::k_ERASED;
+        ++d_numErased;
+    }
+
+    // Find the next slot in use.
+
+    for (bsl::size_t i = index + 1; i < d_capacity; ++i) {
+        if (0 == (d_controls_p[i] & 0x80)) {
+            return iterator(FlatHashTable_IteratorImp<ENTRY>(
+                                                      d_entries_p + i,
+                                                      d_controls_p + i,
+                                                      d_capacity - i - 1));
+                                                                      // RETURN
+        }
+    }
+
+    return end();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(const_iterator first,
+                                                          const_iterator last)
+{
+    // Erasing an entry does not move any other entry, so 'last' remains
+    // valid.
+
+    while (first != last) {
+        first = erase(first);
+    }
+
+    return iterator(last.imp());
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key)
+{
+    const bsl::size_t index = findKey(key, hashOf(key));
+
+    if (index == d_capacity) {
+        return end();                                                 // RETURN
+    }
+
+    return iterator(FlatHashTable_IteratorImp<ENTRY>(d_entries_p + index,
+                                                     d_controls_p + index,
+                                                     d_capacity - index - 1));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+        typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+        bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(const ENTRY& entry)
+{
+    bool              notFound;
+    bsl::size_t       hashValue;
+    const bsl::size_t index = indexOfKey(&notFound,
+                                         &hashValue,
+                                         ENTRY_UTIL::key(entry));
+
+    if (notFound) {
+        bslma::ConstructionUtil::construct(d_entries_p + index,
+                                           d_allocator_p,
+                                           entry);
+        occupySlot(index, hashValue);
+    }
+
+    return bsl::pair<iterator, bool>(
+                   iterator(FlatHashTable_IteratorImp<ENTRY>(
+                                                      d_entries_p + index,
+                                                      d_controls_p + index,
+                                                      d_capacity - index - 1)),
+                   notFound);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+        typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+        bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(
+                                               bslmf::MovableRef<ENTRY> entry)
+{
+    ENTRY&            lvalue = entry;
+    bool              notFound;
+    bsl::size_t       hashValue;
+    const bsl::size_t index  = indexOfKey(&notFound,
+                                          &hashValue,
+                                          ENTRY_UTIL::key(lvalue));
+
+    if (notFound) {
+        bslma::ConstructionUtil::construct(d_entries_p + index,
+                                           d_allocator_p,
+                                           MoveUtil::move(lvalue));
+        occupySlot(index, hashValue);
+    }
+
+    return bsl::pair<iterator, bool>(
+                   iterator(FlatHashTable_IteratorImp<ENTRY>(
+                                                      d_entries_p + index,
+                                                      d_controls_p + index,
+                                                      d_capacity - index - 1)),
+                   notFound);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        insert(*first);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehash(
+                                                   bsl::size_t minimumCapacity)
+{
+    bsl::size_t capacity = ImplUtil::capacityForEntries(d_size);
+
+    if (capacity < minimumCapacity) {
+        capacity = ImplUtil::roundUpCapacity(minimumCapacity);
+    }
+
+    if (capacity != d_capacity || d_numErased) {
+        moveEntriesInto(capacity);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reserve(
+                                                        bsl::size_t numEntries)
+{
+    const bsl::size_t capacity = ImplUtil::capacityForEntries(numEntries);
+
+    if (capacity > d_capacity) {
+        moveEntriesInto(capacity);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reset()
+{
+    destroyEntriesAndDeallocate();
+
+    d_entries_p  = 0;
+    d_controls_p = 0;
+    d_size       = 0;
+    d_numErased  = 0;
+    d_capacity   = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin()
+{
+    for (bsl::size_t i = 0; d_size && i < d_capacity; ++i) {
+        if (0 == (d_controls_p[i] & 0x80)) {
+            return iterator(FlatHashTable_IteratorImp<ENTRY>(
+                                                      d_entries_p + i,
+                                                      d_controls_p + i,
+                                                      d_capacity - i - 1));
+                                                                      // RETURN
+        }
+    }
+
+    return end();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end()
+{
+    return iterator();
+}
+
+                                  // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swap(
+                                                          FlatHashTable& other)
+{
+    BSLS_ASSERT(d_allocator_p == other.d_allocator_p);
+
+    bslalg::SwapUtil::swap(&d_hasher,     &other.d_hasher);
+    bslalg::SwapUtil::swap(&d_equal,      &other.d_equal);
+
+    bslalg::SwapUtil::swap(&d_entries_p,  &other.d_entries_p);
+    bslalg::SwapUtil::swap(&d_controls_p, &other.d_controls_p);
+    bslalg::SwapUtil::swap(&d_size,       &other.d_size);
+    bslalg::SwapUtil::swap(&d_numErased,  &other.d_numErased);
+    bslalg::SwapUtil::swap(&d_capacity,   &other.d_capacity);
+}
+
+// ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::contains(
+                                                          const KEY& key) const
+{
+    return d_capacity != findKey(key, hashOf(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const bsl::uint8_t *
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::controls() const
+{
+    return d_controls_p;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::count(
+                                                          const KEY& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::empty() const
+{
+    return 0 == d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const ENTRY *
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::entries() const
+{
+    return d_entries_p;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::pair<
+  typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator,
+  typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::equal_range(
+                                                          const KEY& key) const
+{
+    const_iterator first = find(key);
+    const_iterator last  = first;
+
+    if (last != end()) {
+        ++last;
+    }
+
+    return bsl::pair<const_iterator, const_iterator>(first, last);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key) const
+{
+    const bsl::size_t index = findKey(key, hashOf(key));
+
+    if (index == d_capacity) {
+        return end();                                                 // RETURN
+    }
+
+    return const_iterator(FlatHashTable_IteratorImp<ENTRY>(
+                                                      d_entries_p + index,
+                                                      d_controls_p + index,
+                                                      d_capacity - index - 1));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const HASH&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hash_function() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const EQUAL& FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::key_eq() const
+{
+    return d_equal;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::load_factor() const
+{
+    return d_capacity
+           ? static_cast<float>(d_size) / static_cast<float>(d_capacity)
+           : 0.0f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::max_load_factor() const
+{
+    return 0.875f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::size() const
+{
+    return d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin() const
+{
+    return const_cast<FlatHashTable *>(this)->begin();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end() const
+{
+    return const_iterator();
+}
+
+                                  // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bslma::Allocator *
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator==(const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+                const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    typedef typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                                       const_iterator Iterator;
+
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (Iterator it = lhs.begin(); it != lhs.end(); ++it) {
+        Iterator match = rhs.find(ENTRY_UTIL::key(*it));
+
+        if (match == rhs.end() || !(*match == *it)) {
+            return false;                                             // RETURN
+        }
+    }
+
+    return true;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool operator!=(const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+                const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
+          FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL> futureA(b,
+                                                               a.allocator());
+    FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL> futureB(a,
+                                                               b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1405 @@
+// bdlc_flathashtable.t.cpp                                           -*-C++-*-
+#include <bdlc_flathashtable.h>
+
+#include <bslim_testutil.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bdlc::FlatHashTable' is an open-addressed hash table that is tested
+// through a test-local entry utility for 'bsl::pair' entries.  The primary
+// manipulators are 'tryEmplace' and 'erase', which are verified against
+// 'bsl::unordered_map' as an oracle, while the invariants of the table (the
+// number of slots in use, the control value of each slot, and the
+// findability of each entry) are verified after every operation.  Hashers
+// that map all keys to few hash values are used to force long probe
+// sequences, erased slots, and rehashing at the same capacity.
+//-----------------------------------------------------------------------------
+// FlatHashTable_ImplUtil
+// [ 2] bsl::size_t capacityForEntries(bsl::size_t numEntries);
+// [ 2] bsl::size_t maxLoad(bsl::size_t capacity);
+// [ 2] bsl::size_t mixHash(bsl::size_t hashValue);
+// [ 2] bsl::size_t roundUpCapacity(bsl::size_t minimumCapacity);
+//
+// FlatHashTable_IteratorImp
+// [ 3] FlatHashTable_IteratorImp();
+// [ 3] FlatHashTable_IteratorImp(ENTRY *, const uint8_t *, size_t);
+// [ 3] void operator++();
+// [ 3] ENTRY& operator*() const;
+// [ 3] bool operator==(const FHTII& lhs, const FHTII& rhs);
+//
+// FlatHashTable
+// [ 4] FlatHashTable(size_t capacity, hash, equal, Allocator *ba = 0);
+// [ 6] FlatHashTable(const FlatHashTable& original, Allocator *ba = 0);
+// [ 6] FlatHashTable(MovableRef<FlatHashTable> original);
+// [ 6] FlatHashTable(MovableRef<FlatHashTable> original, Allocator *ba);
+// [ 4] ~FlatHashTable();
+// [ 6] FlatHashTable& operator=(const FlatHashTable& rhs);
+// [ 6] FlatHashTable& operator=(MovableRef<FlatHashTable> rhs);
+// [ 5] void clear();
+// [ 4] pair<iterator, iterator> equal_range(const KEY& key);
+// [ 4] size_t erase(const KEY& key);
+// [ 4] iterator erase(const_iterator position);
+// [ 5] iterator erase(const_iterator first, const_iterator last);
+// [ 4] iterator find(const KEY& key);
+// [ 4] pair<iterator, bool> insert(const ENTRY& entry);
+// [ 4] pair<iterator, bool> insert(MovableRef<ENTRY> entry);
+// [ 5] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 5] void rehash(size_t minimumCapacity);
+// [ 5] void reserve(size_t numEntries);
+// [ 5] void reset();
+// [ 4] pair<iterator, bool> tryEmplace(KEY_TYPE&& key);
+// [ 4] iterator begin();
+// [ 4] iterator end();
+// [ 6] void swap(FlatHashTable& other);
+// [ 4] size_t capacity() const;
+// [ 4] bool contains(const KEY& key) const;
+// [ 4] const uint8_t *controls() const;
+// [ 4] size_t count(const KEY& key) const;
+// [ 4] bool empty() const;
+// [ 4] const ENTRY *entries() const;
+// [ 4] pair<CI, CI> equal_range(const KEY& key) const;
+// [ 4] const_iterator find(const KEY& key) const;
+// [ 4] const HASH& hash_function() const;
+// [ 4] const EQUAL& key_eq() const;
+// [ 4] float load_factor() const;
+// [ 4] float max_load_factor() const;
+// [ 4] size_t size() const;
+// [ 4] const_iterator begin() const;
+// [ 4] const_iterator end() const;
+// [ 4] Allocator *allocator() const;
+//
+// [ 6] bool operator==(const FlatHashTable& l, const FlatHashTable& r);
+// [ 6] bool operator!=(const FlatHashTable& l, const FlatHashTable& r);
+// [ 6] void swap(FlatHashTable& a, FlatHashTable& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] CONCERN: EXCEPTION SAFETY OF INSERTION AND GROWTH
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class KEY, class VALUE>
+struct TestEntryUtil {
+    // This 'struct' provides the entry utility required by
+    // 'bdlc::FlatHashTable' for 'bsl::pair<KEY, VALUE>' entries.
+
+    typedef bsl::pair<KEY, VALUE> Entry;
+
+    template <class KEY_TYPE>
+    static void constructFromKey(
+                        Entry                                       *entry,
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key)
+        // Create, at the specified 'entry', an entry having the specified
+        // 'key' and a default-constructed value, using the specified
+        // 'allocator' to supply memory.
+    {
+        bslma::ConstructionUtil::construct(
+                                 entry,
+                                 allocator,
+                                 BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key),
+                                 VALUE());
+    }
+
+    static const KEY& key(const Entry& entry)
+        // Return the key of the specified 'entry'.
+    {
+        return entry.first;
+    }
+};
+
+struct CollidingHash {
+    // This functor returns a hash value having only a few distinct values,
+    // so that many keys share a fingerprint and a probe sequence.
+
+    // DATA
+    int d_numValues;  // number of distinct hash values
+
+    // CREATORS
+    explicit CollidingHash(int numValues = 4)
+    : d_numValues(numValues)
+    {
+    }
+
+    // ACCESSORS
+    bsl::size_t operator()(int key) const
+    {
+        return static_cast<bsl::size_t>(key % d_numValues);
+    }
+};
+
+typedef bsl::pair<int, int>                               IntEntry;
+typedef TestEntryUtil<int, int>                           IntUtil;
+typedef bdlc::FlatHashTable<int,
+                            IntEntry,
+                            IntUtil,
+                            bsl::hash<int>,
+                            bsl::equal_to<int> >          Obj;
+typedef bdlc::FlatHashTable<int,
+                            IntEntry,
+                            IntUtil,
+                            CollidingHash,
+                            bsl::equal_to<int> >          CollidingObj;
+
+typedef bsl::pair<bsl::string, bsl::string>               StrEntry;
+typedef TestEntryUtil<bsl::string, bsl::string>           StrUtil;
+typedef bdlc::FlatHashTable<bsl::string,
+                            StrEntry,
+                            StrUtil,
+                            bslh::Hash<>,
+                            bsl::equal_to<bsl::string> >  StrObj;
+
+typedef bdlc::FlatHashTable_ImplUtil                      ImplUtil;
+typedef bdlc::FlatHashTable_IteratorImp<IntEntry>         IterImp;
+typedef bdlc::FlatHashTable_GroupControl                  GroupControl;
+
+typedef bslmf::MovableRefUtil                             MoveUtil;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class TABLE>
+static bool checkInvariants(const TABLE& table)
+    // Return 'true' if the specified 'table' satisfies the invariants of a
+    // flat hash table, and 'false' otherwise: the capacity is 0 or a power of
+    // 2 that is at least 16, the number of slots in use (as given by the
+    // control values) is 'size()', each entry is found at its slot, iteration
+    // visits exactly the slots in use, and some group has an empty slot.
+{
+    const bsl::size_t capacity = table.capacity();
+
+    if (0 == capacity) {
+        return 0 == table.size()
+            && table.begin() == table.end()
+            && 0 == table.controls()
+            && 0 == table.entries();                                  // RETURN
+    }
+
+    if (capacity < 16 || 0 != (capacity & (capacity - 1))) {
+        return false;                                                 // RETURN
+    }
+
+    const bsl::uint8_t *controls = table.controls();
+    bsl::size_t         numInUse = 0;
+    bool                hasEmpty = false;
+
+    for (bsl::size_t i = 0; i < capacity; ++i) {
+        if (0 == (controls[i] & 0x80)) {
+            ++numInUse;
+
+            typename TABLE::const_iterator it =
+                                          table.find(table.entries()[i].first);
+
+            if (it == table.end() || &*it != table.entries() + i) {
+                return false;                                         // RETURN
+            }
+        }
+        else if (GroupControl::k_EMPTY == controls[i]) {
+            hasEmpty = true;
+        }
+        else if (GroupControl::k_ERASED != controls[i]) {
+            return false;                                             // RETURN
+        }
+    }
+
+    bsl::size_t numIterated = 0;
+    for (typename TABLE::const_iterator it = table.begin();
+         it != table.end();
+         ++it) {
+        ++numIterated;
+    }
+
+    return numInUse == table.size()
+        && numIterated == table.size()
+        && hasEmpty
+        && table.size() <= ImplUtil::maxLoad(capacity);
+}
+
+template <class TABLE>
+static bool matchesOracle(const TABLE&                        table,
+                          const bsl::unordered_map<int, int>& oracle)
+    // Return 'true' if the specified 'table' has the same entries as the
+    // specified 'oracle', and 'false' otherwise.
+{
+    if (table.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (bsl::unordered_map<int, int>::const_iterator it = oracle.begin();
+         it != oracle.end();
+         ++it) {
+        typename TABLE::const_iterator match = table.find(it->first);
+
+        if (match == table.end() || match->second != it->second) {
+            return false;                                             // RETURN
+        }
+    }
+
+    return true;
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCERN: EXCEPTION SAFETY OF INSERTION AND GROWTH
+        //
+        // Concerns:
+        //: 1 If an allocation fails while inserting (including while growing
+        //:   the table or constructing an entry), the table is unchanged
+        //:   (strong guarantee) and no memory is leaked.
+        //:
+        //: 2 If an allocation fails while copying a table, no memory is
+        //:   leaked.
+        //
+        // Plan:
+        //: 1 Using 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*', insert entries
+        //:   having allocating keys and values into tables of various sizes,
+        //:   and verify the state of the table after each exception.  (C-1)
+        //:
+        //: 2 Using 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*', copy-construct
+        //:   tables of various sizes.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: EXCEPTION SAFETY OF INSERTION AND GROWTH
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+               << "CONCERN: EXCEPTION SAFETY OF INSERTION AND GROWTH" << endl
+               << "=================================================" << endl;
+
+        const char *LONG = "a string long enough to require an allocation: ";
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        for (int n = 0; n < 40; ++n) {
+            StrObj mX(0, bslh::Hash<>(), bsl::equal_to<bsl::string>(), &sa);
+            const StrObj& X = mX;
+
+            for (int i = 0; i < n; ++i) {
+                mX.insert(StrEntry(bsl::string(LONG) + char('A' + i),
+                                   bsl::string(LONG)));
+            }
+
+            const StrEntry ENTRY(bsl::string(LONG) + "new", LONG, &sa);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                ASSERTV(n, static_cast<bsl::size_t>(n) == X.size());
+                ASSERTV(n, checkInvariants(X));
+
+                mX.insert(ENTRY);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(n, static_cast<bsl::size_t>(n + 1) == X.size());
+            ASSERTV(n, X.contains(ENTRY.first));
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                StrObj mY(X, &sa);  const StrObj& Y = mY;
+
+                ASSERTV(n, X == Y);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the same value, capacity, and layout as the original,
+        //:   and uses the allocator supplied to it, or the default allocator.
+        //:
+        //: 2 Move construction without an allocator takes the contents of the
+        //:   original in constant time and leaves it empty.
+        //:
+        //: 3 Move construction and move assignment with a different allocator
+        //:   move the entries individually.
+        //:
+        //: 4 Copy assignment, including self-assignment, gives the target the
+        //:   value of the source.
+        //:
+        //: 5 Member 'swap' exchanges the contents without allocation; free
+        //:   'swap' also works for tables having different allocators.
+        //:
+        //: 6 Equality compares the entries, irrespective of capacity and of
+        //:   insertion order.
+        //
+        // Plan:
+        //: 1 For tables of various sizes, create copies, moves, and swaps,
+        //:   verify their values and the allocators used, and compare tables
+        //:   built in different orders and with different capacities.
+        //:   (C-1..6)
+        //
+        // Testing:
+        //   FlatHashTable(const FlatHashTable& original, Allocator *ba = 0);
+        //   FlatHashTable(MovableRef<FlatHashTable> original);
+        //   FlatHashTable(MovableRef<FlatHashTable> original, Allocator *ba);
+        //   FlatHashTable& operator=(const FlatHashTable& rhs);
+        //   FlatHashTable& operator=(MovableRef<FlatHashTable> rhs);
+        //   void swap(FlatHashTable& other);
+        //   bool operator==(const FlatHashTable& l, const FlatHashTable& r);
+        //   bool operator!=(const FlatHashTable& l, const FlatHashTable& r);
+        //   void swap(FlatHashTable& a, FlatHashTable& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, SWAP, AND EQUALITY" << endl
+                          << "==============================" << endl;
+
+        const int SIZES[] = { 0, 1, 2, 13, 14, 15, 16, 17, 100, 1000 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N = SIZES[ti];
+
+            bslma::TestAllocator sa("supplied",  veryVeryVeryVerbose);
+            bslma::TestAllocator oa("other",     veryVeryVeryVerbose);
+
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &sa);
+            const Obj& X = mX;
+
+            for (int i = 0; i < N; ++i) {
+                mX.insert(IntEntry(i, i * i));
+            }
+            if (N) {
+                mX.erase(N / 2);
+                mX.insert(IntEntry(N / 2, N));
+            }
+
+            if (veryVerbose) { P_(N) P_(X.size()) P(X.capacity()) }
+
+            // Copy construction.
+            {
+                bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+                Obj mY(X);  const Obj& Y = mY;
+
+                ASSERTV(N, X == Y);
+                ASSERTV(N, !(X != Y));
+                ASSERTV(N, X.capacity() == Y.capacity());
+                ASSERTV(N, &defaultAllocator == Y.allocator());
+                ASSERTV(N, checkInvariants(Y));
+                ASSERTV(N, (0 == N) == dam.isInUseSame());
+
+                for (bsl::size_t i = 0; i < X.capacity(); ++i) {
+                    ASSERTV(N, i, X.controls()[i] == Y.controls()[i]);
+                }
+
+                Obj mZ(X, &oa);  const Obj& Z = mZ;
+
+                ASSERTV(N, X == Z);
+                ASSERTV(N, &oa == Z.allocator());
+            }
+            ASSERTV(N, 0 == oa.numBlocksInUse());
+
+            // Move construction, same allocator.
+            {
+                Obj mY(X, &sa);
+
+                const bsl::size_t             CAPACITY = mY.capacity();
+                const IntEntry *const         ENTRIES  = mY.entries();
+                bslma::TestAllocatorMonitor   sam(&sa);
+
+                Obj mZ(MoveUtil::move(mY));  const Obj& Z = mZ;
+
+                ASSERTV(N, sam.isTotalSame());
+                ASSERTV(N, X == Z);
+                ASSERTV(N, CAPACITY == Z.capacity());
+                ASSERTV(N, ENTRIES  == Z.entries());
+                ASSERTV(N, &sa == Z.allocator());
+                ASSERTV(N, 0 == mY.size());
+                ASSERTV(N, 0 == mY.capacity());
+                ASSERTV(N, checkInvariants(mY));
+
+                Obj mW(MoveUtil::move(mZ), &sa);  const Obj& W = mW;
+
+                ASSERTV(N, sam.isTotalSame());
+                ASSERTV(N, X == W);
+                ASSERTV(N, ENTRIES  == W.entries());
+            }
+
+            // Move construction, different allocator.
+            {
+                Obj mY(X, &sa);
+
+                Obj mZ(MoveUtil::move(mY), &oa);  const Obj& Z = mZ;
+
+                ASSERTV(N, X == Z);
+                ASSERTV(N, &oa == Z.allocator());
+                ASSERTV(N, checkInvariants(Z));
+                ASSERTV(N, checkInvariants(mY));
+            }
+            ASSERTV(N, 0 == oa.numBlocksInUse());
+
+            // Copy and move assignment.
+            for (int tj = 0; tj < NUM_SIZES; ++tj) {
+                const int M = SIZES[tj];
+
+                Obj mY(0, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+                const Obj& Y = mY;
+
+                for (int i = 0; i < M; ++i) {
+                    mY.insert(IntEntry(-i, i));
+                }
+
+                ASSERTV(N, M, (0 == N && 0 == M) == (X == Y));
+
+                Obj *mR = &(mY = X);
+
+                ASSERTV(N, M, mR == &mY);
+                ASSERTV(N, M, X == Y);
+                ASSERTV(N, M, &oa == Y.allocator());
+                ASSERTV(N, M, checkInvariants(Y));
+
+                mY = Y;  // self-assignment
+
+                ASSERTV(N, M, X == Y);
+
+                Obj mZ(X, &sa);
+
+                mY.clear();
+                mR = &(mY = MoveUtil::move(mZ));
+
+                ASSERTV(N, M, mR == &mY);
+                ASSERTV(N, M, X == Y);
+                ASSERTV(N, M, &oa == Y.allocator());
+                ASSERTV(N, M, checkInvariants(mZ));
+            }
+            ASSERTV(N, 0 == oa.numBlocksInUse());
+
+            // Swap.
+            {
+                Obj mY(0, bsl::hash<int>(), bsl::equal_to<int>(), &sa);
+                const Obj& Y = mY;
+
+                mY.insert(IntEntry(-1, -1));
+
+                const Obj XX(X, &sa);
+                const Obj YY(Y, &sa);
+
+                bslma::TestAllocatorMonitor sam(&sa);
+
+                mX.swap(mY);
+
+                ASSERTV(N, sam.isTotalSame());
+                ASSERTV(N, XX == Y);
+                ASSERTV(N, YY == X);
+
+                swap(mX, mY);
+
+                ASSERTV(N, sam.isTotalSame());
+                ASSERTV(N, XX == X);
+                ASSERTV(N, YY == Y);
+
+                Obj mZ(Y, &oa);  const Obj& Z = mZ;
+
+                swap(mX, mZ);
+
+                ASSERTV(N, XX == Z);
+                ASSERTV(N, YY == X);
+                ASSERTV(N, &sa == X.allocator());
+                ASSERTV(N, &oa == Z.allocator());
+
+                swap(mX, mZ);
+
+                ASSERTV(N, XX == X);
+            }
+
+            // Equality is independent of capacity and insertion order.
+            {
+                Obj mY(4 * N, bsl::hash<int>(), bsl::equal_to<int>(), &sa);
+                const Obj& Y = mY;
+
+                for (int i = N - 1; 0 <= i; --i) {
+                    mY.insert(IntEntry(i, i * i));
+                }
+                if (N) {
+                    mY.erase(N / 2);
+                    mY.insert(IntEntry(N / 2, N));
+                }
+
+                ASSERTV(N, X == Y);
+
+                if (N) {
+                    mY.find(0)->second = -1;
+
+                    ASSERTV(N, X != Y);
+
+                    mY.find(0)->second = 0 == N / 2 ? N : 0;
+
+                    ASSERTV(N, X == Y);
+
+                    mY.erase(0);
+
+                    ASSERTV(N, X != Y);
+                }
+            }
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CAPACITY MANAGEMENT AND BULK OPERATIONS
+        //
+        // Concerns:
+        //: 1 'reserve' grows the table so that the specified number of entries
+        //:   can be inserted without rehashing, and never shrinks it.
+        //:
+        //: 2 'rehash' sets the least capacity that accommodates the entries
+        //:   and is at least the specified capacity, and removes all erased
+        //:   slots.
+        //:
+        //: 3 'clear' removes all entries but retains the capacity; 'reset'
+        //:   releases all memory.
+        //:
+        //: 4 Range 'insert' inserts the entries whose keys are not already
+        //:   present, and range 'erase' removes exactly the specified range.
+        //
+        // Plan:
+        //: 1 Exercise each method on tables of various sizes, verifying the
+        //:   capacity, the invariants, and the memory in use.  (C-1..4)
+        //
+        // Testing:
+        //   void clear();
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void rehash(size_t minimumCapacity);
+        //   void reserve(size_t numEntries);
+        //   void reset();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CAPACITY MANAGEMENT AND BULK OPERATIONS" << endl
+                          << "=======================================" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nTesting 'reserve'." << endl;
+
+        for (bsl::size_t n = 0; n < 300; n += 7) {
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &sa);
+            const Obj& X = mX;
+
+            mX.reserve(n);
+
+            const bsl::size_t CAPACITY = X.capacity();
+
+            ASSERTV(n, ImplUtil::capacityForEntries(n) == CAPACITY);
+
+            for (bsl::size_t i = 0; i < n; ++i) {
+                mX.insert(IntEntry(static_cast<int>(i), 0));
+            }
+
+            ASSERTV(n, CAPACITY == X.capacity());
+
+            mX.reserve(n / 2);
+
+            ASSERTV(n, CAPACITY == X.capacity());
+            ASSERTV(n, checkInvariants(X));
+        }
+
+        if (verbose) cout << "\nTesting 'rehash'." << endl;
+
+        for (bsl::size_t n = 0; n < 300; n += 11) {
+            CollidingObj mX(0, CollidingHash(), bsl::equal_to<int>(), &sa);
+            const CollidingObj& X = mX;
+
+            for (bsl::size_t i = 0; i < 2 * n; ++i) {
+                mX.tryEmplace(static_cast<int>(i));
+            }
+            for (bsl::size_t i = 0; i < 2 * n; i += 2) {
+                mX.erase(static_cast<int>(i));
+            }
+
+            ASSERTV(n, n == X.size());
+
+            mX.rehash(0);
+
+            ASSERTV(n, ImplUtil::capacityForEntries(n) == X.capacity());
+            ASSERTV(n, checkInvariants(X));
+
+            for (bsl::size_t i = 0; i < X.capacity(); ++i) {
+                ASSERTV(n, i, GroupControl::k_ERASED != X.controls()[i]);
+            }
+
+            mX.rehash(1000);
+
+            ASSERTV(n, 1024 == X.capacity());
+            ASSERTV(n, n == X.size());
+            ASSERTV(n, checkInvariants(X));
+
+            mX.rehash(1);
+
+            ASSERTV(n, (0 == n ? 16 : ImplUtil::capacityForEntries(n))
+                                                              == X.capacity());
+            ASSERTV(n, checkInvariants(X));
+        }
+
+        if (verbose) cout << "\nTesting 'clear' and 'reset'." << endl;
+
+        for (int n = 0; n < 100; n += 9) {
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &sa);
+            const Obj& X = mX;
+
+            for (int i = 0; i < n; ++i) {
+                mX.insert(IntEntry(i, i));
+            }
+
+            const bsl::size_t CAPACITY = X.capacity();
+
+            mX.clear();
+
+            ASSERTV(n, 0 == X.size());
+            ASSERTV(n, CAPACITY == X.capacity());
+            ASSERTV(n, X.begin() == X.end());
+            ASSERTV(n, checkInvariants(X));
+
+            mX.insert(IntEntry(1, 1));
+
+            ASSERTV(n, X.contains(1));
+
+            mX.reset();
+
+            ASSERTV(n, 0 == X.size());
+            ASSERTV(n, 0 == X.capacity());
+            ASSERTV(n, 0 == sa.numBlocksInUse());
+            ASSERTV(n, checkInvariants(X));
+        }
+
+        if (verbose) cout << "\nTesting range 'insert' and 'erase'." << endl;
+        {
+            IntEntry ENTRIES[50];
+            for (int i = 0; i < 50; ++i) {
+                ENTRIES[i] = IntEntry(i % 30, i);
+            }
+
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &sa);
+            const Obj& X = mX;
+
+            mX.insert(ENTRIES, ENTRIES + 50);
+
+            ASSERT(30 == X.size());
+            for (int i = 0; i < 30; ++i) {
+                ASSERTV(i, i == X.find(i)->second);
+            }
+
+            Obj::const_iterator first = X.begin();
+            Obj::const_iterator last  = first;
+            for (int i = 0; i < 10; ++i) {
+                ++last;
+            }
+
+            const int LAST_KEY = last->first;
+
+            Obj::iterator result = mX.erase(first, last);
+
+            ASSERT(20 == X.size());
+            ASSERT(LAST_KEY == result->first);
+            ASSERT(checkInvariants(X));
+
+            result = mX.erase(X.begin(), X.end());
+
+            ASSERT(0 == X.size());
+            ASSERT(X.end() == result);
+            ASSERT(checkInvariants(X));
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default table allocates no memory and has capacity 0; a table
+        //:   created with a capacity has the least valid capacity that is at
+        //:   least the requested one.
+        //:
+        //: 2 'tryEmplace' and 'insert' add an entry if and only if its key is
+        //:   absent, and return an iterator to the entry having the key.
+        //:
+        //: 3 'erase' removes exactly the entry having the key, and slots are
+        //:   marked empty when their group has an empty slot and erased
+        //:   otherwise.
+        //:
+        //: 4 Lookups are correct when many keys share a hash value, so that
+        //:   probe sequences span several groups, and across growth and
+        //:   rehashing at the same capacity.
+        //:
+        //: 5 The accessors report the state of the table, and all memory is
+        //:   supplied by the specified allocator and released on destruction.
+        //:
+        //: 6 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Perform long pseudo-random sequences of insertions, lookups, and
+        //:   erasures with various hashers, mirror them in
+        //:   'bsl::unordered_map', and verify the result of each operation
+        //:   and the invariants of the table.  (C-1..5)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-6)
+        //
+        // Testing:
+        //   FlatHashTable(size_t capacity, hash, equal, Allocator *ba = 0);
+        //   ~FlatHashTable();
+        //   pair<iterator, iterator> equal_range(const KEY& key);
+        //   size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator find(const KEY& key);
+        //   pair<iterator, bool> insert(const ENTRY& entry);
+        //   pair<iterator, bool> insert(MovableRef<ENTRY> entry);
+        //   pair<iterator, bool> tryEmplace(KEY_TYPE&& key);
+        //   iterator begin();
+        //   iterator end();
+        //   size_t capacity() const;
+        //   bool contains(const KEY& key) const;
+        //   const uint8_t *controls() const;
+        //   size_t count(const KEY& key) const;
+        //   bool empty() const;
+        //   const ENTRY *entries() const;
+        //   pair<CI, CI> equal_range(const KEY& key) const;
+        //   const_iterator find(const KEY& key) const;
+        //   const HASH& hash_function() const;
+        //   const EQUAL& key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                 << "========================================" << endl;
+
+        if (verbose) cout << "\nTesting the constructor." << endl;
+        {
+            const struct {
+                int         d_line;
+                bsl::size_t d_capacity;
+                bsl::size_t d_expected;
+            } DATA[] = {
+                //LN  CAPACITY  EXPECTED
+                //--  --------  --------
+                { L_,        0,        0 },
+                { L_,        1,       16 },
+                { L_,       15,       16 },
+                { L_,       16,       16 },
+                { L_,       17,       32 },
+                { L_,      100,      128 },
+                { L_,     1024,     1024 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const bsl::size_t CAPACITY = DATA[ti].d_capacity;
+                const bsl::size_t EXPECTED = DATA[ti].d_expected;
+
+                bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+                {
+                    const Obj X(CAPACITY,
+                                bsl::hash<int>(),
+                                bsl::equal_to<int>(),
+                                &sa);
+
+                    ASSERTV(LINE, EXPECTED == X.capacity());
+                    ASSERTV(LINE, 0 == X.size());
+                    ASSERTV(LINE, X.empty());
+                    ASSERTV(LINE, &sa == X.allocator());
+                    ASSERTV(LINE, 0.0f == X.load_factor());
+                    ASSERTV(LINE, 0.875f == X.max_load_factor());
+                    ASSERTV(LINE,
+                            (0 == EXPECTED) == (0 == sa.numBlocksInUse()));
+                    ASSERTV(LINE, checkInvariants(X));
+                }
+
+                ASSERTV(LINE, 0 == sa.numBlocksInUse());
+            }
+
+            {
+                bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+                const CollidingObj X(0,
+                                     CollidingHash(7),
+                                     bsl::equal_to<int>());
+
+                ASSERT(&defaultAllocator == X.allocator());
+                ASSERT(7 == X.hash_function().d_numValues);
+                ASSERT(X.key_eq()(3, 3));
+                ASSERT(dam.isTotalSame());
+            }
+        }
+
+        if (verbose) cout << "\nTesting against an oracle." << endl;
+
+        const int HASH_VALUES[] = { 1, 3, 1000, 0 };  // 0 => 'bsl::hash'
+        const int NUM_HASH_VALUES =
+                    static_cast<int>(sizeof HASH_VALUES / sizeof *HASH_VALUES);
+
+        for (int ti = 0; ti < NUM_HASH_VALUES; ++ti) {
+            const int HV      = HASH_VALUES[ti];
+            const int KEY_MAX = HV && HV < 10 ? 300 : 3000;
+
+            if (veryVerbose) { P_(HV) P(KEY_MAX) }
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+            bslma::TestAllocator za("oracle",   veryVeryVeryVerbose);
+
+            {
+                CollidingObj mX(0,
+                                CollidingHash(HV ? HV : 0x7fffffff),
+                                bsl::equal_to<int>(),
+                                &sa);
+                const CollidingObj& X = mX;
+
+                bsl::unordered_map<int, int> oracle(&za);
+
+                unsigned int seed = 12345 + ti;
+
+                for (int iteration = 0; iteration < 20000; ++iteration) {
+                    seed = seed * 1103515245 + 12345;
+
+                    const int r   = static_cast<int>((seed >> 8) & 0xfffff);
+                    const int key = r % KEY_MAX;
+                    const int op  = (r / KEY_MAX) % 8;
+
+                    switch (op) {
+                      case 0:
+                      case 1: {
+                        bsl::pair<CollidingObj::iterator, bool> result =
+                                                           mX.tryEmplace(key);
+
+                        ASSERTV(HV, iteration,
+                                result.second == (0 == oracle.count(key)));
+                        ASSERTV(HV, iteration, key == result.first->first);
+
+                        if (result.second) {
+                            ASSERTV(HV, iteration, 0 == result.first->second);
+                            result.first->second = iteration;
+                        }
+                        oracle.insert(bsl::make_pair(key, iteration));
+                      } break;
+                      case 2: {
+                        const IntEntry ENTRY(key, iteration);
+
+                        const bool EXP = 0 == oracle.count(key);
+
+                        bsl::pair<CollidingObj::iterator, bool> result =
+                                                            mX.insert(ENTRY);
+
+                        ASSERTV(HV, iteration, EXP == result.second);
+                        ASSERTV(HV, iteration, key == result.first->first);
+                        oracle.insert(ENTRY);
+                      } break;
+                      case 3: {
+                        IntEntry entry(key, iteration);
+
+                        const bool EXP = 0 == oracle.count(key);
+
+                        bsl::pair<CollidingObj::iterator, bool> result =
+                                            mX.insert(MoveUtil::move(entry));
+
+                        ASSERTV(HV, iteration, EXP == result.second);
+                        oracle.insert(IntEntry(key, iteration));
+                      } break;
+                      case 4: {
+                        ASSERTV(HV, iteration,
+                                oracle.erase(key) == mX.erase(key));
+                      } break;
+                      case 5: {
+                        CollidingObj::iterator it = mX.find(key);
+
+                        if (it != mX.end()) {
+                            CollidingObj::const_iterator next = it;
+                            ++next;
+
+                            CollidingObj::iterator result = mX.erase(it);
+
+                            ASSERTV(HV, iteration, next == result);
+                            ASSERTV(HV, iteration, 1 == oracle.erase(key));
+                        }
+                      } break;
+                      default: {
+                        const bool EXP = 1 == oracle.count(key);
+
+                        ASSERTV(HV, iteration, EXP == X.contains(key));
+                        ASSERTV(HV, iteration, EXP == (1 == X.count(key)));
+                        ASSERTV(HV, iteration,
+                                EXP == (X.find(key) != X.end()));
+                        ASSERTV(HV, iteration,
+                                EXP == (mX.find(key) != mX.end()));
+
+                        bsl::pair<CollidingObj::const_iterator,
+                                  CollidingObj::const_iterator> range =
+                                                           X.equal_range(key);
+                        bsl::pair<CollidingObj::iterator,
+                                  CollidingObj::iterator> mRange =
+                                                          mX.equal_range(key);
+
+                        ASSERTV(HV, iteration,
+                                EXP == (range.first != range.second));
+                        ASSERTV(HV, iteration,
+                                EXP == (mRange.first != mRange.second));
+
+                        if (EXP) {
+                            ASSERTV(HV, iteration,
+                                    oracle[key] == X.find(key)->second);
+
+                            CollidingObj::const_iterator next = range.first;
+                            ++next;
+                            ASSERTV(HV, iteration, next == range.second);
+                        }
+                      } break;
+                    }
+
+                    ASSERTV(HV, iteration, oracle.size() == X.size());
+                    ASSERTV(HV, iteration, oracle.empty() == X.empty());
+
+                    if (0 == iteration % 97) {
+                        ASSERTV(HV, iteration, checkInvariants(X));
+                        ASSERTV(HV, iteration, matchesOracle(X, oracle));
+                        ASSERTV(HV, iteration,
+                                X.load_factor() <= X.max_load_factor());
+                    }
+                }
+
+                ASSERTV(HV, checkInvariants(X));
+                ASSERTV(HV, matchesOracle(X, oracle));
+                ASSERTV(HV, 0 == defaultAllocator.numBlocksInUse());
+            }
+
+            ASSERTV(HV, 0 == sa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting erasure markers." << endl;
+        {
+            // With a single hash value, the first 14 keys fill one group (the
+            // maximum load of a capacity-16 table); erasing from it marks the
+            // slot empty.  In a larger table, a full group marks the slot
+            // erased.
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            CollidingObj mX(64, CollidingHash(1), bsl::equal_to<int>(), &sa);
+            const CollidingObj& X = mX;
+
+            for (int i = 0; i < 20; ++i) {
+                mX.tryEmplace(i);
+            }
+
+            ASSERT(64 == X.capacity());
+
+            const bsl::size_t INDEX = &*X.find(3) - X.entries();
+
+            mX.erase(3);
+
+            ASSERTV(INDEX, GroupControl::k_ERASED == X.controls()[INDEX]);
+            ASSERT(!X.contains(3));
+            ASSERT( X.contains(19));
+
+            const bsl::size_t INDEX19 = &*X.find(19) - X.entries();
+
+            mX.erase(19);
+
+            ASSERTV(INDEX19, GroupControl::k_EMPTY == X.controls()[INDEX19]);
+
+            bsl::pair<CollidingObj::iterator, bool> result = mX.tryEmplace(3);
+
+            ASSERT(result.second);
+            ASSERT(INDEX == static_cast<bsl::size_t>(&*result.first
+                                                              - X.entries()));
+            ASSERT(checkInvariants(X));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>());
+
+            mX.insert(IntEntry(1, 1));
+
+            ASSERT_SAFE_PASS(mX.erase(mX.find(1)));
+            ASSERT_SAFE_FAIL(mX.erase(mX.end()));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'FlatHashTable_IteratorImp'
+        //
+        // Concerns:
+        //: 1 A default-constructed iterator is the past-the-end value.
+        //:
+        //: 2 'operator++' advances to the next slot in use, skipping empty
+        //:   and erased slots, and becomes past-the-end after the last slot.
+        //:
+        //: 3 'operator*' refers to the current entry, and 'operator=='
+        //:   compares the slots referred to.
+        //:
+        //: 4 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Iterate over hand-built arrays of entries and control values,
+        //:   and verify the entries visited.  (C-1..3)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   FlatHashTable_IteratorImp();
+        //   FlatHashTable_IteratorImp(ENTRY *, const uint8_t *, size_t);
+        //   void operator++();
+        //   ENTRY& operator*() const;
+        //   bool operator==(const FHTII& lhs, const FHTII& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'FlatHashTable_IteratorImp'" << endl
+                          << "===========================" << endl;
+
+        const bsl::uint8_t EM = GroupControl::k_EMPTY;
+        const bsl::uint8_t ER = GroupControl::k_ERASED;
+
+        IntEntry           entries[8];
+        const bsl::uint8_t controls[8] = { 1, EM, 2, ER, ER, 3, EM, 4 };
+
+        for (int i = 0; i < 8; ++i) {
+            entries[i] = IntEntry(i, i);
+        }
+
+        const IterImp END;
+
+        ASSERT(END == IterImp());
+
+        IterImp mX(entries, controls, 7);  const IterImp& X = mX;
+
+        ASSERT(&*X == entries);
+        ASSERT(!(X == END));
+
+        const int EXPECTED[] = { 2, 5, 7 };
+
+        for (int i = 0; i < 3; ++i) {
+            ++mX;
+
+            ASSERTV(i, EXPECTED[i] == (*X).first);
+            ASSERTV(i, X == IterImp(entries + EXPECTED[i],
+                                    controls + EXPECTED[i],
+                                    7 - EXPECTED[i]));
+        }
+
+        ++mX;
+
+        ASSERT(X == END);
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_SAFE_PASS(IterImp(entries, controls, 7));
+            ASSERT_SAFE_FAIL(IterImp(entries + 1, controls + 1, 6));
+            ASSERT_SAFE_FAIL(*END);
+
+            IterImp mY;
+
+            ASSERT_SAFE_FAIL(++mY);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'FlatHashTable_ImplUtil'
+        //
+        // Concerns:
+        //: 1 'maxLoad' is 7/8 of the capacity.
+        //:
+        //: 2 'capacityForEntries' returns the least valid capacity whose
+        //:   maximum load accommodates the specified number of entries.
+        //:
+        //: 3 'roundUpCapacity' returns the least power of 2 that is at least
+        //:   16 and at least the specified value.
+        //:
+        //: 4 'mixHash' is a bijection whose low-order 7 bits and high-order
+        //:   bits vary even if the input varies only in its high-order or
+        //:   low-order bits, respectively.
+        //
+        // Plan:
+        //: 1 Verify the results against brute-force computations.  (C-1..3)
+        //:
+        //: 2 Hash sequences of values differing only in high-order bits (and
+        //:   only in low-order bits), and verify that the low-order 7 bits of
+        //:   the result (and the bits selecting a group) take many values.
+        //:   (C-4)
+        //
+        // Testing:
+        //   bsl::size_t capacityForEntries(bsl::size_t numEntries);
+        //   bsl::size_t maxLoad(bsl::size_t capacity);
+        //   bsl::size_t mixHash(bsl::size_t hashValue);
+        //   bsl::size_t roundUpCapacity(bsl::size_t minimumCapacity);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'FlatHashTable_ImplUtil'" << endl
+                          << "========================" << endl;
+
+        ASSERT(  14 == ImplUtil::maxLoad(16));
+        ASSERT(  28 == ImplUtil::maxLoad(32));
+        ASSERT( 896 == ImplUtil::maxLoad(1024));
+
+        ASSERT(   0 == ImplUtil::capacityForEntries(0));
+
+        for (bsl::size_t n = 1; n < 5000; ++n) {
+            const bsl::size_t CAPACITY = ImplUtil::capacityForEntries(n);
+
+            ASSERTV(n, 16 <= CAPACITY);
+            ASSERTV(n, 0 == (CAPACITY & (CAPACITY - 1)));
+            ASSERTV(n, n <= ImplUtil::maxLoad(CAPACITY));
+            ASSERTV(n, 16 == CAPACITY || ImplUtil::maxLoad(CAPACITY / 2) < n);
+
+            const bsl::size_t ROUNDED = ImplUtil::roundUpCapacity(n);
+
+            ASSERTV(n, 16 <= ROUNDED);
+            ASSERTV(n, 0 == (ROUNDED & (ROUNDED - 1)));
+            ASSERTV(n, n <= ROUNDED);
+            ASSERTV(n, 16 == ROUNDED || ROUNDED / 2 < n);
+        }
+
+        {
+            bool lowSeen[128]  = { false };
+            bool highSeen[128] = { false };
+
+            int numLow  = 0;
+            int numHigh = 0;
+
+            const int SHIFT = static_cast<int>(sizeof(bsl::size_t) * 8 - 8);
+
+            for (bsl::size_t i = 0; i < 256; ++i) {
+                const bsl::size_t LOW  = ImplUtil::mixHash(i << SHIFT) & 0x7f;
+                const bsl::size_t HIGH = (ImplUtil::mixHash(i) >> 7) & 0x7f;
+
+                numLow  += !lowSeen[LOW];
+                numHigh += !highSeen[HIGH];
+
+                lowSeen[LOW]   = true;
+                highSeen[HIGH] = true;
+
+                for (bsl::size_t j = 0; j < i; ++j) {
+                    ASSERTV(i, j,
+                            ImplUtil::mixHash(i) != ImplUtil::mixHash(j));
+                }
+            }
+
+            if (veryVerbose) { P_(numLow) P(numHigh) }
+
+            ASSERTV(numLow,  numLow  > 64);
+            ASSERTV(numHigh, numHigh > 64);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(ImplUtil::roundUpCapacity(1));
+            ASSERT_FAIL(ImplUtil::roundUpCapacity(0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a table, insert, find, and erase entries, and grow the
+        //:   table.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        {
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &sa);
+            const Obj& X = mX;
+
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == sa.numBlocksTotal());
+            ASSERT(X.end() == X.find(1));
+
+            ASSERT(true  == mX.insert(IntEntry(1, 10)).second);
+            ASSERT(false == mX.insert(IntEntry(1, 20)).second);
+            ASSERT(1  == X.size());
+            ASSERT(16 == X.capacity());
+            ASSERT(10 == X.find(1)->second);
+
+            for (int i = 2; i <= 100; ++i) {
+                mX.tryEmplace(i).first->second = 10 * i;
+            }
+
+            ASSERT(100 == X.size());
+            ASSERT(128 == X.capacity());
+
+            for (int i = 1; i <= 100; ++i) {
+                ASSERTV(i, 10 * i == X.find(i)->second);
+            }
+
+            ASSERT(1 == mX.erase(50));
+            ASSERT(0 == mX.erase(50));
+            ASSERT(99 == X.size());
+            ASSERT(!X.contains(50));
+            ASSERT(checkInvariants(X));
+        }
+
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
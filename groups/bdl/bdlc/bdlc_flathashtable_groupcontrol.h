@@ -0,0 +1,226 @@
+// bdlc_flathashtable_groupcontrol.h                                  -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHTABLE_GROUPCONTROL
+#define INCLUDED_BDLC_FLATHASHTABLE_GROUPCONTROL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide inquiries to a flat hash table group of control values.
+//
+//@CLASSES:
+//  bdlc::FlatHashTable_GroupControl: flat hash table group control inquiries
+//
+//@SEE_ALSO: bdlc_flathashtable
+//
+//@DESCRIPTION: This component implements the class,
+// 'bdlc::FlatHashTable_GroupControl', which provides query methods on a group
+// of flat hash table control values.  Note that the hash table functionality
+// is entirely provided by 'bdlc::FlatHashTable'; this component exists so
+// that the (platform-specific) vectorized comparisons of control values are
+// tested in isolation.
+//
+// A flat hash table stores one control value ("control byte") for each of its
+// slots.  A control value is 'k_EMPTY' for a slot that has never held an
+// entry since the table was last rehashed, 'k_ERASED' for a slot whose entry
+// has been erased, and otherwise holds the 7 low-order bits of the (mixed)
+// hash value of the key of the entry in the slot.  Consequently, the slots in
+// use are exactly those whose control values have the high-order bit unset.
+// The slots of a flat hash table are partitioned into groups of 'k_SIZE'
+// slots, and the methods of this component allow a flat hash table to find,
+// with a handful of instructions, the slots of a group that may hold a given
+// key, that are available, or that are in use.  On platforms supporting SSE2,
+// the control values of a group are compared in parallel; on other platforms,
+// they are compared sequentially.
+//
+///Usage
+///-----
+// There is no usage example for this component since it is not meant for
+// direct client use.
+
+#include <bdlscm_version.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ || (defined(BSLS_PLATFORM_CPU_X86)                                           \
+  && (defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+#define BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                      // ================================
+                      // class FlatHashTable_GroupControl
+                      // ================================
+
+class FlatHashTable_GroupControl {
+    // This class provides methods for making inquiries into the control
+    // values of a group of 'k_SIZE' consecutive slots of a flat hash table.
+    // The control values are loaded at construction, so subsequent changes to
+    // the underlying control values are not reflected in an existing object.
+
+  public:
+    // PUBLIC CONSTANTS
+    static const bsl::uint8_t k_EMPTY  = 0x80;
+                                         // control value of an empty slot
+
+    static const bsl::uint8_t k_ERASED = 0xFE;
+                                         // control value of a slot whose
+                                         // entry has been erased
+
+    static const bsl::size_t  k_SIZE   = 16;
+                                         // number of control values in a
+                                         // group
+
+  private:
+    // DATA
+#ifdef BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2
+    __m128i      d_value;      // the control values of the group
+#else
+    bsl::uint8_t d_value[16];  // the control values of the group
+#endif
+
+    // NOT IMPLEMENTED
+    FlatHashTable_GroupControl();
+    FlatHashTable_GroupControl(const FlatHashTable_GroupControl&);
+    FlatHashTable_GroupControl& operator=(const FlatHashTable_GroupControl&);
+
+  public:
+    // CREATORS
+    explicit FlatHashTable_GroupControl(const bsl::uint8_t *data);
+        // Create a group control object for the 'k_SIZE' control values
+        // beginning at the specified 'data'.
+
+    //! ~FlatHashTable_GroupControl() = default;
+        // Destroy this object.
+
+    // ACCESSORS
+    bsl::uint32_t available() const;
+        // Return a bit mask of the slots in this group that are empty or
+        // erased, where bit 'i' corresponds to the slot at offset 'i'.
+
+    bsl::uint32_t inUse() const;
+        // Return a bit mask of the slots in this group that hold an entry,
+        // where bit 'i' corresponds to the slot at offset 'i'.
+
+    bsl::uint32_t match(bsl::uint8_t value) const;
+        // Return a bit mask of the slots in this group whose control value is
+        // the specified 'value', where bit 'i' corresponds to the slot at
+        // offset 'i'.  The behavior is undefined unless '0 == (value & 0x80)'.
+
+    bool neverFull() const;
+        // Return 'true' if this group has at least one empty slot, and
+        // 'false' otherwise.  Note that a search for a key can stop at the
+        // first group having an empty slot, since an insertion of that key
+        // would have used the first available slot it encountered.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                      // --------------------------------
+                      // class FlatHashTable_GroupControl
+                      // --------------------------------
+
+// CREATORS
+inline
+FlatHashTable_GroupControl::FlatHashTable_GroupControl(
+                                                      const bsl::uint8_t *data)
+{
+    BSLS_ASSERT_SAFE(data);
+
+#ifdef BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2
+    d_value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+#else
+    for (int i = 0; i < 16; ++i) {
+        d_value[i] = data[i];
+    }
+#endif
+}
+
+// ACCESSORS
+inline
+bsl::uint32_t FlatHashTable_GroupControl::available() const
+{
+    // Both 'k_EMPTY' and 'k_ERASED' have the high-order bit set.
+
+#ifdef BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2
+    return static_cast<bsl::uint32_t>(_mm_movemask_epi8(d_value));
+#else
+    bsl::uint32_t mask = 0;
+    for (int i = 0; i < 16; ++i) {
+        mask |= static_cast<bsl::uint32_t>(d_value[i] >> 7) << i;
+    }
+    return mask;
+#endif
+}
+
+inline
+bsl::uint32_t FlatHashTable_GroupControl::inUse() const
+{
+    return ~available() & 0xffffu;
+}
+
+inline
+bsl::uint32_t FlatHashTable_GroupControl::match(bsl::uint8_t value) const
+{
+    BSLS_ASSERT_SAFE(0 == (value & 0x80));
+
+#ifdef BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2
+    return static_cast<bsl::uint32_t>(_mm_movemask_epi8(
+                  _mm_cmpeq_epi8(d_value,
+                                 _mm_set1_epi8(static_cast<char>(value)))));
+#else
+    bsl::uint32_t mask = 0;
+    for (int i = 0; i < 16; ++i) {
+        mask |= static_cast<bsl::uint32_t>(value == d_value[i]) << i;
+    }
+    return mask;
+#endif
+}
+
+inline
+bool FlatHashTable_GroupControl::neverFull() const
+{
+#ifdef BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2
+    return 0 != _mm_movemask_epi8(
+                  _mm_cmpeq_epi8(d_value,
+                                 _mm_set1_epi8(static_cast<char>(k_EMPTY))));
+#else
+    for (int i = 0; i < 16; ++i) {
+        if (k_EMPTY == d_value[i]) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
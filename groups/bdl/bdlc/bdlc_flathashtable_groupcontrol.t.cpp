@@ -0,0 +1,417 @@
+// bdlc_flathashtable_groupcontrol.t.cpp                              -*-C++-*-
+#include <bdlc_flathashtable_groupcontrol.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides inquiries into a group of flat hash table
+// control values.  The inquiries are verified against a simple scalar oracle,
+// over tabulated groups and over pseudo-randomly generated groups, at every
+// alignment of the control values.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 1] explicit FlatHashTable_GroupControl(const bsl::uint8_t *data);
+//
+// ACCESSORS
+// [ 1] bsl::uint32_t available() const;
+// [ 1] bsl::uint32_t inUse() const;
+// [ 2] bsl::uint32_t match(bsl::uint8_t value) const;
+// [ 3] bool neverFull() const;
+// ----------------------------------------------------------------------------
+// [ 4] CONCERN: RANDOM GROUPS AT EVERY ALIGNMENT
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashTable_GroupControl Obj;
+
+const bsl::uint8_t EM = Obj::k_EMPTY;
+const bsl::uint8_t ER = Obj::k_ERASED;
+
+// Data for the tabulated test cases: each row is a group of 16 control
+// values.
+
+static const struct {
+    int          d_line;
+    bsl::uint8_t d_data[16];
+} DATA[] = {
+    //LN  control values
+    //--  ---------------------------------------------------------------
+    { L_, { EM, EM, EM, EM, EM, EM, EM, EM, EM, EM, EM, EM, EM, EM, EM, EM} },
+    { L_, { ER, ER, ER, ER, ER, ER, ER, ER, ER, ER, ER, ER, ER, ER, ER, ER} },
+    { L_, {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0} },
+    { L_, {127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127} },
+    { L_, { EM,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15} },
+    { L_, {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, EM} },
+    { L_, { ER,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, ER} },
+    { L_, {  5, EM,  5, ER,  5, EM,  5, ER,  5, EM,  5, ER,  5, EM,  5, ER} },
+    { L_, { ER, ER, EM, ER, ER, ER, ER, ER, ER, ER, ER, ER, ER, ER, ER, ER} },
+    { L_, { 64, 63, 64, 63, 64, 63, 64, 63, 64, 63, 64, 63, 64, 63, 64, 63} },
+};
+const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bsl::uint32_t oracleAvailable(const bsl::uint8_t *data)
+    // Return the bit mask of the values among the 16 values beginning at the
+    // specified 'data' that are 'k_EMPTY' or 'k_ERASED'.
+{
+    bsl::uint32_t mask = 0;
+    for (int i = 0; i < 16; ++i) {
+        if (EM == data[i] || ER == data[i]) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+}
+
+static bsl::uint32_t oracleMatch(const bsl::uint8_t *data, bsl::uint8_t value)
+    // Return the bit mask of the values among the 16 values beginning at the
+    // specified 'data' that are equal to the specified 'value'.
+{
+    bsl::uint32_t mask = 0;
+    for (int i = 0; i < 16; ++i) {
+        if (value == data[i]) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+}
+
+static bool oracleNeverFull(const bsl::uint8_t *data)
+    // Return 'true' if any of the 16 values beginning at the specified 'data'
+    // is 'k_EMPTY', and 'false' otherwise.
+{
+    return 0 != oracleMatch(data, EM);
+}
+
+static void generateGroup(bsl::uint8_t *data, int *seed)
+    // Load into the 16 values beginning at the specified 'data' pseudo-random
+    // control values (empty, erased, or a 7-bit fingerprint drawn from a
+    // small range so that fingerprints repeat), updating the specified
+    // 'seed'.
+{
+    for (int i = 0; i < 16; ++i) {
+        *seed = *seed * 1103515245 + 12345;
+
+        const int r = (*seed >> 16) & 0x7fff;
+
+        switch (r % 4) {
+          case 0: data[i] = EM;                                        break;
+          case 1: data[i] = ER;                                        break;
+          default: data[i] = static_cast<bsl::uint8_t>((r >> 2) % 8);  break;
+        }
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: RANDOM GROUPS AT EVERY ALIGNMENT
+        //
+        // Concerns:
+        //: 1 The inquiries return the expected values for arbitrary groups,
+        //:   irrespective of the alignment of the control values.
+        //
+        // Plan:
+        //: 1 Generate pseudo-random groups, copy each to every offset within
+        //:   a buffer (so that the loads are misaligned), and verify the
+        //:   inquiries against the oracles.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: RANDOM GROUPS AT EVERY ALIGNMENT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                        << "CONCERN: RANDOM GROUPS AT EVERY ALIGNMENT" << endl
+                        << "=========================================" << endl;
+
+        int seed = 17;
+
+        for (int iteration = 0; iteration < 1000; ++iteration) {
+            bsl::uint8_t group[16];
+            generateGroup(group, &seed);
+
+            for (int offset = 0; offset < 16; ++offset) {
+                bsl::uint8_t buffer[32];
+                for (int i = 0; i < 16; ++i) {
+                    buffer[offset + i] = group[i];
+                }
+
+                const Obj X(buffer + offset);
+
+                ASSERTV(iteration, offset,
+                        oracleAvailable(group) == X.available());
+                ASSERTV(iteration, offset,
+                        (~oracleAvailable(group) & 0xffff) == X.inUse());
+                ASSERTV(iteration, offset,
+                        oracleNeverFull(group) == X.neverFull());
+
+                for (int v = 0; v < 8; ++v) {
+                    const bsl::uint8_t VALUE = static_cast<bsl::uint8_t>(v);
+
+                    ASSERTV(iteration, offset, v,
+                            oracleMatch(group, VALUE) == X.match(VALUE));
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'neverFull'
+        //
+        // Concerns:
+        //: 1 The method returns 'true' if and only if the group has an empty
+        //:   slot; erased slots do not count.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the result of
+        //:   'neverFull' against the oracle.  (C-1)
+        //
+        // Testing:
+        //   bool neverFull() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'neverFull'" << endl
+                          << "===================" << endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int           LINE = DATA[ti].d_line;
+            const bsl::uint8_t *CTRL = DATA[ti].d_data;
+
+            const Obj X(CTRL);
+
+            if (veryVerbose) { P_(LINE) P(X.neverFull()) }
+
+            ASSERTV(LINE, oracleNeverFull(CTRL) == X.neverFull());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'match'
+        //
+        // Concerns:
+        //: 1 The method returns the mask of the slots whose control value is
+        //:   the specified value, for every possible fingerprint.
+        //:
+        //: 2 Empty and erased slots never match.
+        //:
+        //: 3 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the result of 'match'
+        //:   for every value in '[0 .. 127]' against the oracle.  (C-1..2)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-3)
+        //
+        // Testing:
+        //   bsl::uint32_t match(bsl::uint8_t value) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'match'" << endl
+                          << "===============" << endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int           LINE = DATA[ti].d_line;
+            const bsl::uint8_t *CTRL = DATA[ti].d_data;
+
+            const Obj X(CTRL);
+
+            for (int v = 0; v < 128; ++v) {
+                const bsl::uint8_t VALUE = static_cast<bsl::uint8_t>(v);
+
+                ASSERTV(LINE, v, oracleMatch(CTRL, VALUE) == X.match(VALUE));
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const Obj X(DATA[0].d_data);
+
+            ASSERT_SAFE_PASS(X.match(0x7f));
+            ASSERT_SAFE_FAIL(X.match(0x80));
+            ASSERT_SAFE_FAIL(X.match(EM));
+            ASSERT_SAFE_FAIL(X.match(ER));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTOR, 'available', AND 'inUse'
+        //
+        // Concerns:
+        //: 1 The constructor loads the 16 control values at the specified
+        //:   address, which need not be aligned.
+        //:
+        //: 2 'available' returns the mask of the empty and erased slots, and
+        //:   'inUse' returns the mask of the other slots; only the low-order
+        //:   16 bits may be set.
+        //:
+        //: 3 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, construct objects from each
+        //:   tabulated group at every offset of a buffer, and verify the
+        //:   results of 'available' and 'inUse' against the oracle.  (C-1..2)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-3)
+        //
+        // Testing:
+        //   explicit FlatHashTable_GroupControl(const bsl::uint8_t *data);
+        //   bsl::uint32_t available() const;
+        //   bsl::uint32_t inUse() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTOR, 'available', AND 'inUse'" << endl
+                          << "=====================================" << endl;
+
+        ASSERT(0x80 == Obj::k_EMPTY);
+        ASSERT(0xFE == Obj::k_ERASED);
+        ASSERT(  16 == Obj::k_SIZE);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int           LINE = DATA[ti].d_line;
+            const bsl::uint8_t *CTRL = DATA[ti].d_data;
+
+            for (int offset = 0; offset < 16; ++offset) {
+                bsl::uint8_t buffer[32];
+                for (int i = 0; i < 16; ++i) {
+                    buffer[offset + i] = CTRL[i];
+                }
+
+                const Obj X(buffer + offset);
+
+                if (veryVerbose) { P_(LINE) P_(offset) P(X.available()) }
+
+                ASSERTV(LINE, offset, oracleAvailable(CTRL) == X.available());
+                ASSERTV(LINE, offset,
+                        (~oracleAvailable(CTRL) & 0xffff) == X.inUse());
+                ASSERTV(LINE, offset, 0 == (X.available() & X.inUse()));
+                ASSERTV(LINE, offset,
+                        0xffff == (X.available() | X.inUse()));
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_SAFE_PASS(Obj(DATA[0].d_data));
+            ASSERT_SAFE_FAIL(Obj(0));
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
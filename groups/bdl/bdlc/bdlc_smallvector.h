@@ -0,0 +1,2034 @@
+// bdlc_smallvector.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_SMALLVECTOR
+#define INCLUDED_BDLC_SMALLVECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a vector holding its first few elements without allocating.
+//
+//@CLASSES:
+//  bdlc::SmallVector: vector with in-place storage for 'N' elements
+//
+//@SEE_ALSO: bslstl_vector, bslalg_arrayprimitives
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::SmallVector', which implements a dynamic array of elements of
+// (template parameter) type 'TYPE' with an interface modeled on that of
+// 'bsl::vector'.  A 'SmallVector' additionally holds an in-place ("inline")
+// buffer large enough for (template parameter) 'INLINE_CAPACITY' elements.
+// As long as the size of a 'SmallVector' does not exceed 'INLINE_CAPACITY',
+// its elements are stored in the inline buffer and no memory is obtained from
+// the allocator; only when an operation needs more room are the elements
+// moved to a buffer obtained from the allocator.  A 'SmallVector' is
+// therefore appropriate for sequences that are usually short, such as the
+// attributes of a message or the hops of a route, when such sequences are
+// created and destroyed at a high rate.
+//
+// 'bdlc::SmallVector' is allocator-aware in the 'bslma' sense: the allocator
+// supplied at construction is used to supply memory once the inline buffer is
+// exhausted, and is passed to the elements that use a 'bslma' allocator.  The
+// elements are created, moved, and destroyed by 'bslalg::ArrayPrimitives',
+// which relocates elements of bit-wise movable types, and copies elements of
+// bit-wise copyable types, with 'memcpy'.
+//
+///Differences From 'bsl::vector'
+///------------------------------
+//: o The capacity of a 'SmallVector' is never less than 'INLINE_CAPACITY',
+//:   and 'shrink_to_fit' moves the elements back to the inline buffer if they
+//:   fit.
+//:
+//: o Moving a 'SmallVector' whose elements are stored inline moves each
+//:   element, and so has linear rather than constant complexity, and
+//:   invalidates iterators to the elements of the source.  Similarly, 'swap'
+//:   has linear complexity unless both vectors store their elements in
+//:   allocated memory.
+//:
+//: o 'SmallVector' itself is not bit-wise movable, since it may refer to its
+//:   own inline buffer.
+//:
+//: o The allocator is not propagated on copy assignment, move assignment, or
+//:   swap, and 'swap' requires both vectors to use the same allocator.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Collecting Message Attributes
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose a messaging system attaches a handful of integer attributes to each
+// message, and that messages are created at a very high rate.  Very few
+// messages carry more than four attributes, so we use a 'SmallVector' with an
+// inline capacity of four, and the allocator is consulted only for the rare
+// message having more attributes.
+//
+// First, we create a test allocator to observe the allocations:
+//..
+//  bslma::TestAllocator ta;
+//..
+// Then, we create a 'SmallVector' that uses the test allocator and append
+// three attributes to it:
+//..
+//  bdlc::SmallVector<int, 4> attributes(&ta);
+//
+//  attributes.push_back(17);
+//  attributes.push_back(42);
+//  attributes.push_back(99);
+//..
+// Next, we verify that the attributes are stored inline, and that the
+// allocator has not been used:
+//..
+//  assert(3 == attributes.size());
+//  assert(attributes.isInline());
+//  assert(0 == ta.numBlocksTotal());
+//..
+// Then, we append two more attributes, exceeding the inline capacity:
+//..
+//  attributes.push_back(3);
+//  attributes.push_back(8);
+//..
+// Now, we observe that the elements have moved to allocated memory:
+//..
+//  assert(5 == attributes.size());
+//  assert(!attributes.isInline());
+//  assert(1 == ta.numBlocksInUse());
+//..
+// Finally, we remove the extra attributes and shrink the vector, which moves
+// the elements back to the inline buffer and releases the allocated memory:
+//..
+//  attributes.resize(2);
+//  attributes.shrink_to_fit();
+//
+//  assert(attributes.isInline());
+//  assert(0  == ta.numBlocksInUse());
+//  assert(17 == attributes[0]);
+//  assert(42 == attributes[1]);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslalg_arraydestructionprimitives.h>
+#include <bslalg_arrayprimitives.h>
+#include <bslalg_hasstliterators.h>
+#include <bslalg_swaputil.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_allocator.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_integralconstant.h>
+#include <bslmf_isintegral.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmf_util.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentfromtype.h>
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_performancehint.h>
+#include <bsls_review.h>
+
+#include <bslstl_stdexceptutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_iterator.h>
+#include <bsl_limits.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                       // ================================
+                       // class SmallVector_CreatorProctor
+                       // ================================
+
+template <class VECTOR>
+class SmallVector_CreatorProctor {
+    // This component-private class implements a proctor that, unless its
+    // 'release' method has been invoked, destroys the elements of a
+    // partially-constructed 'SmallVector' and releases its allocated memory
+    // on destruction.  It is used to provide exception neutrality in the
+    // constructors of 'SmallVector', whose destructor is not run if a
+    // constructor throws.
+
+    // DATA
+    VECTOR *d_vector_p;  // proctored vector (held, not owned)
+
+    // NOT IMPLEMENTED
+    SmallVector_CreatorProctor(const SmallVector_CreatorProctor&);
+    SmallVector_CreatorProctor& operator=(const SmallVector_CreatorProctor&);
+
+  public:
+    // CREATORS
+    explicit SmallVector_CreatorProctor(VECTOR *vector);
+        // Create a proctor for the specified 'vector'.
+
+    ~SmallVector_CreatorProctor();
+        // Destroy this proctor, and destroy the elements and release the
+        // allocated memory of the proctored vector unless 'release' has been
+        // invoked.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the vector proctored by this object.
+};
+
+                            // =================
+                            // class SmallVector
+                            // =================
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+class SmallVector {
+    // This class template implements a value-semantic container type holding
+    // a dynamic array of values of (template parameter) type 'TYPE', the
+    // first (template parameter) 'INLINE_CAPACITY' of which are stored within
+    // the footprint of the object.
+
+    BSLMF_ASSERT(0 < INLINE_CAPACITY);
+
+    // PRIVATE TYPES
+    typedef bslalg::ArrayPrimitives                ArrayPrimitives;
+    typedef bslalg::ArrayDestructionPrimitives     ArrayDestructionPrimitives;
+    typedef bslmf::MovableRefUtil                  MoveUtil;
+    typedef bsl::allocator_traits<bsl::allocator<TYPE> >
+                                                   AllocatorTraits;
+
+    typedef bsls::AlignedBuffer<
+                      static_cast<int>(sizeof(TYPE) * INLINE_CAPACITY),
+                      bsls::AlignmentFromType<TYPE>::VALUE> InlineBuffer;
+
+    // DATA
+    TYPE                 *d_begin_p;       // first element, in either
+                                           // 'd_inlineBuffer' or allocated
+                                           // memory
+
+    TYPE                 *d_end_p;         // one past the last element
+
+    bsl::size_t           d_capacity;      // number of elements that fit at
+                                           // 'd_begin_p'
+
+    bsl::allocator<TYPE>  d_allocator;     // allocator of the elements and of
+                                           // the out-of-place buffer
+
+    InlineBuffer          d_inlineBuffer;  // storage for the first
+                                           // 'INLINE_CAPACITY' elements
+
+    // FRIENDS
+    friend class SmallVector_CreatorProctor<SmallVector>;
+
+    // PRIVATE MANIPULATORS
+    void privateAdopt(TYPE        *newBegin,
+                      bsl::size_t  newSize,
+                      bsl::size_t  newCapacity);
+        // Release the allocated buffer of this vector, if any, and make the
+        // specified 'newBegin', holding 'newSize' elements and having room for
+        // 'newCapacity' elements, the buffer of this vector.  The behavior is
+        // undefined unless the elements of this vector have already been
+        // destroyed or relocated.
+
+    TYPE *privateAllocate(bsl::size_t numElements);
+        // Return the address of a buffer having room for the specified
+        // 'numElements' elements, obtained from the allocator of this vector.
+
+    void privateAssign(bsl::size_t numElements,
+                       const TYPE& value,
+                       bsl::true_type);
+    template <class INPUT_ITERATOR>
+    void privateAssign(INPUT_ITERATOR first,
+                       INPUT_ITERATOR last,
+                       bsl::false_type);
+        // Assign to this vector the specified 'numElements' copies of the
+        // specified 'value', or the elements of the range starting at the
+        // specified 'first' iterator and ending immediately before the
+        // specified 'last' iterator, depending on whether the (template
+        // parameter) type 'INPUT_ITERATOR' of the public 'assign' method is an
+        // integral type.  The last argument is for overload resolution only.
+
+    void privateDestroy();
+        // Destroy the elements of this vector and release its allocated
+        // buffer, if any, leaving this vector empty and using its inline
+        // buffer.
+
+    void privateInsertDispatch(const TYPE  *position,
+                               bsl::size_t  numElements,
+                               const TYPE&  value,
+                               bsl::true_type);
+    template <class INPUT_ITERATOR>
+    void privateInsertDispatch(const TYPE     *position,
+                               INPUT_ITERATOR  first,
+                               INPUT_ITERATOR  last,
+                               bsl::false_type);
+        // Insert at the specified 'position' in this vector the specified
+        // 'numElements' copies of the specified 'value', or the elements of
+        // the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, depending on
+        // whether the (template parameter) type 'INPUT_ITERATOR' of the public
+        // 'insert' method is an integral type.  The last argument is for
+        // overload resolution only.
+
+    template <class INPUT_ITERATOR>
+    void privateInsert(const TYPE     *position,
+                       INPUT_ITERATOR  first,
+                       INPUT_ITERATOR  last,
+                       const bsl::input_iterator_tag&);
+    template <class FORWARD_ITERATOR>
+    void privateInsert(const TYPE       *position,
+                       FORWARD_ITERATOR  first,
+                       FORWARD_ITERATOR  last,
+                       const bsl::forward_iterator_tag&);
+        // Insert at the specified 'position' in this vector the elements of
+        // the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator.  The last argument
+        // selects the algorithm according to the category of the iterators:
+        // the elements of an input range are appended one at a time and then
+        // rotated into place, whereas the length of a forward range is
+        // computed first so that the elements are constructed in place.
+
+    void privateMoveFrom(SmallVector *original);
+        // Move the elements of the specified 'original' vector into this
+        // empty vector, taking ownership of the allocated buffer of
+        // 'original' if it has one and both vectors use the same allocator.
+        // 'original' is left in a valid but unspecified state.  The behavior
+        // is undefined unless this vector is empty and uses its inline buffer.
+
+    void privateResetToInline();
+        // Make this vector refer to its inline buffer, without destroying any
+        // elements or releasing any memory.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t computeNewCapacity(bsl::size_t newSize) const;
+        // Return the capacity to allocate in order to hold the specified
+        // 'newSize' elements, growing geometrically.  Throw
+        // 'bsl::length_error' if 'newSize > max_size()'.
+
+    bool isInlineBuffer(const TYPE *buffer) const;
+        // Return 'true' if the specified 'buffer' is the inline buffer of
+        // this vector, and 'false' otherwise.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SmallVector, bslma::UsesBslmaAllocator);
+    BSLMF_NESTED_TRAIT_DECLARATION(SmallVector, bslalg::HasStlIterators);
+
+    // PUBLIC TYPES
+    typedef TYPE                                   value_type;
+    typedef bsl::allocator<TYPE>                   allocator_type;
+    typedef bsl::size_t                            size_type;
+    typedef bsl::ptrdiff_t                         difference_type;
+    typedef value_type&                            reference;
+    typedef const value_type&                      const_reference;
+    typedef value_type                            *pointer;
+    typedef const value_type                      *const_pointer;
+    typedef value_type                            *iterator;
+    typedef const value_type                      *const_iterator;
+    typedef bsl::reverse_iterator<iterator>        reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>  const_reverse_iterator;
+
+    // CREATORS
+    SmallVector();
+    explicit SmallVector(bslma::Allocator *basicAllocator);
+        // Create an empty 'SmallVector' object.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied or is 0, the currently installed default allocator is
+        // used.  Note that no memory is allocated.
+
+    explicit SmallVector(bsl::size_t       initialSize,
+                         bslma::Allocator *basicAllocator = 0);
+        // Create a 'SmallVector' object holding the specified 'initialSize'
+        // default-constructed elements.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied or is 0, the currently installed default allocator is
+        // used.  Throw 'bsl::length_error' if 'initialSize > max_size()'.
+
+    SmallVector(bsl::size_t       initialSize,
+                const TYPE&       value,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a 'SmallVector' object holding the specified 'initialSize'
+        // copies of the specified 'value'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied or is 0, the currently installed default allocator is
+        // used.  Throw 'bsl::length_error' if 'initialSize > max_size()'.
+
+    template <class INPUT_ITERATOR>
+    SmallVector(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a 'SmallVector' object holding copies of the elements of the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied or is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless 'first'
+        // and 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last'.  Note that if 'INPUT_ITERATOR' is an
+        // integral type, this constructor behaves as
+        // 'SmallVector(size_t(first), TYPE(last), basicAllocator)'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    SmallVector(bsl::initializer_list<TYPE>  values,
+                bslma::Allocator            *basicAllocator = 0);
+        // Create a 'SmallVector' object holding copies of the specified
+        // 'values'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is not supplied or is 0, the currently
+        // installed default allocator is used.
+#endif
+
+    SmallVector(const SmallVector&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a 'SmallVector' object having the same value as the specified
+        // 'original' object.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not specified or is 0, the
+        // currently installed default allocator is used.
+
+    SmallVector(bslmf::MovableRef<SmallVector> original);
+        // Create a 'SmallVector' object having the same value and allocator as
+        // the specified 'original' object, and leave 'original' empty.  If
+        // the elements of 'original' are stored in allocated memory, that
+        // memory is transferred to this object in constant time; otherwise,
+        // each element is moved.
+
+    SmallVector(bslmf::MovableRef<SmallVector>  original,
+                bslma::Allocator               *basicAllocator);
+        // Create a 'SmallVector' object having the same value as the specified
+        // 'original' object, using the specified 'basicAllocator' to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  If 'basicAllocator' is the allocator of
+        // 'original', this constructor behaves as the constructor above;
+        // otherwise, each element is moved, and 'original' is left in a valid
+        // but unspecified state.
+
+    ~SmallVector();
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    SmallVector& operator=(const SmallVector& rhs);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    SmallVector& operator=(bslmf::MovableRef<SmallVector> rhs);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.  If
+        // both objects use the same allocator and the elements of 'rhs' are
+        // stored in allocated memory, that memory is transferred to this
+        // object in constant time; otherwise, each element is moved.  'rhs'
+        // is left in a valid but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    SmallVector& operator=(bsl::initializer_list<TYPE> values);
+        // Assign to this object copies of the specified 'values', and return
+        // a reference providing modifiable access to this object.
+#endif
+
+    template <class INPUT_ITERATOR>
+    void assign(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Assign to this vector copies of the elements of the range starting
+        // at the specified 'first' iterator and ending immediately before the
+        // specified 'last' iterator.  The behavior is undefined unless 'first'
+        // and 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last', and neither refers to an element of
+        // this vector.  Note that if 'INPUT_ITERATOR' is an integral type,
+        // this method behaves as 'assign(size_t(first), TYPE(last))'.
+
+    void assign(bsl::size_t numElements, const TYPE& value);
+        // Assign to this vector the specified 'numElements' copies of the
+        // specified 'value'.  Throw 'bsl::length_error' if
+        // 'numElements > max_size()'.  The behavior is undefined unless
+        // 'value' is not an element of this vector.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void assign(bsl::initializer_list<TYPE> values);
+        // Assign to this vector copies of the specified 'values'.
+#endif
+
+                                  // Iterators
+
+    iterator begin();
+        // Return an iterator to the first element of this vector, or the
+        // 'end' iterator if this vector is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this vector.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator to the last element of this vector, or
+        // the 'rend' iterator if this vector is empty.
+
+    reverse_iterator rend();
+        // Return the past-the-end reverse iterator of this vector.
+
+                                  // Element Access
+
+    reference operator[](bsl::size_t position);
+        // Return a reference providing modifiable access to the element at
+        // the specified 'position' in this vector.  The behavior is undefined
+        // unless 'position < size()'.
+
+    reference at(bsl::size_t position);
+        // Return a reference providing modifiable access to the element at
+        // the specified 'position' in this vector.  Throw
+        // 'bsl::out_of_range' if 'position >= size()'.
+
+    reference front();
+        // Return a reference providing modifiable access to the first element
+        // of this vector.  The behavior is undefined unless this vector is not
+        // empty.
+
+    reference back();
+        // Return a reference providing modifiable access to the last element
+        // of this vector.  The behavior is undefined unless this vector is not
+        // empty.
+
+    TYPE *data();
+        // Return the address of the modifiable first element of this vector.
+        // Note that '[data(), data() + size())' is a valid range.
+
+                                  // Capacity
+
+    void reserve(bsl::size_t newCapacity);
+        // Change the capacity of this vector, if necessary, so that at least
+        // the specified 'newCapacity' elements can be held without
+        // reallocation.  Throw 'bsl::length_error' if
+        // 'newCapacity > max_size()'.  If an exception is thrown, this vector
+        // is unchanged.
+
+    void resize(bsl::size_t newSize);
+        // Change the size of this vector to the specified 'newSize', erasing
+        // elements at the end if 'newSize < size()', and appending
+        // default-constructed elements if 'newSize > size()'.  Throw
+        // 'bsl::length_error' if 'newSize > max_size()'.
+
+    void resize(bsl::size_t newSize, const TYPE& value);
+        // Change the size of this vector to the specified 'newSize', erasing
+        // elements at the end if 'newSize < size()', and appending copies of
+        // the specified 'value' if 'newSize > size()'.  Throw
+        // 'bsl::length_error' if 'newSize > max_size()'.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this vector to its size, or to
+        // 'INLINE_CAPACITY' if the size is not greater, moving the elements
+        // to the inline buffer in the latter case.  If an exception is
+        // thrown, this vector is unchanged.
+
+                                  // Modifiers
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... ARGS>
+    reference emplace_back(ARGS&&... arguments);
+        // Append to this vector an element constructed by forwarding the
+        // allocator of this vector (if required) and the specified
+        // 'arguments' to the constructor of 'TYPE', and return a reference
+        // providing modifiable access to the new element.  If an exception is
+        // thrown, this vector is unchanged.
+
+    template <class... ARGS>
+    iterator emplace(const_iterator position, ARGS&&... arguments);
+        // Insert at the specified 'position' in this vector an element
+        // constructed by forwarding the allocator of this vector (if
+        // required) and the specified 'arguments' to the constructor of
+        // 'TYPE', and return an iterator to the new element.  The behavior is
+        // undefined unless 'position' is in the range '[begin(), end()]'.
+#endif
+
+    void push_back(const TYPE& value);
+    void push_back(bslmf::MovableRef<TYPE> value);
+        // Append to this vector a copy of the specified 'value', or 'value'
+        // itself (moved), leaving 'value' in a valid but unspecified state in
+        // the latter case.  If an exception is thrown, this vector is
+        // unchanged.  Note that 'value' may be an element of this vector.
+
+    void pop_back();
+        // Erase the last element of this vector.  The behavior is undefined
+        // unless this vector is not empty.
+
+    iterator insert(const_iterator position, const TYPE& value);
+    iterator insert(const_iterator position, bslmf::MovableRef<TYPE> value);
+        // Insert at the specified 'position' in this vector a copy of the
+        // specified 'value', or 'value' itself (moved), and return an
+        // iterator to the new element.  The behavior is undefined unless
+        // 'position' is in the range '[begin(), end()]'.  Note that a copied
+        // 'value' may be an element of this vector.
+
+    iterator insert(const_iterator position,
+                    bsl::size_t    numElements,
+                    const TYPE&    value);
+        // Insert at the specified 'position' in this vector the specified
+        // 'numElements' copies of the specified 'value', and return an
+        // iterator to the first new element, or 'position' if
+        // '0 == numElements'.  Throw 'bsl::length_error' if
+        // 'size() + numElements > max_size()'.  The behavior is undefined
+        // unless 'position' is in the range '[begin(), end()]'.  Note that
+        // 'value' may be an element of this vector.
+
+    template <class INPUT_ITERATOR>
+    iterator insert(const_iterator position,
+                    INPUT_ITERATOR first,
+                    INPUT_ITERATOR last);
+        // Insert at the specified 'position' in this vector copies of the
+        // elements of the range starting at the specified 'first' iterator
+        // and ending immediately before the specified 'last' iterator, and
+        // return an iterator to the first new element, or 'position' if the
+        // range is empty.  The behavior is undefined unless 'position' is in
+        // the range '[begin(), end()]', 'first' and 'last' refer to a
+        // sequence of valid values where 'first' is at a position at or
+        // before 'last', and neither refers to an element of this vector.
+        // Note that if 'INPUT_ITERATOR' is an integral type, this method
+        // behaves as 'insert(position, size_t(first), TYPE(last))'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    iterator insert(const_iterator              position,
+                    bsl::initializer_list<TYPE> values);
+        // Insert at the specified 'position' in this vector copies of the
+        // specified 'values', and return an iterator to the first new
+        // element, or 'position' if 'values' is empty.  The behavior is
+        // undefined unless 'position' is in the range '[begin(), end()]'.
+#endif
+
+    iterator erase(const_iterator position);
+        // Erase the element at the specified 'position' in this vector, and
+        // return an iterator to the element that followed it.  The behavior
+        // is undefined unless 'position' is in the range '[begin(), end())'.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Erase the elements starting at the specified 'first' position up
+        // to, but not including, the specified 'last' position, and return an
+        // iterator to the element that followed them.  The behavior is
+        // undefined unless 'begin() <= first <= last <= end()'.
+
+    void clear();
+        // Erase all elements of this vector.  Note that the capacity of this
+        // vector is retained.
+
+                                  // Aspects
+
+    void swap(SmallVector& other);
+        // Exchange the value of this object with that of the specified
+        // 'other' object.  If the elements of both vectors are stored in
+        // allocated memory, this method has constant complexity and provides
+        // the no-throw exception-safety guarantee; otherwise, the elements
+        // stored inline are moved.  The behavior is undefined unless this
+        // object was created with the same allocator as 'other'.
+
+    // ACCESSORS
+
+                                  // Iterators
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator to the first element of this vector, or the
+        // 'end' iterator if this vector is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this vector.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator to the last element of this vector, or
+        // the 'rend' iterator if this vector is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return the past-the-end reverse iterator of this vector.
+
+                                  // Element Access
+
+    const_reference operator[](bsl::size_t position) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'position' in this vector.  The behavior is
+        // undefined unless 'position < size()'.
+
+    const_reference at(bsl::size_t position) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'position' in this vector.  Throw
+        // 'bsl::out_of_range' if 'position >= size()'.
+
+    const_reference front() const;
+        // Return a reference providing non-modifiable access to the first
+        // element of this vector.  The behavior is undefined unless this
+        // vector is not empty.
+
+    const_reference back() const;
+        // Return a reference providing non-modifiable access to the last
+        // element of this vector.  The behavior is undefined unless this
+        // vector is not empty.
+
+    const TYPE *data() const;
+        // Return the address of the non-modifiable first element of this
+        // vector.  Note that '[data(), data() + size())' is a valid range.
+
+                                  // Capacity
+
+    bsl::size_t capacity() const;
+        // Return the number of elements this vector can hold without
+        // reallocation.  Note that the returned value is never less than
+        // 'INLINE_CAPACITY'.
+
+    bool empty() const;
+        // Return 'true' if this vector has no elements, and 'false'
+        // otherwise.
+
+    bool isInline() const;
+        // Return 'true' if the elements of this vector are stored in its
+        // inline buffer, and 'false' if they are stored in memory obtained
+        // from its allocator.
+
+    bsl::size_t max_size() const;
+        // Return the maximum possible size of this vector.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this vector.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this vector to supply memory.
+
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used by this vector to supply
+        // memory, as a 'bsl::allocator'.
+};
+
+// FREE OPERATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator==(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'SmallVector' objects have the same
+    // value if they have the same size and each element of one is equal to
+    // the element at the same position in the other.
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator!=(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'SmallVector' objects do not
+    // have the same value if they do not have the same size or an element of
+    // one is not equal to the element at the same position in the other.
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator<(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+               const SmallVector<TYPE, INLINE_CAPACITY>& rhs);
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator>(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+               const SmallVector<TYPE, INLINE_CAPACITY>& rhs);
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator<=(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY>& rhs);
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator>=(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY>& rhs);
+    // Return the result of lexicographically comparing the elements of the
+    // specified 'lhs' and 'rhs' objects using 'operator<' of 'TYPE'.
+
+// FREE FUNCTIONS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void swap(SmallVector<TYPE, INLINE_CAPACITY>& a,
+          SmallVector<TYPE, INLINE_CAPACITY>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  If the two
+    // objects were created with the same allocator, this function behaves as
+    // 'a.swap(b)'; otherwise, the exchange is made by copying and provides
+    // the basic exception-safety guarantee.
+
+template <class HASH_ALGORITHM, class TYPE, bsl::size_t INLINE_CAPACITY>
+void hashAppend(HASH_ALGORITHM&                           hashAlgorithm,
+                const SmallVector<TYPE, INLINE_CAPACITY>& object);
+    // Pass the size and the elements of the specified 'object' to the
+    // specified 'hashAlgorithm', in the same way as 'hashAppend' for
+    // 'bsl::vector'.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                       // --------------------------------
+                       // class SmallVector_CreatorProctor
+                       // --------------------------------
+
+// CREATORS
+template <class VECTOR>
+inline
+SmallVector_CreatorProctor<VECTOR>::SmallVector_CreatorProctor(VECTOR *vector)
+: d_vector_p(vector)
+{
+}
+
+template <class VECTOR>
+inline
+SmallVector_CreatorProctor<VECTOR>::~SmallVector_CreatorProctor()
+{
+    if (d_vector_p) {
+        d_vector_p->privateDestroy();
+    }
+}
+
+// MANIPULATORS
+template <class VECTOR>
+inline
+void SmallVector_CreatorProctor<VECTOR>::release()
+{
+    d_vector_p = 0;
+}
+
+                            // -----------------
+                            // class SmallVector
+                            // -----------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::privateAdopt(TYPE        *newBegin,
+                                                      bsl::size_t  newSize,
+                                                      bsl::size_t  newCapacity)
+{
+    if (!isInlineBuffer(d_begin_p)) {
+        allocator()->deallocate(d_begin_p);
+    }
+    d_begin_p  = newBegin;
+    d_end_p    = newBegin + newSize;
+    d_capacity = newCapacity;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE *SmallVector<TYPE, INLINE_CAPACITY>::privateAllocate(
+                                                       bsl::size_t numElements)
+{
+    return static_cast<TYPE *>(
+                           allocator()->allocate(numElements * sizeof(TYPE)));
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::privateAssign(
+                                                   bsl::size_t numElements,
+                                                   const TYPE& value,
+                                                   bsl::true_type)
+{
+    clear();
+    insert(d_end_p, numElements, value);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::privateAssign(INPUT_ITERATOR first,
+                                                       INPUT_ITERATOR last,
+                                                       bsl::false_type)
+{
+    clear();
+    privateInsert(d_end_p,
+                  first,
+                  last,
+                  typename bsl::iterator_traits<
+                                      INPUT_ITERATOR>::iterator_category());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::privateDestroy()
+{
+    ArrayDestructionPrimitives::destroy(d_begin_p, d_end_p);
+    if (!isInlineBuffer(d_begin_p)) {
+        allocator()->deallocate(d_begin_p);
+    }
+    privateResetToInline();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::privateInsertDispatch(
+                                                  const TYPE  *position,
+                                                  bsl::size_t  numElements,
+                                                  const TYPE&  value,
+                                                  bsl::true_type)
+{
+    insert(position, numElements, value);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::privateInsertDispatch(
+                                                const TYPE     *position,
+                                                INPUT_ITERATOR  first,
+                                                INPUT_ITERATOR  last,
+                                                bsl::false_type)
+{
+    privateInsert(position,
+                  first,
+                  last,
+                  typename bsl::iterator_traits<
+                                      INPUT_ITERATOR>::iterator_category());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+void SmallVector<TYPE, INLINE_CAPACITY>::privateInsert(
+                                   const TYPE                     *position,
+                                   INPUT_ITERATOR                  first,
+                                   INPUT_ITERATOR                  last,
+                                   const bsl::input_iterator_tag&)
+{
+    const bsl::size_t index   = position - d_begin_p;
+    const bsl::size_t oldSize = size();
+
+    for (; first != last; ++first) {
+        push_back(*first);
+    }
+
+    ArrayPrimitives::rotate(d_begin_p + index,
+                            d_begin_p + oldSize,
+                            d_end_p);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class FORWARD_ITERATOR>
+void SmallVector<TYPE, INLINE_CAPACITY>::privateInsert(
+                                 const TYPE                       *position,
+                                 FORWARD_ITERATOR                  first,
+                                 FORWARD_ITERATOR                  last,
+                                 const bsl::forward_iterator_tag&)
+{
+    TYPE              *pos         = const_cast<TYPE *>(position);
+    const bsl::size_t  numElements = bsl::distance(first, last);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                    numElements > max_size() - size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        bslstl::StdExceptUtil::throwLengthError(
+                      "SmallVector<...>::insert(pos,first,last): too long");
+    }
+
+    const bsl::size_t newSize = size() + numElements;
+
+    if (newSize > d_capacity) {
+        const bsl::size_t newCapacity = computeNewCapacity(newSize);
+        TYPE             *newBegin    = privateAllocate(newCapacity);
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(newBegin,
+                                                            allocator());
+
+        ArrayPrimitives::destructiveMoveAndInsert(newBegin,
+                                                  &d_end_p,
+                                                  d_begin_p,
+                                                  pos,
+                                                  d_end_p,
+                                                  first,
+                                                  last,
+                                                  numElements,
+                                                  d_allocator);
+
+        proctor.release();
+        privateAdopt(newBegin, newSize, newCapacity);
+    }
+    else {
+        ArrayPrimitives::insert(pos,
+                                d_end_p,
+                                first,
+                                last,
+                                numElements,
+                                d_allocator);
+        d_end_p += numElements;
+    }
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::privateMoveFrom(SmallVector *original)
+{
+    BSLS_ASSERT_SAFE(original);
+    BSLS_ASSERT_SAFE(isInlineBuffer(d_begin_p));
+    BSLS_ASSERT_SAFE(d_begin_p == d_end_p);
+
+    if (d_allocator == original->d_allocator) {
+        if (!original->isInline()) {
+            d_begin_p  = original->d_begin_p;
+            d_end_p    = original->d_end_p;
+            d_capacity = original->d_capacity;
+            original->privateResetToInline();
+            return;                                                   // RETURN
+        }
+
+        // The elements fit in the inline buffer, and keep their allocator.
+
+        ArrayPrimitives::destructiveMove(d_begin_p,
+                                         original->d_begin_p,
+                                         original->d_end_p,
+                                         d_allocator);
+        d_end_p           = d_begin_p + original->size();
+        original->d_end_p = original->d_begin_p;
+        return;                                                       // RETURN
+    }
+
+    const bsl::size_t numElements = original->size();
+
+    reserve(numElements);
+    ArrayPrimitives::moveConstruct(d_begin_p,
+                                   original->d_begin_p,
+                                   original->d_end_p,
+                                   d_allocator);
+    d_end_p = d_begin_p + numElements;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::privateResetToInline()
+{
+    d_begin_p  = reinterpret_cast<TYPE *>(d_inlineBuffer.buffer());
+    d_end_p    = d_begin_p;
+    d_capacity = INLINE_CAPACITY;
+}
+
+// PRIVATE ACCESSORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bsl::size_t SmallVector<TYPE, INLINE_CAPACITY>::computeNewCapacity(
+                                                     bsl::size_t newSize) const
+{
+    const bsl::size_t maxSize = max_size();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(newSize > maxSize)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        bslstl::StdExceptUtil::throwLengthError(
+                                          "SmallVector<...>: vector too long");
+    }
+
+    const bsl::size_t doubled = d_capacity > maxSize / 2
+                              ? maxSize
+                              : d_capacity * 2;
+
+    return doubled > newSize ? doubled : newSize;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool SmallVector<TYPE, INLINE_CAPACITY>::isInlineBuffer(
+                                                    const TYPE *buffer) const
+{
+    return reinterpret_cast<const TYPE *>(d_inlineBuffer.buffer()) == buffer;
+}
+
+// CREATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector()
+: d_allocator()
+{
+    privateResetToInline();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                              bslma::Allocator *basicAllocator)
+: d_allocator(basicAllocator)
+{
+    privateResetToInline();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                              bsl::size_t       initialSize,
+                                              bslma::Allocator *basicAllocator)
+: d_allocator(basicAllocator)
+{
+    privateResetToInline();
+
+    SmallVector_CreatorProctor<SmallVector> proctor(this);
+
+    resize(initialSize);
+
+    proctor.release();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                              bsl::size_t       initialSize,
+                                              const TYPE&       value,
+                                              bslma::Allocator *basicAllocator)
+: d_allocator(basicAllocator)
+{
+    privateResetToInline();
+
+    SmallVector_CreatorProctor<SmallVector> proctor(this);
+
+    insert(d_end_p, initialSize, value);
+
+    proctor.release();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bslma::Allocator *basicAllocator)
+: d_allocator(basicAllocator)
+{
+    privateResetToInline();
+
+    SmallVector_CreatorProctor<SmallVector> proctor(this);
+
+    privateInsertDispatch(d_end_p,
+                          first,
+                          last,
+                          typename bsl::is_integral<INPUT_ITERATOR>::type());
+
+    proctor.release();
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                   bsl::initializer_list<TYPE>  values,
+                                   bslma::Allocator            *basicAllocator)
+: d_allocator(basicAllocator)
+{
+    privateResetToInline();
+
+    SmallVector_CreatorProctor<SmallVector> proctor(this);
+
+    privateInsert(d_end_p,
+                  values.begin(),
+                  values.end(),
+                  bsl::random_access_iterator_tag());
+
+    proctor.release();
+}
+#endif
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                            const SmallVector&  original,
+                                            bslma::Allocator   *basicAllocator)
+: d_allocator(basicAllocator)
+{
+    privateResetToInline();
+
+    SmallVector_CreatorProctor<SmallVector> proctor(this);
+
+    privateInsert(d_end_p,
+                  original.d_begin_p,
+                  original.d_end_p,
+                  bsl::random_access_iterator_tag());
+
+    proctor.release();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                       bslmf::MovableRef<SmallVector> original)
+: d_allocator(MoveUtil::access(original).d_allocator)
+{
+    privateResetToInline();
+
+    privateMoveFrom(&MoveUtil::access(original));
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                               bslmf::MovableRef<SmallVector>  original,
+                               bslma::Allocator               *basicAllocator)
+: d_allocator(basicAllocator)
+{
+    privateResetToInline();
+
+    SmallVector_CreatorProctor<SmallVector> proctor(this);
+
+    privateMoveFrom(&MoveUtil::access(original));
+
+    proctor.release();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<TYPE, INLINE_CAPACITY>::~SmallVector()
+{
+    BSLS_ASSERT_SAFE(d_begin_p <= d_end_p);
+    BSLS_ASSERT_SAFE(size() <= d_capacity);
+    BSLS_ASSERT_SAFE(INLINE_CAPACITY <= d_capacity);
+
+    privateDestroy();
+}
+
+// MANIPULATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>&
+SmallVector<TYPE, INLINE_CAPACITY>::operator=(const SmallVector& rhs)
+{
+    if (this != &rhs) {
+        clear();
+        privateInsert(d_end_p,
+                      rhs.d_begin_p,
+                      rhs.d_end_p,
+                      bsl::random_access_iterator_tag());
+    }
+
+    return *this;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>&
+SmallVector<TYPE, INLINE_CAPACITY>::operator=(
+                                            bslmf::MovableRef<SmallVector> rhs)
+{
+    SmallVector& lvalue = rhs;
+
+    if (this == &lvalue) {
+        return *this;                                                 // RETURN
+    }
+
+    if (d_allocator == lvalue.d_allocator) {
+        privateDestroy();
+        privateMoveFrom(&lvalue);
+    }
+    else {
+        // Keep the buffer of this vector, since the elements must be moved
+        // one by one.
+
+        const bsl::size_t numElements = lvalue.size();
+
+        clear();
+        reserve(numElements);
+        ArrayPrimitives::moveConstruct(d_begin_p,
+                                       lvalue.d_begin_p,
+                                       lvalue.d_end_p,
+                                       d_allocator);
+        d_end_p = d_begin_p + numElements;
+    }
+
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<TYPE, INLINE_CAPACITY>&
+SmallVector<TYPE, INLINE_CAPACITY>::operator=(
+                                            bsl::initializer_list<TYPE> values)
+{
+    assign(values.begin(), values.end());
+
+    return *this;
+}
+#endif
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::assign(INPUT_ITERATOR first,
+                                                INPUT_ITERATOR last)
+{
+    privateAssign(first,
+                  last,
+                  typename bsl::is_integral<INPUT_ITERATOR>::type());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::assign(bsl::size_t numElements,
+                                                const TYPE& value)
+{
+    privateAssign(numElements, value, bsl::true_type());
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::assign(
+                                            bsl::initializer_list<TYPE> values)
+{
+    assign(values.begin(), values.end());
+}
+#endif
+
+                                  // Iterators
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::begin()
+{
+    return d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::end()
+{
+    return d_end_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::rbegin()
+{
+    return reverse_iterator(d_end_p);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::rend()
+{
+    return reverse_iterator(d_begin_p);
+}
+
+                                  // Element Access
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reference
+SmallVector<TYPE, INLINE_CAPACITY>::operator[](bsl::size_t position)
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_begin_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reference
+SmallVector<TYPE, INLINE_CAPACITY>::at(bsl::size_t position)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        bslstl::StdExceptUtil::throwOutOfRange(
+                                 "SmallVector<...>::at(position): invalid");
+    }
+
+    return d_begin_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reference
+SmallVector<TYPE, INLINE_CAPACITY>::front()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reference
+SmallVector<TYPE, INLINE_CAPACITY>::back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_end_p - 1);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE *SmallVector<TYPE, INLINE_CAPACITY>::data()
+{
+    return d_begin_p;
+}
+
+                                  // Capacity
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::reserve(bsl::size_t newCapacity)
+{
+    if (newCapacity <= d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(newCapacity > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        bslstl::StdExceptUtil::throwLengthError(
+                       "SmallVector<...>::reserve(newCapacity): too large");
+    }
+
+    const bsl::size_t  oldSize  = size();
+    TYPE              *newBegin = privateAllocate(newCapacity);
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(newBegin,
+                                                        allocator());
+
+    ArrayPrimitives::destructiveMove(newBegin,
+                                     d_begin_p,
+                                     d_end_p,
+                                     d_allocator);
+
+    proctor.release();
+    privateAdopt(newBegin, oldSize, newCapacity);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::resize(bsl::size_t newSize)
+{
+    const bsl::size_t oldSize = size();
+
+    if (newSize <= oldSize) {
+        erase(d_begin_p + newSize, d_end_p);
+        return;                                                       // RETURN
+    }
+
+    if (newSize > d_capacity) {
+        reserve(computeNewCapacity(newSize));
+    }
+
+    ArrayPrimitives::defaultConstruct(d_end_p,
+                                      newSize - oldSize,
+                                      d_allocator);
+    d_end_p = d_begin_p + newSize;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::resize(bsl::size_t newSize,
+                                                const TYPE& value)
+{
+    const bsl::size_t oldSize = size();
+
+    if (newSize <= oldSize) {
+        erase(d_begin_p + newSize, d_end_p);
+        return;                                                       // RETURN
+    }
+
+    insert(d_end_p, newSize - oldSize, value);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::shrink_to_fit()
+{
+    if (isInline()) {
+        return;                                                       // RETURN
+    }
+
+    const bsl::size_t oldSize = size();
+
+    if (oldSize <= INLINE_CAPACITY) {
+        TYPE *oldBegin = d_begin_p;
+        TYPE *inline_p = reinterpret_cast<TYPE *>(d_inlineBuffer.buffer());
+
+        ArrayPrimitives::destructiveMove(inline_p,
+                                         d_begin_p,
+                                         d_end_p,
+                                         d_allocator);
+
+        allocator()->deallocate(oldBegin);
+        d_begin_p  = inline_p;
+        d_end_p    = inline_p + oldSize;
+        d_capacity = INLINE_CAPACITY;
+        return;                                                       // RETURN
+    }
+
+    if (oldSize < d_capacity) {
+        TYPE *newBegin = privateAllocate(oldSize);
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(newBegin,
+                                                            allocator());
+
+        ArrayPrimitives::destructiveMove(newBegin,
+                                         d_begin_p,
+                                         d_end_p,
+                                         d_allocator);
+
+        proctor.release();
+        privateAdopt(newBegin, oldSize, oldSize);
+    }
+}
+
+                                  // Modifiers
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class... ARGS>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reference
+SmallVector<TYPE, INLINE_CAPACITY>::emplace_back(ARGS&&... arguments)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size() < d_capacity)) {
+        AllocatorTraits::construct(
+                            d_allocator,
+                            d_end_p,
+                            BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+        ++d_end_p;
+    }
+    else {
+        emplace(d_end_p, BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+    }
+
+    return *(d_end_p - 1);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class... ARGS>
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::emplace(const_iterator position,
+                                            ARGS&&...      arguments)
+{
+    BSLS_ASSERT_SAFE(d_begin_p <= position);
+    BSLS_ASSERT_SAFE(position  <= d_end_p);
+
+    const bsl::size_t  index = position - d_begin_p;
+    TYPE              *pos   = const_cast<TYPE *>(position);
+
+    if (size() == d_capacity) {
+        const bsl::size_t  newSize     = size() + 1;
+        const bsl::size_t  newCapacity = computeNewCapacity(newSize);
+        TYPE              *newBegin    = privateAllocate(newCapacity);
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(newBegin,
+                                                            allocator());
+
+        ArrayPrimitives::destructiveMoveAndEmplace(
+                            newBegin,
+                            &d_end_p,
+                            d_begin_p,
+                            pos,
+                            d_end_p,
+                            d_allocator,
+                            BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+
+        proctor.release();
+        privateAdopt(newBegin, newSize, newCapacity);
+    }
+    else {
+        ArrayPrimitives::emplace(
+                            pos,
+                            d_end_p,
+                            d_allocator,
+                            BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+        ++d_end_p;
+    }
+
+    return d_begin_p + index;
+}
+#endif
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::push_back(const TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size() < d_capacity)) {
+        AllocatorTraits::construct(d_allocator, d_end_p, value);
+        ++d_end_p;
+    }
+    else {
+        insert(d_end_p, 1, value);
+    }
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::push_back(
+                                                bslmf::MovableRef<TYPE> value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size() < d_capacity)) {
+        TYPE& lvalue = value;
+
+        AllocatorTraits::construct(d_allocator,
+                                   d_end_p,
+                                   MoveUtil::move(lvalue));
+        ++d_end_p;
+    }
+    else {
+        insert(d_end_p, MoveUtil::move(value));
+    }
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::pop_back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    --d_end_p;
+    AllocatorTraits::destroy(d_allocator, d_end_p);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(const_iterator position,
+                                           const TYPE&    value)
+{
+    return insert(position, 1, value);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(
+                                       const_iterator          position,
+                                       bslmf::MovableRef<TYPE> value)
+{
+    BSLS_ASSERT_SAFE(d_begin_p <= position);
+    BSLS_ASSERT_SAFE(position  <= d_end_p);
+
+    TYPE&              lvalue = value;
+    const bsl::size_t  index  = position - d_begin_p;
+    TYPE              *pos    = const_cast<TYPE *>(position);
+
+    if (size() == d_capacity) {
+        const bsl::size_t  newSize     = size() + 1;
+        const bsl::size_t  newCapacity = computeNewCapacity(newSize);
+        TYPE              *newBegin    = privateAllocate(newCapacity);
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(newBegin,
+                                                            allocator());
+
+        ArrayPrimitives::destructiveMoveAndEmplace(newBegin,
+                                                   &d_end_p,
+                                                   d_begin_p,
+                                                   pos,
+                                                   d_end_p,
+                                                   d_allocator,
+                                                   MoveUtil::move(lvalue));
+
+        proctor.release();
+        privateAdopt(newBegin, newSize, newCapacity);
+    }
+    else {
+        ArrayPrimitives::insert(pos,
+                                d_end_p,
+                                MoveUtil::move(lvalue),
+                                d_allocator);
+        ++d_end_p;
+    }
+
+    return d_begin_p + index;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(const_iterator position,
+                                           bsl::size_t    numElements,
+                                           const TYPE&    value)
+{
+    BSLS_ASSERT_SAFE(d_begin_p <= position);
+    BSLS_ASSERT_SAFE(position  <= d_end_p);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                    numElements > max_size() - size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        bslstl::StdExceptUtil::throwLengthError(
+                             "SmallVector<...>::insert(pos,n,v): too long");
+    }
+
+    const bsl::size_t  index   = position - d_begin_p;
+    const bsl::size_t  newSize = size() + numElements;
+    TYPE              *pos     = const_cast<TYPE *>(position);
+
+    if (newSize > d_capacity) {
+        const bsl::size_t  newCapacity = computeNewCapacity(newSize);
+        TYPE              *newBegin    = privateAllocate(newCapacity);
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(newBegin,
+                                                            allocator());
+
+        ArrayPrimitives::destructiveMoveAndInsert(newBegin,
+                                                  &d_end_p,
+                                                  d_begin_p,
+                                                  pos,
+                                                  d_end_p,
+                                                  value,
+                                                  numElements,
+                                                  d_allocator);
+
+        proctor.release();
+        privateAdopt(newBegin, newSize, newCapacity);
+    }
+    else {
+        ArrayPrimitives::insert(pos,
+                                d_end_p,
+                                value,
+                                numElements,
+                                d_allocator);
+        d_end_p += numElements;
+    }
+
+    return d_begin_p + index;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(const_iterator position,
+                                           INPUT_ITERATOR first,
+                                           INPUT_ITERATOR last)
+{
+    BSLS_ASSERT_SAFE(d_begin_p <= position);
+    BSLS_ASSERT_SAFE(position  <= d_end_p);
+
+    const bsl::size_t index = position - d_begin_p;
+
+    privateInsertDispatch(position,
+                          first,
+                          last,
+                          typename bsl::is_integral<INPUT_ITERATOR>::type());
+
+    return d_begin_p + index;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(
+                                        const_iterator              position,
+                                        bsl::initializer_list<TYPE> values)
+{
+    return insert(position, values.begin(), values.end());
+}
+#endif
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(d_begin_p <= position);
+    BSLS_ASSERT_SAFE(position  <  d_end_p);
+
+    return erase(position, position + 1);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::erase(const_iterator first,
+                                          const_iterator last)
+{
+    BSLS_ASSERT_SAFE(d_begin_p <= first);
+    BSLS_ASSERT_SAFE(first     <= last);
+    BSLS_ASSERT_SAFE(last      <= d_end_p);
+
+    const bsl::size_t numElements = last - first;
+
+    ArrayPrimitives::erase(const_cast<TYPE *>(first),
+                           const_cast<TYPE *>(last),
+                           d_end_p,
+                           d_allocator);
+    d_end_p -= numElements;
+
+    return const_cast<TYPE *>(first);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::clear()
+{
+    ArrayDestructionPrimitives::destroy(d_begin_p, d_end_p);
+    d_end_p = d_begin_p;
+}
+
+                                  // Aspects
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::swap(SmallVector& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(!isInline() &&
+                                            !other.isInline())) {
+        bslalg::SwapUtil::swap(&d_begin_p,  &other.d_begin_p);
+        bslalg::SwapUtil::swap(&d_end_p,    &other.d_end_p);
+        bslalg::SwapUtil::swap(&d_capacity, &other.d_capacity);
+        return;                                                       // RETURN
+    }
+
+    SmallVector tmp(MoveUtil::move(other));
+
+    other = MoveUtil::move(*this);
+    *this = MoveUtil::move(tmp);
+}
+
+// ACCESSORS
+
+                                  // Iterators
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::begin() const
+{
+    return d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::cbegin() const
+{
+    return d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::end() const
+{
+    return d_end_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::cend() const
+{
+    return d_end_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::rbegin() const
+{
+    return const_reverse_iterator(d_end_p);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::crbegin() const
+{
+    return const_reverse_iterator(d_end_p);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::rend() const
+{
+    return const_reverse_iterator(d_begin_p);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::crend() const
+{
+    return const_reverse_iterator(d_begin_p);
+}
+
+                                  // Element Access
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reference
+SmallVector<TYPE, INLINE_CAPACITY>::operator[](bsl::size_t position) const
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_begin_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reference
+SmallVector<TYPE, INLINE_CAPACITY>::at(bsl::size_t position) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        bslstl::StdExceptUtil::throwOutOfRange(
+                           "SmallVector<...>::at(position) const: invalid");
+    }
+
+    return d_begin_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reference
+SmallVector<TYPE, INLINE_CAPACITY>::front() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reference
+SmallVector<TYPE, INLINE_CAPACITY>::back() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_end_p - 1);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+const TYPE *SmallVector<TYPE, INLINE_CAPACITY>::data() const
+{
+    return d_begin_p;
+}
+
+                                  // Capacity
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bsl::size_t SmallVector<TYPE, INLINE_CAPACITY>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool SmallVector<TYPE, INLINE_CAPACITY>::empty() const
+{
+    return d_begin_p == d_end_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool SmallVector<TYPE, INLINE_CAPACITY>::isInline() const
+{
+    return isInlineBuffer(d_begin_p);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bsl::size_t SmallVector<TYPE, INLINE_CAPACITY>::max_size() const
+{
+    return bsl::numeric_limits<bsl::size_t>::max() / sizeof(TYPE);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bsl::size_t SmallVector<TYPE, INLINE_CAPACITY>::size() const
+{
+    return d_end_p - d_begin_p;
+}
+
+                                  // Aspects
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bslma::Allocator *SmallVector<TYPE, INLINE_CAPACITY>::allocator() const
+{
+    return d_allocator.mechanism();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::allocator_type
+SmallVector<TYPE, INLINE_CAPACITY>::get_allocator() const
+{
+    return d_allocator;
+}
+
+// FREE OPERATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool operator==(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY>& rhs)
+{
+    return lhs.size() == rhs.size()
+        && bsl::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool operator!=(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool operator<(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+               const SmallVector<TYPE, INLINE_CAPACITY>& rhs)
+{
+    return bsl::lexicographical_compare(lhs.begin(),
+                                        lhs.end(),
+                                        rhs.begin(),
+                                        rhs.end());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool operator>(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+               const SmallVector<TYPE, INLINE_CAPACITY>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool operator<=(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool operator>=(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void swap(SmallVector<TYPE, INLINE_CAPACITY>& a,
+          SmallVector<TYPE, INLINE_CAPACITY>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    typedef SmallVector<TYPE, INLINE_CAPACITY> Vector;
+
+    Vector futureA(b, a.allocator());
+    Vector futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+template <class HASH_ALGORITHM, class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void hashAppend(HASH_ALGORITHM&                           hashAlgorithm,
+                const SmallVector<TYPE, INLINE_CAPACITY>& object)
+{
+    using ::BloombergLP::bslh::hashAppend;
+
+    hashAppend(hashAlgorithm, object.size());
+    for (typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator it =
+                                                               object.begin();
+         it != object.end();
+         ++it) {
+        hashAppend(hashAlgorithm, *it);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
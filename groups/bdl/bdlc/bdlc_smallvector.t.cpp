@@ -0,0 +1,1492 @@
+// bdlc_smallvector.t.cpp                                             -*-C++-*-
+#include <bdlc_smallvector.h>
+
+#include <bslh_defaulthashalgorithm.h>
+#include <bslh_hash.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_sstream.h>
+#include <bsl_stdexcept.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bdlc::SmallVector' delegates the creation, relocation, and destruction of
+// its elements to 'bslalg::ArrayPrimitives', which is tested thoroughly in
+// its own component.  This test driver therefore concentrates on the
+// transitions between the inline buffer and allocated memory, on the use of
+// the allocator (in particular, that no memory is allocated while the size
+// does not exceed the inline capacity), on the propagation of the allocator
+// to the elements, and on exception neutrality at the transitions.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] SmallVector();
+// [ 2] SmallVector(Allocator *basicAllocator);
+// [ 2] SmallVector(size_t initialSize, Allocator *ba = 0);
+// [ 2] SmallVector(size_t initialSize, const TYPE& value, ba = 0);
+// [ 2] SmallVector(INPUT_ITERATOR first, INPUT_ITERATOR last, ba = 0);
+// [ 2] SmallVector(initializer_list<TYPE> values, ba = 0);
+// [ 4] SmallVector(const SmallVector& original, Allocator *ba = 0);
+// [ 4] SmallVector(MovableRef<SmallVector> original);
+// [ 4] SmallVector(MovableRef<SmallVector> original, Allocator *ba);
+// [ 2] ~SmallVector();
+//
+// MANIPULATORS
+// [ 4] SmallVector& operator=(const SmallVector& rhs);
+// [ 4] SmallVector& operator=(MovableRef<SmallVector> rhs);
+// [ 4] SmallVector& operator=(initializer_list<TYPE> values);
+// [ 3] void assign(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 3] void assign(size_t numElements, const TYPE& value);
+// [ 3] void assign(initializer_list<TYPE> values);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] reverse_iterator rbegin();
+// [ 2] reverse_iterator rend();
+// [ 2] reference operator[](size_t position);
+// [ 3] reference at(size_t position);
+// [ 2] reference front();
+// [ 2] reference back();
+// [ 2] TYPE *data();
+// [ 3] void reserve(size_t newCapacity);
+// [ 3] void resize(size_t newSize);
+// [ 3] void resize(size_t newSize, const TYPE& value);
+// [ 3] void shrink_to_fit();
+// [ 3] reference emplace_back(ARGS&&... arguments);
+// [ 3] iterator emplace(const_iterator position, ARGS&&... arguments);
+// [ 2] void push_back(const TYPE& value);
+// [ 3] void push_back(MovableRef<TYPE> value);
+// [ 3] void pop_back();
+// [ 3] iterator insert(const_iterator position, const TYPE& value);
+// [ 3] iterator insert(const_iterator position, MovableRef<TYPE> value);
+// [ 3] iterator insert(const_iterator, size_t, const TYPE&);
+// [ 3] iterator insert(const_iterator, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] iterator insert(const_iterator, initializer_list<TYPE>);
+// [ 3] iterator erase(const_iterator position);
+// [ 3] iterator erase(const_iterator first, const_iterator last);
+// [ 2] void clear();
+// [ 4] void swap(SmallVector& other);
+//
+// ACCESSORS
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_reverse_iterator rbegin() const;
+// [ 2] const_reverse_iterator crbegin() const;
+// [ 2] const_reverse_iterator rend() const;
+// [ 2] const_reverse_iterator crend() const;
+// [ 2] const_reference operator[](size_t position) const;
+// [ 3] const_reference at(size_t position) const;
+// [ 2] const_reference front() const;
+// [ 2] const_reference back() const;
+// [ 2] const TYPE *data() const;
+// [ 2] size_t capacity() const;
+// [ 2] bool empty() const;
+// [ 2] bool isInline() const;
+// [ 2] size_t max_size() const;
+// [ 2] size_t size() const;
+// [ 2] Allocator *allocator() const;
+// [ 2] bsl::allocator<TYPE> get_allocator() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const SmallVector& lhs, const SmallVector& rhs);
+// [ 4] bool operator!=(const SmallVector& lhs, const SmallVector& rhs);
+// [ 4] bool operator<(const SmallVector& lhs, const SmallVector& rhs);
+// [ 4] bool operator>(const SmallVector& lhs, const SmallVector& rhs);
+// [ 4] bool operator<=(const SmallVector& lhs, const SmallVector& rhs);
+// [ 4] bool operator>=(const SmallVector& lhs, const SmallVector& rhs);
+// [ 4] void swap(SmallVector& a, SmallVector& b);
+// [ 4] void hashAppend(HASH_ALGORITHM&, const SmallVector&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] EXCEPTION NEUTRALITY
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+                           // ====================
+                           // class CountedMovable
+                           // ====================
+
+class CountedMovable {
+    // This bit-wise movable class holds an integer value and counts the
+    // invocations of its copy constructor, so that a test can verify that
+    // relocating the elements of a vector does not invoke it.
+
+    // DATA
+    int d_value;  // held value
+
+  public:
+    // CLASS DATA
+    static int s_numCopies;  // number of copy constructions
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(CountedMovable, bslmf::IsBitwiseMoveable);
+
+    // CREATORS
+    explicit CountedMovable(int value = 0)
+    : d_value(value)
+    {
+    }
+
+    CountedMovable(const CountedMovable& original)
+    : d_value(original.d_value)
+    {
+        ++s_numCopies;
+    }
+
+    // MANIPULATORS
+    CountedMovable& operator=(const CountedMovable& rhs)
+    {
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    // ACCESSORS
+    int value() const
+    {
+        return d_value;
+    }
+};
+
+int CountedMovable::s_numCopies = 0;
+
+typedef bdlc::SmallVector<int, 4>          Obj;
+typedef bdlc::SmallVector<bsl::string, 3>  StrObj;
+
+typedef bslmf::MovableRefUtil              MoveUtil;
+
+const char *const LONG = "a string long enough to require an allocation: ";
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bool isSequence(const Obj& object, int first, int length)
+    // Return 'true' if the specified 'object' holds exactly the specified
+    // 'length' consecutive integers starting with the specified 'first', and
+    // 'false' otherwise.
+{
+    if (object.size() != static_cast<bsl::size_t>(length)) {
+        return false;                                                 // RETURN
+    }
+    for (int i = 0; i < length; ++i) {
+        if (object[i] != first + i) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bsl::string longString(int index)
+    // Return a string long enough to require an allocation, distinguished by
+    // the specified 'index'.  Note that the returned string uses the default
+    // allocator.
+{
+    return bsl::string(LONG) + char('A' + index % 26) + char('a' + index / 26);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Collecting Message Attributes
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose a messaging system attaches a handful of integer attributes to each
+// message, and that messages are created at a very high rate.  Very few
+// messages carry more than four attributes, so we use a 'SmallVector' with an
+// inline capacity of four, and the allocator is consulted only for the rare
+// message having more attributes.
+//
+// First, we create a test allocator to observe the allocations:
+//..
+    bslma::TestAllocator ta;
+//..
+// Then, we create a 'SmallVector' that uses the test allocator and append
+// three attributes to it:
+//..
+    bdlc::SmallVector<int, 4> attributes(&ta);
+
+    attributes.push_back(17);
+    attributes.push_back(42);
+    attributes.push_back(99);
+//..
+// Next, we verify that the attributes are stored inline, and that the
+// allocator has not been used:
+//..
+    ASSERT(3 == attributes.size());
+    ASSERT(attributes.isInline());
+    ASSERT(0 == ta.numBlocksTotal());
+//..
+// Then, we append two more attributes, exceeding the inline capacity:
+//..
+    attributes.push_back(3);
+    attributes.push_back(8);
+//..
+// Now, we observe that the elements have moved to allocated memory:
+//..
+    ASSERT(5 == attributes.size());
+    ASSERT(!attributes.isInline());
+    ASSERT(1 == ta.numBlocksInUse());
+//..
+// Finally, we remove the extra attributes and shrink the vector, which moves
+// the elements back to the inline buffer and releases the allocated memory:
+//..
+    attributes.resize(2);
+    attributes.shrink_to_fit();
+
+    ASSERT(attributes.isInline());
+    ASSERT(0  == ta.numBlocksInUse());
+    ASSERT(17 == attributes[0]);
+    ASSERT(42 == attributes[1]);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // EXCEPTION NEUTRALITY
+        //
+        // Concerns:
+        //: 1 If an allocation fails while the elements move from the inline
+        //:   buffer to allocated memory, the vector is unchanged and no memory
+        //:   is leaked.
+        //:
+        //: 2 If an allocation fails while a vector is constructed, no memory
+        //:   is leaked.
+        //
+        // Plan:
+        //: 1 Using the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros, grow
+        //:   vectors of 'bsl::string' across the inline capacity by
+        //:   'push_back', 'insert', and 'reserve', and construct vectors
+        //:   larger than the inline capacity; verify the value on failure and
+        //:   the absence of leaks.  (C-1..2)
+        //
+        // Testing:
+        //   EXCEPTION NEUTRALITY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXCEPTION NEUTRALITY" << endl
+                          << "====================" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        const bsl::string S0 = longString(0);
+        const bsl::string S1 = longString(1);
+        const bsl::string S2 = longString(2);
+        const bsl::string S3 = longString(3);
+
+        if (verbose) cout << "\tGrowing by 'push_back'." << endl;
+        {
+            StrObj mX(&sa);  const StrObj& X = mX;
+
+            mX.push_back(S0);
+            mX.push_back(S1);
+            mX.push_back(S2);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                ASSERT(3 == X.size());
+                ASSERT(X.isInline());
+
+                mX.push_back(S3);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(4 == X.size());
+            ASSERT(!X.isInline());
+            ASSERT(S0 == X[0]);
+            ASSERT(S3 == X[3]);
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\tGrowing by 'insert'." << endl;
+        {
+            StrObj mX(&sa);  const StrObj& X = mX;
+
+            mX.push_back(S0);
+            mX.push_back(S1);
+            mX.push_back(S2);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                ASSERT(3  == X.size());
+                ASSERT(S0 == X[0]);
+                ASSERT(S1 == X[1]);
+
+                mX.insert(X.begin() + 1, 2, S3);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(5  == X.size());
+            ASSERT(S0 == X[0]);
+            ASSERT(S3 == X[1]);
+            ASSERT(S3 == X[2]);
+            ASSERT(S1 == X[3]);
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\tGrowing by 'reserve'." << endl;
+        {
+            StrObj mX(&sa);  const StrObj& X = mX;
+
+            mX.push_back(S0);
+            mX.push_back(S1);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                ASSERT(3 == X.capacity());
+
+                mX.reserve(10);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(10 == X.capacity());
+            ASSERT(2  == X.size());
+            ASSERT(S1 == X[1]);
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\tConstructing." << endl;
+        {
+            StrObj mY(&sa);  const StrObj& Y = mY;
+
+            for (int i = 0; i < 6; ++i) {
+                mY.push_back(longString(i));
+            }
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                StrObj mX(Y, &sa);  const StrObj& X = mX;
+
+                ASSERT(Y == X);
+
+                StrObj mZ(6, S0, &sa);  const StrObj& Z = mZ;
+
+                ASSERT(6  == Z.size());
+                ASSERT(S0 == Z[5]);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, ASSIGNMENT, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 Copies have the value of the original and use the allocator
+        //:   supplied to them, or the default allocator.
+        //:
+        //: 2 Moves with the same allocator do not allocate; a move from
+        //:   allocated memory takes ownership of it, and a move from the
+        //:   inline buffer moves the elements.  Moves with a different
+        //:   allocator produce elements using that allocator.
+        //:
+        //: 3 Assignment (copy, move, and from an initializer list) gives the
+        //:   target the value of the source and retains the allocator of the
+        //:   target.
+        //:
+        //: 4 'swap' exchanges the values of the vectors, without allocating
+        //:   if they use the same allocator.
+        //:
+        //: 5 Equality and the relational operators compare the elements.
+        //:
+        //: 6 'hashAppend' hashes the value of the vector.
+        //
+        // Plan:
+        //: 1 Exercise each operation on vectors of 'bsl::string' having sizes
+        //:   below, at, and above the inline capacity, and verify the values
+        //:   and the allocators in use.  (C-1..4)
+        //:
+        //: 2 Compare vectors of 'int' differing in size and in values.
+        //:   (C-5..6)
+        //
+        // Testing:
+        //   SmallVector(const SmallVector& original, Allocator *ba = 0);
+        //   SmallVector(MovableRef<SmallVector> original);
+        //   SmallVector(MovableRef<SmallVector> original, Allocator *ba);
+        //   SmallVector& operator=(const SmallVector& rhs);
+        //   SmallVector& operator=(MovableRef<SmallVector> rhs);
+        //   SmallVector& operator=(initializer_list<TYPE> values);
+        //   void swap(SmallVector& other);
+        //   bool operator==(const SmallVector& lhs, const SmallVector& rhs);
+        //   bool operator!=(const SmallVector& lhs, const SmallVector& rhs);
+        //   bool operator<(const SmallVector& lhs, const SmallVector& rhs);
+        //   bool operator>(const SmallVector& lhs, const SmallVector& rhs);
+        //   bool operator<=(const SmallVector& lhs, const SmallVector& rhs);
+        //   bool operator>=(const SmallVector& lhs, const SmallVector& rhs);
+        //   void swap(SmallVector& a, SmallVector& b);
+        //   void hashAppend(HASH_ALGORITHM&, const SmallVector&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                  << "COPY, MOVE, ASSIGNMENT, SWAP, AND COMPARISON" << endl
+                  << "============================================" << endl;
+
+        const int SIZES[] = { 0, 1, 2, 3, 4, 5, 17 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N = SIZES[ti];
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+            bslma::TestAllocator oa("other",    veryVeryVeryVerbose);
+
+            StrObj mX(&sa);  const StrObj& X = mX;
+
+            for (int i = 0; i < N; ++i) {
+                mX.push_back(longString(i));
+            }
+
+            if (veryVerbose) { P_(N) P_(X.size()) P(X.isInline()) }
+
+            {
+                StrObj mY(X);  const StrObj& Y = mY;
+
+                ASSERTV(N, X == Y);
+                ASSERTV(N, !(X != Y));
+                ASSERTV(N, &defaultAllocator == Y.allocator());
+
+                StrObj mZ(X, &oa);  const StrObj& Z = mZ;
+
+                ASSERTV(N, X == Z);
+                ASSERTV(N, &oa == Z.allocator());
+
+                for (StrObj::const_iterator it = Z.begin();
+                     it != Z.end();
+                     ++it) {
+                    ASSERTV(N, &oa == it->allocator());
+                }
+            }
+            ASSERTV(N, 0 == oa.numBlocksInUse());
+            ASSERTV(N, 0 == defaultAllocator.numBlocksInUse());
+
+            {
+                StrObj mY(X, &sa);  const StrObj& Y = mY;
+
+                const bool isInline = Y.isInline();
+                const bsl::string *data = Y.data();
+
+                bslma::TestAllocatorMonitor sam(&sa);
+
+                StrObj mZ(MoveUtil::move(mY));  const StrObj& Z = mZ;
+
+                ASSERTV(N, sam.isTotalSame());
+                ASSERTV(N, X == Z);
+                ASSERTV(N, Y.empty());
+                ASSERTV(N, Y.isInline());
+                ASSERTV(N, &sa == Z.allocator());
+                ASSERTV(N, isInline == Z.isInline());
+                ASSERTV(N, isInline || data == Z.data());
+
+                StrObj mW(MoveUtil::move(mZ), &oa);  const StrObj& W = mW;
+
+                ASSERTV(N, X == W);
+                ASSERTV(N, &oa == W.allocator());
+
+                for (StrObj::const_iterator it = W.begin();
+                     it != W.end();
+                     ++it) {
+                    ASSERTV(N, &oa == it->allocator());
+                }
+
+                StrObj mV(MoveUtil::move(mW), &oa);  const StrObj& V = mV;
+
+                ASSERTV(N, X == V);
+                ASSERTV(N, W.empty());
+            }
+            ASSERTV(N, 0 == oa.numBlocksInUse());
+
+            {
+                StrObj mY(&oa);  const StrObj& Y = mY;
+
+                mY.push_back("x");
+
+                StrObj *mR = &(mY = X);
+
+                ASSERTV(N, mR == &mY);
+                ASSERTV(N, X == Y);
+                ASSERTV(N, &oa == Y.allocator());
+
+                mR = &(mY = Y);
+
+                ASSERTV(N, mR == &mY);
+                ASSERTV(N, X == Y);
+
+                StrObj mZ(X, &sa);
+
+                mY.push_back("x");
+                mR = &(mY = MoveUtil::move(mZ));
+
+                ASSERTV(N, mR == &mY);
+                ASSERTV(N, X == Y);
+                ASSERTV(N, &oa == Y.allocator());
+
+                for (StrObj::const_iterator it = Y.begin();
+                     it != Y.end();
+                     ++it) {
+                    ASSERTV(N, &oa == it->allocator());
+                }
+
+                StrObj mW(X, &oa);
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                mR = &(mY = MoveUtil::move(mW));
+
+                ASSERTV(N, mR == &mY);
+                ASSERTV(N, X == Y);
+                ASSERTV(N, oam.isTotalSame());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+                mR = &(mY = { bsl::string("a"), bsl::string("b") });
+
+                ASSERTV(N, mR == &mY);
+                ASSERTV(N, 2   == Y.size());
+                ASSERTV(N, "a" == Y[0]);
+                ASSERTV(N, "b" == Y[1]);
+                ASSERTV(N, &oa == Y.allocator());
+#endif
+            }
+            ASSERTV(N, 0 == oa.numBlocksInUse());
+
+            for (int tj = 0; tj < NUM_SIZES; ++tj) {
+                const int M = SIZES[tj];
+
+                StrObj mY(&sa);  const StrObj& Y = mY;
+
+                for (int i = 0; i < M; ++i) {
+                    mY.push_back(longString(100 + i));
+                }
+
+                const StrObj XX(X, &sa);
+                const StrObj YY(Y, &sa);
+
+                mX.swap(mY);
+
+                ASSERTV(N, M, XX == Y);
+                ASSERTV(N, M, YY == X);
+
+                swap(mX, mY);
+
+                ASSERTV(N, M, XX == X);
+                ASSERTV(N, M, YY == Y);
+
+                if (!X.isInline() && !Y.isInline()) {
+                    bslma::TestAllocatorMonitor sam(&sa);
+
+                    mX.swap(mY);
+                    mX.swap(mY);
+
+                    ASSERTV(N, M, sam.isTotalSame());
+                }
+
+                StrObj mZ(Y, &oa);  const StrObj& Z = mZ;
+
+                swap(mX, mZ);
+
+                ASSERTV(N, M, YY == X);
+                ASSERTV(N, M, XX == Z);
+                ASSERTV(N, M, &sa == X.allocator());
+                ASSERTV(N, M, &oa == Z.allocator());
+
+                swap(mX, mZ);
+
+                ASSERTV(N, M, XX == X);
+            }
+            ASSERTV(N, 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tComparing." << endl;
+        {
+            const int SPECS[][4] = {
+                { 0, 0, 0, 0 },  // empty
+                { 1, 1, 0, 0 },
+                { 2, 1, 2, 0 },
+                { 2, 1, 3, 0 },
+                { 3, 1, 2, 3 },
+                { 1, 2, 0, 0 },
+            };
+            const int NUM_SPECS =
+                               static_cast<int>(sizeof SPECS / sizeof *SPECS);
+
+            for (int ti = 0; ti < NUM_SPECS; ++ti) {
+                Obj mX;  const Obj& X = mX;
+                mX.insert(X.end(), SPECS[ti] + 1, SPECS[ti] + 1 + SPECS[ti][0]);
+
+                for (int tj = 0; tj < NUM_SPECS; ++tj) {
+                    Obj mY;  const Obj& Y = mY;
+                    mY.insert(Y.end(),
+                              SPECS[tj] + 1,
+                              SPECS[tj] + 1 + SPECS[tj][0]);
+
+                    const bsl::vector<int> VX(X.begin(), X.end());
+                    const bsl::vector<int> VY(Y.begin(), Y.end());
+
+                    ASSERTV(ti, tj, (VX == VY) == (X == Y));
+                    ASSERTV(ti, tj, (VX != VY) == (X != Y));
+                    ASSERTV(ti, tj, (VX <  VY) == (X <  Y));
+                    ASSERTV(ti, tj, (VX >  VY) == (X >  Y));
+                    ASSERTV(ti, tj, (VX <= VY) == (X <= Y));
+                    ASSERTV(ti, tj, (VX >= VY) == (X >= Y));
+
+                    bslh::Hash<> hasher;
+
+                    ASSERTV(ti, tj, (VX == VY) == (hasher(X) == hasher(Y)));
+                    ASSERTV(ti, tj, hasher(VX) == hasher(X));
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS
+        //
+        // Concerns:
+        //: 1 Each insertion method places the new elements at the requested
+        //:   position, whether or not the vector must grow, and returns an
+        //:   iterator to the first new element.
+        //:
+        //: 2 Insertion of a copy of an element of the vector itself is
+        //:   correct when the vector grows.
+        //:
+        //: 3 'erase', 'pop_back', and 'resize' remove the requested elements.
+        //:
+        //: 4 'reserve' and 'shrink_to_fit' change the capacity as documented,
+        //:   and 'shrink_to_fit' returns the elements to the inline buffer if
+        //:   they fit.
+        //:
+        //: 5 'at' throws 'bsl::out_of_range' for an invalid position.
+        //:
+        //: 6 Relocating elements of a bit-wise movable type does not invoke
+        //:   their copy constructor.
+        //
+        // Plan:
+        //: 1 Starting from vectors of every size up to twice the inline
+        //:   capacity, apply each manipulator at the front, the middle, and
+        //:   the end, and verify the resulting sequence.  (C-1)
+        //:
+        //: 2 Append and insert copies of 'front()' across the inline
+        //:   capacity.  (C-2)
+        //:
+        //: 3 Remove elements and verify the remaining sequence.  (C-3)
+        //:
+        //: 4 Observe 'capacity', 'isInline', and the allocator.  (C-4)
+        //:
+        //: 5 Call 'at' with an invalid position in a 'try' block.  (C-5)
+        //:
+        //: 6 Grow a vector of a bit-wise movable type that counts its copies.
+        //:   (C-6)
+        //
+        // Testing:
+        //   void assign(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void assign(size_t numElements, const TYPE& value);
+        //   void assign(initializer_list<TYPE> values);
+        //   reference at(size_t position);
+        //   void reserve(size_t newCapacity);
+        //   void resize(size_t newSize);
+        //   void resize(size_t newSize, const TYPE& value);
+        //   void shrink_to_fit();
+        //   reference emplace_back(ARGS&&... arguments);
+        //   iterator emplace(const_iterator position, ARGS&&... arguments);
+        //   void push_back(MovableRef<TYPE> value);
+        //   void pop_back();
+        //   iterator insert(const_iterator position, const TYPE& value);
+        //   iterator insert(const_iterator position, MovableRef<TYPE> value);
+        //   iterator insert(const_iterator, size_t, const TYPE&);
+        //   iterator insert(const_iterator, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   iterator insert(const_iterator, initializer_list<TYPE>);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   const_reference at(size_t position) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANIPULATORS" << endl
+                          << "============" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tInserting at every position." << endl;
+
+        for (int n = 0; n <= 8; ++n) {
+            for (int p = 0; p <= n; ++p) {
+                const int EXTRA[] = { 100, 101, 102 };
+
+                for (int k = 0; k <= 3; ++k) {
+                    Obj mX(&sa);  const Obj& X = mX;
+
+                    for (int i = 0; i < n; ++i) {
+                        mX.push_back(i);
+                    }
+
+                    Obj::iterator it = mX.insert(X.begin() + p,
+                                                 EXTRA,
+                                                 EXTRA + k);
+
+                    ASSERTV(n, p, k, X.begin() + p == it);
+                    ASSERTV(n, p, k, X.size() == static_cast<size_t>(n + k));
+
+                    for (int i = 0; i < n + k; ++i) {
+                        const int EXP = i < p     ? i
+                                      : i < p + k ? 100 + i - p
+                                      :             i - k;
+                        ASSERTV(n, p, k, i, EXP == X[i]);
+                    }
+
+                    ASSERTV(n, p, k,
+                            X.isInline() == (static_cast<int>(X.size()) <= 4)
+                         || n + k > 4);
+                }
+
+                {
+                    Obj mX(&sa);  const Obj& X = mX;
+
+                    for (int i = 0; i < n; ++i) {
+                        mX.push_back(i);
+                    }
+
+                    Obj::iterator it = mX.insert(X.begin() + p, 2, -1);
+
+                    ASSERTV(n, p, X.begin() + p == it);
+                    ASSERTV(n, p, -1 == X[p]);
+                    ASSERTV(n, p, -1 == X[p + 1]);
+                    ASSERTV(n, p, X.size() == static_cast<size_t>(n + 2));
+
+                    it = mX.insert(X.begin() + p, 7);
+
+                    ASSERTV(n, p, X.begin() + p == it);
+                    ASSERTV(n, p, 7 == X[p]);
+
+                    int value = 8;
+                    it = mX.insert(X.begin() + p, MoveUtil::move(value));
+
+                    ASSERTV(n, p, X.begin() + p == it);
+                    ASSERTV(n, p, 8 == X[p]);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+                    it = mX.emplace(X.begin() + p, 9);
+
+                    ASSERTV(n, p, X.begin() + p == it);
+                    ASSERTV(n, p, 9 == X[p]);
+                    ASSERTV(n, p, X.size() == static_cast<size_t>(n + 5));
+
+                    ASSERTV(n, p, 10 == mX.emplace_back(10));
+                    ASSERTV(n, p, 10 == X.back());
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+                    it = mX.insert(X.begin() + p, { 11, 12 });
+
+                    ASSERTV(n, p, X.begin() + p == it);
+                    ASSERTV(n, p, 11 == X[p]);
+                    ASSERTV(n, p, 12 == X[p + 1]);
+#endif
+                }
+            }
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\tInserting from an input range." << endl;
+        {
+            bsl::istringstream in("5 6 7 8 9", &sa);
+
+            Obj mX(&sa);  const Obj& X = mX;
+
+            mX.push_back(1);
+            mX.push_back(2);
+
+            Obj::iterator it = mX.insert(X.begin() + 1,
+                                         bsl::istream_iterator<int>(in),
+                                         bsl::istream_iterator<int>());
+
+            ASSERT(X.begin() + 1 == it);
+            ASSERT(7 == X.size());
+            ASSERT(1 == X[0]);
+            ASSERT(5 == X[1]);
+            ASSERT(9 == X[5]);
+            ASSERT(2 == X[6]);
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\tInserting copies of own elements." << endl;
+        {
+            StrObj mX(&sa);  const StrObj& X = mX;
+
+            mX.push_back(longString(0));
+            for (int i = 1; i < 10; ++i) {
+                mX.push_back(X.front());
+                mX.insert(X.begin(), X.back());
+                mX.insert(X.begin() + 1, 2, X[1]);
+            }
+
+            ASSERT(1 + 9 * 4 == X.size());
+            for (StrObj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERT(longString(0) == *it);
+                ASSERT(&sa == it->allocator());
+            }
+
+            mX.resize(3);
+            mX.resize(20, X[1]);
+
+            ASSERT(20 == X.size());
+            ASSERT(longString(0) == X[19]);
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\tMoving elements in." << endl;
+        {
+            StrObj mX(&sa);  const StrObj& X = mX;
+
+            for (int i = 0; i < 6; ++i) {
+                bsl::string s(longString(i), &sa);
+
+                bslma::TestAllocatorMonitor sam(&sa);
+
+                mX.push_back(MoveUtil::move(s));
+
+                ASSERTV(i, longString(i) == X.back());
+                ASSERTV(i, &sa == X.back().allocator());
+                ASSERTV(i, 3 != i || sam.isTotalUp());
+                ASSERTV(i, 3 == i || sam.isTotalSame());
+            }
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\tErasing." << endl;
+        {
+            Obj mX(&sa);  const Obj& X = mX;
+
+            for (int i = 0; i < 10; ++i) {
+                mX.push_back(i);
+            }
+
+            Obj::iterator it = mX.erase(X.begin());
+
+            ASSERT(X.begin() == it);
+            ASSERT(isSequence(X, 1, 9));
+
+            it = mX.erase(X.begin() + 2, X.begin() + 5);
+
+            ASSERT(X.begin() + 2 == it);
+            ASSERT(6 == X.size());
+            ASSERT(2 == X[1]);
+            ASSERT(6 == X[2]);
+
+            it = mX.erase(X.end() - 1);
+
+            ASSERT(X.end() == it);
+
+            mX.pop_back();
+
+            ASSERT(4 == X.size());
+            ASSERT(7 == X.back());
+
+            it = mX.erase(X.begin(), X.begin());
+
+            ASSERT(X.begin() == it);
+            ASSERT(4 == X.size());
+
+            mX.resize(1);
+
+            ASSERT(isSequence(X, 1, 1));
+
+            mX.resize(3);
+
+            ASSERT(3 == X.size());
+            ASSERT(0 == X[1]);
+            ASSERT(0 == X[2]);
+
+            mX.resize(6, 5);
+
+            ASSERT(6 == X.size());
+            ASSERT(5 == X[5]);
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\tAssigning." << endl;
+        {
+            const int DATA[] = { 3, 4, 5, 6, 7, 8 };
+
+            Obj mX(&sa);  const Obj& X = mX;
+
+            mX.assign(DATA, DATA + 6);
+
+            ASSERT(isSequence(X, 3, 6));
+
+            mX.assign(DATA, DATA + 2);
+
+            ASSERT(isSequence(X, 3, 2));
+
+            mX.assign(5, 9);
+
+            ASSERT(5 == X.size());
+            ASSERT(9 == X[4]);
+
+            mX.assign(static_cast<bsl::size_t>(2), 1);
+
+            ASSERT(2 == X.size());
+            ASSERT(1 == X[1]);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX.assign({ 6, 7, 8 });
+
+            ASSERT(isSequence(X, 6, 3));
+#endif
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\tManaging capacity." << endl;
+        {
+            bslma::TestAllocatorMonitor sam(&sa);
+
+            Obj mX(&sa);  const Obj& X = mX;
+
+            mX.reserve(3);
+
+            ASSERT(4 == X.capacity());
+            ASSERT(X.isInline());
+            ASSERT(sam.isTotalSame());
+
+            mX.push_back(0);
+            mX.push_back(1);
+            mX.reserve(20);
+
+            ASSERT(20 == X.capacity());
+            ASSERT(!X.isInline());
+            ASSERT(1 == sa.numBlocksInUse());
+            ASSERT(isSequence(X, 0, 2));
+
+            for (int i = 2; i < 7; ++i) {
+                mX.push_back(i);
+            }
+
+            mX.shrink_to_fit();
+
+            ASSERT(7 == X.capacity());
+            ASSERT(!X.isInline());
+            ASSERT(1 == sa.numBlocksInUse());
+            ASSERT(isSequence(X, 0, 7));
+
+            mX.shrink_to_fit();
+
+            ASSERT(7 == X.capacity());
+
+            mX.resize(4);
+            mX.shrink_to_fit();
+
+            ASSERT(4 == X.capacity());
+            ASSERT(X.isInline());
+            ASSERT(0 == sa.numBlocksInUse());
+            ASSERT(isSequence(X, 0, 4));
+
+            mX.push_back(4);
+            mX.clear();
+
+            ASSERT(X.empty());
+            ASSERT(!X.isInline());
+            ASSERT(8 <= X.capacity());
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\tChecking bounds." << endl;
+        {
+            Obj mX(&sa);  const Obj& X = mX;
+
+            mX.push_back(5);
+
+            ASSERT(5 == X.at(0));
+            mX.at(0) = 6;
+            ASSERT(6 == X.at(0));
+
+#if defined(BDE_BUILD_TARGET_EXC)
+            bool caught = false;
+            try {
+                X.at(1);
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                mX.at(4);
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+#endif
+        }
+
+        if (verbose) cout << "\tRelocating bit-wise movable elements."
+                          << endl;
+        {
+            ASSERT(bslmf::IsBitwiseMoveable<CountedMovable>::value);
+
+            bdlc::SmallVector<CountedMovable, 2> mX(&sa);
+
+            mX.push_back(CountedMovable(0));
+            mX.push_back(CountedMovable(1));
+
+            CountedMovable::s_numCopies = 0;
+
+            mX.reserve(16);
+            mX.shrink_to_fit();
+            mX.erase(mX.begin());
+
+            ASSERT(0 == CountedMovable::s_numCopies);
+            ASSERT(1 == mX.size());
+            ASSERT(1 == mX.front().value());
+            ASSERT(mX.isInline());
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a vector having the specified value and
+        //:   allocator, and passes the allocator to the elements.
+        //:
+        //: 2 No memory is allocated by the vector while its size does not
+        //:   exceed the inline capacity.
+        //:
+        //: 3 The accessors report the state of the vector, and the iterators
+        //:   traverse the elements in order.
+        //:
+        //: 4 The class has the 'bslma::UsesBslmaAllocator' and
+        //:   'bslalg::HasStlIterators' traits, and is not bit-wise movable.
+        //
+        // Plan:
+        //: 1 Create vectors of 'int' and of 'bsl::string' with each
+        //:   constructor and sizes below, at, and above the inline capacity,
+        //:   and verify their state and the allocations.  (C-1..3)
+        //:
+        //: 2 Verify the traits.  (C-4)
+        //
+        // Testing:
+        //   SmallVector();
+        //   SmallVector(Allocator *basicAllocator);
+        //   SmallVector(size_t initialSize, Allocator *ba = 0);
+        //   SmallVector(size_t initialSize, const TYPE& value, ba = 0);
+        //   SmallVector(INPUT_ITERATOR first, INPUT_ITERATOR last, ba = 0);
+        //   SmallVector(initializer_list<TYPE> values, ba = 0);
+        //   ~SmallVector();
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   reference operator[](size_t position);
+        //   reference front();
+        //   reference back();
+        //   TYPE *data();
+        //   void push_back(const TYPE& value);
+        //   void clear();
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_reverse_iterator crend() const;
+        //   const_reference operator[](size_t position) const;
+        //   const_reference front() const;
+        //   const_reference back() const;
+        //   const TYPE *data() const;
+        //   size_t capacity() const;
+        //   bool empty() const;
+        //   bool isInline() const;
+        //   size_t max_size() const;
+        //   size_t size() const;
+        //   Allocator *allocator() const;
+        //   bsl::allocator<TYPE> get_allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND ACCESSORS" << endl
+                          << "======================" << endl;
+
+        ASSERT( bslma::UsesBslmaAllocator<Obj>::value);
+        ASSERT( bslalg::HasStlIterators<Obj>::value);
+        ASSERT(!bslmf::IsBitwiseMoveable<Obj>::value);
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(X.empty());
+            ASSERT(X.isInline());
+            ASSERT(4 == X.capacity());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.cbegin() == X.cend());
+            ASSERT(X.rbegin() == X.rend());
+            ASSERT(X.crbegin() == X.crend());
+            ASSERT(0 < X.max_size());
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(&defaultAllocator == X.get_allocator().mechanism());
+        }
+
+        for (int n = 0; n <= 9; ++n) {
+            {
+                bslma::TestAllocatorMonitor sam(&sa);
+
+                Obj mX(&sa);  const Obj& X = mX;
+
+                for (int i = 0; i < n; ++i) {
+                    mX.push_back(i);
+
+                    ASSERTV(n, i, (i < 4) == X.isInline());
+                    ASSERTV(n, i, (i < 4) == sam.isTotalSame());
+                }
+
+                ASSERTV(n, isSequence(X, 0, n));
+                ASSERTV(n, &sa == X.allocator());
+                ASSERTV(n, X.size() <= X.capacity());
+
+                if (n) {
+                    ASSERTV(n, 0     == X.front());
+                    ASSERTV(n, n - 1 == X.back());
+                    ASSERTV(n, X.data() == &X[0]);
+                    ASSERTV(n, n - 1 == *X.rbegin());
+                    ASSERTV(n, n - 1 == *X.crbegin());
+                    ASSERTV(n, 0     == *(X.rend() - 1));
+                    ASSERTV(n, 0     == *(X.crend() - 1));
+
+                    mX.front() = -1;
+                    mX.back()  = -2;
+                    mX[0]     -= 1;
+
+                    ASSERTV(n, (1 == n ? -3 : -2) == X[0]);
+                    ASSERTV(n, (1 == n ? -3 : -2) == X[n - 1]);
+
+                    *mX.data() = 0;
+                    *mX.rbegin() = n - 1;
+                    ASSERTV(n, isSequence(X, 0, n));
+                    ASSERTV(n, mX.begin() == X.begin());
+                    ASSERTV(n, mX.end() == X.end());
+                    ASSERTV(n, 0 == *(mX.rend() - 1));
+                }
+
+                mX.clear();
+
+                ASSERTV(n, X.empty());
+            }
+            ASSERTV(n, 0 == sa.numBlocksInUse());
+
+            {
+                bslma::TestAllocatorMonitor sam(&sa);
+
+                Obj mX(static_cast<bsl::size_t>(n), &sa);  const Obj& X = mX;
+
+                ASSERTV(n, X.size() == static_cast<bsl::size_t>(n));
+                ASSERTV(n, (n <= 4) == X.isInline());
+                ASSERTV(n, (n <= 4) == sam.isTotalSame());
+
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, i, 0 == X[i]);
+                }
+            }
+            ASSERTV(n, 0 == sa.numBlocksInUse());
+
+            {
+                Obj mX(n, 7, &sa);  const Obj& X = mX;
+
+                ASSERTV(n, X.size() == static_cast<bsl::size_t>(n));
+                ASSERTV(n, (n <= 4) == X.isInline());
+
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, i, 7 == X[i]);
+                }
+            }
+            ASSERTV(n, 0 == sa.numBlocksInUse());
+
+            {
+                bsl::vector<int> source(&sa);
+
+                for (int i = 0; i < n; ++i) {
+                    source.push_back(i + 10);
+                }
+
+                bslma::TestAllocatorMonitor sam(&sa);
+
+                Obj mX(source.begin(), source.end(), &sa);
+                const Obj& X = mX;
+
+                ASSERTV(n, isSequence(X, 10, n));
+                ASSERTV(n, (n <= 4) == sam.isTotalSame());
+            }
+            ASSERTV(n, 0 == sa.numBlocksInUse());
+
+            {
+                StrObj mX(static_cast<bsl::size_t>(n),
+                          bsl::string(LONG),
+                          &sa);
+                const StrObj& X = mX;
+
+                ASSERTV(n, X.size() == static_cast<bsl::size_t>(n));
+
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, i, LONG == X[i]);
+                    ASSERTV(n, i, &sa == X[i].allocator());
+                }
+            }
+            ASSERTV(n, 0 == sa.numBlocksInUse());
+        }
+
+        {
+            bsl::istringstream in("3 4 5 6 7", &sa);
+
+            Obj mX(bsl::istream_iterator<int>(in),
+                   bsl::istream_iterator<int>(),
+                   &sa);
+            const Obj& X = mX;
+
+            ASSERT(isSequence(X, 3, 5));
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            bslma::TestAllocatorMonitor sam(&sa);
+
+            Obj mX({ 1, 2, 3 }, &sa);  const Obj& X = mX;
+
+            ASSERT(isSequence(X, 1, 3));
+            ASSERT(X.isInline());
+            ASSERT(sam.isTotalSame());
+
+            Obj mY({ 1, 2, 3, 4, 5 });  const Obj& Y = mY;
+
+            ASSERT(isSequence(Y, 1, 5));
+            ASSERT(&defaultAllocator == Y.allocator());
+        }
+#endif
+        ASSERT(0 == sa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a vector, append elements past its inline capacity,
+        //:   erase them, and compare copies.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&sa);  const Obj& X = mX;
+
+            ASSERT(X.empty());
+            ASSERT(X.isInline());
+
+            for (int i = 0; i < 4; ++i) {
+                mX.push_back(i);
+            }
+
+            ASSERT(4 == X.size());
+            ASSERT(X.isInline());
+            ASSERT(0 == sa.numBlocksTotal());
+
+            for (int i = 4; i < 100; ++i) {
+                mX.push_back(i);
+            }
+
+            ASSERT(isSequence(X, 0, 100));
+            ASSERT(!X.isInline());
+
+            Obj mY(X, &sa);  const Obj& Y = mY;
+
+            ASSERT(X == Y);
+
+            mX.erase(X.begin() + 4, X.end());
+
+            ASSERT(isSequence(X, 0, 4));
+            ASSERT(X != Y);
+
+            mX.shrink_to_fit();
+
+            ASSERT(X.isInline());
+            ASSERT(1 == sa.numBlocksInUse());
+        }
+
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -77,6 +77,14 @@ BSLS_IDENT("$Id: $")
 // call to the callback, invoking any operation on the cache that acquires a
 // lock inside the callback will lead to a deadlock.
 //
+///Heterogeneous Lookup
+///--------------------
+// If both the 'HASH' and 'EQUAL' types declare a nested 'is_transparent' type,
+// 'tryGetValue' and 'erase' additionally accept any key type that 'HASH' can
+// hash and 'EQUAL' can compare with 'KEY'.  A cache keyed on 'bsl::string' can
+// then be probed with a 'bslstl::StringRef' without constructing (and
+// possibly allocating) a temporary 'bsl::string' on every lookup.
+//
 ///Runtime Complexity
 ///------------------
 //..
@@ -300,7 +308,9 @@ BSLS_IDENT("$Id: $")
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_allocatorargt.h>
+#include <bslmf_enableif.h>
 #include <bslmf_integralconstant.h>
+#include <bslmf_istransparentpredicate.h>
 #include <bslmf_movableref.h>
 
 #include <bslmt_readerwritermutex.h>
@@ -447,6 +457,22 @@ class Cache {
         // 'size() < lowWatermark()' beginning from the front of the eviction
         // queue.  Invoke the post-eviction callback for each item evicted.
 
+    template <class LOOKUP_KEY>
+    int eraseImp(const LOOKUP_KEY& key);
+        // Remove the item having a key equivalent to the specified 'key' from
+        // this cache.  Invoke the post-eviction callback for the removed item.
+        // Return 0 on success and 1 if no such item exists.
+
+    template <class LOOKUP_KEY>
+    int tryGetValueImp(bsl::shared_ptr<VALUE> *value,
+                       const LOOKUP_KEY&       key,
+                       bool                    modifyEvictionQueue);
+        // Load, into the specified 'value', the value associated with a key
+        // equivalent to the specified 'key' in this cache.  If the specified
+        // 'modifyEvictionQueue' is 'true' and the eviction policy is LRU, then
+        // move the cached item to the back of the eviction queue.  Return 0 on
+        // success, and 1 if no such item exists.
+
     void evictItem(const typename MapType::iterator& mapIt);
         // Evict the item at the specified 'mapIt' and invoke the post-eviction
         // callback for that item.
@@ -535,6 +561,24 @@ class Cache {
         // the post-eviction callback for the removed item.  Return 0 on
         // success and 1 if 'key' does not exist.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        int>::type
+    erase(const LOOKUP_KEY& key)
+        // Remove the item having a key equivalent to the specified 'key' from
+        // this cache.  Invoke the post-eviction callback for the removed item.
+        // Return 0 on success and 1 if no such item exists.  Note that this
+        // overload participates in overload resolution only if both 'HASH'
+        // and 'EQUAL' are transparent (see {Heterogeneous Lookup}), and no
+        // 'KEY' object is created from 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return eraseImp(key);
+    }
+
     int eraseBulk(const bsl::vector<KEY>& keys);
         // Remove the items having the specified 'keys' from this cache.
         // Invoke the post-eviction callback for each removed item.  Return
@@ -595,6 +639,28 @@ class Cache {
         // success, and 1 if 'key' does not exist in this cache.  Note that a
         // write lock is acquired only if this queue is modified.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        int>::type
+    tryGetValue(bsl::shared_ptr<VALUE> *value,
+                const LOOKUP_KEY&       key,
+                bool                    modifyEvictionQueue = true)
+        // Load, into the specified 'value', the value associated with a key
+        // equivalent to the specified 'key' in this cache.  If the optionally
+        // specified 'modifyEvictionQueue' is 'true' and the eviction policy is
+        // LRU, then move the cached item to the back of the eviction queue.
+        // Return 0 on success, and 1 if no such item exists.  Note that this
+        // overload participates in overload resolution only if both 'HASH'
+        // and 'EQUAL' are transparent, and no 'KEY' object is created from
+        // 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return tryGetValueImp(value, key, modifyEvictionQueue);
+    }
+
     // ACCESSORS
     EQUAL equalFunction() const;
         // Return (a copy of) the key-equality functor used by this cache that
@@ -776,6 +842,21 @@ void Cache<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark()
     }
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
+int Cache<KEY, VALUE, HASH, EQUAL>::eraseImp(const LOOKUP_KEY& key)
+{
+    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
+
+    const typename MapType::iterator mapIt = d_map.find(key);
+    if (mapIt == d_map.end()) {
+        return 1;                                                     // RETURN
+    }
+
+    evictItem(mapIt);
+    return 0;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 void Cache<KEY, VALUE, HASH, EQUAL>::evictItem(
                                        const typename MapType::iterator& mapIt)
@@ -789,6 +870,47 @@ void Cache<KEY, VALUE, HASH, EQUAL>::evictItem(
         d_postEvictionCallback(value);
     }
 }
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
+int Cache<KEY, VALUE, HASH, EQUAL>::tryGetValueImp(
+                                   bsl::shared_ptr<VALUE> *value,
+                                   const LOOKUP_KEY&       key,
+                                   bool                    modifyEvictionQueue)
+{
+    int writeLock = d_evictionPolicy == CacheEvictionPolicy::e_LRU &&
+         modifyEvictionQueue ? 1 : 0;
+    if (writeLock) {
+        d_rwlock.lockWrite();
+    }
+    else {
+        d_rwlock.lockRead();
+    }
+
+    // Since the guard is constructed with a locked synchronization object, the
+    // guard's call to 'unlock' correctly handles both read and write
+    // scenarios.
+
+    bslmt::ReadLockGuard<LockType> guard(&d_rwlock, true);
+
+    typename MapType::iterator mapIt = d_map.find(key);
+    if (mapIt == d_map.end()) {
+        return 1;                                                     // RETURN
+    }
+
+    *value = mapIt->second.first;
+
+    if (writeLock) {
+        typename QueueType::iterator queueIt = mapIt->second.second;
+        typename QueueType::iterator last = d_queue.end();
+        --last;
+        if (last != queueIt) {
+            d_queue.splice(d_queue.end(), d_queue, queueIt);
+        }
+    }
+
+    return 0;
+}
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
@@ -912,17 +1034,10 @@ void Cache<KEY, VALUE, HASH, EQUAL>::clear()
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
 int Cache<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
 {
-    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
-
-    const typename MapType::iterator mapIt = d_map.find(key);
-    if (mapIt == d_map.end()) {
-        return 1;                                                     // RETURN
-    }
-
-    evictItem(mapIt);
-    return 0;
+    return eraseImp(key);
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -1090,43 +1205,13 @@ void Cache<KEY, VALUE, HASH, EQUAL>::setPostEvictionCallback(
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
 int Cache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
                                    bsl::shared_ptr<VALUE> *value,
                                    const KEY&              key,
                                    bool                    modifyEvictionQueue)
 {
-    int writeLock = d_evictionPolicy == CacheEvictionPolicy::e_LRU &&
-         modifyEvictionQueue ? 1 : 0;
-    if (writeLock) {
-        d_rwlock.lockWrite();
-    }
-    else {
-        d_rwlock.lockRead();
-    }
-
-    // Since the guard is constructed with a locked synchronization object, the
-    // guard's call to 'unlock' correctly handles both read and write
-    // scenarios.
-
-    bslmt::ReadLockGuard<LockType> guard(&d_rwlock, true);
-
-    typename MapType::iterator mapIt = d_map.find(key);
-    if (mapIt == d_map.end()) {
-        return 1;                                                     // RETURN
-    }
-
-    *value = mapIt->second.first;
-
-    if (writeLock) {
-        typename QueueType::iterator queueIt = mapIt->second.second;
-        typename QueueType::iterator last = d_queue.end();
-        --last;
-        if (last != queueIt) {
-            d_queue.splice(d_queue.end(), d_queue, queueIt);
-        }
-    }
-
-    return 0;
+    return tryGetValueImp(value, key, modifyEvictionQueue);
 }
 
 // ACCESSORS
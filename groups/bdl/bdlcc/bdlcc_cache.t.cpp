@@ -21,6 +21,8 @@
 
 #include <bslmf_issame.h>
 
+#include <bslstl_stringref.h>
+
 #include <bsltf_movestate.h>
 #include <bsltf_streamutil.h>
 #include <bsltf_templatetestfacility.h>
@@ -128,7 +130,8 @@ using namespace bsl;
 // [15] THREAD SAFETY
 // [16] LOCKING TEST UTIL
 // [17] LOCKING
-// [18] USAGE EXAMPLE
+// [19] CONCERN: heterogeneous lookup with transparent functors
+// [20] USAGE EXAMPLE
 // [-1] INSERT PERFORMANCE
 // [-2] INSERT BULK PERFORMANCE
 // [-3] READ PERFORMANCE
@@ -211,6 +214,44 @@ bool         veryVerbose;
 bool     veryVeryVerbose;
 bool veryVeryVeryVerbose;
 
+                        // ============================
+                        // struct TransparentStringHash
+                        // ============================
+
+struct TransparentStringHash {
+    // This 'struct' provides a transparent hash functor that hashes both
+    // 'bsl::string' and 'bslstl::StringRef' objects without creating a
+    // 'bsl::string'.
+
+    typedef void is_transparent;
+
+    bsl::size_t operator()(const bslstl::StringRef& key) const
+        // Return the hash of the specified 'key'.
+    {
+        return bsl::hash<bslstl::StringRef>()(key);
+    }
+};
+
+                        // =============================
+                        // struct TransparentStringEqual
+                        // =============================
+
+struct TransparentStringEqual {
+    // This 'struct' provides a transparent key-equality functor that compares
+    // 'bsl::string' and 'bslstl::StringRef' objects without creating a
+    // 'bsl::string'.
+
+    typedef void is_transparent;
+
+    bool operator()(const bslstl::StringRef& lhs,
+                    const bslstl::StringRef& rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' have the same value,
+        // and 'false' otherwise.
+    {
+        return lhs == rhs;
+    }
+};
+
 
 namespace usageExample1 {
 
@@ -4163,7 +4204,7 @@ int main(int argc, char *argv[])
 
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
-      case 19: {
+      case 20: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -4184,6 +4225,90 @@ int main(int argc, char *argv[])
         usageExample1::example1();
         usageExample2::example2();
       } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // HETEROGENEOUS LOOKUP
+        //
+        // Concerns:
+        //: 1 When 'HASH' and 'EQUAL' are transparent, 'tryGetValue' and
+        //:   'erase' accept a key of a type other than 'KEY'.
+        //:
+        //: 2 No 'KEY' object is created, so no memory is allocated, by a
+        //:   heterogeneous lookup.
+        //:
+        //: 3 A heterogeneous 'tryGetValue' updates the LRU eviction queue
+        //:   exactly as the 'KEY' overload does.
+        //
+        // Plan:
+        //: 1 Create a 'bsl::string'-keyed cache using transparent functors,
+        //:   populate it with keys too long for the short-string buffer, and
+        //:   look them up and erase them using 'bslstl::StringRef' keys,
+        //:   verifying the results and that neither the default nor the
+        //:   cache's allocator is used.  (C-1..2)
+        //:
+        //: 2 Touch the oldest item using a 'bslstl::StringRef', overflow the
+        //:   cache, and verify that the touched item was not evicted.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: heterogeneous lookup with transparent functors
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "HETEROGENEOUS LOOKUP\n"
+                          << "====================\n";
+
+        typedef bdlcc::Cache<bsl::string,
+                             int,
+                             TransparentStringHash,
+                             TransparentStringEqual> Obj;
+
+        const char *KEYS[] = {
+            "a key too long for the short string buffer 0",
+            "a key too long for the short string buffer 1",
+            "a key too long for the short string buffer 2",
+        };
+        enum { NUM_KEYS = sizeof KEYS / sizeof *KEYS };
+
+        bslma::TestAllocator         ta("test", veryVeryVeryVerbose);
+        bslma::TestAllocatorMonitor  tam(&ta);
+
+        {
+            Obj mX(bdlcc::CacheEvictionPolicy::e_LRU,
+                   NUM_KEYS,
+                   NUM_KEYS,
+                   &ta);
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                mX.insert(bsl::string(KEYS[i], &ta), i);
+            }
+
+            bslma::TestAllocatorMonitor  lam(&ta);
+            bsl::shared_ptr<int>         value;
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                ASSERTV(i, 0 == mX.tryGetValue(&value,
+                                               bslstl::StringRef(KEYS[i]),
+                                               false));
+                ASSERTV(i, i == *value);
+            }
+            ASSERT(1 == mX.tryGetValue(&value, bslstl::StringRef("none")));
+            ASSERT(lam.isTotalSame());
+            ASSERT(dam.isTotalSame());
+
+            // Make 'KEYS[0]' the most recently used, then evict one item.
+
+            ASSERT(0 == mX.tryGetValue(&value, bslstl::StringRef(KEYS[0])));
+            mX.insert(bsl::string("another key too long for the buffer", &ta),
+                      NUM_KEYS);
+            ASSERT(0 == mX.tryGetValue(&value, bslstl::StringRef(KEYS[0])));
+            ASSERT(1 == mX.tryGetValue(&value, bslstl::StringRef(KEYS[1])));
+
+            ASSERT(0 == mX.erase(bslstl::StringRef(KEYS[0])));
+            ASSERT(1 == mX.erase(bslstl::StringRef(KEYS[0])));
+            ASSERT(1 == mX.erase(bslstl::StringRef(KEYS[1])));
+            ASSERT(NUM_KEYS - 1 == static_cast<int>(mX.size()));
+            ASSERT(dam.isTotalSame());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
       // BDE_VERIFY pragma: -TP05 Defined in the various test functions
       case 18: {
         // --------------------------------------------------------------------
@@ -0,0 +1,1559 @@
+// bdlcc_shardedcache.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLCC_SHARDEDCACHE
+#define INCLUDED_BDLCC_SHARDEDCACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a sharded in-process cache with approximate-LRU eviction.
+//
+//@CLASSES:
+//  bdlcc::ShardedCache: sharded, concurrent in-process key-value cache
+//
+//@SEE_ALSO: bdlcc_cache, bdlcc_stripedunorderedmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlcc::ShardedCache', implementing a thread-safe in-memory key-value cache
+// intended for workloads where many threads concurrently look up values.  The
+// interface of 'bdlcc::ShardedCache' mirrors that of 'bdlcc::Cache': it uses
+// the same template parameters ('KEY', 'VALUE', and the optional 'HASH' and
+// 'EQUAL'), the same 'bdlcc::CacheEvictionPolicy' enumeration, the same low
+// and high watermark attributes, and the same post-eviction callback.
+//
+// 'bdlcc::Cache' protects its entire state with a single reader-writer lock
+// and, under the LRU policy, needs a *write* lock on every successful lookup
+// to move the accessed item to the back of its eviction queue.  It also
+// allocates a list node and a hash-table node for every inserted item.
+// 'bdlcc::ShardedCache' removes both of these costs:
+//
+//: o The cache is partitioned into a power-of-two number of independent
+//:   shards (see 'numShards'), each having its own reader-writer lock, hash
+//:   table, and eviction queue.  An item is assigned to a shard using the low
+//:   bits of the hash value of its key, so operations on different shards do
+//:   not contend.
+//:
+//: o 'tryGetValue' acquires only a *read* lock on a single shard, regardless
+//:   of the eviction policy.  Under the LRU policy, a successful lookup merely
+//:   sets an atomic "referenced" flag on the item (only if it is not already
+//:   set, so that frequently accessed items do not cause cache-line
+//:   ping-pong).
+//:
+//: o Items are stored in per-shard arrays of entries that are allocated in
+//:   chunks and recycled through a free list, and indexed by an
+//:   open-addressing hash table.  Once a shard has reached its steady-state
+//:   size, inserting and evicting items performs no memory allocation (other
+//:   than that performed by copying the 'KEY' and by the 'insert' overloads
+//:   that create a 'VALUE').
+//
+///Eviction Policies
+///-----------------
+// Under the FIFO policy, each shard evicts its items in exactly the order in
+// which they were inserted.
+//
+// Under the LRU policy, each shard implements the CLOCK ("second chance")
+// approximation of LRU: when an item is selected for eviction from the front
+// of the eviction queue and its referenced flag is set, the flag is cleared
+// and the item is moved to the back of the queue instead of being evicted.
+// Consequently, an item that was accessed (via 'tryGetValue' with
+// 'modifyEvictionQueue' set to 'true') since it was last considered for
+// eviction survives one more round of eviction.  As with 'bdlcc::Cache',
+// re-inserting an existing key moves the item to the back of its queue.
+//
+///Watermarks
+///----------
+// Watermarks are enforced independently in each shard.  The low and high
+// watermarks supplied at construction are divided among the shards, each
+// shard receiving the quotient of the division and the remainder being
+// spread, one item at a time, over the first shards, so that the shares of
+// the high watermark add up to 'highWatermark()'.  A shard starts evicting
+// its own items on insertion when its size reaches its share of the high
+// watermark, stopping when its size falls below its share of the low
+// watermark (or of 1, if greater).  As a result, the total size of the cache
+// never exceeds 'highWatermark()', and eviction may begin before the total
+// size reaches 'highWatermark()' if keys are not evenly distributed among
+// shards.  Note that a shard whose share of the high watermark is 0 (when
+// 'highWatermark() < numShards()') holds no items: an item inserted into it
+// is evicted immediately.  A cache constructed with a single shard enforces
+// the watermarks exactly as 'bdlcc::Cache' does.
+//
+///Thread Safety
+///-------------
+// The 'bdlcc::ShardedCache' class template is fully thread-safe (see
+// 'bsldoc_glossary') provided that the allocator supplied at construction and
+// the default allocator in effect during the lifetime of cached items are both
+// fully thread-safe.
+//
+///Thread Contention
+///-----------------
+// Lookups ('tryGetValue') acquire a read lock on one shard and therefore
+// never block one another.  Modifiers ('insert', 'erase', 'popFront') acquire
+// a write lock on the single shard holding the affected item.  'insertBulk'
+// and 'eraseBulk' lock the affected shard separately for each item, so they
+// are not atomic with respect to other threads.  'clear',
+// 'setPostEvictionCallback', 'size', and 'visit' lock each shard in turn.
+//
+///Post-eviction Callback and Potential Deadlocks
+///---------------------------------------------
+// When an item is evicted or erased from the cache, the previously set
+// post-eviction callback (via the 'setPostEvictionCallback' method) will be
+// invoked within the calling thread, supplying a pointer to the item being
+// removed.  A write lock on the item's shard is held during the call to the
+// callback; therefore, the cache object itself should not be used in a
+// post-eviction callback, or a deadlock may result.
+//
+///Runtime Complexity
+///------------------
+//..
+// +----------------------------------------------------+--------------------+
+// | Operation                                          | Complexity         |
+// +====================================================+====================+
+// | insert                                             | Average: O[1]      |
+// |                                                    | Worst:   O[n]      |
+// +----------------------------------------------------+--------------------+
+// | tryGetValue                                        | Average: O[1]      |
+// +----------------------------------------------------+--------------------+
+// | popFront                                           | Average: O[1]      |
+// +----------------------------------------------------+--------------------+
+// | erase                                              | Average: O[1]      |
+// +----------------------------------------------------+--------------------+
+// | visit                                              | O[n]               |
+// +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Reference-Data Cache
+///- - - - - - - - - - - - - - - - -
+// Suppose we maintain a cache of reference data, keyed by security
+// identifier, that is read by many threads and occasionally refreshed.
+//
+// First, we define a sharded cache mapping 'int' to 'bsl::string' that uses
+// the LRU eviction policy and holds roughly 1000 items, spread over 8 shards:
+//..
+//  bdlcc::ShardedCache<int, bsl::string> cache(
+//                                          bdlcc::CacheEvictionPolicy::e_LRU,
+//                                          900,
+//                                          1000,
+//                                          8,
+//                                          &talloc);
+//  assert(8 == cache.numShards());
+//..
+// Next, we populate the cache:
+//..
+//  for (int i = 0; i < 100; ++i) {
+//      cache.insert(i, bsl::string("security"));
+//  }
+//  assert(100 == cache.size());
+//..
+// Now, any number of threads may look up values concurrently, each taking
+// only a read lock on the shard holding the requested key:
+//..
+//  bsl::shared_ptr<bsl::string> value;
+//  int rc = cache.tryGetValue(&value, 42);
+//  assert(0 == rc);
+//  assert("security" == *value);
+//
+//  rc = cache.tryGetValue(&value, 1042);
+//  assert(1 == rc);
+//..
+// Finally, we remove an item, which invokes the post-eviction callback (if
+// one has been set):
+//..
+//  rc = cache.erase(42);
+//  assert(0  == rc);
+//  assert(99 == cache.size());
+//..
+
+#include <bdlcc_cache.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_allocatorargt.h>
+#include <bslmf_integralconstant.h>
+#include <bslmf_movableref.h>
+
+#include <bslmt_platform.h>
+#include <bslmt_readerwritermutex.h>
+#include <bslmt_readlockguard.h>
+#include <bslmt_writelockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_review.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>            // 'bsl::size_t'
+#include <bsl_functional.h>
+#include <bsl_limits.h>
+#include <bsl_memory.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                         // ========================
+                         // class ShardedCache_Entry
+                         // ========================
+
+template <class KEY, class VALUE>
+struct ShardedCache_Entry {
+    // This component-private 'struct' describes a slot in the entry array of
+    // a 'ShardedCache_Shard'.  A slot is either in use, in which case 'd_key'
+    // holds a constructed key and the slot is linked into the eviction queue
+    // of the shard, or free, in which case 'd_next' links it into the free
+    // list of the shard.
+
+    // DATA
+    bsls::ObjectBuffer<KEY> d_key;         // key (constructed only if in use)
+
+    bsl::shared_ptr<VALUE>  d_value;       // value (empty if free)
+
+    bsl::size_t             d_hash;        // hash value of 'd_key'
+
+    int                     d_prev;        // previous slot in the eviction
+                                           // queue, or -1
+
+    int                     d_next;        // next slot in the eviction queue
+                                           // or the free list, or -1
+
+    bsls::AtomicBool        d_referenced;  // 'true' if accessed since last
+                                           // considered for LRU eviction
+
+    // CREATORS
+    ShardedCache_Entry();
+        // Create a free slot.
+};
+
+                         // ========================
+                         // class ShardedCache_Shard
+                         // ========================
+
+template <class KEY, class VALUE>
+class ShardedCache_Shard {
+    // This component-private class holds the state of one shard of a
+    // 'ShardedCache': a lock, an array of entries allocated in chunks of
+    // 'k_CHUNK_SIZE', an intrusive doubly-linked eviction queue threaded
+    // through the in-use entries, a free list of unused entries, and an
+    // open-addressing (linear probing) index mapping hash values to entries.
+    // All data members are manipulated directly by 'ShardedCache'.
+
+  public:
+    // PUBLIC TYPES
+    typedef ShardedCache_Entry<KEY, VALUE>                   Entry;
+
+    typedef bsl::function<void(const bsl::shared_ptr<VALUE>&)>
+                                                          PostEvictionCallback;
+
+    enum {
+        k_CHUNK_SHIFT      = 6,                   // log2 of entries per chunk
+        k_CHUNK_SIZE       = 1 << k_CHUNK_SHIFT,  // entries per chunk
+        k_MIN_INDEX_SIZE   = 16                   // initial size of 'd_index'
+    };
+
+    // PUBLIC DATA
+    mutable bslmt::ReaderWriterMutex  d_rwlock;      // guards this shard
+
+    bsl::vector<Entry *>              d_chunks;      // entry storage
+
+    bsl::vector<int>                  d_index;       // hash index of entry
+                                                     // numbers, -1 if empty;
+                                                     // size is a power of 2
+
+    int                               d_freeList;    // first free entry, or -1
+
+    int                               d_head;        // front of eviction
+                                                     // queue, or -1
+
+    int                               d_tail;        // back of eviction
+                                                     // queue, or -1
+
+    bsl::size_t                       d_size;        // number of items
+
+    bsl::size_t                       d_lowWatermark;
+                                                     // share of the low
+                                                     // watermark of the cache
+
+    bsl::size_t                       d_highWatermark;
+                                                     // share of the high
+                                                     // watermark of the cache
+
+    PostEvictionCallback              d_postEvictionCallback;
+                                                     // copy of the cache's
+                                                     // callback
+
+    bslma::Allocator                 *d_allocator_p; // memory allocator (held,
+                                                     // not owned)
+
+    char                              d_pad[
+                                         bslmt::Platform::e_CACHE_LINE_SIZE];
+                                                     // padding to prevent
+                                                     // false sharing
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache_Shard(const ShardedCache_Shard&);
+    ShardedCache_Shard& operator=(const ShardedCache_Shard&);
+
+  public:
+    // CREATORS
+    explicit ShardedCache_Shard(bslma::Allocator *basicAllocator);
+        // Create an empty shard using the specified 'basicAllocator' to
+        // supply memory.
+
+    ~ShardedCache_Shard();
+        // Destroy this object.
+
+    // MANIPULATORS
+    Entry& entry(int index);
+        // Return a reference providing modifiable access to the entry having
+        // the specified 'index'.
+
+    void linkBack(int index);
+        // Append the entry having the specified 'index' to the back of the
+        // eviction queue.
+
+    void removeAll();
+        // Destroy the key and release the value of every in-use entry, and
+        // return all entries to the free list.  Do not release memory.
+
+    int reserveEntry();
+        // Return the index of a free entry, allocating a new chunk of entries
+        // if the free list is empty, without removing the entry from the free
+        // list.
+
+    void unlink(int index);
+        // Remove the entry having the specified 'index' from the eviction
+        // queue.
+
+    // ACCESSORS
+    const Entry& entry(int index) const;
+        // Return a reference providing non-modifiable access to the entry
+        // having the specified 'index'.
+};
+
+                            // ==================
+                            // class ShardedCache
+                            // ==================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class ShardedCache {
+    // This class represents an in-process key-value store, partitioned into
+    // independently locked shards, supporting the LRU (approximated by CLOCK)
+    // and FIFO eviction policies.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::shared_ptr<VALUE>                            ValuePtrType;
+        // Shared pointer type pointing to value type.
+
+    typedef bsl::function<void(const ValuePtrType&)> PostEvictionCallback;
+        // Type of function to call after an item has been evicted from the
+        // cache.
+
+    typedef bsl::pair<KEY, ValuePtrType>                          KVType;
+        // Value type of a bulk insert entry.
+
+    enum {
+        k_DEFAULT_NUM_SHARDS = 16  // default number of shards
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef ShardedCache_Shard<KEY, VALUE>                        Shard;
+    typedef typename Shard::Entry                                 Entry;
+    typedef bslmt::ReaderWriterMutex                              LockType;
+
+    // DATA
+    bslma::Allocator          *d_allocator_p;     // memory allocator (held,
+                                                  // not owned)
+
+    bsl::vector<Shard *>       d_shards;          // shards (owned)
+
+    bsl::size_t                d_shardMask;       // 'numShards() - 1'
+
+    int                        d_shardBits;       // log2 of 'numShards()'
+
+    HASH                       d_hashFunction;    // hash functor
+
+    EQUAL                      d_equalFunction;   // equality functor
+
+    CacheEvictionPolicy::Enum  d_evictionPolicy;  // eviction policy
+
+    bsl::size_t                d_lowWatermark;    // the size of this cache
+                                                  // when eviction stops
+
+    bsl::size_t                d_highWatermark;   // the size of this cache
+                                                  // when eviction starts
+                                                  // after an insert
+
+    bsls::AtomicUint           d_nextPopShard;    // shard at which the next
+                                                  // 'popFront' starts
+
+    // PRIVATE CLASS METHODS
+    static bool isCyclicallyBetween(bsl::size_t position,
+                                    bsl::size_t first,
+                                    bsl::size_t last);
+        // Return 'true' if the specified 'position' lies in the cyclic range
+        // '(first .. last]', and 'false' otherwise.
+
+    // PRIVATE MANIPULATORS
+    void enforceHighWatermark(Shard *shard);
+        // Evict items from the specified 'shard' if its size is at least the
+        // per-shard high watermark until its size is less than the per-shard
+        // low watermark.  Invoke the post-eviction callback for each item
+        // evicted.  The behavior is undefined unless the calling thread holds
+        // a write lock on 'shard'.
+
+    void evictEntry(Shard *shard, bsl::size_t position);
+        // Evict the item referred to by the specified 'position' in the index
+        // of the specified 'shard', and invoke the post-eviction callback for
+        // that item.  The behavior is undefined unless the calling thread
+        // holds a write lock on 'shard'.
+
+    int evictFront(Shard *shard);
+        // Evict the first item in the eviction queue of the specified 'shard'
+        // that is not referenced, clearing the referenced flag of (and moving
+        // to the back of the queue) each referenced item at the front.  Return
+        // 0 on success, and 1 if 'shard' is empty.  The behavior is undefined
+        // unless the calling thread holds a write lock on 'shard'.
+
+    void growIndexIfNeeded(Shard *shard);
+        // Double the size of the index of the specified 'shard' if inserting
+        // one more item would make it more than half full.  The behavior is
+        // undefined unless the calling thread holds a write lock on 'shard'.
+
+    bool insertValuePtrMoveImp(KEY          *key_p,
+                               bool          moveKey,
+                               ValuePtrType *valuePtr_p,
+                               bool          moveValuePtr);
+        // Add an item with the specified '*key_p' and the specified
+        // '*valuePtr_p' to the cache.  If an item already exists for '*key_p',
+        // override its value with '*valuePtr_p'.  If the specified 'moveKey'
+        // is 'true', move '*key_p', and if the specified 'moveValuePtr' is
+        // 'true', move '*valuePtr_p'.  Return 'true' if '*key_p' was not
+        // previously in the cache and 'false' otherwise.  Note that this
+        // method acquires the write lock on the appropriate shard.
+
+    void populateValuePtrType(ValuePtrType             *dst,
+                              const VALUE&              value,
+                              bsl::true_type);
+    void populateValuePtrType(ValuePtrType             *dst,
+                              const VALUE&              value,
+                              bsl::false_type);
+    void populateValuePtrType(ValuePtrType             *dst,
+                              bslmf::MovableRef<VALUE>  value,
+                              bsl::true_type);
+    void populateValuePtrType(ValuePtrType             *dst,
+                              bslmf::MovableRef<VALUE>  value,
+                              bsl::false_type);
+        // Allocate a footprint for the specified 'value', copy or move 'value'
+        // into the footprint and load the specified '*dst' with a pointer to
+        // the value.
+
+    void removeFromIndex(Shard *shard, bsl::size_t position);
+        // Remove the entry number at the specified 'position' from the index
+        // of the specified 'shard', shifting subsequent entries of the probe
+        // sequence back to preserve the linear probing invariant.
+
+    Shard *shardFor(bsl::size_t hash) const;
+        // Return the address of the shard responsible for the specified
+        // 'hash'.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t findPosition(const Shard& shard,
+                             const KEY&   key,
+                             bsl::size_t  hash) const;
+        // Return the position in the index of the specified 'shard' of the
+        // entry having the specified 'key' whose hash value is the specified
+        // 'hash', or the size of the index if no such entry exists.
+
+    bsl::size_t homePosition(const Shard& shard, bsl::size_t hash) const;
+        // Return the preferred position of the specified 'hash' in the index
+        // of the specified 'shard'.
+
+    void initShards(bsl::size_t numShards);
+        // Create 'numShards' (rounded up to a power of two) shards and
+        // compute the per-shard watermarks.
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache(const ShardedCache&);
+    ShardedCache& operator=(const ShardedCache&);
+
+  public:
+    // CREATORS
+    explicit ShardedCache(bslma::Allocator *basicAllocator = 0);
+        // Create an empty LRU cache having no size limit and
+        // 'k_DEFAULT_NUM_SHARDS' shards.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    ShardedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bslma::Allocator          *basicAllocator = 0);
+    ShardedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bsl::size_t                numShards,
+                 bslma::Allocator          *basicAllocator = 0);
+        // Create an empty cache using the specified 'evictionPolicy', the
+        // specified 'lowWatermark' and 'highWatermark', and the optionally
+        // specified 'numShards' rounded up to the nearest power of two.  If
+        // 'numShards' is not specified, 'k_DEFAULT_NUM_SHARDS' is used.
+        // Optionally specify the 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless
+        // 'lowWatermark <= highWatermark', '1 <= lowWatermark',
+        // '1 <= highWatermark', and '1 <= numShards'.
+
+    ShardedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bsl::size_t                numShards,
+                 const HASH&                hashFunction,
+                 const EQUAL&               equalFunction,
+                 bslma::Allocator          *basicAllocator = 0);
+        // Create an empty cache using the specified 'evictionPolicy',
+        // 'lowWatermark', 'highWatermark', and 'numShards' rounded up to the
+        // nearest power of two.  The specified 'hashFunction' is used to
+        // generate the hash values for a given key, and the specified
+        // 'equalFunction' is used to determine whether two keys have the same
+        // value.  Optionally specify the 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // 'lowWatermark <= highWatermark', '1 <= lowWatermark',
+        // '1 <= highWatermark', and '1 <= numShards'.
+
+    ~ShardedCache();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all items from this cache.  Do *not* invoke the post-eviction
+        // callback.
+
+    int erase(const KEY& key);
+        // Remove the item having the specified 'key' from this cache.  Invoke
+        // the post-eviction callback for the removed item.  Return 0 on
+        // success and 1 if 'key' does not exist.
+
+    int eraseBulk(const bsl::vector<KEY>& keys);
+        // Remove the items having the specified 'keys' from this cache.
+        // Invoke the post-eviction callback for each removed item.  Return
+        // the number of items successfully removed.
+
+    void insert(const KEY& key, const VALUE& value);
+    void insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+    void insert(bslmf::MovableRef<KEY> key, const VALUE& value);
+    void insert(bslmf::MovableRef<KEY> key, bslmf::MovableRef<VALUE> value);
+        // Move the specified 'key' and its associated 'value' into this cache.
+        // If 'key' already exists, then its value will be replaced with
+        // 'value'.  Note that all the methods that take moved objects provide
+        // the 'basic' but not the 'strong' exception guarantee -- throws may
+        // occur after the objects are moved out of; the cache will not be
+        // modified, but 'key' or 'value' may be changed.
+
+    void insert(const KEY& key, const ValuePtrType& valuePtr);
+    void insert(bslmf::MovableRef<KEY> key, const ValuePtrType& valuePtr);
+        // Insert the specified 'key' and its associated 'valuePtr' into this
+        // cache.  If 'key' already exists, then its value will be replaced
+        // with 'value'.  Note that the method with 'key' moved provides the
+        // 'basic' but not the 'strong' exception guarantee -- if a throw
+        // occurs, the cache will not be modified, but 'key' may be changed.
+
+    int insertBulk(const bsl::vector<KVType>& data);
+        // Insert the specified 'data' (composed of Key-Value pairs) into this
+        // cache.  If a key already exists, then its value will be replaced
+        // with the value.  Return the number of items successfully inserted.
+
+    int insertBulk(bslmf::MovableRef<bsl::vector<KVType> > data);
+        // Insert the specified 'data' (composed of Key-Value pairs) into this
+        // cache.  If a key already exists, then its value will be replaced
+        // with the value.  Return the number of items successfully inserted.
+        // If an exception occurs during this action, we provide only the
+        // basic guarantee - both this cache and 'data' will be in some valid
+        // but unspecified state.
+
+    int popFront();
+        // Remove the item at the front of the eviction queue of the next
+        // non-empty shard, visiting shards in round-robin order.  Under the
+        // LRU policy, items at the front of that queue whose referenced flag
+        // is set are given a second chance first (see {Eviction Policies}).
+        // Invoke the post-eviction callback for the removed item.  Return 0
+        // on success, and 1 if this cache is empty.
+
+    void setPostEvictionCallback(
+                             const PostEvictionCallback& postEvictionCallback);
+        // Set the post-eviction callback to the specified
+        // 'postEvictionCallback'.  The post-eviction callback is invoked for
+        // each item evicted or removed from this cache.
+
+    int tryGetValue(bsl::shared_ptr<VALUE> *value,
+                    const KEY&              key,
+                    bool                    modifyEvictionQueue = true);
+        // Load, into the specified 'value', the value associated with the
+        // specified 'key' in this cache.  If the optionally specified
+        // 'modifyEvictionQueue' is 'true' and the eviction policy is LRU, then
+        // mark the cached item as referenced.  Return 0 on success, and 1 if
+        // 'key' does not exist in this cache.  Note that only a read lock is
+        // acquired, on the shard holding 'key'.
+
+    // ACCESSORS
+    EQUAL equalFunction() const;
+        // Return (a copy of) the key-equality functor used by this cache that
+        // returns 'true' if two 'KEY' objects have the same value, and 'false'
+        // otherwise.
+
+    CacheEvictionPolicy::Enum evictionPolicy() const;
+        // Return the eviction policy used by this cache.
+
+    HASH hashFunction() const;
+        // Return (a copy of) the unary hash functor used by this cache to
+        // generate a hash value (of type 'std::size_t') for a 'KEY' object.
+
+    bsl::size_t highWatermark() const;
+        // Return the high watermark of this cache, which is the approximate
+        // size at which eviction of existing items begins.
+
+    bsl::size_t lowWatermark() const;
+        // Return the low watermark of this cache, which is the approximate
+        // size at which eviction of existing items ends.
+
+    bsl::size_t numShards() const;
+        // Return the number of shards of this cache.
+
+    bsl::size_t size() const;
+        // Return the current size of this cache.  Note that the result is not
+        // a snapshot if other threads are concurrently modifying this cache.
+
+    template <class VISITOR>
+    void visit(VISITOR& visitor) const;
+        // Call the specified 'visitor' for every item stored in this cache,
+        // shard by shard and in the order of each shard's eviction queue,
+        // until 'visitor' returns 'false'.  The 'VISITOR' type must be a
+        // callable object that can be invoked in the same way as the function
+        // 'bool (const KEY&, const VALUE&)'.  Note that each shard is
+        // read-locked only while its own items are visited.
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // ------------------------
+                         // class ShardedCache_Entry
+                         // ------------------------
+
+// CREATORS
+template <class KEY, class VALUE>
+inline
+ShardedCache_Entry<KEY, VALUE>::ShardedCache_Entry()
+: d_value()
+, d_hash(0)
+, d_prev(-1)
+, d_next(-1)
+, d_referenced(false)
+{
+}
+
+                         // ------------------------
+                         // class ShardedCache_Shard
+                         // ------------------------
+
+// CREATORS
+template <class KEY, class VALUE>
+ShardedCache_Shard<KEY, VALUE>::ShardedCache_Shard(
+                                              bslma::Allocator *basicAllocator)
+: d_rwlock()
+, d_chunks(basicAllocator)
+, d_index(k_MIN_INDEX_SIZE, -1, basicAllocator)
+, d_freeList(-1)
+, d_head(-1)
+, d_tail(-1)
+, d_size(0)
+, d_lowWatermark(0)
+, d_highWatermark(0)
+, d_postEvictionCallback(bsl::allocator_arg, basicAllocator)
+, d_allocator_p(basicAllocator)
+{
+}
+
+template <class KEY, class VALUE>
+ShardedCache_Shard<KEY, VALUE>::~ShardedCache_Shard()
+{
+    removeAll();
+
+    for (bsl::size_t i = 0; i < d_chunks.size(); ++i) {
+        Entry *chunk = d_chunks[i];
+        for (int j = 0; j < k_CHUNK_SIZE; ++j) {
+            chunk[j].~Entry();
+        }
+        d_allocator_p->deallocate(chunk);
+    }
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE>
+inline
+typename ShardedCache_Shard<KEY, VALUE>::Entry&
+ShardedCache_Shard<KEY, VALUE>::entry(int index)
+{
+    return d_chunks[index >> k_CHUNK_SHIFT][index & (k_CHUNK_SIZE - 1)];
+}
+
+template <class KEY, class VALUE>
+inline
+void ShardedCache_Shard<KEY, VALUE>::linkBack(int index)
+{
+    Entry& e = entry(index);
+    e.d_prev = d_tail;
+    e.d_next = -1;
+    if (-1 == d_tail) {
+        d_head = index;
+    }
+    else {
+        entry(d_tail).d_next = index;
+    }
+    d_tail = index;
+}
+
+template <class KEY, class VALUE>
+void ShardedCache_Shard<KEY, VALUE>::removeAll()
+{
+    int index = d_head;
+    while (-1 != index) {
+        Entry& e    = entry(index);
+        int    next = e.d_next;
+
+        bslma::DestructionUtil::destroy(e.d_key.address());
+        e.d_value.reset();
+        e.d_referenced.storeRelaxed(false);
+        e.d_prev   = -1;
+        e.d_next   = d_freeList;
+        d_freeList = index;
+
+        index = next;
+    }
+    d_head = -1;
+    d_tail = -1;
+    d_size = 0;
+
+    bsl::fill(d_index.begin(), d_index.end(), -1);
+}
+
+template <class KEY, class VALUE>
+int ShardedCache_Shard<KEY, VALUE>::reserveEntry()
+{
+    if (-1 != d_freeList) {
+        return d_freeList;                                            // RETURN
+    }
+
+    if (d_chunks.size() == d_chunks.capacity()) {
+        d_chunks.reserve(d_chunks.empty() ? 4 : 2 * d_chunks.size());
+    }
+
+    const bsl::size_t  numBytes = k_CHUNK_SIZE * sizeof(Entry);
+    Entry             *chunk    = static_cast<Entry *>(
+                                            d_allocator_p->allocate(numBytes));
+
+    const int base = static_cast<int>(d_chunks.size()) << k_CHUNK_SHIFT;
+    for (int j = 0; j < k_CHUNK_SIZE; ++j) {
+        new (chunk + j) Entry();
+        chunk[j].d_next = j + 1 < k_CHUNK_SIZE ? base + j + 1 : -1;
+    }
+    d_chunks.push_back(chunk);  // capacity was reserved above; cannot throw
+    d_freeList = base;
+
+    return d_freeList;
+}
+
+template <class KEY, class VALUE>
+inline
+void ShardedCache_Shard<KEY, VALUE>::unlink(int index)
+{
+    Entry& e = entry(index);
+    if (-1 == e.d_prev) {
+        d_head = e.d_next;
+    }
+    else {
+        entry(e.d_prev).d_next = e.d_next;
+    }
+    if (-1 == e.d_next) {
+        d_tail = e.d_prev;
+    }
+    else {
+        entry(e.d_next).d_prev = e.d_prev;
+    }
+    e.d_prev = -1;
+    e.d_next = -1;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE>
+inline
+const typename ShardedCache_Shard<KEY, VALUE>::Entry&
+ShardedCache_Shard<KEY, VALUE>::entry(int index) const
+{
+    return d_chunks[index >> k_CHUNK_SHIFT][index & (k_CHUNK_SIZE - 1)];
+}
+
+                            // ------------------
+                            // class ShardedCache
+                            // ------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool ShardedCache<KEY, VALUE, HASH, EQUAL>::isCyclicallyBetween(
+                                                          bsl::size_t position,
+                                                          bsl::size_t first,
+                                                          bsl::size_t last)
+{
+    return first <= last ? first < position && position <= last
+                         : first < position || position <= last;
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark(Shard *shard)
+{
+    if (shard->d_size < shard->d_highWatermark) {
+        return;                                                       // RETURN
+    }
+
+    while (shard->d_size >= shard->d_lowWatermark && shard->d_size > 0) {
+        evictFront(shard);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::evictEntry(Shard       *shard,
+                                                       bsl::size_t  position)
+{
+    const int index = shard->d_index[position];
+    Entry&    e     = shard->entry(index);
+
+    ValuePtrType value;
+    value.swap(e.d_value);
+
+    removeFromIndex(shard, position);
+    shard->unlink(index);
+    bslma::DestructionUtil::destroy(e.d_key.address());
+    e.d_referenced.storeRelaxed(false);
+    e.d_next          = shard->d_freeList;
+    shard->d_freeList = index;
+    --shard->d_size;
+
+    if (shard->d_postEvictionCallback) {
+        shard->d_postEvictionCallback(value);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::evictFront(Shard *shard)
+{
+    if (0 == shard->d_size) {
+        return 1;                                                     // RETURN
+    }
+
+    int index = shard->d_head;
+    if (CacheEvictionPolicy::e_LRU == d_evictionPolicy) {
+        // Give every referenced item at the front a second chance.  This loop
+        // terminates because each iteration clears one flag, and no flag can
+        // be set concurrently while the write lock is held.
+
+        while (shard->entry(index).d_referenced.loadRelaxed()) {
+            shard->entry(index).d_referenced.storeRelaxed(false);
+            if (index != shard->d_tail) {
+                shard->unlink(index);
+                shard->linkBack(index);
+            }
+            index = shard->d_head;
+        }
+    }
+
+    // Locate the index position of the entry without comparing keys.
+
+    const bsl::size_t mask     = shard->d_index.size() - 1;
+    bsl::size_t       position = homePosition(*shard,
+                                              shard->entry(index).d_hash);
+    while (shard->d_index[position] != index) {
+        BSLS_ASSERT(-1 != shard->d_index[position]);
+        position = (position + 1) & mask;
+    }
+
+    evictEntry(shard, position);
+    return 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::growIndexIfNeeded(Shard *shard)
+{
+    if ((shard->d_size + 1) * 2 <= shard->d_index.size()) {
+        return;                                                       // RETURN
+    }
+
+    bsl::vector<int> newIndex(shard->d_index.size() * 2,
+                              -1,
+                              d_allocator_p);
+    const bsl::size_t mask = newIndex.size() - 1;
+
+    for (int index = shard->d_head;
+         -1 != index;
+         index = shard->entry(index).d_next) {
+        bsl::size_t position = (shard->entry(index).d_hash >> d_shardBits)
+                             & mask;
+        while (-1 != newIndex[position]) {
+            position = (position + 1) & mask;
+        }
+        newIndex[position] = index;
+    }
+
+    shard->d_index.swap(newIndex);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool ShardedCache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
+                                                    KEY          *key_p,
+                                                    bool          moveKey,
+                                                    ValuePtrType *valuePtr_p,
+                                                    bool          moveValuePtr)
+{
+    KEY&          key      = *key_p;
+    ValuePtrType& valuePtr = *valuePtr_p;
+
+    const bsl::size_t hash  = d_hashFunction(key);
+    Shard            *shard = shardFor(hash);
+
+    bslmt::WriteLockGuard<LockType> guard(&shard->d_rwlock);
+
+    enforceHighWatermark(shard);
+
+    const bsl::size_t position = findPosition(*shard, key, hash);
+    if (position != shard->d_index.size()) {
+        const int index = shard->d_index[position];
+        Entry&    e     = shard->entry(index);
+
+        if (moveValuePtr) {
+            e.d_value = bslmf::MovableRefUtil::move(valuePtr);
+        }
+        else {
+            e.d_value = valuePtr;
+        }
+        e.d_referenced.storeRelaxed(false);
+        if (index != shard->d_tail) {
+            shard->unlink(index);
+            shard->linkBack(index);
+        }
+        return false;                                                 // RETURN
+    }
+
+    // Perform every operation that might throw before modifying the shard.
+
+    growIndexIfNeeded(shard);
+
+    const int index = shard->reserveEntry();
+    Entry&    e     = shard->entry(index);
+
+    if (moveKey) {
+        bslma::ConstructionUtil::construct(e.d_key.address(),
+                                           d_allocator_p,
+                                           bslmf::MovableRefUtil::move(key));
+    }
+    else {
+        bslma::ConstructionUtil::construct(e.d_key.address(),
+                                           d_allocator_p,
+                                           key);
+    }
+
+    shard->d_freeList = e.d_next;
+    if (moveValuePtr) {
+        e.d_value = bslmf::MovableRefUtil::move(valuePtr);
+    }
+    else {
+        e.d_value = valuePtr;
+    }
+    e.d_hash = hash;
+    e.d_referenced.storeRelaxed(false);
+    shard->linkBack(index);
+
+    const bsl::size_t mask = shard->d_index.size() - 1;
+    bsl::size_t       pos  = homePosition(*shard, hash);
+    while (-1 != shard->d_index[pos]) {
+        pos = (pos + 1) & mask;
+    }
+    shard->d_index[pos] = index;
+    ++shard->d_size;
+
+    if (0 == shard->d_highWatermark) {
+        // This shard has no share of the high watermark, so it holds no
+        // items.
+
+        evictFront(shard);
+    }
+
+    return true;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::populateValuePtrType(
+                                                           ValuePtrType *dst,
+                                                           const VALUE&  value,
+                                                           bsl::true_type)
+{
+    dst->createInplace(d_allocator_p, value, d_allocator_p);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::populateValuePtrType(
+                                                           ValuePtrType *dst,
+                                                           const VALUE&  value,
+                                                           bsl::false_type)
+{
+    dst->createInplace(d_allocator_p, value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::populateValuePtrType(
+                                               ValuePtrType             *dst,
+                                               bslmf::MovableRef<VALUE>  value,
+                                               bsl::true_type)
+{
+    dst->createInplace(d_allocator_p,
+                       bslmf::MovableRefUtil::move(value),
+                       d_allocator_p);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::populateValuePtrType(
+                                               ValuePtrType             *dst,
+                                               bslmf::MovableRef<VALUE>  value,
+                                               bsl::false_type)
+{
+    dst->createInplace(d_allocator_p, bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::removeFromIndex(
+                                                        Shard       *shard,
+                                                        bsl::size_t  position)
+{
+    bsl::vector<int>& index = shard->d_index;
+    const bsl::size_t mask  = index.size() - 1;
+
+    bsl::size_t hole = position;
+    bsl::size_t next = (position + 1) & mask;
+    while (-1 != index[next]) {
+        const bsl::size_t home =
+                      homePosition(*shard, shard->entry(index[next]).d_hash);
+        if (!isCyclicallyBetween(home, hole, next)) {
+            index[hole] = index[next];
+            hole        = next;
+        }
+        next = (next + 1) & mask;
+    }
+    index[hole] = -1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename ShardedCache<KEY, VALUE, HASH, EQUAL>::Shard *
+ShardedCache<KEY, VALUE, HASH, EQUAL>::shardFor(bsl::size_t hash) const
+{
+    return d_shards[hash & d_shardMask];
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::findPosition(
+                                                     const Shard& shard,
+                                                     const KEY&   key,
+                                                     bsl::size_t  hash) const
+{
+    const bsl::size_t mask     = shard.d_index.size() - 1;
+    bsl::size_t       position = homePosition(shard, hash);
+
+    for (int index = shard.d_index[position];
+         -1 != index;
+         index = shard.d_index[position]) {
+        const Entry& e = shard.entry(index);
+        if (e.d_hash == hash && d_equalFunction(e.d_key.object(), key)) {
+            return position;                                          // RETURN
+        }
+        position = (position + 1) & mask;
+    }
+    return shard.d_index.size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::homePosition(
+                                                      const Shard& shard,
+                                                      bsl::size_t  hash) const
+{
+    return (hash >> d_shardBits) & (shard.d_index.size() - 1);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::initShards(bsl::size_t numShards)
+{
+    BSLS_ASSERT(1 <= numShards);
+
+    d_shardBits = 0;
+    while ((static_cast<bsl::size_t>(1) << d_shardBits) < numShards) {
+        ++d_shardBits;
+    }
+    const bsl::size_t count = static_cast<bsl::size_t>(1) << d_shardBits;
+    d_shardMask = count - 1;
+
+    // The remainders of the divisions are spread over the first shards, so
+    // that the shares of each watermark add up to that watermark.
+
+    const bsl::size_t unbounded = bsl::numeric_limits<bsl::size_t>::max();
+
+    d_shards.reserve(count);
+    for (bsl::size_t i = 0; i < count; ++i) {
+        Shard *shard = new (*d_allocator_p) Shard(d_allocator_p);
+        d_shards.push_back(shard);
+
+        shard->d_highWatermark = unbounded == d_highWatermark
+                               ? unbounded
+                               : d_highWatermark / count
+                               + (i < d_highWatermark % count);
+        shard->d_lowWatermark  = unbounded == d_lowWatermark
+                               ? unbounded
+                               : d_lowWatermark / count
+                               + (i < d_lowWatermark % count);
+        if (0 == shard->d_lowWatermark) {
+            shard->d_lowWatermark = 1;
+        }
+    }
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_shards(d_allocator_p)
+, d_shardMask(0)
+, d_shardBits(0)
+, d_hashFunction()
+, d_equalFunction()
+, d_evictionPolicy(CacheEvictionPolicy::e_LRU)
+, d_lowWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_highWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_nextPopShard(0)
+{
+    initShards(k_DEFAULT_NUM_SHARDS);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_shards(d_allocator_p)
+, d_shardMask(0)
+, d_shardBits(0)
+, d_hashFunction()
+, d_equalFunction()
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_nextPopShard(0)
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_REVIEW(1 <= highWatermark);
+
+    initShards(k_DEFAULT_NUM_SHARDS);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bsl::size_t                numShards,
+                                     bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_shards(d_allocator_p)
+, d_shardMask(0)
+, d_shardBits(0)
+, d_hashFunction()
+, d_equalFunction()
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_nextPopShard(0)
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_REVIEW(1 <= highWatermark);
+
+    initShards(numShards);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bsl::size_t                numShards,
+                                     const HASH&                hashFunction,
+                                     const EQUAL&               equalFunction,
+                                     bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_shards(d_allocator_p)
+, d_shardMask(0)
+, d_shardBits(0)
+, d_hashFunction(hashFunction)
+, d_equalFunction(equalFunction)
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_nextPopShard(0)
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_REVIEW(1 <= highWatermark);
+
+    initShards(numShards);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::~ShardedCache()
+{
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        d_allocator_p->deleteObject(d_shards[i]);
+    }
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        bslmt::WriteLockGuard<LockType> guard(&d_shards[i]->d_rwlock);
+        d_shards[i]->removeAll();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    const bsl::size_t hash  = d_hashFunction(key);
+    Shard            *shard = shardFor(hash);
+
+    bslmt::WriteLockGuard<LockType> guard(&shard->d_rwlock);
+
+    const bsl::size_t position = findPosition(*shard, key, hash);
+    if (position == shard->d_index.size()) {
+        return 1;                                                     // RETURN
+    }
+
+    evictEntry(shard, position);
+    return 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::eraseBulk(
+                                                  const bsl::vector<KEY>& keys)
+{
+    int count = 0;
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        count += 0 == erase(keys[i]);
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(const KEY&   key,
+                                                   const VALUE& value)
+{
+    ValuePtrType valuePtr;
+    populateValuePtrType(&valuePtr, value, bslma::UsesBslmaAllocator<VALUE>());
+
+    insertValuePtrMoveImp(const_cast<KEY *>(&key), false, &valuePtr, true);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                               const KEY&               key,
+                                               bslmf::MovableRef<VALUE> value)
+{
+    ValuePtrType valuePtr;
+    populateValuePtrType(&valuePtr,
+                         bslmf::MovableRefUtil::move(value),
+                         bslma::UsesBslmaAllocator<VALUE>());
+
+    insertValuePtrMoveImp(const_cast<KEY *>(&key), false, &valuePtr, true);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                bslmf::MovableRef<KEY> key,
+                                                const VALUE&           value)
+{
+    KEY& localKey = key;
+
+    ValuePtrType valuePtr;
+    populateValuePtrType(&valuePtr, value, bslma::UsesBslmaAllocator<VALUE>());
+
+    insertValuePtrMoveImp(&localKey, true, &valuePtr, true);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                              bslmf::MovableRef<KEY>   key,
+                                              bslmf::MovableRef<VALUE> value)
+{
+    KEY& localKey = key;
+
+    ValuePtrType valuePtr;
+    populateValuePtrType(&valuePtr,
+                         bslmf::MovableRefUtil::move(value),
+                         bslma::UsesBslmaAllocator<VALUE>());
+
+    insertValuePtrMoveImp(&localKey, true, &valuePtr, true);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                 const KEY&          key,
+                                                 const ValuePtrType& valuePtr)
+{
+    insertValuePtrMoveImp(const_cast<KEY *>(&key),
+                          false,
+                          const_cast<ValuePtrType *>(&valuePtr),
+                          false);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                              bslmf::MovableRef<KEY> key,
+                                              const ValuePtrType&    valuePtr)
+{
+    KEY& localKey = key;
+
+    insertValuePtrMoveImp(&localKey,
+                          true,
+                          const_cast<ValuePtrType *>(&valuePtr),
+                          false);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                               const bsl::vector<KVType>& data)
+{
+    int count = 0;
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        KEY          *key_p      = const_cast<KEY *>(         &data[i].first);
+        ValuePtrType *valuePtr_p = const_cast<ValuePtrType *>(&data[i].second);
+
+        count += insertValuePtrMoveImp(key_p, false, valuePtr_p, false);
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                  bslmf::MovableRef<bsl::vector<KVType> > data)
+{
+    bsl::vector<KVType>& localData = data;
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < localData.size(); ++i) {
+        count += insertValuePtrMoveImp(&localData[i].first,
+                                       true,
+                                       &localData[i].second,
+                                       true);
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::popFront()
+{
+    const bsl::size_t start = d_nextPopShard.addRelaxed(1) - 1;
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        Shard *shard = d_shards[(start + i) & d_shardMask];
+
+        bslmt::WriteLockGuard<LockType> guard(&shard->d_rwlock);
+        if (0 == evictFront(shard)) {
+            return 0;                                                 // RETURN
+        }
+    }
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::setPostEvictionCallback(
+                              const PostEvictionCallback& postEvictionCallback)
+{
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        bslmt::WriteLockGuard<LockType> guard(&d_shards[i]->d_rwlock);
+        d_shards[i]->d_postEvictionCallback = postEvictionCallback;
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                   bsl::shared_ptr<VALUE> *value,
+                                   const KEY&              key,
+                                   bool                    modifyEvictionQueue)
+{
+    const bsl::size_t hash  = d_hashFunction(key);
+    const Shard      *shard = shardFor(hash);
+
+    bslmt::ReadLockGuard<LockType> guard(&shard->d_rwlock);
+
+    const bsl::size_t position = findPosition(*shard, key, hash);
+    if (position == shard->d_index.size()) {
+        return 1;                                                     // RETURN
+    }
+
+    const Entry& e = shard->entry(shard->d_index[position]);
+    *value = e.d_value;
+
+    if (modifyEvictionQueue
+     && CacheEvictionPolicy::e_LRU == d_evictionPolicy
+     && !e.d_referenced.loadRelaxed()) {
+        // Only write the flag if it is not already set, to avoid
+        // invalidating the cache line in other readers.
+
+        const_cast<Entry&>(e).d_referenced.storeRelaxed(true);
+    }
+
+    return 0;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL ShardedCache<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_equalFunction;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+CacheEvictionPolicy::Enum
+ShardedCache<KEY, VALUE, HASH, EQUAL>::evictionPolicy() const
+{
+    return d_evictionPolicy;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH ShardedCache<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hashFunction;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::highWatermark() const
+{
+    return d_highWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::lowWatermark() const
+{
+    return d_lowWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::numShards() const
+{
+    return d_shards.size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        bslmt::ReadLockGuard<LockType> guard(&d_shards[i]->d_rwlock);
+        result += d_shards[i]->d_size;
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
+{
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        const Shard& shard = *d_shards[i];
+
+        bslmt::ReadLockGuard<LockType> guard(&shard.d_rwlock);
+
+        for (int index = shard.d_head;
+             -1 != index;
+             index = shard.entry(index).d_next) {
+            const Entry& e = shard.entry(index);
+            if (!visitor(e.d_key.object(), *e.d_value)) {
+                return;                                               // RETURN
+            }
+        }
+    }
+}
+
+}  // close package namespace
+
+// TRAITS
+
+namespace bslma {
+
+template <class KEY,  class VALUE,  class HASH,  class EQUAL>
+struct UsesBslmaAllocator<bdlcc::ShardedCache<KEY, VALUE, HASH, EQUAL> >
+    : bsl::true_type
+{
+};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1217 @@
+// bdlcc_shardedcache.t.cpp                                           -*-C++-*-
+#include <bdlcc_shardedcache.h>
+
+#include <bdlcc_cache.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a mechanism, 'bdlcc::ShardedCache', that
+// provides the interface of 'bdlcc::Cache' over independently locked shards,
+// each storing its items in recycled entry arrays indexed by an
+// open-addressing hash table.  We must verify that the cache behaves as a
+// map (in particular under heavy hash collisions, which exercise the
+// backward-shift deletion of the index), that the FIFO and (CLOCK-based) LRU
+// eviction policies and the watermarks behave as documented, that the
+// post-eviction callback is invoked for evicted and erased items, that all
+// memory comes from the supplied allocator and is released, and that the
+// cache can be used concurrently.
+//
+// In addition to positive test cases (run in the nightly builds), a negative
+// test case -1 can be run manually to compare the throughput of this cache
+// with that of 'bdlcc::Cache' on a read-mostly workload.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit ShardedCache(bslma::Allocator *basicAllocator);
+// [ 2] ShardedCache(policy, lowWatermark, highWatermark, basicAllocator);
+// [ 2] ShardedCache(policy, lowWat, highWat, numShards, basicAllocator);
+// [ 2] ShardedCache(policy, lowWat, highWat, numShards, hash, equal, alloc);
+// [ 2] ~ShardedCache();
+//
+// MANIPULATORS
+// [ 3] void clear();
+// [ 3] int erase(const KEY& key);
+// [ 5] int eraseBulk(const bsl::vector<KEY>& keys);
+// [ 3] void insert(const KEY& key, const VALUE& value);
+// [ 5] void insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+// [ 5] void insert(bslmf::MovableRef<KEY> key, const VALUE& value);
+// [ 5] void insert(bslmf::MovableRef<KEY> key, MovableRef<VALUE> value);
+// [ 3] void insert(const KEY& key, const ValuePtrType& valuePtr);
+// [ 5] void insert(bslmf::MovableRef<KEY> key, const ValuePtrType& ptr);
+// [ 5] int insertBulk(const bsl::vector<KVType>& data);
+// [ 5] int insertBulk(bslmf::MovableRef<bsl::vector<KVType> > data);
+// [ 4] int popFront();
+// [ 3] void setPostEvictionCallback(postEvictionCallback);
+// [ 3] int tryGetValue(value, key, modifyEvictionQueue);
+//
+// ACCESSORS
+// [ 2] EQUAL equalFunction() const;
+// [ 2] CacheEvictionPolicy::Enum evictionPolicy() const;
+// [ 2] HASH hashFunction() const;
+// [ 2] bsl::size_t highWatermark() const;
+// [ 2] bsl::size_t lowWatermark() const;
+// [ 2] bsl::size_t numShards() const;
+// [ 3] bsl::size_t size() const;
+// [ 5] void visit(VISITOR& visitor) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] EVICTION POLICIES AND WATERMARKS
+// [ 6] CONCURRENCY
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: COMPARISON WITH 'bdlcc::Cache'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::ShardedCache<int, int>         Obj;
+typedef bdlcc::CacheEvictionPolicy            Policy;
+typedef bsl::shared_ptr<int>                  IntPtr;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct CollidingHash {
+    // This 'struct' defines a hash functor that maps integers onto very few
+    // hash values, so that long probe sequences are formed in the index.
+
+    bsl::size_t operator()(int key) const
+    {
+        return static_cast<bsl::size_t>(key % 5);
+    }
+};
+
+struct EvictionRecorder {
+    // This 'struct' defines a post-eviction callback that appends the evicted
+    // value to a vector.
+
+    bsl::vector<int> *d_evicted_p;
+
+    void operator()(const IntPtr& value) const
+    {
+        d_evicted_p->push_back(*value);
+    }
+};
+
+struct KeyCollector {
+    // This 'struct' defines a visitor that appends every visited key to a
+    // vector and stops after 'd_limit' keys.
+
+    bsl::vector<int> *d_keys_p;
+    bsl::size_t       d_limit;
+
+    bool operator()(const int& key, const int&) const
+    {
+        d_keys_p->push_back(key);
+        return d_keys_p->size() < d_limit;
+    }
+};
+
+template <class CACHE>
+bool hasKey(CACHE *cache, int key)
+    // Return 'true' if the specified 'cache' contains the specified 'key',
+    // without marking the item as referenced.
+{
+    typename CACHE::ValuePtrType value;
+    return 0 == cache->tryGetValue(&value, key, false);
+}
+
+struct ConcurrentWorker {
+    // This 'struct' defines a thread function that performs a mix of lookups,
+    // inserts, and erasures on a shared cache, verifying that every value
+    // found matches its key.
+
+    Obj             *d_cache_p;
+    int              d_id;
+    int              d_numIterations;
+    int              d_numKeys;
+    bslmt::Barrier  *d_barrier_p;
+
+    void operator()() const
+    {
+        d_barrier_p->wait();
+
+        unsigned int seed = d_id * 7919 + 1;
+        for (int i = 0; i < d_numIterations; ++i) {
+            seed = seed * 1103515245 + 12345;
+            const int key = static_cast<int>((seed >> 8) % d_numKeys);
+            const int op  = static_cast<int>((seed >> 4) % 8);
+
+            if (op < 5) {
+                IntPtr value;
+                if (0 == d_cache_p->tryGetValue(&value, key)) {
+                    ASSERTV(key, *value, key * 3 == *value);
+                }
+            }
+            else if (op < 7) {
+                d_cache_p->insert(key, key * 3);
+            }
+            else {
+                d_cache_p->erase(key);
+            }
+        }
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                           BENCHMARK SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace bench {
+
+template <class CACHE>
+struct ReadMostlyTask {
+    // This 'struct' defines a work unit for 'bslmt::ThroughputBenchmark' that
+    // performs 'd_numOps' operations on a cache of the (template parameter)
+    // type 'CACHE', one in 'd_writeRatio' of which is an insert and the rest
+    // of which are LRU lookups.
+
+    CACHE *d_cache_p;
+    int    d_numKeys;
+    int    d_numOps;
+    int    d_writeRatio;
+
+    void run(int threadIndex) const
+    {
+        unsigned int seed = static_cast<unsigned int>(
+                               reinterpret_cast<bsls::Types::UintPtr>(&seed))
+                          + threadIndex;
+        typename CACHE::ValuePtrType value;
+        for (int i = 0; i < d_numOps; ++i) {
+            seed = seed * 1103515245 + 12345;
+            const int key = static_cast<int>((seed >> 8) % d_numKeys);
+            if (0 < d_writeRatio && 0 == (seed >> 3) % d_writeRatio) {
+                d_cache_p->insert(key, key);
+            }
+            else {
+                d_cache_p->tryGetValue(&value, key);
+            }
+        }
+    }
+};
+
+template <class CACHE>
+double measure(CACHE *cache,
+               int    numThreads,
+               int    numKeys,
+               int    writeRatio,
+               int    numMillis,
+               int    numSamples)
+    // Return the median number of work units (of 100 operations each) per
+    // second performed by the specified 'numThreads' threads on the specified
+    // 'cache', populated with the specified 'numKeys' keys, where one in the
+    // specified 'writeRatio' operations is an insert (none if 'writeRatio' is
+    // 0), measured over the specified 'numSamples' samples of the specified
+    // 'numMillis' milliseconds.
+{
+    for (int i = 0; i < numKeys; ++i) {
+        cache->insert(i, i);
+    }
+
+    ReadMostlyTask<CACHE> task = { cache, numKeys, 100, writeRatio };
+
+    bslmt::ThroughputBenchmark       tb;
+    bslmt::ThroughputBenchmarkResult result;
+
+    int groupId = tb.addThreadGroup(
+                         bdlf::BindUtil::bind(&ReadMostlyTask<CACHE>::run,
+                                              &task,
+                                              bdlf::PlaceHolders::_1),
+                         numThreads,
+                         0);
+
+    tb.execute(&result, numMillis, numSamples);
+
+    double median;
+    result.getMedian(&median, groupId);
+    return median;
+}
+
+}  // close namespace bench
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+void example1(bslma::TestAllocator& talloc)
+{
+///Example 1: A Reference-Data Cache
+///- - - - - - - - - - - - - - - - -
+// Suppose we maintain a cache of reference data, keyed by security
+// identifier, that is read by many threads and occasionally refreshed.
+//
+// First, we define a sharded cache mapping 'int' to 'bsl::string' that uses
+// the LRU eviction policy and holds roughly 1000 items, spread over 8 shards:
+//..
+    bdlcc::ShardedCache<int, bsl::string> cache(
+                                            bdlcc::CacheEvictionPolicy::e_LRU,
+                                            900,
+                                            1000,
+                                            8,
+                                            &talloc);
+    ASSERT(8 == cache.numShards());
+//..
+// Next, we populate the cache:
+//..
+    for (int i = 0; i < 100; ++i) {
+        cache.insert(i, bsl::string("security"));
+    }
+    ASSERT(100 == cache.size());
+//..
+// Now, any number of threads may look up values concurrently, each taking
+// only a read lock on the shard holding the requested key:
+//..
+    bsl::shared_ptr<bsl::string> value;
+    int rc = cache.tryGetValue(&value, 42);
+    ASSERT(0 == rc);
+    ASSERT("security" == *value);
+
+    rc = cache.tryGetValue(&value, 1042);
+    ASSERT(1 == rc);
+//..
+// Finally, we remove an item, which invokes the post-eviction callback (if
+// one has been set):
+//..
+    rc = cache.erase(42);
+    ASSERT(0  == rc);
+    ASSERT(99 == cache.size());
+//..
+}
+
+}  // close namespace usage
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+    bslma::TestAllocator da("default", veryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        usage::example1(ta);
+
+        ASSERT(0 == ta.numBytesInUse());
+        ASSERT(0 == da.numBytesInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Concurrent lookups, inserts, and erasures on the same cache do
+        //:   not corrupt it, and every value found corresponds to its key.
+        //:
+        //: 2 Concurrent eviction keeps each shard within its watermarks.
+        //
+        // Plan:
+        //: 1 Run several threads performing a random mix of operations over a
+        //:   small key range on caches with both eviction policies, then
+        //:   verify the contents and the size of the cache.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        const int k_NUM_THREADS    = 8;
+        const int k_NUM_ITERATIONS = 20000;
+        const int k_NUM_KEYS       = 500;
+
+        const Policy::Enum POLICIES[] = { Policy::e_LRU, Policy::e_FIFO };
+
+        for (int p = 0; p < 2; ++p) {
+            Obj mX(POLICIES[p], 150, 200, 4, &ta);  const Obj& X = mX;
+
+            bslmt::Barrier     barrier(k_NUM_THREADS);
+            bslmt::ThreadGroup group(&ta);
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ConcurrentWorker worker = { &mX,
+                                            i,
+                                            k_NUM_ITERATIONS,
+                                            k_NUM_KEYS,
+                                            &barrier };
+                ASSERT(0 == group.addThread(worker));
+            }
+            group.joinAll();
+
+            ASSERTV(X.size(), X.size() <= 200);
+
+            for (int key = 0; key < k_NUM_KEYS; ++key) {
+                IntPtr value;
+                if (0 == mX.tryGetValue(&value, key)) {
+                    ASSERTV(key, *value, key * 3 == *value);
+                }
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // BULK OPERATIONS, MOVE INSERTION, AND VISIT
+        //
+        // Concerns:
+        //: 1 'insertBulk' inserts every item, returns the number of new keys,
+        //:   and replaces the values of existing keys.
+        //:
+        //: 2 'eraseBulk' removes the existing keys and returns their number.
+        //:
+        //: 3 The moving 'insert' overloads store the expected values, and keys
+        //:   and values that use an allocator get the cache's allocator.
+        //:
+        //: 4 'visit' visits every item once, in eviction-queue order within a
+        //:   shard, and stops when the visitor returns 'false'.
+        //
+        // Plan:
+        //: 1 Perform bulk operations on a cache and verify the results.
+        //:   (C-1..2)
+        //:
+        //: 2 Use a cache of 'bsl::string' keys and values with the default
+        //:   allocator set to a distinct test allocator, and verify that the
+        //:   default allocator is not used.  (C-3)
+        //:
+        //: 3 Visit a single-shard cache and a multi-shard cache.  (C-4)
+        //
+        // Testing:
+        //   int eraseBulk(const bsl::vector<KEY>& keys);
+        //   void insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+        //   void insert(bslmf::MovableRef<KEY> key, const VALUE& value);
+        //   void insert(bslmf::MovableRef<KEY> key, MovableRef<VALUE> value);
+        //   void insert(bslmf::MovableRef<KEY> key, const ValuePtrType& ptr);
+        //   int insertBulk(const bsl::vector<KVType>& data);
+        //   int insertBulk(bslmf::MovableRef<bsl::vector<KVType> > data);
+        //   void visit(VISITOR& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                  << "BULK OPERATIONS, MOVE INSERTION, AND VISIT" << endl
+                  << "==========================================" << endl;
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bsl::vector<Obj::KVType> data(&ta);
+            for (int i = 0; i < 100; ++i) {
+                data.push_back(
+                           Obj::KVType(i, bsl::allocate_shared<int>(&ta, i)));
+            }
+            ASSERT(100 == mX.insertBulk(data));
+            ASSERT(100 == X.size());
+
+            data.resize(50);
+            ASSERT(0 == mX.insertBulk(bslmf::MovableRefUtil::move(data)));
+            ASSERT(100 == X.size());
+
+            bsl::vector<int> keys(&ta);
+            for (int i = 90; i < 110; ++i) {
+                keys.push_back(i);
+            }
+            ASSERT(10 == mX.eraseBulk(keys));
+            ASSERT(90 == X.size());
+
+            bsl::vector<int> visited(&ta);
+            KeyCollector     collector = { &visited, 1000 };
+            X.visit(collector);
+            ASSERT(90 == visited.size());
+
+            bsl::sort(visited.begin(), visited.end());
+            for (int i = 0; i < 90; ++i) {
+                ASSERTV(i, visited[i], i == visited[i]);
+            }
+
+            visited.clear();
+            collector.d_limit = 10;
+            X.visit(collector);
+            ASSERT(10 == visited.size());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        {
+            Obj mX(Policy::e_FIFO, 100, 100, 1, &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 20; ++i) {
+                mX.insert(19 - i, i);
+            }
+
+            bsl::vector<int> visited(&ta);
+            KeyCollector     collector = { &visited, 1000 };
+            X.visit(collector);
+            ASSERT(20 == visited.size());
+            for (int i = 0; i < 20; ++i) {
+                ASSERTV(i, visited[i], 19 - i == visited[i]);
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        {
+            typedef bdlcc::ShardedCache<bsl::string, bsl::string> StrObj;
+
+            const bsls::Types::Int64 numDefaultBlocks = da.numBlocksTotal();
+
+            StrObj mX(&ta);  const StrObj& X = mX;
+
+            const char *LONG = "a string long enough to require allocation";
+
+            bsl::string k1(LONG, &ta), v1(LONG, &ta);
+            bsl::string k2(LONG, &ta), v2(LONG, &ta);
+            bsl::string k3(LONG, &ta), v3(LONG, &ta);
+            bsl::string k4(LONG, &ta);
+            k1 += '1';  k2 += '2';  k3 += '3';  k4 += '4';
+
+            mX.insert(k1, bslmf::MovableRefUtil::move(v1));
+            mX.insert(bslmf::MovableRefUtil::move(k2), v2);
+            mX.insert(bslmf::MovableRefUtil::move(k3),
+                      bslmf::MovableRefUtil::move(v3));
+            mX.insert(bslmf::MovableRefUtil::move(k4),
+                      bsl::allocate_shared<bsl::string>(&ta, LONG));
+            ASSERT(4 == X.size());
+
+            k1.assign(LONG);  k1 += '1';
+            k4.assign(LONG);  k4 += '4';
+
+            bsl::shared_ptr<bsl::string> value;
+            ASSERT(0 == mX.tryGetValue(&value, k1));
+            ASSERT(LONG == *value);
+            ASSERT(0 == mX.tryGetValue(&value, k4));
+            ASSERT(LONG == *value);
+            ASSERT(&ta == value->get_allocator().mechanism());
+
+            ASSERTV(da.numBlocksTotal(),
+                    numDefaultBlocks == da.numBlocksTotal());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // EVICTION POLICIES AND WATERMARKS
+        //
+        // Concerns:
+        //: 1 With a single shard, eviction starts when the size reaches the
+        //:   high watermark and stops when it is below the low watermark.
+        //:
+        //: 2 Under FIFO, items are evicted in insertion order, regardless of
+        //:   lookups.
+        //:
+        //: 3 Under LRU, an item looked up since it was last considered for
+        //:   eviction is given a second chance, unless the lookup was made
+        //:   with 'modifyEvictionQueue' set to 'false'.
+        //:
+        //: 4 Re-inserting an existing key moves it to the back of the queue.
+        //:
+        //: 5 'popFront' follows the same order, and returns 1 on an empty
+        //:   cache.
+        //:
+        //: 6 With several shards, the size never exceeds the high watermark,
+        //:   including when the high watermark is not a multiple of, or is
+        //:   less than, the number of shards.
+        //
+        // Plan:
+        //: 1 Perform ad hoc sequences of operations on single-shard caches,
+        //:   recording evicted values with a post-eviction callback.
+        //:   (C-1..5)
+        //:
+        //: 2 Insert enough keys into multi-shard caches, for a table of
+        //:   watermarks and numbers of shards, to fill every shard, and check
+        //:   the size after each insertion.  (C-6)
+        //
+        // Testing:
+        //   int popFront();
+        //   EVICTION POLICIES AND WATERMARKS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EVICTION POLICIES AND WATERMARKS" << endl
+                          << "================================" << endl;
+
+        if (veryVerbose) cout << "Watermarks and FIFO" << endl;
+        {
+            bsl::vector<int> evicted(&ta);
+            EvictionRecorder recorder = { &evicted };
+
+            Obj mX(Policy::e_FIFO, 3, 5, 1, &ta);  const Obj& X = mX;
+            mX.setPostEvictionCallback(recorder);
+
+            for (int i = 0; i < 5; ++i) {
+                mX.insert(i, i);
+            }
+            ASSERT(5 == X.size());
+            ASSERT(0 == evicted.size());
+
+            ASSERT(hasKey(&mX, 0));
+            IntPtr value;
+            ASSERT(0 == mX.tryGetValue(&value, 0));
+
+            // Size is at the high watermark: evict until below 3.
+
+            mX.insert(5, 5);
+            ASSERTV(X.size(), 3 == X.size());
+            ASSERTV(evicted.size(), 3 == evicted.size());
+            ASSERT(0 == evicted[0]);
+            ASSERT(1 == evicted[1]);
+            ASSERT(2 == evicted[2]);
+
+            ASSERT(0 == mX.popFront());
+            ASSERT(3 == evicted.back());
+            ASSERT(0 == mX.popFront());
+            ASSERT(4 == evicted.back());
+            ASSERT(0 == mX.popFront());
+            ASSERT(5 == evicted.back());
+            ASSERT(1 == mX.popFront());
+            ASSERT(0 == X.size());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (veryVerbose) cout << "LRU second chance" << endl;
+        {
+            bsl::vector<int> evicted(&ta);
+            EvictionRecorder recorder = { &evicted };
+
+            Obj mX(Policy::e_LRU, 3, 5, 1, &ta);  const Obj& X = mX;
+            mX.setPostEvictionCallback(recorder);
+
+            for (int i = 0; i < 5; ++i) {
+                mX.insert(i, i);
+            }
+
+            IntPtr value;
+            ASSERT(0 == mX.tryGetValue(&value, 0));
+            ASSERT(0 == mX.tryGetValue(&value, 1, false));
+
+            // Queue: 0* 1 2 3 4; '0' is referenced and gets a second chance.
+
+            mX.insert(5, 5);
+            ASSERTV(evicted.size(), 3 == evicted.size());
+            ASSERT(1 == evicted[0]);
+            ASSERT(2 == evicted[1]);
+            ASSERT(3 == evicted[2]);
+            ASSERT(3 == X.size());
+
+            // Queue: 4 0 5; re-insert '4' to move it to the back.
+
+            mX.insert(4, 40);
+            ASSERT(3 == X.size());
+            ASSERT(0 == mX.tryGetValue(&value, 5));
+            mX.insert(6, 6);
+            mX.insert(7, 7);
+            ASSERT(5 == X.size());
+            ASSERT(3 == evicted.size());
+
+            // Queue: 0 5* 4 6 7.
+
+            ASSERT(0 == mX.popFront());
+            ASSERT(0 == evicted.back());
+            ASSERT(0 == mX.popFront());
+            ASSERT(40 == evicted.back());
+            ASSERT(0 == mX.popFront());
+            ASSERT(6 == evicted.back());
+            ASSERT(0 == mX.popFront());
+            ASSERT(7 == evicted.back());
+            ASSERT(0 == mX.popFront());
+            ASSERT(5 == evicted.back());
+            ASSERT(1 == mX.popFront());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (veryVerbose) cout << "LRU with every item referenced" << endl;
+        {
+            bsl::vector<int> evicted(&ta);
+            EvictionRecorder recorder = { &evicted };
+
+            Obj mX(Policy::e_LRU, 3, 3, 1, &ta);
+            mX.setPostEvictionCallback(recorder);
+
+            IntPtr value;
+            for (int i = 0; i < 3; ++i) {
+                mX.insert(i, i);
+                ASSERT(0 == mX.tryGetValue(&value, i));
+            }
+            mX.insert(3, 3);
+            ASSERT(1 == evicted.size());
+            ASSERT(0 == evicted.back());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (veryVerbose) cout << "Multiple shards" << endl;
+        {
+            static const struct {
+                int         d_line;       // source line number
+                bsl::size_t d_low;        // low watermark
+                bsl::size_t d_high;       // high watermark
+                bsl::size_t d_numShards;  // number of shards
+            } DATA[] = {
+                //LINE  LOW  HIGH  NS
+                //----  ---  ----  --
+                { L_,    80,  100,  2 },
+                { L_,    80,  100,  4 },
+                { L_,    80,  100, 16 },
+                { L_,    90,  100, 64 },
+                { L_,     5,    7,  4 },
+                { L_,    13,   13,  8 },
+                { L_,     1,    3,  8 },
+                { L_,     1,    1, 16 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE = DATA[ti].d_line;
+                const bsl::size_t LOW  = DATA[ti].d_low;
+                const bsl::size_t HIGH = DATA[ti].d_high;
+                const bsl::size_t NS   = DATA[ti].d_numShards;
+
+                Obj mX(Policy::e_LRU, LOW, HIGH, NS, &ta);  const Obj& X = mX;
+                ASSERTV(LINE, NS == X.numShards());
+
+                for (int i = 0; i < 1000; ++i) {
+                    mX.insert(i, i);
+                    ASSERTV(LINE, i, X.size(), X.size() <= X.highWatermark());
+                }
+                ASSERTV(LINE, X.size(), X.size() + NS >= LOW);
+
+                bsl::size_t n = X.size();
+                while (0 == mX.popFront()) {
+                    --n;
+                    ASSERTV(LINE, n, X.size(), n == X.size());
+                }
+                ASSERTV(LINE, 0 == n);
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MAP SEMANTICS AND POST-EVICTION CALLBACK
+        //
+        // Concerns:
+        //: 1 'insert', 'tryGetValue', 'erase', 'size', and 'clear' behave as
+        //:   for a map, including for keys whose hash values collide.
+        //:
+        //: 2 'erase' invokes the post-eviction callback, and 'clear' does not.
+        //:
+        //: 3 The cache does not allocate memory when items are replaced by new
+        //:   ones after the cache reached its steady-state size.
+        //:
+        //: 4 All memory is released on destruction.
+        //
+        // Plan:
+        //: 1 Perform a long random sequence of inserts and erasures on a cache
+        //:   with a colliding hash functor, comparing after every operation
+        //:   with a 'bsl::map' oracle.  (C-1)
+        //:
+        //: 2 Erase items with and without a callback, and clear the cache.
+        //:   (C-2)
+        //:
+        //: 3 Insert keys with shared value pointers in a loop, and check the
+        //:   number of allocations.  (C-3)
+        //:
+        //: 4 Use a test allocator.  (C-4)
+        //
+        // Testing:
+        //   void clear();
+        //   int erase(const KEY& key);
+        //   void insert(const KEY& key, const VALUE& value);
+        //   void insert(const KEY& key, const ValuePtrType& valuePtr);
+        //   void setPostEvictionCallback(postEvictionCallback);
+        //   int tryGetValue(value, key, modifyEvictionQueue);
+        //   bsl::size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                  << "MAP SEMANTICS AND POST-EVICTION CALLBACK" << endl
+                  << "========================================" << endl;
+
+        if (veryVerbose) cout << "Random operations against an oracle" << endl;
+        {
+            typedef bdlcc::ShardedCache<int, int, CollidingHash> CObj;
+
+            const int SHARDS[] = { 1, 4 };
+            for (int s = 0; s < 2; ++s) {
+                CObj mX(Policy::e_FIFO,
+                        100000,
+                        100000,
+                        SHARDS[s],
+                        CollidingHash(),
+                        bsl::equal_to<int>(),
+                        &ta);
+                const CObj& X = mX;
+
+                bsl::map<int, int> oracle(&ta);
+
+                unsigned int seed = 12345;
+                for (int i = 0; i < 20000; ++i) {
+                    seed = seed * 1103515245 + 12345;
+                    const int key = static_cast<int>((seed >> 8) % 300);
+                    if ((seed >> 4) % 3) {
+                        mX.insert(key, i);
+                        oracle[key] = i;
+                    }
+                    else {
+                        const int rc = mX.erase(key);
+                        const bool found = 1 == oracle.erase(key);
+                        ASSERTV(key, rc, (0 == rc) == found);
+                    }
+                    ASSERTV(i, X.size() == oracle.size());
+
+                    if (0 == i % 1000) {
+                        for (int k = 0; k < 300; ++k) {
+                            IntPtr value;
+                            const int rc = mX.tryGetValue(&value, k);
+                            bsl::map<int, int>::const_iterator it =
+                                                              oracle.find(k);
+                            if (oracle.end() == it) {
+                                ASSERTV(i, k, 1 == rc);
+                            }
+                            else {
+                                ASSERTV(i, k, 0 == rc);
+                                ASSERTV(i, k, it->second == *value);
+                            }
+                        }
+                    }
+                }
+
+                mX.clear();
+                ASSERT(0 == X.size());
+                for (int k = 0; k < 300; ++k) {
+                    ASSERTV(k, !hasKey(&mX, k));
+                }
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (veryVerbose) cout << "Post-eviction callback" << endl;
+        {
+            bsl::vector<int> evicted(&ta);
+            EvictionRecorder recorder = { &evicted };
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            mX.insert(1, 10);
+            mX.insert(2, 20);
+            mX.insert(3, 30);
+
+            ASSERT(0 == mX.erase(1));
+            ASSERT(0 == evicted.size());
+
+            mX.setPostEvictionCallback(recorder);
+
+            ASSERT(0 == mX.erase(2));
+            ASSERT(1 == mX.erase(2));
+            ASSERT(1 == evicted.size());
+            ASSERT(20 == evicted[0]);
+
+            mX.clear();
+            ASSERT(0 == X.size());
+            ASSERT(1 == evicted.size());
+
+            mX.setPostEvictionCallback(Obj::PostEvictionCallback());
+            mX.insert(4, 40);
+            ASSERT(0 == mX.erase(4));
+            ASSERT(1 == evicted.size());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (veryVerbose) cout << "Steady-state allocation" << endl;
+        {
+            Obj mX(Policy::e_LRU, 400, 500, 4, &ta);
+
+            IntPtr value = bsl::allocate_shared<int>(&ta, 7);
+
+            for (int i = 0; i < 5000; ++i) {
+                mX.insert(i, value);
+            }
+            const bsls::Types::Int64 numAllocations = ta.numAllocations();
+            for (int i = 5000; i < 50000; ++i) {
+                mX.insert(i, value);
+            }
+            ASSERTV(ta.numAllocations() - numAllocations,
+                    numAllocations == ta.numAllocations());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates an empty cache having the specified (or
+        //:   default) attributes.
+        //:
+        //: 2 The number of shards is rounded up to a power of two.
+        //:
+        //: 3 Memory is supplied by the specified allocator, or the default
+        //:   allocator if none is specified, and released on destruction.
+        //
+        // Plan:
+        //: 1 Construct caches with each constructor and verify the accessors
+        //:   and the allocators used.  (C-1..3)
+        //
+        // Testing:
+        //   explicit ShardedCache(bslma::Allocator *basicAllocator);
+        //   ShardedCache(policy, lowWatermark, highWatermark, basicAllocator);
+        //   ShardedCache(policy, lowWat, highWat, numShards, basicAllocator);
+        //   ShardedCache(policy, lowWat, highWat, numShards, hash, equal, a);
+        //   ~ShardedCache();
+        //   EQUAL equalFunction() const;
+        //   CacheEvictionPolicy::Enum evictionPolicy() const;
+        //   HASH hashFunction() const;
+        //   bsl::size_t highWatermark() const;
+        //   bsl::size_t lowWatermark() const;
+        //   bsl::size_t numShards() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(Policy::e_LRU == X.evictionPolicy());
+            ASSERT(bsl::numeric_limits<bsl::size_t>::max() ==
+                                                          X.lowWatermark());
+            ASSERT(bsl::numeric_limits<bsl::size_t>::max() ==
+                                                         X.highWatermark());
+            ASSERT(Obj::k_DEFAULT_NUM_SHARDS == X.numShards());
+            ASSERT(0 == X.size());
+            ASSERT(0 <  da.numBytesInUse());
+            ASSERT(0 == ta.numBytesInUse());
+        }
+        ASSERT(0 == da.numBytesInUse());
+        {
+            Obj mX(Policy::e_FIFO, 10, 20, &ta);  const Obj& X = mX;
+
+            ASSERT(Policy::e_FIFO == X.evictionPolicy());
+            ASSERT(10 == X.lowWatermark());
+            ASSERT(20 == X.highWatermark());
+            ASSERT(Obj::k_DEFAULT_NUM_SHARDS == X.numShards());
+            ASSERT(0 == X.size());
+            ASSERT(0 <  ta.numBytesInUse());
+            ASSERT(0 == da.numBytesInUse());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        const struct {
+            int         d_line;
+            bsl::size_t d_numShards;
+            bsl::size_t d_expected;
+        } DATA[] = {
+            { L_,   1,   1 },
+            { L_,   2,   2 },
+            { L_,   3,   4 },
+            { L_,   5,   8 },
+            { L_,  64,  64 },
+            { L_,  65, 128 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const bsl::size_t NS   = DATA[ti].d_numShards;
+            const bsl::size_t EXP  = DATA[ti].d_expected;
+
+            {
+                Obj mX(Policy::e_LRU, 1, 2, NS, &ta);  const Obj& X = mX;
+
+                ASSERTV(LINE, EXP == X.numShards());
+                ASSERTV(LINE, 1 == X.lowWatermark());
+                ASSERTV(LINE, 2 == X.highWatermark());
+            }
+            {
+                Obj mX(Policy::e_FIFO,
+                       5,
+                       6,
+                       NS,
+                       bsl::hash<int>(),
+                       bsl::equal_to<int>(),
+                       &ta);
+                const Obj& X = mX;
+
+                ASSERTV(LINE, EXP == X.numShards());
+                ASSERTV(LINE, Policy::e_FIFO == X.evictionPolicy());
+                ASSERTV(LINE, X.hashFunction()(17) == bsl::hash<int>()(17));
+                ASSERTV(LINE, X.equalFunction()(3, 3));
+                ASSERTV(LINE, !X.equalFunction()(3, 4));
+            }
+            ASSERTV(LINE, 0 == ta.numBytesInUse());
+        }
+        ASSERT(0 == da.numBytesInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, look up, replace, and erase a few items.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(Policy::e_LRU, 100, 200, 4, &ta);  const Obj& X = mX;
+
+        for (int i = 0; i < 50; ++i) {
+            mX.insert(i, i * 2);
+        }
+        ASSERT(50 == X.size());
+
+        IntPtr value;
+        for (int i = 0; i < 50; ++i) {
+            ASSERTV(i, 0 == mX.tryGetValue(&value, i));
+            ASSERTV(i, i * 2 == *value);
+        }
+        ASSERT(1 == mX.tryGetValue(&value, 50));
+
+        mX.insert(7, 700);
+        ASSERT(50 == X.size());
+        ASSERT(0 == mX.tryGetValue(&value, 7));
+        ASSERT(700 == *value);
+
+        ASSERT(0 == mX.erase(7));
+        ASSERT(1 == mX.tryGetValue(&value, 7));
+        ASSERT(49 == X.size());
+
+        ASSERT(0 == mX.popFront());
+        ASSERT(48 == X.size());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'bdlcc::Cache'
+        //
+        // Concerns:
+        //: 1 On a read-mostly LRU workload, 'bdlcc::ShardedCache' sustains a
+        //:   higher throughput than 'bdlcc::Cache', whose lookups serialize on
+        //:   a write lock.
+        //
+        // Plan:
+        //: 1 Using 'bslmt::ThroughputBenchmark', measure the number of work
+        //:   units (of 100 operations) per second for both caches for various
+        //:   numbers of threads.  Print the results in CSV format.
+        //:
+        //: 2 The test takes the following optional arguments:
+        //:   'numThreads' (comma-separated list), 'numKeys', 'writeRatio' (one
+        //:   in 'writeRatio' operations is an insert; 0 for none),
+        //:   'numShards', 'numMillis', and 'numSamples'.
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH 'bdlcc::Cache'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                   << "PERFORMANCE: COMPARISON WITH 'bdlcc::Cache'" << endl
+                   << "===========================================" << endl;
+
+        bsl::vector<int> numThreads;
+        {
+            const char *spec = argc > 2 ? argv[2] : "1,2,4,8,16,40";
+            while (*spec) {
+                numThreads.push_back(atoi(spec));
+                while (*spec && ',' != *spec) {
+                    ++spec;
+                }
+                if (',' == *spec) {
+                    ++spec;
+                }
+            }
+        }
+        const int numKeys    = argc > 3 ? atoi(argv[3]) : 100000;
+        const int writeRatio = argc > 4 ? atoi(argv[4]) :     20;
+        const int numShards  = argc > 5 ? atoi(argv[5]) :     64;
+        const int numMillis  = argc > 6 ? atoi(argv[6]) :    500;
+        const int numSamples = argc > 7 ? atoi(argv[7]) :      5;
+
+        // Use a thread-safe allocator that does not serialize allocations,
+        // and does not print (the arguments make 'veryVeryVerbose' 'true').
+
+        bslma::Allocator *benchAllocator =
+                                      &bslma::NewDeleteAllocator::singleton();
+        bslma::DefaultAllocatorGuard benchGuard(benchAllocator);
+
+        cout << "threads,Cache,ShardedCache,ratio\n";
+
+        for (bsl::size_t i = 0; i < numThreads.size(); ++i) {
+            const int NT = numThreads[i];
+
+            bdlcc::Cache<int, int> cache(Policy::e_LRU,
+                                         numKeys,
+                                         numKeys + numKeys / 10 + 1,
+                                         benchAllocator);
+            Obj                    sharded(Policy::e_LRU,
+                                           numKeys,
+                                           numKeys + numKeys / 10 + 1,
+                                           numShards,
+                                           benchAllocator);
+
+            const double base = bench::measure(&cache,
+                                               NT,
+                                               numKeys,
+                                               writeRatio,
+                                               numMillis,
+                                               numSamples);
+            const double opt  = bench::measure(&sharded,
+                                               NT,
+                                               numKeys,
+                                               writeRatio,
+                                               numMillis,
+                                               numSamples);
+
+            cout << NT << ','
+                 << bsl::fixed << bsl::setprecision(0) << base << ','
+                 << opt << ','
+                 << bsl::setprecision(2) << (0 < base ? opt / base : 0.0)
+                 << '\n';
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
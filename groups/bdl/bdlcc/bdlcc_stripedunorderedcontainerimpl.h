@@ -398,7 +398,12 @@ class StripedUnorderedContainerImpl_LockElementWriteGuard;
 template <class KEY, class VALUE, class HASH, class EQUAL>
 class StripedUnorderedContainerImpl {
     // This class implements the logic for a striped hash multimap with logic
-    // that supports a (unique) map as a special case.
+    // that supports a (unique) map as a special case.  The lookup-only
+    // methods are templated on the type of the key searched for ('LOOKUP_KEY')
+    // so that the owning container can offer heterogeneous lookup when 'HASH'
+    // and 'EQUAL' are transparent; the behavior is undefined unless 'HASH'
+    // accepts a 'LOOKUP_KEY' and 'EQUAL' compares it with a 'KEY' consistently
+    // with 'HASH'.
 
   public:
     // TYPES
@@ -542,7 +547,8 @@ class StripedUnorderedContainerImpl {
         // Perform a rehash if the 'loadFactor() > maxLoadFactor()', and
         // 'true == canRehash()'.
 
-    bsl::size_t erase(const KEY& key, Scope scope);
+    template <class LOOKUP_KEY>
+    bsl::size_t erase(const LOOKUP_KEY& key, Scope scope);
         // Remove from this hash map the element, if any, having the specified
         // 'key'.  If there a multiple elements having 'key' and the specified
         // 'scope' is 'e_SCOPE_ALL', erase them all; otherwise; erase just the
@@ -661,8 +667,22 @@ class StripedUnorderedContainerImpl {
         // note that specifying 'e_SCOPE_FIRST' is more performant when there
         // is a single element in the bucket having 'key'.
 
+    template <class LOOKUP_KEY>
+    int updateImp(const LOOKUP_KEY&      key,
+                  const KEY             *visitorKey,
+                  const VisitorFunction& visitor);
+        // Serially call the specified 'visitor' on each element (if one
+        // exists) in this hash map having the specified 'key' until every such
+        // element has been updated or until 'visitor' returns 'false', passing
+        // the specified '*visitorKey' if 'visitorKey' is not 0, and the key of
+        // the element otherwise.  Return the number of elements visited or the
+        // negation of that value if visitations stopped because 'visitor'
+        // returned 'false'.
+
     // PRIVATE ACCESSORS
-    bsl::size_t bucketIndex(const KEY& key, bsl::size_t numBuckets) const;
+    template <class LOOKUP_KEY>
+    bsl::size_t bucketIndex(const LOOKUP_KEY& key,
+                            bsl::size_t       numBuckets) const;
         // Return the index of the bucket, in the array of buckets maintained
         // by this hash map, where values having a key equivalent to the
         // specified 'key' would be inserted using the specified 'numBuckets'.
@@ -673,13 +693,17 @@ class StripedUnorderedContainerImpl {
     bsl::size_t bucketToStripe(bsl::size_t bucketIndex) const;
         // Return the stripe index associated with the specified 'bucketIndex'.
 
-    LockElement *lockRead(bsl::size_t *bucketIdx, const KEY& key) const;
+    template <class LOOKUP_KEY>
+    LockElement *lockRead(bsl::size_t       *bucketIdx,
+                          const LOOKUP_KEY&  key) const;
         // Lock for read the stripe related to the specified 'key', setting the
         // specified 'bucketIdx' to the bucket index associated with 'key'.
         // Return the address to the lock-element associated with the returned
         // 'bucketIdx'.
 
-    LockElement *lockWrite(bsl::size_t *bucketIdx, const KEY& key) const;
+    template <class LOOKUP_KEY>
+    LockElement *lockWrite(bsl::size_t       *bucketIdx,
+                           const LOOKUP_KEY&  key) const;
         // Lock for write the stripe related to the specified 'key', setting
         // the specified 'bucketIdx' to the bucket index associated with 'key'.
         // Return the address to the lock-element associated with the returned
@@ -719,7 +743,8 @@ class StripedUnorderedContainerImpl {
         // factor to its current value) will trigger a rehash if needed but
         // otherwise does not change the hash map.
 
-    bsl::size_t eraseAll(const KEY& key);
+    template <class LOOKUP_KEY>
+    bsl::size_t eraseAll(const LOOKUP_KEY& key);
         // Erase from this hash map the elements having the specified 'key'.
         // Return the number of elements erased.
 
@@ -746,7 +771,8 @@ class StripedUnorderedContainerImpl {
         // elements removed.  The behavior is undefined unless 'first <= last'.
         // Note that the map may not have an element for every value in 'keys'.
 
-    bsl::size_t eraseFirst(const KEY& key);
+    template <class LOOKUP_KEY>
+    bsl::size_t eraseFirst(const LOOKUP_KEY& key);
         // Erase from this hash map the *first* element (of possibly many)
         // found to the specified 'key'.  Return the number of elements erased.
         // Note that method is more performant than 'eraseAll' when there is
@@ -907,6 +933,23 @@ class StripedUnorderedContainerImpl {
         // map manipulators and 'getValue*' methods are invoked from within
         // 'visitor', as it may lead to a deadlock.
 
+    template <class LOOKUP_KEY>
+    int update(const LOOKUP_KEY& key, const VisitorFunction& visitor);
+        // Serially call the specified 'visitor' on each element (if one
+        // exists) in this hash map having a key equivalent to the specified
+        // 'key' until every such element has been updated or until 'visitor'
+        // returns 'false'.  That is, for '(elementKey, value)', invoke:
+        //..
+        //  bool visitor(&value, elementKey);
+        //..
+        // Return the number of elements visited or the negation of that value
+        // if visitations stopped because 'visitor' returned 'false'.
+        // 'visitor' has exclusive access (i.e., write access) to each element
+        // for duration of each invocation.  The behavior is undefined if hash
+        // map manipulators and 'getValue*' methods are invoked from within
+        // 'visitor', as it may lead to a deadlock.  Note that, as 'key' is not
+        // a 'KEY', 'visitor' is passed the key of each element instead.
+
     int visit(const VisitorFunction& visitor);
         // Call the specified 'visitor' (in an unspecified order) on the
         // elements in this hash table having the specified 'key' either until
@@ -929,7 +972,8 @@ class StripedUnorderedContainerImpl {
         // change the value of the visited elements.
 
     // ACCESSORS
-    bsl::size_t bucketIndex(const KEY& key) const;
+    template <class LOOKUP_KEY>
+    bsl::size_t bucketIndex(const LOOKUP_KEY& key) const;
         // Return the index of the bucket, in the array of buckets maintained
         // by this hash map, where elements having the specified 'key' are
         // inserted.  Note that unless rehash is disabled, the value returned
@@ -959,7 +1003,8 @@ class StripedUnorderedContainerImpl {
         // that returns 'true' if two 'KEY' objects have the same value, and
         // 'false' otherwise.
 
-    bsl::size_t getValue(VALUE *value, const KEY& key) const;
+    template <class LOOKUP_KEY>
+    bsl::size_t getValue(VALUE *value, const LOOKUP_KEY& key) const;
         // Load, into the specified '*value', the value attribute of the first
         // element (of possibly many elements) found in this hash map having
         // the specified 'key'.  Return 1 on success, and 0 if 'key' does not
@@ -968,7 +1013,9 @@ class StripedUnorderedContainerImpl {
         // having 'key', the selection of "first" is implementation specific
         // and subject to change.
 
-    bsl::size_t getValue(bsl::vector<VALUE> *valuesPtr, const KEY& key) const;
+    template <class LOOKUP_KEY>
+    bsl::size_t getValue(bsl::vector<VALUE> *valuesPtr,
+                         const LOOKUP_KEY&   key) const;
         // Load, into the specified '*valuesPtr', the value attributes of every
         // element in this hash map having the specified 'key'.  Return the
         // number of elements found with 'key'.  Note that the order of the
@@ -1725,9 +1772,10 @@ void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::checkRehash()
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
 bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::erase(
-                                                              const KEY& key,
-                                                              Scope      scope)
+                                                      const LOOKUP_KEY& key,
+                                                      Scope             scope)
 {
     bool        eraseAll = scope == e_SCOPE_ALL;
     bsl::size_t bucketIdx;
@@ -2083,13 +2131,43 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setValue(
     return count;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
+int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::updateImp(
+                                             const LOOKUP_KEY&      key,
+                                             const KEY             *visitorKey,
+                                             const VisitorFunction& visitor)
+{
+    bsl::size_t bucketIdx;
+    LEWGuard    guard(lockWrite(&bucketIdx, key));
+
+    StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket =
+                                                          d_buckets[bucketIdx];
+
+    // Loop on the elements in the list
+    int                                             count = 0;
+    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = bucket.head();
+    for (; curNode != NULL; curNode = curNode->next()) {
+        if (d_comparator(curNode->key(), key)) {
+            ++count;
+            bool ret = visitor(&curNode->value(),
+                               visitorKey ? *visitorKey : curNode->key());
+            if (ret == false) {
+                return -count;                                        // RETURN
+            }
+        }
+    }
+    return count;
+}
+
 // PRIVATE ACCESSORS
 template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
 inline
 bsl::size_t
 StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::bucketIndex(
-                                                  const KEY&  key,
-                                                  bsl::size_t numBuckets) const
+                                            const LOOKUP_KEY& key,
+                                            bsl::size_t       numBuckets) const
 {
     bsl::size_t hashVal   = d_hasher(key);
     bsl::size_t bucketIdx =
@@ -2107,11 +2185,12 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::bucketToStripe(
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
 inline
 StripedUnorderedContainerImpl_LockElement *
 StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::lockRead(
-                                                       bsl::size_t  *bucketIdx,
-                                                       const KEY&    key) const
+                                                 bsl::size_t       *bucketIdx,
+                                                 const LOOKUP_KEY&  key) const
 {
     // From key, get hash value, and current number of buckets.
     bsl::size_t  hashVal    = d_hasher(key);
@@ -2131,11 +2210,12 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::lockRead(
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
 inline
 StripedUnorderedContainerImpl_LockElement *
 StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::lockWrite(
-                                                       bsl::size_t  *bucketIdx,
-                                                       const KEY&    key) const
+                                                 bsl::size_t       *bucketIdx,
+                                                 const LOOKUP_KEY&  key) const
 {
     // From key, get hash value, and current number of buckets.
     bsl::size_t  hashVal      = d_hasher(key);
@@ -2241,9 +2321,10 @@ void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::enableRehash()
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
 inline
 bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::eraseAll(
-                                                                const KEY& key)
+                                                         const LOOKUP_KEY& key)
 {
     return erase(key, e_SCOPE_ALL);
 }
@@ -2275,9 +2356,10 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::eraseBulkFirst(
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
 inline
 bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::eraseFirst(
-                                                                const KEY& key)
+                                                         const LOOKUP_KEY& key)
 {
     return erase(key, e_SCOPE_FIRST);
 }
@@ -2505,25 +2587,17 @@ int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::update(
                                                 const KEY&             key,
                                                 const VisitorFunction& visitor)
 {
-    bsl::size_t bucketIdx;
-    LEWGuard    guard(lockWrite(&bucketIdx, key));
-
-    StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket =
-                                                          d_buckets[bucketIdx];
+    return updateImp(key, &key, visitor);
+}
 
-    // Loop on the elements in the list
-    int                                             count = 0;
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = bucket.head();
-    for (; curNode != NULL; curNode = curNode->next()) {
-        if (d_comparator(curNode->key(), key)) {
-            ++count;
-            bool ret = visitor(&curNode->value(), key);
-            if (ret == false) {
-                return -count;                                        // RETURN
-            }
-        }
-    }
-    return count;
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
+inline
+int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::update(
+                                                const LOOKUP_KEY&      key,
+                                                const VisitorFunction& visitor)
+{
+    return updateImp(key, 0, visitor);
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -2568,10 +2642,11 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::bucketCount() const
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
 inline
 bsl::size_t
 StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::bucketIndex(
-                                                          const KEY& key) const
+                                                   const LOOKUP_KEY& key) const
 {
     return bucketIndex(key, d_numBuckets);
 }
@@ -2615,10 +2690,11 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::equalFunction() const
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
 inline
 bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::getValue(
-                                                         VALUE      *value,
-                                                         const KEY&  key) const
+                                                  VALUE             *value,
+                                                  const LOOKUP_KEY&  key) const
 {
     BSLS_ASSERT(NULL != value);
 
@@ -2639,10 +2715,11 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::getValue(
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
 inline
 bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::getValue(
                                                  bsl::vector<VALUE> *valuesPtr,
-                                                 const KEY&          key) const
+                                                 const LOOKUP_KEY&   key) const
 {
     BSLS_ASSERT(NULL != valuesPtr);
 
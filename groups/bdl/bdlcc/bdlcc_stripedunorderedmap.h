@@ -84,6 +84,17 @@ BSLS_IDENT("$Id: $")
 // seen in *this* component is the degenerate case when the number of elements
 // updated (or inserted) is limited to 0 or 1.
 //
+///Heterogeneous Lookup
+///--------------------
+// If both the 'HASH' and 'EQUAL' types declare a nested 'is_transparent' type,
+// the 'erase', 'getValue', 'update', and 'bucketIndex' methods additionally
+// accept any key type that 'HASH' can hash and 'EQUAL' can compare with
+// 'KEY'.  This allows, for example, a map keyed on 'bsl::string' to be
+// queried with a 'bslstl::StringRef' without materializing a temporary
+// 'bsl::string' (and the allocation that may come with it) per call.  The
+// user is responsible for ensuring that 'HASH' produces the same hash value
+// for a lookup key as for the equivalent 'KEY'.
+//
 ///Rehash
 ///------
 //
@@ -344,6 +355,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlcc_stripedunorderedcontainerimpl.h>
 
+#include <bslmf_enableif.h>
+#include <bslmf_istransparentpredicate.h>
 #include <bslmf_movableref.h>
 
 #include <bsls_assert.h>
@@ -454,6 +467,23 @@ class StripedUnorderedMap {
         // Return 1 on success and 0 if 'key' does not exist.  Note that the
         // returned value equals the number of elements removed.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        bsl::size_t>::type
+    erase(const LOOKUP_KEY& key)
+        // Erase from this hash map the element having a key equivalent to the
+        // specified 'key'.  Return 1 on success and 0 if no such element
+        // exists.  Note that this overload participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent (see
+        // {Heterogeneous Lookup}), and no 'KEY' object is created from 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_imp.eraseFirst(key);
+    }
+
     template <class RANDOM_ITER>
     bsl::size_t eraseBulk(RANDOM_ITER first, RANDOM_ITER last);
         // Erase from this hash map elements in this hash map having any of the
@@ -560,6 +590,26 @@ class StripedUnorderedMap {
         // hash map manipulators and 'getValue*' methods are invoked from
         // within 'visitor', as it may lead to a deadlock.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        int>::type
+    update(const LOOKUP_KEY& key, const VisitorFunction& visitor)
+        // Call the specified 'visitor' with the element (if one exists) in
+        // this hash map having a key equivalent to the specified 'key', as
+        // 'visitor(&value, elementKey)'.  Return the number of elements
+        // updated or -1 if 'visitor' returned 'false'.  The behavior is
+        // undefined if hash map manipulators and 'getValue*' methods are
+        // invoked from within 'visitor'.  Note that this overload participates
+        // in overload resolution only if both 'HASH' and 'EQUAL' are
+        // transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_imp.update(key, visitor);
+    }
+
     int visit(const VisitorFunction& visitor);
         // Call the specified 'visitor' (in an unspecified order) on all
         // elements in this hash table until each such element has been
@@ -593,6 +643,23 @@ class StripedUnorderedMap {
         // inserted.  Note that unless rehash is disabled, the value returned
         // may be obsolete at the time it is returned.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        bsl::size_t>::type
+    bucketIndex(const LOOKUP_KEY& key) const
+        // Return the index of the bucket, in the array of buckets maintained
+        // by this hash map, where elements having a key equivalent to the
+        // specified 'key' are inserted.  Note that this overload participates
+        // in overload resolution only if both 'HASH' and 'EQUAL' are
+        // transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_imp.bucketIndex(key);
+    }
+
     bsl::size_t bucketSize(bsl::size_t index) const;
         // Return the number of elements contained in the bucket at the
         // specified 'index' in the array of buckets maintained by this hash
@@ -615,6 +682,26 @@ class StripedUnorderedMap {
         // success and 0 if 'key' does not exist in this hash map.  Note that
         // the return value equals the number of values returned.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        bsl::size_t>::type
+    getValue(VALUE *value, const LOOKUP_KEY& key) const
+        // Load, into the specified '*value', the value attribute of the
+        // element in this hash map having a key equivalent to the specified
+        // 'key'.  Return 1 on success and 0 if no such element exists.  Note
+        // that this overload participates in overload resolution only if both
+        // 'HASH' and 'EQUAL' are transparent, and no 'KEY' object is created
+        // from 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        BSLS_ASSERT(NULL != value);
+
+        return d_imp.getValue(value, key);
+    }
+
     HASH hashFunction() const;
         // Return (a copy of) the unary hash functor used by this hash map.
         // The return function will generate a hash value (of type
@@ -41,6 +41,7 @@
 #include <bsltf_uniontesttype.h>
 
 #include <bslmf_assert.h>
+#include <bslstl_stringref.h>
 #include <bsls_asserttest.h>
 #include <bsls_atomic.h>
 #include <bsls_nameof.h>
@@ -148,10 +149,11 @@ using namespace bsl;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [20] USAGE EXAMPLE
+// [21] USAGE EXAMPLE
 // [15] TYPE TRAITS
 // [18] MULTI-THREADED STRESS TEST
 // [19] DRQS 155023497: 'erase' MEMORY CORRUPTION
+// [20] CONCERN: heterogeneous lookup with transparent functors
 // [-1] PERFORMANCE TEST INT->STRING
 // [-2] PERFORMANCE TEST STRING->INT64
 // [-4] READ WRITE PERFORMANCE
@@ -506,6 +508,61 @@ void example3()
 namespace {
 typedef bsltf::TemplateTestFacility TstFacility;
 
+                        // ============================
+                        // struct TransparentStringHash
+                        // ============================
+
+struct TransparentStringHash {
+    // This 'struct' provides a transparent hash functor that hashes both
+    // 'bsl::string' and 'bslstl::StringRef' objects without creating a
+    // 'bsl::string'.
+
+    typedef void is_transparent;
+
+    bsl::size_t operator()(const bslstl::StringRef& key) const
+        // Return the hash of the specified 'key'.
+    {
+        return bsl::hash<bslstl::StringRef>()(key);
+    }
+};
+
+                        // =============================
+                        // struct TransparentStringEqual
+                        // =============================
+
+struct TransparentStringEqual {
+    // This 'struct' provides a transparent key-equality functor that compares
+    // 'bsl::string' and 'bslstl::StringRef' objects without creating a
+    // 'bsl::string'.
+
+    typedef void is_transparent;
+
+    bool operator()(const bslstl::StringRef& lhs,
+                    const bslstl::StringRef& rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' have the same value,
+        // and 'false' otherwise.
+    {
+        return lhs == rhs;
+    }
+};
+
+bool incrementVisitor(int *value, const bsl::string&)
+    // Increment the specified '*value' and return 'true'.
+{
+    ++*value;
+    return true;
+}
+
+const bsl::string *s_visitedKey_p = 0;  // key passed to 'recordingVisitor'
+
+bool recordingVisitor(int *, const bsl::string& key)
+    // Load the address of the specified 'key' into 's_visitedKey_p' and
+    // return 'true'.
+{
+    s_visitedKey_p = &key;
+    return true;
+}
+
 }  // close unnamed namespace
 
 
@@ -6116,7 +6173,7 @@ int main(int argc, char *argv[])
 
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
-      case 20: {
+      case 21: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -6139,6 +6196,97 @@ int main(int argc, char *argv[])
         usage::example3();
 
       } break;
+      case 20: {
+        // --------------------------------------------------------------------
+        // HETEROGENEOUS LOOKUP
+        //
+        // Concerns:
+        //: 1 When 'HASH' and 'EQUAL' are transparent, 'getValue', 'update',
+        //:   'erase', and 'bucketIndex' accept a key of a type other than
+        //:   'KEY'.
+        //:
+        //: 2 No 'KEY' object is created, so no memory is allocated, by a
+        //:   heterogeneous lookup.
+        //:
+        //: 3 The 'visitor' passed to a heterogeneous 'update' is supplied
+        //:   with the key stored in the map, and the 'visitor' passed to an
+        //:   'update' with a 'KEY' is supplied with that 'KEY' object.
+        //
+        // Plan:
+        //: 1 Create a 'bsl::string'-keyed map using transparent functors,
+        //:   populate it with keys too long for the short-string buffer, and
+        //:   access them using 'bslstl::StringRef' keys, verifying the results
+        //:   and that neither the default nor the map's allocator is used.
+        //:   (C-1..2)
+        //:
+        //: 2 Call 'update' with both a 'bslstl::StringRef' and a 'bsl::string'
+        //:   key, using a visitor that records the address of the key it is
+        //:   passed, and verify that address.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: heterogeneous lookup with transparent functors
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "HETEROGENEOUS LOOKUP\n"
+                          << "====================\n";
+
+        typedef bdlcc::StripedUnorderedMap<bsl::string,
+                                           int,
+                                           TransparentStringHash,
+                                           TransparentStringEqual> Obj;
+
+        const char *KEYS[] = {
+            "a key too long for the short string buffer 0",
+            "a key too long for the short string buffer 1",
+            "a key too long for the short string buffer 2",
+        };
+        enum { NUM_KEYS = sizeof KEYS / sizeof *KEYS };
+
+        bslma::TestAllocator supplied("supplied", veryVeryVeryVerbose);
+        {
+            Obj mX(16, 4, &supplied);  const Obj& X = mX;
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                mX.setValue(bsl::string(KEYS[i], &supplied), i);
+            }
+
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const bslstl::StringRef KEY(KEYS[i]);
+                const bsl::string       STRING(KEYS[i], &supplied);
+
+                ASSERTV(i, X.bucketIndex(STRING) == X.bucketIndex(KEY));
+
+                int value = -1;
+                ASSERTV(i, 1 == X.getValue(&value, KEY));
+                ASSERTV(i, i == value);
+
+                ASSERTV(i, 1 == mX.update(KEY, &incrementVisitor));
+                ASSERTV(i, 1 == X.getValue(&value, KEY));
+                ASSERTV(i, i + 1 == value);
+
+                s_visitedKey_p = 0;
+                ASSERTV(i, 1 == mX.update(KEY, &recordingVisitor));
+                ASSERTV(i, s_visitedKey_p);
+                ASSERTV(i, s_visitedKey_p != &STRING);
+                ASSERTV(i, s_visitedKey_p && STRING == *s_visitedKey_p);
+
+                s_visitedKey_p = 0;
+                ASSERTV(i, 1 == mX.update(STRING, &recordingVisitor));
+                ASSERTV(i, &STRING == s_visitedKey_p);
+            }
+            ASSERT(0 == mX.update(bslstl::StringRef("none"),
+                                  &incrementVisitor));
+
+            ASSERT(1 == mX.erase(bslstl::StringRef(KEYS[0])));
+            ASSERT(0 == mX.erase(bslstl::StringRef(KEYS[0])));
+            ASSERT(NUM_KEYS - 1 == static_cast<int>(X.size()));
+
+            ASSERT(dam.isTotalSame());
+        }
+        ASSERT(0 == supplied.numBlocksInUse());
+      } break;
       case 19: {
         // --------------------------------------------------------------------
         // DRQS 155023497: 'erase' MEMORY CORRUPTION
@@ -15,6 +15,21 @@ BSLS_IDENT_RCSID(bdlde_base64decoder_cpp,"$Id$ $CSID$")
 #include <bdlde_base64encoder.h>  // for testing only
 
 #include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(BSLS_PLATFORM_CPU_X86)
+#if defined(BSLS_PLATFORM_CMP_CLANG) ||                                       \
+    (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900)
+#define BDLDE_BASE64DECODER_X86
+#include <immintrin.h>
+#endif
+#endif
 
 namespace BloombergLP {
 
@@ -93,6 +108,235 @@ static const char decoding[256] = {
        ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // F0
 };
 
+namespace {
+
+// The SIMD kernels below follow the approach described by W. Mula and
+// D. Lemire in "Faster Base64 Encoding and Decoding Using AVX2 Instructions":
+// each character is classified by looking up its high and low nibbles in two
+// 16-entry tables whose entries have a common bit set only for characters
+// outside the numeric Base64 alphabet, then translated to its 6-bit value by
+// adding an offset looked up by its high nibble ('/' being the only character
+// that needs special treatment), and finally groups of four 6-bit values are
+// packed into three bytes with two multiply-add instructions.
+
+bsl::size_t decodeQuantaScalar(char *out, const char *begin, const char *end)
+    // Write to the specified 'out' the bytes decoded from the longest prefix
+    // of the range '[begin, end)', using the specified 'begin' and 'end', that
+    // is a sequence of 4-character quanta consisting only of numeric Base64
+    // characters, and return the length of that prefix.
+{
+    const unsigned char *input = reinterpret_cast<const unsigned char *>(
+                                                                        begin);
+    bsl::size_t          done  = 0;
+    for (; end - begin - done >= 4; done += 4, out += 3) {
+        const unsigned c0 = static_cast<unsigned char>(decoding[input[0]]);
+        const unsigned c1 = static_cast<unsigned char>(decoding[input[1]]);
+        const unsigned c2 = static_cast<unsigned char>(decoding[input[2]]);
+        const unsigned c3 = static_cast<unsigned char>(decoding[input[3]]);
+
+        if ((c0 | c1 | c2 | c3) >= 64) {
+            break;
+        }
+
+        const unsigned value = (c0 << 18) | (c1 << 12) | (c2 << 6) | c3;
+        out[0] = static_cast<char>(value >> 16);
+        out[1] = static_cast<char>(value >>  8);
+        out[2] = static_cast<char>(value);
+        input += 4;
+    }
+    return done;
+}
+
+#if defined(BDLDE_BASE64DECODER_X86)
+
+__attribute__((target("ssse3")))
+bsl::size_t decodeQuantaSsse3(char *out, const char *begin, const char *end)
+    // Write to the specified 'out' the bytes decoded from a prefix of the
+    // range '[begin, end)', using the specified 'begin' and 'end', that is a
+    // sequence of 16-character blocks consisting only of numeric Base64
+    // characters, and return the length of that prefix.  The behavior is
+    // undefined unless the processor supports SSSE3 instructions.
+{
+    const __m128i highTable  = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02,
+                                             0x04, 0x08, 0x04, 0x08,
+                                             0x10, 0x10, 0x10, 0x10,
+                                             0x10, 0x10, 0x10, 0x10);
+    const __m128i lowTable   = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11,
+                                             0x11, 0x11, 0x11, 0x11,
+                                             0x11, 0x11, 0x13, 0x1A,
+                                             0x1B, 0x1B, 0x1B, 0x1A);
+    const __m128i rollTable  = _mm_setr_epi8(  0,  16,  19,   4,
+                                             -65, -65, -71, -71,
+                                               0,   0,   0,   0,
+                                               0,   0,   0,   0);
+    const __m128i slash      = _mm_set1_epi8(0x2F);
+    const __m128i nibble     = _mm_set1_epi8(0x0F);
+    const __m128i pack       = _mm_setr_epi8( 2,  1,  0,  6,  5,  4,
+                                             10,  9,  8, 14, 13, 12,
+                                             -1, -1, -1, -1);
+
+    bsl::size_t done = 0;
+    for (; end - begin - done >= 16; done += 16, out += 12) {
+        const __m128i input = _mm_loadu_si128(
+                              reinterpret_cast<const __m128i *>(begin + done));
+
+        const __m128i high = _mm_and_si128(_mm_srli_epi32(input, 4), nibble);
+        const __m128i low  = _mm_and_si128(input, nibble);
+        const __m128i bad  = _mm_and_si128(_mm_shuffle_epi8(highTable, high),
+                                           _mm_shuffle_epi8(lowTable,  low));
+        if (_mm_movemask_epi8(_mm_cmpgt_epi8(bad, _mm_setzero_si128()))) {
+            break;
+        }
+
+        const __m128i roll   = _mm_shuffle_epi8(
+                                   rollTable,
+                                   _mm_add_epi8(_mm_cmpeq_epi8(input, slash),
+                                                high));
+        const __m128i values = _mm_add_epi8(input, roll);
+
+        const __m128i pairs  = _mm_maddubs_epi16(values,
+                                                 _mm_set1_epi32(0x01400140));
+        const __m128i quanta = _mm_madd_epi16(pairs,
+                                              _mm_set1_epi32(0x00011000));
+        const __m128i bytes  = _mm_shuffle_epi8(quanta, pack);
+
+        // Store exactly 12 bytes, as 'out' may have no room for more.
+
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(out), bytes);
+        const int last = _mm_cvtsi128_si32(_mm_srli_si128(bytes, 8));
+        bsl::memcpy(out + 8, &last, 4);
+    }
+    return done;
+}
+
+__attribute__((target("avx2")))
+bsl::size_t decodeQuantaAvx2(char *out, const char *begin, const char *end)
+    // Write to the specified 'out' the bytes decoded from a prefix of the
+    // range '[begin, end)', using the specified 'begin' and 'end', that is a
+    // sequence of 32-character blocks consisting only of numeric Base64
+    // characters, and return the length of that prefix.  The behavior is
+    // undefined unless the processor supports AVX2 instructions.
+{
+    const __m256i highTable  = _mm256_broadcastsi128_si256(
+                                  _mm_setr_epi8(0x10, 0x10, 0x01, 0x02,
+                                                0x04, 0x08, 0x04, 0x08,
+                                                0x10, 0x10, 0x10, 0x10,
+                                                0x10, 0x10, 0x10, 0x10));
+    const __m256i lowTable   = _mm256_broadcastsi128_si256(
+                                  _mm_setr_epi8(0x15, 0x11, 0x11, 0x11,
+                                                0x11, 0x11, 0x11, 0x11,
+                                                0x11, 0x11, 0x13, 0x1A,
+                                                0x1B, 0x1B, 0x1B, 0x1A));
+    const __m256i rollTable  = _mm256_broadcastsi128_si256(
+                                  _mm_setr_epi8(  0,  16,  19,   4,
+                                                -65, -65, -71, -71,
+                                                  0,   0,   0,   0,
+                                                  0,   0,   0,   0));
+    const __m256i slash      = _mm256_set1_epi8(0x2F);
+    const __m256i nibble     = _mm256_set1_epi8(0x0F);
+    const __m256i pack       = _mm256_broadcastsi128_si256(
+                                  _mm_setr_epi8( 2,  1,  0,  6,  5,  4,
+                                                10,  9,  8, 14, 13, 12,
+                                                -1, -1, -1, -1));
+    const __m256i gather     = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+
+    bsl::size_t done = 0;
+    for (; end - begin - done >= 32; done += 32, out += 24) {
+        const __m256i input = _mm256_loadu_si256(
+                              reinterpret_cast<const __m256i *>(begin + done));
+
+        const __m256i high = _mm256_and_si256(_mm256_srli_epi32(input, 4),
+                                              nibble);
+        const __m256i low  = _mm256_and_si256(input, nibble);
+        const __m256i bad  = _mm256_and_si256(
+                                       _mm256_shuffle_epi8(highTable, high),
+                                       _mm256_shuffle_epi8(lowTable,  low));
+        if (_mm256_movemask_epi8(_mm256_cmpgt_epi8(bad,
+                                                   _mm256_setzero_si256()))) {
+            break;
+        }
+
+        const __m256i roll   = _mm256_shuffle_epi8(
+                             rollTable,
+                             _mm256_add_epi8(_mm256_cmpeq_epi8(input, slash),
+                                             high));
+        const __m256i values = _mm256_add_epi8(input, roll);
+
+        const __m256i pairs  = _mm256_maddubs_epi16(
+                                                values,
+                                                _mm256_set1_epi32(0x01400140));
+        const __m256i quanta = _mm256_madd_epi16(
+                                                pairs,
+                                                _mm256_set1_epi32(0x00011000));
+        const __m256i bytes  = _mm256_permutevar8x32_epi32(
+                                           _mm256_shuffle_epi8(quanta, pack),
+                                           gather);
+
+        // Store exactly 24 bytes, as 'out' may have no room for more.
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         _mm256_castsi256_si128(bytes));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(out + 16),
+                         _mm256_extracti128_si256(bytes, 1));
+    }
+    return done;
+}
+
+enum {
+    k_CPU_DETECTED = 1,  // the supported extensions have been detected
+    k_CPU_SSSE3    = 2,  // the processor supports SSSE3 instructions
+    k_CPU_AVX2     = 4   // the processor and the operating system support
+                         // AVX2 instructions
+};
+
+bsls::AtomicOperations::AtomicTypes::Int s_cpuFeatures;
+    // bitwise OR of the 'k_CPU_*' flags, or 0 if not yet detected
+
+int cpuFeatures()
+    // Return the bitwise OR of the 'k_CPU_*' flags describing the instruction
+    // set extensions supported by the processor, detecting them on first use.
+    // Note that concurrent first uses detect, and store, the same value.
+{
+    int features = bsls::AtomicOperations::getIntRelaxed(&s_cpuFeatures);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == features)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        __builtin_cpu_init();
+
+        features = k_CPU_DETECTED
+                 | (__builtin_cpu_supports("ssse3") ? k_CPU_SSSE3 : 0)
+                 | (__builtin_cpu_supports("avx2")  ? k_CPU_AVX2  : 0);
+
+        bsls::AtomicOperations::setIntRelaxed(&s_cpuFeatures, features);
+    }
+    return features;
+}
+
+#endif  // BDLDE_BASE64DECODER_X86
+
+bsl::size_t decodeQuanta(char *out, const char *begin, const char *end)
+    // Write to the specified 'out' the bytes decoded from the longest prefix
+    // of the range '[begin, end)', using the specified 'begin' and 'end', that
+    // is a sequence of 4-character quanta consisting only of numeric Base64
+    // characters, and return the length of that prefix.
+{
+    bsl::size_t done = 0;
+#if defined(BDLDE_BASE64DECODER_X86)
+    const int features = cpuFeatures();
+
+    if (features & k_CPU_AVX2) {
+        done = decodeQuantaAvx2(out, begin, end);
+    }
+    if (features & k_CPU_SSSE3) {
+        done += decodeQuantaSsse3(out + done / 4 * 3, begin + done, end);
+    }
+#endif
+    return done + decodeQuantaScalar(out + done / 4 * 3, begin + done, end);
+}
+
+}  // close unnamed namespace
+
 namespace bdlde {
 
                          // -------------------
@@ -106,6 +350,29 @@ const bool *const Base64Decoder::s_ignorableRelaxed_p =
                                             charsThatCanBeIgnoredInRelaxedMode;
 const char *const Base64Decoder::s_decoding_p = decoding;
 
+// CLASS METHODS
+int Base64Decoder::decodeBuffer(char       *out,
+                                int        *numOut,
+                                int        *numIn,
+                                const char *begin,
+                                const char *end,
+                                bool        unrecognizedIsErrorFlag)
+{
+    BSLS_ASSERT(numOut);
+    BSLS_ASSERT(numIn);
+
+    Base64Decoder decoder(unrecognizedIsErrorFlag);
+
+    if (0 > decoder.convert(out, numOut, numIn, begin, end)) {
+        return -1;                                                    // RETURN
+    }
+
+    int numEnd;
+    const int rc = decoder.endConvert(out + *numOut, &numEnd);
+    *numOut += numEnd;
+
+    return 0 > rc ? -1 : 0;
+}
 
 // CREATORS
 
@@ -116,6 +383,90 @@ Base64Decoder::~Base64Decoder()
     BSLS_ASSERT(0 <= d_outputLength);
 }
 
+// MANIPULATORS
+int Base64Decoder::convert(char       *out,
+                           int        *numOut,
+                           int        *numIn,
+                           const char *begin,
+                           const char *end)
+{
+    BSLS_ASSERT(numOut);
+    BSLS_ASSERT(numIn);
+    BSLS_ASSERT(begin <= end);
+
+    // The template 'convert' is the reference state machine: the bulk kernels
+    // are used only at 4-character boundaries in the input state, where their
+    // effect is the same; all else is left to the state machine.
+
+    if (e_ERROR_STATE == d_state || e_DONE_STATE == d_state) {
+        return convert<char *, const char *>(out,
+                                             numOut,
+                                             numIn,
+                                             begin,
+                                             end,
+                                             -1);                     // RETURN
+    }
+
+    const char *input  = begin;
+    char       *output = out;
+
+    if (8 <= d_bitsInStack) {
+        // Emit the output retained by an earlier call that was limited by
+        // 'maxNumOut'.
+
+        int numRetained;
+        int numNone;
+        convert<char *, const char *>(output,
+                                      &numRetained,
+                                      &numNone,
+                                      begin,
+                                      begin,
+                                      -1);
+        output += numRetained;
+    }
+
+    for (;;) {
+        if (e_INPUT_STATE == d_state && 0 == d_bitsInStack) {
+            const bsl::size_t consumed = decodeQuanta(output, input, end);
+            const int         produced = static_cast<int>(consumed / 4 * 3);
+
+            input          += consumed;
+            output         += produced;
+            d_outputLength += produced;
+        }
+
+        if (input == end) {
+            break;
+        }
+
+        // Feed a single character to the state machine, so as to return to
+        // the bulk kernels as soon as it reaches a 4-character boundary, or
+        // all of the remaining input once the padding has been seen.
+
+        const char *next = e_INPUT_STATE == d_state ? input + 1 : end;
+        int         charOut;
+        int         charIn;
+        const int   rc = convert<char *, const char *>(output,
+                                                       &charOut,
+                                                       &charIn,
+                                                       input,
+                                                       next,
+                                                       -1);
+        output += charOut;
+        input  += charIn;
+
+        if (0 > rc) {
+            *numOut = static_cast<int>(output - out);
+            *numIn  = static_cast<int>(input - begin);
+            return rc;                                                // RETURN
+        }
+    }
+
+    *numOut = static_cast<int>(output - out);
+    *numIn  = static_cast<int>(input - begin);
+    return 0;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
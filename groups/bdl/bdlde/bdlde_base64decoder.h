@@ -153,6 +153,19 @@ BSLS_IDENT("$Id: $")
 // bytes) of the initial input data sequence before encoding was evenly
 // divisible by 3.
 //
+///Decoding Contiguous Input
+///-------------------------
+// Input held in a contiguous array of 'char' can be decoded either in one call
+// with the 'decodeBuffer' class method, or segment by segment with the
+// (non-template) 'convert' overload taking 'char' pointers.  Both produce
+// exactly the results of the template 'convert', but decode runs of numeric
+// Base64 characters that begin on a 4-character boundary many characters at a
+// time, using SSSE3 or AVX2 instructions where the processor supports them.
+// Whitespace, '=', and unrecognized characters are handled by the
+// character-at-a-time state machine, so that, e.g., MIME-formatted input
+// having a CRLF every 76 characters still decodes almost entirely on the fast
+// path.
+//
 ///Usage
 ///-----
 // The following example shows how to use a 'bdlde::Base64Decoder' object to
@@ -461,6 +474,27 @@ class Base64Decoder {
         // 'convert' method of this decoder.  The behavior is undefined unless
         // '0 <= inputLength'.
 
+    static int decodeBuffer(char       *out,
+                            int        *numOut,
+                            int        *numIn,
+                            const char *begin,
+                            const char *end,
+                            bool        unrecognizedIsErrorFlag);
+        // Decode the sequence of input characters starting at the specified
+        // 'begin' position up to, but not including, the specified 'end'
+        // position, writing the resulting output characters to the specified
+        // 'out' buffer, as if by a call to 'convert' followed by a call to
+        // 'endConvert' on a decoder constructed with the specified
+        // 'unrecognizedIsErrorFlag'.  Load into the specified 'numOut' and
+        // 'numIn' the number of output bytes produced and input bytes
+        // consumed, respectively.  Return 0 on success, and -1 if the input
+        // is not a complete, valid Base64 encoding, in which case, if 'numIn'
+        // is less than 'end - begin', the data at 'begin + numIn - 1' is the
+        // offending character.  The behavior is undefined unless
+        // '[begin, end)' is a valid range of at most 'INT_MAX' characters and
+        // 'out' refers to an array of at least
+        // 'maxDecodedLength(end - begin)' bytes.
+
     // CREATORS
     explicit
     Base64Decoder(bool unrecognizedIsErrorFlag);
@@ -506,6 +540,26 @@ class Base64Decoder {
         // 'endConvert' method be called to complete the encoding of any
         // unprocessed input characters that do not complete a 3-byte sequence.
 
+    int convert(char       *out,
+                int        *numOut,
+                int        *numIn,
+                const char *begin,
+                const char *end);
+        // Decode the sequence of input characters starting at the specified
+        // 'begin' position up to, but not including, the specified 'end'
+        // position, writing any resulting output characters to the specified
+        // 'out' buffer.  Load into the specified 'numOut' and 'numIn' the
+        // number of output bytes produced and input bytes consumed,
+        // respectively.  Return 0 on success, -1 on an input error, and -2 if
+        // the 'endConvert' method has already been called without an
+        // intervening 'resetState' call.  The behavior is undefined unless
+        // '[begin, end)' is a valid range and 'out' refers to an array large
+        // enough to hold the output, which is at most
+        // 'maxDecodedLength(end - begin)' bytes in addition to any bytes
+        // retained by this decoder from a previous call.  Note that the effect
+        // of this method is identical to that of the template 'convert' with
+        // no 'maxNumOut' limit, but it is considerably faster on long inputs.
+
     template <class OUTPUT_ITERATOR>
     int endConvert(OUTPUT_ITERATOR out);
     template <class OUTPUT_ITERATOR>
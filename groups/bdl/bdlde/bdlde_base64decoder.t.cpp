@@ -15,13 +15,17 @@
 #include <bslim_testutil.h>
 
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_cstdlib.h>   // atoi()
 #include <bsl_cstring.h>   // memset()
 #include <bsl_cctype.h>    // isgraph()
 #include <bsl_climits.h>   // INT_MIN
 #include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <stdio.h>
 
@@ -178,6 +182,8 @@ using namespace bsl;  // automatically added by script
 // [ 2] bdlde::Base64Decoder(int unrecognizedIsErrorFlag);
 // [ 3] ~bdlde::Base64Decoder();
 // [ 8] int convert(char *o, int *no, int *ni, begin, end, int mno);
+// [12] int convert(char *o, int *no, int *ni, const char *b, e);
+// [12] static int decodeBuffer(char *o, int *no, int *ni, b, e, bool);
 // [ 8] int endConvert(char *out, int *numOut, int maxNumOut);
 // [ 9] void resetState();
 // [ 3] bool isAcceptable() const;
@@ -210,6 +216,7 @@ using namespace bsl;  // automatically added by script
 //*[ 8] That a specified maximum output length is observed.
 //*[ 8] That surplus output beyond 'maxNumOut' is buffered properly.
 //*[10] STRESS TEST: The decoder properly decodes all encoded output.
+// [-1] PERFORMANCE: DECODING THROUGHPUT
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -1209,6 +1216,338 @@ void testCase##NUMBER(bool verbose,                                           \
                       bool veryVeryVerbose,                                   \
                       bool veryVeryVeryVerbose)
 
+DEFINE_TEST_CASE(12)
+{
+        (void)veryVeryVerbose;
+        (void)veryVeryVeryVerbose;
+
+        // --------------------------------------------------------------------
+        // TESTING CONTIGUOUS DECODING
+        //
+        // Concerns:
+        //: 1 The 'convert' overload taking 'char' pointers behaves exactly as
+        //:   the state machine does: it returns the same status, consumes and
+        //:   produces the same number of characters, writes the same output,
+        //:   and leaves the decoder in the same state, whether the input is
+        //:   valid, contains whitespace or line breaks anywhere, contains
+        //:   padding, or contains unrecognized characters, in both strict and
+        //:   relaxed modes.
+        //:
+        //: 2 Input may be split across calls at any position.
+        //:
+        //: 3 'decodeBuffer' is equivalent to 'convert' followed by
+        //:   'endConvert', and writes no more than 'maxDecodedLength' bytes.
+        //:
+        //: 4 A call passing 'char' pointers, which selects the overload, has
+        //:   the same effect, byte for byte, as the same call made with the
+        //:   template 'convert' that it selected before the overload existed.
+        //
+        // Plan:
+        //: 1 Encode pseudo-random data of every length up to several hundred
+        //:   bytes, with a variety of maximum line lengths, and occasionally
+        //:   insert or overwrite characters with ones drawn from a set
+        //:   containing numeric, padding, whitespace, and unrecognized
+        //:   characters.  Decode each input with the 6-argument (reference)
+        //:   'convert', then with the 5-argument 'convert' after splitting
+        //:   the input at pseudo-random positions, and compare the results,
+        //:   including after 'endConvert'.  (C-1..2)
+        //:
+        //: 2 Decode each input with 'decodeBuffer' in an output buffer filled
+        //:   with a sentinel, and compare the result with that of the
+        //:   reference; verify that the sentinel after 'maxDecodedLength'
+        //:   bytes is intact.  (C-3)
+        //:
+        //: 3 Decode each input in a single call with the overload and with
+        //:   the 5-argument template 'convert' explicitly instantiated for
+        //:   'char *' and 'const char *', each followed by 'endConvert', and
+        //:   compare the statuses, the counts, and every byte written to
+        //:   buffers filled with a sentinel.  (C-4)
+        //
+        // Testing:
+        //   int convert(char *o, int *no, int *ni, const char *b, e);
+        //   static int decodeBuffer(char *o, int *no, int *ni, b, e, bool);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CONTIGUOUS DECODING" << endl
+                          << "===========================" << endl;
+
+        const int         LINE_LENGTHS[] = { 0, 1, 3, 4, 5, 16, 76 };
+        const int         NUM_LINE_LENGTHS =
+                          static_cast<int>(sizeof LINE_LENGTHS
+                                                      / sizeof *LINE_LENGTHS);
+        const int         DATA_SIZE = 300;
+        const char        SENTINEL  = '#';
+        const char        NOISE[]   = "AQw+/09=\r\n \t@-_!\x80\xff";
+        const int         NUM_NOISE = static_cast<int>(sizeof NOISE - 1);
+
+        char     data[DATA_SIZE];
+        unsigned seed = 12345;
+        for (int i = 0; i < DATA_SIZE; ++i) {
+            seed = seed * 1103515245 + 12345;
+            data[i] = static_cast<char>(seed >> 16);
+        }
+
+        for (int ti = 0; ti < NUM_LINE_LENGTHS; ++ti) {
+            const int LINE_LENGTH = LINE_LENGTHS[ti];
+
+            if (veryVerbose) { T_ P(LINE_LENGTH) }
+
+            for (int length = 0; length <= DATA_SIZE; ++length) {
+                bsl::string input(bdlde::Base64Encoder::encodedLength(
+                                                                  length,
+                                                                  LINE_LENGTH),
+                                  '\0');
+                if (!input.empty()) {
+                    bdlde::Base64Encoder::encodeBuffer(&input[0],
+                                                       data,
+                                                       data + length,
+                                                       LINE_LENGTH);
+                }
+
+                // Introduce noise into two of every three inputs.
+
+                seed = seed * 1103515245 + 12345;
+                const int mode = (seed >> 16) % 3;
+                if (mode && !input.empty()) {
+                    seed = seed * 1103515245 + 12345;
+                    const bsl::size_t pos   = (seed >> 8) % input.size();
+                    const char        noise = NOISE[(seed >> 20) % NUM_NOISE];
+                    if (1 == mode) {
+                        input.insert(pos, 1, noise);
+                    }
+                    else {
+                        input[pos] = noise;
+                    }
+                }
+
+                const char *const BEGIN = input.data();
+                const char *const END   = BEGIN + input.size();
+                const int         MAX   = Obj::maxDecodedLength(
+                                             static_cast<int>(input.size()));
+
+                for (int strict = 0; strict < 2; ++strict) {
+                    bsl::vector<char> expected(MAX + 1);
+                    bsl::vector<char> result(MAX + 1, SENTINEL);
+
+                    Obj       reference(strict);
+                    int       expOut;
+                    int       expIn;
+                    const int expRc = reference.convert(&expected[0],
+                                                        &expOut,
+                                                        &expIn,
+                                                        BEGIN,
+                                                        END,
+                                                        -1);
+                    int       expEnd = 0;
+                    const int expEndRc = reference.endConvert(
+                                                        &expected[0] + expOut,
+                                                        &expEnd);
+
+                    // Split the input into up to three segments.
+
+                    seed = seed * 1103515245 + 12345;
+                    const char *split1 = BEGIN + (seed >> 8)
+                                                         % (input.size() + 1);
+                    seed = seed * 1103515245 + 12345;
+                    const char *split2 = split1 + (seed >> 8)
+                                                 % (END - split1 + 1);
+                    const char *splits[] = { BEGIN, split1, split2, END };
+
+                    Obj  object(strict);
+                    int  rc     = 0;
+                    int  numOut = 0;
+                    int  numIn  = 0;
+                    for (int i = 0; i < 3 && 0 <= rc; ++i) {
+                        int no;
+                        int ni;
+                        rc = object.convert(&result[0] + numOut,
+                                            &no,
+                                            &ni,
+                                            splits[i],
+                                            splits[i + 1]);
+                        numOut += no;
+                        numIn  += ni;
+                    }
+                    LOOP4_ASSERT(LINE_LENGTH, length, expRc, rc, expRc == rc);
+                    LOOP4_ASSERT(LINE_LENGTH, length, expOut, numOut,
+                                 expOut == numOut);
+                    LOOP4_ASSERT(LINE_LENGTH, length, expIn, numIn,
+                                 expIn == numIn);
+                    LOOP2_ASSERT(LINE_LENGTH, length,
+                                 0 == memcmp(&expected[0], &result[0],
+                                             numOut));
+                    LOOP2_ASSERT(LINE_LENGTH, length,
+                                 0 > rc || reference.outputLength()
+                                                     == object.outputLength());
+
+                    int       numEnd = 0;
+                    const int endRc  = object.endConvert(&result[0] + numOut,
+                                                         &numEnd);
+                    LOOP2_ASSERT(LINE_LENGTH, length, expEndRc == endRc);
+                    LOOP2_ASSERT(LINE_LENGTH, length, expEnd == numEnd);
+                    LOOP2_ASSERT(LINE_LENGTH, length,
+                                 reference.isDone()  == object.isDone());
+                    LOOP2_ASSERT(LINE_LENGTH, length,
+                                 reference.isError() == object.isError());
+
+                    // 'decodeBuffer'
+
+                    const bool expSuccess = 0 <= expRc && 0 <= expEndRc;
+
+                    bsl::fill(result.begin(), result.end(), SENTINEL);
+                    numOut = -1;
+                    numIn  = -1;
+                    rc     = Obj::decodeBuffer(&result[0],
+                                               &numOut,
+                                               &numIn,
+                                               BEGIN,
+                                               END,
+                                               strict);
+                    LOOP3_ASSERT(LINE_LENGTH, length, rc,
+                                 (expSuccess ? 0 : -1) == rc);
+                    LOOP2_ASSERT(LINE_LENGTH, length, expIn == numIn);
+                    if (expSuccess) {
+                        LOOP2_ASSERT(LINE_LENGTH, length,
+                                     expOut + expEnd == numOut);
+                        LOOP2_ASSERT(LINE_LENGTH, length,
+                                     0 == memcmp(&expected[0], &result[0],
+                                                 numOut));
+                        if (0 == mode) {
+                            LOOP2_ASSERT(LINE_LENGTH, length,
+                                         length == numOut);
+                            LOOP2_ASSERT(LINE_LENGTH, length,
+                                         0 == memcmp(data, &result[0],
+                                                     length));
+                        }
+                    }
+                    LOOP2_ASSERT(LINE_LENGTH, length, SENTINEL == result[MAX]);
+
+                    // The overload and the template, in a single call.
+
+                    bsl::vector<char> viaTemplate(MAX + 1, SENTINEL);
+                    bsl::vector<char> viaOverload(MAX + 1, SENTINEL);
+
+                    Obj tObject(strict);
+                    Obj oObject(strict);
+
+                    int       tOut;
+                    int       tIn;
+                    const int tRc = tObject.convert<char *, const char *>(
+                                                               &viaTemplate[0],
+                                                               &tOut,
+                                                               &tIn,
+                                                               BEGIN,
+                                                               END);
+                    int       oOut;
+                    int       oIn;
+                    const int oRc = oObject.convert(&viaOverload[0],
+                                                    &oOut,
+                                                    &oIn,
+                                                    BEGIN,
+                                                    END);
+                    LOOP4_ASSERT(LINE_LENGTH, length, tRc, oRc, tRc == oRc);
+                    LOOP2_ASSERT(LINE_LENGTH, length, tOut == oOut);
+                    LOOP2_ASSERT(LINE_LENGTH, length, tIn  == oIn);
+
+                    int       tEnd = 0;
+                    int       oEnd = 0;
+                    const int tEndRc = tObject.endConvert(
+                                                       &viaTemplate[0] + tOut,
+                                                       &tEnd);
+                    const int oEndRc = oObject.endConvert(
+                                                       &viaOverload[0] + oOut,
+                                                       &oEnd);
+                    LOOP2_ASSERT(LINE_LENGTH, length, tEndRc == oEndRc);
+                    LOOP2_ASSERT(LINE_LENGTH, length, tEnd   == oEnd);
+                    LOOP2_ASSERT(LINE_LENGTH, length,
+                                 viaTemplate == viaOverload);
+                }
+            }
+        }
+}
+
+void performanceTest(bool verbose, int iterations)
+    // Print, in CSV format, the throughput of decoding 1 MiB of Base64 text,
+    // with and without line breaks, using the state machine and the contiguous
+    // overloads, each repeated the specified 'iterations' number of times, and
+    // print a banner if the specified 'verbose' flag is 'true'.
+{
+    // ------------------------------------------------------------------------
+    // PERFORMANCE: DECODING THROUGHPUT
+    //
+    // Concerns:
+    //: 1 Decoding contiguous input is substantially faster than the state
+    //:   machine.
+    //
+    // Plan:
+    //: 1 Decode 1 MiB of encoded pseudo-random data repeatedly, with and
+    //:   without line breaks, using the 6-argument 'convert' and then
+    //:   'decodeBuffer', and report the throughput of each as CSV.
+    //
+    // Testing:
+    //   PERFORMANCE: DECODING THROUGHPUT
+    // ------------------------------------------------------------------------
+
+    if (verbose) cout << endl
+                      << "PERFORMANCE: DECODING THROUGHPUT" << endl
+                      << "================================" << endl;
+
+    const int SIZE = 1 << 20;
+
+    bsl::vector<char> data(SIZE);
+    unsigned seed = 12345;
+    for (int i = 0; i < SIZE; ++i) {
+        seed = seed * 1103515245 + 12345;
+        data[i] = static_cast<char>(seed >> 16);
+    }
+    bsl::vector<char> output(SIZE);
+
+    cout << "method,maxLineLength,MB/s" << endl;
+
+    const int LINE_LENGTHS[] = { 0, 76 };
+    for (int ti = 0; ti < 2; ++ti) {
+        const int         LINE_LENGTH = LINE_LENGTHS[ti];
+        bsl::vector<char> input(bdlde::Base64Encoder::encodedLength(
+                                                                 SIZE,
+                                                                 LINE_LENGTH));
+        bdlde::Base64Encoder::encodeBuffer(&input[0],
+                                           &data[0],
+                                           &data[0] + SIZE,
+                                           LINE_LENGTH);
+
+        const char *const BEGIN = &input[0];
+        const char *const END   = BEGIN + input.size();
+
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int i = 0; i < iterations; ++i) {
+            Obj decoder(true);
+            int numOut;
+            int numIn;
+            int numEnd;
+            decoder.convert(&output[0], &numOut, &numIn, BEGIN, END, -1);
+            decoder.endConvert(&output[numOut], &numEnd);
+        }
+        timer.stop();
+        cout << "convert," << LINE_LENGTH << ','
+             << double(input.size()) * iterations / timer.elapsedTime() / 1e6
+             << endl;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < iterations; ++i) {
+            int numOut;
+            int numIn;
+            Obj::decodeBuffer(&output[0], &numOut, &numIn, BEGIN, END, true);
+        }
+        timer.stop();
+        cout << "decodeBuffer," << LINE_LENGTH << ','
+             << double(input.size()) * iterations / timer.elapsedTime() / 1e6
+             << endl;
+    }
+}
+
 DEFINE_TEST_CASE(11)
 {
         (void)veryVeryVerbose;
@@ -5616,6 +5955,7 @@ int main(int argc, char *argv[])
   case NUMBER: testCase##NUMBER(verbose, veryVerbose, veryVeryVerbose,        \
                                                     veryVeryVeryVerbose); break
 
+        CASE(12);
         CASE(11);
         CASE(10);
         CASE(9);
@@ -5628,6 +5968,9 @@ int main(int argc, char *argv[])
         CASE(2);
         CASE(1);
 #undef CASE
+      case -1: {
+        performanceTest(verbose, argc > 2 ? atoi(argv[2]) : 50);
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -13,6 +13,20 @@
 BSLS_IDENT_RCSID(bdlde_base64encoder_cpp,"$Id$ $CSID$")
 
 #include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstring.h>
+
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(BSLS_PLATFORM_CPU_X86)
+#if defined(BSLS_PLATFORM_CMP_CLANG) ||                                       \
+    (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900)
+#define BDLDE_BASE64ENCODER_X86
+#include <immintrin.h>
+#endif
+#endif
 
 namespace BloombergLP {
 
@@ -35,6 +49,247 @@ static const char enc[] = {
     '4', '5', '6', '7', '8', '9', '+', '/',  // 070
 };
 
+namespace {
+
+// The SIMD kernels below follow the approach described by W. Mula and
+// D. Lemire in "Faster Base64 Encoding and Decoding Using AVX2 Instructions":
+// the bytes of each 3-byte group are shuffled into a 32-bit lane, the four
+// 6-bit indices are extracted with two multiplications, and the indices are
+// translated to characters by adding an offset selected with 'pshufb' from a
+// 16-entry table according to the range ('A-Z', 'a-z', '0-9', '+', or '/') of
+// the index.
+
+void encodeGroupsScalar(char                *out,
+                        const unsigned char *in,
+                        bsl::size_t          numGroups)
+    // Write to the specified 'out' the 4 * 'numGroups' Base64 characters
+    // encoding the 3 * 'numGroups' bytes at the specified 'in', where
+    // 'numGroups' is the specified number of 3-byte groups.
+{
+    for (; numGroups; --numGroups, in += 3, out += 4) {
+        const unsigned value = (static_cast<unsigned>(in[0]) << 16)
+                             | (static_cast<unsigned>(in[1]) <<  8)
+                             |  static_cast<unsigned>(in[2]);
+        out[0] = enc[ value >> 18        ];
+        out[1] = enc[(value >> 12) & 0x3f];
+        out[2] = enc[(value >>  6) & 0x3f];
+        out[3] = enc[ value        & 0x3f];
+    }
+}
+
+#if defined(BDLDE_BASE64ENCODER_X86)
+
+__attribute__((target("ssse3")))
+inline
+__m128i translateSsse3(__m128i indices)
+    // Return the Base64 characters encoding each of the 6-bit values in the
+    // bytes of the specified 'indices'.
+{
+    const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '+' - 62,
+                                          '/' - 63, 'A',      0,        0);
+
+    // Map [0, 26) to 13, [26, 52) to 0, and [52, 64) to [1, 12].
+
+    __m128i       range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const __m128i upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+
+    range = _mm_or_si128(range, _mm_and_si128(upper, _mm_set1_epi8(13)));
+    return _mm_add_epi8(_mm_shuffle_epi8(offsets, range), indices);
+}
+
+__attribute__((target("ssse3")))
+inline
+__m128i splitSsse3(__m128i input)
+    // Return the 6-bit values, one per byte, of the four 3-byte groups in the
+    // low 12 bytes of the specified 'input'.
+{
+    const __m128i shuffle = _mm_setr_epi8( 1,  0,  2,  1,  4,  3,  5,  4,
+                                           7,  6,  8,  7, 10,  9, 11, 10);
+
+    const __m128i groups = _mm_shuffle_epi8(input, shuffle);
+
+    const __m128i high = _mm_mulhi_epu16(
+                             _mm_and_si128(groups, _mm_set1_epi32(0x0fc0fc00)),
+                             _mm_set1_epi32(0x04000040));
+    const __m128i low  = _mm_mullo_epi16(
+                             _mm_and_si128(groups, _mm_set1_epi32(0x003f03f0)),
+                             _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(high, low);
+}
+
+__attribute__((target("ssse3")))
+bsl::size_t encodeGroupsSsse3(char                *out,
+                              const unsigned char *in,
+                              bsl::size_t          numGroups)
+    // Write to the specified 'out' the Base64 characters encoding a prefix of
+    // the 3 * 'numGroups' bytes at the specified 'in', where 'numGroups' is
+    // the specified number of 3-byte groups, and return the number of groups
+    // encoded.  The behavior is undefined unless the processor supports SSSE3
+    // instructions.
+{
+    // Each iteration loads 16 bytes and encodes the first 12 of them.
+
+    bsl::size_t done = 0;
+    for (; (numGroups - done) * 3 >= 16; done += 4, in += 12, out += 16) {
+        const __m128i input = _mm_loadu_si128(
+                                        reinterpret_cast<const __m128i *>(in));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         translateSsse3(splitSsse3(input)));
+    }
+    return done;
+}
+
+__attribute__((target("avx2")))
+bsl::size_t encodeGroupsAvx2(char                *out,
+                             const unsigned char *in,
+                             bsl::size_t          numGroups)
+    // Write to the specified 'out' the Base64 characters encoding a prefix of
+    // the 3 * 'numGroups' bytes at the specified 'in', where 'numGroups' is
+    // the specified number of 3-byte groups, and return the number of groups
+    // encoded.  The behavior is undefined unless the processor supports AVX2
+    // instructions.
+{
+    const __m256i offsets = _mm256_setr_epi8(
+                    'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                    '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                    '/' - 63, 'A',      0,        0,
+                    'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                    '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                    '/' - 63, 'A',      0,        0);
+    const __m256i shuffle = _mm256_setr_epi8( 1,  0,  2,  1,  4,  3,  5,  4,
+                                              7,  6,  8,  7, 10,  9, 11, 10,
+                                              1,  0,  2,  1,  4,  3,  5,  4,
+                                              7,  6,  8,  7, 10,  9, 11, 10);
+
+    // Each iteration loads the 16 bytes at 'in' and at 'in + 12', and encodes
+    // the first 12 of each.
+
+    bsl::size_t done = 0;
+    for (; (numGroups - done) * 3 >= 28; done += 8, in += 24, out += 32) {
+        const __m128i first  = _mm_loadu_si128(
+                                        reinterpret_cast<const __m128i *>(in));
+        const __m128i second = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(in + 12));
+        const __m256i groups = _mm256_shuffle_epi8(
+                  _mm256_inserti128_si256(_mm256_castsi128_si256(first),
+                                          second,
+                                          1),
+                  shuffle);
+
+        const __m256i high = _mm256_mulhi_epu16(
+                       _mm256_and_si256(groups, _mm256_set1_epi32(0x0fc0fc00)),
+                       _mm256_set1_epi32(0x04000040));
+        const __m256i low  = _mm256_mullo_epi16(
+                       _mm256_and_si256(groups, _mm256_set1_epi32(0x003f03f0)),
+                       _mm256_set1_epi32(0x01000010));
+        const __m256i indices = _mm256_or_si256(high, low);
+
+        __m256i       range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        const __m256i upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26),
+                                                indices);
+        range = _mm256_or_si256(range,
+                                _mm256_and_si256(upper, _mm256_set1_epi8(13)));
+
+        _mm256_storeu_si256(
+                         reinterpret_cast<__m256i *>(out),
+                         _mm256_add_epi8(_mm256_shuffle_epi8(offsets, range),
+                                         indices));
+    }
+    return done;
+}
+
+enum {
+    k_CPU_DETECTED = 1,  // the supported extensions have been detected
+    k_CPU_SSSE3    = 2,  // the processor supports SSSE3 instructions
+    k_CPU_AVX2     = 4   // the processor and the operating system support
+                         // AVX2 instructions
+};
+
+bsls::AtomicOperations::AtomicTypes::Int s_cpuFeatures;
+    // bitwise OR of the 'k_CPU_*' flags, or 0 if not yet detected
+
+int cpuFeatures()
+    // Return the bitwise OR of the 'k_CPU_*' flags describing the instruction
+    // set extensions supported by the processor, detecting them on first use.
+    // Note that concurrent first uses detect, and store, the same value.
+{
+    int features = bsls::AtomicOperations::getIntRelaxed(&s_cpuFeatures);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == features)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        __builtin_cpu_init();
+
+        features = k_CPU_DETECTED
+                 | (__builtin_cpu_supports("ssse3") ? k_CPU_SSSE3 : 0)
+                 | (__builtin_cpu_supports("avx2")  ? k_CPU_AVX2  : 0);
+
+        bsls::AtomicOperations::setIntRelaxed(&s_cpuFeatures, features);
+    }
+    return features;
+}
+
+#endif  // BDLDE_BASE64ENCODER_X86
+
+void encodeGroups(char *out, const unsigned char *in, bsl::size_t numGroups)
+    // Write to the specified 'out' the 4 * 'numGroups' Base64 characters
+    // encoding the 3 * 'numGroups' bytes at the specified 'in', where
+    // 'numGroups' is the specified number of 3-byte groups.
+{
+#if defined(BDLDE_BASE64ENCODER_X86)
+    const int   features = cpuFeatures();
+    bsl::size_t done     = 0;
+
+    if (features & k_CPU_AVX2) {
+        done = encodeGroupsAvx2(out, in, numGroups);
+    }
+    if (features & k_CPU_SSSE3) {
+        done += encodeGroupsSsse3(out + done * 4,
+                                  in + done * 3,
+                                  numGroups - done);
+    }
+    out       += done * 4;
+    in        += done * 3;
+    numGroups -= done;
+#endif
+    encodeGroupsScalar(out, in, numGroups);
+}
+
+char *encodeUnbroken(char *out, const unsigned char *in, bsl::size_t length)
+    // Write to the specified 'out' the Base64 encoding, including any
+    // trailing '=' characters but no CRLF, of the specified 'length' bytes at
+    // the specified 'in', and return the address one past the last character
+    // written.
+{
+    const bsl::size_t numGroups = length / 3;
+    encodeGroups(out, in, numGroups);
+    out += numGroups * 4;
+    in  += numGroups * 3;
+
+    switch (length - numGroups * 3) {
+      case 1: {
+        out[0] = enc[in[0] >> 2];
+        out[1] = enc[(in[0] & 0x03) << 4];
+        out[2] = '=';
+        out[3] = '=';
+        out += 4;
+      } break;
+      case 2: {
+        out[0] = enc[in[0] >> 2];
+        out[1] = enc[((in[0] & 0x03) << 4) | (in[1] >> 4)];
+        out[2] = enc[(in[1] & 0x0f) << 2];
+        out[3] = '=';
+        out += 4;
+      } break;
+    }
+    return out;
+}
+
+}  // close unnamed namespace
+
 namespace bdlde {
 
                          // -------------------
@@ -45,6 +300,72 @@ namespace bdlde {
 const char *const Base64Encoder::s_encodedChars_p       = enc;
 const int         Base64Encoder::s_defaultMaxLineLength = 76;
 
+// CLASS METHODS
+int Base64Encoder::encodeBuffer(char       *out,
+                                const char *begin,
+                                const char *end,
+                                int         maxLineLength)
+{
+    BSLS_ASSERT(out);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(0 <= maxLineLength);
+
+    const unsigned char *input  = reinterpret_cast<const unsigned char *>(
+                                                                        begin);
+    bsl::size_t          length = end - begin;
+
+    const int numOut   = encodedLength(static_cast<int>(length),
+                                       maxLineLength);
+    const int unbroken = static_cast<int>((length + 2) / 3 * 4);
+
+    if (0 == maxLineLength || unbroken <= maxLineLength) {
+        encodeUnbroken(out, input, length);
+        return numOut;                                                // RETURN
+    }
+
+    if (0 == maxLineLength % 4) {
+        // Each line encodes a whole number of 3-byte groups, so encode
+        // directly into 'out' one line at a time.  Note that a CRLF is emitted
+        // only if more characters follow it.
+
+        const bsl::size_t groupsPerLine = maxLineLength / 4;
+        const bsl::size_t bytesPerLine  = groupsPerLine * 3;
+
+        while (length > bytesPerLine) {
+            encodeGroups(out, input, groupsPerLine);
+            out    += maxLineLength;
+            *out++  = '\r';
+            *out++  = '\n';
+            input  += bytesPerLine;
+            length -= bytesPerLine;
+        }
+        encodeUnbroken(out, input, length);
+        return numOut;                                                // RETURN
+    }
+
+    // Lines do not align with 3-byte groups: encode the input without line
+    // breaks into the end of 'out', then move each line to its final
+    // position.  Every line moves toward the beginning of 'out' by 2 bytes
+    // more than the previous one, so no line is overwritten before it moves.
+
+    const char *source    = out + (numOut - unbroken);
+    int         remaining = unbroken;
+
+    encodeUnbroken(out + (numOut - unbroken), input, length);
+
+    while (remaining > maxLineLength) {
+        bsl::memmove(out, source, maxLineLength);
+        out       += maxLineLength;
+        *out++     = '\r';
+        *out++     = '\n';
+        source    += maxLineLength;
+        remaining -= maxLineLength;
+    }
+    bsl::memmove(out, source, remaining);
+
+    return numOut;
+}
+
 // CREATORS
 Base64Encoder::~Base64Encoder()
 {
@@ -153,6 +153,18 @@ BSLS_IDENT("$Id: $")
 // bytes) of the initial input data sequence before encoding was evenly
 // divisible by 3.
 //
+///Contiguous Buffers
+///------------------
+// When the entire input is available in a contiguous buffer, the class
+// methods 'Base64Encoder::encodeBuffer' and 'Base64Decoder::decodeBuffer'
+// convert it in a single call, producing exactly the output of 'convert'
+// followed by 'endConvert' on a correspondingly configured object.  (The
+// 'Base64Decoder::convert' overload taking 'char' pointers similarly
+// accelerates decoding of segmented input.)  These functions process the bulk
+// of the data many bytes at a time, using SSSE3 or AVX2 instructions when the
+// processor supports them, and are considerably faster than the
+// character-at-a-time state machines on large inputs.
+//
 ///Usage
 ///-----
 // The following example shows how to use a 'bdlde::Base64Encoder' object to
@@ -498,6 +510,26 @@ class Base64Encoder {
         // from an encoder having the specified 'maxLineLength' would be an
         // acceptable input to a 'Base64Decoder', and 'false' otherwise.
 
+    static int encodeBuffer(char *out, const char *begin, const char *end);
+    static int encodeBuffer(char       *out,
+                            const char *begin,
+                            const char *end,
+                            int         maxLineLength);
+        // Write to the specified 'out' buffer the Base64 encoding of the
+        // sequence of input characters starting at the specified 'begin'
+        // position up to, but not including, the specified 'end' position,
+        // and return the number of bytes written.  Optionally specify the
+        // 'maxLineLength' of the output; if 'maxLineLength' is not specified,
+        // 76 (as recommended by the MIME standard) is used, and if it is 0, no
+        // CRLF characters will appear in the output.  The output is identical
+        // to that produced by 'convert' followed by 'endConvert' on an encoder
+        // constructed with 'maxLineLength', and the number of bytes written is
+        // 'encodedLength(end - begin, maxLineLength)'.  The behavior is
+        // undefined unless '[begin, end)' is a valid range,
+        // '0 <= maxLineLength', the number of bytes written is representable
+        // as an 'int', and 'out' refers to an array of at least that many
+        // bytes.
+
     // CREATORS
     Base64Encoder();
         // Create a Base64 encoder in the initial state, defaulting the maximum
@@ -727,6 +759,12 @@ int Base64Encoder::encodedLines(int inputLength)
     return encodedLines(inputLength, 76);
 }
 
+inline
+int Base64Encoder::encodeBuffer(char *out, const char *begin, const char *end)
+{
+    return encodeBuffer(out, begin, end, s_defaultMaxLineLength);
+}
+
 inline
 bool Base64Encoder::isResidualOutput(int numBytes, int maxLineLength)
 {
@@ -14,7 +14,9 @@
 
 #include <bsls_assert.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>   // atoi()
@@ -22,6 +24,7 @@
 #include <bsl_cctype.h>    // isgraph()
 #include <bsl_climits.h>   // INT_MAX
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;  // automatically added by script
@@ -96,6 +99,8 @@ using namespace bsl;  // automatically added by script
 // for both of these template methods.
 //-----------------------------------------------------------------------------
 // [ 7] static int encodedLength(int numInputBytes, int maxLineLength);
+// [14] static int encodeBuffer(char *out, const char *b, const char *e);
+// [14] static int encodeBuffer(char *out, const char *b, const char *e, int);
 // [10] bdlde::Base64Encoder();
 // [ 2] bdlde::Base64Encoder(int maxLineLength);
 // [ 3] ~bdlde::Base64Encoder();
@@ -1220,6 +1225,117 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'encodeBuffer'
+        //
+        // Concerns:
+        //: 1 'encodeBuffer' produces exactly the output of 'convert' followed
+        //:   by 'endConvert' on an encoder having the same maximum line
+        //:   length, for every input length and every maximum line length,
+        //:   including line lengths that are not multiples of 4.
+        //:
+        //: 2 The value returned is the number of bytes written, which is
+        //:   'encodedLength(end - begin, maxLineLength)'.
+        //:
+        //: 3 No byte beyond the returned length is written.
+        //:
+        //: 4 The 3-argument overload uses the default maximum line length.
+        //
+        // Plan:
+        //: 1 For each of a set of maximum line lengths, and each input length
+        //:   up to several hundred bytes (so as to exercise the vectorized and
+        //:   the scalar paths), encode pseudo-random input with both
+        //:   'encodeBuffer' and the state machine, and compare the output and
+        //:   its length.  Fill the output buffer with a sentinel first, and
+        //:   verify that the sentinel following the output is intact.
+        //:   (C-1..3)
+        //:
+        //: 2 Compare the output of the 3-argument overload to that of the
+        //:   4-argument overload passed 76.  (C-4)
+        //
+        // Testing:
+        //   static int encodeBuffer(char *out, const char *b, const char *e);
+        //   static int encodeBuffer(char *out, const char *b, const char *e,
+        //                           int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'encodeBuffer'" << endl
+                          << "======================" << endl;
+
+        const int LINE_LENGTHS[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 15, 16,
+                                     31, 32, 33, 64, 75, 76, 77, 100 };
+        const int NUM_LINE_LENGTHS = static_cast<int>(sizeof LINE_LENGTHS
+                                                    / sizeof *LINE_LENGTHS);
+        const int INPUT_SIZE = 400;
+        const char SENTINEL = '#';
+
+        char input[INPUT_SIZE];
+        unsigned seed = 12345;
+        for (int i = 0; i < INPUT_SIZE; ++i) {
+            seed = seed * 1103515245 + 12345;
+            input[i] = static_cast<char>(seed >> 16);
+        }
+
+        // A maximum line length of 1 yields the longest output.
+
+        const int OUTPUT_SIZE = Obj::encodedLength(INPUT_SIZE, 1) + 1;
+
+        bsl::vector<char> expected(OUTPUT_SIZE);
+        bsl::vector<char> result(OUTPUT_SIZE);
+
+        for (int ti = 0; ti < NUM_LINE_LENGTHS; ++ti) {
+            const int LINE_LENGTH = LINE_LENGTHS[ti];
+
+            if (veryVerbose) { T_ P(LINE_LENGTH) }
+
+            for (int length = 0; length <= INPUT_SIZE; ++length) {
+                Obj encoder(LINE_LENGTH);
+                int numOut;
+                int numIn;
+                int numEnd;
+
+                encoder.convert(&expected[0],
+                                &numOut,
+                                &numIn,
+                                input,
+                                input + length);
+                encoder.endConvert(&expected[numOut], &numEnd);
+                const int EXP_LENGTH = numOut + numEnd;
+
+                bsl::fill(result.begin(), result.end(), SENTINEL);
+
+                const int rc = Obj::encodeBuffer(&result[0],
+                                                 input,
+                                                 input + length,
+                                                 LINE_LENGTH);
+
+                LOOP3_ASSERT(LINE_LENGTH, length, rc, EXP_LENGTH == rc);
+                LOOP3_ASSERT(LINE_LENGTH, length, rc,
+                             Obj::encodedLength(length, LINE_LENGTH) == rc);
+                LOOP2_ASSERT(LINE_LENGTH, length,
+                             0 == memcmp(&expected[0], &result[0], rc));
+                LOOP2_ASSERT(LINE_LENGTH, length, SENTINEL == result[rc]);
+            }
+        }
+
+        if (verbose) cout << "\nTesting the default maximum line length."
+                          << endl;
+        {
+            bsl::vector<char> withDefault(OUTPUT_SIZE);
+
+            const int rc1 = Obj::encodeBuffer(&result[0],
+                                              input,
+                                              input + INPUT_SIZE,
+                                              76);
+            const int rc2 = Obj::encodeBuffer(&withDefault[0],
+                                              input,
+                                              input + INPUT_SIZE);
+            ASSERT(rc1 == rc2);
+            ASSERT(0 == memcmp(&result[0], &withDefault[0], rc1));
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING OPTIONAL NUMIN, NUMOUT
@@ -3565,6 +3681,72 @@ LOOP4_ASSERT(LINE, index, totalOut, localTotalOut, totalOut == localTotalOut);
         }
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: ENCODING THROUGHPUT
+        //
+        // Concerns:
+        //: 1 'encodeBuffer' is substantially faster than the state machine.
+        //
+        // Plan:
+        //: 1 Encode a buffer of pseudo-random data repeatedly, with and
+        //:   without line breaks, using 'convert' and 'endConvert' and then
+        //:   'encodeBuffer', and report the throughput of each as CSV.
+        //
+        // Testing:
+        //   PERFORMANCE: ENCODING THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: ENCODING THROUGHPUT" << endl
+                          << "================================" << endl;
+
+        const int SIZE       = 1 << 20;
+        const int ITERATIONS = argc > 2 ? atoi(argv[2]) : 50;
+
+        bsl::vector<char> input(SIZE);
+        unsigned seed = 12345;
+        for (int i = 0; i < SIZE; ++i) {
+            seed = seed * 1103515245 + 12345;
+            input[i] = static_cast<char>(seed >> 16);
+        }
+        bsl::vector<char> output(Obj::encodedLength(SIZE, 1) + 1);
+
+        const char *const BEGIN = &input[0];
+        const char *const END   = BEGIN + SIZE;
+
+        cout << "method,maxLineLength,MB/s" << endl;
+
+        const int LINE_LENGTHS[] = { 0, 76 };
+        for (int ti = 0; ti < 2; ++ti) {
+            const int LINE_LENGTH = LINE_LENGTHS[ti];
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                Obj encoder(LINE_LENGTH);
+                int numOut;
+                int numIn;
+                int numEnd;
+                encoder.convert(&output[0], &numOut, &numIn, BEGIN, END);
+                encoder.endConvert(&output[numOut], &numEnd);
+            }
+            timer.stop();
+            cout << "convert," << LINE_LENGTH << ','
+                 << double(SIZE) * ITERATIONS / timer.elapsedTime() / 1e6
+                 << endl;
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                Obj::encodeBuffer(&output[0], BEGIN, END, LINE_LENGTH);
+            }
+            timer.stop();
+            cout << "encodeBuffer," << LINE_LENGTH << ','
+                 << double(SIZE) * ITERATIONS / timer.elapsedTime() / 1e6
+                 << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -13,16 +13,30 @@
 BSLS_IDENT("$Id$ $CSID$")
 
 #include <bdlde_charconvertstatus.h>
+#include <bdlde_utf8util.h>
+
+#include <bdlb_bitutil.h>
 
 #include <bsla_maybeunused.h>
 #include <bslmf_assert.h>
 #include <bslmf_issame.h>
 #include <bsls_assert.h>
 #include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
 
 #include <bsl_algorithm.h>  // 'min'
 #include <bsl_climits.h>    // 'CHAR_BIT'
 #include <bsl_cstdint.h>    // 'WCHAR_WIDTH'
+#include <bsl_cstring.h>    // 'strlen'
+#include <bsl_limits.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(__SSE2__)
+// SSE2 is part of the x86-64 baseline, so no run-time dispatch is needed.
+
+#define BDLDE_CHARCONVERTUTF16_SSE2
+#include <emmintrin.h>
+#endif
 
 ///IMPLEMENTATION NOTES
 ///--------------------
@@ -325,13 +339,21 @@ struct Capacity {
     void operator--() { --d_capacity; }
         // Decrement 'd_capacity'.
 
-    void operator-=(int delta) { d_capacity -= delta; }
+    void operator-=(bsl::size_t delta) { d_capacity -= delta; }
         // Decrement 'd_capacity' by the specified 'delta'.
 
     // ACCESSORS
     bool operator<(bsl::size_t rhs) const { return d_capacity < rhs; }
         // Return 'true' if 'd_capacity' is less than the specified 'rhs', and
         // 'false' otherwise.
+
+    bsl::size_t limit(bsl::size_t n) const
+        // Return the lesser of the specified 'n' and the number of words that
+        // can be output while still leaving room for a null terminator.  The
+        // behavior is undefined unless '1 <= d_capacity'.
+    {
+        return bsl::min(n, d_capacity - 1);
+    }
 };
 
 struct NoOpCapacity {
@@ -345,12 +367,15 @@ struct NoOpCapacity {
     void operator--() {}
         // No-op.
 
-    void operator-=(int) {}
+    void operator-=(bsl::size_t) {}
         // No-op.
 
     // ACCESSORS
     bool operator<(bsl::size_t) const { return false; }
         // Return 'false'.
+
+    bsl::size_t limit(bsl::size_t n) const { return n; }
+        // Return the specified 'n'.
 };
 
 // LOCAL HELPER STRUCT
@@ -404,6 +429,12 @@ struct Utf8 {
         {}
 
         // ACCESSORS
+        const OctetType *end() const
+            // Return the end of input.
+        {
+            return d_end;
+        }
+
         bool isFinished(const OctetType *position) const
             // Return 'true' if the specified 'position' is at the end of
             // input, and 'false' otherwise.  The behavior is undefined unless
@@ -464,57 +495,6 @@ struct Utf8 {
         }
     };
 
-    struct ZeroBasedEnd {
-        // CREATORS
-        ZeroBasedEnd()
-            // Create a 'ZeroBasedEnd' object.
-        {
-        }
-
-        // ACCESSORS
-        bool isFinished(const OctetType *position) const
-            // Return 'true' if the specified 'position' is at the end of
-            // input, and 'false' otherwise.
-        {
-            return 0 == *position;
-        }
-
-        const OctetType *skipContinuations(const OctetType *octets) const
-            // Return a pointer to after all the consecutive continuation
-            // bytes following the specified 'octets'.  The behavior is
-            // undefined unless 'octets <= d_end'.
-        {
-            // This function is not called in the critical path.  It is called
-            // when it is known that there are not as many continuation octets
-            // after 'octets' as were expected.
-
-            while ((*octets & CONTINUE_MASK) == CONTINUE_TAG) {
-                ++octets;
-            }
-
-            return octets;
-        }
-
-        bool verifyContinuations(const OctetType *octets, int n) const
-            // Return 'true' if there are at least the specified 'n'
-            // continuation bytes beginning at the specified 'octets', and
-            // 'false' otherwise.  The behavior is undefined unless 'n >= 1'.
-        {
-            BSLS_ASSERT(n >= 1);
-
-            const OctetType *end = octets + n;
-            do {
-                if ((*octets & CONTINUE_MASK) != CONTINUE_TAG) {
-                    return false;                                     // RETURN
-                }
-
-                ++octets;
-            } while (octets < end);
-
-            return true;
-        }
-    };
-
     // CLASS METHODS
 
     // Part 1: Determine how to decode a UTF-8 code point.
@@ -906,7 +886,8 @@ struct Swapper {
     // This 'struct' contains static functions that facilitate doing encoding
     // and decoding of swapped UTF-16 data.
 
-    enum { k_SIZE = sizeof(UTF16_WORD) };
+    enum { k_SIZE    = sizeof(UTF16_WORD),
+           k_SWAPPED = 1 };
 
     // CLASS METHODS
     static
@@ -962,6 +943,8 @@ struct NoOpSwapper {
     // byte order -- the UTF-16 data that is being input or output is assumed
     // to be in host byte order.
 
+    enum { k_SWAPPED = 0 };
+
     // CLASS METHODS
     static
     UnicodeCodePoint decodeSingleWord(const UTF16_WORD *u16Buf)
@@ -1016,72 +999,198 @@ BSLMF_ASSERT(sizeof(bsl::wstring::value_type) >= sizeof(unsigned short));
 // are declared static, you have to fully specialize them every time you call
 // them.
 
-template <class END_FUNCTOR>
-bsl::size_t utf16BufferLength(const char  *srcBuffer,
-                              END_FUNCTOR  endFunctor)
-    // Return the number of shorts required to store the translation of the
-    // specified UTF-8 string 'srcBuffer', using the specified 'endFunctor' to
-    // evaluate end of input and explore continuation bytes.  Note that this
-    // routine will exactly estimate the right size except in two cases, in
-    // which case it will either still return exactly the right value, or a
-    // slight over-estimation.  The two cases where this routine will
-    // over-estimate the size required are:
-    //: o There are errors and the 'errorWord' is 0.  This routine assumes that
-    //:   'errorWord' is non-zero.
-    //: o if a four byte sequence is a non-minimal encoding.  This would be
-    //:   translated as a single error word, while we don't decode it so
-    //:   we just assume it will result in 2 words output.
+#if defined(BDLDE_CHARCONVERTUTF16_SSE2)
+template <class UTF16_WORD, class SWAPPER>
+bsl::size_t widenAsciiBlocks(UTF16_WORD            *dstBuffer,
+                             const Utf8::OctetType *octets,
+                             bsl::size_t            maxLength)
+    // Translate the longest sequence of whole 16-octet blocks of ASCII, of
+    // total length not greater than the specified 'maxLength', beginning at
+    // the specified 'octets' to UTF-16 words encoded as by 'SWAPPER' at the
+    // specified 'dstBuffer'.  Return the number of octets translated.
 {
-    bsl::size_t wordsNeeded = 0;
+    BSLMF_ASSERT(2 == sizeof(UTF16_WORD) || 4 == sizeof(UTF16_WORD));
 
-    // Working in unsigned makes bit manipulation with widening simpler;
-    // changing the type here keeps the low-level routines short.
+    const __m128i zero = _mm_setzero_si128();
 
-    const Utf8::OctetType *octets = static_cast<const Utf8::OctetType*>(
-                                          static_cast<const void*>(srcBuffer));
-    while (!endFunctor.isFinished(octets)) {
-        if      (Utf8::isSingleOctet(     *octets)) {
-            ++octets;
-            ++wordsNeeded;
-        }
-        else if (Utf8::isTwoOctetHeader(  *octets)) {
-            octets += endFunctor.verifyContinuations(octets + 1, 1) ? 2 : 1;
-            ++wordsNeeded;
+    bsl::size_t done = 0;
+    for (; 16 <= maxLength - done; done += 16) {
+        const __m128i input = _mm_loadu_si128(
+                             reinterpret_cast<const __m128i *>(octets + done));
+        if (_mm_movemask_epi8(input)) {
+            break;
         }
-        else if (Utf8::isThreeOctetHeader(*octets)) {
-            if (endFunctor.verifyContinuations(octets + 1, 2)) {
-                octets += 3;
-            }
-            else {
-                octets = endFunctor.skipContinuations(octets + 1);
-            }
-            ++wordsNeeded;
+
+        // Interleaving with zero octets widens each octet to 16 bits.  Putting
+        // the zero first places the octet in the high-order byte, which is
+        // the swapped encoding.
+
+        const __m128i lo = SWAPPER::k_SWAPPED
+                         ? _mm_unpacklo_epi8(zero, input)
+                         : _mm_unpacklo_epi8(input, zero);
+        const __m128i hi = SWAPPER::k_SWAPPED
+                         ? _mm_unpackhi_epi8(zero, input)
+                         : _mm_unpackhi_epi8(input, zero);
+
+        __m128i *out = reinterpret_cast<__m128i *>(dstBuffer + done);
+        if (2 == sizeof(UTF16_WORD)) {
+            _mm_storeu_si128(out,     lo);
+            _mm_storeu_si128(out + 1, hi);
         }
-        else if (Utf8::isFourOctetHeader( *octets)) {
-            if (endFunctor.verifyContinuations(octets + 1, 3)) {
-                octets += 4;
-            }
-            else {
-                octets = endFunctor.skipContinuations(octets + 1);
-            }
-            wordsNeeded += 2;      // will be over-estimate if error
+        else if (SWAPPER::k_SWAPPED) {
+            _mm_storeu_si128(out,     _mm_unpacklo_epi16(zero, lo));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(zero, lo));
+            _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(zero, hi));
+            _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(zero, hi));
         }
         else {
-            // Handle a five-octet code point (or anything else) sanely.
+            _mm_storeu_si128(out,     _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(hi, zero));
+        }
+    }
 
-            ++octets;
-            if (endFunctor.verifyContinuations(octets, 4)) {
-                octets += 4;
-            }
-            else {
-                octets = endFunctor.skipContinuations(octets);
-            }
+    return done;
+}
+#endif
+
+template <class UTF16_WORD, class SWAPPER>
+inline
+bsl::size_t copyAscii(UTF16_WORD            *dstBuffer,
+                      const Utf8::OctetType *octets,
+                      bsl::size_t            maxLength)
+    // Translate the run of ASCII octets beginning at the specified 'octets' to
+    // UTF-16 words encoded as by 'SWAPPER' at the specified 'dstBuffer',
+    // stopping at the first octet that is not ASCII or after the specified
+    // 'maxLength' octets, whichever comes first.  Return the number of octets
+    // translated.
+{
+    bsl::size_t done = 0;
+
+#if defined(BDLDE_CHARCONVERTUTF16_SSE2)
+    done = widenAsciiBlocks<UTF16_WORD, SWAPPER>(dstBuffer, octets, maxLength);
+#endif
+
+    for (; done < maxLength && Utf8::isSingleOctet(octets[done]); ++done) {
+        dstBuffer[done] = SWAPPER::encodeSingleWord(octets[done]);
+    }
+
+    return done;
+}
+
+bsl::size_t countFourOctetHeaders(const Utf8::OctetType *octets,
+                                  bsl::size_t            length)
+    // Return the number of octets in the specified 'length' octets beginning
+    // at the specified 'octets' that have the value 0xf0 or greater, which in
+    // valid UTF-8 are exactly the headers of four-octet sequences.
+{
+    bsl::size_t count = 0;
+    bsl::size_t done  = 0;
 
+#if defined(BDLDE_CHARCONVERTUTF16_SSE2)
+    const __m128i limit = _mm_set1_epi8(static_cast<char>(0xf0));
+
+    for (; 16 <= length - done; done += 16) {
+        const __m128i input = _mm_loadu_si128(
+                             reinterpret_cast<const __m128i *>(octets + done));
+        const int     mask  = _mm_movemask_epi8(
+                     _mm_cmpeq_epi8(_mm_max_epu8(input, limit), input));
+
+        count += BloombergLP::bdlb::BitUtil::numBitsSet(
+                                             static_cast<bsl::uint32_t>(mask));
+    }
+#endif
+
+    for (; done < length; ++done) {
+        count += octets[done] >= 0xf0;
+    }
+
+    return count;
+}
+
+const Utf8::OctetType *skipInvalidSequence(const Utf8::OctetType *octets,
+                                           Utf8::PtrBasedEnd      endFunctor)
+    // Return the position following the invalid sequence beginning at the
+    // specified 'octets', using the specified 'endFunctor' to evaluate end of
+    // input and continuation octets.  The octets skipped are exactly those
+    // that 'localUtf8ToUtf16' replaces with a single error word.  The
+    // behavior is undefined unless the sequence beginning at 'octets' is not
+    // valid UTF-8.
+{
+    BSLS_ASSERT(!Utf8::isSingleOctet(*octets));
+
+    int numContinuations;
+    if      (Utf8::isTwoOctetHeader(  *octets)) {
+        numContinuations = 1;
+    }
+    else if (Utf8::isThreeOctetHeader(*octets)) {
+        numContinuations = 2;
+    }
+    else if (Utf8::isFourOctetHeader( *octets)) {
+        numContinuations = 3;
+    }
+    else {
+        // Anything else is skipped as a five-octet sequence.
+
+        ++octets;
+        return endFunctor.verifyContinuations(octets, 4)
+               ? octets + 4
+               : endFunctor.skipContinuations(octets);                // RETURN
+    }
+
+    // If the continuations are all present, the sequence was invalid because
+    // of the value it encodes.
+
+    return endFunctor.verifyContinuations(octets + 1, numContinuations)
+           ? octets + 1 + numContinuations
+           : endFunctor.skipContinuations(octets + 1);
+}
+
+bsl::size_t utf16BufferLength(const char *srcBuffer, const char *endPtr)
+    // Return the number of words required to store the translation of the
+    // UTF-8 sequence '[ srcBuffer, endPtr )' to UTF-16, including the
+    // terminating null word.  The result is exact if the translation is done
+    // with a non-zero error word, and an over-estimate otherwise.
+{
+    typedef BloombergLP::bdlde::Utf8Util     Utf8Util;
+    typedef BloombergLP::bsls::Types::IntPtr IntPtr;
+
+    const IntPtr infinity = bsl::numeric_limits<IntPtr>::max();
+
+    Utf8::PtrBasedEnd endFunctor(endPtr);
+    bsl::size_t       wordsNeeded = 1;    // the null terminator
+
+    const char *pc = srcBuffer;
+    while (pc < endPtr) {
+        // Valid UTF-8 translates to one word per code point, plus one more for
+        // each four-octet sequence, which becomes a surrogate pair.
+        // 'advanceIfValid' validates and counts a block at a time where the
+        // platform supports it.
+
+        int         status;
+        const char *next;
+        wordsNeeded += Utf8Util::advanceIfValid(&status,
+                                                &next,
+                                                pc,
+                                                endPtr - pc,
+                                                infinity);
+        wordsNeeded += countFourOctetHeaders(
+                                 reinterpret_cast<const Utf8::OctetType *>(pc),
+                                 next - pc);
+        pc = next;
+
+        if (pc < endPtr) {
+            // Each invalid sequence is replaced by a single error word.
+
+            pc = reinterpret_cast<const char *>(skipInvalidSequence(
+                                 reinterpret_cast<const Utf8::OctetType *>(pc),
+                                 endFunctor));
             ++wordsNeeded;
         }
     }
 
-    return wordsNeeded + 1;
+    return wordsNeeded;
 }
 
 template <class UTF16_WORD,
@@ -1176,11 +1285,19 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
                 break;
             }
 
-            *dstBuffer = SWAPPER::encodeSingleWord(*octets);
-            ++octets;
-            ++dstBuffer;
-            --dstCapacity;
-            ++nCodePoints;
+            // Translate the whole run of ASCII, which is the common case, at
+            // once.
+
+            const bsl::size_t n = copyAscii<UTF16_WORD, SWAPPER>(
+                                 dstBuffer,
+                                 octets,
+                                 dstCapacity.limit(endFunctor.end() - octets));
+            BSLS_ASSERT(0 < n);
+
+            octets      += n;
+            dstBuffer   += n;
+            dstCapacity -= n;
+            nCodePoints += n;
             continue;
         }
 
@@ -1733,6 +1850,19 @@ namespace bdlde {
 
                         // -- UTF-8 to UTF-16 Methods
 
+bsl::size_t CharConvertUtf16::computeRequiredUtf16Words(const char *srcBuffer,
+                                                        const char *endPtr)
+{
+    BSLS_ASSERT(srcBuffer);
+    BSLS_ASSERT(!endPtr || srcBuffer <= endPtr);
+
+    if (0 == endPtr) {
+        endPtr = srcBuffer + bsl::strlen(srcBuffer);
+    }
+
+    return utf16BufferLength(srcBuffer, endPtr);
+}
+
 int CharConvertUtf16::utf8ToUtf16(
                                 bsl::wstring             *dstWstring,
                                 const bslstl::StringRef&  srcString,
@@ -1743,7 +1873,7 @@ int CharConvertUtf16::utf8ToUtf16(
     Utf8::PtrBasedEnd endFunctor(srcString.end());
 
     bsl::size_t estLength = utf16BufferLength(srcString.data(),
-                                              endFunctor);
+                                              srcString.end());
     BSLS_ASSERT(estLength > 0);
 
     // Set the length big enough to include the '\0' at the end.  There's no
@@ -1797,10 +1927,10 @@ int CharConvertUtf16::utf8ToUtf16(bsl::wstring       *dstWstring,
                                   wchar_t             errorWord,
                                   ByteOrder::Enum     byteOrder)
 {
-    Utf8::ZeroBasedEnd endFunctor;
+    const char        *endPtr = srcString + bsl::strlen(srcString);
+    Utf8::PtrBasedEnd  endFunctor(endPtr);
 
-    bsl::size_t estLength = utf16BufferLength(srcString,
-                                              endFunctor);
+    bsl::size_t estLength = utf16BufferLength(srcString, endPtr);
     BSLS_ASSERT(estLength > 0);
 
     // Set the length big enough to include the '\0' at the end.  There's no
@@ -1858,7 +1988,7 @@ int CharConvertUtf16::utf8ToUtf16(
     Utf8::PtrBasedEnd endFunctor(srcString.end());
 
     bsl::size_t estLength = utf16BufferLength(srcString.data(),
-                                              endFunctor);
+                                              srcString.end());
     BSLS_ASSERT(estLength > 0);
 
     if (estLength > dstVector->size()) {
@@ -1907,10 +2037,10 @@ int CharConvertUtf16::utf8ToUtf16(
                              unsigned short               errorWord,
                              ByteOrder::Enum              byteOrder)
 {
-    Utf8::ZeroBasedEnd endFunctor;
+    const char        *endPtr = srcString + bsl::strlen(srcString);
+    Utf8::PtrBasedEnd  endFunctor(endPtr);
 
-    bsl::size_t estLength = utf16BufferLength(srcString,
-                                              endFunctor);
+    bsl::size_t estLength = utf16BufferLength(srcString, endPtr);
     BSLS_ASSERT(estLength > 0);
 
     if (estLength > dstVector->size()) {
@@ -1991,7 +2121,7 @@ int CharConvertUtf16::utf8ToUtf16(
                                 unsigned short            errorWord,
                                 ByteOrder::Enum           byteOrder)
 {
-    Utf8::ZeroBasedEnd endFunctor;
+    Utf8::PtrBasedEnd endFunctor(srcString + bsl::strlen(srcString));
 
     return ByteOrder::e_HOST == byteOrder
            ? localUtf8ToUtf16(dstBuffer,
@@ -2050,7 +2180,7 @@ int CharConvertUtf16::utf8ToUtf16(wchar_t         *dstBuffer,
                                   wchar_t          errorWord,
                                   ByteOrder::Enum  byteOrder)
 {
-    Utf8::ZeroBasedEnd endFunctor;
+    Utf8::PtrBasedEnd endFunctor(srcString + bsl::strlen(srcString));
 
     return ByteOrder::e_HOST == byteOrder
            ? localUtf8ToUtf16(dstBuffer,
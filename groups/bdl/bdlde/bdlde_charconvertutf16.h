@@ -51,7 +51,13 @@ BSLS_IDENT("$Id: $")
 // through the data.  The functions that translate to 'bsl::string's and STL
 // containers, however, like the 'glib' conversion routines, make two passes: a
 // size estimation pass, after which the output container is sized
-// appropriately, and then the translation pass.
+// appropriately, and then the translation pass.  Clients translating UTF-8 to
+// buffers of their own can size those buffers exactly by calling
+// 'computeRequiredUtf16Words', which performs the same size calculation.
+//
+// Runs of ASCII, the most common input, are translated a block at a time, and
+// the size calculation for UTF-8 input validates and counts a block at a time
+// (see {'bdlde_utf8util'}).
 //
 // The methods that output to a 'vector', 'string', or 'wstring' will all grow
 // the output object as necessary to fit the data, and in the end will exactly
@@ -312,6 +318,21 @@ struct CharConvertUtf16 {
                         // -- UTF-8 to UTF-16 Methods
 
     // CLASS METHODS
+    static bsl::size_t computeRequiredUtf16Words(const char *srcBuffer,
+                                                 const char *endPtr = 0);
+        // Return the number of UTF-16 words required to store the translation
+        // of the specified UTF-8 'srcBuffer', including the terminating null
+        // word.  Optionally specify 'endPtr', referring to one past the last
+        // input byte.  If 'endPtr' is not specified or is 0, 'srcBuffer' is
+        // treated as null-terminated.  The value returned is exactly the
+        // number of words (or 'wchar_t's) that the 'utf8ToUtf16' functions
+        // write when translating the same input with a non-zero 'errorWord',
+        // and is an upper bound when 'errorWord' is 0.  The behavior is
+        // undefined unless 'srcBuffer' is null-terminated if 'endPtr' is 0,
+        // and 'srcBuffer <= endPtr' otherwise.  Note that this function is
+        // much faster than the translation itself, so calling it to size a
+        // buffer exactly is inexpensive.
+
     static int utf8ToUtf16(
                           bsl::wstring             *dstWstring,
                           const bslstl::StringRef&  srcString,
@@ -128,8 +128,9 @@ using namespace bsl;
 // Exercise boundary cases for both of the conversion mappings as well as
 // handling of buffer capacity issues.
 //-----------------------------------------------------------------------------
-// [15] USAGE EXAMPLE 2
-// [14] USAGE EXAMPLE 1
+// [16] USAGE EXAMPLE 2
+// [15] USAGE EXAMPLE 1
+// [14] TESTING 'computeRequiredUtf16Words' AND ASCII RUNS
 // [13] BACKWARDS BYTE ORDER TEST
 // [12] EMBEDDED ZEROES TEST
 // [11] UTF-16 -> UTF-8: THOROUGH BROKEN GLASS TEST
@@ -144,6 +145,7 @@ using namespace bsl;
 // [ 2] SINGLE-VALUE, LEGAL VALUE TEST
 // [ 1] BREATHING/USAGE TEST
 //-----------------------------------------------------------------------------
+// [14] computeRequiredUtf16Words(const char *, const char *)
 // [13] utf8ToUtf16 (all container overloads)
 // [13] utf16ToUtf8 (all container overloads)
 // [12] utf8ToUtf16 (single container overload)
@@ -4399,6 +4401,101 @@ unsigned char utf8MultiLang[] = {
 const char * const charUtf8MultiLang = (const char *) utf8MultiLang;
 
 
+static
+unsigned int nextRand(unsigned int *seed)
+    // Return a pseudo-random value in the range '[ 0 .. 0x7fff ]' generated
+    // from, and update, the specified 'seed'.
+{
+    *seed = *seed * 1103515245 + 12345;
+    return (*seed >> 16) & 0x7fff;
+}
+
+static
+void appendRandomSegment(bsl::string                 *utf8,
+                         bsl::vector<unsigned short> *utf16,
+                         bool                        *hasError,
+                         bool                         withNulls,
+                         unsigned int                *seed)
+    // Append to the specified 'utf8' a randomly chosen segment of input -- a
+    // run of ASCII, a single multi-octet code point, or a single invalid
+    // octet followed by an ASCII character -- and append to the specified
+    // 'utf16' the words that 'utf8ToUtf16' is expected to produce for that
+    // segment when 'errorWord' is '?'.  Set '*hasError' to 'true' if an
+    // invalid octet was appended.  If the specified 'withNulls' is 'true',
+    // ASCII runs may contain embedded null bytes.  Use the specified 'seed'
+    // to generate random numbers.
+{
+    static const unsigned char INVALID[] = {
+        0x80, 0xbf, 0xc0, 0xc1, 0xdf, 0xe0, 0xef, 0xf0, 0xf4, 0xf5, 0xf8, 0xff
+    };
+
+    unsigned int codePoint;
+    switch (nextRand(seed) % 6) {
+      case 0:
+      case 1: {
+        // ASCII run, long enough to exercise the block-at-a-time path
+
+        const unsigned int len = nextRand(seed) % 80;
+        for (unsigned int ii = 0; ii < len; ++ii) {
+            char c = static_cast<char>(' ' + nextRand(seed) % 95);
+            if (withNulls && 0 == nextRand(seed) % 16) {
+                c = 0;
+            }
+            *utf8 += c;
+            utf16->push_back(static_cast<unsigned char>(c));
+        }
+        return;                                                       // RETURN
+      }
+      case 2: {
+        codePoint = 0x80 + nextRand(seed) % (0x800 - 0x80);
+      } break;
+      case 3: {
+        do {
+            codePoint = 0x800 + nextRand(seed) * 2 % (0x10000 - 0x800);
+        } while (0xd800 <= codePoint && codePoint < 0xe000);
+      } break;
+      case 4: {
+        codePoint = 0x10000 + (nextRand(seed) << 5 | nextRand(seed) % 32) %
+                                                          (0x110000 - 0x10000);
+      } break;
+      default: {
+        *utf8 += static_cast<char>(
+                          INVALID[nextRand(seed) % sizeof INVALID]);
+        *utf8 += 'x';
+        utf16->push_back('?');
+        utf16->push_back('x');
+        *hasError = true;
+        return;                                                       // RETURN
+      }
+    }
+
+    if (codePoint < 0x800) {
+        *utf8 += static_cast<char>(0xc0 | codePoint >> 6);
+        *utf8 += static_cast<char>(0x80 | (codePoint & 0x3f));
+    }
+    else if (codePoint < 0x10000) {
+        *utf8 += static_cast<char>(0xe0 | codePoint >> 12);
+        *utf8 += static_cast<char>(0x80 | (codePoint >> 6 & 0x3f));
+        *utf8 += static_cast<char>(0x80 | (codePoint & 0x3f));
+    }
+    else {
+        *utf8 += static_cast<char>(0xf0 | codePoint >> 18);
+        *utf8 += static_cast<char>(0x80 | (codePoint >> 12 & 0x3f));
+        *utf8 += static_cast<char>(0x80 | (codePoint >> 6 & 0x3f));
+        *utf8 += static_cast<char>(0x80 | (codePoint & 0x3f));
+    }
+
+    if (codePoint < 0x10000) {
+        utf16->push_back(static_cast<unsigned short>(codePoint));
+    }
+    else {
+        const unsigned int offset = codePoint - 0x10000;
+        utf16->push_back(static_cast<unsigned short>(0xd800 | offset >> 10));
+        utf16->push_back(static_cast<unsigned short>(0xdc00 |
+                                                            (offset & 0x3ff)));
+    }
+}
+
 template <class UTF16_WORD>
 static
 int localUtf16Cmp(const UTF16_WORD *a, const UTF16_WORD *b)
@@ -4448,7 +4545,7 @@ int main(int argc, char**argv)
     bslma::DefaultAllocatorGuard daGuard(&da);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         // --------------------------------------------------------------------
@@ -4574,7 +4671,7 @@ int main(int argc, char**argv)
     ASSERT(utf16CodePointsWritten       == uf8CodePointsWritten);
 //..
       } break;
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         // --------------------------------------------------------------------
@@ -4667,6 +4764,196 @@ int main(int argc, char**argv)
     ASSERT(0    == secondUtf16String[5]);
 //..
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'computeRequiredUtf16Words' AND ASCII RUNS
+        //
+        // Concerns:
+        //: 1 'computeRequiredUtf16Words' returns exactly the number of words,
+        //:   including the terminating null word, that the translators write
+        //:   for the same input when 'errorWord' is not 0, and an upper bound
+        //:   when 'errorWord' is 0.
+        //:
+        //: 2 Null-terminated input is measured up to the first null byte.
+        //:
+        //: 3 Runs of ASCII of any length and alignment, interleaved with
+        //:   multi-octet code points and invalid octets, are translated
+        //:   correctly, in both byte orders.
+        //:
+        //: 4 When translating into a buffer that is too small, the ASCII
+        //:   path writes no more than the capacity allows, never splits a
+        //:   surrogate pair, and reports the correct counts.
+        //
+        // Plan:
+        //: 1 Build random input by concatenating segments, each of which is
+        //:   a run of ASCII, a single multi-octet code point, or an invalid
+        //:   octet followed by an ASCII character, computing the expected
+        //:   UTF-16 output of each segment independently.  Translate the
+        //:   input into containers in both byte orders and compare with the
+        //:   expected output, and compare the expected length with
+        //:   'computeRequiredUtf16Words'.  (C-1..3)
+        //:
+        //: 2 Translate each input into buffers with capacities in the range
+        //:   '[ 1 .. required ]', surrounded by guard words, and verify the
+        //:   prefix written, the counts returned, and that the guard words
+        //:   are untouched.  (C-4)
+        //:
+        //: 3 Measure and translate strings of random bytes, which are mostly
+        //:   invalid, and verify that the measurement is exact for a non-zero
+        //:   'errorWord' and an upper bound for a zero 'errorWord'.  (C-1)
+        //
+        // Testing:
+        //   size_t computeRequiredUtf16Words(const char *, const char *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'computeRequiredUtf16Words' AND ASCII"
+                                                                   " RUNS\n"
+                             "=============================================="
+                                                                   "=====\n";
+
+        enum { k_NUM_ITERATIONS = 2000, k_GUARD = 8 };
+
+        const unsigned short GUARD_WORD = 0xa5a5;
+
+        unsigned int seed = 12345;
+
+        if (veryVerbose) cout << "Segmented input\n";
+
+        for (int ti = 0; ti < k_NUM_ITERATIONS; ++ti) {
+            const bool WITH_NULLS = ti & 1;
+
+            bsl::string                 input(&ta);
+            bsl::vector<unsigned short> EXP(&ta);
+            bool                        hasError = false;
+
+            const unsigned int numSegments = nextRand(&seed) % 24;
+            for (unsigned int si = 0; si < numSegments; ++si) {
+                appendRandomSegment(&input,
+                                    &EXP,
+                                    &hasError,
+                                    WITH_NULLS,
+                                    &seed);
+            }
+            EXP.push_back(0);
+
+            const bsl::size_t        LEN  = EXP.size();
+            const char              *BEGIN = input.data();
+            const char              *END   = BEGIN + input.length();
+            const bslstl::StringRef  INPUT(BEGIN, END);
+            const int                EXP_RC = hasError
+                                            ? Status::k_INVALID_INPUT_BIT
+                                            : 0;
+
+            if (veryVeryVerbose) { P_(ti) P_(input.length()) P(LEN) }
+
+            ASSERTV(ti, LEN, Util::computeRequiredUtf16Words(BEGIN, END),
+                         LEN == Util::computeRequiredUtf16Words(BEGIN, END));
+
+            if (!WITH_NULLS) {
+                ASSERTV(ti, LEN == Util::computeRequiredUtf16Words(BEGIN));
+            }
+
+            bsl::vector<unsigned short> vec(&ta);
+            bsl::size_t                 numCodePoints = 0;
+            int rc = Util::utf8ToUtf16(&vec, INPUT, &numCodePoints, '?');
+            ASSERTV(ti, rc, EXP_RC == rc);
+            ASSERTV(ti, EXP == vec);
+
+            if (!WITH_NULLS) {
+                vec.clear();
+                rc = Util::utf8ToUtf16(&vec, BEGIN, 0, '?');
+                ASSERTV(ti, rc, EXP_RC == rc);
+                ASSERTV(ti, EXP == vec);
+            }
+
+            vec.clear();
+            rc = Util::utf8ToUtf16(&vec, INPUT, 0, '?', e_BACKWARDS);
+            ASSERTV(ti, rc, EXP_RC == rc);
+            ASSERTV(ti, LEN == vec.size());
+            for (bsl::size_t ii = 0; ii < LEN && ii < vec.size(); ++ii) {
+                ASSERTV(ti, ii, (swappedEquals<unsigned short, 2>(EXP[ii],
+                                                                  vec[ii])));
+            }
+
+            bsl::wstring wstr(&ta);
+            rc = Util::utf8ToUtf16(&wstr, INPUT, 0, '?');
+            ASSERTV(ti, rc, EXP_RC == rc);
+            ASSERTV(ti, LEN == wstr.length() + 1);
+            for (bsl::size_t ii = 0; ii + 1 < LEN && ii < wstr.length();
+                                                                        ++ii) {
+                ASSERTV(ti, ii, EXP[ii] == static_cast<unsigned>(wstr[ii]));
+            }
+
+            bsl::vector<unsigned short> buffer(LEN + k_GUARD, &ta);
+            for (bsl::size_t cap = 1; cap <= LEN; ++cap) {
+                // Find the longest prefix of whole code points that fits.
+
+                bsl::size_t expWords = 0, expCodePoints = 1;
+                while (expWords + 1 < LEN) {
+                    const bsl::size_t n = 0xd800 <= EXP[expWords] &&
+                                                     EXP[expWords] < 0xdc00
+                                        ? 2
+                                        : 1;
+                    if (expWords + n > cap - 1) {
+                        break;
+                    }
+                    expWords += n;
+                    ++expCodePoints;
+                }
+
+                bsl::fill(buffer.begin(), buffer.end(), GUARD_WORD);
+
+                bsl::size_t numWords = 0;
+                numCodePoints = 0;
+                rc = Util::utf8ToUtf16(buffer.data(),
+                                       cap,
+                                       INPUT,
+                                       &numCodePoints,
+                                       &numWords,
+                                       '?');
+
+                const bool EXP_OUT_OF_SPACE = expWords + 1 < LEN;
+                ASSERTV(ti, cap, rc, EXP_OUT_OF_SPACE ==
+                                !!(rc & Status::k_OUT_OF_SPACE_BIT));
+                ASSERTV(ti, cap, numWords, expWords + 1 == numWords);
+                ASSERTV(ti, cap, numCodePoints, expCodePoints,
+                                              expCodePoints == numCodePoints);
+                ASSERTV(ti, cap, bsl::equal(EXP.begin(),
+                                            EXP.begin() + expWords,
+                                            buffer.begin()));
+                ASSERTV(ti, cap, 0 == buffer[expWords]);
+                for (bsl::size_t ii = expWords + 1; ii < buffer.size();
+                                                                        ++ii) {
+                    ASSERTV(ti, cap, ii, GUARD_WORD == buffer[ii]);
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "Random bytes\n";
+
+        for (int ti = 0; ti < k_NUM_ITERATIONS; ++ti) {
+            bsl::string input(&ta);
+
+            const unsigned int len = nextRand(&seed) % 200;
+            for (unsigned int ii = 0; ii < len; ++ii) {
+                input += static_cast<char>(nextRand(&seed));
+            }
+
+            const char              *BEGIN = input.data();
+            const char              *END   = BEGIN + input.length();
+            const bslstl::StringRef  INPUT(BEGIN, END);
+
+            const bsl::size_t REQUIRED = Util::computeRequiredUtf16Words(BEGIN,
+                                                                         END);
+
+            bsl::vector<unsigned short> vec(&ta);
+            Util::utf8ToUtf16(&vec, INPUT, 0, '?');
+            ASSERTV(ti, REQUIRED, vec.size(), REQUIRED == vec.size());
+
+            Util::utf8ToUtf16(&vec, INPUT, 0, 0);
+            ASSERTV(ti, REQUIRED, vec.size(), REQUIRED >= vec.size());
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // BACKWARDS BYTE ORDER TEST
@@ -8,7 +8,7 @@
 // ----------------------------------------------------------------------------
 
 #include <bdlde_charconvertutf32.h>
-#include <bdlde_utf8util.h>    // for testing only
+#include <bdlde_utf8util.h>
 
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_charconvertutf32_cpp,"$Id$ $CSID$")
@@ -18,12 +18,21 @@ BSLS_IDENT_RCSID(bdlde_charconvertutf32_cpp,"$Id$ $CSID$")
 
 #include <bsls_assert.h>
 #include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>    // 'bsl::find'
 
 #include <bsl_climits.h>      // 'CHAR_BIT'
 #include <bsl_cstring.h>
+#include <bsl_limits.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(__SSE2__)
+// SSE2 is part of the x86-64 baseline, so no run-time dispatch is needed.
+
+#define BDLDE_CHARCONVERTUTF32_SSE2
+#include <emmintrin.h>
+#endif
 
 ///IMPLEMENTATION NOTES
 ///--------------------
@@ -182,7 +191,7 @@ struct Capacity {
     void operator--();
         // Decrement 'd_capacity'.
 
-    void operator-=(int delta);
+    void operator-=(bsl::size_t delta);
         // Decrement 'd_capacity' by the specified 'delta'.
 
     // ACCESSORS
@@ -193,6 +202,11 @@ struct Capacity {
     bool operator>=(bsl::size_t rhs) const;
         // Return 'true' if 'd_capacity' is greater than or equal to the
         // specified 'rhs', and 'false' otherwise.
+
+    bsl::size_t limit(bsl::size_t n) const;
+        // Return the lesser of the specified 'n' and the number of words that
+        // can be output while still leaving room for a null terminator.  The
+        // behavior is undefined unless '1 <= d_capacity'.
 };
 
                            // ---------------------
@@ -214,7 +228,7 @@ void Capacity::operator--()
 }
 
 inline
-void Capacity::operator-=(int delta)
+void Capacity::operator-=(bsl::size_t delta)
     // Decrement 'd_capacity' by 'delta'.
 {
     d_capacity -= delta;
@@ -237,6 +251,12 @@ bool Capacity::operator>=(bsl::size_t rhs) const
     return d_capacity >= rhs;
 }
 
+inline
+bsl::size_t Capacity::limit(bsl::size_t n) const
+{
+    return bsl::min(n, d_capacity - 1);
+}
+
                          // =========================
                          // local struct NoopCapacity
                          // =========================
@@ -257,7 +277,7 @@ struct NoopCapacity {
     void operator--();
         // No-op.
 
-    void operator-=(int);
+    void operator-=(bsl::size_t);
         // No-op.
 
     // ACCESSORS
@@ -266,6 +286,9 @@ struct NoopCapacity {
 
     bool operator>=(bsl::size_t) const;
         // Return 'true'.
+
+    bsl::size_t limit(bsl::size_t n) const;
+        // Return the specified 'n'.
 };
 
                          // -------------------------
@@ -285,7 +308,7 @@ void NoopCapacity::operator--()
 {}
 
 inline
-void NoopCapacity::operator-=(int)
+void NoopCapacity::operator-=(bsl::size_t)
     // No-op.
 {}
 
@@ -304,6 +327,13 @@ bool NoopCapacity::operator>=(bsl::size_t) const
     return true;
 }
 
+inline
+bsl::size_t NoopCapacity::limit(bsl::size_t n) const
+    // Return the specified 'n'.
+{
+    return n;
+}
+
                             // ====================
                             // local struct Swapper
                             // ====================
@@ -312,6 +342,8 @@ struct Swapper {
     // This 'struct' serves as a template argument.  The type is used for
     // reversing the byte order of 'unsigned int' values passed to 'swapBytes'.
 
+    enum { k_SWAPPED = 1 };
+
     // CLASS METHODS
     static unsigned int swapBytes(unsigned int x);
         // Return the specified 'x' with its byte order reversed;
@@ -334,6 +366,8 @@ struct NoopSwapper {
     // function name and signature must match that of the function in
     // 'Swapper'.
 
+    enum { k_SWAPPED = 0 };
+
     // CLASS METHODS
     static unsigned int swapBytes(unsigned int x);
         // Return the specified 'x' without modification.
@@ -365,6 +399,9 @@ class Utf8PtrBasedEnd {
         // 'end'.
 
     // ACCESSORS
+    const OctetType *end() const;
+        // Return the end of input.
+
     bool isFinished(const OctetType *position) const;
         // Return 'true' if the specified 'position' is at the end of input and
         // 'false' otherwise.  The behavior is undefined unless
@@ -394,6 +431,12 @@ Utf8PtrBasedEnd::Utf8PtrBasedEnd(const char *end)
 {}
 
 // ACCESSORS
+inline
+const OctetType *Utf8PtrBasedEnd::end() const
+{
+    return d_end;
+}
+
 inline
 bool Utf8PtrBasedEnd::isFinished(const OctetType *position) const
 {
@@ -448,88 +491,6 @@ bool Utf8PtrBasedEnd::verifyContinuations(const OctetType *octets,
     return true;
 }
 
-                       // =============================
-                       // local struct Utf8ZeroBasedEnd
-                       // =============================
-
-struct Utf8ZeroBasedEnd {
-    // CREATORS
-    Utf8ZeroBasedEnd();
-        // Create a 'Utf8ZeroBasedEnd' object.
-
-    // ACCESSORS
-    bool isFinished(const OctetType *position) const;
-        // Return 'true' if the specified 'position' is at the end of input,
-        // and 'false' otherwise.
-
-    const OctetType *skipContinuations(const OctetType *octets,
-                                       int              skipBy) const;
-        // Return a pointer to after up to the specified 'skipBy' consecutive
-        // continuation bytes following the specified 'octets'.  The function
-        // will skip over less than 'skipBy' octets if it encounters end of
-        // input, or any non-continuation octets.  The behavior is undefined
-        // unless 'octets' is before or at the end of input.
-
-    bool verifyContinuations(const OctetType *octets, int n) const;
-        // Return 'true' if there are at least the specified 'n' continuation
-        // bytes beginning at the specified 'octets' and 'false' otherwise.
-        // The behavior is undefined unless 'n >= 1'.
-};
-
-                       // -----------------------------
-                       // local struct Utf8ZeroBasedEnd
-                       // -----------------------------
-
-// CREATORS
-inline
-Utf8ZeroBasedEnd::Utf8ZeroBasedEnd()
-{
-}
-
-// ACCESSORS
-inline
-bool Utf8ZeroBasedEnd::isFinished(const OctetType *position) const
-{
-    return 0 == *position;
-}
-
-inline
-const OctetType *Utf8ZeroBasedEnd::skipContinuations(
-                                                 const OctetType *octets,
-                                                 int              skipBy) const
-{
-    // This function is not called in the critical path.  It is called when it
-    // is known that there are not as many continuation octets after 'octets'
-    // as were expected.  Note that if '0 == *octets' the loop will stop.
-
-    const OctetType *end = octets + skipBy;
-
-    while (octets < end && (*octets & k_CONTINUE_MASK) == k_CONTINUE_TAG) {
-        ++octets;
-    }
-
-    return octets;
-}
-
-inline
-bool Utf8ZeroBasedEnd::verifyContinuations(const OctetType *octets,
-                                           int              n) const
-{
-    BSLS_ASSERT(n >= 1);
-
-    const OctetType *end = octets + n;
-    do {
-        if ((*octets & k_CONTINUE_MASK) != k_CONTINUE_TAG) {
-            return false;                                             // RETURN
-        }
-
-        ++octets;
-    } while (octets < end);
-
-    return true;
-}
-
-
                         // ============================
                         // local class Utf32PtrBasedEnd
                         // ============================
@@ -704,20 +665,6 @@ unsigned int decodeFourOctets(const OctetType *octBuf)
             | ((octBuf[0] & ~k_FOUR_OCTET_MASK) << 3 * k_CONTINUE_CONT_WID);
 }
 
-static inline
-bsl::size_t lookaheadContinuations(const OctetType * const octBuf, int n)
-    // Return the number of continuation octets beginning at the specified
-    // 'octBuf', up to but not greater than the specified 'n'.  Note that a
-    // null octet is not a continuation and is taken to end the scan.
-{
-    const OctetType *       pc  = octBuf;
-    const OctetType * const end = pc + n;
-    while (pc < end && isContinuation(*pc)) {
-        ++pc;
-    }
-    return pc - octBuf;
-}
-
 static inline
 bool fitsInSingleOctet(unsigned int uc)
     // Return 'true' if the specified Unicode value 'uc' can be coded in a
@@ -817,18 +764,21 @@ bool isLegalUtf32ErrorWord(unsigned int uc)
 #endif
 
 static inline
-const OctetType *skipUtf8CodePoint(const OctetType *input)
-    // Return a pointer to the next Unicode code point after the code point in
-    // the sequence beginning at the specified 'input'.  Note that an
-    // incomplete sequence is skipped as a single char, and that any first byte
-    // that is neither a single byte nor a header of a valid UTF-8 sequence is
-    // interpreted as a 5-byte header.
+const OctetType *skipInvalidSequence(const OctetType *input,
+                                     Utf8PtrBasedEnd  endFunctor)
+    // Return a pointer to the next Unicode code point after the invalid
+    // sequence beginning at the specified 'input', using the specified
+    // 'endFunctor' to determine end of input.  The octets skipped are exactly
+    // those that 'Utf8ToUtf32Translator' replaces with a single error word.
+    // Note that an incomplete sequence is skipped up to the first octet that
+    // is not a continuation, and that any first byte that is neither a single
+    // byte nor a header of a valid UTF-8 sequence is interpreted as a 5-byte
+    // header.  The behavior is undefined unless the sequence beginning at
+    // 'input' is not valid UTF-8.
 {
     const OctetType uc = *input;
 
-    if (isSingleOctet(uc)) {
-        return input + 1;                                             // RETURN
-    }
+    BSLS_ASSERT(!isSingleOctet(uc));
 
     int expected = isTwoOctetHeader(uc)
                  ? 1
@@ -837,41 +787,122 @@ const OctetType *skipUtf8CodePoint(const OctetType *input)
                    : isFourOctetHeader(uc)
                      ? 3
                      : 4;
-    ++input;
-    return input + lookaheadContinuations(input, expected);
+    return endFunctor.skipContinuations(input + 1, expected);
 }
 
-template <class END_FUNCTOR>
 static
-bsl::size_t utf32BufferLengthNeeded(const char  *input,
-                                    END_FUNCTOR  endFunctor)
-    // Return the number of 'unsigned int's sufficient to store the UTF-8
-    // sequence beginning at the specified 'input', including the terminating 0
-    // word of the output.  Use the specified 'endFunctor' to determine end of
-    // input.  Note that if the translation occurs with 0 specified as the
-    // error word and errors are present, this will be an over-estimate,
-    // otherwise the result will be exact.  Also note that the end of 'input'
-    // is determined by 'endFunctor', which will treat the input as either
-    // null-terminated or fixed-length.
+bsl::size_t utf32BufferLengthNeeded(const char *input, const char *end)
+    // Return the number of 'unsigned int's sufficient to store the translation
+    // of the UTF-8 sequence '[ input, end )', including the terminating 0 word
+    // of the output.  Note that if the translation occurs with 0 specified as
+    // the error word and errors are present, this will be an over-estimate,
+    // otherwise the result will be exact.
 {
-    // Note that to exactly calculate the size would require much more detailed
-    // decoding and would hence be much slower.  Also, the default is for the
-    // error word not to be 0, in which case this estimate will be exact.
-    // Also, error sequences will usually range from extremely rare to totally
-    // not present.  For these reasons, this faster, less exact algorithm was
-    // chosen.
+    typedef BloombergLP::bdlde::Utf8Util     Utf8Util;
+    typedef BloombergLP::bsls::Types::IntPtr IntPtr;
 
-    BSLMF_ASSERT((bsl::is_same<END_FUNCTOR,  Utf8PtrBasedEnd>::value ||
-                  bsl::is_same<END_FUNCTOR, Utf8ZeroBasedEnd>::value));
+    const IntPtr infinity = bsl::numeric_limits<IntPtr>::max();
 
-    const OctetType *octets = constOctetCast(input);
+    Utf8PtrBasedEnd endFunctor(end);
+    bsl::size_t     ret = 1;    // the terminating 0 word
 
-    bsl::size_t ret = 0;
-    for (; ! endFunctor.isFinished(octets); ++ret) {
-        octets = skipUtf8CodePoint(octets);
+    while (input < end) {
+        // Valid UTF-8 translates to one word per code point.  'advanceIfValid'
+        // validates and counts a block at a time where the platform supports
+        // it.
+
+        int status;
+        ret += Utf8Util::advanceIfValid(&status,
+                                        &input,
+                                        input,
+                                        end - input,
+                                        infinity);
+
+        if (input < end) {
+            // Each invalid sequence is replaced by a single error word.
+
+            input = reinterpret_cast<const char *>(skipInvalidSequence(
+                                                         constOctetCast(input),
+                                                         endFunctor));
+            ++ret;
+        }
     }
 
-    return ret + 1;
+    return ret;
+}
+
+#if defined(BDLDE_CHARCONVERTUTF32_SSE2)
+template <class SWAPPER>
+static
+bsl::size_t widenAsciiBlocks(unsigned int    *output,
+                             const OctetType *input,
+                             bsl::size_t      maxLength)
+    // Translate the longest sequence of whole 16-octet blocks of ASCII, of
+    // total length not greater than the specified 'maxLength', beginning at
+    // the specified 'input' to UTF-32 words, swapped as by 'SWAPPER', at the
+    // specified 'output'.  Return the number of octets translated.
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    bsl::size_t done = 0;
+    for (; 16 <= maxLength - done; done += 16) {
+        const __m128i in = _mm_loadu_si128(
+                              reinterpret_cast<const __m128i *>(input + done));
+        if (_mm_movemask_epi8(in)) {
+            break;
+        }
+
+        // Interleaving twice with zeros widens each octet to 32 bits.  Putting
+        // the zeros first places the octet in the high-order byte, which is
+        // the swapped encoding.
+
+        __m128i *out = reinterpret_cast<__m128i *>(output + done);
+        if (SWAPPER::k_SWAPPED) {
+            const __m128i lo = _mm_unpacklo_epi8(zero, in);
+            const __m128i hi = _mm_unpackhi_epi8(zero, in);
+
+            _mm_storeu_si128(out,     _mm_unpacklo_epi16(zero, lo));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(zero, lo));
+            _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(zero, hi));
+            _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(zero, hi));
+        }
+        else {
+            const __m128i lo = _mm_unpacklo_epi8(in, zero);
+            const __m128i hi = _mm_unpackhi_epi8(in, zero);
+
+            _mm_storeu_si128(out,     _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(hi, zero));
+        }
+    }
+
+    return done;
+}
+#endif
+
+template <class SWAPPER>
+static inline
+bsl::size_t copyAscii(unsigned int    *output,
+                      const OctetType *input,
+                      bsl::size_t      maxLength)
+    // Translate the run of ASCII octets beginning at the specified 'input' to
+    // UTF-32 words, swapped as by 'SWAPPER', at the specified 'output',
+    // stopping at the first octet that is not ASCII or after the specified
+    // 'maxLength' octets, whichever comes first.  Return the number of octets
+    // translated.
+{
+    bsl::size_t done = 0;
+
+#if defined(BDLDE_CHARCONVERTUTF32_SSE2)
+    done = widenAsciiBlocks<SWAPPER>(output, input, maxLength);
+#endif
+
+    for (; done < maxLength && isSingleOctet(input[done]); ++done) {
+        output[done] = SWAPPER::swapBytes(input[done]);
+    }
+
+    return done;
 }
 
 template <class END_FUNCTOR, class SWAPPER>
@@ -946,10 +977,10 @@ class Utf8ToUtf32Translator {
     // generate no code and waste no CPU time.
     //
     // The template argument 'END_FUNCTOR' is used for determining the end of
-    // input.  If the input is null terminated, 'Utf8ZeroBasedEnd' is used for
-    // 'END_FUNCTOR'; if the input is of fixed length, an instance of
-    // 'Utf8PtrBasedEnd', which contains a pointer to the end of the string, is
-    // used.
+    // input.  It is always 'Utf8PtrBasedEnd', which contains a pointer to the
+    // end of the string; the length of null-terminated input is found before
+    // translating it, so that runs of ASCII can be translated a block at a
+    // time without reading past the end of input.
     //
     // The template argument 'SWAPPER' is use for handling the byte order of
     // the UTF-32 output.  If the output is in host byte order, the
@@ -960,8 +991,7 @@ class Utf8ToUtf32Translator {
     BSLMF_ASSERT((bsl::is_same<CAPACITY,            Capacity>::value ||
                   bsl::is_same<CAPACITY,        NoopCapacity>::value));
 
-    BSLMF_ASSERT((bsl::is_same<END_FUNCTOR,  Utf8PtrBasedEnd>::value ||
-                  bsl::is_same<END_FUNCTOR, Utf8ZeroBasedEnd>::value));
+    BSLMF_ASSERT((bsl::is_same<END_FUNCTOR,  Utf8PtrBasedEnd>::value));
 
     BSLMF_ASSERT((bsl::is_same<SWAPPER,              Swapper>::value ||
                   bsl::is_same<SWAPPER,          NoopSwapper>::value));
@@ -1005,11 +1035,12 @@ class Utf8ToUtf32Translator {
         // is undefined unless 'd_capacity >= 2'.
 
     int decodeCodePoint();
-        // Read one Unicode code point of UTF-8 from the input stream
-        // 'd_input', and update the output and the state of this object
-        // accordingly.  Return a non-zero value if there was insufficient
-        // capacity for the output, and 0 otherwise.  The behavior is undefined
-        // unless at least 1 word of space is available in the output buffer.
+        // Read one Unicode code point of UTF-8, or a run of ASCII code points,
+        // from the input stream 'd_input', and update the output and the state
+        // of this object accordingly.  Return a non-zero value if there was
+        // insufficient capacity for the output, and 0 otherwise.  The behavior
+        // is undefined unless at least 1 word of space is available in the
+        // output buffer.
 
   public:
     // CLASS METHODS
@@ -1083,9 +1114,19 @@ int Utf8ToUtf32Translator<CAPACITY, END_FUNCTOR, SWAPPER>::decodeCodePoint()
     }
 
     if      (isSingleOctet(     firstOctet)) {
-        len = 1;
-        good = true;
-        decodedCodePoint = firstOctet;
+        // Translate the whole run of ASCII, which is the common case, at
+        // once.
+
+        const bsl::size_t n = copyAscii<SWAPPER>(
+                               d_output,
+                               d_input,
+                               d_capacity.limit(d_endFunctor.end() - d_input));
+        BSLS_ASSERT(0 < n);
+
+        d_input    += n;
+        d_output   += n;
+        d_capacity -= n;
+        return 0;                                                     // RETURN
     }
     else if (isTwoOctetHeader(  firstOctet)) {
         len = 2;
@@ -1475,6 +1516,19 @@ namespace bdlde {
                                   // UTF8 to UTF32
 
 // CLASS METHODS
+bsl::size_t CharConvertUtf32::computeRequiredUtf32Words(const char *srcBuffer,
+                                                        const char *endPtr)
+{
+    BSLS_ASSERT(srcBuffer);
+    BSLS_ASSERT(!endPtr || srcBuffer <= endPtr);
+
+    if (0 == endPtr) {
+        endPtr = srcBuffer + bsl::strlen(srcBuffer);
+    }
+
+    return utf32BufferLengthNeeded(srcBuffer, endPtr);
+}
+
 int CharConvertUtf32::utf8ToUtf32(bsl::vector<unsigned int> *dstVector,
                                   const char                *srcString,
                                   unsigned int               errorWord,
@@ -1485,15 +1539,15 @@ int CharConvertUtf32::utf8ToUtf32(bsl::vector<unsigned int> *dstVector,
     BSLS_ASSERT(isLegalUtf32ErrorWord(errorWord));
 
     typedef Utf8ToUtf32Translator<NoopCapacity,
-                                  Utf8ZeroBasedEnd,
+                                  Utf8PtrBasedEnd,
                                   Swapper> SwapTranslator;
     typedef Utf8ToUtf32Translator<NoopCapacity,
-                                  Utf8ZeroBasedEnd,
+                                  Utf8PtrBasedEnd,
                                   NoopSwapper> NoSwapTranslator;
-    Utf8ZeroBasedEnd endFunctor;
+    const char      *endPtr = srcString + bsl::strlen(srcString);
+    Utf8PtrBasedEnd  endFunctor(endPtr);
 
-    bsl::size_t bufferLen = utf32BufferLengthNeeded(srcString,
-                                                    endFunctor);
+    bsl::size_t bufferLen = utf32BufferLengthNeeded(srcString, endPtr);
     BSLS_ASSERT(bufferLen > 0);
     dstVector->resize(bufferLen);
 
@@ -1567,7 +1621,7 @@ int CharConvertUtf32::utf8ToUtf32(bsl::vector<unsigned int> *dstVector,
     Utf8PtrBasedEnd endFunctor(srcString.end());
 
     bsl::size_t bufferLen = utf32BufferLengthNeeded(srcString.begin(),
-                                                    endFunctor);
+                                                    srcString.end());
     BSLS_ASSERT(bufferLen > 0);
     dstVector->resize(bufferLen);
 
@@ -1629,13 +1683,13 @@ int CharConvertUtf32::utf8ToUtf32(unsigned int          *dstBuffer,
     BSLS_ASSERT(isLegalUtf32ErrorWord(errorWord));
 
     typedef Utf8ToUtf32Translator<Capacity,
-                                  Utf8ZeroBasedEnd,
+                                  Utf8PtrBasedEnd,
                                   Swapper> SwapTranslator;
     typedef Utf8ToUtf32Translator<Capacity,
-                                  Utf8ZeroBasedEnd,
+                                  Utf8PtrBasedEnd,
                                   NoopSwapper> NoSwapTranslator;
 
-    Utf8ZeroBasedEnd endFunctor;
+    Utf8PtrBasedEnd endFunctor(srcString + bsl::strlen(srcString));
 
     bsl::size_t localNumCodePointsWritten;
     if (0 == numCodePointsWritten) {
@@ -49,7 +49,13 @@ BSLS_IDENT("$Id: $")
 // through the data.  The functions that translate to 'bsl::string's and
 // 'bsl::vector's, however, like the 'glib' conversion routines, make two
 // passes: a size estimation pass, after which the output container is sized
-// appropriately, and then the translation pass.
+// appropriately, and then the translation pass.  Clients translating UTF-8 to
+// buffers of their own can size those buffers exactly by calling
+// 'computeRequiredUtf32Words', which performs the same size calculation.
+//
+// Runs of ASCII, the most common input, are translated from UTF-8 a block at a
+// time, and the size calculation validates and counts a block at a time (see
+// {'bdlde_utf8util'}).
 //
 // The methods that output to a 'vector' or 'string' will all grow the output
 // object as necessary to fit the data, and in the end will exactly resize the
@@ -203,6 +209,19 @@ struct CharConvertUtf32 {
                           // UTF-8 to UTF-32 Methods
 
     // CLASS METHODS
+    static bsl::size_t computeRequiredUtf32Words(const char *srcBuffer,
+                                                 const char *endPtr = 0);
+        // Return the number of 'unsigned int' words required to store the
+        // translation of the specified UTF-8 'srcBuffer', including the
+        // terminating null word.  Optionally specify 'endPtr', referring to
+        // one past the last input byte.  If 'endPtr' is not specified or is 0,
+        // 'srcBuffer' is treated as null-terminated.  The value returned is
+        // exactly the number of words that the 'utf8ToUtf32' functions write
+        // when translating the same input with a non-zero 'errorWord', and is
+        // an upper bound when 'errorWord' is 0.  The behavior is undefined
+        // unless 'srcBuffer' is null-terminated if 'endPtr' is 0, and
+        // 'srcBuffer <= endPtr' otherwise.
+
     static int utf8ToUtf32(bsl::vector<unsigned int> *dstVector,
                            const char                *srcString,
                            unsigned int               errorWord = '?',
@@ -74,7 +74,9 @@ using bsl::size_t;
 //:   capacity specified was adequate, and is never set on translations with
 //:   STL container output destinations.
 // ----------------------------------------------------------------------------
-// [17] USAGE EXAMPLE
+// [19] USAGE EXAMPLE
+// [18] 'computeRequiredUtf32Words' and ASCII runs
+// [17] UTF-32 <- UTF-8 Random table driven sequences with embedded nulls
 // [16] UTF-32 <- UTF-8 Random garbage input, random error word
 // [15] UTF-32 <- UTF-8 Table generated random sequences, random error word
 // [14] UTF-8 <- UTF-32 Random garbage input, random error byte
@@ -2493,6 +2495,72 @@ unsigned int myRandUtf32Word()
     }
 }
 
+static
+void appendRandomSegment(bsl::string               *utf8,
+                         bsl::vector<unsigned int> *utf32,
+                         bool                      *hasError,
+                         bool                       withNulls)
+    // Append to the specified 'utf8' a randomly chosen segment of input -- a
+    // run of ASCII, a single multi-octet code point, or a single invalid
+    // octet followed by an ASCII character -- and append to the specified
+    // 'utf32' the words that 'utf8ToUtf32' is expected to produce for that
+    // segment when 'errorWord' is '?'.  Set '*hasError' to 'true' if an
+    // invalid octet was appended.  If the specified 'withNulls' is 'true',
+    // ASCII runs may contain embedded null bytes.
+{
+    static const unsigned char INVALID[] = {
+        0x80, 0xbf, 0xc0, 0xc1, 0xdf, 0xe0, 0xef, 0xf0, 0xf4, 0xf5, 0xf8, 0xff
+    };
+
+    const unsigned int typ = myRand15() % 6;
+    if (typ < 2) {
+        // ASCII run, long enough to exercise the block-at-a-time path
+
+        const unsigned int len = myRand15() % 80;
+        for (unsigned int ii = 0; ii < len; ++ii) {
+            char c = static_cast<char>(' ' + myRand15() % 95);
+            if (withNulls && 0 == myRand15() % 16) {
+                c = 0;
+            }
+            *utf8 += c;
+            utf32->push_back(static_cast<unsigned char>(c));
+        }
+        return;                                                       // RETURN
+    }
+
+    if (5 == typ) {
+        *utf8 += static_cast<char>(INVALID[myRand15() % sizeof INVALID]);
+        *utf8 += 'x';
+        utf32->push_back('?');
+        utf32->push_back('x');
+        *hasError = true;
+        return;                                                       // RETURN
+    }
+
+    unsigned int codePoint;
+    do {
+        codePoint = myRandUtf32Word();
+    } while (codePoint < 0x80 || (0xd800 <= codePoint && codePoint < 0xe000)
+                              || 0x10ffff < codePoint);
+
+    if (codePoint < 0x800) {
+        *utf8 += static_cast<char>(0xc0 | codePoint >> 6);
+        *utf8 += static_cast<char>(0x80 | (codePoint & 0x3f));
+    }
+    else if (codePoint < 0x10000) {
+        *utf8 += static_cast<char>(0xe0 | codePoint >> 12);
+        *utf8 += static_cast<char>(0x80 | (codePoint >> 6 & 0x3f));
+        *utf8 += static_cast<char>(0x80 | (codePoint & 0x3f));
+    }
+    else {
+        *utf8 += static_cast<char>(0xf0 | codePoint >> 18);
+        *utf8 += static_cast<char>(0x80 | (codePoint >> 12 & 0x3f));
+        *utf8 += static_cast<char>(0x80 | (codePoint >> 6 & 0x3f));
+        *utf8 += static_cast<char>(0x80 | (codePoint & 0x3f));
+    }
+    utf32->push_back(codePoint);
+}
+
 template <class TYPE>
 struct NotEqual {
     // For passing to 'bsl::find_if'.
@@ -2742,7 +2810,7 @@ int main(int argc, char **argv)
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 18: {
+      case 19: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Simple example illustrating how one might use the 'utf8ToUtf32'
@@ -2872,6 +2940,159 @@ int main(int argc, char **argv)
     ASSERT(v32.size()                   == codePointsWritten);
 //..
       } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING 'computeRequiredUtf32Words' AND ASCII RUNS
+        //
+        // Concerns:
+        //: 1 'computeRequiredUtf32Words' returns exactly the number of words,
+        //:   including the terminating null word, that the translators write
+        //:   for the same input when 'errorWord' is not 0, and an upper bound
+        //:   when 'errorWord' is 0.
+        //:
+        //: 2 Null-terminated input is measured up to the first null byte.
+        //:
+        //: 3 Runs of ASCII of any length and alignment, interleaved with
+        //:   multi-octet code points and invalid octets, are translated
+        //:   correctly, in both byte orders.
+        //:
+        //: 4 When translating into a buffer that is too small, the ASCII
+        //:   path writes exactly 'capacity' words, and reports the correct
+        //:   count.
+        //
+        // Plan:
+        //: 1 Build random input by concatenating segments, each of which is
+        //:   a run of ASCII, a single multi-octet code point, or an invalid
+        //:   octet followed by an ASCII character, computing the expected
+        //:   UTF-32 output of each segment independently.  Translate the
+        //:   input into vectors in both byte orders and compare with the
+        //:   expected output, and compare the expected length with
+        //:   'computeRequiredUtf32Words'.  (C-1..3)
+        //:
+        //: 2 Translate each input into buffers with capacities in the range
+        //:   '[ 1 .. required ]', surrounded by guard words, and verify the
+        //:   prefix written, the count returned, and that the guard words are
+        //:   untouched.  (C-4)
+        //:
+        //: 3 Measure and translate strings of random bytes, which are mostly
+        //:   invalid, and verify that the measurement is exact for a non-zero
+        //:   'errorWord' and an upper bound for a zero 'errorWord'.  (C-1)
+        //
+        // Testing:
+        //   size_t computeRequiredUtf32Words(const char *, const char *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout <<
+                    "\nTESTING 'computeRequiredUtf32Words' AND ASCII RUNS\n"
+                      "==================================================\n";
+
+        enum { k_NUM_ITERATIONS = 2000, k_GUARD = 8 };
+
+        const unsigned int GUARD_WORD = 0xa5a5a5a5;
+
+        if (veryVerbose) cout << "Segmented input\n";
+
+        for (int ti = 0; ti < k_NUM_ITERATIONS; ++ti) {
+            const bool WITH_NULLS = ti & 1;
+
+            bsl::string               input;
+            bsl::vector<unsigned int> EXP;
+            bool                      hasError = false;
+
+            const unsigned int numSegments = myRand15() % 24;
+            for (unsigned int si = 0; si < numSegments; ++si) {
+                appendRandomSegment(&input, &EXP, &hasError, WITH_NULLS);
+            }
+            EXP.push_back(0);
+
+            const bsl::size_t        LEN   = EXP.size();
+            const char              *BEGIN = input.data();
+            const char              *END   = BEGIN + input.length();
+            const bslstl::StringRef  INPUT(BEGIN, END);
+            const int                EXP_RC = hasError
+                                            ? Status::k_INVALID_INPUT_BIT
+                                            : 0;
+
+            if (veryVeryVerbose) { P_(ti) P_(input.length()) P(LEN) }
+
+            LOOP3_ASSERT(ti, LEN, Util::computeRequiredUtf32Words(BEGIN, END),
+                         LEN == Util::computeRequiredUtf32Words(BEGIN, END));
+
+            if (!WITH_NULLS) {
+                LOOP_ASSERT(ti, LEN == Util::computeRequiredUtf32Words(BEGIN));
+            }
+
+            bsl::vector<unsigned int> vec;
+            int rc = Util::utf8ToUtf32(&vec, INPUT, '?');
+            LOOP2_ASSERT(ti, rc, EXP_RC == rc);
+            LOOP3_ASSERT(ti, dumpUtf32Vec(EXP), dumpUtf32Vec(vec),
+                                                                  EXP == vec);
+
+            if (!WITH_NULLS) {
+                vec.clear();
+                rc = Util::utf8ToUtf32(&vec, BEGIN, '?');
+                LOOP2_ASSERT(ti, rc, EXP_RC == rc);
+                LOOP_ASSERT(ti, EXP == vec);
+            }
+
+            vec.clear();
+            rc = Util::utf8ToUtf32(&vec, INPUT, '?', oppositeEndian);
+            LOOP2_ASSERT(ti, rc, EXP_RC == rc);
+            LOOP_ASSERT(ti, LEN == vec.size());
+            for (bsl::size_t ii = 0; ii < LEN && ii < vec.size(); ++ii) {
+                LOOP2_ASSERT(ti, ii, EXP[ii] == sb(vec[ii]));
+            }
+
+            bsl::vector<unsigned int> buffer(LEN + k_GUARD);
+            for (bsl::size_t cap = 1; cap <= LEN; ++cap) {
+                bsl::fill(buffer.begin(), buffer.end(), GUARD_WORD);
+
+                bsl::size_t numCodePoints = 0;
+                rc = Util::utf8ToUtf32(buffer.data(),
+                                       cap,
+                                       INPUT,
+                                       &numCodePoints,
+                                       '?');
+
+                const bool EXP_OUT_OF_SPACE = cap < LEN;
+                LOOP3_ASSERT(ti, cap, rc, EXP_OUT_OF_SPACE ==
+                                         !!(rc & Status::k_OUT_OF_SPACE_BIT));
+                LOOP3_ASSERT(ti, cap, numCodePoints, cap == numCodePoints);
+                LOOP2_ASSERT(ti, cap, bsl::equal(EXP.begin(),
+                                                 EXP.begin() + cap - 1,
+                                                 buffer.begin()));
+                LOOP2_ASSERT(ti, cap, 0 == buffer[cap - 1]);
+                for (bsl::size_t ii = cap; ii < buffer.size(); ++ii) {
+                    LOOP3_ASSERT(ti, cap, ii, GUARD_WORD == buffer[ii]);
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "Random bytes\n";
+
+        for (int ti = 0; ti < k_NUM_ITERATIONS; ++ti) {
+            bsl::string input;
+
+            const unsigned int len = myRand15() % 200;
+            for (unsigned int ii = 0; ii < len; ++ii) {
+                input += static_cast<char>(myRand15());
+            }
+
+            const char              *BEGIN = input.data();
+            const char              *END   = BEGIN + input.length();
+            const bslstl::StringRef  INPUT(BEGIN, END);
+
+            const bsl::size_t REQUIRED = Util::computeRequiredUtf32Words(BEGIN,
+                                                                         END);
+
+            bsl::vector<unsigned int> vec;
+            Util::utf8ToUtf32(&vec, INPUT, '?');
+            LOOP3_ASSERT(ti, REQUIRED, vec.size(), REQUIRED == vec.size());
+
+            Util::utf8ToUtf32(&vec, INPUT, 0);
+            LOOP3_ASSERT(ti, REQUIRED, vec.size(), REQUIRED >= vec.size());
+        }
+      } break;
       case 17: {
         // --------------------------------------------------------------------
         // RANDOM TABLE DRIVEN UTF-8 -> UTF-32 TEST PLUS EMBEDDED NULLS
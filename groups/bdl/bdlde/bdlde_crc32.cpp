@@ -15,6 +15,16 @@ BSLS_IDENT_RCSID(bdlde_crc32_cpp,"$Id$ $CSID$")
 #include <bslmf_assert.h>
 
 #include <bsls_annotation.h>
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(BSLS_PLATFORM_CPU_X86)
+#if defined(BSLS_PLATFORM_CMP_CLANG) ||                                       \
+    (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900)
+#define BDLDE_CRC32_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+#endif
 
 ///IMPLEMENTATION NOTES
 ///--------------------
@@ -93,6 +103,22 @@ BSLS_IDENT_RCSID(bdlde_crc32_cpp,"$Id$ $CSID$")
 //..
 //  http://ravenphpscripts.com/modules.php?name=Forums&file=viewtopic&t=614
 //..
+//
+// On x86 processors supporting the 'PCLMULQDQ' instruction, long inputs are
+// instead processed by folding: the running remainder is kept in 128-bit
+// registers and, for each further 16 bytes of input, is multiplied (without
+// carries) by 'x^(128 + 32)' and 'x^(128 - 32)' modulo the CRC polynomial
+// and added to the input, which preserves the remainder of the whole
+// sequence.  Four registers are folded in parallel to hide the latency of the
+// multiplication, and the final 128 bits are reduced to 32 by a Barrett
+// reduction.  This is the method of Gopal et al., "Fast CRC Computation for
+// Generic Polynomials Using PCLMULQDQ Instruction" (Intel, 2009); the
+// constants used are those of the reflected polynomial, as derived there.
+//
+// 'combine' relies on the fact that appending 'n' bytes to a sequence
+// multiplies its (unconditioned) remainder by 'x^(8 * n)'.  The powers
+// 'x^(2^k)' needed to compute 'x^(8 * n)' by repeated squaring are
+// tabulated; for this polynomial they repeat with a period of 32.
 
 #include <bsls_assert.h>
 #include <bsl_ostream.h>
@@ -158,6 +184,165 @@ static const unsigned int CRC_TABLE[256] = {
     0x2d02ef8d
 };
 
+static const unsigned int k_X2N_TABLE[32] = {
+    // The following table holds, for each 'n' in '[ 0 .. 31 ]', the value of
+    // 'x^(2^n)' modulo the CRC-32 polynomial, in the reflected bit order used
+    // by 'CRC_TABLE' (i.e., 'x^0' is represented by '0x80000000').
+
+    0x40000000, 0x20000000, 0x08000000, 0x00800000,
+    0x00008000, 0xedb88320, 0xb1e6b092, 0xa06a2517,
+    0xed627dae, 0x88d14467, 0xd7bbfe6a, 0xec447f11,
+    0x8e7ea170, 0x6427800e, 0x4d47bae0, 0x09fe548f,
+    0x83852d0f, 0x30362f1a, 0x7b5a9cc3, 0x31fec169,
+    0x9fec022a, 0x6c8dedc4, 0x15d6874d, 0x5fde7a4e,
+    0xbad90e37, 0x2e4e5eef, 0x4eaba214, 0xa8a472c0,
+    0x429a969e, 0x148d302a, 0xc40ba6d0, 0xc4e22c3c
+};
+
+static
+unsigned int multiplyModP(unsigned int a, unsigned int b)
+    // Return the product of the specified 'a' and 'b', each a polynomial over
+    // GF(2) in the reflected bit order of 'k_X2N_TABLE', modulo the CRC-32
+    // polynomial.
+{
+    static const unsigned int k_POLY = 0xedb88320;
+
+    unsigned int product = 0;
+    for (unsigned int mask = 0x80000000; a; mask >>= 1) {
+        if (a & mask) {
+            product ^= b;
+            a       ^= mask;
+        }
+        b = b & 1 ? (b >> 1) ^ k_POLY : b >> 1;
+    }
+    return product;
+}
+
+static
+unsigned int xPowEightNModP(bsl::size_t n)
+    // Return 'x^(8 * n)' modulo the CRC-32 polynomial, in the reflected bit
+    // order of 'k_X2N_TABLE', for the specified 'n'.
+{
+    unsigned int result = 0x80000000;  // x^0
+    for (unsigned int k = 3; n; n >>= 1, ++k) {
+        if (n & 1) {
+            result = multiplyModP(k_X2N_TABLE[k % 32], result);
+        }
+    }
+    return result;
+}
+
+#if defined(BDLDE_CRC32_X86)
+
+__attribute__((target("pclmul")))
+static
+unsigned int updatePclmul(unsigned int         crc,
+                          const unsigned char *data,
+                          bsl::size_t          length)
+    // Return the internal CRC-32 state resulting from updating the specified
+    // 'crc' state with the specified 'length' bytes at the specified 'data'.
+    // The behavior is undefined unless '64 <= length' and 'length' is a
+    // multiple of 16.
+{
+    // Each constant is 'x^n' modulo the polynomial for the 'n' shown, in the
+    // reflected 33-bit representation.  'k_POLY' is the polynomial itself, and
+    // 'k_MU' is 'x^64 / P'.
+
+    const __m128i k1k2 = _mm_set_epi64x(0x1c6e41596LL,    // x^(512 - 32)
+                                        0x154442bd4LL);   // x^(512 + 32)
+    const __m128i k3k4 = _mm_set_epi64x(0x0ccaa009eLL,    // x^(128 - 32)
+                                        0x1751997d0LL);   // x^(128 + 32)
+    const __m128i k5   = _mm_set_epi64x(0,
+                                        0x163cd6124LL);   // x^64
+    const __m128i poly = _mm_set_epi64x(0x1f7011641LL,    // k_MU
+                                        0x1db710641LL);   // k_POLY
+    const __m128i mask = _mm_setr_epi32(-1, 0, -1, 0);
+
+    const __m128i *p = reinterpret_cast<const __m128i *>(data);
+
+    __m128i x1 = _mm_loadu_si128(p + 0);
+    __m128i x2 = _mm_loadu_si128(p + 1);
+    __m128i x3 = _mm_loadu_si128(p + 2);
+    __m128i x4 = _mm_loadu_si128(p + 3);
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+    p      += 4;
+    length -= 64;
+
+    // Fold four blocks at a time.
+
+    while (length >= 64) {
+        __m128i x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+        __m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+        __m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+        __m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(p + 0));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(p + 1));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(p + 2));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(p + 3));
+
+        p      += 4;
+        length -= 64;
+    }
+
+    // Fold the four blocks into one, then fold in any remaining blocks.
+
+    __m128i x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), x2);
+
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), x3);
+
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), x4);
+
+    while (length >= 16) {
+        x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(p));
+
+        ++p;
+        length -= 16;
+    }
+
+    // Reduce 128 bits to 64, then 64 bits to 32.
+
+    x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), k5, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), poly, 0x10);
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask), poly, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return static_cast<unsigned int>(
+                                 _mm_cvtsi128_si32(_mm_srli_si128(x1, 4)));
+}
+
+static
+bool detectPclmul()
+    // Return 'true' if the processor supports the 'PCLMULQDQ' instruction,
+    // and 'false' otherwise.
+{
+    unsigned int eax, ebx, ecx, edx;
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_PCLMUL);
+}
+
+static const bool s_usePclmul = detectPclmul();
+
+#endif  // BDLDE_CRC32_X86
+
 namespace bdlde {
                                 // -----------
                                 // class Crc32
@@ -174,6 +359,16 @@ void Crc32::update(const void *data, bsl::size_t length)
     const unsigned char *d   = (const unsigned char *)data;
     unsigned int         tmp = d_crc;
 
+#if defined(BDLDE_CRC32_X86)
+    if (s_usePclmul && length >= 64) {
+        const bsl::size_t blocksLength = length & ~bsl::size_t(15);
+
+        tmp     = updatePclmul(tmp, d, blocksLength);
+        d      += blocksLength;
+        length -= blocksLength;
+    }
+#endif
+
     switch (length % 4) {
       case 3: tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
           BSLS_ANNOTATION_FALLTHROUGH;
@@ -196,6 +391,16 @@ void Crc32::update(const void *data, bsl::size_t length)
     d_crc = tmp;
 }
 
+void Crc32::combine(const Crc32& other, bsl::size_t length)
+{
+    // Appending the data of 'other' multiplies the unconditioned remainder of
+    // this checksum by 'x^(8 * length)'; the conditioning of the two states
+    // and of the result then cancels out.
+
+    d_crc = multiplyModP(xPowEightNModP(length), d_crc ^ 0xffffffff)
+                                                                 ^ other.d_crc;
+}
+
 // ACCESSORS
 bsl::ostream& Crc32::print(bsl::ostream& stream) const
 {
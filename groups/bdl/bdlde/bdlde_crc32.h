@@ -29,6 +29,25 @@ BSLS_IDENT("$Id: $")
 // SHA-256, it is relatively easy to find alternate texts with identical
 // checksum.
 //
+///Combining Checksums
+///-------------------
+// The 'combine' manipulator updates a checksum to reflect data that was
+// checksummed separately by another 'bdlde::Crc32' object, given only that
+// object and the length of its data.  The result is identical to that of
+// providing all of the data, in order, to a single object.  This allows large
+// buffers to be checksummed in independent pieces (e.g., concurrently), and
+// frames to be assembled from pieces whose checksums are already known.  The
+// cost of 'combine' is logarithmic in the length of the appended data.
+//
+///Hardware Acceleration
+///---------------------
+// On x86 platforms, when built with a supporting compiler, 'update' detects at
+// runtime whether the processor provides the 'PCLMULQDQ' (carry-less
+// multiply) instruction, and, if so, uses it to checksum long runs of data
+// sixteen bytes at a time.  Inputs shorter than 64 bytes, and the unaligned
+// remainder of longer inputs, are processed by the table-driven
+// implementation.  The checksum computed is the same on every platform.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate a typical use of the
@@ -170,6 +189,14 @@ class Crc32 {
         // Return the current value of this checksum and set the value of this
         // checksum to the value the default constructor provides.
 
+    void combine(const Crc32& other, bsl::size_t length);
+        // Update the value of this checksum to incorporate the data having the
+        // specified 'length' that was provided to the specified 'other'
+        // checksum, as if that data had been provided to 'update' on this
+        // object.  Note that the result is meaningful only if 'length' is the
+        // total number of bytes provided to 'other' since it was default
+        // constructed or last reset.
+
     void reset();
         // Reset the value of this checksum to the value the default
         // constructor provides.
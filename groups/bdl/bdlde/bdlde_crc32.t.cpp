@@ -14,6 +14,7 @@
 #include <bslx_testinstream.h>                  // for testing only
 #include <bslx_testinstreamexception.h>         // for testing only
 #include <bsls_stopwatch.h>                     // for testing only
+#include <bsls_types.h>                         // for testing only
 
 #include <bsl_algorithm.h>   // sort()
 #include <bsl_cstdlib.h>     // atoi()
@@ -86,6 +87,8 @@ using namespace bsl;  // automatically added by script
 // [ 4] unsigned int checksumAndReset();
 // [13] void reset();
 // [11] void update(const void *data, int length);
+// [15] void update(const void *data, bsl::size_t length);
+// [16] void combine(const Crc32& other, bsl::size_t length);
 //
 // ACCESSORS
 // [10] STREAM& bdexStreamOut(STREAM& stream, int version) const;
@@ -98,10 +101,11 @@ using namespace bsl;  // automatically added by script
 // [ 5] bsl::ostream& operator<<(bsl::ostream& stream, const bdlde::Crc32&);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [17] USAGE EXAMPLE
 // [ 2] BOOTSTRAP: void update(const void *data, int length);
 // [14] CRC_TABLE TEST
 // [-1] PERFORMANCE TEST
+// [-2] THROUGHPUT TEST
 //
 // [ 3] int ggg(bdlde::Crc32 *object, const char *spec, int vF = 1);
 // [ 3] bdlde::Crc32& gg(bdlde::Crc32 *object, const char *spec);
@@ -516,7 +520,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 17: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -547,6 +551,165 @@ int main(int argc, char *argv[])
         receiverExample(in);
 
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING 'combine'
+        //
+        // Concerns:
+        //: 1 Combining the checksums of two sequences yields the checksum of
+        //:   their concatenation, for every split point, including empty
+        //:   sequences on either side.
+        //:
+        //: 2 The result is independent of how 'other' was built, and 'other'
+        //:   is not modified.
+        //:
+        //: 3 Combining is associative, so that many pieces may be combined in
+        //:   any grouping, including pieces long enough to exercise every
+        //:   entry of the table of powers used internally.
+        //
+        // Plan:
+        //: 1 For a buffer of pseudo-random data, and every split point, build
+        //:   one object from the prefix and one from the suffix, combine
+        //:   them, and compare against the oracle 'crc' over the whole buffer.
+        //:   (C-1)
+        //:
+        //: 2 Build 'other' from several 'update' calls and verify that it is
+        //:   unchanged by 'combine'.  (C-2)
+        //:
+        //: 3 For lengths up to '2^62' (so that no data is involved), verify
+        //:   that '(A + B) + C' equals 'A + (B + C)'.  (C-3)
+        //
+        // Testing:
+        //   void combine(const Crc32& other, bsl::size_t length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'combine'"
+                          << "\n=================" << endl;
+
+        char buffer[600];
+        unsigned int seed = 12345;
+        for (int i = 0; i < static_cast<int>(sizeof buffer); ++i) {
+            seed = seed * 1103515245 + 12345;
+            buffer[i] = static_cast<char>(seed >> 16);
+        }
+
+        if (verbose) cout << "\nSplitting a buffer at every point." << endl;
+        {
+            const int LEN = static_cast<int>(sizeof buffer);
+            const unsigned int EXP = crc(buffer, LEN);
+
+            for (int split = 0; split <= LEN; ++split) {
+                Obj mA(buffer, split);
+                Obj mB;
+                mB.update(buffer + split, (LEN - split) / 2);
+                mB.update(buffer + split + (LEN - split) / 2,
+                          LEN - split - (LEN - split) / 2);
+                const Obj B(mB);
+
+                mA.combine(mB, LEN - split);
+
+                LOOP_ASSERT(split, EXP == mA.checksum());
+                LOOP_ASSERT(split, B == mB);
+            }
+        }
+
+        if (verbose) cout << "\nCombining with empty checksums." << endl;
+        {
+            Obj mA(buffer, 100);  const Obj A(mA);
+            Obj mB;
+
+            mA.combine(mB, 0);
+            ASSERT(A == mA);
+
+            mB.combine(A, 100);
+            ASSERT(A == mB);
+        }
+
+        if (verbose) cout << "\nTesting associativity." << endl;
+        {
+            const int MAX_SHIFT = sizeof(bsl::size_t) > 4 ? 62 : 30;
+            const bsl::size_t ONE = 1;
+
+            for (int i = 0; i <= MAX_SHIFT; i += 3) {
+                for (int j = 0; j <= MAX_SHIFT; j += 3) {
+                    const bsl::size_t lenB = (ONE << i) + i;
+                    const bsl::size_t lenC = (ONE << j) * 3 / 2;
+
+                    Obj mA(buffer,       10);
+                    Obj mB(buffer + 10, 100);
+                    Obj mC(buffer + 20, 200);
+
+                    Obj mAB(mA);  mAB.combine(mB, lenB);
+                    mAB.combine(mC, lenC);
+
+                    Obj mBC(mB);  mBC.combine(mC, lenC);
+                    mA.combine(mBC, lenB + lenC);
+
+                    LOOP2_ASSERT(lenB, lenC, mAB == mA);
+                }
+            }
+        }
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING LONG INPUTS
+        //   On platforms supporting it, 'update' processes long inputs using
+        //   carry-less multiplication rather than 'CRC_TABLE'.
+        //
+        // Concerns:
+        //: 1 'update' computes the correct checksum for inputs of every
+        //:   length, including lengths on either side of the 64-byte
+        //:   threshold for the accelerated path and lengths that are not a
+        //:   multiple of 16.
+        //:
+        //: 2 The alignment of the input does not affect the result.
+        //:
+        //: 3 The result is correct when the accelerated path is used on a
+        //:   checksum that has already been provided data.
+        //
+        // Plan:
+        //: 1 For every length in '[0 .. 600]' and every offset in '[0 .. 15]'
+        //:   into a buffer of pseudo-random data, compare the checksum of the
+        //:   sub-range against the oracle 'crc'.  (C-1..2)
+        //:
+        //: 2 Split each such range into two 'update' calls at several points,
+        //:   and verify the checksum is unchanged.  (C-3)
+        //
+        // Testing:
+        //   void update(const void *data, bsl::size_t length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING LONG INPUTS"
+                          << "\n===================" << endl;
+
+        char buffer[616];
+        unsigned int seed = 54321;
+        for (int i = 0; i < static_cast<int>(sizeof buffer); ++i) {
+            seed = seed * 1103515245 + 12345;
+            buffer[i] = static_cast<char>(seed >> 16);
+        }
+
+        for (int offset = 0; offset < 16; ++offset) {
+            for (int len = 0; len <= 600; ++len) {
+                const char         *DATA = buffer + offset;
+                const unsigned int  EXP  = crc(DATA, len);
+
+                const Obj X(DATA, len);
+                LOOP2_ASSERT(offset, len, EXP == X.checksum());
+
+                const int SPLITS[] = { 1, 17, 63, 64, 65, 200 };
+                const int NUM_SPLITS = sizeof SPLITS / sizeof *SPLITS;
+
+                for (int i = 0; i < NUM_SPLITS; ++i) {
+                    const int SPLIT = bsl::min(SPLITS[i], len);
+
+                    Obj mY(DATA, SPLIT);
+                    mY.update(DATA + SPLIT, len - SPLIT);
+                    LOOP3_ASSERT(offset, len, SPLIT, EXP == mY.checksum());
+                }
+            }
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING CRC_TABLE
@@ -2679,6 +2842,71 @@ int main(int argc, char *argv[])
                       << bsl::endl;
         }
 
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // THROUGHPUT TEST
+        //
+        // Concerns:
+        //: 1 On processors supporting carry-less multiplication, 'update' is
+        //:   substantially faster than the table-driven algorithm for inputs
+        //:   of the sizes typical of network frames and larger.
+        //
+        // Plan:
+        //: 1 For a range of input sizes, time 'update' and the byte-at-a-time
+        //:   oracle 'update_crc' (which is the table-driven algorithm used by
+        //:   'update' for short inputs) over the same total number of bytes,
+        //:   and report the throughput of each in GB/s.
+        //
+        // Testing:
+        //   void update(const void *data, bsl::size_t length);  // throughput
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTHROUGHPUT TEST"
+                          << "\n===============" << endl;
+
+        const int SIZES[] = { 16, 64, 256, 1024, 4096, 65536, 1024 * 1024 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        const bsls::Types::Int64 TOTAL = 256 * 1024 * 1024;
+
+        bsl::vector<char> buffer(1024 * 1024);
+        for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+            buffer[i] = static_cast<char>(i * 7 + i / 1021);
+        }
+
+        cout << "size,table GB/s,update GB/s" << endl;
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const int                SIZE  = SIZES[i];
+            const bsls::Types::Int64 ITERS = TOTAL / SIZE;
+
+            unsigned int    sink = 0;
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (bsls::Types::Int64 j = 0; j < ITERS / 8; ++j) {
+                sink ^= update_crc(0, buffer.data(), SIZE);
+            }
+            timer.stop();
+            const double tableRate = static_cast<double>(ITERS / 8 * SIZE)
+                                   / timer.elapsedTime() / 1.0e9;
+
+            Obj mX;
+            timer.reset();
+            timer.start();
+            for (bsls::Types::Int64 j = 0; j < ITERS; ++j) {
+                mX.update(buffer.data(), SIZE);
+            }
+            timer.stop();
+            const double updateRate = static_cast<double>(ITERS * SIZE)
+                                    / timer.elapsedTime() / 1.0e9;
+
+            cout << SIZE << ',' << tableRate << ',' << updateRate << endl;
+
+            if (veryVerbose) { P_(sink) P(mX.checksum()) }
+        }
+
       } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
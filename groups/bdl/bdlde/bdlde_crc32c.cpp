@@ -666,6 +666,57 @@ const unsigned int k_CRC_TABLE_IL8_O88[256] =
     0xC451B7CC, 0x8D6DCAEB, 0x56294D82, 0x1F1530A5
 };
 
+const unsigned int k_X2N_TABLE[31] =
+    // The following table holds, for each 'n' in '[ 0 .. 30 ]', the value of
+    // 'x^(2^n)' modulo the Castagnoli polynomial, in the reflected bit order
+    // used by the CRC tables above (i.e., the coefficient of 'x^0' is in the
+    // most significant bit, so that 'x^0' is represented by '0x80000000').
+    // Note that 'x^(2^31)' is equal to 'x' modulo the Castagnoli polynomial,
+    // so the table repeats with a period of 31.
+{
+    0x40000000, 0x20000000, 0x08000000, 0x00800000,
+    0x00008000, 0x82F63B78, 0x6EA2D55C, 0x18B8EA18,
+    0x510AC59A, 0xB82BE955, 0xB8FDB1E7, 0x88E56F72,
+    0x74C360A4, 0xE4172B16, 0x0D65762A, 0x35D73A62,
+    0x28461564, 0xBF455269, 0xE2EA32DC, 0xFE7740E6,
+    0xF946610B, 0x3C204F8F, 0x538586E3, 0x59726915,
+    0x734D5309, 0xBC1AC763, 0x7D0722CC, 0xD289CABE,
+    0xE94CA9BC, 0x05B74F3F, 0xA51E1F42
+};
+
+unsigned int multiplyModP(unsigned int a, unsigned int b)
+    // Return the product of the specified 'a' and 'b', each a polynomial over
+    // GF(2) in the reflected bit order of 'k_X2N_TABLE', modulo the
+    // Castagnoli polynomial.
+{
+    static const unsigned int k_POLY = 0x82F63B78;  // reflected 0x1EDC6F41
+
+    unsigned int product = 0;
+    for (unsigned int mask = 0x80000000; a; mask >>= 1) {
+        if (a & mask) {
+            product ^= b;
+            a       ^= mask;
+        }
+        b = b & 1 ? (b >> 1) ^ k_POLY : b >> 1;
+    }
+    return product;
+}
+
+unsigned int xPowEightNModP(bsl::size_t n)
+    // Return 'x^(8 * n)' modulo the Castagnoli polynomial, in the reflected
+    // bit order of 'k_X2N_TABLE', for the specified 'n'.  Note that
+    // multiplying the CRC32-C value of a sequence by the result appends 'n'
+    // zero bytes to the sequence (ignoring pre- and post-conditioning).
+{
+    unsigned int result = 0x80000000;  // x^0
+    for (unsigned int k = 3; n; n >>= 1, ++k) {
+        if (n & 1) {
+            result = multiplyModP(k_X2N_TABLE[k % 31], result);
+        }
+    }
+    return result;
+}
+
                         //=======================
                         // class Crc32cCalculator
                         //=======================
@@ -1315,6 +1366,17 @@ unsigned int Crc32c::calculate(const void   *data,
     return calculator(static_cast<const unsigned char *>(data), length, crc);
 }
 
+unsigned int Crc32c::combine(unsigned int crcA,
+                             unsigned int crcB,
+                             bsl::size_t  lengthB)
+{
+    // Appending 'B' to 'A' shifts the (unconditioned) remainder of 'A' by
+    // '8 * lengthB' bits, and the pre- and post-conditioning of the three
+    // values cancel out, so the result is 'crcA * x^(8 * lengthB) + crcB'.
+
+    return multiplyModP(xPowEightNModP(lengthB), crcA) ^ crcB;
+}
+
                              // ------------------
                              // struct Crc32c_Impl
                              // ------------------
@@ -11,7 +11,7 @@ BSLS_IDENT("$Id$")
 //  bdlde::Crc32c     : calculates CRC32-C checksum
 //  bdlde::Crc32c_Impl: calculates CRC32-C checksum with alternative impl.
 //
-//@SEE_ALSO: bdlde_crc32
+//@SEE_ALSO: bdlde_crc32, bdlbb_blobutil
 //
 //@DESCRIPTION: This component defines a struct, 'bdlde::Crc32c' that
 // dramatically accelerates (as opposite to the 'bdlde::Crc32' component)
@@ -25,6 +25,22 @@ BSLS_IDENT("$Id$")
 // CRC-32 checksum does not aid in error correction and is not naively useful
 // in any sort of cryptography application.
 //
+///Combining Checksums
+///-------------------
+// 'bdlde::Crc32c::combine' computes the CRC32-C checksum of the concatenation
+// of two byte sequences from the checksums of each, and the length of the
+// second, without access to the data itself.  This makes it possible to
+// divide a large buffer into chunks, checksum the chunks independently (for
+// example, concurrently in several threads), and then merge the results in
+// order to obtain exactly the checksum of the whole buffer.  Combining costs
+// a number of operations logarithmic in the length of the second sequence,
+// which is negligible next to checksumming any chunk large enough to be worth
+// processing in parallel (see {Example 2}).
+//
+// Note that 'bdlbb::BlobUtil::crc32c' uses this component to checksum the
+// data held by a 'bdlbb::Blob' one buffer at a time, without first copying
+// it to a contiguous area.
+//
 ///Thread Safety
 ///-------------
 // Thread safe.
@@ -76,12 +92,73 @@ BSLS_IDENT("$Id$")
 //                                      newChunk.size(),
 //                                      checksum);
 //..
+//
+///Example 2: Checksumming a large buffer in parallel
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we need to verify the checksum of a large buffer, such as a file
+// snapshot mapped into memory, and that several cores are available to do
+// so.  We can divide the buffer into chunks, checksum each chunk in its own
+// thread, and combine the results.
+//
+// First, we define a function that checksums one chunk:
+//..
+//  void checksumChunk(unsigned int *result, const char *data, bsl::size_t n)
+//      // Load into the specified 'result' the CRC32-C checksum of the
+//      // specified 'n' bytes at the specified 'data'.
+//  {
+//      *result = bdlde::Crc32c::calculate(data, n);
+//  }
+//..
+// Then, we prepare the buffer, and decide on the number of chunks:
+//..
+//  bsl::vector<char> buffer(4 * 1024 * 1024);
+//  for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+//      buffer[i] = static_cast<char>(i * 7 + i / 1021);
+//  }
+//
+//  enum { k_NUM_CHUNKS = 4 };
+//
+//  const bsl::size_t chunkSize = buffer.size() / k_NUM_CHUNKS;
+//..
+// Next, we checksum each chunk in a separate thread, giving the last chunk
+// any remaining bytes:
+//..
+//  unsigned int       chunkCrcs[k_NUM_CHUNKS];
+//  bsl::size_t        chunkLengths[k_NUM_CHUNKS];
+//  bslmt::ThreadGroup threadGroup;
+//
+//  for (int i = 0; i < k_NUM_CHUNKS; ++i) {
+//      chunkLengths[i] = k_NUM_CHUNKS - 1 == i
+//                        ? buffer.size() - i * chunkSize
+//                        : chunkSize;
+//
+//      threadGroup.addThread(bdlf::BindUtil::bind(&checksumChunk,
+//                                                 chunkCrcs + i,
+//                                                 &buffer[i * chunkSize],
+//                                                 chunkLengths[i]));
+//  }
+//  threadGroup.joinAll();
+//..
+// Then, we combine the checksums of the chunks in order:
+//..
+//  unsigned int checksum = chunkCrcs[0];
+//  for (int i = 1; i < k_NUM_CHUNKS; ++i) {
+//      checksum = bdlde::Crc32c::combine(checksum,
+//                                        chunkCrcs[i],
+//                                        chunkLengths[i]);
+//  }
+//..
+// Finally, we observe that the result is the checksum of the whole buffer:
+//..
+//  assert(bdlde::Crc32c::calculate(buffer.data(), buffer.size()) == checksum);
+//..
 
 #include <bdlscm_version.h>
 
 #include <bsl_cstddef.h>
 
 namespace BloombergLP {
+
 namespace bdlde {
 
                                // =============
@@ -106,6 +183,18 @@ struct Crc32c {
         // the specified 'length' number of bytes, using the optionally
         // specified 'crc' value as the starting point for the calculation.
         // Note that if 'data' is 0, then 'length' also must be 0.
+
+    static unsigned int combine(unsigned int crcA,
+                                unsigned int crcB,
+                                bsl::size_t  lengthB);
+        // Return the CRC32-C value of the concatenation of two byte sequences,
+        // 'A' followed by 'B', given the specified 'crcA', the CRC32-C value
+        // of 'A', and the specified 'crcB' and 'lengthB', the CRC32-C value
+        // and the length in bytes of 'B'.  Note that
+        // 'combine(calculate(a, n), calculate(b, m), m)' is equal to
+        // 'calculate(b, m, calculate(a, n))', and that the data of 'A' and
+        // 'B' are not needed.  Also note that this function performs a number
+        // of operations proportional to the logarithm of 'lengthB'.
 };
 
                              // ==================
@@ -229,14 +229,16 @@ using namespace bsl;
 // [6] int Crc32c_Impl::calculateSoftware(const void *, size_t, uint);
 // [2] int Crc32c_Impl::calculateHardwareSerial(const void *, size_t, uint);
 // [3] int Crc32c_Impl::calculateHardwareSerial(const void *, size_t, uint);
+// [7] unsigned int Crc32c::combine(unsigned int, unsigned int, size_t);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 // [-1] DEFAULT PERFORMANCE TEST
 // [-2] SOFTWARE PERFORMANCE TEST
 // [-3] THROUGPUT DEFAULT & SOFTWARE BENCHMARK
 // [-4] DEFAULT & FOLLY PERFORMANCE TEST
 // [-5] PERFORMANCE TEST ON USER INPUT
+// [-6] PARALLEL THROUGHPUT BENCHMARK USING COMBINE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -1311,6 +1313,183 @@ void test6_multithreadedCrc32cSoftware()
     }
 }
 
+void checksumChunk(unsigned int *result, const char *data, bsl::size_t n)
+    // Load into the specified 'result' the CRC32-C checksum of the specified
+    // 'n' bytes at the specified 'data'.
+{
+    *result = bdlde::Crc32c::calculate(data, n);
+}
+
+void test7_combine()
+    // ------------------------------------------------------------------------
+    // COMBINE
+    //
+    // Concerns:
+    //: 1 'combine(calculate(A), calculate(B), len(B))' is equal to
+    //:   'calculate(A + B)' for every way of splitting a buffer into 'A' and
+    //:   'B', including empty 'A' or 'B'.
+    //:
+    //: 2 'combine' is consistent with passing 'calculate(A)' as the starting
+    //:   'crc' when calculating the checksum of 'B'.
+    //:
+    //: 3 'combine' is correct for lengths too large to checksum in a test,
+    //:   including lengths that do not fit in 32 bits.
+    //:
+    //: 4 Checksums of chunks computed concurrently combine to the checksum
+    //:   of the whole buffer.
+    //
+    // Plan:
+    //: 1 For buffers of random data of several lengths, split the buffer at
+    //:   every position and verify that combining the checksums of the two
+    //:   parts yields the checksum of the whole buffer, and the checksum
+    //:   computed by chaining the 'crc' argument.  (C-1..2)
+    //:
+    //: 2 Verify that combining with the checksum of 'n' zero bytes is the
+    //:   same as checksumming 'n' appended zero bytes, for 'n' up to 1 MiB.
+    //:   (C-3)
+    //:
+    //: 3 Verify that 'combine' is associative, i.e.,
+    //:   'combine(combine(a, b, m), c, n) == combine(a, combine(b, c, n),
+    //:   m + n)', for random checksums and for random lengths up to 2^62, so
+    //:   that the multiplications by 'x^(8 * n)' for large 'n' are checked
+    //:   against products of smaller powers.  (C-3)
+    //:
+    //: 4 Split a large buffer into a varying number of chunks, checksum each
+    //:   chunk in its own thread, and verify that the combined result is the
+    //:   checksum of the buffer.  (C-4)
+    //
+    // Testing:
+    //   unsigned int combine(unsigned int, unsigned int, size_t);
+    // ------------------------------------------------------------------------
+{
+    if (verbose) bsl::cout << bsl::endl
+                           << "COMBINE" << bsl::endl
+                           << "=======" << bsl::endl;
+
+    if (veryVerbose) cout << "Splitting buffers at every position\n";
+    {
+        const int LENGTHS[] = { 0, 1, 2, 7, 8, 9, 63, 64, 65, 1023, 1024,
+                                1025, 3000 };
+        enum { k_NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+        for (int ti = 0; ti < k_NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            bsl::vector<char> buffer(LENGTH + 1, pa);
+            bsl::generate_n(buffer.begin(), LENGTH, bsl::rand);
+
+            const char         *DATA = buffer.data();
+            const unsigned int  EXP  = Crc32c::calculate(DATA, LENGTH);
+
+            for (int split = 0; split <= LENGTH; ++split) {
+                const unsigned int crcA = Crc32c::calculate(DATA, split);
+                const unsigned int crcB = Crc32c::calculate(DATA + split,
+                                                            LENGTH - split);
+
+                ASSERTV(LENGTH, split, EXP ==
+                             Crc32c::combine(crcA, crcB, LENGTH - split));
+                ASSERTV(LENGTH, split, EXP ==
+                             Crc32c::calculate(DATA + split,
+                                               LENGTH - split,
+                                               crcA));
+            }
+        }
+    }
+
+    if (veryVerbose) cout << "Appending zero bytes\n";
+    {
+        const bsl::size_t k_MAX_ZEROES = 1024 * 1024;
+
+        bsl::vector<char> buffer(16 + k_MAX_ZEROES, 0, pa);
+        bsl::generate_n(buffer.begin(), 16, bsl::rand);
+
+        const unsigned int crcA = Crc32c::calculate(buffer.data(), 16);
+
+        for (bsl::size_t n = 0; n <= k_MAX_ZEROES; n = n * 3 + 1) {
+            const unsigned int crcZeroes =
+                                  Crc32c::calculate(buffer.data() + 16, n);
+
+            ASSERTV(n, Crc32c::calculate(buffer.data(), 16 + n) ==
+                                       Crc32c::combine(crcA, crcZeroes, n));
+        }
+    }
+
+    if (veryVerbose) cout << "Associativity for large lengths\n";
+    {
+        for (int ti = 0; ti < 1000; ++ti) {
+            const unsigned int a = static_cast<unsigned int>(bsl::rand()) << 16
+                                 ^ static_cast<unsigned int>(bsl::rand());
+            const unsigned int b = static_cast<unsigned int>(bsl::rand()) << 16
+                                 ^ static_cast<unsigned int>(bsl::rand());
+            const unsigned int c = static_cast<unsigned int>(bsl::rand()) << 16
+                                 ^ static_cast<unsigned int>(bsl::rand());
+
+            bsls::Types::Uint64 m = static_cast<bsls::Types::Uint64>(
+                                                                bsl::rand());
+            bsls::Types::Uint64 n = static_cast<bsls::Types::Uint64>(
+                                                                bsl::rand());
+            if (sizeof(bsl::size_t) > 4) {
+                m = m << 31 ^ bsl::rand();
+                n = n << 31 ^ bsl::rand();
+            }
+            else {
+                m &= 0x7fffffff;
+                n &= 0x7fffffff;
+            }
+
+            const bsl::size_t M = static_cast<bsl::size_t>(m);
+            const bsl::size_t N = static_cast<bsl::size_t>(n);
+
+            const unsigned int LEFT  = Crc32c::combine(
+                                               Crc32c::combine(a, b, M), c, N);
+            const unsigned int RIGHT = Crc32c::combine(
+                                           a, Crc32c::combine(b, c, N), M + N);
+
+            ASSERTV(ti, M, N, LEFT, RIGHT, LEFT == RIGHT);
+        }
+    }
+
+    if (veryVerbose) cout << "Combining chunks computed concurrently\n";
+    {
+        const bsl::size_t k_LENGTH = 1024 * 1024 + 13;
+
+        bsl::vector<char> buffer(k_LENGTH, pa);
+        bsl::generate_n(buffer.begin(), k_LENGTH, bsl::rand);
+
+        const unsigned int EXP = Crc32c::calculate(buffer.data(), k_LENGTH);
+
+        for (int numChunks = 1; numChunks <= 8; ++numChunks) {
+            const bsl::size_t chunkSize = k_LENGTH / numChunks;
+
+            bsl::vector<unsigned int> chunkCrcs(numChunks, pa);
+            bsl::vector<bsl::size_t>  chunkLengths(numChunks, pa);
+            bslmt::ThreadGroup        threadGroup(pa);
+
+            for (int i = 0; i < numChunks; ++i) {
+                chunkLengths[i] = numChunks - 1 == i
+                                  ? k_LENGTH - i * chunkSize
+                                  : chunkSize;
+
+                const int rc = threadGroup.addThread(bdlf::BindUtil::bind(
+                                                      &checksumChunk,
+                                                      &chunkCrcs[i],
+                                                      &buffer[i * chunkSize],
+                                                      chunkLengths[i]));
+                BSLS_ASSERT_OPT(rc == 0);
+            }
+            threadGroup.joinAll();
+
+            unsigned int checksum = chunkCrcs[0];
+            for (int i = 1; i < numChunks; ++i) {
+                checksum = Crc32c::combine(checksum,
+                                           chunkCrcs[i],
+                                           chunkLengths[i]);
+            }
+            ASSERTV(numChunks, EXP == checksum);
+        }
+    }
+}
+
 // ============================================================================
 //                              PERFORMANCE TESTS
 // ----------------------------------------------------------------------------
@@ -1831,6 +2010,77 @@ void testN5_performanceDefaultUserInput()
          << "\n\n";
 }
 
+void testN6_calculateParallelThroughput()
+    // ------------------------------------------------------------------------
+    // BENCHMARK: PARALLEL CRC32-C THROUGHPUT USING 'combine'
+    //
+    // Concerns:
+    //: 1 Measure the throughput (GB/s) of checksumming a large buffer by
+    //:   dividing it into one chunk per thread, checksumming the chunks
+    //:   concurrently, and combining the results.
+    //
+    // Plan:
+    //: 1 For 1, 2, 4, and 8 threads, time the checksum of a 256 MiB buffer
+    //:   computed as described, verify the result against the serial
+    //:   checksum, and report the throughput.
+    //
+    // Testing:
+    //   unsigned int combine(unsigned int, unsigned int, size_t);
+    // ------------------------------------------------------------------------
+{
+    if (verbose) bsl::cout << bsl::endl
+                 << "BENCHMARK: PARALLEL CRC32-C THROUGHPUT USING 'combine'"
+                 << bsl::endl
+                 << "======================================================"
+                 << bsl::endl;
+
+    const bsl::size_t k_LENGTH = 256 * 1024 * 1024;
+    const int         k_NUM_ITERS = 4;
+
+    bsl::vector<char> buffer(k_LENGTH, pa);
+    for (bsl::size_t i = 0; i < k_LENGTH; ++i) {
+        buffer[i] = static_cast<char>(i * 7 + i / 1021);
+    }
+
+    const unsigned int EXP = Crc32c::calculate(buffer.data(), k_LENGTH);
+
+    cout << "threads,GB/s\n";
+
+    for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+        const bsl::size_t chunkSize = k_LENGTH / numThreads;
+
+        bsl::vector<unsigned int> chunkCrcs(numThreads, pa);
+        unsigned int              checksum = 0;
+
+        const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+        for (int iter = 0; iter < k_NUM_ITERS; ++iter) {
+            bslmt::ThreadGroup threadGroup(pa);
+            for (int i = 0; i < numThreads; ++i) {
+                const int rc = threadGroup.addThread(bdlf::BindUtil::bind(
+                                                      &checksumChunk,
+                                                      &chunkCrcs[i],
+                                                      &buffer[i * chunkSize],
+                                                      chunkSize));
+                BSLS_ASSERT_OPT(rc == 0);
+            }
+            threadGroup.joinAll();
+
+            checksum = chunkCrcs[0];
+            for (int i = 1; i < numThreads; ++i) {
+                checksum = Crc32c::combine(checksum, chunkCrcs[i], chunkSize);
+            }
+        }
+        const bsls::Types::Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+        ASSERTV(numThreads, EXP == checksum);
+
+        cout << numThreads << ','
+             << static_cast<double>(k_LENGTH) * k_NUM_ITERS /
+                                                  static_cast<double>(elapsed)
+             << '\n';
+    }
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -1864,20 +2114,20 @@ int main(int argc, char* argv[])
     bsls::Log::setSeverityThreshold(bsls::LogSeverity::e_INFO);
 
     switch(test) { case 0:
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
-        // TESTING USAGE EXAMPLE 1
+        // TESTING USAGE EXAMPLES
         //
         // Concerns:
-        //   The usage example provided in the component header file must
+        //   The usage examples provided in the component header file must
         //   compile, link, and run on all platforms as shown.
         //
         // Plan:
-        //   Run the usage example 1
+        //   Run the usage examples 1 and 2
         // --------------------------------------------------------------------
 
-        if (verbose) cout << "\nTesting Usage Example 1"
-                          << "\n=======================" << endl;
+        if (verbose) cout << "\nTesting Usage Examples"
+                          << "\n======================" << endl;
 
 ///Example 1: Computing and updating a checksum
 /// - - - - - - - - - - - - - - - - - - - - - -
@@ -1906,6 +2156,66 @@ int main(int argc, char* argv[])
                                             newChunk.size(),
                                             checksum);
 //..
+        ASSERT(bdlde::Crc32c::calculate(message.c_str(), message.size())
+                                                                 == checksum);
+
+///Example 2: Checksumming a large buffer in parallel
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we need to verify the checksum of a large buffer, such as a file
+// snapshot mapped into memory, and that several cores are available to do
+// so.  We can divide the buffer into chunks, checksum each chunk in its own
+// thread, and combine the results.
+//
+// First, we define a function that checksums one chunk (see 'checksumChunk'
+// above).
+//
+// Then, we prepare the buffer, and decide on the number of chunks:
+//..
+        bsl::vector<char> buffer(4 * 1024 * 1024);
+        for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+            buffer[i] = static_cast<char>(i * 7 + i / 1021);
+        }
+
+        enum { k_NUM_CHUNKS = 4 };
+
+        const bsl::size_t chunkSize = buffer.size() / k_NUM_CHUNKS;
+//..
+// Next, we checksum each chunk in a separate thread, giving the last chunk
+// any remaining bytes:
+//..
+        unsigned int       chunkCrcs[k_NUM_CHUNKS];
+        bsl::size_t        chunkLengths[k_NUM_CHUNKS];
+        bslmt::ThreadGroup threadGroup;
+
+        for (int i = 0; i < k_NUM_CHUNKS; ++i) {
+            chunkLengths[i] = k_NUM_CHUNKS - 1 == i
+                              ? buffer.size() - i * chunkSize
+                              : chunkSize;
+
+            threadGroup.addThread(bdlf::BindUtil::bind(&checksumChunk,
+                                                       chunkCrcs + i,
+                                                       &buffer[i * chunkSize],
+                                                       chunkLengths[i]));
+        }
+        threadGroup.joinAll();
+//..
+// Then, we combine the checksums of the chunks in order:
+//..
+        checksum = chunkCrcs[0];
+        for (int i = 1; i < k_NUM_CHUNKS; ++i) {
+            checksum = bdlde::Crc32c::combine(checksum,
+                                              chunkCrcs[i],
+                                              chunkLengths[i]);
+        }
+//..
+// Finally, we observe that the result is the checksum of the whole buffer:
+//..
+        ASSERT(bdlde::Crc32c::calculate(buffer.data(), buffer.size())
+                                                                 == checksum);
+//..
+      } break;
+      case  7: {
+        test7_combine();
       } break;
       case  6: {
         test6_multithreadedCrc32cSoftware();
@@ -1940,6 +2250,9 @@ int main(int argc, char* argv[])
       case -5: {
         testN5_performanceDefaultUserInput();
       } break;
+      case -6: {
+        testN6_calculateParallelThroughput();
+      } break;
       default: {
         cerr << "WARNING: CASE '" << test << "' NOT FOUND." << endl;
         testStatus = -1;
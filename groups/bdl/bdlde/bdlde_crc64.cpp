@@ -6,11 +6,36 @@
 // This implements the CRC-64 defined in ECMA 182 (with reversed polynomial
 // 0xC96C5795D7870F42), in the usual manner:
 //   http://en.wikipedia.org/wiki/Cyclic_redundancy_check
+//
+// On x86 processors supporting the 'PCLMULQDQ' instruction, inputs of 64
+// bytes or more are processed by folding, as described in Gopal et al., "Fast
+// CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" (Intel,
+// 2009): the remainder is carried in four 128-bit registers, each of which is
+// advanced over 64 bytes of input by carry-less multiplication with
+// 'x^(512 + 63)' and 'x^(512 - 1)' modulo the polynomial.  The registers are
+// then folded into one, and the last 128 bits are reduced to 64 by a Barrett
+// reduction.
+//
+// 'combine' multiplies the (unconditioned) remainder of this checksum by
+// 'x^(8 * length)', computed by repeated squaring from a table of 'x^(2^k)'.
+// Unlike for the CRC-32 polynomial, these powers do not repeat within the
+// range of 'k' that a 'bsl::size_t' length can require, so the table covers
+// that entire range.
 
 #include <bsl_ostream.h>
 #include <bsls_annotation.h>
+#include <bsls_platform.h>
 #include <bsls_types.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(BSLS_PLATFORM_CPU_X86)
+#if defined(BSLS_PLATFORM_CMP_CLANG) ||                                       \
+    (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900)
+#define BDLDE_CRC64_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+#endif
+
 namespace BloombergLP {
 
 // STATIC DATA
@@ -274,12 +299,192 @@ static const bsls::Types::Uint64 CRC_TABLE[256] = {
     0xe0ada17364673f59ULL
 };
 
+static const bsls::Types::Uint64 k_X2N_TABLE[67] = {
+    // The following table holds, for each 'n' in '[ 0 .. 66 ]', the value of
+    // 'x^(2^n)' modulo the CRC-64 polynomial, in the reflected bit order used
+    // by 'CRC_TABLE' (i.e., 'x^0' is represented by '0x8000000000000000').
+
+    0x4000000000000000ULL, 0x2000000000000000ULL, 0x0800000000000000ULL,
+    0x0080000000000000ULL, 0x0000800000000000ULL, 0x0000000080000000ULL,
+    0xc96c5795d7870f42ULL, 0x6d5f4ad7e3c3afa0ULL, 0xd49f7e445077d8eaULL,
+    0x040fb02a53c216faULL, 0x6bec35957b9ef3a0ULL, 0xb0e3bb0658964afeULL,
+    0x218578c7a2dff638ULL, 0x6dbb920f24dd5cf2ULL, 0x7a140cfcdb4d5eb5ULL,
+    0x41b3705ecbc4057bULL, 0xd46ab656accac1eaULL, 0x329beda6fc34fb73ULL,
+    0x51a4fcd4350b9797ULL, 0x314fa85637efae9dULL, 0xacf27e9a1518d512ULL,
+    0xffe2a3388a4d8ce7ULL, 0x48b9697e60cc2e4eULL, 0xada73cb78dd62460ULL,
+    0x3ea5454d8ce5c1bbULL, 0x5e84e3a6c70feaf1ULL, 0x90fd49b66cbd81d1ULL,
+    0xe2943e0c1db254e8ULL, 0xecfa6adeca8834a1ULL, 0xf513e212593ee321ULL,
+    0xf36ae57331040916ULL, 0x63fbd333b87b6717ULL, 0xbd60f8e152f50b8bULL,
+    0xa5ce4a8299c1567dULL, 0x0bd445f0cbdb55eeULL, 0xfdd6824e20134285ULL,
+    0xcead8b6ebda2227aULL, 0xe44b17e4f5d4fb5cULL, 0x9b29c81ad01ca7c5ULL,
+    0x1b4366e40fea4055ULL, 0x27bca1551aae167bULL, 0xaa57bcd1b39a5690ULL,
+    0xd7fce83fa1234db9ULL, 0xcce4986efea3ff8eULL, 0x3602a4d9e65341f1ULL,
+    0x722b1da2df516145ULL, 0xecfc3ddd3a08da83ULL, 0x0fb96dcca83507e6ULL,
+    0x125f2fe78d70f080ULL, 0x842f50b7651aa516ULL, 0x09bc34188cd9836fULL,
+    0xf43666c84196d909ULL, 0xb56feb30c0df6ccbULL, 0xaa66e04ce7f30958ULL,
+    0xb7b1187e9af29547ULL, 0x113255f8476495deULL, 0x8fb19f783095d77eULL,
+    0xaec4aacc7c82b133ULL, 0xf64e6d09218428cfULL, 0x036a72ea5ac258a0ULL,
+    0x5235ef12eb7aaa6aULL, 0x2fed7b1685657853ULL, 0x8ef8951d46606fb5ULL,
+    0x9d58c1090f034d14ULL, 0x36f6c59a9fdaa97bULL, 0xbe2d517d98682592ULL,
+    0x7bcd738fef5729f1ULL
+};
+
+static
+bsls::Types::Uint64 multiplyModP(bsls::Types::Uint64 a, bsls::Types::Uint64 b)
+    // Return the product of the specified 'a' and 'b', each a polynomial over
+    // GF(2) in the reflected bit order of 'k_X2N_TABLE', modulo the CRC-64
+    // polynomial.
+{
+    static const bsls::Types::Uint64 k_POLY = 0xc96c5795d7870f42ULL;
+
+    bsls::Types::Uint64 product = 0;
+    for (bsls::Types::Uint64 mask = 0x8000000000000000ULL; a; mask >>= 1) {
+        if (a & mask) {
+            product ^= b;
+            a       ^= mask;
+        }
+        b = b & 1 ? (b >> 1) ^ k_POLY : b >> 1;
+    }
+    return product;
+}
+
+static
+bsls::Types::Uint64 xPowEightNModP(bsl::size_t n)
+    // Return 'x^(8 * n)' modulo the CRC-64 polynomial, in the reflected bit
+    // order of 'k_X2N_TABLE', for the specified 'n'.
+{
+    bsls::Types::Uint64 result = 0x8000000000000000ULL;  // x^0
+    for (unsigned int k = 3; n; n >>= 1, ++k) {
+        if (n & 1) {
+            result = multiplyModP(k_X2N_TABLE[k], result);
+        }
+    }
+    return result;
+}
+
+#if defined(BDLDE_CRC64_X86)
+
+__attribute__((target("pclmul")))
+static
+bsls::Types::Uint64 updatePclmul(bsls::Types::Uint64  crc,
+                                 const unsigned char *data,
+                                 bsl::size_t          length)
+    // Return the internal CRC-64 state resulting from updating the specified
+    // 'crc' state with the specified 'length' bytes at the specified 'data'.
+    // The behavior is undefined unless '64 <= length' and 'length' is a
+    // multiple of 16.
+{
+    // Each constant is 'x^n' modulo the polynomial for the 'n' shown, in the
+    // reflected 64-bit representation.  'k_POLY' is the polynomial, and
+    // 'k_MU' is 'x^128 / P', both reflected in 65 bits, with the top bit
+    // (which is implied) dropped.
+
+    const __m128i k1k2 = _mm_set_epi64x(0x081f6054a7842df4ULL,  // x^(512 - 1)
+                                        0x6ae3efbb9dd441f3ULL); // x^(512 + 63)
+    const __m128i k3k4 = _mm_set_epi64x(0xdabe95afc7875f40ULL,  // x^(128 - 1)
+                                        0xe05dd497ca393ae4ULL); // x^(128 + 63)
+    const __m128i poly = _mm_set_epi64x(0x92d8af2baf0e1e85ULL,  // k_POLY
+                                        0x9c3e466c172963d5ULL); // k_MU
+
+    const __m128i *p = reinterpret_cast<const __m128i *>(data);
+
+    __m128i x1 = _mm_loadu_si128(p + 0);
+    __m128i x2 = _mm_loadu_si128(p + 1);
+    __m128i x3 = _mm_loadu_si128(p + 2);
+    __m128i x4 = _mm_loadu_si128(p + 3);
+    x1 = _mm_xor_si128(x1, _mm_set_epi64x(0, static_cast<long long>(crc)));
+    p      += 4;
+    length -= 64;
+
+    // Fold four blocks at a time.
+
+    while (length >= 64) {
+        __m128i x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+        __m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+        __m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+        __m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(p + 0));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(p + 1));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(p + 2));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(p + 3));
+
+        p      += 4;
+        length -= 64;
+    }
+
+    // Fold the four blocks into one, then fold in any remaining blocks.
+
+    __m128i x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), x2);
+
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), x3);
+
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), x4);
+
+    while (length >= 16) {
+        x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(p));
+
+        ++p;
+        length -= 16;
+    }
+
+    // Reduce 128 bits to 64, then compute the remainder of those 64 bits
+    // (shifted by 'x^64') with a Barrett reduction.
+
+    x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+    x2 = _mm_clmulepi64_si128(x1, poly, 0x00);
+    x3 = _mm_clmulepi64_si128(x2, poly, 0x10);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), _mm_slli_si128(x2, 8));
+
+    bsls::Types::Uint64 result;
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(&result),
+                     _mm_srli_si128(x1, 8));
+    return result;
+}
+
+static
+bool detectPclmul()
+    // Return 'true' if the processor supports the 'PCLMULQDQ' instruction,
+    // and 'false' otherwise.
+{
+    unsigned int eax, ebx, ecx, edx;
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_PCLMUL);
+}
+
+static const bool s_usePclmul = detectPclmul();
+
+#endif  // BDLDE_CRC64_X86
+
 namespace bdlde {
                                 // -----------
                                 // class Crc64
                                 // -----------
 
 // MANIPULATORS
+void Crc64::combine(const Crc64& other, bsl::size_t length)
+{
+    // Appending the data of 'other' multiplies the unconditioned remainder of
+    // this checksum by 'x^(8 * length)'; the conditioning of the two states
+    // and of the result then cancels out.
+
+    d_crc = multiplyModP(xPowEightNModP(length), ~d_crc) ^ other.d_crc;
+}
+
 void Crc64::update(const void *data, bsl::size_t length)
 {
     BSLS_ASSERT(data || !length);
@@ -287,6 +492,16 @@ void Crc64::update(const void *data, bsl::size_t length)
     const unsigned char *d = (const unsigned char *)data;
     bsls::Types::Uint64 tmp = d_crc;
 
+#if defined(BDLDE_CRC64_X86)
+    if (s_usePclmul && length >= 64) {
+        const bsl::size_t blocksLength = length & ~bsl::size_t(15);
+
+        tmp     = updatePclmul(tmp, d, blocksLength);
+        d      += blocksLength;
+        length -= blocksLength;
+    }
+#endif
+
     switch (length % 8) {
       case 7:
         tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
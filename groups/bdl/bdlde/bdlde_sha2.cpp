@@ -1,10 +1,46 @@
 // bdlde_sha2.cpp                                                     -*-C++-*-
 #include <bdlde_sha2.h>
 
+#include <bsls_platform.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_ostream.h>
 
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(BSLS_PLATFORM_CPU_X86)
+#if defined(BSLS_PLATFORM_CMP_CLANG) ||                                       \
+    (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 50000)
+#define BDLDE_SHA2_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+#endif
+
+// IMPLEMENTATION NOTES
+// --------------------
+// Three implementations of the compression function are provided:
+//
+//: o 'transformPortable' is the reference implementation of FIPS 180-4, used
+//:   for all four digest sizes on every platform.
+//:
+//: o 'transformShaNi' compresses SHA-224 and SHA-256 blocks using the x86 SHA
+//:   extensions.  These instructions operate on the working variables arranged
+//:   as 'ABEF' and 'CDGH' rather than in FIPS order, so the state is permuted
+//:   on entry and exit; each 'sha256rnds2' instruction performs two rounds.
+//:
+//: o 'transformAvx2x4' compresses one block from each of four independent
+//:   SHA-384 or SHA-512 messages, keeping the working variable of each message
+//:   in one 64-bit lane of an AVX2 register.  There are no SHA-512 extensions
+//:   on the processors we target, so multi-buffer hashing is the only way to
+//:   use vector units for these digests, and it is exposed only through
+//:   'loadDigests'.
+//
+// The choice of implementation is made once, during static initialization,
+// by querying the processor.  If a digest is computed before that
+// initialization (e.g., from the constructor of another static object), the
+// portable implementation is used, which produces the same results.
+
 namespace BloombergLP {
 namespace bdlde {
 namespace {
@@ -197,11 +233,11 @@ const bsl::uint64_t sha512Constants[80] =
              0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL};
 
 template<class INTEGER, bsl::size_t ARRAY_SIZE>
-void transform(INTEGER             *state,
-               const unsigned char *message,
-               bsl::uint64_t        numberOfBuffers,
-               bsl::uint64_t        bufferSize,
-               const INTEGER      (&constants)[ARRAY_SIZE])
+void transformPortable(INTEGER             *state,
+                       const unsigned char *message,
+                       bsl::uint64_t        numberOfBuffers,
+                       bsl::uint64_t        bufferSize,
+                       const INTEGER      (&constants)[ARRAY_SIZE])
     // Update the specified 'state' with the hashed contents of the specified
     // 'message' having a length equal to the specified 'bufferSize' times the
     // specified 'numberOfBuffers', mixing it with the values in the specified
@@ -247,6 +283,296 @@ void transform(INTEGER             *state,
     }
 }
 
+#if defined(BDLDE_SHA2_X86)
+
+bool detectShaExtensions()
+    // Return 'true' if the processor supports the SHA extensions, along with
+    // the SSSE3 and SSE4.1 instructions used to marshal the state for them,
+    // and 'false' otherwise.
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return false;                                                 // RETURN
+    }
+
+    const unsigned int k_SSSE3  = 1u << 9;    // CPUID.01H:ECX
+    const unsigned int k_SSE4_1 = 1u << 19;   // CPUID.01H:ECX
+    const unsigned int k_SHA    = 1u << 29;   // CPUID.(EAX=07H,ECX=0):EBX
+
+    if ((ecx & (k_SSSE3 | k_SSE4_1)) != (k_SSSE3 | k_SSE4_1)
+     || __get_cpuid_max(0, 0) < 7) {
+        return false;                                                 // RETURN
+    }
+
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return 0 != (ebx & k_SHA);
+}
+
+bool detectAvx2()
+    // Return 'true' if the processor and the operating system support AVX2
+    // instructions, and 'false' otherwise.
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+static const bool s_useShaExtensions = detectShaExtensions();
+static const bool s_useAvx2          = detectAvx2();
+
+__attribute__((target("sha,ssse3,sse4.1")))
+inline
+__m128i scheduleShaNi(__m128i w0, __m128i w1, __m128i w2, __m128i w3)
+    // Return the four message schedule words following the sixteen words held
+    // in order by the specified 'w0', 'w1', 'w2', and 'w3'.
+{
+    const __m128i partial = _mm_add_epi32(_mm_sha256msg1_epu32(w0, w1),
+                                          _mm_alignr_epi8(w3, w2, 4));
+    return _mm_sha256msg2_epu32(partial, w3);
+}
+
+__attribute__((target("sha,ssse3,sse4.1")))
+inline
+void roundsShaNi(__m128i             *abef,
+                 __m128i             *cdgh,
+                 __m128i              w,
+                 const bsl::uint32_t *constants)
+    // Perform four SHA-256 rounds on the working variables held by the
+    // specified 'abef' and 'cdgh', using the four message schedule words in
+    // the specified 'w' and the four round constants starting at the
+    // specified 'constants'.
+{
+    const __m128i *address = reinterpret_cast<const __m128i *>(constants);
+
+    __m128i wk = _mm_add_epi32(w, _mm_loadu_si128(address));
+    *cdgh = _mm_sha256rnds2_epu32(*cdgh, *abef, wk);
+    wk    = _mm_shuffle_epi32(wk, 0x0E);
+    *abef = _mm_sha256rnds2_epu32(*abef, *cdgh, wk);
+}
+
+__attribute__((target("sha,ssse3,sse4.1")))
+void transformShaNi(bsl::uint32_t       *state,
+                    const unsigned char *message,
+                    bsl::uint64_t        numberOfBuffers)
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'message' having a length equal to 64 times the specified
+    // 'numberOfBuffers', using the SHA extensions.  The behavior is undefined
+    // unless the processor supports the SHA, SSSE3, and SSE4.1 instructions.
+{
+    const bsl::uint32_t *k = sha256Constants;
+
+    // Mask converting each big-endian 32-bit word of the message to native
+    // order.
+
+    const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                            0x0405060700010203ULL);
+
+    // Arrange the state as required by 'sha256rnds2'.
+
+    __m128i dcba = _mm_loadu_si128(reinterpret_cast<__m128i *>(state));
+    __m128i hgfe = _mm_loadu_si128(reinterpret_cast<__m128i *>(state + 4));
+
+    const __m128i cdab = _mm_shuffle_epi32(dcba, 0xB1);
+    const __m128i efgh = _mm_shuffle_epi32(hgfe, 0x1B);
+
+    __m128i abef = _mm_alignr_epi8(cdab, efgh, 8);
+    __m128i cdgh = _mm_blend_epi16(efgh, cdab, 0xF0);
+
+    const __m128i *input = reinterpret_cast<const __m128i *>(message);
+    for (; numberOfBuffers; --numberOfBuffers, input += 4) {
+        const __m128i savedAbef = abef;
+        const __m128i savedCdgh = cdgh;
+
+        __m128i w0 = _mm_shuffle_epi8(_mm_loadu_si128(input + 0), byteSwap);
+        __m128i w1 = _mm_shuffle_epi8(_mm_loadu_si128(input + 1), byteSwap);
+        __m128i w2 = _mm_shuffle_epi8(_mm_loadu_si128(input + 2), byteSwap);
+        __m128i w3 = _mm_shuffle_epi8(_mm_loadu_si128(input + 3), byteSwap);
+
+        roundsShaNi(&abef, &cdgh, w0, k +  0);
+        roundsShaNi(&abef, &cdgh, w1, k +  4);
+        roundsShaNi(&abef, &cdgh, w2, k +  8);
+        roundsShaNi(&abef, &cdgh, w3, k + 12);
+
+        for (int round = 16; round != 64; round += 16) {
+            w0 = scheduleShaNi(w0, w1, w2, w3);
+            roundsShaNi(&abef, &cdgh, w0, k + round +  0);
+            w1 = scheduleShaNi(w1, w2, w3, w0);
+            roundsShaNi(&abef, &cdgh, w1, k + round +  4);
+            w2 = scheduleShaNi(w2, w3, w0, w1);
+            roundsShaNi(&abef, &cdgh, w2, k + round +  8);
+            w3 = scheduleShaNi(w3, w0, w1, w2);
+            roundsShaNi(&abef, &cdgh, w3, k + round + 12);
+        }
+
+        abef = _mm_add_epi32(abef, savedAbef);
+        cdgh = _mm_add_epi32(cdgh, savedCdgh);
+    }
+
+    // Restore the FIPS order of the state.
+
+    const __m128i feba = _mm_shuffle_epi32(abef, 0x1B);
+    const __m128i dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+
+    dcba = _mm_blend_epi16(feba, dchg, 0xF0);
+    hgfe = _mm_alignr_epi8(dchg, feba, 8);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state),     dcba);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4), hgfe);
+}
+
+__attribute__((target("avx2")))
+inline
+__m256i rotateRightAvx2(__m256i value, int shift)
+    // Return the specified 'value' with each 64-bit lane rotated by the
+    // specified 'shift' bits to the right.  The behavior is undefined unless
+    // '0 < shift < 64'.
+{
+    return _mm256_or_si256(_mm256_srli_epi64(value, shift),
+                           _mm256_slli_epi64(value, 64 - shift));
+}
+
+__attribute__((target("avx2")))
+void transformAvx2x4(bsl::uint64_t              (*state)[4],
+                     const unsigned char *const  *buffers)
+    // Update each of the four SHA-512 states held in the lanes of the
+    // specified 'state', such that 'state[i][j]' is word 'i' of the state of
+    // lane 'j', with the hashed contents of the 128-byte buffer at the
+    // corresponding one of the four specified 'buffers'.  The behavior is
+    // undefined unless the processor supports AVX2 instructions.
+{
+    // Mask converting each big-endian 64-bit word of a buffer to native
+    // order.
+
+    const __m256i byteSwap = _mm256_set_epi64x(0x08090a0b0c0d0e0fULL,
+                                               0x0001020304050607ULL,
+                                               0x08090a0b0c0d0e0fULL,
+                                               0x0001020304050607ULL);
+
+    // Load the message, transposing it so that 'w[i]' holds word 'i' of each
+    // buffer.
+
+    __m256i w[16];
+    for (int index = 0; index != 16; index += 4) {
+        __m256i row[4];
+        for (int lane = 0; lane != 4; ++lane) {
+            const __m256i *address = reinterpret_cast<const __m256i *>(
+                                                   buffers[lane] + index * 8);
+
+            row[lane] = _mm256_shuffle_epi8(_mm256_loadu_si256(address),
+                                            byteSwap);
+        }
+        const __m256i low01  = _mm256_unpacklo_epi64(row[0], row[1]);
+        const __m256i high01 = _mm256_unpackhi_epi64(row[0], row[1]);
+        const __m256i low23  = _mm256_unpacklo_epi64(row[2], row[3]);
+        const __m256i high23 = _mm256_unpackhi_epi64(row[2], row[3]);
+
+        w[index + 0] = _mm256_permute2x128_si256(low01,  low23,  0x20);
+        w[index + 1] = _mm256_permute2x128_si256(high01, high23, 0x20);
+        w[index + 2] = _mm256_permute2x128_si256(low01,  low23,  0x31);
+        w[index + 3] = _mm256_permute2x128_si256(high01, high23, 0x31);
+    }
+
+    __m256i wv[8];
+    for (int index = 0; index != 8; ++index) {
+        wv[index] = _mm256_loadu_si256(
+                                    reinterpret_cast<__m256i *>(state[index]));
+    }
+
+    for (int round = 0; round != 80; ++round) {
+        __m256i& current = w[round & 15];
+        if (16 <= round) {
+            const __m256i w2  = w[(round -  2) & 15];
+            const __m256i w15 = w[(round - 15) & 15];
+
+            const __m256i f4 = _mm256_xor_si256(
+                                   _mm256_xor_si256(rotateRightAvx2(w2, 19),
+                                                    rotateRightAvx2(w2, 61)),
+                                   _mm256_srli_epi64(w2, 6));
+            const __m256i f3 = _mm256_xor_si256(
+                                   _mm256_xor_si256(rotateRightAvx2(w15, 1),
+                                                    rotateRightAvx2(w15, 8)),
+                                   _mm256_srli_epi64(w15, 7));
+
+            current = _mm256_add_epi64(
+                                _mm256_add_epi64(f4, w[(round - 7) & 15]),
+                                _mm256_add_epi64(f3, current));
+        }
+
+        const __m256i f2 = _mm256_xor_si256(
+                                  _mm256_xor_si256(rotateRightAvx2(wv[4], 14),
+                                                   rotateRightAvx2(wv[4], 18)),
+                                  rotateRightAvx2(wv[4], 41));
+        const __m256i ch = _mm256_xor_si256(_mm256_and_si256(wv[4], wv[5]),
+                                            _mm256_andnot_si256(wv[4], wv[6]));
+        const __m256i t1 = _mm256_add_epi64(
+                    _mm256_add_epi64(_mm256_add_epi64(wv[7], f2),
+                                     _mm256_add_epi64(ch, current)),
+                    _mm256_set1_epi64x(static_cast<long long>(
+                                                     sha512Constants[round])));
+
+        const __m256i f1 = _mm256_xor_si256(
+                                  _mm256_xor_si256(rotateRightAvx2(wv[0], 28),
+                                                   rotateRightAvx2(wv[0], 34)),
+                                  rotateRightAvx2(wv[0], 39));
+        const __m256i maj = _mm256_or_si256(
+                            _mm256_and_si256(wv[0], wv[1]),
+                            _mm256_and_si256(_mm256_or_si256(wv[0], wv[1]),
+                                             wv[2]));
+        const __m256i t2 = _mm256_add_epi64(f1, maj);
+
+        wv[7] = wv[6];
+        wv[6] = wv[5];
+        wv[5] = wv[4];
+        wv[4] = _mm256_add_epi64(wv[3], t1);
+        wv[3] = wv[2];
+        wv[2] = wv[1];
+        wv[1] = wv[0];
+        wv[0] = _mm256_add_epi64(t1, t2);
+    }
+
+    for (int index = 0; index != 8; ++index) {
+        __m256i *address = reinterpret_cast<__m256i *>(state[index]);
+        _mm256_storeu_si256(address,
+                            _mm256_add_epi64(_mm256_loadu_si256(address),
+                                             wv[index]));
+    }
+}
+
+#endif  // BDLDE_SHA2_X86
+
+void transform(bsl::uint32_t        *state,
+               const unsigned char  *message,
+               bsl::uint64_t         numberOfBuffers,
+               bsl::uint64_t         bufferSize,
+               const bsl::uint32_t (&constants)[64])
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'message' having a length equal to the specified 'bufferSize' times the
+    // specified 'numberOfBuffers', mixing it with the values in the specified
+    // 'constants', using the SHA extensions if the processor supports them.
+    // The behavior is undefined unless 'bufferSize' is 64 and 'constants' is
+    // 'sha256Constants'.
+{
+#if defined(BDLDE_SHA2_X86)
+    if (s_useShaExtensions) {
+        transformShaNi(state, message, numberOfBuffers);
+        return;                                                       // RETURN
+    }
+#endif
+    transformPortable(state, message, numberOfBuffers, bufferSize, constants);
+}
+
+void transform(bsl::uint64_t        *state,
+               const unsigned char  *message,
+               bsl::uint64_t         numberOfBuffers,
+               bsl::uint64_t         bufferSize,
+               const bsl::uint64_t (&constants)[80])
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'message' having a length equal to the specified 'bufferSize' times the
+    // specified 'numberOfBuffers', mixing it with the values in the specified
+    // 'constants'.
+{
+    transformPortable(state, message, numberOfBuffers, bufferSize, constants);
+}
+
 template<bsl::size_t BUFFER_CAPACITY, class INTEGER, bsl::size_t ARRAY_SIZE>
 void updateImpl(INTEGER             *state,
                 bsl::uint64_t       *totalSize,
@@ -291,6 +617,36 @@ void updateImpl(INTEGER             *state,
     bsl::copy(epilogue, epilogue + *bufferSize, buffer);
 }
 
+template<class INTEGER, bsl::size_t FINAL_CAPACITY>
+bsl::uint64_t loadFinalBuffers(
+                           unsigned char       (&finalBuffers)[FINAL_CAPACITY],
+                          const unsigned char  *remaining,
+                          bsl::uint64_t         remainingSize,
+                          bsl::uint64_t         totalSize)
+    // Load into the specified 'finalBuffers' the specified 'remainingSize'
+    // bytes starting at the specified 'remaining', followed by the SHA-2
+    // metadata, which uses the specified 'totalSize', and return the number
+    // of buffers, each holding 'FINAL_CAPACITY / 2' bytes, that were loaded.
+    // The behavior is undefined unless 'remainingSize < FINAL_CAPACITY / 2'.
+{
+    const bsl::uint64_t bufferSize       = FINAL_CAPACITY / 2;
+    const bsl::uint64_t totalSizeInBits  = totalSize * 8;
+    const bsl::uint64_t unpaddedSize     = remainingSize
+                                         + 1
+                                         + sizeof(INTEGER) * 2;
+    const bsl::uint64_t remainingBuffers =
+                                          (unpaddedSize <= bufferSize) ? 1 : 2;
+    // At the end of the message, we write a special marker byte, followed by
+    // the total size of the message.  Insert '0' bytes between those to pad
+    // the message to a multiple of 'bufferSize'.
+    bsl::fill(finalBuffers, finalBuffers + FINAL_CAPACITY, 0);
+    bsl::copy(remaining, remaining + remainingSize, finalBuffers);
+    finalBuffers[remainingSize] = 1 << 7;
+    unsigned char *end = finalBuffers + remainingBuffers * bufferSize;
+    unpack(totalSizeInBits, end - sizeof(totalSizeInBits));
+    return remainingBuffers;
+}
+
 template<bsl::size_t BUFFER_CAPACITY, class INTEGER, bsl::size_t ARRAY_SIZE>
 void finalize(unsigned char        *result,
               bsl::size_t           digestSize,
@@ -306,20 +662,12 @@ void finalize(unsigned char        *result,
     // the specified 'result' having the specified 'digestSize' the contents of
     // 'state'.
 {
-    const bsl::uint64_t totalSizeInBits  = totalSize * 8;
-    const bsl::uint64_t unpaddedSize     = bufferSize
-                                         + 1
-                                         + sizeof(INTEGER) * 2;
-    const bsl::uint64_t remainingBuffers =
-                                     (unpaddedSize <= BUFFER_CAPACITY) ? 1 : 2;
-    // At the end of the message, we write a special marker byte, followed by
-    // the total size of the message.  Insert '0' bytes between those to pad
-    // the message to a multiple of BUFFER_CAPACITY.
-    unsigned char       finalBuffers[BUFFER_CAPACITY * 2] = {};
-    bsl::copy(buffer, buffer + bufferSize, finalBuffers);
-    finalBuffers[bufferSize] = 1 << 7;
-    unsigned char *end = finalBuffers + remainingBuffers * BUFFER_CAPACITY;
-    unpack(totalSizeInBits, end - sizeof(totalSizeInBits));
+    unsigned char       finalBuffers[BUFFER_CAPACITY * 2];
+    const bsl::uint64_t remainingBuffers = loadFinalBuffers<INTEGER>(
+                                                                  finalBuffers,
+                                                                  buffer,
+                                                                  bufferSize,
+                                                                  totalSize);
     transform(state,
               finalBuffers,
               remainingBuffers,
@@ -331,6 +679,202 @@ void finalize(unsigned char        *result,
     }
 }
 
+template<bsl::size_t BUFFER_CAPACITY, class INTEGER, bsl::size_t ARRAY_SIZE>
+void digestEach(unsigned char       *results,
+                bsl::size_t          digestSize,
+                const INTEGER       *initialState,
+                const void * const  *messages,
+                const bsl::size_t   *lengths,
+                bsl::size_t          numMessages,
+                const INTEGER      (&constants)[ARRAY_SIZE])
+    // Load into the specified 'results' the SHA-2 digests, each having the
+    // specified 'digestSize', of the specified 'numMessages' messages
+    // described by the specified 'messages' and 'lengths', as documented for
+    // 'Sha256::loadDigests', starting each from the specified 'initialState'
+    // and mixing in the specified 'constants'.
+{
+    for (bsl::size_t i = 0; i != numMessages; ++i) {
+        const unsigned char *message         =
+                               static_cast<const unsigned char *>(messages[i]);
+        const bsl::uint64_t  numberOfBuffers = lengths[i] / BUFFER_CAPACITY;
+        const bsl::uint64_t  wholeSize       = numberOfBuffers
+                                             * BUFFER_CAPACITY;
+
+        INTEGER state[8];
+        bsl::copy(initialState, initialState + 8, state);
+        transform(state, message, numberOfBuffers, BUFFER_CAPACITY, constants);
+
+        unsigned char       finalBuffers[BUFFER_CAPACITY * 2];
+        const bsl::uint64_t remainingBuffers = loadFinalBuffers<INTEGER>(
+                                                  finalBuffers,
+                                                  message + wholeSize,
+                                                  lengths[i] - wholeSize,
+                                                  lengths[i]);
+        transform(state,
+                  finalBuffers,
+                  remainingBuffers,
+                  BUFFER_CAPACITY,
+                  constants);
+
+        unsigned char *result = results + i * digestSize;
+        for (unsigned index = 0;
+             index < digestSize / sizeof(INTEGER);
+             ++index) {
+            unpack(state[index], &result[index * sizeof(INTEGER)]);
+        }
+    }
+}
+
+#if defined(BDLDE_SHA2_X86)
+
+struct Sha512Lane {
+    // This 'struct' describes the progress of a message being hashed by one
+    // lane of 'digestAvx2x4'.
+
+    // DATA
+    bsl::size_t          d_messageIndex;     // index of the message
+
+    const unsigned char *d_next_p;           // next buffer to hash
+
+    bsl::uint64_t        d_numBuffers;       // buffers remaining at
+                                             // 'd_next_p'
+
+    bsl::uint64_t        d_numFinalBuffers;  // buffers in 'd_final' not yet
+                                             // reached
+
+    unsigned char        d_final[2 * 1024 / 8];
+                                             // padded end of the message
+};
+
+void digestAvx2x4(unsigned char       *results,
+                  bsl::size_t          digestSize,
+                  const bsl::uint64_t *initialState,
+                  const void * const  *messages,
+                  const bsl::size_t   *lengths,
+                  bsl::size_t          numMessages)
+    // Load into the specified 'results' the SHA-384 or SHA-512 digests,
+    // according to the specified 'digestSize' and 'initialState', of the
+    // specified 'numMessages' messages described by the specified 'messages'
+    // and 'lengths', as documented for 'Sha512::loadDigests', hashing up to
+    // four messages concurrently.  The behavior is undefined unless the
+    // processor supports AVX2 instructions.
+{
+    enum { k_BUFFER_SIZE = 1024 / 8, k_NUM_LANES = 4 };
+
+    // Idle lanes hash this buffer, and their results are ignored.
+
+    static const unsigned char idleBuffer[k_BUFFER_SIZE] = { 0 };
+
+    Sha512Lane    lanes[k_NUM_LANES];
+    bool          active[k_NUM_LANES] = { false, false, false, false };
+    bsl::uint64_t state[8][k_NUM_LANES];
+
+    bsl::size_t nextMessage = 0;
+    for (;;) {
+        // Assign the next messages to the idle lanes.
+
+        int numActive = 0;
+        for (int lane = 0; lane != k_NUM_LANES; ++lane) {
+            if (!active[lane] && nextMessage != numMessages) {
+                Sha512Lane&          l      = lanes[lane];
+                const unsigned char *begin  =
+                     static_cast<const unsigned char *>(messages[nextMessage]);
+                const bsl::uint64_t  length = lengths[nextMessage];
+                const bsl::uint64_t  whole  = length / k_BUFFER_SIZE;
+
+                l.d_messageIndex    = nextMessage++;
+                l.d_next_p          = begin;
+                l.d_numBuffers      = whole;
+                l.d_numFinalBuffers = loadFinalBuffers<bsl::uint64_t>(
+                                                l.d_final,
+                                                begin + whole * k_BUFFER_SIZE,
+                                                length % k_BUFFER_SIZE,
+                                                length);
+                for (int index = 0; index != 8; ++index) {
+                    state[index][lane] = initialState[index];
+                }
+                active[lane] = true;
+            }
+            numActive += active[lane];
+        }
+
+        if (numActive < 2) {
+            break;
+        }
+
+        // Advance every active lane by one buffer, then retire the lanes
+        // whose messages are complete.
+
+        const unsigned char *buffers[k_NUM_LANES];
+        for (int lane = 0; lane != k_NUM_LANES; ++lane) {
+            Sha512Lane& l = lanes[lane];
+            if (!active[lane]) {
+                buffers[lane] = idleBuffer;
+                continue;
+            }
+            if (0 == l.d_numBuffers) {
+                l.d_next_p          = l.d_final;
+                l.d_numBuffers      = l.d_numFinalBuffers;
+                l.d_numFinalBuffers = 0;
+            }
+            buffers[lane] = l.d_next_p;
+            l.d_next_p   += k_BUFFER_SIZE;
+            --l.d_numBuffers;
+        }
+
+        transformAvx2x4(state, buffers);
+
+        for (int lane = 0; lane != k_NUM_LANES; ++lane) {
+            const Sha512Lane& l = lanes[lane];
+            if (active[lane] && 0 == l.d_numBuffers
+                             && 0 == l.d_numFinalBuffers) {
+                unsigned char *result = results
+                                      + l.d_messageIndex * digestSize;
+                for (bsl::size_t index = 0;
+                     index < digestSize / sizeof(bsl::uint64_t);
+                     ++index) {
+                    unpack(state[index][lane],
+                           result + index * sizeof(bsl::uint64_t));
+                }
+                active[lane] = false;
+            }
+        }
+    }
+
+    // Finish the last message, if any, without the overhead of idle lanes.
+
+    for (int lane = 0; lane != k_NUM_LANES; ++lane) {
+        if (!active[lane]) {
+            continue;
+        }
+        const Sha512Lane& l = lanes[lane];
+
+        bsl::uint64_t laneState[8];
+        for (int index = 0; index != 8; ++index) {
+            laneState[index] = state[index][lane];
+        }
+        transform(laneState,
+                  l.d_next_p,
+                  l.d_numBuffers,
+                  k_BUFFER_SIZE,
+                  sha512Constants);
+        transform(laneState,
+                  l.d_final,
+                  l.d_numFinalBuffers,
+                  k_BUFFER_SIZE,
+                  sha512Constants);
+
+        unsigned char *result = results + l.d_messageIndex * digestSize;
+        for (bsl::size_t index = 0;
+             index < digestSize / sizeof(bsl::uint64_t);
+             ++index) {
+            unpack(laneState[index], result + index * sizeof(bsl::uint64_t));
+        }
+    }
+}
+
+#endif  // BDLDE_SHA2_X86
+
 template<bsl::size_t SIZE>
 void toHex(char *output, const unsigned char (&input)[SIZE])
     // Store into the specified 'output' the hex representation of the bytes in
@@ -346,6 +890,88 @@ void toHex(char *output, const unsigned char (&input)[SIZE])
 
 } // close unnamed namespace
 
+void Sha224::loadDigests(unsigned char      *results,
+                         const void * const *messages,
+                         const bsl::size_t  *lengths,
+                         bsl::size_t         numMessages)
+{
+    const Sha224 initial;
+    digestEach<512 / 8>(results,
+                        k_DIGEST_SIZE,
+                        initial.d_state,
+                        messages,
+                        lengths,
+                        numMessages,
+                        sha256Constants);
+}
+
+void Sha256::loadDigests(unsigned char      *results,
+                         const void * const *messages,
+                         const bsl::size_t  *lengths,
+                         bsl::size_t         numMessages)
+{
+    const Sha256 initial;
+    digestEach<512 / 8>(results,
+                        k_DIGEST_SIZE,
+                        initial.d_state,
+                        messages,
+                        lengths,
+                        numMessages,
+                        sha256Constants);
+}
+
+void Sha384::loadDigests(unsigned char      *results,
+                         const void * const *messages,
+                         const bsl::size_t  *lengths,
+                         bsl::size_t         numMessages)
+{
+    const Sha384 initial;
+#if defined(BDLDE_SHA2_X86)
+    if (s_useAvx2) {
+        digestAvx2x4(results,
+                     k_DIGEST_SIZE,
+                     initial.d_state,
+                     messages,
+                     lengths,
+                     numMessages);
+        return;                                                       // RETURN
+    }
+#endif
+    digestEach<1024 / 8>(results,
+                         k_DIGEST_SIZE,
+                         initial.d_state,
+                         messages,
+                         lengths,
+                         numMessages,
+                         sha512Constants);
+}
+
+void Sha512::loadDigests(unsigned char      *results,
+                         const void * const *messages,
+                         const bsl::size_t  *lengths,
+                         bsl::size_t         numMessages)
+{
+    const Sha512 initial;
+#if defined(BDLDE_SHA2_X86)
+    if (s_useAvx2) {
+        digestAvx2x4(results,
+                     k_DIGEST_SIZE,
+                     initial.d_state,
+                     messages,
+                     lengths,
+                     numMessages);
+        return;                                                       // RETURN
+    }
+#endif
+    digestEach<1024 / 8>(results,
+                         k_DIGEST_SIZE,
+                         initial.d_state,
+                         messages,
+                         lengths,
+                         numMessages,
+                         sha512Constants);
+}
+
 Sha224::Sha224()
 {
     reset();
@@ -25,6 +25,32 @@ BSLS_IDENT("$Id$ $CSID$")
 //
 // Note that a SHA-2 digest does not aid in error correction.
 //
+///Hashing Many Messages
+///---------------------
+// Each class provides a 'loadDigests' class method that computes the digests
+// of a sequence of independent messages in one call.  The result for each
+// message is identical to that obtained by constructing a digest from the
+// message and calling 'loadDigest', but 'loadDigests' is free to interleave
+// the computation of several digests, which lets it use the SIMD lanes of the
+// processor when they are not otherwise usable for a single message.  Clients
+// that checksum many buffers at once (e.g., each record of a batch being
+// persisted) should prefer it to a loop over individual digest objects.
+//
+///Hardware Acceleration
+///---------------------
+// On x86 platforms, when built with a compiler that supports the necessary
+// intrinsics, this component determines at runtime which of the following
+// instruction set extensions the processor provides and uses them in place of
+// the portable implementation:
+//
+//: o The SHA extensions ('SHA-NI') are used to compress each block of a
+//:   SHA-224 or SHA-256 message, both by 'update' and by 'loadDigests'.
+//:
+//: o AVX2 is used by 'Sha384::loadDigests' and 'Sha512::loadDigests' to hash
+//:   up to four messages concurrently, one per 64-bit lane.
+//
+// The digests produced are the same regardless of the implementation chosen.
+//
 ///Usage
 ///-----
 // In this section we show intended usage of this component.  The
@@ -121,6 +147,25 @@ class Sha224 {
     static const bsl::size_t k_DIGEST_SIZE = 224 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void loadDigests(unsigned char      *results,
+                            const void * const *messages,
+                            const bsl::size_t  *lengths,
+                            bsl::size_t         numMessages);
+        // Load into the specified 'results' the SHA-224 digests of the
+        // specified 'numMessages' messages, where the message having index 'i'
+        // is the range '[messages[i], messages[i] + lengths[i])', using the
+        // specified 'messages' and 'lengths'.  The digest of the message
+        // having index 'i' is loaded into
+        // '[results + i * k_DIGEST_SIZE, results + (i + 1) * k_DIGEST_SIZE)'.
+        // The behavior is undefined unless 'results' refers to an array of at
+        // least 'numMessages * k_DIGEST_SIZE' bytes, 'messages' and 'lengths'
+        // each refer to an array of at least 'numMessages' elements, and each
+        // message is a valid range.  Note that if 'messages[i]' is 0, then
+        // 'lengths[i]' must also be 0.  Also note that the digests loaded are
+        // identical to those obtained by calling 'loadDigest' on a digest
+        // constructed from each message in turn.
+
     // CREATORS
     Sha224();
         // Construct a SHA-2 digest having the value corresponding to no data
@@ -201,6 +246,25 @@ class Sha256 {
     static const bsl::size_t k_DIGEST_SIZE = 256 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void loadDigests(unsigned char      *results,
+                            const void * const *messages,
+                            const bsl::size_t  *lengths,
+                            bsl::size_t         numMessages);
+        // Load into the specified 'results' the SHA-256 digests of the
+        // specified 'numMessages' messages, where the message having index 'i'
+        // is the range '[messages[i], messages[i] + lengths[i])', using the
+        // specified 'messages' and 'lengths'.  The digest of the message
+        // having index 'i' is loaded into
+        // '[results + i * k_DIGEST_SIZE, results + (i + 1) * k_DIGEST_SIZE)'.
+        // The behavior is undefined unless 'results' refers to an array of at
+        // least 'numMessages * k_DIGEST_SIZE' bytes, 'messages' and 'lengths'
+        // each refer to an array of at least 'numMessages' elements, and each
+        // message is a valid range.  Note that if 'messages[i]' is 0, then
+        // 'lengths[i]' must also be 0.  Also note that the digests loaded are
+        // identical to those obtained by calling 'loadDigest' on a digest
+        // constructed from each message in turn.
+
     // CREATORS
     Sha256();
         // Construct a SHA-2 digest having the value corresponding to no data
@@ -281,6 +345,25 @@ class Sha384 {
     static const bsl::size_t k_DIGEST_SIZE = 384 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void loadDigests(unsigned char      *results,
+                            const void * const *messages,
+                            const bsl::size_t  *lengths,
+                            bsl::size_t         numMessages);
+        // Load into the specified 'results' the SHA-384 digests of the
+        // specified 'numMessages' messages, where the message having index 'i'
+        // is the range '[messages[i], messages[i] + lengths[i])', using the
+        // specified 'messages' and 'lengths'.  The digest of the message
+        // having index 'i' is loaded into
+        // '[results + i * k_DIGEST_SIZE, results + (i + 1) * k_DIGEST_SIZE)'.
+        // The behavior is undefined unless 'results' refers to an array of at
+        // least 'numMessages * k_DIGEST_SIZE' bytes, 'messages' and 'lengths'
+        // each refer to an array of at least 'numMessages' elements, and each
+        // message is a valid range.  Note that if 'messages[i]' is 0, then
+        // 'lengths[i]' must also be 0.  Also note that the digests loaded are
+        // identical to those obtained by calling 'loadDigest' on a digest
+        // constructed from each message in turn.
+
     // CREATORS
     Sha384();
         // Construct a SHA-2 digest having the value corresponding to no data
@@ -361,6 +444,25 @@ class Sha512 {
     static const bsl::size_t k_DIGEST_SIZE = 512 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void loadDigests(unsigned char      *results,
+                            const void * const *messages,
+                            const bsl::size_t  *lengths,
+                            bsl::size_t         numMessages);
+        // Load into the specified 'results' the SHA-512 digests of the
+        // specified 'numMessages' messages, where the message having index 'i'
+        // is the range '[messages[i], messages[i] + lengths[i])', using the
+        // specified 'messages' and 'lengths'.  The digest of the message
+        // having index 'i' is loaded into
+        // '[results + i * k_DIGEST_SIZE, results + (i + 1) * k_DIGEST_SIZE)'.
+        // The behavior is undefined unless 'results' refers to an array of at
+        // least 'numMessages * k_DIGEST_SIZE' bytes, 'messages' and 'lengths'
+        // each refer to an array of at least 'numMessages' elements, and each
+        // message is a valid range.  Note that if 'messages[i]' is 0, then
+        // 'lengths[i]' must also be 0.  Also note that the digests loaded are
+        // identical to those obtained by calling 'loadDigest' on a digest
+        // constructed from each message in turn.
+
     // CREATORS
     Sha512();
         // Construct a SHA-2 digest having the value corresponding to no data
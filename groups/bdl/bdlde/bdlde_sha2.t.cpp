@@ -5,6 +5,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -120,6 +121,12 @@ using namespace bsl;
 // [24] bsl::ostream& Sha384::print(bsl::ostream& stream) const;
 // [25] bsl::ostream& Sha512::print(bsl::ostream& stream) const;
 //
+// CLASS METHODS
+// [26] void Sha224::loadDigests(uchar *, const void **, const size_t *, int);
+// [26] void Sha256::loadDigests(uchar *, const void **, const size_t *, int);
+// [26] void Sha384::loadDigests(uchar *, const void **, const size_t *, int);
+// [26] void Sha512::loadDigests(uchar *, const void **, const size_t *, int);
+//
 // FREE OPERATORS
 // [ 6] bool operator==(const Sha224& lhs, const Sha224& rhs);
 // [ 7] bool operator==(const Sha256& lhs, const Sha256& rhs);
@@ -135,7 +142,8 @@ using namespace bsl;
 // [25] bsl::ostream& operator<<(bsl::ostream& stream, const Sha512& digest);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [27] USAGE EXAMPLE
+// [-1] PERFORMANCE: HASHING THROUGHPUT
 // [ *] CONCERN: This test driver is reusable w/other, similar components.
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [  ] CONCERN: All memory allocation is from the object's allocator.
@@ -495,6 +503,157 @@ void testTwoArgumentConstructor(const char (&message)[LENGTH])
     ASSERT(digest1 == digest2);
 }
 
+template<class HASHER>
+void testLoadDigests(bool verbose)
+    // Verify that 'HASHER::loadDigests' loads, for batches of messages of
+    // assorted sizes, the same digests as a separate 'HASHER' constructed from
+    // each message.  If the specified 'verbose' is 'true', print the number
+    // of batches verified.
+{
+    const bsl::size_t k_DIGEST_SIZE = HASHER::k_DIGEST_SIZE;
+
+    // Lengths around the boundaries at which the padding of a message spills
+    // into a second final buffer, for both buffer sizes, and some multiples of
+    // the buffer sizes.
+
+    static const bsl::size_t LENGTHS[] = {
+          0,   1,   2,   3,  31,  54,  55,  56,  57,  63,  64,  65, 110, 111,
+        112, 113, 119, 127, 128, 129, 191, 255, 256, 257, 383, 640, 1000, 4096,
+        4097
+    };
+    const bsl::size_t NUM_LENGTHS = arraySize(LENGTHS);
+
+    bsl::string data(5000, '\0');
+    for (bsl::size_t i = 0; i != data.size(); ++i) {
+        data[i] = static_cast<char>(i * 7 + i / 251);
+    }
+
+    int numBatches = 0;
+    for (bsl::size_t numMessages = 0; numMessages <= 11; ++numMessages) {
+        for (bsl::size_t offset = 0; offset != NUM_LENGTHS; ++offset) {
+            bsl::vector<const void *> messages(numMessages + 1);
+            bsl::vector<bsl::size_t>  lengths(numMessages + 1);
+
+            // The messages start at different addresses, and their lengths
+            // are chosen so that the messages assigned to the lanes of a
+            // multi-buffer implementation finish at different times.
+
+            for (bsl::size_t i = 0; i != numMessages; ++i) {
+                lengths[i]  = LENGTHS[(offset + i * i) % NUM_LENGTHS];
+                messages[i] = lengths[i] ? data.data() + (i * 13) % 97 : 0;
+            }
+
+            // Include one extra digest after the last, to verify that it is
+            // not modified.
+
+            bsl::vector<unsigned char> results((numMessages + 1)
+                                                              * k_DIGEST_SIZE,
+                                               0xA5);
+            HASHER::loadDigests(results.data(),
+                                messages.data(),
+                                lengths.data(),
+                                numMessages);
+            ++numBatches;
+
+            for (bsl::size_t i = 0; i != numMessages; ++i) {
+                unsigned char expected[k_DIGEST_SIZE];
+                HASHER(messages[i], lengths[i]).loadDigest(expected);
+
+                ASSERTV(numMessages, offset, i, lengths[i],
+                        bsl::equal(expected,
+                                   expected + k_DIGEST_SIZE,
+                                   results.data() + i * k_DIGEST_SIZE));
+            }
+            for (bsl::size_t i = numMessages * k_DIGEST_SIZE;
+                 i != results.size();
+                 ++i) {
+                ASSERTV(numMessages, offset, i, 0xA5 == results[i]);
+            }
+        }
+    }
+
+    // Verify the known hashes, in a single batch.
+
+    const bsl::size_t         NUM_INPUTS = arraySize(inputMessages);
+    bsl::vector<const void *> messages(NUM_INPUTS);
+    bsl::vector<bsl::size_t>  lengths(NUM_INPUTS);
+    for (bsl::size_t i = 0; i != NUM_INPUTS; ++i) {
+        messages[i] = inputMessages[i].data();
+        lengths[i]  = inputMessages[i].size();
+    }
+
+    bsl::vector<unsigned char> results(NUM_INPUTS * k_DIGEST_SIZE);
+    HASHER::loadDigests(results.data(),
+                        messages.data(),
+                        lengths.data(),
+                        NUM_INPUTS);
+    for (bsl::size_t i = 0; i != NUM_INPUTS; ++i) {
+        unsigned char expected[k_DIGEST_SIZE];
+        HASHER(messages[i], lengths[i]).loadDigest(expected);
+
+        ASSERTV(i, bsl::equal(expected,
+                              expected + k_DIGEST_SIZE,
+                              results.data() + i * k_DIGEST_SIZE));
+    }
+
+    if (verbose) {
+        P(numBatches);
+    }
+}
+
+template<class HASHER>
+void measureThroughput(const char *name, bsl::size_t messageSize)
+    // Print, in CSV format and labelled with the specified 'name', the rate
+    // in MB/s at which 'HASHER' hashes messages of the specified
+    // 'messageSize' one at a time using 'update' and 'loadDigest', and in
+    // batches using 'loadDigests'.
+{
+    const bsl::size_t k_TOTAL_SIZE  = 64 * 1024 * 1024;
+    const bsl::size_t k_BATCH_SIZE  = 64;
+    const bsl::size_t numMessages   = k_TOTAL_SIZE / messageSize;
+    const bsl::size_t numBatches    = numMessages / k_BATCH_SIZE;
+
+    bsl::string data(messageSize * k_BATCH_SIZE, 'x');
+    for (bsl::size_t i = 0; i != data.size(); ++i) {
+        data[i] = static_cast<char>(i * 31);
+    }
+
+    bsl::vector<const void *>  messages(k_BATCH_SIZE);
+    bsl::vector<bsl::size_t>   lengths(k_BATCH_SIZE, messageSize);
+    bsl::vector<unsigned char> results(k_BATCH_SIZE * HASHER::k_DIGEST_SIZE);
+    for (bsl::size_t i = 0; i != k_BATCH_SIZE; ++i) {
+        messages[i] = data.data() + i * messageSize;
+    }
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (bsl::size_t batch = 0; batch != numBatches; ++batch) {
+        for (bsl::size_t i = 0; i != k_BATCH_SIZE; ++i) {
+            HASHER hasher(messages[i], messageSize);
+            hasher.loadDigest(results.data() + i * HASHER::k_DIGEST_SIZE);
+        }
+    }
+    timer.stop();
+    const double serialTime = timer.elapsedTime();
+
+    timer.reset();
+    timer.start();
+    for (bsl::size_t batch = 0; batch != numBatches; ++batch) {
+        HASHER::loadDigests(results.data(),
+                            messages.data(),
+                            lengths.data(),
+                            k_BATCH_SIZE);
+    }
+    timer.stop();
+    const double batchTime = timer.elapsedTime();
+
+    const double megabytes = static_cast<double>(numBatches * k_BATCH_SIZE
+                                                 * messageSize) / 1.0e6;
+
+    cout << name << ',' << messageSize << ','
+         << megabytes / serialTime << ',' << megabytes / batchTime << '\n';
+}
+
 }  // close unnamed namespace
 
 //=============================================================================
@@ -509,7 +668,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << '\n';
 
     switch (test) { case 0:
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -531,6 +690,59 @@ int main(int argc, char *argv[])
 
         assertPasswordIsExpected();
       } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING 'loadDigests'
+        //
+        // Concerns:
+        //: 1 'loadDigests' loads, for each message, the digest that would be
+        //:   obtained from 'loadDigest' on a digest constructed from that
+        //:   message.
+        //:
+        //: 2 The digests are correct for messages of any length, in particular
+        //:   around the lengths at which the padding of the message requires
+        //:   an additional buffer.
+        //:
+        //: 3 The digests are correct for any number of messages, including
+        //:   0 and numbers that are not multiples of the number of messages
+        //:   hashed concurrently, and when messages of different lengths, and
+        //:   so of a different number of buffers, are hashed concurrently.
+        //:
+        //: 4 No memory outside the digests of the specified messages is
+        //:   modified.
+        //:
+        //: 5 The digests of the FIPS-180 validation messages are correct when
+        //:   they are hashed together.
+        //
+        // Plan:
+        //: 1 For each of a range of batch sizes, hash batches of messages
+        //:   having lengths drawn from a table of boundary values, in a
+        //:   different order for each batch, and compare each digest against
+        //:   that obtained from 'loadDigest'.  (C-1..3)
+        //:
+        //: 2 Pre-fill the results with a known value, including an extra
+        //:   digest after the last, and verify that the extra digest is
+        //:   unmodified.  (C-4)
+        //:
+        //: 3 Hash the messages having known hashes in a single batch and
+        //:   compare against 'loadDigest', which was verified in cases 2-5.
+        //:   (C-5)
+        //
+        // Testing:
+        //   void Sha224::loadDigests(uchar *, const void **, size_t *, int);
+        //   void Sha256::loadDigests(uchar *, const void **, size_t *, int);
+        //   void Sha384::loadDigests(uchar *, const void **, size_t *, int);
+        //   void Sha512::loadDigests(uchar *, const void **, size_t *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'loadDigests'" "\n"
+                          << "=====================" "\n";
+
+        testLoadDigests<bdlde::Sha224>(verbose);
+        testLoadDigests<bdlde::Sha256>(verbose);
+        testLoadDigests<bdlde::Sha384>(verbose);
+        testLoadDigests<bdlde::Sha512>(verbose);
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // TESTING PRINTING AND OUTPUT (<<) OPERATOR FOR SHA-512
@@ -1250,6 +1462,36 @@ int main(int argc, char *argv[])
             ASSERT(hasher == hasher);
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: HASHING THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Hashing makes use of the processor's SHA extensions and vector
+        //:   units where available.
+        //
+        // Plan:
+        //: 1 For each digest and a range of message sizes, measure the rate at
+        //:   which messages are hashed one at a time and in batches, and print
+        //:   the results in CSV format.
+        //
+        // Testing:
+        //   PERFORMANCE: HASHING THROUGHPUT
+        // --------------------------------------------------------------------
+
+        cout << "PERFORMANCE: HASHING THROUGHPUT" "\n"
+             << "===============================" "\n";
+
+        static const bsl::size_t SIZES[] = { 64, 256, 1024, 4096, 65536 };
+
+        cout << "digest,messageSize,serialMBps,batchMBps\n";
+        for (bsl::size_t i = 0; i != arraySize(SIZES); ++i) {
+            measureThroughput<bdlde::Sha256>("sha256", SIZES[i]);
+        }
+        for (bsl::size_t i = 0; i != arraySize(SIZES); ++i) {
+            measureThroughput<bdlde::Sha512>("sha512", SIZES[i]);
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." "\n";
         testStatus = -1;
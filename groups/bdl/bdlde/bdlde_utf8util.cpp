@@ -15,11 +15,21 @@ BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 #include <bsla_fallthrough.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
+#include <bsls_platform.h>
 
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_streambuf.h>
 
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(BSLS_PLATFORM_CPU_X86)
+#if defined(BSLS_PLATFORM_CMP_CLANG) ||                                       \
+    (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900)
+#define BDLDE_UTF8UTIL_X86
+#include <immintrin.h>
+#endif
+#endif
+
 // LOCAL MACROS
 
 #define UNLIKELY(EXPRESSION) BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(EXPRESSION)
@@ -164,6 +174,357 @@ int get4ByteValue(const char *pc)
                                |  (pc[3] & k_CONT_VALUE_MASK);
 }
 
+// IMPLEMENTATION NOTES: The validating functions below first skip the prefix
+// of their input found to be valid by 'validPrefixLength', which checks many
+// bytes at a time using the lookup-table algorithm described by J. Keiser and
+// D. Lemire in "Validating UTF-8 In Less Than One Instruction Per Byte": each
+// byte is classified by three 16-entry table lookups, on its high nibble and
+// on both nibbles of the byte preceding it, such that the bitwise-and of the
+// three results is non-zero exactly when the pair cannot occur in valid UTF-8,
+// and the bytes that must be the third or fourth of a sequence are checked
+// separately.  Blocks consisting entirely of ASCII skip the table lookups.
+//
+// 'validPrefixLength' stops at the first block containing an error, and backs
+// off to the start of any code point that is incomplete before that block, so
+// that the character-at-a-time code resumes at a code point boundary and alone
+// determines the position and the nature of any error.
+
+#if defined(BDLDE_UTF8UTIL_X86)
+
+// The following flags classify a pair of consecutive bytes according to the
+// ways in which it may fail to be part of valid UTF-8.
+
+enum {
+    k_TOO_SHORT      = 1 << 0,  // lead byte not followed by continuation
+    k_TOO_LONG       = 1 << 1,  // ASCII byte followed by continuation
+    k_OVERLONG_3     = 1 << 2,  // 3-byte sequence for a value below 0x800
+    k_TOO_LARGE      = 1 << 3,  // value above 0x10ffff
+    k_SURROGATE_PAIR = 1 << 4,  // value in '[0xd800 .. 0xdfff]'
+    k_OVERLONG_2     = 1 << 5,  // 2-byte sequence for a value below 0x80
+    k_TOO_LARGE_1000 = 1 << 6,  // value above 0x10ffff (second byte 0x8_)
+    k_OVERLONG_4     = 1 << 6,  // 4-byte sequence for a value below 0x10000
+    k_TWO_CONTS      = 1 << 7,  // continuation followed by continuation
+    k_CARRY          = k_TOO_SHORT | k_TOO_LONG | k_TWO_CONTS
+};
+
+// The following are the tables indexed by the high nibble of the first byte,
+// the low nibble of the first byte, and the high nibble of the second byte of
+// each pair.
+
+#define BDLDE_UTF8UTIL_FIRST_HIGH                                             \
+    k_TOO_LONG,  k_TOO_LONG,  k_TOO_LONG,  k_TOO_LONG,                        \
+    k_TOO_LONG,  k_TOO_LONG,  k_TOO_LONG,  k_TOO_LONG,                        \
+    k_TWO_CONTS, k_TWO_CONTS, k_TWO_CONTS, k_TWO_CONTS,                       \
+    k_TOO_SHORT | k_OVERLONG_2,                                               \
+    k_TOO_SHORT,                                                              \
+    k_TOO_SHORT | k_OVERLONG_3 | k_SURROGATE_PAIR,                            \
+    k_TOO_SHORT | k_TOO_LARGE | k_TOO_LARGE_1000 | k_OVERLONG_4
+
+#define BDLDE_UTF8UTIL_FIRST_LOW                                              \
+    k_CARRY | k_OVERLONG_3 | k_OVERLONG_2 | k_OVERLONG_4,                     \
+    k_CARRY | k_OVERLONG_2,                                                   \
+    k_CARRY,                                                                  \
+    k_CARRY,                                                                  \
+    k_CARRY | k_TOO_LARGE,                                                    \
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,                                 \
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,                                 \
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,                                 \
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,                                 \
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,                                 \
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,                                 \
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,                                 \
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,                                 \
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000 | k_SURROGATE_PAIR,              \
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,                                 \
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000
+
+#define BDLDE_UTF8UTIL_SECOND_HIGH                                            \
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,                       \
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,                       \
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_OVERLONG_3                    \
+               | k_TOO_LARGE_1000 | k_OVERLONG_4,                             \
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_OVERLONG_3 | k_TOO_LARGE,     \
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_SURROGATE_PAIR | k_TOO_LARGE, \
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_SURROGATE_PAIR | k_TOO_LARGE, \
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT
+
+// The following holds, for each of the last 3 positions of a block, the
+// largest value of a byte that does not start a sequence extending beyond the
+// block.
+
+#define BDLDE_UTF8UTIL_INCOMPLETE_LIMIT                                       \
+    static_cast<char>(0xef), static_cast<char>(0xdf), static_cast<char>(0xbf)
+
+__attribute__((target("ssse3")))
+static
+bsls::Types::size_type validBlocksSsse3(bsls::Types::size_type *numStarts,
+                                        const char             *string,
+                                        bsls::Types::size_type  length,
+                                        bsls::Types::size_type  maxStarts)
+    // Return the length of the longest sequence of 16-byte blocks at the start
+    // of the specified 'string' having the specified 'length' that is valid
+    // UTF-8, except perhaps for the completeness of the last code point, and
+    // contains no more than the specified 'maxStarts' bytes that are not
+    // continuation bytes, and load the number of such bytes into the specified
+    // 'numStarts'.  The behavior is undefined unless the processor supports
+    // SSSE3 instructions.
+{
+    const __m128i firstHigh  = _mm_setr_epi8(BDLDE_UTF8UTIL_FIRST_HIGH);
+    const __m128i firstLow   = _mm_setr_epi8(BDLDE_UTF8UTIL_FIRST_LOW);
+    const __m128i secondHigh = _mm_setr_epi8(BDLDE_UTF8UTIL_SECOND_HIGH);
+    const __m128i limit      = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+                                             -1, -1, -1, -1, -1,
+                                             BDLDE_UTF8UTIL_INCOMPLETE_LIMIT);
+    const __m128i nibble     = _mm_set1_epi8(0x0f);
+    const __m128i zero       = _mm_setzero_si128();
+
+    __m128i                previous   = zero;
+    __m128i                incomplete = zero;
+    bsls::Types::size_type done       = 0;
+    bsls::Types::size_type starts     = 0;
+
+    for (; length - done >= 16 && maxStarts - starts >= 16; done += 16) {
+        const __m128i input = _mm_loadu_si128(
+                             reinterpret_cast<const __m128i *>(string + done));
+
+        __m128i error;
+        int     blockStarts = 16;
+
+        if (0 == _mm_movemask_epi8(input)) {
+            // Only ASCII: valid unless the previous block is incomplete.
+
+            error = incomplete;
+        }
+        else {
+            const __m128i previous1 = _mm_alignr_epi8(input, previous, 15);
+            const __m128i previous2 = _mm_alignr_epi8(input, previous, 14);
+            const __m128i previous3 = _mm_alignr_epi8(input, previous, 13);
+
+            const __m128i special = _mm_and_si128(
+                _mm_and_si128(
+                    _mm_shuffle_epi8(
+                              firstHigh,
+                              _mm_and_si128(_mm_srli_epi16(previous1, 4),
+                                            nibble)),
+                    _mm_shuffle_epi8(firstLow,
+                                     _mm_and_si128(previous1, nibble))),
+                _mm_shuffle_epi8(secondHigh,
+                                 _mm_and_si128(_mm_srli_epi16(input, 4),
+                                               nibble)));
+
+            // The bytes 2 after a 3- or 4-byte lead, and 3 after a 4-byte
+            // lead, must be continuations following continuations, which are
+            // exactly the pairs flagged only by 'k_TWO_CONTS'.
+
+            const __m128i must23 = _mm_or_si128(
+                            _mm_subs_epu8(previous2, _mm_set1_epi8(0x60)),
+                            _mm_subs_epu8(previous3, _mm_set1_epi8(0x70)));
+
+            error = _mm_xor_si128(
+                       _mm_and_si128(must23,
+                                     _mm_set1_epi8(static_cast<char>(0x80))),
+                       special);
+
+            // Count the bytes that are not continuation bytes, that is, those
+            // greater than 0xbf as signed values.
+
+            blockStarts = __builtin_popcount(_mm_movemask_epi8(
+                    _mm_cmpgt_epi8(input,
+                                   _mm_set1_epi8(static_cast<char>(0xbf)))));
+        }
+
+        if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi8(error, zero))) {
+            break;
+        }
+
+        starts     += blockStarts;
+        incomplete  = _mm_subs_epu8(input, limit);
+        previous    = input;
+    }
+
+    *numStarts = starts;
+    return done;
+}
+
+__attribute__((target("avx2,popcnt")))
+static
+bsls::Types::size_type validBlocksAvx2(bsls::Types::size_type *numStarts,
+                                       const char             *string,
+                                       bsls::Types::size_type  length,
+                                       bsls::Types::size_type  maxStarts)
+    // Return the length of the longest sequence of 32-byte blocks at the start
+    // of the specified 'string' having the specified 'length' that is valid
+    // UTF-8, except perhaps for the completeness of the last code point, and
+    // contains no more than the specified 'maxStarts' bytes that are not
+    // continuation bytes, and load the number of such bytes into the specified
+    // 'numStarts'.  The behavior is undefined unless the processor supports
+    // AVX2 and POPCNT instructions.
+{
+    const __m256i firstHigh  = _mm256_setr_epi8(BDLDE_UTF8UTIL_FIRST_HIGH,
+                                                BDLDE_UTF8UTIL_FIRST_HIGH);
+    const __m256i firstLow   = _mm256_setr_epi8(BDLDE_UTF8UTIL_FIRST_LOW,
+                                                BDLDE_UTF8UTIL_FIRST_LOW);
+    const __m256i secondHigh = _mm256_setr_epi8(BDLDE_UTF8UTIL_SECOND_HIGH,
+                                                BDLDE_UTF8UTIL_SECOND_HIGH);
+    const __m256i limit      = _mm256_setr_epi8(
+                                       -1, -1, -1, -1, -1, -1, -1, -1,
+                                       -1, -1, -1, -1, -1, -1, -1, -1,
+                                       -1, -1, -1, -1, -1, -1, -1, -1,
+                                       -1, -1, -1, -1, -1,
+                                       BDLDE_UTF8UTIL_INCOMPLETE_LIMIT);
+    const __m256i nibble     = _mm256_set1_epi8(0x0f);
+
+    __m256i                previous   = _mm256_setzero_si256();
+    __m256i                incomplete = _mm256_setzero_si256();
+    bsls::Types::size_type done       = 0;
+    bsls::Types::size_type starts     = 0;
+
+    for (; length - done >= 32 && maxStarts - starts >= 32; done += 32) {
+        const __m256i input = _mm256_loadu_si256(
+                             reinterpret_cast<const __m256i *>(string + done));
+
+        __m256i error;
+        int     blockStarts = 32;
+
+        if (0 == _mm256_movemask_epi8(input)) {
+            // Only ASCII: valid unless the previous block is incomplete.
+
+            error = incomplete;
+        }
+        else {
+            // 'shifted' holds the last 16 bytes of 'previous' followed by the
+            // first 16 of 'input'.
+
+            const __m256i shifted   = _mm256_permute2x128_si256(previous,
+                                                                input,
+                                                                0x21);
+            const __m256i previous1 = _mm256_alignr_epi8(input, shifted, 15);
+            const __m256i previous2 = _mm256_alignr_epi8(input, shifted, 14);
+            const __m256i previous3 = _mm256_alignr_epi8(input, shifted, 13);
+
+            const __m256i special = _mm256_and_si256(
+                _mm256_and_si256(
+                    _mm256_shuffle_epi8(
+                            firstHigh,
+                            _mm256_and_si256(_mm256_srli_epi16(previous1, 4),
+                                             nibble)),
+                    _mm256_shuffle_epi8(firstLow,
+                                        _mm256_and_si256(previous1, nibble))),
+                _mm256_shuffle_epi8(secondHigh,
+                                    _mm256_and_si256(_mm256_srli_epi16(input,
+                                                                       4),
+                                                     nibble)));
+
+            const __m256i must23 = _mm256_or_si256(
+                         _mm256_subs_epu8(previous2, _mm256_set1_epi8(0x60)),
+                         _mm256_subs_epu8(previous3, _mm256_set1_epi8(0x70)));
+
+            error = _mm256_xor_si256(
+                   _mm256_and_si256(must23,
+                                    _mm256_set1_epi8(static_cast<char>(0x80))),
+                   special);
+
+            blockStarts = __builtin_popcount(_mm256_movemask_epi8(
+                _mm256_cmpgt_epi8(input,
+                                  _mm256_set1_epi8(static_cast<char>(0xbf)))));
+        }
+
+        if (!_mm256_testz_si256(error, error)) {
+            break;
+        }
+
+        starts     += blockStarts;
+        incomplete  = _mm256_subs_epu8(input, limit);
+        previous    = input;
+    }
+
+    *numStarts = starts;
+    return done;
+}
+
+static bool detectSsse3()
+    // Return 'true' if the processor supports SSSE3 instructions, and 'false'
+    // otherwise.
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("ssse3");
+}
+
+static bool detectAvx2()
+    // Return 'true' if the processor and the operating system support AVX2
+    // and POPCNT instructions, and 'false' otherwise.
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+}
+
+static const bool s_useSsse3 = detectSsse3();
+static const bool s_useAvx2  = detectAvx2();
+
+#undef BDLDE_UTF8UTIL_FIRST_HIGH
+#undef BDLDE_UTF8UTIL_FIRST_LOW
+#undef BDLDE_UTF8UTIL_SECOND_HIGH
+#undef BDLDE_UTF8UTIL_INCOMPLETE_LIMIT
+
+#endif  // BDLDE_UTF8UTIL_X86
+
+static
+bsls::Types::size_type validPrefixLength(
+                                      bsls::Types::IntPtr    *numCodePoints,
+                                      const char             *string,
+                                      bsls::Types::size_type  length,
+                                      bsls::Types::IntPtr     maxCodePoints)
+    // Return the length of a prefix of the specified 'string' having the
+    // specified 'length' that consists of no more than the specified
+    // 'maxCodePoints' complete, valid UTF-8 code points, and load the number
+    // of those code points into the specified 'numCodePoints'.  The prefix is
+    // determined many bytes at a time, and may be shorter (in particular,
+    // empty) even if more of 'string' is valid.  The behavior is undefined
+    // unless '0 <= maxCodePoints'.
+{
+    bsls::Types::size_type done   = 0;
+    bsls::Types::size_type starts = 0;
+
+#if defined(BDLDE_UTF8UTIL_X86)
+    if (s_useAvx2) {
+        done = validBlocksAvx2(&starts,
+                               string,
+                               length,
+                               static_cast<bsls::Types::size_type>(
+                                                               maxCodePoints));
+    }
+    else if (s_useSsse3) {
+        done = validBlocksSsse3(&starts,
+                                string,
+                                length,
+                                static_cast<bsls::Types::size_type>(
+                                                               maxCodePoints));
+    }
+#else
+    (void)string;
+    (void)length;
+    (void)maxCodePoints;
+#endif
+
+    if (done) {
+        // Back off to the start of the last code point if it is incomplete.
+        // Note that the first byte of 'string' is not a continuation byte,
+        // since it was validated.
+
+        const char *last = string + done - 1;
+        while (!isNotContinuation(*last)) {
+            --last;
+        }
+        if (last + utf8Size(*last) > string + done) {
+            done = last - string;
+            --starts;
+        }
+    }
+
+    *numCodePoints = static_cast<bsls::Types::IntPtr>(starts);
+    return done;
+}
+
 static
 int validateAndCountCodePoints(const char **invalidString, const char *string)
     // Return the number of Unicode code points in the specified 'string' if it
@@ -181,7 +542,14 @@ int validateAndCountCodePoints(const char **invalidString, const char *string)
     BSLS_ASSERT_SAFE(invalidString);
     BSLS_ASSERT_SAFE(string);
 
-    int count = 0;
+    // Skip the prefix that can be validated many bytes at a time.
+
+    const bsls::Types::size_type length = bsl::strlen(string);
+
+    bsls::Types::IntPtr numSkipped;
+    string += validPrefixLength(&numSkipped, string, length, length);
+
+    int count = static_cast<int>(numSkipped);
 
     while (true) {
         switch (static_cast<unsigned char>(*string) >> 4) {
@@ -327,10 +695,20 @@ static int validateAndCountCodePoints(const char             **invalidString,
         return 0;                                                     // RETURN
     }
 
+    // Skip the prefix that can be validated many bytes at a time.
+
+    bsls::Types::IntPtr          numSkipped;
+    const bsls::Types::size_type skipped = validPrefixLength(&numSkipped,
+                                                             string,
+                                                             length,
+                                                             length);
+    string += skipped;
+    length -= skipped;
+
     const char       *pc     = string;
     const char *const pcEnd4 = string + length - 4;
 
-    int count = 0;
+    int count = static_cast<int>(numSkipped);
 
     while (pc <= pcEnd4) {
         switch (static_cast<unsigned char>(*pc) >> 4) {
@@ -768,6 +1146,10 @@ Utf8Util::IntPtr Utf8Util::advanceIfValid(int         *status,
 
     const char * const endOfInput = string + length;
 
+    // Skip the prefix that can be validated many bytes at a time.
+
+    string += validPrefixLength(&ret, string, length, numCodePoints);
+
     // Note that we keep 'string' pointing to the beginning of the Unicode code
     // point being processed, and only advance it to the next code point
     // between iterations.
@@ -78,6 +78,18 @@ BSLS_IDENT("$Id: $")
 // counterpart that takes a lone pointer to a null-terminated (C-style) string.
 // The behavior is always undefined if 0 is supplied for that lone pointer.
 //
+///Performance
+///-----------
+// On x86 platforms supporting SSSE3 or AVX2 (detected at run time),
+// 'isValid', 'numCodePointsIfValid', and the overloads of 'advanceIfValid'
+// taking a length validate and count code points 16 or 32 bytes at a time,
+// skipping runs of ASCII with a single comparison per block.  The result,
+// including the error status and the position reported for invalid input, is
+// identical to that of the byte-at-a-time algorithm used elsewhere.  Since
+// reading a block ahead requires knowing where the input ends, the overload of
+// 'advanceIfValid' taking a null-terminated string always proceeds one code
+// point at a time.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -17,6 +17,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_log.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -83,7 +84,9 @@ using bsl::size_t;
 //:
 //: o Test case 14 is negative testing.
 //:
-//: o Test cases 15, 16, and 17 are USAGE EXAMPLES.
+//: o Test case 15 tests the block-at-a-time validation on long inputs.
+//:
+//: o Test cases 16, 17, and 18 are USAGE EXAMPLES.
 //
 //-----------------------------------------------------------------------------
 // To fit functions on one line, 'typedef const char cchar'.
@@ -151,11 +154,13 @@ using bsl::size_t;
 // [ 1] BREATHING TEST
 // [ 2] TABLE-DRIVEN ENCODING / DECODING / VALIDATION TEST
 // [14] NEGATIVE TESTING
-// [15] USAGE EXAMPLE 1
-// [16] USAGE EXAMPLE 2
-// [17] USAGE EXAMPLE 3
+// [15] VECTORIZED VALIDATION
+// [16] USAGE EXAMPLE 1
+// [17] USAGE EXAMPLE 2
+// [18] USAGE EXAMPLE 3
 // [-1] random number generator
 // [-2] 'utf8Encode', 'decode'
+// [-3] PERFORMANCE: 'isValid' and 'numCodePointsIfValid'
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -3026,7 +3031,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 17: {
+      case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 3: 'readIfValid'
         //
@@ -3108,7 +3113,7 @@ int main(int argc, char *argv[])
         ASSERT(out.length() == validLen);
         ASSERT(validChineseUtf8 == out);
       } break;
-      case 16: {
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2: 'advance'
         //
@@ -3221,7 +3226,7 @@ int main(int argc, char *argv[])
     ASSERT(static_cast<int>(string.length()) == result - start);
 //..
       } break;
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1: 'isValid' AND 'numCodePoints*'
         //
@@ -3341,6 +3346,192 @@ int main(int argc, char *argv[])
     ASSERT(invalidPosition == stringWithOverlong.data() + string.length());
 //..
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING VECTORIZED VALIDATION
+        //
+        // Concerns:
+        //: 1 On platforms where validation proceeds a block of 16 or 32 bytes
+        //:   at a time, the functions taking a length report exactly the same
+        //:   results (code point count, status, and position of the first
+        //:   invalid sequence) as the byte-at-a-time validator.
+        //:
+        //: 2 Errors located anywhere relative to a block boundary, including
+        //:   multi-octet sequences that straddle a boundary or that are
+        //:   truncated by the end of input, are detected and reported at the
+        //:   correct position.
+        //:
+        //: 3 Inputs that begin with continuation octets, and inputs that are
+        //:   entirely ASCII, are handled correctly.
+        //:
+        //: 4 A limit on the number of code points to be advanced over is
+        //:   honored even when it falls in the middle of a block.
+        //
+        // Plan:
+        //: 1 Generate a large number of pseudo-random strings of up to a few
+        //:   hundred bytes, varying the density of multi-octet code points
+        //:   from none to all, and optionally splice a sequence from a table
+        //:   of invalid sequences into a random position.  Randomly trim a
+        //:   few bytes from the front and back of each string.  (C-1..3)
+        //:
+        //: 2 Use the null-terminated overload of 'advanceIfValid', which
+        //:   always validates one code point at a time, as the oracle, and
+        //:   compare its results with those of 'isValid',
+        //:   'numCodePointsIfValid', and 'advanceIfValid' given a length,
+        //:   with and without a limit on the number of code points.  (C-1..4)
+        //
+        // Testing:
+        //   VECTORIZED VALIDATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING VECTORIZED VALIDATION\n"
+                             "=============================\n";
+
+        static const char *const INVALID[] = {
+            "\x80",                 // unexpected continuation
+            "\xbf\x80",             // unexpected continuation
+            "\xc0\x80",             // overlong 2-octet
+            "\xc1\xbf",             // overlong 2-octet
+            "\xc2",                 // missing continuation
+            "\xc2\xc2\x80",         // non-continuation
+            "\xe0\x80\x80",         // overlong 3-octet
+            "\xe0\x9f\xbf",         // overlong 3-octet
+            "\xe1\x80",             // missing continuation
+            "\xe2\x28\xa1",         // non-continuation
+            "\xed\xa0\x80",         // surrogate
+            "\xed\xbf\xbf",         // surrogate
+            "\xf0\x80\x80\x80",     // overlong 4-octet
+            "\xf0\x8f\xbf\xbf",     // overlong 4-octet
+            "\xf1\x80\x80",         // missing continuation
+            "\xf4\x90\x80\x80",     // larger than 0x10ffff
+            "\xf5\x80\x80\x80",     // larger than 0x10ffff
+            "\xf7\xbf\xbf\xbf",     // larger than 0x10ffff
+            "\xf8\x88\x80\x80\x80", // invalid initial octet
+            "\xff",                 // invalid initial octet
+        };
+        enum { k_NUM_INVALID = sizeof INVALID / sizeof *INVALID };
+
+        const IntPtr infinity = bsl::numeric_limits<IntPtr>::max();
+
+        const int NUM_ITERATIONS = veryVerbose ? 200 * 1000 : 20 * 1000;
+
+        int numValid = 0;
+        for (int ti = 0; ti < NUM_ITERATIONS; ++ti) {
+            // 'density' is the chance, out of 8, that a code point is longer
+            // than one octet.
+
+            const unsigned density = randUnsigned() % 9;
+            const unsigned length  = randUnsigned() % 300;
+
+            bsl::string str;
+            while (str.length() < length) {
+                if (randUnsigned() % 8 < density) {
+                    appendRandCorrectCodePoint(&str,
+                                               false,
+                                               randUnsigned() % 3 + 2);
+                }
+                else {
+                    appendRand1Byte(&str);
+                }
+            }
+
+            if (randUnsigned() % 2) {
+                const char   *bad = INVALID[randUnsigned() % k_NUM_INVALID];
+                const size_t  pos = randUnsigned() % (str.length() + 1);
+
+                str.insert(pos, bad);
+            }
+
+            if (0 == randUnsigned() % 4) {
+                str.erase(0, randUnsigned() % 4);
+            }
+            if (0 == randUnsigned() % 4) {
+                str.resize(str.length() - bsl::min<size_t>(str.length(),
+                                                      randUnsigned() % 4));
+            }
+
+            // Compute the expected results with the byte-at-a-time validator.
+
+            int         EXP_STATUS  = 100;
+            const char *EXP_INVALID = 0;
+            const IntPtr EXP_COUNT = Obj::advanceIfValid(&EXP_STATUS,
+                                                         &EXP_INVALID,
+                                                         str.c_str(),
+                                                         infinity);
+            const bool EXP_VALID = 0 == EXP_STATUS;
+            numValid += EXP_VALID;
+
+            if (veryVeryVerbose) {
+                P_(ti);    P_(str.length());    P_(EXP_STATUS);
+                P(EXP_COUNT);
+            }
+
+            const char *invalid = 0;
+            ASSERTV(ti, EXP_VALID == Obj::isValid(&invalid,
+                                                  str.data(),
+                                                  str.length()));
+            ASSERTV(ti, (EXP_VALID ? 0 : EXP_INVALID) == invalid);
+
+            invalid = 0;
+            ASSERTV(ti, EXP_VALID == Obj::isValid(&invalid, str.c_str()));
+            ASSERTV(ti, (EXP_VALID ? 0 : EXP_INVALID) == invalid);
+
+            invalid = 0;
+            ASSERTV(ti, (EXP_VALID ? EXP_COUNT : EXP_STATUS) ==
+                        Obj::numCodePointsIfValid(&invalid,
+                                                  str.data(),
+                                                  str.length()));
+            ASSERTV(ti, (EXP_VALID ? 0 : EXP_INVALID) == invalid);
+
+            invalid = 0;
+            ASSERTV(ti, (EXP_VALID ? EXP_COUNT : EXP_STATUS) ==
+                        Obj::numCodePointsIfValid(&invalid, str.c_str()));
+            ASSERTV(ti, (EXP_VALID ? 0 : EXP_INVALID) == invalid);
+
+            int status = 100;
+            invalid = 0;
+            ASSERTV(ti, EXP_COUNT == Obj::advanceIfValid(&status,
+                                                         &invalid,
+                                                         str.data(),
+                                                         str.length(),
+                                                         infinity));
+            ASSERTV(ti, EXP_STATUS == status);
+            ASSERTV(ti, EXP_INVALID == invalid);
+
+            // Now limit the number of code points to be advanced over.
+
+            for (int tj = 0; tj < 4; ++tj) {
+                const IntPtr LIMIT = 0 == tj ? 0
+                                   : 1 == tj ? EXP_COUNT / 2
+                                   : 2 == tj ? bsl::max<IntPtr>(EXP_COUNT - 1,
+                                                                0)
+                                   : randUnsigned() % (EXP_COUNT + 1);
+
+                int         expStatus = 100;
+                const char *expResult = 0;
+                const IntPtr expCount = Obj::advanceIfValid(&expStatus,
+                                                            &expResult,
+                                                            str.c_str(),
+                                                            LIMIT);
+                ASSERTV(ti, tj, expCount <= LIMIT);
+
+                status = 100;
+                const char *result = 0;
+                ASSERTV(ti, tj, expCount == Obj::advanceIfValid(&status,
+                                                                &result,
+                                                                str.data(),
+                                                                str.length(),
+                                                                LIMIT));
+                ASSERTV(ti, tj, expStatus == status);
+                ASSERTV(ti, tj, expResult == result);
+            }
+        }
+
+        // Make sure both outcomes were well represented.
+
+        ASSERTV(numValid, NUM_ITERATIONS / 4 < numValid);
+        ASSERTV(numValid, numValid < NUM_ITERATIONS * 3 / 4);
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // NEGATIVE TESTING
@@ -6203,6 +6394,109 @@ int main(int argc, char *argv[])
             ASSERT(bsl::strlen(str.c_str()) == str.length());
         }
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'isValid' AND 'numCodePointsIfValid'
+        //
+        // Concerns:
+        //: 1 Report the throughput of validation on ASCII text, on text that
+        //:   is mostly ASCII, and on text consisting entirely of multi-octet
+        //:   code points.
+        //
+        // Plan:
+        //: 1 Generate 1MB of each kind of text and time repeated calls to
+        //:   'isValid' and 'numCodePointsIfValid' given a length, and to the
+        //:   null-terminated overload of 'advanceIfValid', which validates one
+        //:   code point at a time, for comparison.  Print the results in CSV
+        //:   format.
+        //
+        // Testing:
+        //   PERFORMANCE: 'isValid' and 'numCodePointsIfValid'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout <<
+                         "PERFORMANCE: 'isValid' AND 'numCodePointsIfValid'\n"
+                         "=================================================\n";
+
+        const IntPtr infinity = bsl::numeric_limits<IntPtr>::max();
+
+        const size_t INPUT_SIZE     = 1024 * 1024;
+        const int    NUM_ITERATIONS = 100;
+
+        static const struct {
+            const char *d_name;     // name of the kind of text
+            unsigned    d_density;  // chance out of 8 of a multi-octet point
+        } DATA[] = {
+            { "ascii",        0 },
+            { "mostly-ascii", 1 },
+            { "multi-octet",  8 },
+        };
+        enum { k_NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        cout << "text,function,MB/s\n";
+
+        for (int ti = 0; ti < k_NUM_DATA; ++ti) {
+            const char     *NAME    = DATA[ti].d_name;
+            const unsigned  DENSITY = DATA[ti].d_density;
+
+            bsl::string str;
+            while (str.length() < INPUT_SIZE) {
+                if (randUnsigned() % 8 < DENSITY) {
+                    appendRandCorrectCodePoint(&str,
+                                               false,
+                                               randUnsigned() % 3 + 2);
+                }
+                else {
+                    appendRand1Byte(&str);
+                }
+            }
+            ASSERT(Obj::isValid(str.data(), str.length()));
+
+            const double megabytes = static_cast<double>(str.length()) *
+                                              NUM_ITERATIONS / (1024 * 1024);
+
+            bsls::Stopwatch timer;
+            IntPtr          sum = 0;
+
+            timer.start();
+            for (int tj = 0; tj < NUM_ITERATIONS; ++tj) {
+                sum += Obj::isValid(str.data(), str.length());
+            }
+            timer.stop();
+            ASSERT(NUM_ITERATIONS == sum);
+            cout << NAME << ",isValid," << megabytes / timer.elapsedTime()
+                 << endl;
+
+            const char *invalid = 0;
+            sum = 0;
+            timer.reset();
+            timer.start();
+            for (int tj = 0; tj < NUM_ITERATIONS; ++tj) {
+                sum += Obj::numCodePointsIfValid(&invalid,
+                                                 str.data(),
+                                                 str.length());
+            }
+            timer.stop();
+            ASSERT(0 < sum);
+            cout << NAME << ",numCodePointsIfValid,"
+                 << megabytes / timer.elapsedTime() << endl;
+
+            int status = 0;
+            sum = 0;
+            timer.reset();
+            timer.start();
+            for (int tj = 0; tj < NUM_ITERATIONS; ++tj) {
+                sum += Obj::advanceIfValid(&status,
+                                           &invalid,
+                                           str.c_str(),
+                                           infinity);
+            }
+            timer.stop();
+            ASSERT(0 < sum);
+            cout << NAME << ",advanceIfValid (byte-at-a-time),"
+                 << megabytes / timer.elapsedTime() << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -23,7 +23,10 @@ BSLS_IDENT("$Id: $")
 //   `----------------------------------'
 //                   |        ctor/dtor
 //                   |        rewind
-//                   |
+//                   |        setMaxIdleCapacity
+//                   |        shrink
+//                   |        mark
+//                   |        maxIdleCapacity
 //                   V
 //       ,-----------------------.
 //      ( bdlma::ManagedAllocator )
@@ -92,6 +95,31 @@ BSLS_IDENT("$Id: $")
 // wasted depends on whether natural alignment, maximum alignment, or 1-byte
 // alignment is used (see 'bsls_alignment' for more details).
 //
+///Rewinding to a Mark
+///--------------------
+// The 'mark' accessor returns a mark recording the current state of the
+// allocator, and 'rewind(mark)' releases all memory allocated since then
+// (returning to the underlying allocator only the large blocks allocated
+// since then), leaving memory allocated before the mark untouched.  Marks
+// nest, so a long-lived allocator can serve as an arena with *savepoints*:
+// rewinding to a mark invalidates all marks taken after it, but not those
+// taken before it.  Note that 'release' and 'rewind()' invalidate all marks.
+// See {'bdlma_sequentialpool'|Marks and Rewinding}.
+//
+///Returning Idle Memory
+///---------------------
+// Rewinding does not return the internal buffers of the allocator to the
+// underlying allocator, so an allocator that grew to satisfy one unusually
+// large burst of allocations would otherwise hold that memory until it is
+// released or destroyed.  The 'shrink' method returns internal buffers that
+// are not currently used to satisfy any allocation (i.e., *idle* buffers),
+// largest first, until at most a specified number of idle bytes remain.  In
+// addition, 'setMaxIdleCapacity' installs a policy under which every call to
+// either 'rewind' overload is followed by 'shrink(maxIdleCapacity())', so that
+// the allocator retains no more idle memory than the configured watermark
+// once its usage falls.  By default, no limit is imposed, and the allocator
+// retains all of its internal buffers until 'release' is called.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -195,6 +223,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_performancehint.h>
 #include <bsls_types.h>
 
+#include <bsl_limits.h>
+
 namespace BloombergLP {
 namespace bdlma {
 
@@ -216,14 +246,28 @@ class BufferedSequentialAllocator : public ManagedAllocator {
     // allocator attempt to deallocate the external buffer.
 
     // DATA
-    BufferedSequentialPool d_pool;  // manager for allocated memory blocks
+    BufferedSequentialPool d_pool;             // manager for allocated memory
+                                               // blocks
+
+    bsls::Types::size_type d_maxIdleCapacity;  // upper bound on idle memory
+                                               // retained after a 'rewind'
 
   private:
+    // PRIVATE MANIPULATORS
+    void applyMaxIdleCapacity();
+        // Return idle memory to the underlying allocator as necessary so that
+        // at most 'maxIdleCapacity()' bytes of it remain.
+
     // NOT IMPLEMENTED
     BufferedSequentialAllocator(const BufferedSequentialAllocator&);
     BufferedSequentialAllocator& operator=(const BufferedSequentialAllocator&);
 
   public:
+    // PUBLIC TYPES
+    typedef BufferedSequentialPool::Mark Mark;
+        // 'Mark' is an alias for the type recording the state of this
+        // allocator, to which it can be rewound.
+
     // CREATORS
     BufferedSequentialAllocator(char                   *buffer,
                                 bsls::Types::size_type  size,
@@ -341,6 +385,47 @@ class BufferedSequentialAllocator : public ManagedAllocator {
         // allocations.  The effect of subsequently - to this invokation of
         // 'rewind' - using a pointer obtained from this object prior to this
         // call to 'rewind' is undefined.
+
+    void rewind(const Mark& mark);
+        // Release all memory allocated through this allocator since the
+        // specified 'mark' was obtained from 'mark()', and return to the
+        // underlying allocator *only* the large blocks allocated since then;
+        // then, if a maximum idle capacity has been set, return idle memory to
+        // the underlying allocator as by 'shrink(maxIdleCapacity())'.  Memory
+        // allocated before 'mark' was obtained is unaffected.  Marks obtained
+        // after 'mark' are invalidated.  The effect of subsequently - to this
+        // invocation of 'rewind' - using a pointer obtained from this object
+        // after 'mark' was obtained is undefined.  The behavior is undefined
+        // unless 'mark' was obtained from this allocator, and neither
+        // 'release', 'rewind()', nor 'rewind' with a mark obtained before
+        // 'mark' has been called since.
+
+    void setMaxIdleCapacity(bsls::Types::size_type numBytes);
+        // Set the maximum number of bytes of idle memory (i.e., memory
+        // retained by this allocator but not used to satisfy any allocation)
+        // that this allocator retains following a call to either 'rewind'
+        // overload to the specified 'numBytes'.  Note that this method does
+        // not itself return any memory; see 'shrink'.
+
+    void shrink(bsls::Types::size_type maxIdleBytes = 0);
+        // Return to the underlying allocator internal buffers that are
+        // retained by this allocator but not currently used to satisfy any
+        // allocation, largest first, until at most the optionally specified
+        // 'maxIdleBytes' of such memory remain.  If 'maxIdleBytes' is not
+        // specified, all idle internal buffers are returned.  Outstanding
+        // allocations, and marks that remain valid, are unaffected.
+
+    // ACCESSORS
+    Mark mark() const;
+        // Return a mark recording the current state of this allocator, such
+        // that supplying it to 'rewind' releases all memory allocated after
+        // this call.
+
+    bsls::Types::size_type maxIdleCapacity() const;
+        // Return the maximum number of bytes of idle memory that this
+        // allocator retains following a call to either 'rewind' overload.  If
+        // 'setMaxIdleCapacity' has not been called, return
+        // 'bsl::numeric_limits<bsls::Types::size_type>::max()'.
 };
 
 // ============================================================================
@@ -358,6 +443,7 @@ BufferedSequentialAllocator::BufferedSequentialAllocator(
                                         bsls::Types::size_type  size,
                                         bslma::Allocator       *basicAllocator)
 : d_pool(buffer, size, basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
 }
 
@@ -368,6 +454,7 @@ BufferedSequentialAllocator::BufferedSequentialAllocator(
                                    bsls::BlockGrowth::Strategy  growthStrategy,
                                    bslma::Allocator            *basicAllocator)
 : d_pool(buffer, size, growthStrategy, basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
 }
 
@@ -378,6 +465,7 @@ BufferedSequentialAllocator::BufferedSequentialAllocator(
                                   bsls::Alignment::Strategy  alignmentStrategy,
                                   bslma::Allocator          *basicAllocator)
 : d_pool(buffer, size, alignmentStrategy, basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
 }
 
@@ -389,6 +477,7 @@ BufferedSequentialAllocator::BufferedSequentialAllocator(
                                 bsls::Alignment::Strategy    alignmentStrategy,
                                 bslma::Allocator            *basicAllocator)
 : d_pool(buffer, size, growthStrategy, alignmentStrategy, basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
 }
 
@@ -399,6 +488,7 @@ BufferedSequentialAllocator::BufferedSequentialAllocator(
                                         bsls::Types::size_type  maxBufferSize,
                                         bslma::Allocator       *basicAllocator)
 : d_pool(buffer, size, maxBufferSize, basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
 }
 
@@ -410,6 +500,7 @@ BufferedSequentialAllocator::BufferedSequentialAllocator(
                                    bsls::BlockGrowth::Strategy  growthStrategy,
                                    bslma::Allocator            *basicAllocator)
 : d_pool(buffer, size, maxBufferSize, growthStrategy, basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
 }
 
@@ -421,6 +512,7 @@ BufferedSequentialAllocator::BufferedSequentialAllocator(
                                   bsls::Alignment::Strategy  alignmentStrategy,
                                   bslma::Allocator          *basicAllocator)
 : d_pool(buffer, size, maxBufferSize, alignmentStrategy, basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
 }
 
@@ -438,9 +530,25 @@ BufferedSequentialAllocator::BufferedSequentialAllocator(
          growthStrategy,
          alignmentStrategy,
          basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
 }
 
+// PRIVATE MANIPULATORS
+inline
+void BufferedSequentialAllocator::applyMaxIdleCapacity()
+{
+    const bsls::Types::size_type k_UNLIMITED =
+                            bsl::numeric_limits<bsls::Types::size_type>::max();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                           d_maxIdleCapacity != k_UNLIMITED)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_pool.shrink(d_maxIdleCapacity);
+    }
+}
+
 // MANIPULATORS
 inline
 void *BufferedSequentialAllocator::allocate(size_type size)
@@ -468,6 +576,43 @@ inline
 void BufferedSequentialAllocator::rewind()
 {
     d_pool.rewind();
+
+    applyMaxIdleCapacity();
+}
+
+inline
+void BufferedSequentialAllocator::rewind(const Mark& mark)
+{
+    d_pool.rewind(mark);
+
+    applyMaxIdleCapacity();
+}
+
+inline
+void BufferedSequentialAllocator::setMaxIdleCapacity(
+                                               bsls::Types::size_type numBytes)
+{
+    d_maxIdleCapacity = numBytes;
+}
+
+inline
+void BufferedSequentialAllocator::shrink(bsls::Types::size_type maxIdleBytes)
+{
+    d_pool.shrink(maxIdleBytes);
+}
+
+
+// ACCESSORS
+inline
+BufferedSequentialAllocator::Mark BufferedSequentialAllocator::mark() const
+{
+    return d_pool.mark();
+}
+
+inline
+bsls::Types::size_type BufferedSequentialAllocator::maxIdleCapacity() const
+{
+    return d_maxIdleCapacity;
 }
 
 }  // close package namespace
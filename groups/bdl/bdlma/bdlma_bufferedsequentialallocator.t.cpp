@@ -13,6 +13,7 @@
 
 #include <bsl_cstdio.h>
 #include <bsl_iostream.h>
+#include <bsl_limits.h>
 #include <bsl_map.h>
 #include <bsl_string.h>
 #include <bsl_vector.h>
@@ -71,9 +72,16 @@ using namespace bsl;
 // [ 2] void *allocate(size_type size);
 // [ 3] void deallocate(void *address);
 // [ 4] void release();
+// [ 6] void rewind(const Mark& mark);
+// [ 6] void setMaxIdleCapacity(size_type numBytes);
+// [ 6] void shrink(size_type maxIdleBytes = 0);
+//
+// // ACCESSORS
+// [ 6] Mark mark() const;
+// [ 6] size_type maxIdleCapacity() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 6] USAGE TEST
+// [ 7] USAGE TEST
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -248,7 +256,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 6: {
+      case 7: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -330,6 +338,153 @@ int main(int argc, char *argv[])
             if (verbose) P(objectAllocator.numBytesTotal())
         }
 
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'mark', 'rewind(mark)', 'shrink', AND 'setMaxIdleCapacity'
+        //
+        // Concerns:
+        //: 1 'maxIdleCapacity' is initially unlimited, and reflects the value
+        //:   most recently supplied to 'setMaxIdleCapacity'.
+        //:
+        //: 2 'rewind(mark)' restores both the position in the external buffer
+        //:   and the state of the allocator used once the buffer is
+        //:   exhausted, whether or not that allocator had been used when the
+        //:   mark was obtained.
+        //:
+        //: 3 'shrink' returns idle memory to the allocator supplied at
+        //:   construction, and never affects the external buffer.
+        //:
+        //: 4 Both 'rewind' overloads return idle memory in excess of
+        //:   'maxIdleCapacity' to the allocator supplied at construction.
+        //
+        // Plan:
+        //: 1 Verify the default value of 'maxIdleCapacity', set a sequence of
+        //:   values, and verify the accessor after each.  (C-1)
+        //:
+        //: 2 Obtain marks before and after exhausting the external buffer,
+        //:   allocate past each, rewind, and verify that repeating the
+        //:   allocations yields the same addresses without further dynamic
+        //:   allocation.  (C-2)
+        //:
+        //: 3 Rewind to a mark obtained before the buffer was exhausted, invoke
+        //:   'shrink', and verify using a test allocator that only the
+        //:   bookkeeping of the allocator remains in use, and that subsequent
+        //:   allocations are satisfied by the external buffer.  (C-3)
+        //:
+        //: 4 Repeat P-2 having first set 'maxIdleCapacity' to 0, and verify
+        //:   that 'rewind' and 'rewind(mark)' shrink the allocator.  (C-4)
+        //
+        // Testing:
+        //   void rewind(const Mark& mark);
+        //   void setMaxIdleCapacity(size_type numBytes);
+        //   void shrink(size_type maxIdleBytes = 0);
+        //   Mark mark() const;
+        //   size_type maxIdleCapacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+               << "TESTING 'mark', 'rewind(mark)', 'shrink', AND "
+                  "'setMaxIdleCapacity'" << endl
+               << "=============================================="
+                  "====================" << endl;
+
+        typedef bsls::Types::size_type size_type;
+
+        enum { k_NUM_ALLOCS = 32, k_ALLOC_SIZE = 64 };
+
+        char *buffer = bufferStorage.buffer();
+
+        if (verbose) cout << "\nTesting 'maxIdleCapacity'." << endl;
+        {
+            Obj mX(buffer, k_BUFFER_SIZE, &objectAllocator);
+            const Obj& X = mX;
+
+            ASSERT(bsl::numeric_limits<size_type>::max() ==
+                                                         X.maxIdleCapacity());
+
+            mX.setMaxIdleCapacity(0);
+            ASSERT(0 == X.maxIdleCapacity());
+
+            mX.setMaxIdleCapacity(1024);
+            ASSERT(1024 == X.maxIdleCapacity());
+        }
+
+        if (verbose) cout << "\nTesting 'rewind(mark)' and 'shrink'." << endl;
+        {
+            Obj mX(buffer, k_BUFFER_SIZE, &objectAllocator);
+            const Obj& X = mX;
+
+            void *addr[k_NUM_ALLOCS];
+
+            ASSERT(buffer == mX.allocate(k_ALLOC_SIZE));
+
+            const Obj::Mark M1 = X.mark();
+
+            for (int i = 0; i < k_NUM_ALLOCS; ++i) {
+                addr[i] = mX.allocate(k_ALLOC_SIZE);
+            }
+            ASSERT(buffer + k_ALLOC_SIZE == addr[0]);
+
+            const Obj::Mark M2 = X.mark();
+
+            const bsls::Types::Int64 NUM_BLOCKS =
+                                             objectAllocator.numBlocksInUse();
+            ASSERTV(NUM_BLOCKS, 2 < NUM_BLOCKS);
+
+            mX.allocate(k_ALLOC_SIZE);
+            mX.rewind(M2);
+            mX.rewind(M1);
+            ASSERT(NUM_BLOCKS == objectAllocator.numBlocksInUse());
+
+            for (int i = 0; i < k_NUM_ALLOCS; ++i) {
+                ASSERTV(i, addr[i] == mX.allocate(k_ALLOC_SIZE));
+            }
+            ASSERT(NUM_BLOCKS == objectAllocator.numBlocksInUse());
+
+            mX.rewind(M1);
+
+            mX.shrink(bsl::numeric_limits<size_type>::max());
+            ASSERT(NUM_BLOCKS == objectAllocator.numBlocksInUse());
+
+            mX.shrink();
+            ASSERTV(objectAllocator.numBlocksInUse(),
+                    1 == objectAllocator.numBlocksInUse());
+
+            ASSERT(buffer + k_ALLOC_SIZE == mX.allocate(k_ALLOC_SIZE));
+            ASSERT(1 == objectAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == objectAllocator.numBytesInUse());
+
+        if (verbose) cout << "\nTesting 'setMaxIdleCapacity'." << endl;
+        {
+            Obj mX(buffer, k_BUFFER_SIZE, &objectAllocator);
+            const Obj& X = mX;
+
+            mX.setMaxIdleCapacity(0);
+
+            for (int i = 0; i < k_NUM_ALLOCS; ++i) {
+                mX.allocate(k_ALLOC_SIZE);
+            }
+            ASSERT(1 < objectAllocator.numBlocksInUse());
+
+            mX.rewind();
+            ASSERT(1 == objectAllocator.numBlocksInUse());
+
+            const Obj::Mark M = X.mark();
+
+            for (int i = 0; i < k_NUM_ALLOCS; ++i) {
+                mX.allocate(k_ALLOC_SIZE);
+            }
+            ASSERT(1 < objectAllocator.numBlocksInUse());
+
+            mX.rewind(M);
+            ASSERT(1 == objectAllocator.numBlocksInUse());
+
+            ASSERT(buffer == mX.allocate(k_ALLOC_SIZE));
+        }
+        ASSERT(0 == objectAllocator.numBytesInUse());
+
       } break;
       case 5: {
         // --------------------------------------------------------------------
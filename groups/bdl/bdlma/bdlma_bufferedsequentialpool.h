@@ -29,6 +29,14 @@ BSLS_IDENT("$Id: $")
 // internal buffer growth of the pool (i.e., large blocks).  Note that
 // individually allocated memory blocks cannot be separately deallocated.
 //
+// As with 'bdlma::SequentialPool', the 'mark' accessor records the state of
+// the pool, and 'rewind(mark)' releases all memory allocated since then,
+// allowing nested savepoints; and the 'shrink' method returns dynamically
+// allocated buffers that are not currently in use to the underlying allocator
+// (see {'bdlma_sequentialpool'|Marks and Rewinding} and
+// {'bdlma_sequentialpool'|Returning Idle Memory}).  Note that the external
+// buffer is never returned.
+//
 // A 'bdlma::BufferedSequentialPool' is typically used when users have a
 // reasonable estimation of the amount of memory needed.  This amount of memory
 // would typically be created directly on the program stack, and used as the
@@ -367,6 +375,40 @@ class BufferedSequentialPool {
                                                 // buffer, if the sequential
                                                 // pool has been created
 
+  public:
+    // PUBLIC TYPES
+    class Mark {
+        // This class records the state of a 'BufferedSequentialPool' at the
+        // time its 'mark' accessor was called, and allows that pool to be
+        // rewound to that state.  A 'Mark' is meaningful only to the pool
+        // that created it.
+
+        // DATA
+        bsls::Types::size_type d_cursor;         // cursor in external buffer
+
+        bool                   d_poolIsCreated;  // whether the sequential
+                                                 // pool existed
+
+        SequentialPool::Mark   d_poolMark;       // state of the sequential
+                                                 // pool, if it existed
+
+        // FRIENDS
+        friend class BufferedSequentialPool;
+
+      public:
+        // CREATORS
+        Mark();
+            // Create a mark that does not record the state of any pool.  The
+            // behavior is undefined if a default-constructed mark is supplied
+            // to 'rewind' unless another mark has been assigned to it.
+
+        //! Mark(const Mark& original) = default;
+        //! ~Mark() = default;
+
+        // MANIPULATORS
+        //! Mark& operator=(const Mark& rhs) = default;
+    };
+
   private:
     // NOT IMPLEMENTED
     BufferedSequentialPool(const BufferedSequentialPool&);
@@ -509,7 +551,36 @@ class BufferedSequentialPool {
         // a pointer obtained from this object prior to this call to 'rewind'
         // is undefined.
 
+    void rewind(const Mark& mark);
+        // Release all memory allocated through this pool since the specified
+        // 'mark' was obtained from 'mark()', and return to the underlying
+        // allocator *only* the large blocks (i.e., memory allocated outside of
+        // the typical internal buffer growth of this pool) allocated since
+        // then.  All retained memory will be used to satisfy subsequent
+        // allocations.  Memory allocated before 'mark' was obtained is
+        // unaffected.  Marks obtained after 'mark' are invalidated.  The
+        // effect of subsequently - to this invocation of 'rewind' - using a
+        // pointer obtained from this object after 'mark' was obtained is
+        // undefined.  The behavior is undefined unless 'mark' was obtained
+        // from this pool, and neither 'release', 'rewind()', nor 'rewind' with
+        // a mark obtained before 'mark' has been called since.
+
+    void shrink(bsls::Types::size_type maxIdleBytes = 0);
+        // Return to the underlying allocator dynamically-allocated buffers
+        // that are retained by this pool but not currently used to satisfy
+        // any allocation, largest first, until at most the optionally
+        // specified 'maxIdleBytes' of such memory remain.  If 'maxIdleBytes'
+        // is not specified, all idle dynamically-allocated buffers are
+        // returned.  Outstanding allocations, and marks that remain valid, are
+        // unaffected.  Note that the external buffer supplied at construction
+        // is never returned.
+
     // ACCESSORS
+    Mark mark() const;
+        // Return a mark recording the current state of this pool, such that
+        // supplying it to 'rewind' releases all memory allocated after this
+        // call.
+
     bslma::Allocator *allocator() const;
         // Return the allocator used by this object to allocate memory.  Note
         // that this allocator can not be used to deallocate memory allocated
@@ -587,6 +658,19 @@ void operator delete(void                                        *address,
 namespace BloombergLP {
 namespace bdlma {
 
+                    // ----------------------------------
+                    // class BufferedSequentialPool::Mark
+                    // ----------------------------------
+
+// CREATORS
+inline
+BufferedSequentialPool::Mark::Mark()
+: d_cursor(0)
+, d_poolIsCreated(false)
+, d_poolMark()
+{
+}
+
                        // ----------------------------
                        // class BufferedSequentialPool
                        // ----------------------------
@@ -687,7 +771,44 @@ void BufferedSequentialPool::rewind()
     }
 }
 
+inline
+void BufferedSequentialPool::rewind(const Mark& mark)
+{
+    d_bufferManager.setCursor(mark.d_cursor);
+
+    if (d_sequentialPoolIsCreated) {
+        if (mark.d_poolIsCreated) {
+            d_pool_p->rewind(mark.d_poolMark);
+        }
+        else {
+            d_pool_p->rewind();
+        }
+    }
+}
+
+inline
+void BufferedSequentialPool::shrink(bsls::Types::size_type maxIdleBytes)
+{
+    if (d_sequentialPoolIsCreated) {
+        d_pool_p->shrink(maxIdleBytes);
+    }
+}
+
 // ACCESSORS
+inline
+BufferedSequentialPool::Mark BufferedSequentialPool::mark() const
+{
+    Mark result;
+
+    result.d_cursor        = d_bufferManager.cursor();
+    result.d_poolIsCreated = d_sequentialPoolIsCreated;
+    if (d_sequentialPoolIsCreated) {
+        result.d_poolMark = d_pool_p->mark();
+    }
+
+    return result;
+}
+
 inline
 bslma::Allocator *BufferedSequentialPool::allocator() const
 {
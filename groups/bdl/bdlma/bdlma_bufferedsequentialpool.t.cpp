@@ -73,6 +73,11 @@ using namespace bsl;
 // [ 6] void deleteObject(const TYPE *object);
 // [ 5] void release();
 // [ 9] void rewind();
+// [11] void rewind(const Mark& mark);
+// [11] void shrink(size_type maxIdleBytes = 0);
+//
+// ACCESSORS
+// [11] Mark mark() const;
 // [10] bslma::Allocator *allocator() const;
 //
 // FREE FUNCTIONS
@@ -80,7 +85,7 @@ using namespace bsl;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] HELPER FUNCTION: 'int blockSize(numBytes)'
-// [11] USAGE EXAMPLE
+// [12] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -493,7 +498,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 11: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -516,6 +521,152 @@ int main(int argc, char *argv[])
                           << "=============" << endl;
 
       } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING 'mark', 'rewind(mark)', AND 'shrink'
+        //   Ensure a pool can be rewound to a mark, and returns idle memory.
+        //
+        // Concerns:
+        //: 1 After 'rewind(mark)', the pool reuses exactly the memory
+        //:   allocated since 'mark' was taken, whether that memory came from
+        //:   the external buffer or from dynamically-allocated buffers, and
+        //:   whether or not dynamically-allocated buffers were in use when
+        //:   'mark' was taken.
+        //:
+        //: 2 Marks nest.
+        //:
+        //: 3 'rewind(mark)' does not return dynamically-allocated buffers to
+        //:   the underlying allocator.
+        //:
+        //: 4 'shrink' returns idle dynamically-allocated buffers, has no
+        //:   effect if none were allocated, and never returns the external
+        //:   buffer.
+        //:
+        //: 5 'mark' is declared 'const'.
+        //
+        // Plan:
+        //: 1 For all alignment strategies, allocate a sequence of sizes that
+        //:   overflows the external buffer, taking a mark before the first
+        //:   allocation and another in the middle of the sequence.  Rewind to
+        //:   each mark in turn and verify that re-allocating the sequence
+        //:   from that point reproduces the same addresses without further
+        //:   use of the underlying allocator.  (C-1..3, 5)
+        //:
+        //: 2 Using a 'bslma::TestAllocator', verify the memory retained after
+        //:   'shrink' for pools that have and have not overflowed their
+        //:   external buffer, and that allocations from the external buffer
+        //:   remain writable.  (C-4)
+        //
+        // Testing:
+        //   void rewind(const Mark& mark);
+        //   void shrink(size_type maxIdleBytes = 0);
+        //   Mark mark() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'mark', 'rewind(mark)', AND 'shrink'"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        const bsls::Alignment::Strategy alignmentStrategy[] = {
+            bsls::Alignment::BSLS_NATURAL,
+            bsls::Alignment::BSLS_MAXIMUM,
+            bsls::Alignment::BSLS_BYTEALIGNED
+        };
+        const bsl::size_t numAlignmentStrategy = sizeof  alignmentStrategy
+                                               / sizeof *alignmentStrategy;
+
+        const bsl::size_t allocationSize[] = {
+            4, 8, 64, 100, 12, 7, 200, 1, 300, 16, 1024, 8
+        };
+        const bsl::size_t numAllocationSize = sizeof  allocationSize
+                                            / sizeof *allocationSize;
+
+        char *buffer = u::bufferStorage.buffer();
+
+        if (verbose) cout << "\nTesting 'rewind(mark)' reuse." << endl;
+
+        for (bsl::size_t ai = 0; ai < numAlignmentStrategy; ++ai) {
+            for (bsl::size_t mi = 0; mi < numAllocationSize; ++mi) {
+                bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+                Obj mX(buffer, u::k_BUFFER_SIZE, alignmentStrategy[ai], &sa);
+                const Obj& X = mX;
+
+                bsl::vector<void *> address;
+
+                const Obj::Mark outer = X.mark();
+
+                for (bsl::size_t i = 0; i < mi; ++i) {
+                    address.push_back(mX.allocate(allocationSize[i]));
+                }
+
+                const Obj::Mark inner = X.mark();
+
+                for (bsl::size_t i = mi; i < numAllocationSize; ++i) {
+                    address.push_back(mX.allocate(allocationSize[i]));
+                }
+
+                const bsls::Types::Int64 numBlocks = sa.numBlocksTotal();
+                ASSERT(0 < numBlocks);
+
+                mX.rewind(inner);
+
+                for (bsl::size_t i = mi; i < numAllocationSize; ++i) {
+                    LOOP3_ASSERT(ai, mi, i,
+                                 address[i] == mX.allocate(allocationSize[i]));
+                }
+
+                mX.rewind(inner);
+                mX.rewind(outer);
+
+                for (bsl::size_t i = 0; i < numAllocationSize; ++i) {
+                    LOOP3_ASSERT(ai, mi, i,
+                                 address[i] == mX.allocate(allocationSize[i]));
+                }
+
+                LOOP2_ASSERT(ai, mi, numBlocks == sa.numBlocksTotal());
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'shrink'." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(buffer, u::k_BUFFER_SIZE, &sa);
+
+            char *p = static_cast<char *>(mX.allocate(100));
+
+            mX.shrink();
+
+            ASSERT(0 == sa.numBlocksTotal());
+
+            const Obj::Mark mark = mX.mark();
+
+            mX.allocate(1000);
+            mX.allocate(2000);
+
+            const bsls::Types::Int64 numBlocks = sa.numBlocksInUse();
+            ASSERT(2 < numBlocks);
+
+            mX.shrink();
+
+            ASSERT(numBlocks == sa.numBlocksInUse());
+
+            mX.rewind(mark);
+            mX.shrink();
+
+            // Only the footprint of the sequential pool remains.
+
+            ASSERT(1              == sa.numBlocksInUse());
+            ASSERT(u::k_FOOTPRINT == sa.numBytesInUse());
+
+            bsl::memset(p, 0xab, 100);
+
+            ASSERT(mX.allocate(1000));
+        }
+      } break;
       case 10: {
         // --------------------------------------------------------------------
         // ALLOCATOR ACCESSOR TEST
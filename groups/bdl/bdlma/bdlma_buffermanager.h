@@ -380,6 +380,15 @@ class BufferManager {
         // of this object with no effect on the outstanding allocated memory
         // blocks.
 
+    void setCursor(bsls::Types::size_type cursor);
+        // Set the offset (in bytes) from the start of the managed buffer at
+        // which subsequent allocations are carved to the specified 'cursor'.
+        // Memory blocks allocated at or beyond 'cursor' are released (i.e.,
+        // will be reused by subsequent allocations).  The behavior is
+        // undefined unless 'cursor <= bufferSize()'.  Note that, together
+        // with 'cursor', this method allows a client to restore the state of
+        // this buffer manager to an earlier point in time.
+
     bsls::Types::size_type truncate(void                   *address,
                                     bsls::Types::size_type  originalSize,
                                     bsls::Types::size_type  newSize);
@@ -409,6 +418,11 @@ class BufferManager {
         // Return the size (in bytes) of the buffer currently managed by this
         // object, or 0 if this object currently manages no buffer.
 
+    bsls::Types::size_type cursor() const;
+        // Return the offset (in bytes) from the start of the managed buffer of
+        // the first byte not yet allocated from it, or 0 if this object
+        // currently manages no buffer.
+
     int calculateAlignmentOffsetFromSize(const void             *address,
                                          bsls::Types::size_type  size) const;
         // Return the minimum non-negative integer that, when added to the
@@ -566,6 +580,14 @@ void BufferManager::reset()
     d_cursor     = 0;
 }
 
+inline
+void BufferManager::setCursor(bsls::Types::size_type cursor)
+{
+    BSLS_ASSERT(cursor <= d_bufferSize);
+
+    d_cursor = static_cast<bsls::Types::IntPtr>(cursor);
+}
+
 // ACCESSORS
 inline
 bsls::Alignment::Strategy BufferManager::alignmentStrategy() const
@@ -588,6 +610,12 @@ bsls::Types::size_type BufferManager::bufferSize() const
     return d_bufferSize;
 }
 
+inline
+bsls::Types::size_type BufferManager::cursor() const
+{
+    return static_cast<bsls::Types::size_type>(d_cursor);
+}
+
 inline
 int BufferManager::calculateAlignmentOffsetFromSize(
                                             const void             *address,
@@ -70,17 +70,19 @@ using namespace bsl;
 // [ 4] char *replaceBuffer(char *newBuffer, int newBufferSize);
 // [ 5] void release();
 // [ 6] void reset();
+// [12] void setCursor(size_type cursor);
 // [10] int truncate(void *address, int originalSize, int newSize);
 //
 // // ACCESSORS
 // [ 2] bsls::Alignment::Strategy alignmentStrategy() const;
 // [ 2] char *buffer() const;
 // [ 2] int bufferSize() const;
+// [12] size_type cursor() const;
 // [11] int calculateAlignmentOffsetFromSize(address, size) const;
 // [ 7] bool hasSufficientCapacity(int size) const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -383,7 +385,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -414,6 +416,125 @@ int main(int argc, char *argv[])
         ASSERT(false == result);
 
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING 'cursor' AND 'setCursor'
+        //   Ensure the cursor can be observed and restored.
+        //
+        // Concerns:
+        //: 1 'cursor' returns 0 for a buffer manager managing no buffer, and
+        //:   for one whose buffer was just supplied or released.
+        //:
+        //: 2 'cursor' reflects the offset just past the most recent
+        //:   allocation, including any alignment padding.
+        //:
+        //: 3 After 'setCursor(c)', where 'c' was obtained from 'cursor',
+        //:   subsequent allocations return the same addresses as those
+        //:   originally returned after 'c' was obtained, for all alignment
+        //:   strategies.
+        //:
+        //: 4 'cursor' is declared 'const'.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 Verify 'cursor' on default-constructed, buffer-supplied, and
+        //:   released buffer managers.  (C-1, 4)
+        //:
+        //: 2 For each alignment strategy, allocate a sequence of blocks of
+        //:   varying sizes, record 'cursor' after each, and verify it against
+        //:   the address of the next allocation.  Then 'setCursor' to each
+        //:   recorded value in turn, and verify that the allocations that
+        //:   followed it are reproduced.  (C-2..3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid cursor values (using the
+        //:   'BSLS_ASSERTTEST_*' macros).  (C-5)
+        //
+        // Testing:
+        //   void setCursor(size_type cursor);
+        //   size_type cursor() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'cursor' AND 'setCursor'" << endl
+                          << "================================" << endl;
+
+        char *buffer = bufferStorage.buffer();
+
+        if (verbose) cout << "\nTesting 'cursor' on a fresh object." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == X.cursor());
+
+            mX.replaceBuffer(buffer, k_BUFFER_SIZE);
+            ASSERT(0 == X.cursor());
+
+            mX.allocate(3);
+            ASSERT(3 == X.cursor());
+
+            mX.release();
+            ASSERT(0 == X.cursor());
+        }
+
+        if (verbose) cout << "\nTesting 'setCursor'." << endl;
+
+        const bsls::Alignment::Strategy STRATEGIES[] = {
+            bsls::Alignment::BSLS_NATURAL,
+            bsls::Alignment::BSLS_MAXIMUM,
+            bsls::Alignment::BSLS_BYTEALIGNED
+        };
+        const int NUM_STRATEGIES = sizeof STRATEGIES / sizeof *STRATEGIES;
+
+        const int SIZES[]   = { 1, 3, 8, 2, 16, 5, 4, 1, 7, 24 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int i = 0; i < NUM_STRATEGIES; ++i) {
+            const bsls::Alignment::Strategy STRAT = STRATEGIES[i];
+
+            Obj mX(buffer, k_BUFFER_SIZE, STRAT);  const Obj& X = mX;
+
+            bsls::Types::size_type cursors[NUM_SIZES];
+            void                  *addresses[NUM_SIZES];
+
+            for (int j = 0; j < NUM_SIZES; ++j) {
+                cursors[j]   = X.cursor();
+                addresses[j] = mX.allocate(SIZES[j]);
+
+                LOOP2_ASSERT(i, j, addresses[j]);
+                LOOP2_ASSERT(i, j, X.cursor() ==
+                      static_cast<bsls::Types::size_type>(
+                                     static_cast<char *>(addresses[j])
+                                                        + SIZES[j] - buffer));
+            }
+
+            for (int j = NUM_SIZES - 1; 0 <= j; --j) {
+                mX.setCursor(cursors[j]);
+                LOOP2_ASSERT(i, j, cursors[j] == X.cursor());
+
+                for (int k = j; k < NUM_SIZES; ++k) {
+                    LOOP3_ASSERT(i, j, k,
+                                 addresses[k] == mX.allocate(SIZES[k]));
+                }
+                mX.setCursor(cursors[j]);
+            }
+
+            mX.setCursor(k_BUFFER_SIZE);
+            LOOP_ASSERT(i, 0 == mX.allocate(1));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(buffer, k_BUFFER_SIZE);
+
+            ASSERT_PASS(mX.setCursor(0));
+            ASSERT_PASS(mX.setCursor(k_BUFFER_SIZE));
+            ASSERT_FAIL(mX.setCursor(k_BUFFER_SIZE + 1));
+        }
+      } break;
       case 11: {
         // -------------------------------------------------------------------
         // TESTING 'calculateAlignmentOffsetFromSize'
@@ -466,6 +466,7 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_mutex.h>
 
 #include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
 #include <bsls_blockgrowth.h>
 #include <bsls_types.h>
 
@@ -713,6 +714,16 @@ class ConcurrentMultipool {
         // where 'numPools' is either specified at construction, or an
         // implementation-defined value.
 
+    int poolIndex(const void *address) const;
+        // Return the index of the internal pool that dispensed the memory
+        // block at the specified 'address', or -1 if the block is not pooled
+        // (i.e., its requested size exceeded 'maxPooledBlockSize()').  The
+        // pool having index 'i' dispenses blocks of '2^(i + 3)' bytes.  The
+        // behavior is undefined unless 'address' was allocated by this
+        // multipool object and has not already been deallocated.  Note that
+        // this method does not access any state shared between threads other
+        // than the header of the block itself.
+
 
                                   // Aspects
 
@@ -758,6 +769,14 @@ bsls::Types::size_type ConcurrentMultipool::maxPooledBlockSize() const
     return d_maxBlockSize;
 }
 
+inline
+int ConcurrentMultipool::poolIndex(const void *address) const
+{
+    BSLS_ASSERT(address);
+
+    return (static_cast<const Header *>(address) - 1)->d_header.d_poolIdx;
+}
+
 // Aspects
 
 inline
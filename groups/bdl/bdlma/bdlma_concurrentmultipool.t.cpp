@@ -65,11 +65,12 @@ using namespace bsl;  // automatically added by script
 // [ 9] void deleteObjectRaw(const TYPE *object);
 // [ 5] void release();
 // [ 6] void reserveCapacity(bsls::Types::size_type size, int numObjects);
+// [12] int poolIndex(const void *address) const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 7] CONCURRENCY TEST
 // [11] OLD USAGE EXAMPLE
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
 
 //=============================================================================
 //                    STANDARD BDE ASSERT TEST MACRO
@@ -661,7 +662,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -730,6 +731,70 @@ int main(int argc, char *argv[])
             // Now 'pM' and 'pBuf' are also invalid addresses.
         }
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING 'poolIndex'
+        //
+        // Concerns:
+        //: 1 'poolIndex' returns the index of the pool having the smallest
+        //:   block size not less than the size requested for the block.
+        //:
+        //: 2 'poolIndex' returns -1 for blocks larger than
+        //:   'maxPooledBlockSize()'.
+        //:
+        //: 3 The result does not depend on the contents of the block, or on
+        //:   allocations and deallocations of other blocks.
+        //
+        // Plan:
+        //: 1 For a multipool with several pools, allocate blocks of every
+        //:   size up to twice 'maxPooledBlockSize()', overwrite the blocks,
+        //:   and verify 'poolIndex' against the expected index.  Then
+        //:   deallocate the blocks in reverse order, checking the remaining
+        //:   blocks each time.  (C-1..3)
+        //
+        // Testing:
+        //   int poolIndex(const void *address) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'poolIndex'"
+                          << endl << "===================" << endl;
+
+        const int NUM_POOLS = 6;
+
+        Obj mX(NUM_POOLS, Z);  const Obj& X = mX;
+
+        const int MAX_SIZE = static_cast<int>(X.maxPooledBlockSize()) * 2;
+
+        bsl::vector<void *> blocks;
+        bsl::vector<int>    expected;
+
+        for (int size = 1; size <= MAX_SIZE; ++size) {
+            int index = 0;
+            while (index < NUM_POOLS && (8 << index) < size) {
+                ++index;
+            }
+            if (NUM_POOLS == index) {
+                index = -1;
+            }
+
+            void *p = mX.allocate(size);
+            bsl::memset(p, 0xff, size);
+
+            blocks.push_back(p);
+            expected.push_back(index);
+
+            LOOP_ASSERT(size, index == X.poolIndex(p));
+        }
+
+        while (!blocks.empty()) {
+            for (bsl::size_t i = 0; i < blocks.size(); i += 37) {
+                LOOP_ASSERT(i, expected[i] == X.poolIndex(blocks[i]));
+            }
+            mX.deallocate(blocks.back());
+            blocks.pop_back();
+            expected.pop_back();
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING OLD USAGE EXAMPLE
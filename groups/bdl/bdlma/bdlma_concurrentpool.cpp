@@ -13,16 +13,20 @@
 BSLS_IDENT_RCSID(bdlma_concurrentpool_cpp,"$Id$ $CSID$")
 
 #include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
 
 #include <bsls_alignmentutil.h>
+#include <bsls_atomic.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
 
 #include <bslma_testallocator.h>  // for testing purpose only
 
 #include <bsl_algorithm.h>  // for 'max()'
-#include <bsl_cstddef.h>    // for 'offsetof()'
 #include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+
+#include <new>              // placement 'new'
 
 namespace BloombergLP {
 namespace {
@@ -33,16 +37,12 @@ namespace {
 
 struct LLink {
     // This 'struct' implements a link data structure that stores the address
-    // of the next link, used to implement the internal linked list of free
+    // of the next link, used to implement the internal linked lists of free
     // memory blocks.  Note that this type is copied from
     // 'bdlma_concurrentpool.h' to provide access to this type from static
     // methods.
 
-    union {
-        bsls::AtomicOperations::AtomicTypes::Int d_refCount;
-        bsls::AlignmentUtil::MaxAlignedType      d_dummy;
-    };
-    LLink *d_next_p;
+    LLink *volatile d_next_p;
 };
 
                                 // ---------
@@ -56,6 +56,68 @@ enum {
                                // 'd_numObjects' becomes positive
 };
 
+// The head of each free list is a tagged pointer: the address of the first
+// free block, combined with a tag that is incremented each time a block is
+// removed from the list.  A thread removing a block reads the head, then the
+// link of the first block, and swaps in the second block only if the head
+// (including the tag) is unchanged.  Were the tag omitted, the swap could
+// succeed after other threads removed the first block, then the second, then
+// deallocated the first block again (the "ABA problem"), corrupting the list.
+// Note that the link of the first block may be read after another thread has
+// removed (and started using) the block; the value read is then discarded,
+// since the swap fails.  This is safe because the memory of the blocks is not
+// returned to the underlying allocator until 'release' is called.
+//
+// Where a double-width compare-and-swap is available (x86-64, using
+// 'cmpxchg16b', and 64-bit ARM, using the compiler's 16-byte '__atomic'
+// built-ins), a head is a full address and a 64-bit tag, updated together.
+// The two words are read separately, so a head may be read "torn"; the swap
+// then fails and returns the current head.  Elsewhere, a head is a single
+// 64-bit word holding the address shifted left by 'k_TAG_BITS' and the tag in
+// the low-order bits.  On 64-bit platforms this representation can hold only
+// addresses that fit in 48 bits, and its 16-bit tag wraps after 65536
+// removals.  Blocks whose addresses cannot be represented (e.g., on platforms
+// using 57-bit virtual addresses, or tagging the top byte of pointers) are
+// kept instead on a list guarded by the mutex of the pool.
+
+#if (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))     \
+ && (defined(BSLS_PLATFORM_CPU_X86_64)                                        \
+  || (defined(BSLS_PLATFORM_CPU_ARM) && defined(BSLS_PLATFORM_CPU_64_BIT)))
+#define BDLMA_CONCURRENTPOOL_DOUBLE_WIDTH_HEAD 1
+#endif
+
+#ifdef BDLMA_CONCURRENTPOOL_DOUBLE_WIDTH_HEAD
+
+struct Head {
+    // This 'struct' is the value of the head of a free list.
+
+    LLink               *d_link_p;  // first free block, or 0 if empty
+    bsls::Types::Uint64  d_tag;     // number of removals from the list
+};
+
+typedef Head HeadStorage;
+    // Alias for the object holding a head, which must be 16-byte aligned.
+
+const bsls::Types::size_type k_HEAD_ALIGNMENT = 16;
+
+#else
+
+typedef bsls::Types::Uint64 Head;
+typedef bsls::AtomicUint64  HeadStorage;
+
+#ifdef BSLS_PLATFORM_CPU_64_BIT
+const int k_TAG_BITS = 16;   // addresses must fit in 48 bits
+#else
+const int k_TAG_BITS = 32;
+#endif
+
+const bsls::Types::Uint64 k_TAG_MASK =
+                       (static_cast<bsls::Types::Uint64>(1) << k_TAG_BITS) - 1;
+
+const bsls::Types::size_type k_HEAD_ALIGNMENT = sizeof(HeadStorage);
+
+#endif
+
 }  // close unnamed namespace
 
 // implementation details of private support functions
@@ -78,34 +140,264 @@ LLink *toLink(char *address)
     return static_cast<LLink *>(static_cast<void *>(address));
 }
 
+static inline
+HeadStorage *headStorage(char *buffer)
+    // Return the address of the head held in the specified 'buffer' of a free
+    // list, which is the first suitably aligned address in 'buffer'.
+{
+    const bsls::Types::UintPtr address =
+                                reinterpret_cast<bsls::Types::UintPtr>(buffer);
+
+    return reinterpret_cast<HeadStorage *>(
+                 (address + k_HEAD_ALIGNMENT - 1) & ~(k_HEAD_ALIGNMENT - 1));
+}
+
+#ifdef BDLMA_CONCURRENTPOOL_DOUBLE_WIDTH_HEAD
+
+static inline
+bool isRepresentable(LLink *)
+    // Return 'true', as every address can be held in a head.
+{
+    return true;
+}
+
+static inline
+LLink *headLink(const Head& head)
+    // Return the address of the first block on a free list having the
+    // specified 'head'.
+{
+    return head.d_link_p;
+}
+
+static inline
+Head makeHead(LLink *link, const Head& previous, int tagIncrement)
+    // Return the head of a free list whose first block is at the specified
+    // 'link', having the tag of the specified 'previous' head plus the
+    // specified 'tagIncrement'.
+{
+    Head result = { link, previous.d_tag + tagIncrement };
+    return result;
+}
+
+static inline
+Head loadHead(HeadStorage *storage)
+    // Return the head held by the specified 'storage'.  Note that the result
+    // may be inconsistent if 'storage' is concurrently modified; such a
+    // result is corrected by the next call to 'swapHead'.
+{
+    Head result;
+    result.d_tag    = __atomic_load_n(&storage->d_tag, __ATOMIC_ACQUIRE);
+    result.d_link_p = __atomic_load_n(&storage->d_link_p, __ATOMIC_ACQUIRE);
+    return result;
+}
+
+static inline
+bool swapHead(HeadStorage *storage, Head *expected, const Head& newHead)
+    // Replace the head held by the specified 'storage' with the specified
+    // 'newHead' if it is equal to the specified 'expected' head, and return
+    // 'true'; otherwise, load the current head into 'expected', and return
+    // 'false'.  This operation has acquire-release semantics.
+{
+#if defined(BSLS_PLATFORM_CPU_X86_64)
+    // GCC emits a call to 'libatomic' for a 16-byte '__atomic' operation on
+    // x86-64 (where 'cmpxchg16b' is an optional instruction), so the
+    // instruction is used directly.
+
+    bool result;
+    __asm__ __volatile__("lock; cmpxchg16b %1\n\t"
+                         "sete %0"
+                         : "=q"(result),
+                           "+m"(*storage),
+                           "+a"(expected->d_link_p),
+                           "+d"(expected->d_tag)
+                         : "b"(newHead.d_link_p),
+                           "c"(newHead.d_tag)
+                         : "cc", "memory");
+    return result;
+#else
+    // A 'Head' is only 8-byte aligned, so the swap operates on the 16-byte
+    // integer overlaying the (16-byte aligned) 'storage'.
+
+    typedef unsigned __int128 Word;
+
+    Word expectedWord;
+    Word newWord;
+    bsl::memcpy(&expectedWord, expected, sizeof expectedWord);
+    bsl::memcpy(&newWord, &newHead, sizeof newWord);
+
+    const bool result = __atomic_compare_exchange_n(
+                                          reinterpret_cast<Word *>(storage),
+                                          &expectedWord,
+                                          newWord,
+                                          false,
+                                          __ATOMIC_ACQ_REL,
+                                          __ATOMIC_ACQUIRE);
+    if (!result) {
+        bsl::memcpy(expected, &expectedWord, sizeof expectedWord);
+    }
+    return result;
+#endif
+}
+
+#else
+
+static inline
+bool isRepresentable(LLink *link)
+    // Return 'true' if the specified 'link' can be held in a head, and
+    // 'false' otherwise.
+{
+    const bsls::Types::Uint64 address = static_cast<bsls::Types::Uint64>(
+                                 reinterpret_cast<bsls::Types::UintPtr>(link));
+
+    return 0 == (address >> (64 - k_TAG_BITS));
+}
+
+static inline
+LLink *headLink(Head head)
+    // Return the address of the first block on a free list having the
+    // specified 'head'.
+{
+    return reinterpret_cast<LLink *>(
+                       static_cast<bsls::Types::UintPtr>(head >> k_TAG_BITS));
+}
+
+static inline
+Head makeHead(LLink *link, Head previous, int tagIncrement)
+    // Return the head of a free list whose first block is at the specified
+    // 'link', having the tag of the specified 'previous' head plus the
+    // specified 'tagIncrement'.  The behavior is undefined unless
+    // 'isRepresentable(link)'.
+{
+    return (static_cast<bsls::Types::Uint64>(
+                                 reinterpret_cast<bsls::Types::UintPtr>(link))
+                                                                 << k_TAG_BITS)
+         | ((previous + tagIncrement) & k_TAG_MASK);
+}
+
+static inline
+Head loadHead(HeadStorage *storage)
+    // Return the head held by the specified 'storage'.
+{
+    return storage->loadAcquire();
+}
+
+static inline
+bool swapHead(HeadStorage *storage, Head *expected, const Head& newHead)
+    // Replace the head held by the specified 'storage' with the specified
+    // 'newHead' if it is equal to the specified 'expected' head, and return
+    // 'true'; otherwise, load the current head into 'expected', and return
+    // 'false'.  This operation has acquire-release semantics.
+{
+    const Head oldHead = storage->testAndSwapAcqRel(*expected, newHead);
+    if (oldHead == *expected) {
+        return true;                                                  // RETURN
+    }
+    *expected = oldHead;
+    return false;
+}
+
+#endif
+
 // private support functions
 
+static inline
+int homeFreeList(int numFreeLists)
+    // Return the index of the free list used by the calling thread, given
+    // the specified 'numFreeLists'.  The behavior is undefined unless
+    // 'numFreeLists' is a power of 2.
+{
+    // Thread ids are typically addresses aligned on large boundaries; use the
+    // high-order bits of a multiplicative hash.
+
+    const bsls::Types::Uint64 hash = bslmt::ThreadUtil::selfIdAsUint64()
+                                   * 0x9E3779B97F4A7C15ULL;
+
+    return static_cast<int>(hash >> 32) & (numFreeLists - 1);
+}
+
 static inline
 bsls::Types::size_type computeInternalBlockSize(
                                               bsls::Types::size_type blockSize)
     // Return the number of bytes that must be allocated to provide an aligned
     // block of memory of the specified 'blockSize' that can also be used to
-    // represent a 'object' 'LLink' (on the 'bdlma::ConcurrentPool' objects
-    // free list).  Note that this value is the maximum of either the size of a
-    // 'LLink' object or 'blockSize' rounded up to the alignment required for a
-    // 'LLink' object (i.e., the maximum platform alignment).
+    // represent a 'LLink' object (on the 'bdlma::ConcurrentPool' objects free
+    // lists).  Note that this value is the maximum of either the size of a
+    // 'LLink' object or 'blockSize', rounded up to the maximum platform
+    // alignment.
 {
-    const bsls::Types::size_type HEADER_LENGTH  = offsetof(LLink, d_next_p);
-    const bsls::Types::size_type MINIMUM_LENGTH = sizeof(LLink);
-
-    return roundUp(bsl::max(blockSize + HEADER_LENGTH, MINIMUM_LENGTH),
+    return roundUp(bsl::max(blockSize, sizeof(LLink)),
                    bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
 }
 
 static
-void replenishImp(bsls::AtomicPointer<LLink>       *nextList,
+void pushList(HeadStorage *freeList, LLink *first, LLink *last)
+    // Prepend to the specified 'freeList' the blocks linked from the specified
+    // 'first' to the specified 'last' block.  The behavior is undefined unless
+    // 'isRepresentable(first)'.  Note that adding blocks to a free list does
+    // not change the tag of its head.
+{
+    Head head = loadHead(freeList);
+    for (;;) {
+        last->d_next_p = headLink(head);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                        swapHead(freeList, &head, makeHead(first, head, 0)))) {
+            return;                                                   // RETURN
+        }
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    }
+}
+
+static
+LLink *popList(HeadStorage *freeList)
+    // Remove the first block of the specified 'freeList' and return its
+    // address, or return 0 if 'freeList' is empty.
+{
+    Head head = loadHead(freeList);
+    for (;;) {
+        LLink *link = headLink(head);
+        if (!link) {
+            return 0;                                                 // RETURN
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+               swapHead(freeList, &head, makeHead(link->d_next_p, head, 1)))) {
+            return link;                                              // RETURN
+        }
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    }
+}
+
+static
+LLink *popAll(HeadStorage *freeList)
+    // Remove all blocks from the specified 'freeList' and return the address
+    // of the first one, or 0 if 'freeList' is empty.
+{
+    Head head = loadHead(freeList);
+    for (;;) {
+        LLink *link = headLink(head);
+        if (!link) {
+            return 0;                                                 // RETURN
+        }
+
+        if (swapHead(freeList, &head, makeHead(0, head, 1))) {
+            return link;                                              // RETURN
+        }
+    }
+}
+
+static
+void replenishImp(HeadStorage                      *freeList,
+                  LLink                           **lockedFreeList,
                   bdlma::InfrequentDeleteBlockList *blockList,
                   bsls::Types::size_type            blockSize,
                   int                               numBlocks)
-    // Append to the specified 'nextList', 'numBlocks' free memory blocks each
+    // Append to the specified 'freeList', 'numBlocks' free memory blocks each
     // having the specified 'blockSize', using memory provided by the specified
-    // 'blockList'.  The behavior is undefined unless '1 <= blockSize' and
-    // '1 <= numBlocks'.
+    // 'blockList', or append them to the specified 'lockedFreeList' if their
+    // addresses cannot be held in the head of 'freeList'.  The behavior is
+    // undefined unless '1 <= blockSize', '1 <= numBlocks', and the calling
+    // thread has a lock on the mutex guarding 'lockedFreeList'.
 {
     using namespace BloombergLP;
 
@@ -116,30 +408,56 @@ void replenishImp(bsls::AtomicPointer<LLink>       *nextList,
     char  *start = static_cast<char *>(
                                   blockList->allocate(numBlocks * blockSize));
     char  *end   = start + (numBlocks - 1) * blockSize;
+
     for (char *p = start; p < end; p += blockSize) {
-        LLink *nextLink = toLink(p);
-        bsls::AtomicOperations::initInt(&nextLink->d_refCount, 0 );
-        nextLink->d_next_p = toLink(p + blockSize);
+        toLink(p)->d_next_p = toLink(p + blockSize);
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(isRepresentable(toLink(end)))) {
+        pushList(freeList, toLink(start), toLink(end));
     }
-    bsls::AtomicOperations::initInt(&toLink(end)->d_refCount, 0 );
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
-    LLink *old;
-    do {
-        old                   = *nextList;
-        toLink(end)->d_next_p = old;
-    } while (old != nextList->testAndSwap(old, toLink(start)));
+        toLink(end)->d_next_p = *lockedFreeList;
+        *lockedFreeList       = toLink(start);
+    }
 }
 
 namespace bdlma {
 
+                     // -------------------------------
+                     // struct ConcurrentPool::FreeList
+                     // -------------------------------
+
+// CREATORS
+ConcurrentPool::FreeList::FreeList()
+{
+    ::new (headStorage(d_buffer)) HeadStorage();
+}
+
                            // --------------------
                            // class ConcurrentPool
                            // --------------------
 
 // PRIVATE MANIPULATORS
-void ConcurrentPool::replenish()
+ConcurrentPool::Link *ConcurrentPool::allocateFromFreeLists(int home)
 {
-    replenishImp(reinterpret_cast<bsls::AtomicPointer<LLink> *>(&d_freeList),
+    for (int i = 0; i < k_NUM_FREE_LISTS; ++i) {
+        LLink *link = popList(headStorage(
+                 d_freeLists[(home + i) & (k_NUM_FREE_LISTS - 1)].d_buffer));
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != link)) {
+            return reinterpret_cast<Link *>(link);                    // RETURN
+        }
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    }
+    return 0;
+}
+
+void ConcurrentPool::replenish(int home)
+{
+    replenishImp(headStorage(d_freeLists[home].d_buffer),
+                 reinterpret_cast<LLink **>(&d_lockedFreeList_p),
                  &d_blockList,
                  d_internalBlockSize,
                  d_chunkSize);
@@ -163,7 +481,7 @@ ConcurrentPool::ConcurrentPool(bsls::Types::size_type  blockSize,
 , d_chunkSize(k_INITIAL_CHUNK_SIZE)
 , d_maxBlocksPerChunk(k_MAX_CHUNK_SIZE)
 , d_growthStrategy(bsls::BlockGrowth::BSLS_GEOMETRIC)
-, d_freeList(0)
+, d_lockedFreeList_p(0)
 , d_blockList(basicAllocator)
 {
     BSLS_ASSERT(1 <= blockSize);
@@ -179,7 +497,7 @@ ConcurrentPool::ConcurrentPool(bsls::Types::size_type       blockSize,
               ? k_MAX_CHUNK_SIZE : k_INITIAL_CHUNK_SIZE)
 , d_maxBlocksPerChunk(k_MAX_CHUNK_SIZE)
 , d_growthStrategy(growthStrategy)
-, d_freeList(0)
+, d_lockedFreeList_p(0)
 , d_blockList(basicAllocator)
 {
     BSLS_ASSERT(1 <= blockSize);
@@ -196,7 +514,7 @@ ConcurrentPool::ConcurrentPool(bsls::Types::size_type       blockSize,
               ? maxBlocksPerChunk : k_INITIAL_CHUNK_SIZE)
 , d_maxBlocksPerChunk(maxBlocksPerChunk)
 , d_growthStrategy(growthStrategy)
-, d_freeList(0)
+, d_lockedFreeList_p(0)
 , d_blockList(basicAllocator)
 {
     BSLS_ASSERT(1 <= blockSize);
@@ -214,133 +532,70 @@ ConcurrentPool::~ConcurrentPool()
 // MANIPULATORS
 void *ConcurrentPool::allocate()
 {
-    Link *p;
-    for (;;) {
-        p = d_freeList.loadRelaxed();
-        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!p)) {
-            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-            p = d_freeList;
-            if (!p) {
-                replenish();
-                continue;
-            }
-        }
-
-        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY
-                  (2 != bsls::AtomicOperations::addIntNv(&p->d_refCount, 2))) {
-            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-            for (int i = 0; i < 3; ++i) {
-                // To avoid unnecessary contention, assume that if we did not
-                // get the first reference, then the other thread is about to
-                // complete the pop.  Wait for a few cycles until he does.  If
-                // he does not complete then go on and try to acquire it
-                // ourselves.
-
-                if (d_freeList.loadRelaxed() != p) {
-                    break;
-                }
-            }
-        }
+    const int home = homeFreeList(k_NUM_FREE_LISTS);
 
-        // Force a dependent read of 'd_next_p' to make sure that we're not
-        // racing against another thread calling 'deallocate' for 'p' and that
-        // checked the refcount *before* we incremented it, put back 'p' in the
-        // freelist with a potentially different 'd_next_p'.
-        //
-        // There are two possibilities in this particular case:
-        //   - The following 'loadRelaxed()' will return the new 'freelist'
-        //     value (== p) and because of the release barrier before the last
-        //     CAS in deallocate, we can observe the new 'd_next_p' value (this
-        //     relies on dependent load ordering)
-        //   - loadRelaxed() will return the "old" (!= p) and the CAS and thus
-        //     the condition will be false.
-        //
-        // Note that 'h' is made volatile so that the compiler does not replace
-        // the 'h->d_inUse' load with 'p->d_inUse' (and thus removing the data
-        // dependency).  TBD to be completely thorough 'h->d_next_p' needs a
-        // load dependent barrier (no-op on all current architectures though).
-
-        const Link * volatile h = d_freeList.loadRelaxed();
-
-        // gcc 4.3, 4.4 seems to have trouble processing likely(a && b), using
-        // likely(a) && likely(b) fixes the problem.  3.4.6 seems to generate
-        // the proper code though.
-
-        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(h == p)
-         && BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
-                                d_freeList.testAndSwap(p, h->d_next_p) == p)) {
-            break;
-        }
+    Link *p = allocateFromFreeLists(home);
 
+    while (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!p)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        for (;;) {
-            int refCount = bsls::AtomicOperations::getInt(&p->d_refCount);
-
-            if (refCount & 1) {
-                if (refCount ==
-                        bsls::AtomicOperations::testAndSwapInt(
-                            &p->d_refCount,
-                            refCount,
-                            refCount^1)) {
-                    // The node is now free but not on the free list.  Try to
-                    // take it.
-
-                    return static_cast<void *>(const_cast<Link **>(
-                                                      &p->d_next_p)); // RETURN
-                }
+
+        // All of the free lists are empty.  Serialize the growth of the block
+        // list, and replenish only if no other thread did so while this
+        // thread was waiting for the mutex.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        p = allocateFromFreeLists(home);
+        if (!p) {
+            if (d_lockedFreeList_p) {
+                p                  = d_lockedFreeList_p;
+                d_lockedFreeList_p = p->d_next_p;
             }
-            else if (refCount ==
-                        bsls::AtomicOperations::testAndSwapInt(
-                            &p->d_refCount,
-                            refCount,
-                            refCount - 2)) {
-                break;
+            else {
+                // Note that the new chunk is placed on the locked free list
+                // if its addresses cannot be held in a free list head.
+
+                replenish(home);
+                p = allocateFromFreeLists(home);
             }
         }
     }
 
-    return static_cast<void *>(const_cast<Link **>(&p->d_next_p));
+    return p;
 }
 
 void ConcurrentPool::deallocate(void *address)
 {
-    Link *p = static_cast<Link *>(static_cast<void *>(
-                     static_cast<char *>(address) - offsetof(Link, d_next_p)));
-    int refCount = bsls::AtomicOperations::getIntRelaxed(&p->d_refCount);
-    for (;;) {
-        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
-            refCount = bsls::AtomicOperations::testAndSwapInt(&p->d_refCount,
-                                                              2,
-                                                              0);
-            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
-                break;
-            }
-        }
+    BSLS_ASSERT(address);
+
+    LLink *link = static_cast<LLink *>(address);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isRepresentable(link))) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
-        const int oldRefCount = refCount;
-        refCount = bsls::AtomicOperations::testAndSwapInt(&p->d_refCount,
-                                                          refCount,
-                                                          refCount - 1);
-        if (oldRefCount == refCount) {
-            // Someone else is still trying to pop this item.  Just let them
-            // have it.
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
 
-            return;                                                   // RETURN
-        }
+        Link *lockedLink = static_cast<Link *>(address);
+
+        lockedLink->d_next_p = d_lockedFreeList_p;
+        d_lockedFreeList_p   = lockedLink;
+        return;                                                       // RETURN
     }
 
-    Link *old = d_freeList.loadRelaxed();
-    for (;;) {
-        p->d_next_p = old;
-        const Link * const swap = old;
-        old = d_freeList.testAndSwap(old, p);  // release
-        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(swap == old)) {
-            break;
-        }
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    pushList(headStorage(d_freeLists[homeFreeList(k_NUM_FREE_LISTS)].d_buffer),
+             link,
+             link);
+}
+
+void ConcurrentPool::release()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    for (int i = 0; i < k_NUM_FREE_LISTS; ++i) {
+        popAll(headStorage(d_freeLists[i].d_buffer));
     }
+    d_lockedFreeList_p = 0;
+    d_blockList.release();
 }
 
 void ConcurrentPool::reserveCapacity(int numBlocks)
@@ -349,36 +604,46 @@ void ConcurrentPool::reserveCapacity(int numBlocks)
 
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
 
-    Link *list = d_freeList.swap(0);
-    Link *last = list;
+    // Count the free blocks by detaching each free list in turn, then
+    // returning it to the free list of the calling thread.
+
+    const int home = homeFreeList(k_NUM_FREE_LISTS);
 
-    while (last) {
+    for (const Link *link = d_lockedFreeList_p;
+         link && 0 < numBlocks;
+         link = link->d_next_p) {
         --numBlocks;
-        if (!last->d_next_p) break;
-        last = last->d_next_p;
     }
 
-    if (last) {
-        Link *old;
+    for (int i = 0; i < k_NUM_FREE_LISTS && 0 < numBlocks; ++i) {
+        LLink *list = popAll(headStorage(d_freeLists[i].d_buffer));
+        LLink *last = list;
 
-        do {
-            old = d_freeList;
-            last->d_next_p = old;
-        } while (old != d_freeList.testAndSwap(old, list));
+        while (last) {
+            --numBlocks;
+            if (!last->d_next_p) break;
+            last = last->d_next_p;
+        }
+
+        if (list) {
+            pushList(headStorage(d_freeLists[home].d_buffer), list, last);
+        }
     }
 
     if (numBlocks > 0) {
-        replenishImp(
-                   reinterpret_cast<bsls::AtomicPointer<LLink> *>(&d_freeList),
-                   &d_blockList,
-                   d_internalBlockSize,
-                   numBlocks);
+        replenishImp(headStorage(d_freeLists[home].d_buffer),
+                     reinterpret_cast<LLink **>(&d_lockedFreeList_p),
+                     &d_blockList,
+                     d_internalBlockSize,
+                     numBlocks);
     }
 }
 }  // close package namespace
 
 }  // close enterprise namespace
 
+#undef BDLMA_CONCURRENTPOOL_DOUBLE_WIDTH_HEAD
+
 // ----------------------------------------------------------------------------
 // Copyright 2016 Bloomberg Finance L.P.
 //
@@ -82,6 +82,36 @@ BSLS_IDENT("$Id: $")
 // currently installed default allocator at the time the
 // 'bdlma::ConcurrentPool' was created.
 //
+///Free Lists and Thread Safety
+///----------------------------
+// A 'bdlma::ConcurrentPool' is fully thread-safe.  To limit contention
+// between threads, free blocks are kept on several lock-free free lists
+// rather than on one: each thread allocates from, and deallocates to, the
+// free list selected by a hash of its thread id, and takes blocks from the
+// other free lists only when its own is empty.  A single thread therefore
+// always reuses the block it most recently deallocated first.  The head of
+// each free list is a tagged pointer -- the address of the first free block,
+// combined with a count of the removals from the list -- that is updated with
+// a single compare-and-swap, which makes the free lists immune to the ABA
+// problem without requiring a reference count in each block.
+//
+// On x86-64 and 64-bit ARM platforms (using GCC or Clang), a head holds a full
+// address and a 64-bit count, updated with a double-width (128-bit)
+// compare-and-swap.  On other platforms, a head is a single 64-bit word.  On
+// 32-bit platforms it holds a full address and a 32-bit count.  On the
+// remaining 64-bit platforms (e.g., using other compilers) it can hold only
+// addresses that fit in 48 bits, together with a 16-bit count that wraps
+// after 65536 removals from a list (which weakens, but does not remove, the
+// protection against the ABA problem).  On those platforms, blocks whose
+// addresses do not fit (e.g., with 57-bit virtual addresses, or with tagged
+// pointers) are kept on a free list guarded by a mutex instead, so that
+// allocating and deallocating them is correct, but not lock-free.
+//
+// Neither 'allocate' nor 'deallocate' acquires a mutex, except when all of
+// the free lists are empty and the pool must be replenished with a new chunk,
+// or when the address of a block cannot be held in a lock-free list head (see
+// above); 'release' and 'reserveCapacity' acquire the same mutex.
+//
 ///Overloaded Global Operator 'new'
 ///--------------------------------
 // This component overloads the global 'operator new' to allow convenient
@@ -293,17 +323,35 @@ class ConcurrentPool {
     struct Link {
         // This 'struct' implements a link data structure that stores the
         // address of the next link, and is used to implement the internal
-        // linked list of free memory blocks.  Note that this type is
+        // linked lists of free memory blocks.  Note that this type is
         // replicated in 'bdlma_concurrentpool.cpp' to provide access to a
-        // compatible type from static methods defined in 'bdema_pool.cpp'.
+        // compatible type from static methods defined in
+        // 'bdlma_concurrentpool.cpp'.
 
-        union {
-            bsls::AtomicOperations::AtomicTypes::Int d_refCount;
-            bsls::AlignmentUtil::MaxAlignedType      d_dummy;
-        };
         Link  *volatile d_next_p;   // pointer to next link
     };
 
+    enum {
+        k_NUM_FREE_LISTS = 8,   // number of free lists (a power of 2)
+
+        k_CACHE_LINE_SIZE = 64  // assumed size of a cache line
+    };
+
+    struct FreeList {
+        // This 'struct' holds the head of one lock-free linked list of free
+        // memory blocks, padded so that distinct free lists do not share a
+        // cache line.  The head is a tagged pointer, held at the first
+        // suitably aligned address in 'd_buffer' (see the implementation in
+        // 'bdlma_concurrentpool.cpp').
+
+        char d_buffer[k_CACHE_LINE_SIZE];  // holds the tagged address of the
+                                           // first free block
+
+        // CREATORS
+        FreeList();
+            // Create an empty free list.
+    };
+
     // DATA
     bsls::Types::size_type d_blockSize;  // size of each allocated memory block
                                          // returned to client
@@ -323,20 +371,33 @@ class ConcurrentPool {
     bsls::BlockGrowth::Strategy d_growthStrategy;
                                          // growth strategy of the chunk size
 
-    bsls::AtomicPointer<Link> d_freeList;
-                                         // linked list of free memory blocks
+    FreeList          d_freeLists[k_NUM_FREE_LISTS];
+                                         // lock-free linked lists of free
+                                         // memory blocks
+
+    Link             *d_lockedFreeList_p;
+                                         // free memory blocks whose addresses
+                                         // cannot be held in the head of a
+                                         // lock-free list (guarded by
+                                         // 'd_mutex')
 
     bdlma::InfrequentDeleteBlockList d_blockList;
                                          // memory manager for allocated memory
 
     bslmt::Mutex      d_mutex;           // protects access to the block list
+                                         // and 'd_lockedFreeList_p'
 
     // PRIVATE MANIPULATORS
-    void replenish();
+    Link *allocateFromFreeLists(int home);
+        // Remove a block from the free lists of this pool, trying the free
+        // list at the specified 'home' index first, and return its address,
+        // or 0 if all of the free lists are empty.
+
+    void replenish(int home);
         // Dynamically allocate a new chunk using the pool's underlying growth
-        // strategy, and use the chunk to replenish the free memory list of
-        // this pool.  The behavior is undefined unless the calling thread has
-        // a lock on 'd_mutex'.
+        // strategy, and use the chunk to replenish the free list at the
+        // specified 'home' index of this pool.  The behavior is undefined
+        // unless the calling thread has a lock on 'd_mutex'.
 
   private:
     // NOT IMPLEMENTED
@@ -522,15 +583,6 @@ void ConcurrentPool::deleteObjectRaw(const TYPE *object)
     bslma::DeleterHelper::deleteObjectRaw(object, this);
 }
 
-inline
-void ConcurrentPool::release()
-{
-    d_mutex.lock();
-    d_freeList = (Link*)0;
-    d_blockList.release();
-    d_mutex.unlock();
-}
-
 // ACCESSORS
 inline
 bsls::Types::size_type ConcurrentPool::blockSize() const
@@ -12,6 +12,7 @@
 #include <bdlf_bind.h>
 
 #include <bdlma_infrequentdeleteblocklist.h>
+#include <bdlma_pool.h>
 
 #include <bslim_testutil.h>
 
@@ -19,11 +20,16 @@
 #include <bslma_testallocatorexception.h>
 
 #include <bslmt_barrier.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
 #include <bslmt_qlock.h>
 #include <bslmt_threadgroup.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
 #include <bslmt_threadutil.h>
 
 #include <bsls_alignmentutil.h>
+#include <bsls_atomic.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
@@ -81,7 +87,8 @@ using namespace bsl;  // automatically added by script
 // [ 9] template<typename TYPE> void deleteObject(TYPE *object)
 // [13] bslma::Allocator *allocator() const;
 //-----------------------------------------------------------------------------
-// [17] USAGE EXAMPLE
+// [18] USAGE EXAMPLE
+// [17] CROSS-THREAD DEALLOCATION
 // [16] ORIGINAL USAGE EXAMPLE
 // [15] PERFORMANCE TEST
 // [14] CONCURRENCY TEST
@@ -89,6 +96,7 @@ using namespace bsl;  // automatically added by script
 // [ 1] int poolObjectSize(size);
 // [-1] MEMORY EXHAUSTION TEST
 // [-2] BENCHMARK
+// [-3] CONTENTION BENCHMARK
 
 //=============================================================================
 //                    STANDARD BDE ASSERT TEST MACRO
@@ -192,10 +200,6 @@ struct MostDerived : LeftChild, MiddleChild, RightChild {
 struct LLink {
     // Note that this type is copied from 'bdlma_concurrentpool.h'.
 
-    union {
-        bsls::AtomicOperations::AtomicTypes::Int               d_refCount;
-        bsls::AlignmentUtil::MaxAlignedType d_dummy;
-    };
     LLink *d_next_p;
 };
 
@@ -227,9 +231,8 @@ inline static int poolObjectSize(int size)
     // Return the actual object size used by the pool when given the specified
     // 'size'.
 {
-    const int HEADER_SIZE = offsetof(LLink, d_next_p);
-    return roundUp(size + HEADER_SIZE < (int)sizeof(LLink)
-                        ? static_cast<int>(sizeof(LLink)) : size + HEADER_SIZE,
+    return roundUp(size < (int)sizeof(LLink)
+                        ? static_cast<int>(sizeof(LLink)) : size,
                    bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
 }
 
@@ -611,6 +614,58 @@ void *workerThread(void *arg) {
     return arg;
 }
 
+//=============================================================================
+//                  HELPER FUNCTIONS FOR CROSS-THREAD TEST
+//-----------------------------------------------------------------------------
+
+namespace crossThread {
+
+typedef bsls::Types::Uint64 Stamp;
+
+enum {
+    k_NUM_THREADS    = 8,
+    k_NUM_SLOTS      = 16,
+    k_NUM_WORDS      = 4,
+    k_NUM_ITERATIONS = 100000
+};
+
+struct Control {
+    Obj                        *d_pool_p;              // pool under test
+    bsls::AtomicPointer<Stamp>  d_slots[k_NUM_SLOTS];  // blocks in use
+};
+
+void churn(Control *control, int threadIndex)
+    // Repeatedly allocate a block from the pool of the specified 'control',
+    // stamp it with a value unique to the specified 'threadIndex' and the
+    // iteration, and exchange it with the block in a pseudo-randomly chosen
+    // slot of 'control'; verify, then deallocate, the block previously in the
+    // slot.
+{
+    unsigned int state = threadIndex + 1;
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        Stamp *block = static_cast<Stamp *>(control->d_pool_p->allocate());
+
+        const Stamp STAMP = (static_cast<Stamp>(threadIndex) << 32) | i;
+        for (int w = 0; w < k_NUM_WORDS; ++w) {
+            block[w] = STAMP;
+        }
+
+        state = state * 1103515245 + 12345;
+
+        Stamp *old = control->d_slots[(state >> 16) % k_NUM_SLOTS].swap(block);
+
+        if (old) {
+            for (int w = 1; w < k_NUM_WORDS; ++w) {
+                ASSERTV(threadIndex, i, w, old[0] == old[w]);
+            }
+            control->d_pool_p->deallocate(old);
+        }
+    }
+}
+
+}  // close namespace crossThread
+
 //=============================================================================
 //                              BENCHMARKS
 //-----------------------------------------------------------------------------
@@ -678,6 +733,61 @@ void runtest(int numIterations, int numObjects, int numThreads)
 }
 }  // close namespace bench
 
+namespace contention {
+
+enum { k_BATCH_SIZE = 4 };
+
+bdlma::ConcurrentPool *s_pool_p;   // pool under test
+bdlma::Pool           *s_lockedPool_p;
+                                   // baseline pool, protected by 's_mutex'
+bslmt::Mutex           s_mutex;
+
+void allocateBatch(int)
+    // Allocate, then deallocate, a batch of 'k_BATCH_SIZE' blocks from
+    // 's_pool_p'.
+{
+    void *blocks[k_BATCH_SIZE];
+    for (int i = 0; i < k_BATCH_SIZE; ++i) {
+        blocks[i] = s_pool_p->allocate();
+    }
+    for (int i = 0; i < k_BATCH_SIZE; ++i) {
+        s_pool_p->deallocate(blocks[i]);
+    }
+}
+
+void allocateBatchLocked(int)
+    // Allocate, then deallocate, a batch of 'k_BATCH_SIZE' blocks from
+    // 's_lockedPool_p', acquiring 's_mutex' for each operation.
+{
+    void *blocks[k_BATCH_SIZE];
+    for (int i = 0; i < k_BATCH_SIZE; ++i) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&s_mutex);
+        blocks[i] = s_lockedPool_p->allocate();
+    }
+    for (int i = 0; i < k_BATCH_SIZE; ++i) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&s_mutex);
+        s_lockedPool_p->deallocate(blocks[i]);
+    }
+}
+
+double run(void (*function)(int), int numThreads, int workLoad)
+    // Return the median throughput, in calls per second, of the specified
+    // 'function' called by the specified 'numThreads' threads, with the
+    // specified 'workLoad' between calls.
+{
+    bslmt::ThroughputBenchmark bench;
+    const int group = bench.addThreadGroup(function, numThreads, workLoad);
+
+    bslmt::ThroughputBenchmarkResult result;
+    bench.execute(&result, 200, 5);
+
+    double median;
+    result.getMedian(&median, group);
+    return median;
+}
+
+}  // close namespace contention
+
 //=============================================================================
 //                                MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -695,7 +805,7 @@ int main(int argc, char *argv[]) {
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 17: {
+      case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Make sure main usage example compiles and works.
@@ -729,6 +839,81 @@ int main(int argc, char *argv[]) {
         array.removeAll();
         ASSERT(0 == array.length());
       } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // CROSS-THREAD DEALLOCATION
+        //
+        // Concerns:
+        //: 1 A block is never dispensed to more than one client at a time,
+        //:   even when blocks are allocated by one thread and deallocated by
+        //:   another, so that a block is removed from and added to the free
+        //:   lists by different threads concurrently (the conditions under
+        //:   which an unprotected lock-free list suffers from the ABA
+        //:   problem).
+        //:
+        //: 2 Blocks deallocated by any thread are reused.
+        //
+        // Plan:
+        //: 1 Have several threads repeatedly allocate a block, stamp its
+        //:   every word with a unique value, and exchange it with a block in a
+        //:   randomly chosen slot of an array shared by all threads.  Before
+        //:   deallocating the block taken from the slot, verify that its stamp
+        //:   is intact.  (C-1)
+        //:
+        //: 2 Verify that the memory allocated from the underlying allocator is
+        //:   bounded by the number of blocks that can be in use at once.
+        //:   (C-2)
+        //
+        // Testing:
+        //   CROSS-THREAD DEALLOCATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CROSS-THREAD DEALLOCATION" << endl
+                                  << "=========================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mX(sizeof(crossThread::Stamp) * crossThread::k_NUM_WORDS,
+                   &ta);
+
+            crossThread::Control control;
+            control.d_pool_p = &mX;
+
+            bslmt::ThreadGroup tg;
+            for (int i = 0; i < crossThread::k_NUM_THREADS; ++i) {
+                tg.addThread(bdlf::BindUtil::bind(&crossThread::churn,
+                                                  &control,
+                                                  i));
+            }
+            tg.joinAll();
+
+            for (int i = 0; i < crossThread::k_NUM_SLOTS; ++i) {
+                crossThread::Stamp *block = control.d_slots[i].load();
+                if (block) {
+                    mX.deallocate(block);
+                }
+            }
+
+            // Without reuse, 'k_NUM_THREADS * k_NUM_ITERATIONS' blocks would
+            // be allocated.  At most one block per slot, plus two per thread,
+            // are in use at any time; allow for a few extra chunks of (at
+            // most) 32 blocks replenished while other threads were returning
+            // blocks.
+
+            const bsls::Types::Int64 MAX_BLOCKS =
+                                           crossThread::k_NUM_SLOTS
+                                         + crossThread::k_NUM_THREADS * 2
+                                         + crossThread::k_NUM_THREADS * 32;
+
+            if (veryVerbose) { P_(ta.numBytesInUse()) P(MAX_BLOCKS) }
+
+            ASSERTV(ta.numBytesInUse(),
+                    ta.numBytesInUse() <
+                           MAX_BLOCKS * 2 * static_cast<bsls::Types::Int64>(
+                                                             mX.blockSize()));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // ORIGINAL USAGE EXAMPLE
@@ -1851,6 +2036,48 @@ int main(int argc, char *argv[]) {
         bench::runtest(numIterations, numObjects, numThreads);
 
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // CONTENTION BENCHMARK
+        //   Measure the throughput of 'allocate' and 'deallocate' as the
+        //   number of threads increases, and compare it with that of a
+        //   'bdlma::Pool' protected by a mutex.  Optionally specify the
+        //   maximum number of threads (default 64) and the work load between
+        //   calls (default 100) as the second and third arguments.
+        //
+        // Testing:
+        //   CONTENTION BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONTENTION BENCHMARK" << endl
+                          << "====================" << endl;
+
+        const int maxThreads = argc > 2 ? atoi(argv[2]) : 64;
+        const int workLoad   = argc > 3 ? atoi(argv[3]) : 100;
+
+        bdlma::ConcurrentPool pool(64);
+        bdlma::Pool           lockedPool(64);
+
+        contention::s_pool_p       = &pool;
+        contention::s_lockedPool_p = &lockedPool;
+
+        cout << "threads, ConcurrentPool (batches/s), "
+             << "Pool + Mutex (batches/s)" << endl;
+
+        for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+            const double lockFree = contention::run(
+                                                  &contention::allocateBatch,
+                                                  numThreads,
+                                                  workLoad);
+            const double locked   = contention::run(
+                                            &contention::allocateBatchLocked,
+                                            numThreads,
+                                            workLoad);
+
+            cout << numThreads << ", " << lockFree << ", " << locked << endl;
+        }
+      } break;
 
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
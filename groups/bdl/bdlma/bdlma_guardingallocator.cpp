@@ -4,17 +4,26 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlma_guardingallocator_cpp,"$Id$ $CSID$")
 
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+
 #include <bslmf_assert.h>
 
+#include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
+
 #include <bsls_alignmentutil.h>
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
+#include <bsls_atomicoperations.h>
 #include <bsls_exceptionutil.h>      // 'BSLS_THROW'
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
+#include <bsls_stackaddressutil.h>
 #include <bsls_types.h>
 
 #include <bsl_cstddef.h>             // 'bsl::size_t'
+#include <bsl_cstdio.h>              // 'bsl::fputs'
 #include <bsl_new.h>                 // 'bsl::bad_alloc'
 
 #ifdef BSLS_PLATFORM_OS_WINDOWS
@@ -24,13 +33,64 @@ BSLS_IDENT_RCSID(bdlma_guardingallocator_cpp,"$Id$ $CSID$")
 #else
 
 #include <errno.h>     // 'errno'
+#include <signal.h>    // 'sigaction'
 #include <string.h>    // 'strerror'
 #include <sys/mman.h>  // 'mmap', 'mprotect', 'munmap'
-#include <unistd.h>    // 'sysconf'
+#include <unistd.h>    // 'sysconf', 'write'
 
 #endif
 
 namespace BloombergLP {
+namespace bdlma {
+
+                    // ===================================
+                    // struct GuardingAllocator_SampledSlot
+                    // ===================================
+
+struct GuardingAllocator_SampledSlot {
+    // This component-private 'struct' records the state of a slot in the pool
+    // of a 'GuardingAllocator' in sampling mode, and the stack traces of the
+    // allocation and deallocation of the block most recently held in it.
+
+    // TYPES
+    enum State {
+        e_UNUSED,     // no block has been allocated from the slot
+        e_ALLOCATED,  // the slot holds an outstanding block
+        e_FREED       // the block held in the slot has been deallocated
+    };
+
+    // DATA
+    State                   d_state;         // state of the slot
+
+    char                   *d_address_p;     // address of the block
+
+    bsls::Types::size_type  d_size;          // requested size of the block
+
+    bsls::Types::Uint64     d_allocatingThread;
+                                             // id of the allocating thread
+
+    bsls::Types::Uint64     d_deallocatingThread;
+                                             // id of the deallocating thread
+
+    int                     d_numAllocationFrames;
+                                             // number of addresses in
+                                             // 'd_allocationFrames'
+
+    int                     d_numDeallocationFrames;
+                                             // number of addresses in
+                                             // 'd_deallocationFrames'
+
+    void                   *d_allocationFrames[
+                                         GuardingAllocator::k_MAX_STACK_DEPTH];
+                                             // stack trace of the allocation
+
+    void                   *d_deallocationFrames[
+                                         GuardingAllocator::k_MAX_STACK_DEPTH];
+                                             // stack trace of the deallocation
+};
+
+}  // close package namespace
+
 namespace {
 
 // Define the offset (in bytes) from the address returned to the user in which
@@ -185,17 +245,796 @@ int systemUnprotect(void *address, int pageSize)
 #endif
 }
 
+
+void *systemReserve(bsl::size_t size)
+    // Allocate a page-aligned block of memory of the specified 'size' (in
+    // bytes) that is read/write protected, and return the address of the
+    // allocated block, or 0 if the memory could not be allocated.  The
+    // behavior is undefined unless 'size > 0'.
+{
+    BSLS_ASSERT(size > 0);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    return VirtualAlloc(0, size, MEM_COMMIT | MEM_RESERVE, PAGE_NOACCESS);
+                                                                      // RETURN
+
+#else
+
+    void *address = mmap(0, size, PROT_NONE, MAP_ANON | MAP_PRIVATE, -1, 0);
+
+    if (MAP_FAILED == address) {
+        return 0;                                                     // RETURN
+    }
+
+    return address;                                                   // RETURN
+
+#endif
+}
+
+void writeToStderr(const char *report, int length)
+    // Write the specified 'report' of the specified 'length' to 'stderr'.
+    // Note that this function is async-signal-safe on POSIX platforms.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    (void)length;
+
+    bsl::fputs(report, stderr);
+    bsl::fflush(stderr);
+
+#else
+
+    while (0 < length) {
+        const ssize_t rc = write(2, report, length);
+
+        if (rc <= 0 && EINTR != errno) {
+            return;                                                   // RETURN
+        }
+
+        if (0 < rc) {
+            report += rc;
+            length -= static_cast<int>(rc);
+        }
+    }
+
+#endif
+}
+
+                            // ==================
+                            // class ReportWriter
+                            // ==================
+
+class ReportWriter {
+    // This class appends text to a fixed-capacity buffer, keeping it
+    // null-terminated, and silently truncating text that does not fit.  Note
+    // that the methods of this class are async-signal-safe.
+
+    // DATA
+    char *d_buffer_p;  // buffer (held, not owned)
+    int   d_capacity;  // capacity of 'd_buffer_p' (in bytes)
+    int   d_length;    // number of characters in 'd_buffer_p'
+
+  public:
+    // CREATORS
+    ReportWriter(char *buffer, int capacity)
+        // Create a writer that appends to the specified 'buffer' having the
+        // specified 'capacity' (in bytes).
+    : d_buffer_p(buffer)
+    , d_capacity(capacity)
+    , d_length(0)
+    {
+        if (0 < d_capacity) {
+            d_buffer_p[0] = 0;
+        }
+    }
+
+    // MANIPULATORS
+    void append(const char *string)
+        // Append the specified null-terminated 'string'.
+    {
+        while (*string && d_length + 1 < d_capacity) {
+            d_buffer_p[d_length++] = *string++;
+        }
+
+        if (0 < d_capacity) {
+            d_buffer_p[d_length] = 0;
+        }
+    }
+
+    void appendDecimal(bsls::Types::Uint64 value)
+        // Append the decimal representation of the specified 'value'.
+    {
+        char  digits[24];
+        char *p = digits + sizeof digits;
+
+        *--p = 0;
+        do {
+            *--p = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value);
+
+        append(p);
+    }
+
+    void appendAddress(const void *address)
+        // Append the hexadecimal representation of the specified 'address',
+        // prefixed by "0x".
+    {
+        bsls::Types::Uint64 value = reinterpret_cast<bsls::Types::UintPtr>(
+                                                                      address);
+
+        char  digits[24];
+        char *p = digits + sizeof digits;
+
+        *--p = 0;
+        do {
+            *--p = "0123456789abcdef"[value % 16];
+            value /= 16;
+        } while (value);
+
+        append("0x");
+        append(p);
+    }
+
+    void appendStack(const char *title,
+                     bsls::Types::Uint64  threadId,
+                     void *const         *frames,
+                     int                  numFrames)
+        // Append a line with the specified 'title' and 'threadId', followed by
+        // a line for each of the specified 'numFrames' return addresses in
+        // the specified 'frames'.
+    {
+        append("  ");
+        append(title);
+        append(" by thread ");
+        appendDecimal(threadId);
+        append(":\n");
+
+        for (int i = 0; i < numFrames; ++i) {
+            append("    #");
+            appendDecimal(i);
+            append(" ");
+            appendAddress(frames[i]);
+            append("\n");
+        }
+    }
+
+    // ACCESSORS
+    int length() const
+        // Return the number of characters in the buffer.
+    {
+        return d_length;
+    }
+};
+
+// STATIC DATA
+
+enum {
+    k_REGISTRY_SIZE = bdlma::GuardingAllocator::k_MAX_SAMPLING_ALLOCATORS
+                                // maximum number of sampling allocators that
+                                // are known to the fault handler
+};
+
+bsls::AtomicOperations::AtomicTypes::Pointer s_registry[k_REGISTRY_SIZE];
+    // sampling allocators known to the fault handler (empty entries are 0)
+
+bsls::AtomicOperations::AtomicTypes::Int     s_numRegistryReaders;
+    // number of invocations of the fault handler that may be using an
+    // allocator loaded from 's_registry'
+
+bsls::AtomicOperations::AtomicTypes::Int     s_randomState;
+    // state of the generator of sampling intervals
+
+int randomInterval(int mean)
+    // Return a pseudo-random sampling interval in the range '[1, 2 * mean)'
+    // (or '[1, INT_MAX]', if '2 * mean' is not representable as an 'int').
+    // The behavior is undefined unless '0 < mean'.
+{
+    BSLS_ASSERT(0 < mean);
+
+    if (1 == mean) {
+        return 1;                                                     // RETURN
+    }
+
+    unsigned int x = static_cast<unsigned int>(
+        bsls::AtomicOperations::addIntNvRelaxed(&s_randomState, 0x61c88647));
+
+    // Finalize with a 32-bit mixing function, so that successive intervals
+    // are uncorrelated.
+
+    x ^= x >> 16;
+    x *= 0x7feb352dU;
+    x ^= x >> 15;
+    x *= 0x846ca68bU;
+    x ^= x >> 16;
+
+    const unsigned int range = mean < 0x40000000
+                             ? 2 * static_cast<unsigned int>(mean) - 1
+                             : 0x7fffffff;
+
+    return 1 + static_cast<int>(x % range);
+}
+
+int captureStack(void **frames)
+    // Load into the specified 'frames' up to
+    // 'bdlma::GuardingAllocator::k_MAX_STACK_DEPTH' return addresses from the
+    // current stack, and return the number of addresses loaded.
+{
+    enum {
+        k_IGNORE = bsls::StackAddressUtil::k_IGNORE_FRAMES,
+        k_DEPTH  = bdlma::GuardingAllocator::k_MAX_STACK_DEPTH
+    };
+
+    void *buffer[k_DEPTH + k_IGNORE];
+
+    int numFrames = bsls::StackAddressUtil::getStackAddresses(
+                                                       buffer,
+                                                       k_DEPTH + k_IGNORE);
+    numFrames = numFrames < k_IGNORE ? 0 : numFrames - k_IGNORE;
+
+    for (int i = 0; i < numFrames; ++i) {
+        frames[i] = buffer[k_IGNORE + i];
+    }
+
+    return numFrames;
+}
+
+int formatReport(char                                        *buffer,
+                 int                                          length,
+                 const char                                  *description,
+                 const void                                  *address,
+                 const char                                  *pool,
+                 int                                          numSlots,
+                 const bdlma::GuardingAllocator_SampledSlot  *slots)
+    // Load into the specified 'buffer' of the specified 'length' a
+    // null-terminated report describing the sampled block nearest to the
+    // specified 'address' within the specified 'pool' having the specified
+    // 'numSlots' described by the specified 'slots', headed by the specified
+    // 'description' or, if 'description' is 0, by a classification of an
+    // access to 'address'.  Return the length of the report.  The behavior is
+    // undefined unless 'address' is within 'pool'.
+{
+    typedef bdlma::GuardingAllocator_SampledSlot Slot;
+
+    const bsls::Types::size_type pageSize = getSystemPageSize();
+    const bsls::Types::size_type page     =
+          (static_cast<const char *>(address) - pool) / pageSize;
+
+    // Find the nearest slot that has held a block.  Odd-numbered pages are
+    // slots, and even-numbered pages are guard pages.
+
+    const Slot *slot = 0;
+
+    if (1 == page % 2) {
+        slot = slots + page / 2;
+    }
+    else {
+        const Slot *left  = 0 < page ? slots + page / 2 - 1 : 0;
+        const Slot *right = static_cast<int>(page / 2) < numSlots
+                          ? slots + page / 2
+                          : 0;
+
+        if (left && Slot::e_UNUSED == left->d_state) {
+            left = 0;
+        }
+        if (right && Slot::e_UNUSED == right->d_state) {
+            right = 0;
+        }
+
+        if (left && right) {
+            const char *p = static_cast<const char *>(address);
+
+            slot = p - (left->d_address_p + left->d_size)
+                                                  <= right->d_address_p - p
+                 ? left
+                 : right;
+        }
+        else {
+            slot = left ? left : right;
+        }
+    }
+
+    if (slot && Slot::e_UNUSED == slot->d_state) {
+        slot = 0;
+    }
+
+    const char *p     = static_cast<const char *>(address);
+    const char *begin = slot ? slot->d_address_p : 0;
+    const char *end   = slot ? begin + slot->d_size : 0;
+
+    if (!description) {
+        description = !slot                          ? "wild access"
+                    : Slot::e_FREED == slot->d_state ? "use after free"
+                    : p < begin                      ? "buffer underflow"
+                    : end <= p                       ? "buffer overflow"
+                    :                                  "access";
+    }
+
+    ReportWriter writer(buffer, length);
+
+    writer.append("bdlma::GuardingAllocator: ");
+    writer.append(description);
+    writer.append(" at ");
+    writer.appendAddress(address);
+    writer.append("\n");
+
+    if (!slot) {
+        writer.append("  no sampled block is near this address\n");
+        return writer.length();                                       // RETURN
+    }
+
+    writer.append("  ");
+    writer.appendAddress(address);
+    writer.append(" is ");
+    if (p < begin) {
+        writer.appendDecimal(begin - p);
+        writer.append(" bytes before");
+    }
+    else if (end <= p) {
+        writer.appendDecimal(p - end);
+        writer.append(" bytes after");
+    }
+    else {
+        writer.appendDecimal(p - begin);
+        writer.append(" bytes inside");
+    }
+    writer.append(" the ");
+    writer.appendDecimal(slot->d_size);
+    writer.append("-byte block at ");
+    writer.appendAddress(begin);
+    writer.append("\n");
+
+    writer.appendStack("allocated",
+                       slot->d_allocatingThread,
+                       slot->d_allocationFrames,
+                       slot->d_numAllocationFrames);
+
+    if (Slot::e_FREED == slot->d_state) {
+        writer.appendStack("deallocated",
+                           slot->d_deallocatingThread,
+                           slot->d_deallocationFrames,
+                           slot->d_numDeallocationFrames);
+    }
+
+    return writer.length();
+}
+}  // close unnamed namespace
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+
+namespace {
+
+struct sigaction                         s_previousSegvAction;
+struct sigaction                         s_previousBusAction;
+    // handlers installed before 'installFaultHandler' was called
+
+bsls::AtomicOperations::AtomicTypes::Int s_faultHandlerInstalled;
+    // 1 if the fault handler is installed, and 0 otherwise
+
+void reinstatePreviousHandlers()
+    // Reinstate the signal handlers that were installed before the fault
+    // handler, replacing an ignored disposition by the default one.
+{
+    struct sigaction *previous[] = { &s_previousSegvAction,
+                                     &s_previousBusAction };
+    const int         signals[]  = { SIGSEGV, SIGBUS };
+
+    for (int i = 0; i < 2; ++i) {
+        if (!(previous[i]->sa_flags & SA_SIGINFO)
+         && SIG_IGN == previous[i]->sa_handler) {
+            previous[i]->sa_handler = SIG_DFL;
+        }
+        sigaction(signals[i], previous[i], 0);
+    }
+
+    bsls::AtomicOperations::setIntRelease(&s_faultHandlerInstalled, 0);
+}
+
 }  // close unnamed namespace
 
+extern "C" {
+
+static void bdlma_GuardingAllocator_handleFault(int        signal,
+                                                siginfo_t *info,
+                                                void      *context)
+    // Write to 'stderr' a report describing the sampled block nearest to the
+    // faulting address in the specified 'info', if that address is within
+    // the pool of a registered sampling allocator, and reinstate the previous
+    // handlers for the specified 'signal'; otherwise, pass 'signal', 'info',
+    // and the specified 'context' to the previous handler.
+{
+    char report[4096];
+    int  length = 0;
+
+    // An allocator loaded from the registry is used only while
+    // 's_numRegistryReaders' counts this invocation, so that a destructor,
+    // having removed its allocator from the registry, can wait until no
+    // invocation of this handler is using it.  The increment, the loads of
+    // the registry, and the removal are sequentially consistent, so that
+    // either the destructor waits for this invocation, or this invocation
+    // does not find the allocator.
+
+    bsls::AtomicOperations::addIntNv(&s_numRegistryReaders, 1);
+
+    for (int i = 0; i < k_REGISTRY_SIZE && 0 == length; ++i) {
+        const bdlma::GuardingAllocator *allocator =
+            static_cast<const bdlma::GuardingAllocator *>(
+                              bsls::AtomicOperations::getPtr(s_registry + i));
+
+        if (allocator) {
+            length = allocator->formatFaultReport(report,
+                                                  sizeof report,
+                                                  info->si_addr);
+        }
+    }
+
+    bsls::AtomicOperations::addIntNvAcqRel(&s_numRegistryReaders, -1);
+
+    const struct sigaction previous = SIGBUS == signal
+                                    ? s_previousBusAction
+                                    : s_previousSegvAction;
+
+    if (0 < length
+     || (!(previous.sa_flags & SA_SIGINFO)
+      && (SIG_DFL == previous.sa_handler
+       || SIG_IGN == previous.sa_handler))) {
+        // Return with the previous handlers reinstated, so that the faulting
+        // access is repeated and handled by them.
+
+        writeToStderr(report, length);
+        reinstatePreviousHandlers();
+        return;                                                       // RETURN
+    }
+
+    if (previous.sa_flags & SA_SIGINFO) {
+        previous.sa_sigaction(signal, info, context);
+    }
+    else {
+        previous.sa_handler(signal);
+    }
+}
+
+}  // close extern "C"
+
+#endif
+
 namespace bdlma {
 
                          // -----------------------
                          // class GuardingAllocator
                          // -----------------------
 
+// PRIVATE MANIPULATORS
+void GuardingAllocator::initializePool()
+{
+    BSLS_ASSERT(0 < d_sampleInterval);
+    BSLS_ASSERT(0 < d_maxSampledBlocks);
+    BSLS_ASSERT(d_allocator_p);
+
+    typedef GuardingAllocator_SampledSlot Slot;
+
+    const int pageSize = getSystemPageSize();
+
+    const bsls::Types::size_type numSlots = d_maxSampledBlocks;
+
+    d_slots_p = static_cast<Slot *>(
+                             d_allocator_p->allocate(sizeof(Slot) * numSlots));
+
+    bslma::DeallocatorProctor<bslma::Allocator> slotsProctor(d_slots_p,
+                                                             d_allocator_p);
+
+    d_freeSlots_p = static_cast<int *>(
+                              d_allocator_p->allocate(sizeof(int) * numSlots));
+
+    bslma::DeallocatorProctor<bslma::Allocator> freeSlotsProctor(
+                                                                d_freeSlots_p,
+                                                                d_allocator_p);
+
+    for (int i = 0; i < d_maxSampledBlocks; ++i) {
+        Slot& slot = d_slots_p[i];
+
+        slot.d_state                 = Slot::e_UNUSED;
+        slot.d_address_p             = 0;
+        slot.d_size                  = 0;
+        slot.d_allocatingThread      = 0;
+        slot.d_deallocatingThread    = 0;
+        slot.d_numAllocationFrames   = 0;
+        slot.d_numDeallocationFrames = 0;
+
+        d_freeSlots_p[i] = i;
+    }
+
+    d_freeHead     = 0;
+    d_numFreeSlots = d_maxSampledBlocks;
+
+    // Reserve a slot page for each block, a guard page between each pair of
+    // adjacent slots, and a guard page at either end.
+
+    d_poolSize = (2 * numSlots + 1) * pageSize;
+    d_pool_p   = static_cast<char *>(systemReserve(d_poolSize));
+
+    if (!d_pool_p) {
+        d_poolSize     = 0;
+        d_slots_p      = 0;
+        d_freeSlots_p  = 0;
+        d_numFreeSlots = 0;
+
+#ifdef BDE_BUILD_TARGET_EXC
+        BSLS_THROW(bsl::bad_alloc());
+#else
+        return;                                                       // RETURN
+#endif
+    }
+
+    d_samplingCountdown = randomInterval(d_sampleInterval);
+
+    for (int i = 0; i < k_REGISTRY_SIZE; ++i) {
+        if (0 == bsls::AtomicOperations::testAndSwapPtr(s_registry + i,
+                                                        0,
+                                                        this)) {
+            d_registryIndex = i;
+
+            freeSlotsProctor.release();
+            slotsProctor.release();
+            return;                                                   // RETURN
+        }
+    }
+
+    // Every entry of the registry is taken: release the pool, and pass every
+    // request upstream (see {Sampling Mode}).  The proctors deallocate the
+    // bookkeeping.
+
+    systemFree(d_pool_p, d_poolSize);
+
+    d_pool_p       = 0;
+    d_poolSize     = 0;
+    d_slots_p      = 0;
+    d_freeSlots_p  = 0;
+    d_numFreeSlots = 0;
+}
+
+void *GuardingAllocator::allocateSampled(bsls::Types::size_type size)
+{
+    typedef GuardingAllocator_SampledSlot Slot;
+
+    const int pageSize = getSystemPageSize();
+
+    BSLS_ASSERT(0 < size);
+    BSLS_ASSERT(size <= static_cast<bsls::Types::size_type>(pageSize));
+
+    void      *frames[k_MAX_STACK_DEPTH];
+    const int  numFrames = captureStack(frames);
+
+    const bsls::Types::size_type paddedSize =
+                          bsls::AlignmentUtil::roundUpToMaximalAlignment(size);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (0 == d_numFreeSlots) {
+        return 0;                                                     // RETURN
+    }
+
+    const int  index    = d_freeSlots_p[d_freeHead];
+    char      *slotPage = d_pool_p + (2 * index + 1) * pageSize;
+
+    if (0 != systemUnprotect(slotPage, pageSize)) {
+        return 0;                                                     // RETURN
+    }
+
+    d_freeHead = (d_freeHead + 1) % d_maxSampledBlocks;
+    --d_numFreeSlots;
+
+    // Place the block against the guard page that follows the slot
+    // ('e_AFTER_USER_BLOCK') or that precedes it ('e_BEFORE_USER_BLOCK').
+
+    Slot& slot = d_slots_p[index];
+
+    slot.d_state               = Slot::e_ALLOCATED;
+    slot.d_address_p           = e_AFTER_USER_BLOCK == d_guardPageLocation
+                               ? slotPage + pageSize - paddedSize
+                               : slotPage;
+    slot.d_size                = size;
+    slot.d_allocatingThread    = bslmt::ThreadUtil::selfIdAsUint64();
+    slot.d_numAllocationFrames = numFrames;
+
+    for (int i = 0; i < numFrames; ++i) {
+        slot.d_allocationFrames[i] = frames[i];
+    }
+
+    ++d_numSampledAllocations;
+
+    return slot.d_address_p;
+}
+
+void GuardingAllocator::deallocateSampled(void *address)
+{
+    typedef GuardingAllocator_SampledSlot Slot;
+
+    void      *frames[k_MAX_STACK_DEPTH];
+    const int  numFrames = captureStack(frames);
+
+    const int                    pageSize = getSystemPageSize();
+    const bsls::Types::size_type page     =
+                      (static_cast<char *>(address) - d_pool_p) / pageSize;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        Slot *slot = 1 == page % 2 ? d_slots_p + page / 2 : 0;
+
+        if (slot
+         && Slot::e_ALLOCATED == slot->d_state
+         && address == slot->d_address_p) {
+            slot->d_state                 = Slot::e_FREED;
+            slot->d_deallocatingThread    =
+                                          bslmt::ThreadUtil::selfIdAsUint64();
+            slot->d_numDeallocationFrames = numFrames;
+
+            for (int i = 0; i < numFrames; ++i) {
+                slot->d_deallocationFrames[i] = frames[i];
+            }
+
+            // Protect the slot until it is reused, so that a use after free
+            // faults, and queue it behind the other free slots.
+
+            const int rc = systemProtect(d_pool_p + page * pageSize, pageSize);
+            (void)rc;
+
+            BSLS_ASSERT_OPT(0 == rc);
+
+            const int tail = (d_freeHead + d_numFreeSlots)
+                                                        % d_maxSampledBlocks;
+
+            d_freeSlots_p[tail] = static_cast<int>(page / 2);
+            ++d_numFreeSlots;
+
+            return;                                                   // RETURN
+        }
+    }
+
+    // 'address' is not that of an outstanding sampled block.
+
+    const Slot *slot        = 1 == page % 2 ? d_slots_p + page / 2 : 0;
+    const bool  isDoubleFree = slot
+                            && Slot::e_FREED == slot->d_state
+                            && address == slot->d_address_p;
+
+    char      report[4096];
+    const int length = formatReport(report,
+                                    sizeof report,
+                                    isDoubleFree ? "double free"
+                                                 : "invalid deallocation",
+                                    address,
+                                    d_pool_p,
+                                    d_maxSampledBlocks,
+                                    d_slots_p);
+
+    writeToStderr(report, length);
+
+    BSLS_ASSERT_OPT(!"deallocation of an invalid sampled block");
+}
+
+bool GuardingAllocator::shouldSample()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                   0 != d_samplingCountdown.addRelaxed(-1))) {
+        return false;                                                 // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    // This request took the countdown to 0.  The next interval is added to
+    // (rather than stored in) the countdown, so that requests made by other
+    // threads in the meantime, which found it negative, are counted.
+
+    d_samplingCountdown.addRelaxed(randomInterval(d_sampleInterval));
+    return true;
+}
+
+// CLASS METHODS
+int GuardingAllocator::installFaultHandler()
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    return -1;                                                        // RETURN
+
+#else
+
+    if (0 != bsls::AtomicOperations::testAndSwapInt(&s_faultHandlerInstalled,
+                                                    0,
+                                                    1)) {
+        return 0;                                                     // RETURN
+    }
+
+    struct sigaction action;
+
+    memset(&action, 0, sizeof action);
+    sigemptyset(&action.sa_mask);
+    action.sa_sigaction = &bdlma_GuardingAllocator_handleFault;
+    action.sa_flags     = SA_SIGINFO | SA_ONSTACK;
+
+    if (0 != sigaction(SIGSEGV, &action, &s_previousSegvAction)) {
+        bsls::AtomicOperations::setIntRelease(&s_faultHandlerInstalled, 0);
+        return -1;                                                    // RETURN
+    }
+
+    if (0 != sigaction(SIGBUS, &action, &s_previousBusAction)) {
+        sigaction(SIGSEGV, &s_previousSegvAction, 0);
+        bsls::AtomicOperations::setIntRelease(&s_faultHandlerInstalled, 0);
+        return -1;                                                    // RETURN
+    }
+
+    return 0;
+
+#endif
+}
+
 // CREATORS
+GuardingAllocator::GuardingAllocator(int               sampleInterval,
+                                     int               maxSampledBlocks,
+                                     bslma::Allocator *basicAllocator)
+: d_guardPageLocation(e_AFTER_USER_BLOCK)
+, d_sampleInterval(sampleInterval)
+, d_maxSampledBlocks(maxSampledBlocks)
+, d_pool_p(0)
+, d_poolSize(0)
+, d_slots_p(0)
+, d_freeSlots_p(0)
+, d_freeHead(0)
+, d_numFreeSlots(0)
+, d_numSampledAllocations(0)
+, d_samplingCountdown(0)
+, d_registryIndex(-1)
+, d_mutex()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initializePool();
+}
+
+GuardingAllocator::GuardingAllocator(int               sampleInterval,
+                                     int               maxSampledBlocks,
+                                     GuardPageLocation guardLocation,
+                                     bslma::Allocator *basicAllocator)
+: d_guardPageLocation(guardLocation)
+, d_sampleInterval(sampleInterval)
+, d_maxSampledBlocks(maxSampledBlocks)
+, d_pool_p(0)
+, d_poolSize(0)
+, d_slots_p(0)
+, d_freeSlots_p(0)
+, d_freeHead(0)
+, d_numFreeSlots(0)
+, d_numSampledAllocations(0)
+, d_samplingCountdown(0)
+, d_registryIndex(-1)
+, d_mutex()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initializePool();
+}
+
 GuardingAllocator::~GuardingAllocator()
 {
+    if (0 <= d_registryIndex) {
+        bsls::AtomicOperations::setPtr(s_registry + d_registryIndex, 0);
+
+        // Wait for any invocation of the fault handler that may have loaded
+        // this allocator from the registry before it was removed.
+
+        while (0 != bsls::AtomicOperations::getInt(&s_numRegistryReaders)) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+
+    if (d_pool_p) {
+        systemFree(d_pool_p, d_poolSize);
+    }
+
+    if (d_slots_p) {
+        d_allocator_p->deallocate(d_freeSlots_p);
+        d_allocator_p->deallocate(d_slots_p);
+    }
 }
 
 // MANIPULATORS
@@ -206,6 +1045,23 @@ void *GuardingAllocator::allocate(bsls::Types::size_type size)
         return 0;                                                     // RETURN
     }
 
+    if (d_allocator_p) {
+        // Sampling mode: guard a sample of the blocks no larger than a page,
+        // and obtain all others from the upstream allocator.
+
+        if (d_pool_p
+         && size <= static_cast<bsls::Types::size_type>(getSystemPageSize())
+         && shouldSample()) {
+            void *address = allocateSampled(size);
+
+            if (address) {
+                return address;                                       // RETURN
+            }
+        }
+
+        return d_allocator_p->allocate(size);                         // RETURN
+    }
+
     const bsls::Types::size_type paddedSize =
                           bsls::AlignmentUtil::roundUpToMaximalAlignment(size);
 
@@ -284,6 +1140,20 @@ void GuardingAllocator::deallocate(void *address)
         return;                                                       // RETURN
     }
 
+    if (d_allocator_p) {
+        // Sampling mode: sampled blocks are within the pool.
+
+        if (reinterpret_cast<bsls::Types::UintPtr>(address)
+                     - reinterpret_cast<bsls::Types::UintPtr>(d_pool_p)
+                                                              < d_poolSize) {
+            deallocateSampled(address);
+        }
+        else {
+            d_allocator_p->deallocate(address);
+        }
+        return;                                                       // RETURN
+    }
+
     const int pageSize = getSystemPageSize();
 
     void *firstPage;  // address of the first page of the allocation
@@ -317,6 +1187,36 @@ void GuardingAllocator::deallocate(void *address)
     systemFree(firstPage, totalSize);
 }
 
+// ACCESSORS
+int GuardingAllocator::formatFaultReport(char       *buffer,
+                                         int         length,
+                                         const void *address) const
+{
+    BSLS_ASSERT(0 <= length);
+
+    if (!d_pool_p
+     || reinterpret_cast<bsls::Types::UintPtr>(address)
+              - reinterpret_cast<bsls::Types::UintPtr>(d_pool_p)
+                                                            >= d_poolSize) {
+        return 0;                                                     // RETURN
+    }
+
+    return formatReport(buffer,
+                        length,
+                        0,
+                        address,
+                        d_pool_p,
+                        d_maxSampledBlocks,
+                        d_slots_p);
+}
+
+int GuardingAllocator::numSampledBlocks() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_slots_p ? d_maxSampledBlocks - d_numFreeSlots : 0;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
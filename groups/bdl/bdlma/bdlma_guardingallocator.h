@@ -30,15 +30,16 @@ BSLS_IDENT("$Id: $")
 //                         allocate
 //                         deallocate
 //..
-// *WARNING*: Note that this allocator should *not* be used for production use;
-// it is intended for debugging purposes only.  In particular, clients should
-// be aware that a multiple of the page size is allocated for *each* 'allocate'
+// *WARNING*: Note that, unless it is configured for sampling (see {Sampling
+// Mode}), this allocator should *not* be used for production use; it is
+// intended for debugging purposes only.  In particular, clients should be
+// aware that a multiple of the page size is allocated for *each* 'allocate'
 // invocation (unless the size of the request is 0).
 //
-// Also note that, unlike many other BDE allocators, a 'bslma::Allocator *'
-// cannot be (optionally) supplied upon construction of a 'GuardingAllocator';
-// instead, a system facility is used that allocates blocks of memory in
-// multiples of the system page size.
+// Also note that, unless it is configured for sampling, a 'GuardingAllocator'
+// does not use a 'bslma::Allocator' supplied at construction; instead, a
+// system facility is used that allocates blocks of memory in multiples of the
+// system page size.
 //
 ///Guard Pages
 ///-----------
@@ -84,10 +85,64 @@ BSLS_IDENT("$Id: $")
 //      A == G                         U == A + PS
 //..
 //
+///Sampling Mode
+///-------------
+// Guarding every allocation is far too expensive for production use.  A
+// 'GuardingAllocator' constructed with a 'sampleInterval' and a
+// 'maxSampledBlocks' operates in *sampling* *mode*: approximately one in every
+// 'sampleInterval' allocation requests is satisfied from a bounded pool of
+// guarded slots reserved at construction, and every other request is passed
+// to an upstream allocator (the 'basicAllocator' supplied at construction, or
+// the currently installed default allocator).  The cost of an unsampled
+// allocation is that of the upstream allocator plus the atomic decrement of a
+// counter held by the guarding allocator, and the cost of an unsampled
+// deallocation is that of the upstream allocator plus an address-range
+// comparison.  The sampling interval is randomized around 'sampleInterval',
+// so that allocation patterns that repeat with a fixed period are not
+// consistently missed.  The countdown to the next sampled allocation is kept
+// by each guarding allocator, so the allocations made from one guarding
+// allocator do not affect the sampling of another.
+//
+// At most 'k_MAX_SAMPLING_ALLOCATORS' guarding allocators in sampling mode
+// can exist at any one time, as each is registered with the fault handler
+// (see below).  A guarding allocator constructed in sampling mode while that
+// many others exist does not sample: it reserves no pool, and passes every
+// request to the upstream allocator ('numSampledAllocations' remains 0).
+//
+// The pool consists of 'maxSampledBlocks' slots of one memory page each, with
+// a read/write protected guard page between each pair of adjacent slots and
+// at either end of the pool:
+//..
+//  | guard | slot 0 | guard | slot 1 | guard | ... | slot N-1 | guard |
+//..
+// A sampled block is placed at the end of its slot ('e_AFTER_USER_BLOCK') or
+// at the beginning of its slot ('e_BEFORE_USER_BLOCK'), so that a buffer
+// overrun (or underrun) faults on the adjoining guard page.  When a sampled
+// block is deallocated, its slot is read/write protected, so that a
+// subsequent use of the block faults, and the slot is not reused until all
+// other free slots have been.  Requests larger than a memory page, and
+// requests that are sampled while every slot is in use, are passed to the
+// upstream allocator.
+//
+// For each sampled block, the allocator records the return addresses on the
+// stack (see 'bsls_stackaddressutil') of the thread that allocated it and,
+// once deallocated, of the thread that deallocated it.  The
+// 'formatFaultReport' method renders a report, including those stack traces,
+// describing the sampled block nearest to a faulting address, and the
+// 'installFaultHandler' class method installs (on POSIX platforms) a 'SIGSEGV'
+// and 'SIGBUS' handler that writes that report to 'stderr' before deferring
+// to the previously installed handler.  Stack traces are reported as raw
+// return addresses, which may be symbolized with 'balst' or with a platform
+// tool such as 'addr2line'.  Deallocating a sampled block twice is detected
+// and reported likewise, after which 'BSLS_ASSERT_OPT' fails.
+//
 ///Thread Safety
 ///-------------
 // The 'bdlma::GuardingAllocator' class is fully thread-safe (see
-// 'bsldoc_glossary').
+// 'bsldoc_glossary').  In addition, 'formatFaultReport' is async-signal-safe
+// and is intended to be called from a signal handler; if it is called while
+// another thread is allocating or deallocating a sampled block, the report is
+// a best-effort description of that block.
 //
 ///Usage
 ///-----
@@ -288,11 +343,69 @@ BSLS_IDENT("$Id: $")
 // program will dump core in a context that is more proximate to the buggy
 // code, resulting in a core file that will be more amenable to revealing the
 // issue when analyzed in a debugger.
+//
+///Example 2: Sampling Memory Errors in Production
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// The guarding allocator of {Example 1} consumes at least two memory pages,
+// and a pair of system calls, for each allocation, so it cannot remain in
+// place once the program is released.  A guarding allocator in sampling mode,
+// by contrast, is cheap enough to be left in place under real load, where it
+// will eventually catch the rare allocation that is misused.
+//
+// First, at program start-up, we install the fault handler so that a fault in
+// a sampled block is reported to 'stderr' along with the stack traces of the
+// block's allocation (and deallocation, if any):
+//..
+//  bdlma::GuardingAllocator::installFaultHandler();
+//..
+// Then, we create a guarding allocator that samples approximately one in every
+// 1000 allocations into at most 64 guarded slots, and passes every other
+// allocation to an upstream allocator (here, a test allocator):
+//..
+//  bslma::TestAllocator     upstream;
+//  bdlma::GuardingAllocator sampler(1000, 64, &upstream);
+//..
+// Next, we use 'sampler' to supply memory to several data handlers.  Most of
+// the handlers obtain their memory from 'upstream', but some of their buffers
+// are guarded:
+//..
+//  for (int i = 0; i < 100; ++i) {
+//      my_DataHandler handler(input, 16, e_STYLE_A, &sampler);
+//  }
+//  assert(0 == sampler.numSampledBlocks());
+//..
+// Should one of those handlers call the buggy 'generateAlternate' method, and
+// its buffer be one of the sampled ones, the program faults at the offending
+// write and the handler installed above describes the buffer overrun and the
+// stack trace of the allocation that was overrun.
+//
+// Finally, we note that the same report can be rendered on demand, for an
+// address that is known to be suspicious, using 'formatFaultReport'.  Here we
+// request a report for the byte just past a block that is guaranteed to be
+// sampled, as it is allocated from a guarding allocator that samples every
+// allocation:
+//..
+//  bdlma::GuardingAllocator everyAllocation(1, 1, &upstream);
+//
+//  char *block = static_cast<char *>(everyAllocation.allocate(16));
+//
+//  char report[2048];
+//  int  length = everyAllocation.formatFaultReport(report,
+//                                                  sizeof report,
+//                                                  block + 16);
+//  assert(0 < length);
+//  assert(0 != bsl::strstr(report, "buffer overflow"));
+//
+//  everyAllocation.deallocate(block);
+//..
 
 #include <bdlscm_version.h>
 
 #include <bslma_allocator.h>
 
+#include <bslmt_mutex.h>
+
+#include <bsls_atomic.h>
 #include <bsls_types.h>
 
 namespace BloombergLP {
@@ -302,6 +415,8 @@ namespace bdlma {
                          // class GuardingAllocator
                          // -----------------------
 
+struct GuardingAllocator_SampledSlot;
+
 class GuardingAllocator : public bslma::Allocator {
     // This class defines a concrete thread-safe "guarding" allocator mechanism
     // that implements the 'bslma::Allocator' protocol, and adjoins a
@@ -309,11 +424,12 @@ class GuardingAllocator : public bslma::Allocator {
     // 'allocate' method.  The guard page is placed immediately before or
     // immediately following the block returned from 'allocate' according to
     // the 'GuardPageLocation' enumerator value (optionally) supplied at
-    // construction.  Note that, unlike many other allocators, an allocator
-    // cannot be (optionally) supplied at construction; instead, a system
-    // facility is used that allocates blocks of memory in multiples of the
-    // system page size.  Also note that this allocator is intended for
-    // debugging purposes *only*.
+    // construction.  Unless constructed in sampling mode, a system facility
+    // is used that allocates blocks of memory in multiples of the system page
+    // size, and this allocator is intended for debugging purposes *only*.  In
+    // sampling mode, only a sample of the allocations are guarded, using a
+    // bounded pool of guarded slots, and all others are passed to an upstream
+    // allocator (see {Sampling Mode}).
 
   public:
     // TYPES
@@ -325,20 +441,125 @@ class GuardingAllocator : public bslma::Allocator {
         e_BEFORE_USER_BLOCK  // locate the guard page before the user block
     };
 
+    enum {
+        k_MAX_STACK_DEPTH         = 16,  // maximum number of return addresses
+                                         // recorded for the allocation, and
+                                         // deallocation, of a sampled block
+
+        k_MAX_SAMPLING_ALLOCATORS = 64   // maximum number of sampling
+                                         // allocators that can exist at once
+                                         // (see {Sampling Mode})
+    };
+
   private:
     // DATA
-    GuardPageLocation d_guardPageLocation;  // if 'e_AFTER_USER_BLOCK', place
-                                            // the read/write protected guard
-                                            // page after the user block;
-                                            // otherwise, place it before the
-                                            // block ('e_BEFORE_USER_BLOCK')
+    GuardPageLocation     d_guardPageLocation;
+                                          // if 'e_AFTER_USER_BLOCK', place
+                                          // the read/write protected guard
+                                          // page after the user block;
+                                          // otherwise, place it before the
+                                          // block ('e_BEFORE_USER_BLOCK')
+
+    int                   d_sampleInterval;
+                                          // mean number of allocations per
+                                          // sampled allocation, or 0 if not
+                                          // in sampling mode
+
+    int                   d_maxSampledBlocks;
+                                          // number of slots in the pool
+
+    char                 *d_pool_p;       // pool of guarded slots (owned),
+                                          // or 0 if not in sampling mode
+
+    bsls::Types::size_type
+                          d_poolSize;     // size (in bytes) of 'd_pool_p'
+
+    GuardingAllocator_SampledSlot
+                         *d_slots_p;      // array of 'd_maxSampledBlocks'
+                                          // slot records (owned)
+
+    int                  *d_freeSlots_p;  // circular queue of the indices of
+                                          // the free slots, least recently
+                                          // freed first (owned)
+
+    int                   d_freeHead;     // index in 'd_freeSlots_p' of the
+                                          // next slot to be used
+
+    int                   d_numFreeSlots; // number of indices in
+                                          // 'd_freeSlots_p'
+
+    bsls::AtomicInt64     d_numSampledAllocations;
+                                          // number of allocations satisfied
+                                          // from the pool
+
+    bsls::AtomicInt       d_samplingCountdown;
+                                          // number of allocation requests up
+                                          // to and including the next sampled
+                                          // request (may transiently be
+                                          // negative)
+
+    int                   d_registryIndex;
+                                          // index of this allocator in the
+                                          // fault handler's registry, or -1
+                                          // if unregistered
+
+    mutable bslmt::Mutex  d_mutex;        // serialize access to the slots
+
+    bslma::Allocator     *d_allocator_p;  // upstream allocator (held, not
+                                          // owned), or 0 if not in sampling
+                                          // mode
 
   private:
+    // PRIVATE MANIPULATORS
+    void initializePool();
+        // Reserve the pool of guarded slots, allocate its bookkeeping from the
+        // upstream allocator, and register this allocator with the fault
+        // handler.  If the pool cannot be reserved, a 'bsl::bad_alloc'
+        // exception is thrown.  If 'k_MAX_SAMPLING_ALLOCATORS' allocators are
+        // already registered, release the pool and its bookkeeping, so that
+        // this allocator passes every request upstream.  The behavior is
+        // undefined unless 'd_sampleInterval', 'd_maxSampledBlocks', and
+        // 'd_allocator_p' have been set, and this method has not already been
+        // called.
+
+    void *allocateSampled(bsls::Types::size_type size);
+        // Return a newly-allocated maximally-aligned block of memory of the
+        // specified 'size' (in bytes) from a free slot of the pool, recording
+        // the current stack trace, or return 0 if no slot is free.  The
+        // behavior is undefined unless this allocator is in sampling mode and
+        // '0 < size <= pageSize', where 'pageSize' is the size of a memory
+        // page.
+
+    void deallocateSampled(void *address);
+        // Return the sampled block at the specified 'address' to the pool,
+        // recording the current stack trace and read/write protecting its
+        // slot.  The behavior is undefined unless 'address' is within the
+        // pool.  Note that if 'address' is not that of an outstanding sampled
+        // block, a report is written to 'stderr' and 'BSLS_ASSERT_OPT' fails.
+
+    bool shouldSample();
+        // Return 'true' if the current allocation request should be sampled,
+        // and 'false' otherwise, counting down to the next sampled request.
+        // The behavior is undefined unless this allocator is in sampling mode.
+
     // NOT IMPLEMENTED
     GuardingAllocator(const GuardingAllocator&);
     GuardingAllocator& operator=(const GuardingAllocator&);
 
   public:
+    // CLASS METHODS
+    static int installFaultHandler();
+        // Install a handler for the 'SIGSEGV' and 'SIGBUS' signals that, when
+        // a memory fault occurs within the pool of any guarding allocator in
+        // sampling mode, writes the report rendered by 'formatFaultReport' to
+        // 'stderr'.  The handler then reinstates the previously installed
+        // handlers and returns, so that the faulting access is repeated and
+        // handled by them (by default, terminating the process); a fault
+        // outside every pool is passed directly to the previously installed
+        // handler.  Return 0 on success (including if the handler is already
+        // installed), and a non-zero value if the handler could not be
+        // installed or if the platform does not support it (e.g., Windows).
+
     // CREATORS
     explicit
     GuardingAllocator(GuardPageLocation guardLocation = e_AFTER_USER_BLOCK);
@@ -348,9 +569,36 @@ class GuardingAllocator : public bslma::Allocator {
         // If 'guardLocation' is not specified, guard pages are placed
         // immediately following the memory blocks returned by 'allocate'.
 
+    GuardingAllocator(int               sampleInterval,
+                      int               maxSampledBlocks,
+                      bslma::Allocator *basicAllocator = 0);
+    GuardingAllocator(int               sampleInterval,
+                      int               maxSampledBlocks,
+                      GuardPageLocation guardLocation,
+                      bslma::Allocator *basicAllocator = 0);
+        // Create a guarding allocator in sampling mode that guards
+        // approximately one in every specified 'sampleInterval' allocations,
+        // using a pool of the specified 'maxSampledBlocks' guarded slots, and
+        // passes all other allocations to an upstream allocator.  Optionally
+        // specify a 'guardLocation' indicating where read/write protected
+        // guard pages should be placed with respect to the sampled blocks.
+        // If 'guardLocation' is not specified, guard pages are placed
+        // immediately following the sampled blocks.  Optionally specify a
+        // 'basicAllocator' used as the upstream allocator and to supply the
+        // memory for the bookkeeping of the pool.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  If the pool
+        // cannot be reserved, a 'bsl::bad_alloc' exception is thrown.  The
+        // behavior is undefined unless '0 < sampleInterval' and
+        // '0 < maxSampledBlocks'.  See {Sampling Mode}.
+
     virtual ~GuardingAllocator();
-        // Destroy this allocator object.  Note that destroying this allocator
-        // has no effect on any outstanding allocated memory.
+        // Destroy this allocator object.  Note that, unless this allocator is
+        // in sampling mode, destroying this allocator has no effect on any
+        // outstanding allocated memory; in sampling mode, the pool of guarded
+        // slots is released, so any outstanding sampled blocks become invalid
+        // (the destructor first waits for any invocation of the handler
+        // installed by 'installFaultHandler' that may be using this
+        // allocator).
 
     // MANIPULATORS
     virtual void *allocate(bsls::Types::size_type size);
@@ -358,16 +606,51 @@ class GuardingAllocator : public bslma::Allocator {
         // specified 'size' (in bytes) that has a read/write protected guard
         // page located immediately before or after it according to the
         // 'GuardPageLocation' indicated at construction.  If 'size' is 0, no
-        // memory is allocated and 0 is returned.  Note that a multiple of the
-        // platform's memory page size is allocated for *every* call to this
-        // method.
+        // memory is allocated and 0 is returned.  Note that, unless this
+        // allocator is in sampling mode, a multiple of the platform's memory
+        // page size is allocated for *every* call to this method; in sampling
+        // mode, only the sampled blocks are guarded and the memory for all
+        // other blocks is obtained from the upstream allocator.
 
     virtual void deallocate(void *address);
         // Return the memory block at the specified 'address' back to this
         // allocator.  If 'address' is 0, this method has no effect.
         // Otherwise, the guard page associated with 'address' is unprotected
-        // and also deallocated.  The behavior is undefined unless 'address'
-        // was returned by 'allocate' and has not already been deallocated.
+        // and also deallocated, or, for a sampled block, the slot holding the
+        // block is read/write protected until it is reused.  The behavior is
+        // undefined unless 'address' was returned by 'allocate' and has not
+        // already been deallocated.
+
+    // ACCESSORS
+    int formatFaultReport(char       *buffer,
+                          int         length,
+                          const void *address) const;
+        // Load into the specified 'buffer' of the specified 'length' a
+        // null-terminated report describing the sampled block nearest to the
+        // specified 'address', including the stack traces of the allocation
+        // and (if it has been deallocated) deallocation of that block, and
+        // return the length of the report (not including the null
+        // terminator).  Return 0, with no effect, if this allocator is not in
+        // sampling mode or 'address' is not within its pool of guarded slots.
+        // The report is truncated if it does not fit in 'buffer'.  The
+        // behavior is undefined unless '0 <= length'.  Note that this method
+        // is async-signal-safe.
+
+    int maxSampledBlocks() const;
+        // Return the number of guarded slots in the pool of this allocator,
+        // or 0 if this allocator is not in sampling mode.
+
+    int numSampledBlocks() const;
+        // Return the number of sampled blocks currently allocated from this
+        // allocator.
+
+    bsls::Types::Int64 numSampledAllocations() const;
+        // Return the total number of allocations satisfied from the pool of
+        // guarded slots of this allocator.
+
+    int sampleInterval() const;
+        // Return the mean number of allocation requests per sampled request of
+        // this allocator, or 0 if this allocator is not in sampling mode.
 };
 
 // ============================================================================
@@ -382,7 +665,39 @@ class GuardingAllocator : public bslma::Allocator {
 inline
 GuardingAllocator::GuardingAllocator(GuardPageLocation guardLocation)
 : d_guardPageLocation(guardLocation)
+, d_sampleInterval(0)
+, d_maxSampledBlocks(0)
+, d_pool_p(0)
+, d_poolSize(0)
+, d_slots_p(0)
+, d_freeSlots_p(0)
+, d_freeHead(0)
+, d_numFreeSlots(0)
+, d_numSampledAllocations(0)
+, d_samplingCountdown(0)
+, d_registryIndex(-1)
+, d_mutex()
+, d_allocator_p(0)
+{
+}
+
+// ACCESSORS
+inline
+int GuardingAllocator::maxSampledBlocks() const
+{
+    return d_maxSampledBlocks;
+}
+
+inline
+bsls::Types::Int64 GuardingAllocator::numSampledAllocations() const
+{
+    return d_numSampledAllocations.loadRelaxed();
+}
+
+inline
+int GuardingAllocator::sampleInterval() const
 {
+    return d_sampleInterval;
 }
 
 }  // close package namespace
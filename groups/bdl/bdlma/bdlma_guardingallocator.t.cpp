@@ -7,6 +7,8 @@
 #include <bslma_testallocator.h>
 
 #include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
 #include <bsls_platform.h>
 
 #include <bsl_cstdlib.h>
@@ -21,7 +23,7 @@
   #include <windows.h>  // 'GetSystemInfo'
 #else
   #include <pthread.h>
-  #include <unistd.h>   // 'sysconf'
+  #include <unistd.h>   // 'sysconf', 'dup', 'dup2'
 #endif
 
 using namespace BloombergLP;
@@ -40,23 +42,39 @@ using namespace bsl;
 // of the component-level documentation).  'setjmp' and 'longjmp' are used in
 // conjunction with a signal handler to test that the guard pages are write-
 // protected.  (Care is taken to ensure that 'longjmp' does not by-pass the
-// destruction of any stack objects that are of user-defined type.)  Note that
-// since the 'bdlma::GuardingAllocator' constructor does not accept an optional
-// allocator argument, there is scant opportunity to use 'bslma::TestAllocator'
-// in this test driver.
+// destruction of any stack objects that are of user-defined type.)  In
+// sampling mode, the additional concerns are that only a bounded sample of
+// the allocations is guarded, that all others are passed to the upstream
+// allocator (a 'bslma::TestAllocator' in this test driver), and that faults on
+// sampled blocks are reported with the relevant stack traces.
 // ----------------------------------------------------------------------------
 // CREATORS
+// CLASS METHODS
+// [ 6] static int installFaultHandler();
+//
+// CREATORS
 // [ 2] GuardingAllocator(GuardPageLocation l = e_AFTER_USER_BLOCK);
+// [ 5] GuardingAllocator(int interval, int max, Allocator *ba = 0);
+// [ 5] GuardingAllocator(int, int, GuardPageLocation, Allocator *ba = 0);
 // [ 2] ~GuardingAllocator();
 //
 // MANIPULATORS
 // [ 3] void *allocate(bsls::Types::size_type size);
 // [ 3] void deallocate(void *address);
+//
+// ACCESSORS
+// [ 6] int formatFaultReport(char *buf, int len, const void *addr) const;
+// [ 5] int maxSampledBlocks() const;
+// [ 5] int numSampledBlocks() const;
+// [ 5] bsls::Types::Int64 numSampledAllocations() const;
+// [ 5] int sampleInterval() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 5] USAGE EXAMPLE
+// [ 7] USAGE EXAMPLE
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [ 4] CONCERN: The 'allocate' and 'deallocate' methods are thread-safe.
+// [ 5] CONCERN: Sampling mode guards a bounded sample of the allocations.
+// [ 6] CONCERN: Faults and invalid deallocations of sampled blocks reported.
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -160,7 +178,7 @@ bool causesMemoryFault(void *address, int offset, char value)
     // specified 'offset' from the specified 'address' causes a memory fault,
     // and 'false' otherwise.
 {
-    bool faultFlag = false;
+    volatile bool faultFlag = false;
 
     // Register a signal handler for the duration of this function.
 
@@ -448,6 +466,92 @@ extern "C" void *threadFunction3(void *arg)
 
 }  // close namespace TestCase4
 
+namespace TestCase5 {
+
+struct ThreadInfo {
+    int  d_numIterations;
+    Obj *d_obj_p;
+};
+
+extern "C" void *threadFunction(void *arg)
+{
+    ThreadInfo *info = (ThreadInfo *)arg;
+
+    Obj& mX = *info->d_obj_p;
+
+    void *blocks[8];
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        for (int j = 0; j < 8; ++j) {
+            const int n = 1 + (i * 8 + j) % 500;
+
+            blocks[j] = mX.allocate(n);  bsl::memset(blocks[j], 0xff, n);
+        }
+
+        for (int j = 0; j < 8; ++j) {
+            mX.deallocate(blocks[(j * 3) % 8]);
+        }
+    }
+
+    return arg;
+}
+
+}  // close namespace TestCase5
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+
+class StderrCapture {
+    // This class redirects 'stderr' (i.e., file descriptor 2) to a temporary
+    // file for the lifetime of an object, and provides access to the text
+    // written to it.
+
+    // DATA
+    FILE *d_file_p;          // temporary file
+    int   d_savedDescriptor; // duplicate of the original 'stderr'
+    char  d_text[8192];      // captured text
+
+  public:
+    // CREATORS
+    StderrCapture()
+    : d_file_p(tmpfile())
+    , d_savedDescriptor(dup(2))
+    {
+        ASSERT(d_file_p);
+
+        fflush(stderr);
+        dup2(fileno(d_file_p), 2);
+        d_text[0] = 0;
+    }
+
+    ~StderrCapture()
+    {
+        release();
+    }
+
+    // MANIPULATORS
+    const char *release()
+        // Restore 'stderr', and return the text written to it since the
+        // creation of this object.
+    {
+        if (d_file_p) {
+            fflush(stderr);
+            dup2(d_savedDescriptor, 2);
+            close(d_savedDescriptor);
+
+            rewind(d_file_p);
+            const size_t n = fread(d_text, 1, sizeof d_text - 1, d_file_p);
+            d_text[n] = 0;
+
+            fclose(d_file_p);
+            d_file_p = 0;
+        }
+
+        return d_text;
+    }
+};
+
+#endif
+
 // ============================================================================
 //                                USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -698,7 +802,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 5: {
+      case 7: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -805,6 +909,633 @@ int main(int argc, char *argv[])
 // program will dump core in a context that is more proximate to the buggy
 // code, resulting in a core file that will be more amenable to revealing the
 // issue when analyzed in a debugger.
+//
+///Example 2: Sampling Memory Errors in Production
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// The guarding allocator of {Example 1} consumes at least two memory pages,
+// and a pair of system calls, for each allocation, so it cannot remain in
+// place once the program is released.  A guarding allocator in sampling mode,
+// by contrast, is cheap enough to be left in place under real load, where it
+// will eventually catch the rare allocation that is misused.
+//
+// First, at program start-up, we install the fault handler so that a fault in
+// a sampled block is reported to 'stderr' along with the stack traces of the
+// block's allocation (and deallocation, if any):
+//..
+    bdlma::GuardingAllocator::installFaultHandler();
+//..
+// Then, we create a guarding allocator that samples approximately one in every
+// 1000 allocations into at most 64 guarded slots, and passes every other
+// allocation to an upstream allocator (here, a test allocator):
+//..
+    bslma::TestAllocator     upstream;
+    bdlma::GuardingAllocator sampler(1000, 64, &upstream);
+//..
+// Next, we use 'sampler' to supply memory to several data handlers.  Most of
+// the handlers obtain their memory from 'upstream', but some of their buffers
+// are guarded:
+//..
+    for (int i = 0; i < 100; ++i) {
+        my_DataHandler handler(input, 16, e_STYLE_A, &sampler);
+    }
+    ASSERT(0 == sampler.numSampledBlocks());
+//..
+// Should one of those handlers call the buggy 'generateAlternate' method, and
+// its buffer be one of the sampled ones, the program faults at the offending
+// write and the handler installed above describes the buffer overrun and the
+// stack trace of the allocation that was overrun.
+//
+// Finally, we note that the same report can be rendered on demand, for an
+// address that is known to be suspicious, using 'formatFaultReport'.  Here we
+// request a report for the byte just past a block that is guaranteed to be
+// sampled, as it is allocated from a guarding allocator that samples every
+// allocation:
+//..
+    bdlma::GuardingAllocator everyAllocation(1, 1, &upstream);
+
+    char *block = static_cast<char *>(everyAllocation.allocate(16));
+
+    char report[2048];
+    int  length = everyAllocation.formatFaultReport(report,
+                                                    sizeof report,
+                                                    block + 16);
+    ASSERT(0 < length);
+    ASSERT(0 != bsl::strstr(report, "buffer overflow"));
+
+    everyAllocation.deallocate(block);
+//..
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // FAULT REPORTS
+        //   Ensure that faults on, and invalid deallocations of, sampled
+        //   blocks are reported with the relevant stack traces.
+        //
+        // Concerns:
+        //: 1 'formatFaultReport' returns 0, with no effect, for an address
+        //:   outside the pool, and for an allocator not in sampling mode.
+        //:
+        //: 2 'formatFaultReport' classifies an address just past, just
+        //:   before, within, and within the freed slot of a sampled block,
+        //:   and an address far from any sampled block.
+        //:
+        //: 3 The report includes the allocating thread and stack trace, and,
+        //:   once the block is deallocated, the deallocating thread and stack
+        //:   trace.
+        //:
+        //: 4 The report is null-terminated and truncated to fit the buffer.
+        //:
+        //: 5 The fault handler installed by 'installFaultHandler' writes the
+        //:   report for a fault within a pool to 'stderr', then defers to the
+        //:   previously installed handler.
+        //:
+        //: 6 The fault handler passes a fault outside every pool directly to
+        //:   the previously installed handler.
+        //:
+        //: 7 Deallocating a sampled block twice is reported, and causes
+        //:   'BSLS_ASSERT_OPT' to fail.
+        //
+        // Plan:
+        //: 1 Using sampling allocators that sample every allocation, call
+        //:   'formatFaultReport' for addresses in the various relations to a
+        //:   sampled block, and verify the classification, offset, and stack
+        //:   traces in the report.  (C-1..4)
+        //:
+        //: 2 Install a test signal handler, then the fault handler, and
+        //:   overrun a sampled block with 'stderr' redirected to a file.
+        //:   Verify that the report is written, that the test handler is
+        //:   invoked, and that it is reinstated.  (C-5)
+        //:
+        //: 3 Repeat P-2 for a guard page of an allocator not in sampling
+        //:   mode, and verify that nothing is written.  (C-6)
+        //:
+        //: 4 Install a test assertion handler, deallocate a sampled block
+        //:   twice, and verify the report and the assertion failure.  (C-7)
+        //
+        // Testing:
+        //   static int installFaultHandler();
+        //   int formatFaultReport(char *buf, int len, const void *addr) const;
+        //   CONCERN: Faults and invalid deallocations of sampled blocks
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FAULT REPORTS" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator ta("upstream", veryVeryVeryVerbose);
+
+        char buffer[4096];
+
+        if (verbose) cout << "\nAddresses outside a pool." << endl;
+        {
+            Obj mX(1, 2, &ta);  const Obj& X = mX;
+            Obj mY;             const Obj& Y = mY;
+
+            char  local   = 0;
+            void *largeP  = mX.allocate(pageSize + 1);
+            void *guarded = mY.allocate(16);
+
+            ASSERT(0 == X.formatFaultReport(buffer, sizeof buffer, &local));
+            ASSERT(0 == X.formatFaultReport(buffer, sizeof buffer, largeP));
+            ASSERT(0 == Y.formatFaultReport(buffer, sizeof buffer, guarded));
+
+            mX.deallocate(largeP);
+            mY.deallocate(guarded);
+        }
+
+        if (verbose) cout << "\nClassification of addresses." << endl;
+        {
+            Obj mX(1, 3, Obj::e_AFTER_USER_BLOCK,  &ta);  const Obj& X = mX;
+            Obj mY(1, 3, Obj::e_BEFORE_USER_BLOCK, &ta);  const Obj& Y = mY;
+
+            char *p = static_cast<char *>(mX.allocate(16));
+            char *q = static_cast<char *>(mY.allocate(16));
+
+            int length = X.formatFaultReport(buffer, sizeof buffer, p + 16);
+
+            if (veryVerbose) cout << buffer;
+
+            ASSERTV(length, 0 < length);
+            ASSERT(static_cast<int>(bsl::strlen(buffer)) == length);
+            ASSERT(bsl::strstr(buffer, "buffer overflow"));
+            ASSERT(bsl::strstr(buffer, "0 bytes after the 16-byte block"));
+            ASSERT(bsl::strstr(buffer, "allocated by thread"));
+            ASSERT(bsl::strstr(buffer, "#0 0x"));
+            ASSERT(!bsl::strstr(buffer, "deallocated"));
+
+            ASSERT(0 < X.formatFaultReport(buffer, sizeof buffer, p + 100));
+            ASSERT(bsl::strstr(buffer, "84 bytes after the 16-byte block"));
+
+            ASSERT(0 < X.formatFaultReport(buffer, sizeof buffer, p + 5));
+            ASSERT(bsl::strstr(buffer, "5 bytes inside the 16-byte block"));
+
+            ASSERT(0 < Y.formatFaultReport(buffer, sizeof buffer, q - 1));
+            ASSERT(bsl::strstr(buffer, "buffer underflow"));
+            ASSERT(bsl::strstr(buffer, "1 bytes before the 16-byte block"));
+
+            // The last slot has never been used, and is far from 'p'.
+
+            ASSERT(0 < X.formatFaultReport(buffer,
+                                           sizeof buffer,
+                                           p + 4 * pageSize));
+            ASSERT(bsl::strstr(buffer, "wild access"));
+
+            if (veryVerbose) cout << "\tTruncation." << endl;
+
+            ASSERT(9 == X.formatFaultReport(buffer, 10, p + 16));
+            ASSERT(0 == buffer[9]);
+            ASSERT(0 == bsl::strcmp(buffer, "bdlma::Gu"));
+
+            if (veryVerbose) cout << "\tUse after free." << endl;
+
+            mX.deallocate(p);
+
+            length = X.formatFaultReport(buffer, sizeof buffer, p);
+
+            if (veryVerbose) cout << buffer;
+
+            ASSERTV(length, 0 < length);
+            ASSERT(bsl::strstr(buffer, "use after free"));
+            ASSERT(bsl::strstr(buffer, "allocated by thread"));
+            ASSERT(bsl::strstr(buffer, "deallocated by thread"));
+
+            mY.deallocate(q);
+        }
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+        if (verbose) cout << "\nThe fault handler." << endl;
+        {
+            Obj mX(1, 2, &ta);
+
+            char *p = static_cast<char *>(mX.allocate(16));
+
+            signal(SIGSEGV, signalHandler);
+            signal(SIGBUS,  signalHandler);
+
+            ASSERT(0 == Obj::installFaultHandler());
+            ASSERT(0 == Obj::installFaultHandler());
+
+            StderrCapture capture;
+
+            g_withinTestFlag = true;
+
+            volatile bool faultFlag = false;
+
+            if (0 == sigsetjmp(g_jumpBuffer, 1)) {
+                p[16] = 'x';
+            }
+            else {
+                faultFlag = true;
+            }
+
+            g_withinTestFlag = false;
+
+            const char *text = capture.release();
+
+            if (veryVerbose) cout << text;
+
+            ASSERT(faultFlag);
+            ASSERT(bsl::strstr(text, "buffer overflow"));
+            ASSERT(bsl::strstr(text, "allocated by thread"));
+
+            struct sigaction current;
+            sigaction(SIGSEGV, 0, &current);
+            ASSERT(signalHandler == current.sa_handler);
+
+            mX.deallocate(p);
+
+            if (veryVerbose) cout << "\tFault outside every pool." << endl;
+
+            Obj mY;
+
+            char *q = static_cast<char *>(mY.allocate(16));
+
+            ASSERT(0 == Obj::installFaultHandler());
+
+            StderrCapture otherCapture;
+
+            g_withinTestFlag = true;
+
+            faultFlag = false;
+
+            if (0 == sigsetjmp(g_jumpBuffer, 1)) {
+                q[16] = 'x';
+            }
+            else {
+                faultFlag = true;
+            }
+
+            g_withinTestFlag = false;
+
+            ASSERT(faultFlag);
+            ASSERT(0 == bsl::strlen(otherCapture.release()));
+
+            mY.deallocate(q);
+
+            signal(SIGSEGV, SIG_DFL);
+            signal(SIGBUS,  SIG_DFL);
+        }
+#endif
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nDouble free." << endl;
+        {
+            Obj mX(1, 2, &ta);
+
+            void *p = mX.allocate(16);
+            mX.deallocate(p);
+
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            bool assertFlag = false;
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+            StderrCapture capture;
+#endif
+            try {
+                mX.deallocate(p);
+            }
+            catch (const bsls::AssertTestException&) {
+                assertFlag = true;
+            }
+
+            ASSERT(assertFlag);
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+            const char *text = capture.release();
+
+            if (veryVerbose) cout << text;
+
+            ASSERT(bsl::strstr(text, "double free"));
+            ASSERT(bsl::strstr(text, "deallocated by thread"));
+#endif
+        }
+#endif
+
+        ASSERT(0 == ta.numBlocksInUse());
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // SAMPLING MODE
+        //   Ensure that a guarding allocator in sampling mode guards a sample
+        //   of the allocations from a bounded pool, and passes all others to
+        //   the upstream allocator.
+        //
+        // Concerns:
+        //: 1 The sampling constructors configure the allocator as specified,
+        //:   obtain the bookkeeping from the upstream allocator, and the
+        //:   destructor returns it.
+        //:
+        //: 2 Sampled blocks are maximally aligned, writable, and adjoin a
+        //:   guard page after ('e_AFTER_USER_BLOCK') or before
+        //:   ('e_BEFORE_USER_BLOCK') them.
+        //:
+        //: 3 Requests larger than a page, and requests made while every slot
+        //:   is in use, are satisfied by the upstream allocator.
+        //:
+        //: 4 A deallocated sampled block is read/write protected, and its slot
+        //:   is reused only after every slot freed before it.
+        //:
+        //: 5 Approximately one in every 'sampleInterval' requests is sampled.
+        //:
+        //: 6 'allocate' and 'deallocate' are thread-safe in sampling mode.
+        //:
+        //: 7 An allocator not in sampling mode reports 0 for all sampling
+        //:   attributes.
+        //:
+        //: 8 The sampling of one allocator is not affected by allocations from
+        //:   another.
+        //:
+        //: 9 An allocator constructed in sampling mode while
+        //:   'k_MAX_SAMPLING_ALLOCATORS' others exist passes every request to
+        //:   the upstream allocator, and later ones sample again once one of
+        //:   the others is destroyed.
+        //
+        // Plan:
+        //: 1 Create sampling allocators that sample every allocation, verify
+        //:   their attributes and the upstream allocator's usage.  (C-1, 7)
+        //:
+        //: 2 Exhaust the pool with requests of several sizes, verifying the
+        //:   alignment and guard page of each block, then verify that further
+        //:   requests, and requests larger than a page, are passed upstream.
+        //:   (C-2..3)
+        //:
+        //: 3 Deallocate sampled blocks in a known order, verify that they
+        //:   are protected, and that subsequent allocations reuse their slots
+        //:   in the same order.  (C-4)
+        //:
+        //: 4 Allocate and deallocate many blocks from an allocator having a
+        //:   sampling interval of 10, and verify the number of sampled
+        //:   allocations.  (C-5)
+        //:
+        //: 5 Allocate and deallocate from several threads.  (C-6)
+        //:
+        //: 6 Interleave the allocations from an allocator having a sampling
+        //:   interval of 10 with those from an allocator having a very long
+        //:   interval, and verify the number of sampled allocations of each.
+        //:   (C-8)
+        //:
+        //: 7 Create 'k_MAX_SAMPLING_ALLOCATORS' allocators sampling every
+        //:   allocation, verify that one more allocator samples none, and that
+        //:   an allocator created after destroying one of the others samples
+        //:   every allocation.  (C-9)
+        //
+        // Testing:
+        //   GuardingAllocator(int interval, int max, Allocator *ba = 0);
+        //   GuardingAllocator(int, int, GuardPageLocation, Allocator *ba = 0);
+        //   int maxSampledBlocks() const;
+        //   int numSampledBlocks() const;
+        //   bsls::Types::Int64 numSampledAllocations() const;
+        //   int sampleInterval() const;
+        //   CONCERN: Sampling mode guards a bounded sample of the allocations.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SAMPLING MODE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator ta("upstream", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\nAttributes." << endl;
+        {
+            const Obj X;
+
+            ASSERT(0 == X.sampleInterval());
+            ASSERT(0 == X.maxSampledBlocks());
+            ASSERT(0 == X.numSampledBlocks());
+            ASSERT(0 == X.numSampledAllocations());
+
+            const Obj Y(1, 4, &ta);
+
+            ASSERT(1 == Y.sampleInterval());
+            ASSERT(4 == Y.maxSampledBlocks());
+            ASSERT(0 == Y.numSampledBlocks());
+            ASSERT(0 == Y.numSampledAllocations());
+            ASSERT(0 <  ta.numBlocksInUse());
+
+            const Obj Z(100, 8, Obj::e_BEFORE_USER_BLOCK);
+
+            ASSERT(100 == Z.sampleInterval());
+            ASSERT(  8 == Z.maxSampledBlocks());
+            ASSERT(0 <  da.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\nGuarded blocks and the upstream allocator."
+                          << endl;
+
+        const int NUM_SLOTS = 4;
+
+        for (int li = 0; li < 2; ++li) {
+            const Enum LOCATION = 0 == li ? Obj::e_AFTER_USER_BLOCK
+                                          : Obj::e_BEFORE_USER_BLOCK;
+
+            if (veryVerbose) { T_ P(LOCATION) }
+
+            Obj mX(1, NUM_SLOTS, LOCATION, &ta);  const Obj& X = mX;
+
+            const bsls::Types::Int64 NUM_BOOKKEEPING = ta.numBlocksInUse();
+
+            const int SIZES[NUM_SLOTS] = { 1, 16, 100, pageSize };
+
+            void *blocks[NUM_SLOTS];
+
+            for (int i = 0; i < NUM_SLOTS; ++i) {
+                const int SIZE    = SIZES[i];
+                const int ROUNDED = static_cast<int>(
+                        bsls::AlignmentUtil::roundUpToMaximalAlignment(SIZE));
+
+                char *p = static_cast<char *>(mX.allocate(SIZE));
+
+                blocks[i] = p;
+
+                ASSERTV(i, NUM_BOOKKEEPING == ta.numBlocksInUse());
+                const int MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+                ASSERTV(i, 0 == bsls::AlignmentUtil::calculateAlignmentOffset(
+                                                                 p,
+                                                                 MAX_ALIGN));
+                ASSERTV(i, i + 1 == X.numSampledBlocks());
+                ASSERTV(i, i + 1 == X.numSampledAllocations());
+
+                bsl::memset(p, 0xff, SIZE);
+
+                if (Obj::e_AFTER_USER_BLOCK == LOCATION) {
+                    ASSERTV(i, causesMemoryFault(p, ROUNDED, 'x'));
+                }
+                else {
+                    ASSERTV(i, causesMemoryFault(p, -1, 'x'));
+                }
+            }
+
+            void *u1 = mX.allocate(8);
+            void *u2 = mX.allocate(pageSize + 1);
+
+            ASSERT(NUM_BOOKKEEPING + 2 == ta.numBlocksInUse());
+            ASSERT(NUM_SLOTS           == X.numSampledBlocks());
+            ASSERT(NUM_SLOTS           == X.numSampledAllocations());
+
+            char buffer[16];
+            ASSERT(0 == X.formatFaultReport(buffer, sizeof buffer, u1));
+
+            mX.deallocate(u1);
+            mX.deallocate(u2);
+
+            ASSERT(NUM_BOOKKEEPING == ta.numBlocksInUse());
+
+            if (veryVerbose) cout << "\tDeallocation and reuse." << endl;
+
+            mX.deallocate(blocks[2]);
+            mX.deallocate(blocks[0]);
+
+            ASSERT(NUM_SLOTS - 2 == X.numSampledBlocks());
+
+            ASSERT(causesMemoryFault(blocks[2], 0, 'x'));
+            ASSERT(causesMemoryFault(blocks[0], 0, 'x'));
+
+            // The slot of 'blocks[2]' was freed first, so is reused first.
+
+            void *p2 = mX.allocate(100);
+            void *p0 = mX.allocate(1);
+
+            ASSERT(blocks[2] == p2);
+            ASSERT(blocks[0] == p0);
+            ASSERT(NUM_SLOTS == X.numSampledBlocks());
+            ASSERT(NUM_SLOTS + 2 == X.numSampledAllocations());
+
+            for (int i = 0; i < NUM_SLOTS; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+
+            ASSERT(0 == X.numSampledBlocks());
+            ASSERT(NUM_BOOKKEEPING == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nSampling interval." << endl;
+        {
+            const int NUM_ALLOCATIONS = 10000;
+
+            Obj mX(10, 1, &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < NUM_ALLOCATIONS; ++i) {
+                mX.deallocate(mX.allocate(8));
+            }
+
+            if (veryVerbose) { T_ P(X.numSampledAllocations()) }
+
+            ASSERTV(X.numSampledAllocations(),
+                    NUM_ALLOCATIONS / 20 < X.numSampledAllocations());
+            ASSERTV(X.numSampledAllocations(),
+                    NUM_ALLOCATIONS / 5  > X.numSampledAllocations());
+            ASSERT(0 == X.numSampledBlocks());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nConcurrency." << endl;
+        {
+            using namespace TestCase5;
+
+            Obj mX(2, 8, &ta);  const Obj& X = mX;
+
+            ThreadInfo info = { 200, &mX };
+
+            ThreadId id1 = createThread(&threadFunction, &info);
+            ThreadId id2 = createThread(&threadFunction, &info);
+            ThreadId id3 = createThread(&threadFunction, &info);
+
+            joinThread(id1);
+            joinThread(id2);
+            joinThread(id3);
+
+            ASSERT(0 <  X.numSampledAllocations());
+            ASSERT(0 == X.numSampledBlocks());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nIndependent sampling intervals." << endl;
+        {
+            const int NUM_ALLOCATIONS = 10000;
+
+            Obj mX(10,      1, &ta);  const Obj& X = mX;
+            Obj mY(1 << 30, 1, &ta);  const Obj& Y = mY;
+
+            for (int i = 0; i < NUM_ALLOCATIONS; ++i) {
+                mX.deallocate(mX.allocate(8));
+                mY.deallocate(mY.allocate(8));
+            }
+
+            if (veryVerbose) {
+                T_ P_(X.numSampledAllocations()) P(Y.numSampledAllocations())
+            }
+
+            ASSERTV(X.numSampledAllocations(),
+                    NUM_ALLOCATIONS / 20 < X.numSampledAllocations());
+            ASSERTV(X.numSampledAllocations(),
+                    NUM_ALLOCATIONS / 5  > X.numSampledAllocations());
+            ASSERTV(Y.numSampledAllocations(),
+                    0 == Y.numSampledAllocations());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nMaximum number of sampling allocators."
+                          << endl;
+        {
+            const int MAX = Obj::k_MAX_SAMPLING_ALLOCATORS;
+
+            Obj *allocators[MAX];
+
+            for (int i = 0; i < MAX; ++i) {
+                allocators[i] = new (ta) Obj(1, 1, &ta);
+
+                ASSERTV(i, 0 != allocators[i]->allocate(8));
+                ASSERTV(i, 1 == allocators[i]->numSampledAllocations());
+            }
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+            {
+                Obj mX(1, 1, &ta);  const Obj& X = mX;
+
+                ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+
+                void *p = mX.allocate(8);
+
+                ASSERT(0              != p);
+                ASSERT(0              == X.numSampledAllocations());
+                ASSERT(0              == X.numSampledBlocks());
+                ASSERT(NUM_BLOCKS + 1 == ta.numBlocksInUse());
+
+                char buffer[16];
+                ASSERT(0 == X.formatFaultReport(buffer, sizeof buffer, p));
+
+                mX.deallocate(p);
+
+                ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+            }
+
+            ta.deleteObject(allocators[MAX / 2]);
+            {
+                Obj mX(1, 1, &ta);  const Obj& X = mX;
+
+                mX.deallocate(mX.allocate(8));
+
+                ASSERT(1 == X.numSampledAllocations());
+            }
+
+            for (int i = 0; i < MAX; ++i) {
+                if (MAX / 2 != i) {
+                    ta.deleteObject(allocators[i]);
+                }
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
 
       } break;
       case 4: {
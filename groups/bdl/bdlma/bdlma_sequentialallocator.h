@@ -24,7 +24,11 @@ BSLS_IDENT("$Id: $")
 //                |         allocateAndExpand
 //                |         reserveCapacity
 //                |         rewind
+//                |         setMaxIdleCapacity
+//                |         shrink
 //                |         truncate
+//                |         mark
+//                |         maxIdleCapacity
 //                V
 //    ,-----------------------.
 //   ( bdlma::ManagedAllocator )
@@ -92,6 +96,31 @@ BSLS_IDENT("$Id: $")
 // 'alignmentStrategy' is not specified, natural alignment is used.  See
 // 'bsls_alignment' for more details.
 //
+///Rewinding to a Mark
+///--------------------
+// The 'mark' accessor returns a mark recording the current state of the
+// allocator, and 'rewind(mark)' releases all memory allocated since then
+// (returning to the underlying allocator only the large blocks allocated
+// since then), leaving memory allocated before the mark untouched.  Marks
+// nest, so a long-lived allocator can serve as an arena with *savepoints*:
+// rewinding to a mark invalidates all marks taken after it, but not those
+// taken before it.  Note that 'release' and 'rewind()' invalidate all marks.
+// See {'bdlma_sequentialpool'|Marks and Rewinding}.
+//
+///Returning Idle Memory
+///---------------------
+// Rewinding does not return the internal buffers of the allocator to the
+// underlying allocator, so an allocator that grew to satisfy one unusually
+// large burst of allocations would otherwise hold that memory until it is
+// released or destroyed.  The 'shrink' method returns internal buffers that
+// are not currently used to satisfy any allocation (i.e., *idle* buffers),
+// largest first, until at most a specified number of idle bytes remain.  In
+// addition, 'setMaxIdleCapacity' installs a policy under which every call to
+// either 'rewind' overload is followed by 'shrink(maxIdleCapacity())', so that
+// the allocator retains no more idle memory than the configured watermark
+// once its usage falls.  By default, no limit is imposed, and the allocator
+// retains all of its internal buffers until 'release' is called.
+//
 ///Usage
 ///-----
 // Allocators are often supplied, at construction, to objects requiring
@@ -209,6 +238,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_review.h>
 #include <bsls_types.h>
 
+#include <bsl_limits.h>
+
 namespace BloombergLP {
 namespace bdlma {
 
@@ -230,14 +261,28 @@ class SequentialAllocator : public ManagedAllocator {
     // construction.
 
     // DATA
-    SequentialPool d_sequentialPool;  // manager for allocated memory blocks
+    SequentialPool         d_sequentialPool;   // manager for allocated memory
+                                               // blocks
+
+    bsls::Types::size_type d_maxIdleCapacity;  // upper bound on idle memory
+                                               // retained after a 'rewind'
 
   private:
+    // PRIVATE MANIPULATORS
+    void applyMaxIdleCapacity();
+        // Return idle memory to the underlying allocator as necessary so that
+        // at most 'maxIdleCapacity()' bytes of it remain.
+
     // NOT IMPLEMENTED
     SequentialAllocator(const SequentialAllocator&);
     SequentialAllocator& operator=(const SequentialAllocator&);
 
   public:
+    // PUBLIC TYPES
+    typedef SequentialPool::Mark Mark;
+        // 'Mark' is an alias for the type recording the state of this
+        // allocator, to which it can be rewound.
+
     // CREATORS
     explicit SequentialAllocator(bslma::Allocator *basicAllocator = 0);
     explicit SequentialAllocator(
@@ -373,6 +418,35 @@ class SequentialAllocator : public ManagedAllocator {
         // 'rewind' - using a pointer obtained from this object prior to this
         // call to 'rewind' is undefined.
 
+    void rewind(const Mark& mark);
+        // Release all memory allocated through this allocator since the
+        // specified 'mark' was obtained from 'mark()', and return to the
+        // underlying allocator *only* the large blocks allocated since then;
+        // then, if a maximum idle capacity has been set, return idle memory to
+        // the underlying allocator as by 'shrink(maxIdleCapacity())'.  Memory
+        // allocated before 'mark' was obtained is unaffected.  Marks obtained
+        // after 'mark' are invalidated.  The effect of subsequently - to this
+        // invocation of 'rewind' - using a pointer obtained from this object
+        // after 'mark' was obtained is undefined.  The behavior is undefined
+        // unless 'mark' was obtained from this allocator, and neither
+        // 'release', 'rewind()', nor 'rewind' with a mark obtained before
+        // 'mark' has been called since.
+
+    void setMaxIdleCapacity(bsls::Types::size_type numBytes);
+        // Set the maximum number of bytes of idle memory (i.e., memory
+        // retained by this allocator but not used to satisfy any allocation)
+        // that this allocator retains following a call to either 'rewind'
+        // overload to the specified 'numBytes'.  Note that this method does
+        // not itself return any memory; see 'shrink'.
+
+    void shrink(bsls::Types::size_type maxIdleBytes = 0);
+        // Return to the underlying allocator internal buffers that are
+        // retained by this allocator but not currently used to satisfy any
+        // allocation, largest first, until at most the optionally specified
+        // 'maxIdleBytes' of such memory remain.  If 'maxIdleBytes' is not
+        // specified, all idle internal buffers are returned.  Outstanding
+        // allocations, and marks that remain valid, are unaffected.
+
     void reserveCapacity(bsls::Types::size_type numBytes);
         // Reserve sufficient memory to satisfy allocation requests for at
         // least the specified 'numBytes' without replenishment (i.e., without
@@ -396,6 +470,18 @@ class SequentialAllocator : public ManagedAllocator {
         // at 'address' is 'originalSize', 'newSize <= originalSize', and
         // 'release' was not called after allocating the memory block at
         // 'address'.
+
+    // ACCESSORS
+    Mark mark() const;
+        // Return a mark recording the current state of this allocator, such
+        // that supplying it to 'rewind' releases all memory allocated after
+        // this call.
+
+    bsls::Types::size_type maxIdleCapacity() const;
+        // Return the maximum number of bytes of idle memory that this
+        // allocator retains following a call to either 'rewind' overload.  If
+        // 'setMaxIdleCapacity' has not been called, return
+        // 'bsl::numeric_limits<bsls::Types::size_type>::max()'.
 };
 
 // ============================================================================
@@ -411,6 +497,7 @@ inline
 SequentialAllocator::
 SequentialAllocator(bslma::Allocator *basicAllocator)
 : d_sequentialPool(basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
 }
 
@@ -419,6 +506,7 @@ SequentialAllocator::
 SequentialAllocator(bsls::BlockGrowth::Strategy  growthStrategy,
                     bslma::Allocator            *basicAllocator)
 : d_sequentialPool(growthStrategy, basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
 }
 
@@ -427,6 +515,7 @@ SequentialAllocator::
 SequentialAllocator(bsls::Alignment::Strategy  alignmentStrategy,
                     bslma::Allocator          *basicAllocator)
 : d_sequentialPool(alignmentStrategy, basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
 }
 
@@ -436,6 +525,7 @@ SequentialAllocator(bsls::BlockGrowth::Strategy  growthStrategy,
                     bsls::Alignment::Strategy    alignmentStrategy,
                     bslma::Allocator            *basicAllocator)
 : d_sequentialPool(growthStrategy, alignmentStrategy, basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
 }
 
@@ -443,6 +533,7 @@ inline
 SequentialAllocator::
 SequentialAllocator(int initialSize)
 : d_sequentialPool(initialSize)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
     BSLS_ASSERT(0 < initialSize);
 }
@@ -452,6 +543,7 @@ SequentialAllocator::
 SequentialAllocator(bsls::Types::size_type  initialSize,
                     bslma::Allocator       *basicAllocator)
 : d_sequentialPool(initialSize, basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
     BSLS_ASSERT(0 < initialSize);
 }
@@ -462,6 +554,7 @@ SequentialAllocator(bsls::Types::size_type       initialSize,
                     bsls::BlockGrowth::Strategy  growthStrategy,
                     bslma::Allocator            *basicAllocator)
 : d_sequentialPool(initialSize, growthStrategy, basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
     BSLS_ASSERT(0 < initialSize);
 }
@@ -472,6 +565,7 @@ SequentialAllocator(bsls::Types::size_type     initialSize,
                     bsls::Alignment::Strategy  alignmentStrategy,
                     bslma::Allocator          *basicAllocator)
 : d_sequentialPool(initialSize, alignmentStrategy, basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
     BSLS_ASSERT(0 < initialSize);
 }
@@ -486,6 +580,7 @@ SequentialAllocator(bsls::Types::size_type       initialSize,
                    growthStrategy,
                    alignmentStrategy,
                    basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
     BSLS_ASSERT(0 < initialSize);
 }
@@ -496,6 +591,7 @@ SequentialAllocator(bsls::Types::size_type  initialSize,
                     bsls::Types::size_type  maxBufferSize,
                     bslma::Allocator       *basicAllocator)
 : d_sequentialPool(initialSize, maxBufferSize, basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
     BSLS_ASSERT(0 < initialSize);
     BSLS_ASSERT(initialSize <= maxBufferSize);
@@ -508,6 +604,7 @@ SequentialAllocator(bsls::Types::size_type       initialSize,
                     bsls::BlockGrowth::Strategy  growthStrategy,
                     bslma::Allocator            *basicAllocator)
 : d_sequentialPool(initialSize, maxBufferSize, growthStrategy, basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
     BSLS_ASSERT(0 < initialSize);
     BSLS_ASSERT(initialSize <= maxBufferSize);
@@ -523,6 +620,7 @@ SequentialAllocator(bsls::Types::size_type     initialSize,
                    maxBufferSize,
                    alignmentStrategy,
                    basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
     BSLS_ASSERT(0 < initialSize);
     BSLS_ASSERT(initialSize <= maxBufferSize);
@@ -540,11 +638,27 @@ SequentialAllocator(bsls::Types::size_type       initialSize,
                    growthStrategy,
                    alignmentStrategy,
                    basicAllocator)
+, d_maxIdleCapacity(bsl::numeric_limits<bsls::Types::size_type>::max())
 {
     BSLS_ASSERT(0 < initialSize);
     BSLS_ASSERT(initialSize <= maxBufferSize);
 }
 
+// PRIVATE MANIPULATORS
+inline
+void SequentialAllocator::applyMaxIdleCapacity()
+{
+    const bsls::Types::size_type k_UNLIMITED =
+                            bsl::numeric_limits<bsls::Types::size_type>::max();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                           d_maxIdleCapacity != k_UNLIMITED)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_sequentialPool.shrink(d_maxIdleCapacity);
+    }
+}
+
 // MANIPULATORS
 inline
 void *SequentialAllocator::allocate(bsls::Types::size_type size)
@@ -579,6 +693,28 @@ inline
 void SequentialAllocator::rewind()
 {
     d_sequentialPool.rewind();
+
+    applyMaxIdleCapacity();
+}
+
+inline
+void SequentialAllocator::rewind(const Mark& mark)
+{
+    d_sequentialPool.rewind(mark);
+
+    applyMaxIdleCapacity();
+}
+
+inline
+void SequentialAllocator::setMaxIdleCapacity(bsls::Types::size_type numBytes)
+{
+    d_maxIdleCapacity = numBytes;
+}
+
+inline
+void SequentialAllocator::shrink(bsls::Types::size_type maxIdleBytes)
+{
+    d_sequentialPool.shrink(maxIdleBytes);
 }
 
 inline
@@ -590,6 +726,20 @@ bsls::Types::size_type SequentialAllocator::truncate(
     return d_sequentialPool.truncate(address, originalSize, newSize);
 }
 
+
+// ACCESSORS
+inline
+SequentialAllocator::Mark SequentialAllocator::mark() const
+{
+    return d_sequentialPool.mark();
+}
+
+inline
+bsls::Types::size_type SequentialAllocator::maxIdleCapacity() const
+{
+    return d_maxIdleCapacity;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
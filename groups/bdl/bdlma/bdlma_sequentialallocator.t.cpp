@@ -13,6 +13,7 @@
 
 #include <bsl_cstdlib.h>
 #include <bsl_iostream.h>
+#include <bsl_limits.h>
 
 #undef GS  // Solaris 2.10 x86 /usr/include/sys/regset.h
 
@@ -76,11 +77,18 @@ using namespace bsl;
 // [ 3] void deallocate(void *address);
 // [ 4] void release();
 // [ 5] void rewind();
+// [ 8] void rewind(const Mark& mark);
+// [ 8] void setMaxIdleCapacity(size_type numBytes);
+// [ 8] void shrink(size_type maxIdleBytes = 0);
 // [ 7] void reserveCapacity(int numBytes);
 // [ 6] int truncate(void *address, int originalSize, int newSize);
+//
+// // ACCESSORS
+// [ 8] Mark mark() const;
+// [ 8] size_type maxIdleCapacity() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE TEST
+// [ 9] USAGE TEST
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -286,7 +294,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -316,6 +324,194 @@ int main(int argc, char *argv[])
         my_DoubleStack dstack(&sequentialAlloc);
 //..
 
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING 'mark', 'rewind(mark)', 'shrink', AND 'setMaxIdleCapacity'
+        //
+        // Concerns:
+        //: 1 'maxIdleCapacity' is initially unlimited, and reflects the value
+        //:   most recently supplied to 'setMaxIdleCapacity'.
+        //:
+        //: 2 'rewind(mark)' does not return memory to the underlying
+        //:   allocator while 'maxIdleCapacity' is unlimited, and subsequent
+        //:   allocations reproduce the addresses returned after the mark was
+        //:   obtained.
+        //:
+        //: 3 'shrink' returns idle memory to the underlying allocator, and
+        //:   retains at most the requested amount of idle memory.
+        //:
+        //: 4 Both 'rewind' overloads return idle memory in excess of
+        //:   'maxIdleCapacity' to the underlying allocator.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify the default value of 'maxIdleCapacity', set a sequence of
+        //:   values, and verify the accessor after each.  (C-1)
+        //:
+        //: 2 Using a test allocator, obtain a mark, allocate enough memory to
+        //:   grow the allocator several times, rewind to the mark, and verify
+        //:   that no memory was deallocated and that repeating the
+        //:   allocations yields the same addresses.  (C-2)
+        //:
+        //: 3 Rewind, invoke 'shrink' with a positive value and then with no
+        //:   argument, and verify the memory in use by the test allocator
+        //:   after each.  (C-3)
+        //:
+        //: 4 Repeat P-2 and P-3 having first set 'maxIdleCapacity', and
+        //:   verify that 'rewind' and 'rewind(mark)' shrink the allocator.
+        //:   (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a default-constructed mark.  (C-5)
+        //
+        // Testing:
+        //   void rewind(const Mark& mark);
+        //   void setMaxIdleCapacity(size_type numBytes);
+        //   void shrink(size_type maxIdleBytes = 0);
+        //   Mark mark() const;
+        //   size_type maxIdleCapacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+               << "TESTING 'mark', 'rewind(mark)', 'shrink', AND "
+                  "'setMaxIdleCapacity'" << endl
+               << "=============================================="
+                  "====================" << endl;
+
+        typedef bsls::Types::size_type size_type;
+
+        enum { k_INITIAL_SIZE = 64, k_NUM_ALLOCS = 32, k_ALLOC_SIZE = 64 };
+
+        if (verbose) cout << "\nTesting 'maxIdleCapacity'." << endl;
+        {
+            Obj mX(&objectAllocator);  const Obj& X = mX;
+
+            ASSERT(bsl::numeric_limits<size_type>::max() ==
+                                                         X.maxIdleCapacity());
+
+            mX.setMaxIdleCapacity(0);
+            ASSERT(0 == X.maxIdleCapacity());
+
+            mX.setMaxIdleCapacity(1024);
+            ASSERT(1024 == X.maxIdleCapacity());
+
+            mX.setMaxIdleCapacity(bsl::numeric_limits<size_type>::max());
+            ASSERT(bsl::numeric_limits<size_type>::max() ==
+                                                         X.maxIdleCapacity());
+        }
+
+        if (verbose) cout << "\nTesting 'rewind(mark)' and 'shrink'." << endl;
+        {
+            Obj mX(k_INITIAL_SIZE, &objectAllocator);  const Obj& X = mX;
+
+            void *addr[k_NUM_ALLOCS];
+
+            mX.allocate(k_ALLOC_SIZE);
+
+            const Obj::Mark M = X.mark();
+
+            for (int i = 0; i < k_NUM_ALLOCS; ++i) {
+                addr[i] = mX.allocate(k_ALLOC_SIZE);
+            }
+
+            const bsls::Types::Int64 NUM_BLOCKS =
+                                             objectAllocator.numBlocksInUse();
+            const bsls::Types::Int64 NUM_BYTES  =
+                                              objectAllocator.numBytesInUse();
+            ASSERTV(NUM_BLOCKS, 2 < NUM_BLOCKS);
+
+            mX.rewind(M);
+            ASSERT(NUM_BLOCKS == objectAllocator.numBlocksInUse());
+
+            for (int i = 0; i < k_NUM_ALLOCS; ++i) {
+                ASSERTV(i, addr[i] == mX.allocate(k_ALLOC_SIZE));
+            }
+            ASSERT(NUM_BLOCKS == objectAllocator.numBlocksInUse());
+
+            mX.shrink();  // nothing is idle
+            ASSERT(NUM_BLOCKS == objectAllocator.numBlocksInUse());
+
+            mX.rewind(M);
+
+            mX.shrink(bsl::numeric_limits<size_type>::max());
+            ASSERT(NUM_BLOCKS == objectAllocator.numBlocksInUse());
+
+            mX.shrink(k_ALLOC_SIZE * k_NUM_ALLOCS / 2);
+            ASSERT(NUM_BLOCKS >  objectAllocator.numBlocksInUse());
+            ASSERT(NUM_BYTES  >  objectAllocator.numBytesInUse());
+
+            const bsls::Types::Int64 NUM_BYTES_AFTER_SHRINK =
+                                              objectAllocator.numBytesInUse();
+            ASSERTV(NUM_BYTES - NUM_BYTES_AFTER_SHRINK,
+                    k_ALLOC_SIZE * k_NUM_ALLOCS / 2 <=
+                                           NUM_BYTES - NUM_BYTES_AFTER_SHRINK);
+
+            mX.shrink();
+            ASSERT(NUM_BYTES_AFTER_SHRINK > objectAllocator.numBytesInUse());
+            ASSERT(0 < objectAllocator.numBlocksInUse());  // holds 'first'
+
+            for (int i = 0; i < k_NUM_ALLOCS; ++i) {
+                mX.allocate(k_ALLOC_SIZE);
+            }
+            ASSERT(NUM_BYTES_AFTER_SHRINK < objectAllocator.numBytesInUse());
+        }
+        ASSERT(0 == objectAllocator.numBytesInUse());
+
+        if (verbose) cout << "\nTesting 'setMaxIdleCapacity'." << endl;
+        {
+            Obj mX(k_INITIAL_SIZE, &objectAllocator);
+
+            mX.setMaxIdleCapacity(0);
+
+            for (int i = 0; i < k_NUM_ALLOCS; ++i) {
+                mX.allocate(k_ALLOC_SIZE);
+            }
+            ASSERT(0 < objectAllocator.numBytesInUse());
+
+            mX.rewind();
+            ASSERT(0 == objectAllocator.numBytesInUse());
+
+            mX.allocate(k_ALLOC_SIZE);
+            const bsls::Types::Int64 NUM_BLOCKS =
+                                             objectAllocator.numBlocksInUse();
+
+            const Obj::Mark M = mX.mark();
+
+            for (int i = 0; i < k_NUM_ALLOCS; ++i) {
+                mX.allocate(k_ALLOC_SIZE);
+            }
+            ASSERT(NUM_BLOCKS < objectAllocator.numBlocksInUse());
+
+            mX.rewind(M);
+            ASSERT(NUM_BLOCKS == objectAllocator.numBlocksInUse());
+
+            mX.setMaxIdleCapacity(bsl::numeric_limits<size_type>::max());
+
+            for (int i = 0; i < k_NUM_ALLOCS; ++i) {
+                mX.allocate(k_ALLOC_SIZE);
+            }
+            const bsls::Types::Int64 NUM_GROWN =
+                                             objectAllocator.numBlocksInUse();
+
+            mX.rewind(M);
+            ASSERT(NUM_GROWN == objectAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == objectAllocator.numBytesInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&objectAllocator);
+
+            const Obj::Mark M = mX.mark();
+
+            ASSERT_PASS_RAW(mX.rewind(M));
+            ASSERT_FAIL_RAW(mX.rewind(Obj::Mark()));
+        }
+
       } break;
       case 7: {
         // --------------------------------------------------------------------
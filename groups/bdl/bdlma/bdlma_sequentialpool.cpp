@@ -606,6 +606,96 @@ void SequentialPool::rewind()
     }
 }
 
+void SequentialPool::rewind(const Mark& mark)
+{
+    BSLS_ASSERT(mark.d_freeListPrevAddr_p);
+
+    // Return all blocks allocated outside the constant and growth strategies
+    // since 'mark' was taken to the underlying allocator.
+
+    while (d_largeBlockList_p != mark.d_largeBlockList_p) {
+        BSLS_ASSERT(d_largeBlockList_p);
+
+        void *lastBlock    = d_largeBlockList_p;
+        d_largeBlockList_p = d_largeBlockList_p->d_next_p;
+        d_allocator_p->deallocate(lastBlock);
+    }
+
+    // Mark the constant and geometric growth blocks used since 'mark' was
+    // taken as reusable.
+
+    d_freeListPrevAddr_p = mark.d_freeListPrevAddr_p;
+    d_unavailable        = mark.d_unavailable;
+
+    // Restore 'd_bufferManager' to the buffer, and the position within it,
+    // recorded by 'mark'.
+
+    if (mark.d_buffer_p) {
+        d_bufferManager.replaceBuffer(mark.d_buffer_p, mark.d_bufferSize);
+        d_bufferManager.setCursor(mark.d_cursor);
+    }
+    else {
+        d_bufferManager.reset();
+    }
+}
+
+void SequentialPool::shrink(bsls::Types::size_type maxIdleBytes)
+{
+    // Geometric growth blocks that are allocated but available to supply
+    // memory are idle, as are the constant growth blocks following
+    // '*d_freeListPrevAddr_p'.
+
+    uint64_t idleBins = d_allocated & ~d_unavailable;
+
+    bsls::Types::size_type numIdleBlocks = 0;
+    for (const Block *block = *d_freeListPrevAddr_p;
+         block;
+         block = block->d_next_p) {
+        ++numIdleBlocks;
+    }
+
+    bsls::Types::size_type idleBytes = numIdleBlocks * d_constantGrowthSize;
+    for (uint64_t bins = idleBins; bins;) {
+        int i = bdlb::BitUtil::numTrailingUnsetBits(bins);
+        idleBytes += static_cast<bsls::Types::size_type>(
+                                                static_cast<uint64_t>(1) << i);
+        bins = bdlb::BitUtil::withBitCleared(bins, i);
+    }
+
+    // Return geometric growth blocks, largest first.
+
+    while (idleBytes > maxIdleBytes && idleBins) {
+        int i = 63 - bdlb::BitUtil::numLeadingUnsetBits(idleBins);
+
+        d_allocator_p->deallocate(d_geometricBin[i]);
+        d_allocated = bdlb::BitUtil::withBitCleared(d_allocated, i);
+        idleBins    = bdlb::BitUtil::withBitCleared(idleBins, i);
+        idleBytes  -= static_cast<bsls::Types::size_type>(
+                                                static_cast<uint64_t>(1) << i);
+    }
+
+    // Return the trailing constant growth blocks that exceed the allowance.
+    // Note that all idle geometric growth blocks have been returned if
+    // 'maxIdleBytes' is still exceeded.
+
+    if (idleBytes > maxIdleBytes) {
+        bsls::Types::size_type numKept = maxIdleBytes / d_constantGrowthSize;
+
+        Block **prevAddr = d_freeListPrevAddr_p;
+        for (; numKept; --numKept) {
+            prevAddr = &(*prevAddr)->d_next_p;
+        }
+
+        Block *block = *prevAddr;
+        *prevAddr    = 0;
+        while (block) {
+            void *lastBlock = block;
+            block           = block->d_next_p;
+            d_allocator_p->deallocate(lastBlock);
+        }
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
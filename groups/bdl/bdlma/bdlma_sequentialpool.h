@@ -24,7 +24,8 @@ BSLS_IDENT("$Id: $")
 // through the pool and returns to the underlying allocator *only* memory that
 // was allocated outside of the typical internal buffer growth of the pool
 // (i.e., large blocks).  Note that individually allocated memory blocks cannot
-// be separately deallocated.
+// be separately deallocated; however, all memory allocated since a *mark* was
+// taken can be reclaimed at once (see {Marks and Rewinding}).
 //
 // A 'bdlma::SequentialPool' is typically used when fast allocation and
 // deallocation is needed, but the user does not know in advance the maximum
@@ -65,6 +66,29 @@ BSLS_IDENT("$Id: $")
 // 'alignmentStrategy' is not specified, natural alignment is used.  See
 // 'bsls_alignment' for more details.
 //
+///Marks and Rewinding
+///--------------------
+// The 'mark' accessor returns a 'bdlma::SequentialPool::Mark' recording the
+// current state of the pool, and 'rewind(mark)' returns the pool to that
+// state: all memory allocated since 'mark' was taken becomes available for
+// reuse, and large blocks (i.e., blocks allocated outside of the internal
+// buffer growth of the pool) allocated since then are returned to the
+// underlying allocator.  Marks may be nested, giving *savepoints*: rewinding
+// to a mark invalidates all marks taken after it, but not those taken before
+// it.  Note that 'rewind()' (i.e., rewinding to the state immediately
+// following construction) and 'release' invalidate all marks.
+//
+///Returning Idle Memory
+///---------------------
+// Neither 'rewind' overload returns internal buffers to the underlying
+// allocator, so a pool that once grew to satisfy a burst of allocations will
+// hold that memory until it is released or destroyed.  The 'shrink' method
+// returns to the underlying allocator the internal buffers that are retained
+// by the pool but not currently used to satisfy any allocation (i.e., *idle*
+// buffers), starting with the largest, until at most a specified number of
+// idle bytes remain.  Note that memory reserved by 'reserveCapacity' is idle
+// until it is used to satisfy an allocation.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -285,6 +309,56 @@ BSLS_IDENT("$Id: $")
 //  {
 //  }
 //..
+//
+///Example 3: Using Marks as Savepoints
+/// - - - - - - - - - - - - - - - - - -
+// Suppose that a server handles each request using scratch memory from a
+// long-lived 'bdlma::SequentialPool', and that some requests parse
+// sub-documents whose scratch memory can be discarded as soon as each
+// sub-document has been processed.
+//
+// First, we create a pool, and take a mark before handling a request:
+//..
+//  bslma::TestAllocator  supplier;
+//  bdlma::SequentialPool pool(&supplier);
+//
+//  const bdlma::SequentialPool::Mark requestMark = pool.mark();
+//..
+// Then, while handling the request, we allocate memory that must remain valid
+// until the request has been handled, and take a nested mark for each
+// sub-document:
+//..
+//  char *header = static_cast<char *>(pool.allocate(64));
+//
+//  for (int i = 0; i < 10; ++i) {
+//      const bdlma::SequentialPool::Mark documentMark = pool.mark();
+//
+//      void *scratch = pool.allocate(1024 * (i + 1));
+//      (void)scratch;  // ... parse sub-document 'i' ...
+//
+//      pool.rewind(documentMark);
+//  }
+//..
+// Next, we observe that 'header' remains valid, as only the memory allocated
+// after each 'documentMark' was reclaimed:
+//..
+//  bsl::memset(header, 'h', 64);
+//..
+// Now, when the request is complete, we rewind to 'requestMark' to reuse all
+// of the memory allocated while handling the request for the next one:
+//..
+//  pool.rewind(requestMark);
+//..
+// Finally, should the request have been unusually large, we return the memory
+// that is now idle to the underlying allocator, retaining at most 4 kilobytes
+// for subsequent requests:
+//..
+//  const bsls::Types::Int64 inUse = supplier.numBytesInUse();
+//
+//  pool.shrink(4096);
+//
+//  assert(supplier.numBytesInUse() < inUse);
+//..
 
 #include <bdlscm_version.h>
 
@@ -394,6 +468,48 @@ class SequentialPool {
     bslma::Allocator              *d_allocator_p;    // memory allocator (held,
                                                      // not owned)
 
+  public:
+    // PUBLIC TYPES
+    class Mark {
+        // This class records the state of a 'SequentialPool' at the time its
+        // 'mark' accessor was called, and allows that pool to be rewound to
+        // that state.  A 'Mark' is meaningful only to the pool that created
+        // it.
+
+        // DATA
+        char                    *d_buffer_p;       // managed buffer (or 0)
+
+        bsls::Types::size_type   d_bufferSize;     // size of 'd_buffer_p'
+
+        bsls::Types::size_type   d_cursor;         // cursor in 'd_buffer_p'
+
+        Block                  **d_freeListPrevAddr_p;
+                                                   // first reusable constant
+                                                   // growth block (or 0 for a
+                                                   // default-constructed mark)
+
+        Block                   *d_largeBlockList_p;
+                                                   // most recent large block
+
+        uint64_t                 d_unavailable;    // geometric bins in use
+
+        // FRIENDS
+        friend class SequentialPool;
+
+      public:
+        // CREATORS
+        Mark();
+            // Create a mark that does not record the state of any pool.  The
+            // behavior is undefined if a default-constructed mark is supplied
+            // to 'rewind' unless another mark has been assigned to it.
+
+        //! Mark(const Mark& original) = default;
+        //! ~Mark() = default;
+
+        // MANIPULATORS
+        //! Mark& operator=(const Mark& rhs) = default;
+    };
+
   private:
     // PRIVATE MANIPULATORS
     void *allocateNonFastPath(bsls::Types::size_type size);
@@ -571,6 +687,29 @@ class SequentialPool {
         // a pointer obtained from this object prior to this call to 'rewind'
         // is undefined.
 
+    void rewind(const Mark& mark);
+        // Release all memory allocated through this pool since the specified
+        // 'mark' was obtained from 'mark()', and return to the underlying
+        // allocator *only* the large blocks (i.e., memory allocated outside of
+        // the typical internal buffer growth of this pool) allocated since
+        // then.  All retained memory will be used to satisfy subsequent
+        // allocations.  Memory allocated before 'mark' was obtained is
+        // unaffected.  Marks obtained after 'mark' are invalidated.  The
+        // effect of subsequently - to this invocation of 'rewind' - using a
+        // pointer obtained from this object after 'mark' was obtained is
+        // undefined.  The behavior is undefined unless 'mark' was obtained
+        // from this pool, and neither 'release', 'rewind()', nor 'rewind' with
+        // a mark obtained before 'mark' has been called since.
+
+    void shrink(bsls::Types::size_type maxIdleBytes = 0);
+        // Return to the underlying allocator internal buffers that are
+        // retained by this pool but not currently used to satisfy any
+        // allocation, largest first, until at most the optionally specified
+        // 'maxIdleBytes' of such memory remain.  If 'maxIdleBytes' is not
+        // specified, all idle internal buffers are returned.  Outstanding
+        // allocations, and marks that remain valid, are unaffected.  Note that
+        // memory reserved by 'reserveCapacity' and not yet used is idle.
+
     void reserveCapacity(bsls::Types::size_type numBytes);
         // Reserve sufficient memory to satisfy allocation requests for at
         // least the specified 'numBytes' without replenishment (i.e., without
@@ -595,6 +734,12 @@ class SequentialPool {
         // 'release' was not called after allocating the memory block at
         // 'address'.
 
+    // ACCESSORS
+    Mark mark() const;
+        // Return a mark recording the current state of this pool, such that
+        // supplying it to 'rewind' releases all memory allocated after this
+        // call.  See {Marks and Rewinding}.
+
                                   // Aspects
 
     bslma::Allocator *allocator() const;
@@ -672,6 +817,22 @@ void operator delete(void *address, BloombergLP::bdlma::SequentialPool& pool);
 namespace BloombergLP {
 namespace bdlma {
 
+                        // --------------------------
+                        // class SequentialPool::Mark
+                        // --------------------------
+
+// CREATORS
+inline
+SequentialPool::Mark::Mark()
+: d_buffer_p(0)
+, d_bufferSize(0)
+, d_cursor(0)
+, d_freeListPrevAddr_p(0)
+, d_largeBlockList_p(0)
+, d_unavailable(0)
+{
+}
+
                            // --------------------
                            // class SequentialPool
                            // --------------------
@@ -740,6 +901,22 @@ bsls::Types::size_type SequentialPool::truncate(
     return d_bufferManager.truncate(address, originalSize, newSize);
 }
 
+// ACCESSORS
+inline
+SequentialPool::Mark SequentialPool::mark() const
+{
+    Mark result;
+
+    result.d_buffer_p            = d_bufferManager.buffer();
+    result.d_bufferSize          = d_bufferManager.bufferSize();
+    result.d_cursor              = d_bufferManager.cursor();
+    result.d_freeListPrevAddr_p  = d_freeListPrevAddr_p;
+    result.d_largeBlockList_p    = d_largeBlockList_p;
+    result.d_unavailable         = d_unavailable;
+
+    return result;
+}
+
 // Aspects
 
 inline
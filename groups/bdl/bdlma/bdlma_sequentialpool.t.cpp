@@ -19,6 +19,7 @@
 #include <bsls_types.h>
 
 #include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_map.h>
 #include <bsl_vector.h>
@@ -89,14 +90,19 @@ using namespace bsl;
 // [ 6] void deleteObject(const TYPE *object);
 // [ 5] void release();
 // [11] void rewind();
+// [14] void rewind(const Mark& mark);
+// [14] void shrink(size_type maxIdleBytes = 0);
 // [ 9] void reserveCapacity(int numBytes);
 // [ 8] int truncate(void *address, int originalSize, int newSize);
+//
+// // ACCESSORS
+// [14] Mark mark() const;
 // [12] bslma::Allocator *allocator() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] HELPER FUNCTION: 'int blockSize(numBytes)'
 // [10] FREE FUNCTION: 'operator new(size_t, bdlma::SequentialPool)'
-// [14] USAGE EXAMPLE
+// [15] USAGE EXAMPLE
 // [13] DRQS 135423849: LARGE ALLOCATION FAILURE ON 32-BIT BUILDS
 
 //=============================================================================
@@ -523,7 +529,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -545,6 +551,355 @@ int main(int argc, char *argv[])
                           << "USAGE EXAMPLE" << endl
                           << "=============" << endl;
 
+///Example 3: Using Marks as Savepoints
+/// - - - - - - - - - - - - - - - - - -
+// Suppose that a server handles each request using scratch memory from a
+// long-lived 'bdlma::SequentialPool', and that some requests parse
+// sub-documents whose scratch memory can be discarded as soon as each
+// sub-document has been processed.
+//
+// First, we create a pool, and take a mark before handling a request:
+//..
+    bslma::TestAllocator  supplier;
+    bdlma::SequentialPool pool(&supplier);
+
+    const bdlma::SequentialPool::Mark requestMark = pool.mark();
+//..
+// Then, while handling the request, we allocate memory that must remain valid
+// until the request has been handled, and take a nested mark for each
+// sub-document:
+//..
+    char *header = static_cast<char *>(pool.allocate(64));
+
+    for (int i = 0; i < 10; ++i) {
+        const bdlma::SequentialPool::Mark documentMark = pool.mark();
+
+        void *scratch = pool.allocate(1024 * (i + 1));
+        (void)scratch;  // ... parse sub-document 'i' ...
+
+        pool.rewind(documentMark);
+    }
+//..
+// Next, we observe that 'header' remains valid, as only the memory allocated
+// after each 'documentMark' was reclaimed:
+//..
+    bsl::memset(header, 'h', 64);
+//..
+// Now, when the request is complete, we rewind to 'requestMark' to reuse all
+// of the memory allocated while handling the request for the next one:
+//..
+    pool.rewind(requestMark);
+//..
+// Finally, should the request have been unusually large, we return the memory
+// that is now idle to the underlying allocator, retaining at most 4 kilobytes
+// for subsequent requests:
+//..
+    const bsls::Types::Int64 inUse = supplier.numBytesInUse();
+
+    pool.shrink(4096);
+
+    ASSERT(supplier.numBytesInUse() < inUse);
+//..
+      } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'mark', 'rewind(mark)', AND 'shrink'
+        //   Ensure a pool can be rewound to a mark, and returns idle memory.
+        //
+        // Concerns:
+        //: 1 After 'rewind(mark)', the pool reuses exactly the memory
+        //:   allocated since 'mark' was taken, and memory allocated before
+        //:   'mark' is unaffected.
+        //:
+        //: 2 Marks nest: rewinding to an inner mark, and then to an outer
+        //:   mark, behaves as rewinding to each in turn.
+        //:
+        //: 3 'rewind(mark)' returns to the underlying allocator exactly the
+        //:   large blocks allocated since 'mark' was taken, and no other
+        //:   memory.
+        //:
+        //: 4 'shrink' returns idle internal buffers, largest first, until at
+        //:   most the specified number of idle bytes remain, for both growth
+        //:   strategies, and does not affect outstanding allocations or valid
+        //:   marks.
+        //:
+        //: 5 'mark' is declared 'const'.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 For all growth and alignment strategies, allocate a prefix of a
+        //:   sequence of sizes, take a mark, allocate the rest of the
+        //:   sequence, rewind to the mark, and verify that re-allocating the
+        //:   rest of the sequence reproduces the same addresses without
+        //:   further use of the underlying allocator.  Repeat with a nested
+        //:   mark.  (C-1..2, 5)
+        //:
+        //: 2 Using a pool whose maximum buffer size forces large requests to
+        //:   be satisfied by separate blocks, verify with a
+        //:   'bslma::TestAllocator' that rewinding to a mark returns only the
+        //:   blocks allocated after it.  (C-3)
+        //:
+        //: 3 Grow pools of each growth strategy, rewind them, and verify the
+        //:   memory retained after 'shrink' with various limits.  Verify that
+        //:   outstanding allocations remain writable and that a mark taken
+        //:   before 'shrink' remains usable.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a default-constructed mark (using the
+        //:   'BSLS_ASSERTTEST_*' macros).  (C-6)
+        //
+        // Testing:
+        //   void rewind(const Mark& mark);
+        //   void shrink(size_type maxIdleBytes = 0);
+        //   Mark mark() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'mark', 'rewind(mark)', AND 'shrink'"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        const bsls::BlockGrowth::Strategy growthStrategy[] = {
+            bsls::BlockGrowth::BSLS_GEOMETRIC,
+            bsls::BlockGrowth::BSLS_CONSTANT
+        };
+        const bsl::size_t numGrowthStrategy = sizeof  growthStrategy
+                                            / sizeof *growthStrategy;
+
+        const bsls::Alignment::Strategy alignmentStrategy[] = {
+            bsls::Alignment::BSLS_NATURAL,
+            bsls::Alignment::BSLS_MAXIMUM,
+            bsls::Alignment::BSLS_BYTEALIGNED
+        };
+        const bsl::size_t numAlignmentStrategy = sizeof  alignmentStrategy
+                                               / sizeof *alignmentStrategy;
+
+        const bsl::size_t allocationSize[] = {
+            4, 8, 1024, 256, 512, 4, 4, 16, 1, 2, 3, 4, 5, 2048, 12, 7
+        };
+        const bsl::size_t numAllocationSize = sizeof  allocationSize
+                                            / sizeof *allocationSize;
+
+        if (verbose) cout << "\nTesting 'rewind(mark)' reuse." << endl;
+
+        for (bsl::size_t gi = 0; gi < numGrowthStrategy; ++gi) {
+            for (bsl::size_t ai = 0; ai < numAlignmentStrategy; ++ai) {
+                for (bsl::size_t mi = 0; mi <= numAllocationSize; ++mi) {
+                    const bsl::size_t ni = (mi + numAllocationSize) / 2;
+
+                    bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+                    Obj mX(growthStrategy[gi], alignmentStrategy[ai], &sa);
+                    const Obj& X = mX;
+
+                    bsl::vector<void *> address;
+
+                    for (bsl::size_t i = 0; i < mi; ++i) {
+                        address.push_back(mX.allocate(allocationSize[i]));
+                    }
+
+                    const Obj::Mark outer = X.mark();
+
+                    for (bsl::size_t i = mi; i < ni; ++i) {
+                        address.push_back(mX.allocate(allocationSize[i]));
+                    }
+
+                    const Obj::Mark inner = X.mark();
+
+                    for (bsl::size_t i = ni; i < numAllocationSize; ++i) {
+                        address.push_back(mX.allocate(allocationSize[i]));
+                    }
+
+                    const bsls::Types::Int64 numBlocks = sa.numBlocksTotal();
+
+                    mX.rewind(inner);
+
+                    for (bsl::size_t i = ni; i < numAllocationSize; ++i) {
+                        LOOP4_ASSERT(gi, ai, mi, i,
+                                     address[i] ==
+                                             mX.allocate(allocationSize[i]));
+                    }
+
+                    mX.rewind(inner);
+                    mX.rewind(outer);
+
+                    for (bsl::size_t i = mi; i < numAllocationSize; ++i) {
+                        LOOP4_ASSERT(gi, ai, mi, i,
+                                     address[i] ==
+                                             mX.allocate(allocationSize[i]));
+                    }
+
+                    LOOP3_ASSERT(gi, ai, mi,
+                                 numBlocks == sa.numBlocksTotal());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting large blocks." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(64, 256, &sa);
+
+            mX.allocate(8);
+
+            const Obj::Mark outer = mX.mark();
+
+            mX.allocate(1000);
+            mX.allocate(2000);
+
+            const bsls::Types::Int64 numBlocks = sa.numBlocksInUse();
+
+            const Obj::Mark inner = mX.mark();
+
+            mX.allocate(3000);
+            mX.allocate(4000);
+
+            ASSERT(numBlocks + 2 == sa.numBlocksInUse());
+
+            mX.rewind(inner);
+
+            ASSERT(numBlocks == sa.numBlocksInUse());
+
+            mX.rewind(outer);
+
+            ASSERT(numBlocks - 2 == sa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting 'shrink' with geometric growth."
+                          << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(&sa);
+
+            const Obj::Mark start = mX.mark();
+
+            // Grow the pool through bins of 256, 512, 1024, and 2048 bytes.
+
+            mX.allocate(200);
+            mX.allocate(400);
+            mX.allocate(1000);
+            mX.allocate(2000);
+
+            ASSERT(4    == sa.numBlocksInUse());
+            ASSERT(3840 == sa.numBytesInUse());
+
+            mX.shrink();  // nothing is idle
+
+            ASSERT(4 == sa.numBlocksInUse());
+
+            mX.rewind(start);
+
+            mX.shrink(3840);
+
+            ASSERT(4 == sa.numBlocksInUse());
+
+            mX.shrink(1000);  // returns 2048 and 1024
+
+            ASSERT(2   == sa.numBlocksInUse());
+            ASSERT(768 == sa.numBytesInUse());
+
+            char *p = static_cast<char *>(mX.allocate(200));
+
+            const Obj::Mark middle = mX.mark();
+
+            mX.shrink();  // returns 512
+
+            ASSERT(1   == sa.numBlocksInUse());
+            ASSERT(256 == sa.numBytesInUse());
+
+            bsl::memset(p, 0xab, 200);
+
+            mX.allocate(40);
+            mX.rewind(middle);
+            mX.allocate(1000);
+
+            ASSERT(2 == sa.numBlocksInUse());
+
+            mX.rewind(start);
+            mX.shrink();
+
+            ASSERT(0 == sa.numBlocksInUse());
+
+            // The pool remains usable.
+
+            ASSERT(mX.allocate(100));
+            ASSERT(1 == sa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting 'shrink' with constant growth."
+                          << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(64, bsls::BlockGrowth::BSLS_CONSTANT, &sa);
+
+            ASSERT(1 == sa.numBlocksInUse());
+
+            const Obj::Mark start = mX.mark();
+
+            for (int i = 0; i < 8; ++i) {
+                mX.allocate(64);
+            }
+
+            ASSERT(8 == sa.numBlocksInUse());
+
+            mX.rewind(start);
+
+            mX.shrink(3 * 64 + 10);
+
+            ASSERT(3 == sa.numBlocksInUse());
+
+            for (int i = 0; i < 3; ++i) {
+                mX.allocate(64);
+            }
+
+            ASSERT(3 == sa.numBlocksInUse());
+
+            mX.allocate(64);
+
+            ASSERT(4 == sa.numBlocksInUse());
+
+            mX.rewind(start);
+            mX.shrink();
+
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting 'shrink' of reserved capacity."
+                          << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(1024, &sa);
+
+            ASSERT(1 == sa.numBlocksInUse());
+
+            mX.shrink(1024);
+
+            ASSERT(1 == sa.numBlocksInUse());
+
+            mX.shrink();
+
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&objectAllocator);
+
+            const Obj::Mark mark = mX.mark();
+            const Obj::Mark none;
+
+            ASSERT_PASS(mX.rewind(mark));
+            ASSERT_FAIL(mX.rewind(none));
+        }
       } break;
       case 13: {
         // --------------------------------------------------------------------
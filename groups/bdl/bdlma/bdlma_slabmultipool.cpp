@@ -0,0 +1,354 @@
+// bdlma_slabmultipool.cpp                                            -*-C++-*-
+#include <bdlma_slabmultipool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_slabmultipool_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+#include <bslma_deallocatorproctor.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+
+#include <bsl_cstring.h>
+#include <bsl_limits.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+// TYPES
+enum {
+    k_DEFAULT_NUM_POOLS         = 10,  // default number of pools
+
+    k_MAX_SLABS_PER_CHUNK       = 16,  // cap on the geometric growth of the
+                                       // chunks supplying spans
+
+    k_INITIAL_DIRECTORY_SIZE    = 32   // initial capacity of the slab
+                                       // directory (a power of 2)
+};
+
+                            // -------------------
+                            // class SlabMultipool
+                            // -------------------
+
+// PRIVATE CLASS METHODS
+bsls::Types::size_type
+SlabMultipool::spanSize(bsls::Types::size_type blockSize)
+{
+    // Replenishing small pools one slab at a time ensures that spans are
+    // carved from chunks without leaving gaps.
+
+    const bsls::Types::size_type slabSize = k_SLAB_SIZE;
+
+    return blockSize < slabSize ? slabSize : blockSize;
+}
+
+// PRIVATE MANIPULATORS
+void *SlabMultipool::allocateFromNewSpan(int poolIdx)
+{
+    const bsls::Types::size_type blockSize =
+                                 static_cast<bsls::Types::size_type>(8)
+                                                                   << poolIdx;
+    const bsls::Types::size_type numBytes  = spanSize(blockSize);
+
+    Pool& pool = d_pools_p[poolIdx];
+
+    char *span = allocateSpan(numBytes, poolIdx);
+
+    pool.d_cursor_p = span + blockSize;
+    pool.d_end_p    = span + numBytes;
+
+    return span;
+}
+
+void *SlabMultipool::allocateLarge(bsls::Types::size_type size)
+{
+    return d_blockList.allocate(size);
+}
+
+char *SlabMultipool::allocateSpan(bsls::Types::size_type numBytes,
+                                  int                    poolIdx)
+{
+    BSLS_ASSERT(0 == numBytes % k_SLAB_SIZE);
+
+    const bsls::Types::size_type numNewSlabs = numBytes / k_SLAB_SIZE;
+
+    // Make room in the directory first, so that no memory is consumed if the
+    // directory cannot grow.  The directory is kept at most half full, so
+    // that probe sequences stay short.
+
+    while ((d_numSlabs + numNewSlabs) * 2 > d_directoryMask + 1) {
+        growDirectory();
+    }
+
+    if (numBytes == k_SLAB_SIZE && d_freeSlabs_p) {
+        char *span    = reinterpret_cast<char *>(d_freeSlabs_p);
+        d_freeSlabs_p = d_freeSlabs_p->d_next_p;
+
+        insertSlab(reinterpret_cast<bsls::Types::UintPtr>(span)
+                                                          >> k_LOG2_SLAB_SIZE,
+                   poolIdx);
+
+        return span;                                                  // RETURN
+    }
+
+    if (static_cast<bsls::Types::size_type>(d_chunkEnd_p - d_chunkCursor_p)
+                                                                 < numBytes) {
+        // Any slabs remaining in the current chunk are too few to hold the
+        // span; they are kept on the free-slab list for later single-slab
+        // spans.  The basic allocator supplies maximally aligned memory, so
+        // at most 'k_SLAB_SIZE - BSLS_MAX_ALIGNMENT' bytes are skipped to
+        // reach a slab boundary.
+
+        while (d_chunkCursor_p != d_chunkEnd_p) {
+            FreeBlock *slab = reinterpret_cast<FreeBlock *>(d_chunkCursor_p);
+
+            slab->d_next_p   = d_freeSlabs_p;
+            d_freeSlabs_p    = slab;
+            d_chunkCursor_p += k_SLAB_SIZE;
+        }
+
+        const bsls::Types::size_type chunkSize = numBytes < d_nextChunkSize
+                                               ? d_nextChunkSize
+                                               : numBytes;
+
+        if (d_nextChunkSize < k_MAX_SLABS_PER_CHUNK * k_SLAB_SIZE) {
+            d_nextChunkSize *= 2;
+        }
+
+        char *chunk = static_cast<char *>(d_chunkList.allocate(
+                                chunkSize
+                              + k_SLAB_SIZE
+                              - bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT));
+
+        const bsls::Types::UintPtr mask = k_SLAB_SIZE - 1;
+
+        d_chunkCursor_p = reinterpret_cast<char *>(
+                      (reinterpret_cast<bsls::Types::UintPtr>(chunk) + mask)
+                                                                      & ~mask);
+        d_chunkEnd_p    = d_chunkCursor_p + chunkSize;
+    }
+
+    char *span = d_chunkCursor_p;
+    d_chunkCursor_p += numBytes;
+
+    const bsls::Types::UintPtr first =
+                                reinterpret_cast<bsls::Types::UintPtr>(span)
+                                                          >> k_LOG2_SLAB_SIZE;
+    const bsls::Types::UintPtr last  = first + numNewSlabs;
+
+    for (bsls::Types::UintPtr slab = first; slab < last; ++slab) {
+        insertSlab(slab, poolIdx);
+    }
+
+    return span;
+}
+
+void SlabMultipool::growDirectory()
+{
+    const bsls::Types::size_type oldCapacity  = d_directoryMask + 1;
+    const bsls::Types::size_type newCapacity  = oldCapacity * 2;
+    DirectoryEntry              *oldDirectory = d_directory_p;
+
+    d_directory_p = static_cast<DirectoryEntry *>(d_allocator_p->allocate(
+                                      newCapacity * sizeof(DirectoryEntry)));
+    bsl::memset(d_directory_p, 0, newCapacity * sizeof(DirectoryEntry));
+
+    d_directoryMask  = newCapacity - 1;
+    d_directoryShift -= 1;
+    d_numSlabs       = 0;
+
+    for (bsls::Types::size_type i = 0; i < oldCapacity; ++i) {
+        if (oldDirectory[i].d_slab) {
+            insertSlab(oldDirectory[i].d_slab, oldDirectory[i].d_poolIdx);
+        }
+    }
+
+    d_allocator_p->deallocate(oldDirectory);
+}
+
+void SlabMultipool::initialize()
+{
+    BSLS_ASSERT(1 <= d_numPools);
+
+    d_maxBlockSize = 8;
+    for (int i = 1; i < d_numPools; ++i) {
+        BSLS_ASSERT(d_maxBlockSize <=
+                       bsl::numeric_limits<bsls::Types::size_type>::max() / 2);
+
+        d_maxBlockSize *= 2;
+    }
+
+    d_pools_p = static_cast<Pool *>(
+                      d_allocator_p->allocate(d_numPools * sizeof *d_pools_p));
+    bsl::memset(d_pools_p, 0, d_numPools * sizeof *d_pools_p);
+
+    bslma::DeallocatorProctor<bslma::Allocator> autoPoolsDeallocator(
+                                                                d_pools_p,
+                                                                d_allocator_p);
+
+    d_directory_p = static_cast<DirectoryEntry *>(d_allocator_p->allocate(
+                     k_INITIAL_DIRECTORY_SIZE * sizeof(DirectoryEntry)));
+    bsl::memset(d_directory_p,
+                0,
+                k_INITIAL_DIRECTORY_SIZE * sizeof(DirectoryEntry));
+
+    d_directoryMask  = k_INITIAL_DIRECTORY_SIZE - 1;
+    d_directoryShift = 64 - bdlb::BitUtil::log2(
+                       static_cast<bsl::uint32_t>(k_INITIAL_DIRECTORY_SIZE));
+
+    autoPoolsDeallocator.release();
+}
+
+void SlabMultipool::insertSlab(bsls::Types::UintPtr slab, int poolIdx)
+{
+    BSLS_ASSERT(slab);
+    BSLS_ASSERT(d_numSlabs < d_directoryMask);
+
+    bsls::Types::size_type index = static_cast<bsls::Types::size_type>(
+                   (static_cast<bsls::Types::Uint64>(slab)
+                                               * 0x9E3779B97F4A7C15ULL)
+                                                         >> d_directoryShift);
+
+    while (d_directory_p[index].d_slab) {
+        BSLS_ASSERT(slab != d_directory_p[index].d_slab);
+
+        index = (index + 1) & d_directoryMask;
+    }
+
+    d_directory_p[index].d_slab    = slab;
+    d_directory_p[index].d_poolIdx = poolIdx;
+    ++d_numSlabs;
+}
+
+// CREATORS
+SlabMultipool::SlabMultipool(bslma::Allocator *basicAllocator)
+: d_numPools(k_DEFAULT_NUM_POOLS)
+, d_numSlabs(0)
+, d_chunkCursor_p(0)
+, d_chunkEnd_p(0)
+, d_nextChunkSize(k_SLAB_SIZE)
+, d_freeSlabs_p(0)
+, d_chunkList(basicAllocator)
+, d_blockList(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
+}
+
+SlabMultipool::SlabMultipool(int               numPools,
+                             bslma::Allocator *basicAllocator)
+: d_numPools(numPools)
+, d_numSlabs(0)
+, d_chunkCursor_p(0)
+, d_chunkEnd_p(0)
+, d_nextChunkSize(k_SLAB_SIZE)
+, d_freeSlabs_p(0)
+, d_chunkList(basicAllocator)
+, d_blockList(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
+}
+
+SlabMultipool::~SlabMultipool()
+{
+    BSLS_ASSERT(d_pools_p);
+    BSLS_ASSERT(d_directory_p);
+
+    d_blockList.release();
+    d_chunkList.release();
+    d_allocator_p->deallocate(d_directory_p);
+    d_allocator_p->deallocate(d_pools_p);
+}
+
+// MANIPULATORS
+void SlabMultipool::release()
+{
+    d_blockList.release();
+    d_chunkList.release();
+
+    bsl::memset(d_pools_p, 0, d_numPools * sizeof *d_pools_p);
+    bsl::memset(d_directory_p,
+                0,
+                (d_directoryMask + 1) * sizeof(DirectoryEntry));
+
+    d_numSlabs       = 0;
+    d_chunkCursor_p  = 0;
+    d_chunkEnd_p     = 0;
+    d_nextChunkSize  = k_SLAB_SIZE;
+    d_freeSlabs_p    = 0;
+}
+
+void SlabMultipool::reserveCapacity(bsls::Types::size_type size,
+                                    int                    numBlocks)
+{
+    BSLS_ASSERT(size <= d_maxBlockSize);
+    BSLS_ASSERT(0    <= numBlocks);
+
+    if (0 == size) {
+        return;                                                       // RETURN
+    }
+
+    const int                    poolIdx   = findPool(size);
+    const bsls::Types::size_type blockSize =
+                                 static_cast<bsls::Types::size_type>(8)
+                                                                   << poolIdx;
+    Pool&                        pool      = d_pools_p[poolIdx];
+
+    bsls::Types::size_type numAvailable =
+          static_cast<bsls::Types::size_type>(pool.d_end_p - pool.d_cursor_p)
+                                                                  / blockSize;
+
+    const bsls::Types::size_type numWanted =
+                                static_cast<bsls::Types::size_type>(numBlocks);
+
+    for (FreeBlock *block = pool.d_freeList_p;
+         block && numAvailable < numWanted;
+         block = block->d_next_p) {
+        ++numAvailable;
+    }
+
+    if (numAvailable >= numWanted) {
+        return;                                                       // RETURN
+    }
+
+    // Move the unused remainder of the current span onto the free list, and
+    // replace it with a single span large enough for the shortfall.
+
+    while (static_cast<bsls::Types::size_type>(pool.d_end_p - pool.d_cursor_p)
+                                                               >= blockSize) {
+        FreeBlock *block = reinterpret_cast<FreeBlock *>(pool.d_cursor_p);
+
+        block->d_next_p   = pool.d_freeList_p;
+        pool.d_freeList_p = block;
+        pool.d_cursor_p  += blockSize;
+    }
+
+    const bsls::Types::size_type span     = spanSize(blockSize);
+    const bsls::Types::size_type needed   =
+                                      (numWanted - numAvailable) * blockSize;
+    const bsls::Types::size_type numBytes = (needed + span - 1) / span * span;
+
+    pool.d_cursor_p = allocateSpan(numBytes, poolIdx);
+    pool.d_end_p    = pool.d_cursor_p + numBytes;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,569 @@
+// bdlma_slabmultipool.h                                              -*-C++-*-
+#ifndef INCLUDED_BDLMA_SLABMULTIPOOL
+#define INCLUDED_BDLMA_SLABMULTIPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a header-free multipool dispensing blocks from slabs.
+//
+//@CLASSES:
+//  bdlma::SlabMultipool: multipool locating a block's pool from its address
+//
+//@SEE_ALSO: bdlma_multipool, bdlma_slabmultipoolallocator
+//
+//@DESCRIPTION: This component implements a memory manager,
+// 'bdlma::SlabMultipool', that, like 'bdlma::Multipool', maintains a
+// configurable number of pools, each dispensing memory blocks of a unique
+// size, with each successive pool managing memory blocks of a size twice that
+// of the previous pool.  Each allocation (deallocation) request allocates
+// memory from (returns memory to) the internal pool managing memory blocks of
+// the smallest size not less than the requested size, or else from a
+// separately managed list of memory blocks, if no internal pool managing
+// memory blocks of sufficient size exists.  Both the 'release' method and the
+// destructor of a 'bdlma::SlabMultipool' release all memory currently
+// allocated via the object.
+//
+// The difference between the two lies in how 'deallocate' finds the pool
+// that owns a block.  A 'bdlma::Multipool' prefixes every block it dispenses
+// with a maximally-aligned header holding the index of the owning pool, which
+// costs 8 or 16 bytes per block (more than doubling the footprint of an
+// 8-byte request).  A 'bdlma::SlabMultipool' stores no per-block header;
+// instead, the memory backing the pools is obtained in "slabs" aligned on (and
+// a multiple of) 'k_SLAB_SIZE' bytes, every slab holds blocks of a single size
+// only, and the multipool keeps a small hash table (the "slab directory")
+// mapping the address of each slab to the index of the pool that owns it.
+// Deallocation masks the address of a block down to the start of its slab and
+// looks the slab up in the directory, in constant (expected) time:
+//..
+//      block address
+//  +-------------------+------------+
+//  |    slab number    |   offset   |      slab directory
+//  +-------------------+------------+     +--------------+------+
+//            |                            | slab number  | pool |
+//            +--------------------------> +--------------+------+
+//                                         |     ...      | ...  |
+//                                         +--------------+------+
+//..
+// Blocks are therefore packed back-to-back within their slabs, which improves
+// both the memory footprint and the cache density of small objects (e.g., the
+// nodes of a 'bsl::list').  An address that is not found in the directory was
+// not dispensed from a pool, and is returned to the list of "large" blocks;
+// each such block (larger than 'maxPooledBlockSize()') carries a header, just
+// as it would in a 'bdlma::Multipool'.
+//
+///Alignment
+///---------
+// A block of a given size is placed at an offset within its slab that is a
+// multiple of that size, and slabs are aligned on 'k_SLAB_SIZE' bytes, so
+// every pooled block is aligned on the lesser of its size and 'k_SLAB_SIZE'.
+// Blocks of at least 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT' bytes are
+// therefore maximally aligned, while the blocks dispensed by the 8-byte pool
+// are *naturally* aligned (i.e., aligned as required by any object that fits
+// in 8 bytes), which is sufficient for every object that can be constructed
+// in such a block.
+//
+///Configuration at Construction
+///-----------------------------
+// When creating a 'bdlma::SlabMultipool', clients can optionally configure:
+//
+//: 1 NUMBER OF POOLS -- the number of internal pools (the block size managed
+//:   by the first pool is eight bytes, with each successive pool managing
+//:   blocks of a size twice that of the previous pool).
+//: 2 BASIC ALLOCATOR -- the allocator used to supply memory (to replenish an
+//:   internal pool, or directly if the maximum block size is exceeded).  If
+//:   not specified, the currently installed default allocator is used (see
+//:   'bslma_default').
+//
+// A pool is replenished with a single slab or, if its blocks are larger than a
+// slab, with a "span" of contiguous slabs holding a single block.  Slabs are
+// carved from chunks obtained from the basic allocator; chunk sizes grow
+// geometrically, starting from a single slab, up to an implementation-defined
+// maximum.  Since the basic allocator need not return slab-aligned memory,
+// each chunk is over-allocated to provide for alignment: up to
+// 'k_SLAB_SIZE - bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT' bytes of every chunk
+// (4080 bytes on typical 64-bit platforms) precede its first slab and are
+// never used.  When a span of several slabs does not fit in the remainder of
+// the current chunk, the slabs of that remainder are kept on a list of free
+// slabs, from which subsequent single-slab spans are taken before any new
+// chunk is allocated.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Small Nodes Without Per-Block Overhead
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we are building a linked list of small nodes, and want all of
+// the nodes to be densely packed in memory.  We allocate the nodes from a
+// 'bdlma::SlabMultipool', which, unlike a 'bdlma::Multipool', dispenses
+// 16-byte nodes 16 bytes apart.
+//
+// First, we define the node type:
+//..
+//  struct Node {
+//      Node *d_next_p;
+//      int   d_value;
+//  };
+//..
+// Then, we create a slab multipool, supplying a 'bslma::TestAllocator' so
+// that we can observe the memory that the multipool consumes:
+//..
+//  bslma::TestAllocator ta;
+//  {
+//      bdlma::SlabMultipool multipool(&ta);
+//..
+// Next, we build a list of 100000 nodes:
+//..
+//      Node *head = 0;
+//      for (int i = 0; i < 100000; ++i) {
+//          Node *node = static_cast<Node *>(multipool.allocate(sizeof(Node)));
+//          node->d_next_p = head;
+//          node->d_value  = i;
+//          head           = node;
+//      }
+//..
+// Now, we observe that consecutively allocated nodes are adjacent in memory
+// (within a slab), and that the memory obtained from the underlying allocator
+// is less than twice the size of the nodes themselves -- which is less than
+// the footprint of the nodes alone, had each of them been prefixed with a
+// maximally-aligned header:
+//..
+//      assert(sizeof(Node) ==
+//             static_cast<char *>(static_cast<void *>(head))
+//           - static_cast<char *>(static_cast<void *>(head->d_next_p)));
+//      assert(ta.numBytesInUse() < static_cast<bsls::Types::Int64>(
+//                                               2 * 100000 * sizeof(Node)));
+//..
+// Finally, we return the nodes to the multipool; the memory is then available
+// for reuse by subsequent 16-byte allocations:
+//..
+//      while (head) {
+//          Node *next = head->d_next_p;
+//          multipool.deallocate(head);
+//          head = next;
+//      }
+//  }
+//  assert(0 == ta.numBytesInUse());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_blocklist.h>
+#include <bdlma_infrequentdeleteblocklist.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_deleterhelper.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdint.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                            // ===================
+                            // class SlabMultipool
+                            // ===================
+
+class SlabMultipool {
+    // This class implements a memory manager that maintains a configurable
+    // number of pools, each dispensing memory blocks of a unique size, with
+    // each successive pool managing memory blocks of size twice that of the
+    // previous pool.  Each multipool allocation (deallocation) request
+    // allocates memory from (returns memory to) the internal pool having the
+    // smallest block size not less than the requested size, or, if no pool
+    // manages memory blocks of sufficient size, from a separately managed list
+    // of memory blocks.  Pooled blocks carry no header: the pool owning a
+    // block is found from the slab containing it.  Both the 'release' method
+    // and the destructor of a 'bdlma::SlabMultipool' release all memory
+    // currently allocated via the object.
+
+  public:
+    // PUBLIC TYPES
+    enum {
+        k_LOG2_SLAB_SIZE = 12,                     // base-2 log of the slab
+                                                   // size
+
+        k_SLAB_SIZE      = 1 << k_LOG2_SLAB_SIZE   // size (and alignment) of
+                                                   // a slab, in bytes
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct FreeBlock {
+        // This 'struct' overlays the first bytes of a free block, linking it
+        // into the free list of its pool.
+
+        FreeBlock *d_next_p;  // next free block, or 0 if none
+    };
+
+    struct Pool {
+        // This 'struct' holds the state of a single pool: a free list of
+        // deallocated blocks and the (as yet unused) remainder of the span
+        // most recently obtained for the pool.
+
+        FreeBlock *d_freeList_p;  // blocks available for reuse
+        char      *d_cursor_p;    // next unused block in the current span
+        char      *d_end_p;       // end of the current span
+    };
+
+    struct DirectoryEntry {
+        // This 'struct' maps a slab (identified by its address divided by
+        // 'k_SLAB_SIZE') to the index of the pool owning its blocks.  An
+        // entry whose slab number is 0 is unused.
+
+        bsls::Types::UintPtr d_slab;     // slab number
+        int                  d_poolIdx;  // index of owning pool
+    };
+
+    // DATA
+    Pool                      *d_pools_p;          // array of pools
+
+    int                        d_numPools;         // number of pools
+
+    bsls::Types::size_type     d_maxBlockSize;     // largest pooled block
+                                                   // size; always a power of
+                                                   // 2
+
+    DirectoryEntry            *d_directory_p;      // open-addressing hash
+                                                   // table of owned slabs
+
+    bsls::Types::size_type     d_directoryMask;    // capacity of the
+                                                   // directory minus 1
+
+    int                        d_directoryShift;   // 64 minus the base-2 log
+                                                   // of the directory capacity
+
+    bsls::Types::size_type     d_numSlabs;         // number of entries in use
+                                                   // in the directory
+
+    char                      *d_chunkCursor_p;    // next unused slab in the
+                                                   // current chunk
+
+    char                      *d_chunkEnd_p;       // end of the usable part of
+                                                   // the current chunk
+
+    bsls::Types::size_type     d_nextChunkSize;    // number of bytes of slabs
+                                                   // requested for the next
+                                                   // chunk
+
+    FreeBlock                 *d_freeSlabs_p;      // slabs left over from
+                                                   // earlier chunks, not yet
+                                                   // owned by any pool
+
+    InfrequentDeleteBlockList  d_chunkList;        // chunks supplying slabs
+
+    BlockList                  d_blockList;        // memory manager for
+                                                   // "large" memory blocks
+
+    bslma::Allocator          *d_allocator_p;      // holds (but does not own)
+                                                   // allocator
+
+  private:
+    // PRIVATE CLASS METHODS
+    static bsls::Types::size_type spanSize(bsls::Types::size_type blockSize);
+        // Return the number of bytes (a multiple of 'k_SLAB_SIZE') by which a
+        // pool dispensing blocks of the specified 'blockSize' is replenished.
+
+    // PRIVATE MANIPULATORS
+    void *allocateFromNewSpan(int poolIdx);
+        // Replenish the pool at the specified 'poolIdx' with a new span (of
+        // one or more slabs) and return the address of the first block of
+        // that span.
+
+    void *allocateLarge(bsls::Types::size_type size);
+        // Return the address of a maximally-aligned block of the specified
+        // 'size' (in bytes) obtained from the list of "large" blocks.
+
+    char *allocateSpan(bsls::Types::size_type numBytes, int poolIdx);
+        // Return the address of a slab-aligned region of the specified
+        // 'numBytes', a multiple of 'k_SLAB_SIZE', having first recorded in
+        // the slab directory that each of its slabs is owned by the pool at
+        // the specified 'poolIdx'.  A single-slab region is taken from the
+        // list of free slabs, if that list is not empty.
+
+    void growDirectory();
+        // Double the capacity of the slab directory, rehashing its entries.
+
+    void initialize();
+        // Allocate and initialize the pools and the slab directory of this
+        // multipool.
+
+    void insertSlab(bsls::Types::UintPtr slab, int poolIdx);
+        // Record in the slab directory that the specified 'slab' is owned by
+        // the pool at the specified 'poolIdx'.  The behavior is undefined
+        // unless the directory has room for another entry, and 'slab' is not
+        // already recorded.
+
+    // PRIVATE ACCESSORS
+    int findPool(bsls::Types::size_type size) const;
+        // Return the index of the memory pool in this multipool for an
+        // allocation request of the specified 'size' (in bytes).  The behavior
+        // is undefined unless '0 < size <= maxPooledBlockSize()'.
+
+    int lookupPool(const void *address) const;
+        // Return the index of the pool owning the slab containing the
+        // specified 'address', or -1 if that slab is not owned by this
+        // multipool.
+
+  private:
+    // NOT IMPLEMENTED
+    SlabMultipool(const SlabMultipool&);
+    SlabMultipool& operator=(const SlabMultipool&);
+
+  public:
+    // CREATORS
+    explicit
+    SlabMultipool(bslma::Allocator *basicAllocator = 0);
+    explicit
+    SlabMultipool(int numPools, bslma::Allocator *basicAllocator = 0);
+        // Create a slab multipool.  Optionally specify 'numPools', indicating
+        // the number of internally created pools; the block size of the first
+        // pool is 8 bytes, with the block size of each additional pool
+        // successively doubling.  If 'numPools' is not specified, an
+        // implementation-defined number of pools 'N' -- covering memory blocks
+        // ranging in size from '2^3 = 8' to '2^(N+2)' -- are created.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '1 <= numPools'.
+
+    ~SlabMultipool();
+        // Destroy this multipool.  All memory allocated from this multipool is
+        // released.
+
+    // MANIPULATORS
+    void *allocate(bsls::Types::size_type size);
+        // Return the address of a contiguous block of memory of (at least) the
+        // specified 'size' (in bytes), aligned as described in {Alignment}.
+        // If 'size' is 0, no memory is allocated and 0 is returned.  If
+        // 'size > maxPooledBlockSize()', the memory allocation is managed
+        // directly by the underlying allocator, and will not be pooled, but
+        // will be deallocated when the 'release' method is called, or when
+        // this object is destroyed.
+
+    void deallocate(void *address);
+        // Relinquish the memory block at the specified 'address' back to this
+        // multipool object for reuse.  The behavior is undefined unless
+        // 'address' is non-zero, was allocated by this multipool object, and
+        // has not already been deallocated.
+
+    template <class TYPE>
+    void deleteObject(const TYPE *object);
+        // Destroy the specified 'object' based on its dynamic type and then
+        // use this multipool object to deallocate its memory footprint.  This
+        // method has no effect if 'object' is 0.  The behavior is undefined
+        // unless 'object', when cast appropriately to 'void *', was allocated
+        // using this multipool object and has not already been deallocated.
+        // Note that 'dynamic_cast<void *>(object)' is applied if 'TYPE' is
+        // polymorphic, and 'static_cast<void *>(object)' is applied otherwise.
+
+    template <class TYPE>
+    void deleteObjectRaw(const TYPE *object);
+        // Destroy the specified 'object' and then use this multipool to
+        // deallocate its memory footprint.  This method has no effect if
+        // 'object' is 0.  The behavior is undefined unless 'object' is !not! a
+        // secondary base class pointer (i.e., the address is (numerically) the
+        // same as when it was originally dispensed by this multipool), was
+        // allocated using this multipool, and has not already been
+        // deallocated.
+
+    void release();
+        // Relinquish all memory currently allocated via this multipool object.
+        // Note that the slab directory, whose size grows with the number of
+        // slabs obtained, is retained (emptied) for reuse.
+
+    void reserveCapacity(bsls::Types::size_type size, int numBlocks);
+        // Reserve memory from this multipool to satisfy memory requests for at
+        // least the specified 'numBlocks' having the specified 'size' (in
+        // bytes) before the pool replenishes.  If 'size' is 0, this method has
+        // no effect.  The behavior is undefined unless
+        // 'size <= maxPooledBlockSize()' and '0 <= numBlocks'.
+
+    // ACCESSORS
+    int numPools() const;
+        // Return the number of pools managed by this multipool object.
+
+    bsls::Types::size_type maxPooledBlockSize() const;
+        // Return the maximum size of memory blocks that are pooled by this
+        // multipool object.  Note that the maximum value is defined as:
+        //..
+        //  2 ^ (numPools + 2)
+        //..
+        // where 'numPools' is either specified at construction, or an
+        // implementation-defined value.
+
+    bsls::Types::size_type numSlabs() const;
+        // Return the number of slabs currently owned by the pools of this
+        // multipool object.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to allocate memory.  Note
+        // that this allocator can not be used to deallocate memory
+        // allocated through this pool.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class SlabMultipool
+                            // -------------------
+
+// PRIVATE ACCESSORS
+inline
+int SlabMultipool::findPool(bsls::Types::size_type size) const
+{
+    BSLS_ASSERT(0 < size);
+    BSLS_ASSERT(size <= d_maxBlockSize);
+
+    return bdlb::BitUtil::log2(static_cast<bsl::uint64_t>((size + 7) >> 3));
+}
+
+inline
+int SlabMultipool::lookupPool(const void *address) const
+{
+    const bsls::Types::UintPtr slab =
+                       reinterpret_cast<bsls::Types::UintPtr>(address)
+                                                          >> k_LOG2_SLAB_SIZE;
+
+    bsls::Types::size_type index = static_cast<bsls::Types::size_type>(
+                   (static_cast<bsls::Types::Uint64>(slab)
+                                               * 0x9E3779B97F4A7C15ULL)
+                                                         >> d_directoryShift);
+
+    for (;;) {
+        const DirectoryEntry& entry = d_directory_p[index];
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(entry.d_slab == slab)) {
+            return entry.d_poolIdx;                                   // RETURN
+        }
+        if (0 == entry.d_slab) {
+            return -1;                                                // RETURN
+        }
+        index = (index + 1) & d_directoryMask;
+    }
+}
+
+// MANIPULATORS
+inline
+void *SlabMultipool::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        return 0;                                                     // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(size > d_maxBlockSize)) {
+        return allocateLarge(size);                                   // RETURN
+    }
+
+    const int  poolIdx = findPool(size);
+    Pool&      pool    = d_pools_p[poolIdx];
+    FreeBlock *block   = pool.d_freeList_p;
+
+    if (block) {
+        pool.d_freeList_p = block->d_next_p;
+        return block;                                                 // RETURN
+    }
+
+    const bsls::Types::size_type blockSize =
+                                 static_cast<bsls::Types::size_type>(8)
+                                                                   << poolIdx;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+           static_cast<bsls::Types::size_type>(pool.d_end_p - pool.d_cursor_p)
+                                                              >= blockSize)) {
+        void *result = pool.d_cursor_p;
+        pool.d_cursor_p += blockSize;
+        return result;                                                // RETURN
+    }
+
+    return allocateFromNewSpan(poolIdx);
+}
+
+inline
+void SlabMultipool::deallocate(void *address)
+{
+    BSLS_ASSERT(address);
+
+    const int poolIdx = lookupPool(address);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 <= poolIdx)) {
+        Pool&      pool  = d_pools_p[poolIdx];
+        FreeBlock *block = static_cast<FreeBlock *>(address);
+
+        block->d_next_p   = pool.d_freeList_p;
+        pool.d_freeList_p = block;
+    }
+    else {
+        d_blockList.deallocate(address);
+    }
+}
+
+template <class TYPE>
+inline
+void SlabMultipool::deleteObject(const TYPE *object)
+{
+    bslma::DeleterHelper::deleteObject(object, this);
+}
+
+template <class TYPE>
+inline
+void SlabMultipool::deleteObjectRaw(const TYPE *object)
+{
+    bslma::DeleterHelper::deleteObjectRaw(object, this);
+}
+
+// ACCESSORS
+inline
+int SlabMultipool::numPools() const
+{
+    return d_numPools;
+}
+
+inline
+bsls::Types::size_type SlabMultipool::maxPooledBlockSize() const
+{
+    return d_maxBlockSize;
+}
+
+inline
+bsls::Types::size_type SlabMultipool::numSlabs() const
+{
+    return d_numSlabs;
+}
+
+// Aspects
+
+inline
+bslma::Allocator *SlabMultipool::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
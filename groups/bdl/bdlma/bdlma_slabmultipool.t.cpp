@@ -0,0 +1,1124 @@
+// bdlma_slabmultipool.t.cpp                                          -*-C++-*-
+#include <bdlma_slabmultipool.h>
+
+#include <bdlma_multipool.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_new.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a memory manager, 'bdlma::SlabMultipool', that
+// dispenses blocks of several sizes from slab-aligned memory, without any
+// per-block header, and locates the pool owning a block from its address.  We
+// must verify that each request is satisfied from the pool of the appropriate
+// size (or, for large requests, from the underlying allocator), that blocks
+// are suitably aligned, do not overlap, and are packed contiguously within
+// their slabs, that deallocated blocks are reused by their own pool only, that
+// the slab directory continues to identify every slab as it grows, and that
+// all memory comes from the supplied allocator and is returned by 'release'
+// and on destruction.
+//
+// In addition to positive test cases (run in the nightly builds), a negative
+// test case -1 can be run manually to compare the memory footprint and speed
+// of this multipool with that of 'bdlma::Multipool'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] SlabMultipool(bslma::Allocator *basicAllocator = 0);
+// [ 2] SlabMultipool(int numPools, bslma::Allocator *basicAllocator = 0);
+// [ 2] ~SlabMultipool();
+//
+// MANIPULATORS
+// [ 3] void *allocate(bsls::Types::size_type size);
+// [ 3] void deallocate(void *address);
+// [ 7] template <class TYPE> void deleteObject(const TYPE *object);
+// [ 7] template <class TYPE> void deleteObjectRaw(const TYPE *object);
+// [ 5] void release();
+// [ 6] void reserveCapacity(bsls::Types::size_type size, int numBlocks);
+//
+// ACCESSORS
+// [ 2] int numPools() const;
+// [ 2] bsls::Types::size_type maxPooledBlockSize() const;
+// [ 4] bsls::Types::size_type numSlabs() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] SLAB DIRECTORY GROWTH
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE: COMPARISON WITH 'bdlma::Multipool'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::SlabMultipool Obj;
+
+typedef bsls::Types::UintPtr UintPtr;
+
+const int DEFAULT_NUM_POOLS = 10;  // keep in sync with the implementation
+
+const int MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+int numLeftChildren  = 0;
+int numRightChildren = 0;
+int numMostDerived   = 0;
+
+struct LeftChild {
+    int d_li;
+
+    LeftChild()          { ++numLeftChildren; }
+    virtual ~LeftChild() { --numLeftChildren; }
+};
+
+struct RightChild {
+    int d_ri;
+
+    RightChild()          { ++numRightChildren; }
+    virtual ~RightChild() { --numRightChildren; }
+};
+
+struct MostDerived : LeftChild, RightChild {
+    int d_md;
+
+    MostDerived()  { ++numMostDerived; }
+    ~MostDerived() { --numMostDerived; }
+};
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bsls::Types::size_type blockSizeFor(bsls::Types::size_type size)
+    // Return the size of the block that a slab multipool dispenses from a
+    // pool for a request of the specified 'size'.  The behavior is undefined
+    // unless '0 < size'.
+{
+    bsls::Types::size_type blockSize = 8;
+    while (blockSize < size) {
+        blockSize *= 2;
+    }
+    return blockSize;
+}
+
+bool isAligned(const void *address, bsls::Types::size_type alignment)
+    // Return 'true' if the specified 'address' is aligned on the specified
+    // 'alignment', and 'false' otherwise.
+{
+    return 0 == reinterpret_cast<UintPtr>(address) % alignment;
+}
+
+unsigned int nextRandom(unsigned int *seed)
+    // Advance the linear congruential generator having the specified 'seed'
+    // and return its next value.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return *seed >> 8;
+}
+
+struct Block {
+    // This 'struct' describes a block allocated by the test driver, filled
+    // with a pattern derived from its index.
+
+    char                   *d_address_p;  // address of the block
+    bsls::Types::size_type  d_size;       // number of bytes requested
+    char                    d_pattern;    // value written to each byte
+};
+
+bool checkPattern(const Block& block)
+    // Return 'true' if every byte of the specified 'block' holds the pattern
+    // of 'block', and 'false' otherwise.
+{
+    for (bsls::Types::size_type i = 0; i < block.d_size; ++i) {
+        if (block.d_address_p[i] != block.d_pattern) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Small Nodes Without Per-Block Overhead
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we are building a linked list of small nodes, and want all of
+// the nodes to be densely packed in memory.  We allocate the nodes from a
+// 'bdlma::SlabMultipool', which, unlike a 'bdlma::Multipool', dispenses
+// 16-byte nodes 16 bytes apart.
+//
+// First, we define the node type:
+//..
+    struct Node {
+        Node *d_next_p;
+        int   d_value;
+    };
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+// Then, we create a slab multipool, supplying a 'bslma::TestAllocator' so
+// that we can observe the memory that the multipool consumes:
+//..
+    bslma::TestAllocator ta;
+    {
+        bdlma::SlabMultipool multipool(&ta);
+//..
+// Next, we build a list of 100000 nodes:
+//..
+        Node *head = 0;
+        for (int i = 0; i < 100000; ++i) {
+            Node *node = static_cast<Node *>(multipool.allocate(sizeof(Node)));
+            node->d_next_p = head;
+            node->d_value  = i;
+            head           = node;
+        }
+//..
+// Now, we observe that consecutively allocated nodes are adjacent in memory
+// (within a slab), and that the memory obtained from the underlying allocator
+// is less than twice the size of the nodes themselves -- which is less than
+// the footprint of the nodes alone, had each of them been prefixed with a
+// maximally-aligned header:
+//..
+        ASSERT(sizeof(Node) ==
+               static_cast<char *>(static_cast<void *>(head))
+             - static_cast<char *>(static_cast<void *>(head->d_next_p)));
+        ASSERT(ta.numBytesInUse() < static_cast<bsls::Types::Int64>(
+                                                 2 * 100000 * sizeof(Node)));
+//..
+// Finally, we return the nodes to the multipool; the memory is then available
+// for reuse by subsequent 16-byte allocations:
+//..
+        while (head) {
+            Node *next = head->d_next_p;
+            multipool.deallocate(head);
+            head = next;
+        }
+    }
+    ASSERT(0 == ta.numBytesInUse());
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'deleteObject' AND 'deleteObjectRaw'
+        //
+        // Concerns:
+        //: 1 'deleteObject' and 'deleteObjectRaw' destroy the object and
+        //:   return its footprint to the multipool, including when
+        //:   'deleteObject' is given the address of a secondary base class.
+        //
+        // Plan:
+        //: 1 Repeatedly create an object of a type that multiply inherits
+        //:   from two types having virtual destructors, destroy it using each
+        //:   form of 'deleteObject' and 'deleteObjectRaw', and verify that the
+        //:   destructors have run and that the same address is dispensed on
+        //:   the next iteration.  (C-1)
+        //
+        // Testing:
+        //   template <class TYPE> void deleteObject(const TYPE *object);
+        //   template <class TYPE> void deleteObjectRaw(const TYPE *object);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'deleteObject' AND 'deleteObjectRaw'"
+                          << "\n============================================"
+                          << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        Obj mX(6, &ta);
+
+        const MostDerived *lastAddress = 0;
+
+        for (int di = 0; di < 6; ++di) {
+            MostDerived *pMD = static_cast<MostDerived *>(
+                                                 mX.allocate(sizeof(*pMD)));
+            new (pMD) MostDerived();
+            const MostDerived *pMDC = pMD;
+
+            ASSERTV(di, !lastAddress || lastAddress == pMDC);
+            lastAddress = pMDC;
+
+            ASSERTV(di, 1 == numMostDerived);
+
+            switch (di) {
+              case 0: {
+                mX.deleteObjectRaw(pMDC);
+              } break;
+              case 1: {
+                const LeftChild *pLCC = pMDC;
+                mX.deleteObjectRaw(pLCC);
+              } break;
+              case 2: {
+                mX.deleteObject(pMDC);
+              } break;
+              case 3: {
+                const LeftChild *pLCC = pMDC;
+                mX.deleteObject(pLCC);
+              } break;
+              case 4: {
+                const RightChild *pRCC = pMDC;
+                ASSERT(static_cast<const void *>(pRCC) !=
+                                              static_cast<const void *>(pMDC));
+                mX.deleteObject(pRCC);
+              } break;
+              case 5: {
+                mX.deleteObjectRaw(static_cast<const MostDerived *>(0));
+                mX.deleteObject(static_cast<const MostDerived *>(0));
+                mX.deleteObjectRaw(pMDC);
+              } break;
+            }
+
+            ASSERTV(di, 0 == numLeftChildren);
+            ASSERTV(di, 0 == numRightChildren);
+            ASSERTV(di, 0 == numMostDerived);
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'reserveCapacity'
+        //
+        // Concerns:
+        //: 1 After 'reserveCapacity(size, n)', 'n' blocks of 'size' can be
+        //:   allocated without any further request to the underlying
+        //:   allocator, whatever the state of the pool (empty, partially used
+        //:   span, blocks on the free list).
+        //:
+        //: 2 'reserveCapacity' does not allocate when enough blocks are
+        //:   already available.
+        //:
+        //: 3 'reserveCapacity' has no effect for a 'size' of 0 or an 'n' of
+        //:   0.
+        //
+        // Plan:
+        //: 1 For a set of sizes and counts, bring a multipool into one of
+        //:   several states, reserve capacity, and verify that the number of
+        //:   allocations from the test allocator does not change while
+        //:   allocating the reserved blocks (which must not overlap).  Then
+        //:   reserve again and verify that nothing is allocated.  (C-1..2)
+        //:
+        //: 2 Call 'reserveCapacity' with a 0 size or count and verify that
+        //:   nothing is allocated.  (C-3)
+        //
+        // Testing:
+        //   void reserveCapacity(bsls::Types::size_type size, int numBlocks);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'reserveCapacity'"
+                          << "\n=========================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        static const int SIZES[]   = { 1, 8, 24, 100, 1000, 4096 };
+        const int        NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        static const int COUNTS[]   = { 1, 3, 8, 50, 700 };
+        const int        NUM_COUNTS = sizeof COUNTS / sizeof *COUNTS;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+        for (int ci = 0; ci < NUM_COUNTS; ++ci) {
+        for (int state = 0; state < 3; ++state) {
+            const int SIZE  = SIZES[si];
+            const int COUNT = COUNTS[ci];
+
+            Obj mX(&ta);
+
+            if (1 == state) {
+                mX.allocate(SIZE);            // partially used span
+            }
+            else if (2 == state) {
+                void *blocks[5];
+                for (int i = 0; i < 5; ++i) {
+                    blocks[i] = mX.allocate(SIZE);
+                }
+                for (int i = 0; i < 5; ++i) {
+                    mX.deallocate(blocks[i]);  // blocks on the free list
+                }
+            }
+
+            mX.reserveCapacity(SIZE, COUNT);
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            mX.reserveCapacity(SIZE, COUNT);
+
+            ASSERTV(SIZE, COUNT, state,
+                    NUM_ALLOCATIONS == ta.numAllocations());
+
+            bsl::vector<char *> blocks(&ta);
+            blocks.reserve(COUNT);
+
+            const bsls::Types::Int64 NUM_AFTER_VECTOR = ta.numAllocations();
+
+            for (int i = 0; i < COUNT; ++i) {
+                blocks.push_back(static_cast<char *>(mX.allocate(SIZE)));
+                bsl::memset(blocks.back(), i & 0xff, SIZE);
+            }
+
+            ASSERTV(SIZE, COUNT, state,
+                    NUM_AFTER_VECTOR == ta.numAllocations());
+
+            for (int i = 0; i < COUNT; ++i) {
+                ASSERTV(SIZE, COUNT, state, i,
+                        static_cast<char>(i & 0xff) == blocks[i][0]);
+                ASSERTV(SIZE, COUNT, state, i,
+                        static_cast<char>(i & 0xff) == blocks[i][SIZE - 1]);
+            }
+        }
+        }
+        }
+
+        if (verbose) cout << "\tZero size or count." << endl;
+        {
+            Obj mX(&ta);
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            mX.reserveCapacity(0, 100);
+            mX.reserveCapacity(64, 0);
+
+            ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERT(0 == mX.numSlabs());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'release'
+        //
+        // Concerns:
+        //: 1 'release' returns all memory, pooled or not, to the underlying
+        //:   allocator, except for the internal array of pools and the slab
+        //:   directory, whose capacity is retained.
+        //:
+        //: 2 The multipool is fully usable after 'release', and a block of any
+        //:   size can then be allocated and deallocated.
+        //
+        // Plan:
+        //: 1 Allocate blocks of many sizes, including large blocks, then call
+        //:   'release' and verify that no slabs are owned, and that the memory
+        //:   in use by the test allocator is the same after each round.
+        //:   (C-1)
+        //:
+        //: 2 Repeat the allocations after 'release', deallocating half of
+        //:   them, and verify the contents of the others.  (C-2)
+        //
+        // Testing:
+        //   void release();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'release'"
+                          << "\n=================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        Obj mX(&ta);
+
+        const bsls::Types::Int64 EMPTY    = ta.numBytesInUse();
+        bsls::Types::Int64       released = 0;
+
+        for (int round = 0; round < 3; ++round) {
+            bsl::vector<Block> blocks;
+
+            for (int size = 1; size < 20000; size += 37) {
+                Block block;
+                block.d_address_p = static_cast<char *>(mX.allocate(size));
+                block.d_size      = size;
+                block.d_pattern   = static_cast<char>(size);
+                bsl::memset(block.d_address_p, block.d_pattern, size);
+                blocks.push_back(block);
+            }
+
+            for (bsl::size_t i = 0; i < blocks.size(); i += 2) {
+                mX.deallocate(blocks[i].d_address_p);
+            }
+            for (bsl::size_t i = 1; i < blocks.size(); i += 2) {
+                ASSERTV(round, i, checkPattern(blocks[i]));
+            }
+
+            ASSERTV(round, EMPTY < ta.numBytesInUse());
+            ASSERTV(round, 0 < mX.numSlabs());
+
+            mX.release();
+
+            ASSERTV(round, 0 == mX.numSlabs());
+            ASSERTV(round, EMPTY <= ta.numBytesInUse());
+            ASSERTV(round, 0 == round || released == ta.numBytesInUse());
+
+            released = ta.numBytesInUse();
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SLAB DIRECTORY GROWTH
+        //
+        // Concerns:
+        //: 1 As the number of slabs grows, the slab directory grows, and
+        //:   every block continues to be returned to the pool from which it
+        //:   was allocated.
+        //:
+        //: 2 'numSlabs' reports the number of slabs owned by the pools, which
+        //:   is consistent with the memory allocated.
+        //:
+        //: 3 Deallocated blocks are reused, in any order of deallocation,
+        //:   without requesting more memory from the underlying allocator.
+        //:
+        //: 4 The slabs remaining in a chunk that is too small for a span of
+        //:   several slabs are used for subsequent single-slab spans.
+        //
+        // Plan:
+        //: 1 Allocate a large number of blocks of several interleaved sizes,
+        //:   verifying that 'numSlabs' never decreases and that the memory
+        //:   obtained from the test allocator exceeds that of the slabs.
+        //:   (C-2)
+        //:
+        //: 2 Deallocate the blocks in a pseudo-random order, then allocate
+        //:   the same number of blocks of each size and verify that no memory
+        //:   was requested, and that every block lies in a distinct location
+        //:   formerly used by a block of the same size.  (C-1, 3)
+        //:
+        //: 3 Using a multipool whose largest blocks span 16 slabs, leave one
+        //:   slab unused at the end of a chunk, allocate a 16-slab block, and
+        //:   verify that the next pool replenished with a single slab obtains
+        //:   the left-over slab without allocating memory.  (C-4)
+        //
+        // Testing:
+        //   bsls::Types::size_type numSlabs() const;
+        //   SLAB DIRECTORY GROWTH
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nSLAB DIRECTORY GROWTH"
+                          << "\n=====================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        static const int SIZES[]   = { 8, 24, 40, 200, 3000 };
+        const int        NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+        const int        NUM_EACH  = 20000;
+
+        Obj mX(&ta);  const Obj& X = mX;
+
+        ASSERT(0 == X.numSlabs());
+
+        bsl::vector<bsl::vector<char *> > blocks(NUM_SIZES);
+
+        bsls::Types::size_type lastNumSlabs = 0;
+        for (int i = 0; i < NUM_EACH; ++i) {
+            for (int si = 0; si < NUM_SIZES; ++si) {
+                char *p = static_cast<char *>(mX.allocate(SIZES[si]));
+                *p = static_cast<char>(si);
+                blocks[si].push_back(p);
+            }
+            ASSERTV(i, lastNumSlabs <= X.numSlabs());
+            lastNumSlabs = X.numSlabs();
+        }
+
+        bsls::Types::size_type payload = 0;
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            payload += NUM_EACH * blockSizeFor(SIZES[si]);
+        }
+
+        if (veryVerbose) { P_(X.numSlabs()) P_(payload) P(ta.numBytesInUse()) }
+
+        ASSERT(payload <= X.numSlabs() * Obj::k_SLAB_SIZE);
+        ASSERT(X.numSlabs() * Obj::k_SLAB_SIZE
+                                 < static_cast<bsls::Types::size_type>(
+                                                          ta.numBytesInUse()));
+        ASSERT(ta.numBytesInUse() < static_cast<bsls::Types::Int64>(
+                                                         payload * 11 / 10));
+
+        // Deallocate in a pseudo-random order, interleaving the sizes.
+
+        unsigned int seed = 12345;
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            bsl::vector<char *>& v = blocks[si];
+            for (bsl::size_t i = v.size() - 1; 0 < i; --i) {
+                bsl::swap(v[i], v[nextRandom(&seed) % (i + 1)]);
+            }
+        }
+        for (int i = 0; i < NUM_EACH; ++i) {
+            for (int si = 0; si < NUM_SIZES; ++si) {
+                ASSERTV(si, i, static_cast<char>(si) == *blocks[si][i]);
+                mX.deallocate(blocks[si][i]);
+            }
+        }
+
+        const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+        const bsls::Types::size_type NUM_SLABS   = X.numSlabs();
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            bsl::vector<char *> again;
+            for (int i = 0; i < NUM_EACH; ++i) {
+                again.push_back(static_cast<char *>(mX.allocate(SIZES[si])));
+            }
+            bsl::sort(again.begin(), again.end());
+            bsl::sort(blocks[si].begin(), blocks[si].end());
+            ASSERTV(si, again == blocks[si]);
+        }
+
+        ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+        ASSERT(NUM_SLABS       == X.numSlabs());
+
+        if (verbose) cout << "\nReusing the slabs left over in a chunk."
+                          << endl;
+        {
+            const bsls::Types::size_type SLAB = Obj::k_SLAB_SIZE;
+
+            Obj mY(14, &ta);  const Obj& Y = mY;
+
+            ASSERT(16 * SLAB == Y.maxPooledBlockSize());
+
+            // The first chunk holds one slab, and the second two slabs, the
+            // latter of which is left unused by the 16-byte pool.
+
+            mY.allocate(8);
+            char *p = static_cast<char *>(mY.allocate(16));
+
+            const bsls::Types::UintPtr leftOver =
+                     (reinterpret_cast<bsls::Types::UintPtr>(p) & ~(SLAB - 1))
+                                                                       + SLAB;
+
+            mY.allocate(16 * SLAB);
+
+            ASSERT(18 == Y.numSlabs());
+
+            const bsls::Types::Int64 NUM_ALLOCS = ta.numAllocations();
+
+            char *q = static_cast<char *>(mY.allocate(32));
+
+            ASSERT(NUM_ALLOCS == ta.numAllocations());
+            ASSERT(leftOver   == reinterpret_cast<bsls::Types::UintPtr>(q));
+            ASSERT(19         == Y.numSlabs());
+
+            mY.deallocate(q);
+            mY.release();
+
+            ASSERT(0 == Y.numSlabs());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate(0)' returns 0 and allocates nothing.
+        //:
+        //: 2 Each pooled block is aligned on the lesser of its block size and
+        //:   the slab size, and is therefore maximally aligned unless it comes
+        //:   from the 8-byte pool; blocks that are not pooled are maximally
+        //:   aligned.
+        //:
+        //: 3 Consecutive allocations of the same size from a fresh pool are
+        //:   contiguous (there is no per-block header).
+        //:
+        //: 4 A deallocated block is returned to the pool of its size, and is
+        //:   dispensed by the next allocation of that size only.
+        //:
+        //: 5 Blocks larger than 'maxPooledBlockSize()' are obtained directly
+        //:   from the underlying allocator and returned to it on
+        //:   deallocation.
+        //:
+        //: 6 Live blocks of mixed sizes never overlap.
+        //
+        // Plan:
+        //: 1 Verify that 'allocate(0)' returns 0 without allocating.  (C-1)
+        //:
+        //: 2 For every size from 1 to just beyond 'maxPooledBlockSize()',
+        //:   allocate two blocks and verify their alignment and (for pooled
+        //:   blocks) that they are adjacent.  (C-2..3)
+        //:
+        //: 3 Deallocate a block of each pooled size, and verify that the next
+        //:   allocation of a different size does not return it, but that of
+        //:   the same size does.  (C-4)
+        //:
+        //: 4 Allocate and deallocate a large block and verify that the number
+        //:   of blocks in use by the test allocator goes up and down by one.
+        //:   (C-5)
+        //:
+        //: 5 Perform a pseudo-random sequence of allocations and deallocations
+        //:   of random sizes, filling each block with a pattern, and verify
+        //:   the pattern of every live block before it is deallocated.  (C-6)
+        //
+        // Testing:
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'allocate' AND 'deallocate'"
+                          << "\n===================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        if (verbose) cout << "\tZero-sized requests." << endl;
+        {
+            Obj mX(&ta);
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            ASSERT(0 == mX.allocate(0));
+            ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+        }
+
+        if (verbose) cout << "\tAlignment and contiguity." << endl;
+        {
+            Obj mX(&ta);
+
+            const int MAX_POOLED = static_cast<int>(mX.maxPooledBlockSize());
+
+            for (int size = 1; size <= MAX_POOLED + 100; ++size) {
+                char *p = static_cast<char *>(mX.allocate(size));
+                char *q = static_cast<char *>(mX.allocate(size));
+
+                bsl::memset(p, 0xa5, size);
+                bsl::memset(q, 0x5a, size);
+
+                if (size <= MAX_POOLED) {
+                    const bsls::Types::size_type BLOCK = blockSizeFor(size);
+
+                    ASSERTV(size, isAligned(p, BLOCK));
+                    ASSERTV(size, isAligned(q, BLOCK));
+                    ASSERTV(size, 8 == BLOCK || isAligned(p, MAX_ALIGN));
+
+                    // The first block of a span is never preceded by a
+                    // second block of the same span, so the two blocks are
+                    // adjacent unless 'p' was the last block of its span.
+
+                    ASSERTV(size, p + BLOCK == q
+                               || 0 == reinterpret_cast<UintPtr>(q)
+                                                     % bdlma::SlabMultipool::
+                                                                k_SLAB_SIZE);
+                }
+                else {
+                    ASSERTV(size, isAligned(p, MAX_ALIGN));
+                    ASSERTV(size, isAligned(q, MAX_ALIGN));
+                }
+
+                mX.deallocate(q);
+                mX.deallocate(p);
+            }
+        }
+
+        if (verbose) cout << "\tReuse by the owning pool only." << endl;
+        {
+            Obj mX(&ta);
+
+            for (int pool = 0; pool < mX.numPools(); ++pool) {
+                const int SIZE = 8 << pool;
+
+                void *p = mX.allocate(SIZE);
+                mX.deallocate(p);
+
+                void *q = mX.allocate(0 == pool ? 16 : SIZE / 2);
+                ASSERTV(pool, p != q);
+
+                void *r = mX.allocate(SIZE);
+                ASSERTV(pool, p == r);
+
+                mX.deallocate(q);
+                mX.deallocate(r);
+            }
+        }
+
+        if (verbose) cout << "\tLarge blocks." << endl;
+        {
+            Obj mX(&ta);
+
+            const bsls::Types::size_type LARGE = mX.maxPooledBlockSize() + 1;
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            void *p = mX.allocate(LARGE);
+            ASSERT(NUM_BLOCKS + 1 == ta.numBlocksInUse());
+            ASSERT(0 == mX.numSlabs());
+
+            mX.deallocate(p);
+            ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tRandom allocations." << endl;
+        {
+            Obj mX(8, &ta);
+
+            const int NUM_SLOTS = 500;
+            Block     slots[NUM_SLOTS];
+            bsl::memset(slots, 0, sizeof slots);
+
+            unsigned int seed = 42;
+            for (int i = 0; i < 100000; ++i) {
+                Block& slot = slots[nextRandom(&seed) % NUM_SLOTS];
+
+                if (slot.d_address_p) {
+                    ASSERTV(i, checkPattern(slot));
+                    mX.deallocate(slot.d_address_p);
+                    slot.d_address_p = 0;
+                }
+                else {
+                    const unsigned int r = nextRandom(&seed);
+                    slot.d_size      = 0 == r % 16
+                                     ? 1 + r % 3000
+                                     : 1 + r % 300;
+                    slot.d_pattern   = static_cast<char>(i);
+                    slot.d_address_p = static_cast<char *>(
+                                                   mX.allocate(slot.d_size));
+                    bsl::memset(slot.d_address_p,
+                                slot.d_pattern,
+                                slot.d_size);
+                }
+            }
+
+            for (int i = 0; i < NUM_SLOTS; ++i) {
+                if (slots[i].d_address_p) {
+                    ASSERTV(i, checkPattern(slots[i]));
+                }
+            }
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A multipool has the specified number of pools (or the default
+        //:   number), and pools blocks of up to '2^(numPools + 2)' bytes.
+        //:
+        //: 2 All memory is obtained from the supplied allocator, or from the
+        //:   default allocator if none is supplied, and 'allocator' returns
+        //:   that allocator.
+        //:
+        //: 3 The destructor returns all memory, including that of outstanding
+        //:   blocks.
+        //:
+        //: 4 Constructing a multipool obtains no slabs.
+        //
+        // Plan:
+        //: 1 Construct multipools using each constructor, with and without an
+        //:   allocator and for several numbers of pools, and verify the
+        //:   accessors.  (C-1..2, 4)
+        //:
+        //: 2 Allocate blocks of many sizes without deallocating them, destroy
+        //:   the multipool, and verify that no memory remains in use.  (C-3)
+        //
+        // Testing:
+        //   SlabMultipool(bslma::Allocator *basicAllocator = 0);
+        //   SlabMultipool(int numPools, bslma::Allocator *basicAllocator = 0);
+        //   ~SlabMultipool();
+        //   int numPools() const;
+        //   bsls::Types::size_type maxPooledBlockSize() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCREATORS AND BASIC ACCESSORS"
+                          << "\n============================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        for (int ti = 0; ti < 4; ++ti) {
+            for (int numPools = 1; numPools <= 16; ++numPools) {
+                const int NUM_POOLS = ti < 2 ? DEFAULT_NUM_POOLS : numPools;
+
+                if (ti < 2 && 1 < numPools) {
+                    continue;
+                }
+
+                Obj *objPtr = 0;
+                switch (ti) {
+                  case 0: objPtr = new Obj();                          break;
+                  case 1: objPtr = new Obj(&ta);                       break;
+                  case 2: objPtr = new Obj(numPools);                  break;
+                  case 3: objPtr = new Obj(numPools, &ta);             break;
+                }
+                Obj& mX = *objPtr;  const Obj& X = mX;
+
+                bslma::TestAllocator& oa = 0 == ti || 2 == ti
+                                         ? defaultAllocator
+                                         : ta;
+
+                ASSERTV(ti, NUM_POOLS, NUM_POOLS == X.numPools());
+                ASSERTV(ti, NUM_POOLS,
+                        static_cast<bsls::Types::size_type>(4) << NUM_POOLS
+                                                    == X.maxPooledBlockSize());
+                ASSERTV(ti, NUM_POOLS, &oa == X.allocator());
+                ASSERTV(ti, NUM_POOLS, 0 == X.numSlabs());
+                ASSERTV(ti, NUM_POOLS, 0 < oa.numBlocksInUse());
+
+                for (int size = 1; size < 10000; size += 11) {
+                    mX.allocate(size);
+                }
+
+                delete objPtr;
+
+                ASSERTV(ti, NUM_POOLS, 0 == ta.numBlocksInUse());
+                ASSERTV(ti, NUM_POOLS,
+                        0 == defaultAllocator.numBlocksInUse());
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks of a few sizes, and verify that
+        //:   small blocks are reused and that memory is returned on
+        //:   destruction.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(&ta);
+
+            void *p = mX.allocate(8);
+            void *q = mX.allocate(8);
+            void *r = mX.allocate(100);
+            void *s = mX.allocate(100000);
+
+            ASSERT(p && q && r && s);
+            ASSERT(static_cast<char *>(p) + 8 == q);
+            ASSERT(2 == mX.numSlabs());
+
+            mX.deallocate(p);
+            ASSERT(p == mX.allocate(7));
+
+            mX.deallocate(r);
+            mX.deallocate(s);
+            ASSERT(r == mX.allocate(65));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'bdlma::Multipool'
+        //
+        // Concerns:
+        //: 1 For small blocks, a slab multipool consumes less memory than a
+        //:   'bdlma::Multipool', and is at least as fast.
+        //
+        // Plan:
+        //: 1 For several block sizes typical of the nodes of node-based
+        //:   containers, allocate a large number of blocks, then deallocate
+        //:   them in a pseudo-random order and allocate them again, using each
+        //:   multipool; report the memory obtained from the underlying
+        //:   allocator and the time taken per operation.
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH 'bdlma::Multipool'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE"
+                          << "\n===========" << endl;
+
+        const int NUM_BLOCKS = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        static const int SIZES[]   = { 8, 16, 24, 32, 48, 64 };
+        const int        NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        bsl::vector<int> order(NUM_BLOCKS);
+        unsigned int     seed = 7;
+        for (int i = 0; i < NUM_BLOCKS; ++i) {
+            order[i] = i;
+        }
+        for (int i = NUM_BLOCKS - 1; 0 < i; --i) {
+            bsl::swap(order[i], order[nextRandom(&seed) % (i + 1)]);
+        }
+
+        bsl::vector<void *> blocks(NUM_BLOCKS);
+
+        cout << "size,multipool bytes,slab bytes,"
+             << "multipool ns/op,slab ns/op" << endl;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int           SIZE = SIZES[si];
+            bsls::Types::Int64  bytes[2];
+            double              nsPerOp[2];
+
+            for (int which = 0; which < 2; ++which) {
+                bslma::TestAllocator ta("supplier");
+                bdlma::Multipool     multipool(&ta);
+                Obj                  slabMultipool(&ta);
+
+                bsls::Stopwatch timer;
+                timer.start();
+
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    blocks[i] = 0 == which ? multipool.allocate(SIZE)
+                                           : slabMultipool.allocate(SIZE);
+                }
+
+                bytes[which] = ta.numBytesInUse();
+
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    if (0 == which) {
+                        multipool.deallocate(blocks[order[i]]);
+                    }
+                    else {
+                        slabMultipool.deallocate(blocks[order[i]]);
+                    }
+                }
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    blocks[i] = 0 == which ? multipool.allocate(SIZE)
+                                           : slabMultipool.allocate(SIZE);
+                    *static_cast<char *>(blocks[i]) = 0;
+                }
+
+                timer.stop();
+
+                nsPerOp[which] = timer.elapsedTime() * 1.0e9
+                               / (3.0 * NUM_BLOCKS);
+            }
+
+            cout << SIZE     << ','
+                 << bytes[0] << ',' << bytes[1] << ','
+                 << nsPerOp[0] << ',' << nsPerOp[1] << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
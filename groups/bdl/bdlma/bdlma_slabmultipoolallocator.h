@@ -0,0 +1,290 @@
+// bdlma_slabmultipoolallocator.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMA_SLABMULTIPOOLALLOCATOR
+#define INCLUDED_BDLMA_SLABMULTIPOOLALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a multipool allocator storing no per-block headers.
+//
+//@CLASSES:
+//  bdlma::SlabMultipoolAllocator: header-free allocator of varying-size pools
+//
+//@SEE_ALSO: bdlma_slabmultipool, bdlma_multipoolallocator
+//
+//@DESCRIPTION: This component provides a general-purpose, managed allocator,
+// 'bdlma::SlabMultipoolAllocator', that implements the
+// 'bdlma::ManagedAllocator' protocol and offers the same interface as
+// 'bdlma::MultipoolAllocator' (for the configuration options it shares), but
+// dispenses its memory from a 'bdlma::SlabMultipool' rather than a
+// 'bdlma::Multipool':
+//..
+//   ,-----------------------------.
+//  ( bdlma::SlabMultipoolAllocator )
+//   `-----------------------------'
+//                  |         ctor/dtor
+//                  |         maxPooledBlockSize
+//                  |         numPools
+//                  |         reserveCapacity
+//                  V
+//      ,-----------------------.
+//     ( bdlma::ManagedAllocator )
+//      `-----------------------'
+//                  |         release
+//                  V
+//         ,----------------.
+//        ( bslma::Allocator )
+//         `----------------'
+//                            allocate
+//                            deallocate
+//..
+// A 'bdlma::SlabMultipool' maintains a configurable number of pools, each
+// dispensing memory blocks of a unique size, with each successive pool
+// managing memory blocks of a size twice that of the previous pool.  Unlike a
+// 'bdlma::Multipool', it stores no header in the blocks it dispenses; the
+// pool owning a block is instead found from the address of the block (see
+// 'bdlma_slabmultipool').  For small blocks, such as the nodes of node-based
+// containers, a 'bdlma::SlabMultipoolAllocator' therefore consumes noticeably
+// less memory than a 'bdlma::MultipoolAllocator', and places consecutively
+// allocated blocks of the same size next to each other in memory.
+//
+// Note that blocks dispensed from the smallest (8-byte) pool are naturally,
+// rather than maximally, aligned (see {'bdlma_slabmultipool'|Alignment}).
+// Both the 'release' method and the destructor of a
+// 'bdlma::SlabMultipoolAllocator' release all memory currently allocated via
+// the object.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Supplying Memory to a Node-Based Container
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// A 'bdlma::SlabMultipoolAllocator' is a drop-in replacement for a
+// 'bdlma::MultipoolAllocator' supplying memory to a node-based container.
+// Suppose that we maintain a long 'bsl::list' of integers, and wish to
+// compare the memory consumed by its nodes when supplied by either allocator.
+//
+// First, we create two test allocators that will supply memory to each of the
+// multipool allocators:
+//..
+//  bslma::TestAllocator slabSupplier;
+//  bslma::TestAllocator headerSupplier;
+//
+//  bdlma::SlabMultipoolAllocator slabAllocator(&slabSupplier);
+//  bdlma::MultipoolAllocator     headerAllocator(&headerSupplier);
+//..
+// Then, within a scope that ends before the memory of the allocators is
+// released, we create a list using each allocator, and populate both with the
+// same 10000 integers:
+//..
+//  {
+//      bsl::list<int> slabList(&slabAllocator);
+//      bsl::list<int> headerList(&headerAllocator);
+//
+//      for (int i = 0; i < 10000; ++i) {
+//          slabList.push_back(i);
+//          headerList.push_back(i);
+//      }
+//..
+// Now, we observe that the list whose nodes carry no per-block header consumes
+// less memory (on typical 64-bit platforms, a list node holding an 'int'
+// occupies 24 bytes, and is dispensed from a 32-byte block by either
+// allocator, but a 'bdlma::MultipoolAllocator' adds a 16-byte header to each
+// block):
+//..
+//      assert(slabSupplier.numBytesInUse() < headerSupplier.numBytesInUse());
+//  }
+//..
+// Finally, we note that, as with any managed allocator, the memory held by
+// the allocator can be released in one call once the lists that used it have
+// been destroyed (a 'bsl::list' holds a sentinel node allocated from its
+// allocator, so the allocator must not be released while the list exists):
+//..
+//  slabAllocator.release();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_managedallocator.h>
+#include <bdlma_slabmultipool.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                        // ============================
+                        // class SlabMultipoolAllocator
+                        // ============================
+
+class SlabMultipoolAllocator : public ManagedAllocator {
+    // This class implements the 'bdlma::ManagedAllocator' protocol to provide
+    // an allocator that maintains a configurable number of pools, each
+    // dispensing memory blocks of a unique size, with each successive pool
+    // managing memory blocks of size twice that of the previous pool.  Each
+    // allocation (deallocation) request allocates memory from (returns memory
+    // to) the internal pool having the smallest block size not less than the
+    // requested size, or, if no pool manages memory blocks of sufficient size,
+    // from a separately managed list of memory blocks.  Pooled blocks carry no
+    // per-block header.  Both the 'release' method and the destructor of a
+    // 'bdlma::SlabMultipoolAllocator' release all memory currently allocated
+    // via the object.
+
+    // DATA
+    SlabMultipool d_multipool;  // manager for allocated memory blocks
+
+  private:
+    // NOT IMPLEMENTED
+    SlabMultipoolAllocator(const SlabMultipoolAllocator&);
+    SlabMultipoolAllocator& operator=(const SlabMultipoolAllocator&);
+
+  public:
+    // CREATORS
+    explicit
+    SlabMultipoolAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit
+    SlabMultipoolAllocator(int numPools, bslma::Allocator *basicAllocator = 0);
+        // Create a slab multipool allocator.  Optionally specify 'numPools',
+        // indicating the number of internally created pools; the block size
+        // of the first pool is 8 bytes, with the block size of each additional
+        // pool successively doubling.  If 'numPools' is not specified, an
+        // implementation-defined number of pools 'N' -- covering memory blocks
+        // ranging in size from '2^3 = 8' to '2^(N+2)' -- are created.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '1 <= numPools'.
+
+    virtual ~SlabMultipoolAllocator();
+        // Destroy this slab multipool allocator.  All memory allocated from
+        // this allocator is released.
+
+    // MANIPULATORS
+    void reserveCapacity(bsls::Types::size_type size, int numObjects);
+        // Reserve memory from this allocator to satisfy memory requests for
+        // at least the specified 'numObjects' having the specified 'size' (in
+        // bytes) before the pool replenishes.  If 'size' is 0, this method has
+        // no effect.  The behavior is undefined unless
+        // 'size <= maxPooledBlockSize()' and '0 <= numObjects'.
+
+                                // Virtual Functions
+
+    virtual void *allocate(bsls::Types::size_type size);
+        // Return the address of a contiguous block of memory of (at least) the
+        // specified 'size' (in bytes), aligned as described in
+        // {'bdlma_slabmultipool'|Alignment}.  If 'size' is 0, no memory is
+        // allocated and 0 is returned.  If 'size > maxPooledBlockSize()', the
+        // memory allocation is managed directly by the underlying allocator,
+        // but will not be pooled.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to this
+        // allocator for reuse.  If 'address' is 0, this method has no effect.
+        // The behavior is undefined unless 'address' was allocated by this
+        // allocator, and has not already been deallocated.
+
+    virtual void release();
+        // Release all memory currently allocated through this allocator.
+
+    // ACCESSORS
+    int numPools() const;
+        // Return the number of pools managed by this allocator.
+
+    bsls::Types::size_type maxPooledBlockSize() const;
+        // Return the maximum size of memory blocks that are pooled by this
+        // allocator.  Note that the maximum value is defined as:
+        //..
+        //  2 ^ (numPools + 2)
+        //..
+        // where 'numPools' is either specified at construction, or an
+        // implementation-defined value.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // class SlabMultipoolAllocator
+                        // ----------------------------
+
+// CREATORS
+inline
+SlabMultipoolAllocator::SlabMultipoolAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_multipool(basicAllocator)
+{
+}
+
+inline
+SlabMultipoolAllocator::SlabMultipoolAllocator(
+                                              int               numPools,
+                                              bslma::Allocator *basicAllocator)
+: d_multipool(numPools, basicAllocator)
+{
+}
+
+// MANIPULATORS
+inline
+void *SlabMultipoolAllocator::allocate(bsls::Types::size_type size)
+{
+    return d_multipool.allocate(size);
+}
+
+inline
+void SlabMultipoolAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(address != 0)) {
+        d_multipool.deallocate(address);
+    }
+}
+
+inline
+void SlabMultipoolAllocator::release()
+{
+    d_multipool.release();
+}
+
+inline
+void SlabMultipoolAllocator::reserveCapacity(bsls::Types::size_type size,
+                                             int                    numObjects)
+{
+    d_multipool.reserveCapacity(size, numObjects);
+}
+
+// ACCESSORS
+inline
+int SlabMultipoolAllocator::numPools() const
+{
+    return d_multipool.numPools();
+}
+
+inline
+bsls::Types::size_type SlabMultipoolAllocator::maxPooledBlockSize() const
+{
+    return d_multipool.maxPooledBlockSize();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,378 @@
+// bdlma_slabmultipoolallocator.t.cpp                                 -*-C++-*-
+#include <bdlma_slabmultipoolallocator.h>
+
+#include <bdlma_multipoolallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_list.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a managed allocator,
+// 'bdlma::SlabMultipoolAllocator', that forwards each of its operations to a
+// 'bdlma::SlabMultipool' (which is tested thoroughly in its own component).
+// We must verify that the allocator is usable through the 'bslma::Allocator'
+// and 'bdlma::ManagedAllocator' protocols, that each method forwards its
+// arguments and results correctly, that 'deallocate' accepts a null address,
+// and that all memory comes from the supplied allocator and is returned on
+// destruction.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] SlabMultipoolAllocator(bslma::Allocator *basicAllocator = 0);
+// [ 2] SlabMultipoolAllocator(int numPools, bslma::Allocator *ba = 0);
+// [ 2] ~SlabMultipoolAllocator();
+//
+// MANIPULATORS
+// [ 2] void *allocate(bsls::Types::size_type size);
+// [ 2] void deallocate(void *address);
+// [ 2] void release();
+// [ 2] void reserveCapacity(bsls::Types::size_type size, int numObjects);
+//
+// ACCESSORS
+// [ 2] int numPools() const;
+// [ 2] bsls::Types::size_type maxPooledBlockSize() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::SlabMultipoolAllocator Obj;
+
+const int DEFAULT_NUM_POOLS = 10;  // keep in sync with 'bdlma_slabmultipool'
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Supplying Memory to a Node-Based Container
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// A 'bdlma::SlabMultipoolAllocator' is a drop-in replacement for a
+// 'bdlma::MultipoolAllocator' supplying memory to a node-based container.
+// Suppose that we maintain a long 'bsl::list' of integers, and wish to
+// compare the memory consumed by its nodes when supplied by either allocator.
+//
+// First, we create two test allocators that will supply memory to each of the
+// multipool allocators:
+//..
+    bslma::TestAllocator slabSupplier;
+    bslma::TestAllocator headerSupplier;
+
+    bdlma::SlabMultipoolAllocator slabAllocator(&slabSupplier);
+    bdlma::MultipoolAllocator     headerAllocator(&headerSupplier);
+//..
+// Then, within a scope that ends before the memory of the allocators is
+// released, we create a list using each allocator, and populate both with the
+// same 10000 integers:
+//..
+    {
+        bsl::list<int> slabList(&slabAllocator);
+        bsl::list<int> headerList(&headerAllocator);
+
+        for (int i = 0; i < 10000; ++i) {
+            slabList.push_back(i);
+            headerList.push_back(i);
+        }
+//..
+// Now, we observe that the list whose nodes carry no per-block header consumes
+// less memory (on typical 64-bit platforms, a list node holding an 'int'
+// occupies 24 bytes, and is dispensed from a 32-byte block by either
+// allocator, but a 'bdlma::MultipoolAllocator' adds a 16-byte header to each
+// block):
+//..
+        ASSERT(slabSupplier.numBytesInUse() < headerSupplier.numBytesInUse());
+    }
+//..
+// Finally, we note that, as with any managed allocator, the memory held by
+// the allocator can be released in one call once the lists that used it have
+// been destroyed (a 'bsl::list' holds a sentinel node allocated from its
+// allocator, so the allocator must not be released while the list exists):
+//..
+    slabAllocator.release();
+//..
+
+        if (veryVerbose) {
+            P_(slabSupplier.numBytesInUse()) P(headerSupplier.numBytesInUse())
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, MANIPULATORS, AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor configures the number of pools and the
+        //:   allocator supplying memory as specified.
+        //:
+        //: 2 'allocate', 'deallocate', 'release', and 'reserveCapacity'
+        //:   forward to the underlying multipool, including when invoked
+        //:   through the base class protocols.
+        //:
+        //: 3 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //:
+        //: 4 The destructor returns all memory to the supplied allocator.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor, with and without a test
+        //:   allocator, and verify the accessors and the allocator from which
+        //:   memory is obtained.  (C-1)
+        //:
+        //: 2 Through a 'bdlma::ManagedAllocator' reference, allocate blocks of
+        //:   several sizes, verify that blocks of a pooled size are adjacent
+        //:   and reused after deallocation, and that 'release' returns the
+        //:   blocks to the supplied allocator.  Verify that reserved capacity
+        //:   is used without further allocation.  (C-2..3)
+        //:
+        //: 3 Destroy each object with outstanding blocks and verify that no
+        //:   memory remains in use.  (C-4)
+        //
+        // Testing:
+        //   SlabMultipoolAllocator(bslma::Allocator *basicAllocator = 0);
+        //   SlabMultipoolAllocator(int numPools, bslma::Allocator *ba = 0);
+        //   ~SlabMultipoolAllocator();
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        //   void release();
+        //   void reserveCapacity(bsls::Types::size_type size, int numObjects);
+        //   int numPools() const;
+        //   bsls::Types::size_type maxPooledBlockSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCREATORS, MANIPULATORS, AND ACCESSORS"
+                          << "\n=====================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        for (int ti = 0; ti < 4; ++ti) {
+            const int NUM_POOLS = ti < 2 ? DEFAULT_NUM_POOLS : 6;
+
+            Obj *objPtr = 0;
+            switch (ti) {
+              case 0: objPtr = new Obj();                               break;
+              case 1: objPtr = new Obj(&ta);                            break;
+              case 2: objPtr = new Obj(NUM_POOLS);                      break;
+              case 3: objPtr = new Obj(NUM_POOLS, &ta);                 break;
+            }
+            Obj& mX = *objPtr;  const Obj& X = mX;
+
+            bslma::TestAllocator& oa = 0 == ti || 2 == ti
+                                     ? defaultAllocator
+                                     : ta;
+
+            ASSERTV(ti, NUM_POOLS == X.numPools());
+            ASSERTV(ti, static_cast<bsls::Types::size_type>(4) << NUM_POOLS
+                                                    == X.maxPooledBlockSize());
+
+            bdlma::ManagedAllocator& managed = mX;
+
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+            ASSERTV(ti, 0 == managed.allocate(0));
+            managed.deallocate(0);
+
+            char *p = static_cast<char *>(managed.allocate(24));
+            char *q = static_cast<char *>(managed.allocate(24));
+            ASSERTV(ti, p + 32 == q);
+
+            managed.deallocate(q);
+            ASSERTV(ti, q == managed.allocate(17));
+
+            void *large = managed.allocate(X.maxPooledBlockSize() + 1);
+            ASSERTV(ti, large);
+
+            ASSERTV(ti, NUM_BLOCKS < oa.numBlocksInUse());
+
+            managed.release();
+
+            ASSERTV(ti, NUM_BLOCKS == oa.numBlocksInUse());
+
+            mX.reserveCapacity(100, 40);
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            for (int i = 0; i < 40; ++i) {
+                mX.allocate(100);
+            }
+
+            ASSERTV(ti, NUM_ALLOCATIONS == oa.numAllocations());
+
+            for (int size = 1; size < 1000; size += 13) {
+                mX.allocate(size);
+            }
+
+            delete objPtr;
+
+            ASSERTV(ti, 0 == ta.numBlocksInUse());
+            ASSERTV(ti, 0 == defaultAllocator.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks of a few sizes through the
+        //:   'bslma::Allocator' protocol, and verify that memory is returned
+        //:   on destruction.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj               mX(&ta);
+            bslma::Allocator& allocator = mX;
+
+            void *p = allocator.allocate(8);
+            void *q = allocator.allocate(1000);
+            void *r = allocator.allocate(100000);
+
+            ASSERT(p && q && r);
+
+            allocator.deallocate(p);
+            allocator.deallocate(q);
+            allocator.deallocate(r);
+
+            ASSERT(p == allocator.allocate(8));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,639 @@
+// bdlma_threadcachingmultipoolallocator.cpp                          -*-C++-*-
+#include <bdlma_threadcachingmultipoolallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_threadcachingmultipoolallocator_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_once.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+
+#include <new>          // placement 'new'
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Each thread cache consists of a 'ThreadCachingMultipoolAllocator_Cache',
+// obtained from the global allocator, and a single block, obtained from the
+// allocator supplied at construction, holding one array of 'd_maxCachedBlocks'
+// block addresses, and one count, for each pool.  The blocks of a pool are
+// stacked in its array in the order in which they were deallocated, so that
+// allocation reuses the most recently deallocated (and so most likely still
+// in the processor cache) block, and flushing a full array returns the least
+// recently deallocated ones.
+//
+// The address of the calling thread's cache is held in thread-specific
+// storage under a key owned by the allocator, which has no destructor.  The
+// caches of a thread (one for each allocator it has used) are also linked
+// into a list held in thread-specific storage under a single, process-wide
+// key that is never deleted, and whose destructor retires each cache in the
+// list when the thread exits.  The caches of an allocator are in addition
+// linked into a list owned by the allocator, so that it can report statistics
+// and dispose of the caches of threads that are still running when it is
+// itself destroyed.
+//
+// A thread may begin to exit while the allocator is being destroyed, so the
+// ownership of each cache is arbitrated by its atomic state.  An exiting
+// thread changes the state of an active cache to retiring before using its
+// allocator, and the destructor of the allocator waits for all retiring
+// caches to be unregistered.  The destructor changes the state of every
+// other cache to orphaned, releasing its block array; the (small) cache
+// object is then left to be destroyed by its thread when it exits, and is
+// not accessed by the destructor thereafter.
+//
+// 'release' cannot reach into the caches of other threads, which hold their
+// contents without synchronization.  Instead, it increments a generation
+// count, and each thread discards the contents of its cache the next time it
+// finds the cache's generation out of date.
+//
+// The memory supplied to the block arrays of the caches and to the multipool
+// comes from the same allocator, which need not be thread-safe; both obtain
+// it through a single 'ConcurrentAllocatorAdapter'.  'd_allocatorMutex' is
+// therefore always acquired last: the multipool may acquire it while holding
+// its own mutex, and the caches are created and destroyed while holding
+// 'd_cachesMutex'.
+
+namespace BloombergLP {
+namespace bdlma {
+
+namespace {
+
+enum {
+    k_DEFAULT_MAX_CACHED_BLOCKS = 32  // default capacity of a thread cache for
+                                      // each pool
+};
+
+enum CacheState {
+    // This enumeration defines the states of a thread cache.
+
+    e_ACTIVE   = 0,  // owned by its thread and registered with its allocator
+    e_RETIRING = 1,  // being unregistered by its exiting thread
+    e_ORPHANED = 2   // allocator destroyed; awaiting the exit of its thread
+};
+
+bool                   s_threadCachesKeyValid = false;
+                                  // 's_threadCachesKey' was created
+
+bslmt::ThreadUtil::Key s_threadCachesKey;
+                                  // key to the list of caches of the calling
+                                  // thread
+
+}  // close unnamed namespace
+
+                // ===========================================
+                // class ThreadCachingMultipoolAllocator_Cache
+                // ===========================================
+
+class ThreadCachingMultipoolAllocator_Cache {
+    // This component-private class holds the cache of free blocks of one
+    // thread.  All of its data other than the state and the links of the
+    // list of the allocator is accessed only by the owning thread; the
+    // statistics are atomic only so that they may be read safely by other
+    // threads.
+
+  public:
+    // DATA
+    ThreadCachingMultipoolAllocator
+                          *d_allocator_p;   // owning allocator
+
+    ThreadCachingMultipoolAllocator_Cache
+                          *d_next_p;        // next cache in the list
+
+    ThreadCachingMultipoolAllocator_Cache
+                          *d_prev_p;        // previous cache in the list
+
+    ThreadCachingMultipoolAllocator_Cache
+                          *d_threadNext_p;  // next cache of the owning thread
+
+    bslma::Allocator      *d_globalAllocator_p;
+                                            // allocator of this object
+
+    bsls::AtomicInt        d_state;         // 'CacheState' of this cache
+
+    bsls::AtomicInt        d_generation;    // value of the generation count
+                                            // of the allocator when last used
+
+    void                 **d_blocks_p;      // 'd_maxCachedBlocks' entries for
+                                            // each pool (owned)
+
+    int                   *d_counts_p;      // number of blocks cached for
+                                            // each pool
+
+    bsls::AtomicInt64      d_numHits;       // allocations from this cache
+
+    bsls::AtomicInt64      d_numMisses;     // pooled allocations not
+                                            // satisfied from this cache
+
+    bsls::AtomicInt64      d_numCached;     // total blocks in this cache
+
+    // CLASS METHODS
+    static void retire(void *caches);
+        // Return the blocks held by each cache in the list of the calling
+        // thread starting at the specified 'caches' to its allocator, unless
+        // the allocator has been destroyed, and destroy the cache.
+
+    // MANIPULATORS
+    void increment(bsls::AtomicInt64 *counter, bsls::Types::Int64 delta);
+        // Add the specified 'delta' to the specified 'counter', which is
+        // modified only by the owning thread of this cache.
+};
+
+extern "C"
+void bdlma_ThreadCachingMultipoolAllocator_retire(void *caches)
+    // Retire the list of caches of the calling thread starting at the
+    // specified 'caches'.  This function is the thread-specific storage
+    // destructor of the lists of caches.
+{
+    ThreadCachingMultipoolAllocator_Cache::retire(caches);
+}
+
+                // -------------------------------------------
+                // class ThreadCachingMultipoolAllocator_Cache
+                // -------------------------------------------
+
+// CLASS METHODS
+void ThreadCachingMultipoolAllocator_Cache::retire(void *caches)
+{
+    ThreadCachingMultipoolAllocator_Cache *cache =
+                  static_cast<ThreadCachingMultipoolAllocator_Cache *>(caches);
+
+    while (cache) {
+        ThreadCachingMultipoolAllocator_Cache *next = cache->d_threadNext_p;
+
+        // The destructor of the allocator waits for a retiring cache to be
+        // unregistered, and does not access an orphaned one.
+
+        if (e_ACTIVE == cache->d_state.testAndSwap(e_ACTIVE, e_RETIRING)) {
+            cache->d_allocator_p->retireCache(cache);
+        }
+
+        bslma::Allocator *allocator = cache->d_globalAllocator_p;
+        cache->~ThreadCachingMultipoolAllocator_Cache();
+        allocator->deallocate(cache);
+
+        cache = next;
+    }
+}
+
+// MANIPULATORS
+inline
+void ThreadCachingMultipoolAllocator_Cache::increment(
+                                            bsls::AtomicInt64  *counter,
+                                            bsls::Types::Int64  delta)
+{
+    counter->storeRelaxed(counter->loadRelaxed() + delta);
+}
+
+                   // -------------------------------------
+                   // class ThreadCachingMultipoolAllocator
+                   // -------------------------------------
+
+// PRIVATE MANIPULATORS
+void ThreadCachingMultipoolAllocator::createCacheKey()
+{
+    if (0 == d_maxCachedBlocks) {
+        return;                                                       // RETURN
+    }
+
+    BSLMT_ONCE_DO {
+        s_threadCachesKeyValid = 0 == bslmt::ThreadUtil::createKey(
+                                &s_threadCachesKey,
+                                &bdlma_ThreadCachingMultipoolAllocator_retire);
+    }
+
+    if (!s_threadCachesKeyValid
+     || 0 != bslmt::ThreadUtil::createKey(&d_cacheKey, 0)) {
+        // The thread-specific storage keys of the process are exhausted:
+        // operate as a plain concurrent multipool, without thread caches.
+
+        d_maxCachedBlocks = 0;
+    }
+}
+
+ThreadCachingMultipoolAllocator::Cache *
+ThreadCachingMultipoolAllocator::createCache()
+{
+    const int numPools = d_multipool.numPools();
+
+    const bsls::Types::size_type size =
+                            numPools * d_maxCachedBlocks * sizeof(void *)
+                          + numPools * sizeof(int);
+
+    bslma::Allocator *globalAllocator = bslma::Default::globalAllocator();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);
+
+    void *arrays = d_allocatorAdapter.allocate(size);
+    bslma::DeallocatorProctor<ConcurrentAllocatorAdapter> proctor(
+                                                         arrays,
+                                                         &d_allocatorAdapter);
+
+    Cache *cache = new (*globalAllocator) Cache();
+
+    proctor.release();
+
+    cache->d_allocator_p       = this;
+    cache->d_globalAllocator_p = globalAllocator;
+    cache->d_blocks_p          = static_cast<void **>(arrays);
+    cache->d_counts_p          = reinterpret_cast<int *>(
+                             cache->d_blocks_p + numPools * d_maxCachedBlocks);
+    cache->d_generation.storeRelaxed(d_generation.loadRelaxed());
+    cache->d_state.storeRelaxed(e_ACTIVE);
+    bsl::memset(cache->d_counts_p, 0, numPools * sizeof(int));
+
+    cache->d_prev_p = 0;
+    cache->d_next_p = d_caches_p;
+    if (d_caches_p) {
+        d_caches_p->d_prev_p = cache;
+    }
+    d_caches_p = cache;
+
+    cache->d_threadNext_p = static_cast<Cache *>(
+                           bslmt::ThreadUtil::getSpecific(s_threadCachesKey));
+    bslmt::ThreadUtil::setSpecific(s_threadCachesKey, cache);
+    bslmt::ThreadUtil::setSpecific(d_cacheKey, cache);
+
+    return cache;
+}
+
+void ThreadCachingMultipoolAllocator::flushCache(Cache *cache,
+                                                 int    poolIndex,
+                                                 int    numBlocks)
+{
+    void **blocks = cache->d_blocks_p + poolIndex * d_maxCachedBlocks;
+    int&   count  = cache->d_counts_p[poolIndex];
+
+    BSLS_ASSERT(numBlocks <= count);
+
+    for (int i = 0; i < numBlocks; ++i) {
+        d_multipool.deallocate(blocks[i]);
+    }
+    bsl::memmove(blocks,
+                 blocks + numBlocks,
+                 (count - numBlocks) * sizeof *blocks);
+    count -= numBlocks;
+
+    cache->increment(&cache->d_numCached, -numBlocks);
+}
+
+inline
+ThreadCachingMultipoolAllocator::Cache *
+ThreadCachingMultipoolAllocator::localCache()
+{
+    Cache *cache = static_cast<Cache *>(
+                                  bslmt::ThreadUtil::getSpecific(d_cacheKey));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cache)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        return createCache();                                         // RETURN
+    }
+
+    const int generation = d_generation.loadRelaxed();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                            cache->d_generation.loadRelaxed() != generation)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // The cached blocks were released with the rest of the memory of the
+        // multipool.
+
+        bsl::memset(cache->d_counts_p, 0, numPools() * sizeof(int));
+        cache->d_numCached.storeRelaxed(0);
+        cache->d_generation.storeRelaxed(generation);
+    }
+
+    return cache;
+}
+
+void ThreadCachingMultipoolAllocator::retireCache(Cache *cache)
+{
+    // Thread-specific storage destructors run later by the exiting thread may
+    // still use this allocator, which must then create a new cache.
+
+    bslmt::ThreadUtil::setSpecific(d_cacheKey, 0);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);
+
+    if (cache->d_generation.loadRelaxed() == d_generation.loadRelaxed()) {
+        const int numPools = d_multipool.numPools();
+        for (int i = 0; i < numPools; ++i) {
+            void **blocks = cache->d_blocks_p + i * d_maxCachedBlocks;
+            for (int j = 0; j < cache->d_counts_p[i]; ++j) {
+                d_multipool.deallocate(blocks[j]);
+            }
+        }
+    }
+
+    d_retiredNumHits   += cache->d_numHits.loadRelaxed();
+    d_retiredNumMisses += cache->d_numMisses.loadRelaxed();
+
+    if (cache->d_prev_p) {
+        cache->d_prev_p->d_next_p = cache->d_next_p;
+    }
+    else {
+        d_caches_p = cache->d_next_p;
+    }
+    if (cache->d_next_p) {
+        cache->d_next_p->d_prev_p = cache->d_prev_p;
+    }
+
+    d_allocatorAdapter.deallocate(cache->d_blocks_p);
+}
+
+// CREATORS
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_allocatorMutex()
+, d_allocatorAdapter(&d_allocatorMutex, basicAllocator)
+, d_multipool(&d_allocatorAdapter)
+, d_maxCachedBlocks(k_DEFAULT_MAX_CACHED_BLOCKS)
+, d_cacheKey()
+, d_generation(0)
+, d_caches_p(0)
+, d_retiredNumHits(0)
+, d_retiredNumMisses(0)
+, d_cachesMutex()
+{
+    createCacheKey();
+}
+
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                                              int               numPools,
+                                              bslma::Allocator *basicAllocator)
+: d_allocatorMutex()
+, d_allocatorAdapter(&d_allocatorMutex, basicAllocator)
+, d_multipool(numPools, &d_allocatorAdapter)
+, d_maxCachedBlocks(k_DEFAULT_MAX_CACHED_BLOCKS)
+, d_cacheKey()
+, d_generation(0)
+, d_caches_p(0)
+, d_retiredNumHits(0)
+, d_retiredNumMisses(0)
+, d_cachesMutex()
+{
+    BSLS_ASSERT(1 <= numPools);
+
+    createCacheKey();
+}
+
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                                             int               numPools,
+                                             int               maxCachedBlocks,
+                                             bslma::Allocator *basicAllocator)
+: d_allocatorMutex()
+, d_allocatorAdapter(&d_allocatorMutex, basicAllocator)
+, d_multipool(numPools, &d_allocatorAdapter)
+, d_maxCachedBlocks(maxCachedBlocks)
+, d_cacheKey()
+, d_generation(0)
+, d_caches_p(0)
+, d_retiredNumHits(0)
+, d_retiredNumMisses(0)
+, d_cachesMutex()
+{
+    BSLS_ASSERT(1 <= numPools);
+    BSLS_ASSERT(0 <= maxCachedBlocks);
+
+    createCacheKey();
+}
+
+ThreadCachingMultipoolAllocator::~ThreadCachingMultipoolAllocator()
+{
+    if (0 == d_maxCachedBlocks) {
+        return;                                                       // RETURN
+    }
+
+    // The cache of the calling thread, if any, is removed from the list of
+    // caches of the thread, and destroyed below.
+
+    Cache *ownCache = static_cast<Cache *>(
+                                  bslmt::ThreadUtil::getSpecific(d_cacheKey));
+    if (ownCache) {
+        Cache *head = static_cast<Cache *>(
+                           bslmt::ThreadUtil::getSpecific(s_threadCachesKey));
+        if (head == ownCache) {
+            bslmt::ThreadUtil::setSpecific(s_threadCachesKey,
+                                           ownCache->d_threadNext_p);
+        }
+        else {
+            while (head->d_threadNext_p != ownCache) {
+                head = head->d_threadNext_p;
+            }
+            head->d_threadNext_p = ownCache->d_threadNext_p;
+        }
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);
+
+        while (d_caches_p) {
+            Cache *cache = d_caches_p;
+            while (cache) {
+                // Once orphaned, 'cache' may be destroyed by its exiting
+                // thread at any time, so its links and block array are loaded
+                // beforehand.  The blocks it holds are released with the
+                // multipool.
+
+                Cache *next   = cache->d_next_p;
+                Cache *prev   = cache->d_prev_p;
+                void  *arrays = cache->d_blocks_p;
+
+                if (e_ACTIVE == cache->d_state.testAndSwap(e_ACTIVE,
+                                                           e_ORPHANED)) {
+                    if (prev) {
+                        prev->d_next_p = next;
+                    }
+                    else {
+                        d_caches_p = next;
+                    }
+                    if (next) {
+                        next->d_prev_p = prev;
+                    }
+                    d_allocatorAdapter.deallocate(arrays);
+                }
+                cache = next;
+            }
+
+            if (d_caches_p) {
+                // The remaining caches are being retired by exiting threads,
+                // which need 'd_cachesMutex' to unregister them.
+
+                bslmt::UnLockGuard<bslmt::Mutex> unguard(&d_cachesMutex);
+                bslmt::ThreadUtil::yield();
+            }
+        }
+    }
+
+    if (ownCache) {
+        bslma::Allocator *allocator = ownCache->d_globalAllocator_p;
+        ownCache->~Cache();
+        allocator->deallocate(ownCache);
+    }
+
+    bslmt::ThreadUtil::deleteKey(d_cacheKey);
+}
+
+// MANIPULATORS
+void *ThreadCachingMultipoolAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        return 0;                                                     // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                       size > d_multipool.maxPooledBlockSize()
+                                    || 0 == d_maxCachedBlocks)) {
+        return d_multipool.allocate(size);                            // RETURN
+    }
+
+    // Pool 'i' dispenses blocks of '2^(i + 3)' bytes.
+
+    const int poolIndex = size <= 8
+                        ? 0
+                        : bdlb::BitUtil::log2(static_cast<bsl::uint64_t>(size))
+                                                                          - 3;
+
+    Cache *cache = localCache();
+    int&   count = cache->d_counts_p[poolIndex];
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(count)) {
+        --count;
+        cache->increment(&cache->d_numCached, -1);
+        cache->increment(&cache->d_numHits, 1);
+
+        return cache->d_blocks_p[poolIndex * d_maxCachedBlocks + count];
+                                                                      // RETURN
+    }
+
+    cache->increment(&cache->d_numMisses, 1);
+
+    return d_multipool.allocate(size);
+}
+
+void ThreadCachingMultipoolAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        return;                                                       // RETURN
+    }
+
+    const int poolIndex = d_multipool.poolIndex(address);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 > poolIndex
+                                           || 0 == d_maxCachedBlocks)) {
+        d_multipool.deallocate(address);
+        return;                                                       // RETURN
+    }
+
+    Cache *cache = localCache();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                        cache->d_counts_p[poolIndex] == d_maxCachedBlocks)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        flushCache(cache, poolIndex, (d_maxCachedBlocks + 1) / 2);
+    }
+
+    int& count = cache->d_counts_p[poolIndex];
+
+    cache->d_blocks_p[poolIndex * d_maxCachedBlocks + count] = address;
+    ++count;
+    cache->increment(&cache->d_numCached, 1);
+}
+
+void ThreadCachingMultipoolAllocator::flushThreadCache()
+{
+    if (0 == d_maxCachedBlocks
+     || !bslmt::ThreadUtil::getSpecific(d_cacheKey)) {
+        return;                                                       // RETURN
+    }
+
+    Cache *cache = localCache();
+
+    const int numPools = d_multipool.numPools();
+    for (int i = 0; i < numPools; ++i) {
+        flushCache(cache, i, cache->d_counts_p[i]);
+    }
+}
+
+void ThreadCachingMultipoolAllocator::release()
+{
+    d_generation.addRelaxed(1);
+    d_multipool.release();
+}
+
+// ACCESSORS
+bsls::Types::Int64 ThreadCachingMultipoolAllocator::numCacheHits() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);
+
+    bsls::Types::Int64 result = d_retiredNumHits;
+    for (const Cache *cache = d_caches_p; cache; cache = cache->d_next_p) {
+        result += cache->d_numHits.loadRelaxed();
+    }
+    return result;
+}
+
+bsls::Types::Int64 ThreadCachingMultipoolAllocator::numCacheMisses() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);
+
+    bsls::Types::Int64 result = d_retiredNumMisses;
+    for (const Cache *cache = d_caches_p; cache; cache = cache->d_next_p) {
+        result += cache->d_numMisses.loadRelaxed();
+    }
+    return result;
+}
+
+bsls::Types::Int64 ThreadCachingMultipoolAllocator::numCachedBlocks() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);
+
+    const int generation = d_generation.loadRelaxed();
+
+    bsls::Types::Int64 result = 0;
+    for (const Cache *cache = d_caches_p; cache; cache = cache->d_next_p) {
+        if (cache->d_generation.loadRelaxed() == generation) {
+            result += cache->d_numCached.loadRelaxed();
+        }
+    }
+    return result;
+}
+
+int ThreadCachingMultipoolAllocator::numThreadCaches() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);
+
+    int result = 0;
+    for (const Cache *cache = d_caches_p; cache; cache = cache->d_next_p) {
+        ++result;
+    }
+    return result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,440 @@
+// bdlma_threadcachingmultipoolallocator.h                            -*-C++-*-
+#ifndef INCLUDED_BDLMA_THREADCACHINGMULTIPOOLALLOCATOR
+#define INCLUDED_BDLMA_THREADCACHINGMULTIPOOLALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a multipool allocator with per-thread caches of blocks.
+//
+//@CLASSES:
+//  bdlma::ThreadCachingMultipoolAllocator: multipool with thread caches
+//
+//@SEE_ALSO: bdlma_concurrentmultipoolallocator, bdlma_concurrentmultipool
+//
+//@DESCRIPTION: This component provides a thread-safe allocator,
+// 'bdlma::ThreadCachingMultipoolAllocator', that implements the
+// 'bdlma::ManagedAllocator' protocol.  Like a
+// 'bdlma::ConcurrentMultipoolAllocator', it dispenses memory from a
+// 'bdlma::ConcurrentMultipool', which maintains a configurable number of
+// pools, each dispensing blocks of a unique size, with each successive pool
+// managing blocks of a size twice that of the previous pool:
+//..
+//   ,---------------------------------------.
+//  ( bdlma::ThreadCachingMultipoolAllocator )
+//   `---------------------------------------'
+//                      |        ctor/dtor
+//                      |        flushThreadCache
+//                      |        maxCachedBlocks
+//                      |        maxPooledBlockSize
+//                      |        numCacheHits
+//                      |        numCacheMisses
+//                      |        numCachedBlocks
+//                      |        numPools
+//                      |        numThreadCaches
+//                      |        reserveCapacity
+//                      V
+//          ,-----------------------.
+//         ( bdlma::ManagedAllocator )
+//          `-----------------------'
+//                      |        release
+//                      V
+//              ,----------------.
+//             ( bslma::Allocator )
+//              `----------------'
+//                               allocate
+//                               deallocate
+//..
+// In addition, each thread using the allocator is given its own cache,
+// holding, for each pool, up to a fixed number of blocks that the thread has
+// deallocated.  Allocation requests are satisfied from the calling thread's
+// cache when possible, and blocks are deallocated into the calling thread's
+// cache while it has room; neither operation then touches any data shared
+// with other threads.  The free lists of the underlying
+// 'bdlma::ConcurrentPool' objects, whose heads are updated atomically by
+// every operation and therefore bounce between the caches of the processors
+// of a heavily-threaded application, are consulted only when a thread's cache
+// is empty (on allocation) or full (on deallocation).
+//
+///Thread Caches
+///-------------
+// A thread's cache is created the first time the thread allocates or
+// deallocates a pooled block.  Each cache holds at most 'maxCachedBlocks()'
+// blocks of each pooled size (the "capacity" of the cache, configurable at
+// construction).  When a thread deallocates a block into a cache that is
+// already full for that size, the half of the cached blocks that were
+// deallocated least recently are first returned to the shared pool.  The
+// memory held in the thread caches of a default-constructed allocator is
+// therefore bounded by a small multiple of the sum of the pooled block sizes
+// for each thread; a capacity of 0 disables caching altogether.
+//
+// Blocks need not be deallocated by the thread that allocated them: a block
+// is cached by the thread that deallocates it, and is then available to that
+// thread's subsequent allocations.  Blocks larger than
+// 'maxPooledBlockSize()' are never cached.
+//
+// When a thread exits, all of the blocks in its cache are returned to the
+// shared pools, and the cache itself is destroyed.  A thread may also return
+// the contents of its cache at any time by calling 'flushThreadCache'.  The
+// block array of a cache is obtained from the allocator supplied at
+// construction, but the small object managing it is obtained from the global
+// allocator (see 'bslma_default'): if the allocator is destroyed while a
+// thread having a cache is still running, that object is destroyed only when
+// the thread exits.  Note that each 'bdlma::ThreadCachingMultipoolAllocator'
+// object consumes a thread-specific storage key (see
+// 'bslmt::ThreadUtil::createKey') for its lifetime, in addition to one key
+// shared by all such objects, and that the number of such keys available to a
+// process is limited; this allocator is intended for long-lived,
+// heavily-shared uses.  An allocator constructed when no key is available does
+// not cache blocks (its 'maxCachedBlocks' is 0), and behaves as a plain
+// concurrent multipool.
+//
+///Statistics
+///----------
+// The allocator keeps, for each thread cache, counts of the pooled
+// allocations satisfied from the cache ('numCacheHits') and from the shared
+// pools ('numCacheMisses'), and of the number of blocks currently cached
+// ('numCachedBlocks').  These counters are updated only by the owning thread,
+// without synchronization, so that maintaining them does not reintroduce the
+// contention the caches are meant to remove; the accessors return the sums of
+// the counters of all caches (including those of threads that have exited),
+// which are exact when no other thread is using the allocator.
+//
+///'release'
+///---------
+// 'release' relinquishes all memory allocated via the allocator, including
+// the blocks held in the thread caches, which the owning threads then discard
+// the next time they use the allocator.  As for the other managed allocators
+// in this package, the behavior is undefined if 'release' is called while
+// another thread is using the allocator, or if memory obtained before the
+// call to 'release' is used afterward.
+//
+///Thread Safety
+///-------------
+// 'bdlma::ThreadCachingMultipoolAllocator' is *fully thread-safe*, except for
+// 'release' (see above) and the destructor, meaning that any other operation
+// can be called on the same object simultaneously from multiple threads.  The
+// allocator supplied at construction need not be thread-safe: it is only ever
+// used under the protection of a mutex.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Messages in Worker Threads
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service processes each incoming message in one of a set of
+// worker threads, and that processing a message allocates and frees many
+// small, short-lived objects.  A 'bdlma::ThreadCachingMultipoolAllocator'
+// shared by the worker threads lets most of those operations complete within
+// the thread that performs them.
+//
+// First, we define a functor, run by each worker thread, that repeatedly
+// builds and discards a collection of small strings using the shared
+// allocator:
+//..
+//  struct MessageProcessor {
+//      // This 'struct' simulates the processing of messages by a worker
+//      // thread.
+//
+//      // DATA
+//      bslma::Allocator *d_allocator_p;  // allocator shared by the workers
+//      int               d_numMessages;  // number of messages to process
+//
+//      // ACCESSORS
+//      void operator()() const
+//          // Simulate processing 'd_numMessages' messages using
+//          // 'd_allocator_p' to supply memory.
+//      {
+//          for (int i = 0; i < d_numMessages; ++i) {
+//              bsl::vector<bsl::string> fields(d_allocator_p);
+//              for (int j = 0; j < 10; ++j) {
+//                  fields.push_back(bsl::string(40, 'a', d_allocator_p));
+//              }
+//          }
+//      }
+//  };
+//..
+// Then, we create the allocator, allowing each thread to cache up to 16
+// blocks of each size:
+//..
+//  bdlma::ThreadCachingMultipoolAllocator allocator(8, 16);
+//..
+// Next, we run several worker threads that share the allocator:
+//..
+//  enum { k_NUM_THREADS = 4 };
+//
+//  MessageProcessor processor = { &allocator, 1000 };
+//
+//  bslmt::ThreadGroup workers;
+//  workers.addThreads(processor, k_NUM_THREADS);
+//  workers.joinAll();
+//..
+// Finally, we observe that nearly all of the allocations were satisfied from
+// the thread caches, and that the blocks cached by the worker threads were
+// returned to the shared pools when those threads exited:
+//..
+//  assert(allocator.numCacheHits() > 10 * allocator.numCacheMisses());
+//  assert(0 == allocator.numThreadCaches());
+//  assert(0 == allocator.numCachedBlocks());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_concurrentallocatoradapter.h>
+#include <bdlma_concurrentmultipool.h>
+#include <bdlma_managedallocator.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+class ThreadCachingMultipoolAllocator_Cache;
+
+                   // =====================================
+                   // class ThreadCachingMultipoolAllocator
+                   // =====================================
+
+class ThreadCachingMultipoolAllocator : public ManagedAllocator {
+    // This class implements the 'ManagedAllocator' protocol to provide a
+    // thread-safe allocator that dispenses memory from a
+    // 'bdlma::ConcurrentMultipool', through a cache of free blocks maintained
+    // for each thread using the allocator.
+
+    // PRIVATE TYPES
+    typedef ThreadCachingMultipoolAllocator_Cache Cache;
+
+    // DATA
+    bslmt::Mutex               d_allocatorMutex;   // serializes use of the
+                                                   // allocator supplied at
+                                                   // construction
+
+    ConcurrentAllocatorAdapter d_allocatorAdapter; // thread-safe adapter for
+                                                   // the allocator supplied at
+                                                   // construction
+
+    ConcurrentMultipool        d_multipool;        // shared pools, supplying
+                                                   // all memory
+
+    int                        d_maxCachedBlocks;  // capacity of a thread
+                                                   // cache for each pool (0
+                                                   // if caching is disabled)
+
+    bslmt::ThreadUtil::Key     d_cacheKey;         // key, without
+                                                   // destructor, to the
+                                                   // calling thread's cache
+                                                   // (valid only if
+                                                   // 'd_maxCachedBlocks')
+
+    bsls::AtomicInt            d_generation;       // number of calls to
+                                                   // 'release'
+
+    Cache                     *d_caches_p;         // list of caches of live
+                                                   // threads
+
+    bsls::Types::Int64         d_retiredNumHits;   // cache hits of exited
+                                                   // threads
+
+    bsls::Types::Int64         d_retiredNumMisses; // cache misses of exited
+                                                   // threads
+
+    mutable bslmt::Mutex       d_cachesMutex;      // protects 'd_caches_p' and
+                                                   // the retired statistics
+
+    // FRIENDS
+    friend class ThreadCachingMultipoolAllocator_Cache;
+
+  private:
+    // NOT IMPLEMENTED
+    ThreadCachingMultipoolAllocator(const ThreadCachingMultipoolAllocator&);
+    ThreadCachingMultipoolAllocator& operator=(
+                                       const ThreadCachingMultipoolAllocator&);
+
+    // PRIVATE MANIPULATORS
+    void createCacheKey();
+        // Create the thread-specific storage key of the thread caches, unless
+        // 'd_maxCachedBlocks' is 0.  If no key is available, set
+        // 'd_maxCachedBlocks' to 0, disabling the thread caches.
+
+    Cache *createCache();
+        // Create a cache for the calling thread, register it with this
+        // allocator, and return its address.
+
+    void flushCache(Cache *cache, int poolIndex, int numBlocks);
+        // Return to the shared pools the specified 'numBlocks' least recently
+        // cached blocks of the specified 'poolIndex' in the specified 'cache'.
+        // The behavior is undefined unless 'cache' belongs to the calling
+        // thread, and 'numBlocks' does not exceed the number of blocks of
+        // 'poolIndex' in 'cache'.
+
+    Cache *localCache();
+        // Return the address of the cache of the calling thread, creating it
+        // if necessary, and discarding its contents if 'release' has been
+        // called since the cache was last used.
+
+    void retireCache(Cache *cache);
+        // Return all blocks held by the specified 'cache' of the calling
+        // thread to the shared pools, accumulate its statistics, unregister
+        // it, and deallocate its block array.  The behavior is undefined
+        // unless the calling thread is exiting.
+
+  public:
+    // CREATORS
+    explicit
+    ThreadCachingMultipoolAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit
+    ThreadCachingMultipoolAllocator(int               numPools,
+                                    bslma::Allocator *basicAllocator = 0);
+    ThreadCachingMultipoolAllocator(int               numPools,
+                                    int               maxCachedBlocks,
+                                    bslma::Allocator *basicAllocator = 0);
+        // Create a thread-caching multipool allocator.  Optionally specify
+        // 'numPools', indicating the number of internally created pools; the
+        // block size of the first pool is 8 bytes, with the block size of each
+        // additional pool successively doubling.  If 'numPools' is not
+        // specified, an implementation-defined number of pools is created.  If
+        // 'numPools' is specified, optionally specify 'maxCachedBlocks', the
+        // maximum number of blocks of each size held in the cache of each
+        // thread; if 'maxCachedBlocks' is not specified, an
+        // implementation-defined value is used, and if it is 0, no blocks are
+        // cached (as is also the case if no thread-specific storage key is
+        // available).  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '1 <= numPools' and '0 <= maxCachedBlocks'.
+
+    virtual ~ThreadCachingMultipoolAllocator();
+        // Destroy this allocator, and release all memory allocated through
+        // it, including the blocks held in thread caches.  The behavior is
+        // undefined if any other thread is using this allocator during the
+        // destruction.  Note that threads that have used this allocator may
+        // exit during, or after, the destruction.
+
+    // MANIPULATORS
+    virtual void *allocate(bsls::Types::size_type size);
+        // Return the address of a contiguous block of maximally-aligned memory
+        // of (at least) the specified 'size' (in bytes).  If 'size' is 0, no
+        // memory is allocated and 0 is returned.  If
+        // 'size <= maxPooledBlockSize()', the block is taken from the cache of
+        // the calling thread if possible, and from the corresponding shared
+        // pool otherwise.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to this
+        // allocator.  If 'address' is 0, this method has no effect.  A pooled
+        // block is placed in the cache of the calling thread, after returning
+        // half of the cached blocks of the same size to the shared pool if
+        // the cache is full.  The behavior is undefined unless 'address' was
+        // allocated using this allocator object and has not already been
+        // deallocated.
+
+    void flushThreadCache();
+        // Return all blocks held in the cache of the calling thread to the
+        // shared pools.  This method has no effect if the calling thread has
+        // no cache.
+
+    virtual void release();
+        // Relinquish all memory currently allocated via this allocator,
+        // including the blocks held in thread caches.  The behavior is
+        // undefined if any other thread is using this allocator during the
+        // call.
+
+    void reserveCapacity(bsls::Types::size_type size, int numObjects);
+        // Reserve memory from the shared pools to satisfy memory requests for
+        // at least the specified 'numObjects' having the specified 'size' (in
+        // bytes) before the pool replenishes.  If 'size' is 0, this method has
+        // no effect.  The behavior is undefined unless
+        // 'size <= maxPooledBlockSize()' and '0 <= numObjects'.
+
+    // ACCESSORS
+    int maxCachedBlocks() const;
+        // Return the maximum number of blocks of each size held in the cache
+        // of each thread, or 0 if thread caching is disabled.
+
+    bsls::Types::size_type maxPooledBlockSize() const;
+        // Return the maximum size of memory blocks that are pooled (and
+        // cached) by this allocator.
+
+    bsls::Types::Int64 numCacheHits() const;
+        // Return the number of pooled allocations that were satisfied from a
+        // thread cache.
+
+    bsls::Types::Int64 numCacheMisses() const;
+        // Return the number of pooled allocations that were satisfied from
+        // the shared pools because the cache of the calling thread held no
+        // block of the requested size.
+
+    bsls::Types::Int64 numCachedBlocks() const;
+        // Return the number of blocks currently held in thread caches.
+
+    int numPools() const;
+        // Return the number of pools managed by this allocator.
+
+    int numThreadCaches() const;
+        // Return the number of threads currently having a cache.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                   // -------------------------------------
+                   // class ThreadCachingMultipoolAllocator
+                   // -------------------------------------
+
+// MANIPULATORS
+inline
+void ThreadCachingMultipoolAllocator::reserveCapacity(
+                                             bsls::Types::size_type size,
+                                             int                    numObjects)
+{
+    d_multipool.reserveCapacity(size, numObjects);
+}
+
+// ACCESSORS
+inline
+int ThreadCachingMultipoolAllocator::maxCachedBlocks() const
+{
+    return d_maxCachedBlocks;
+}
+
+inline
+bsls::Types::size_type
+ThreadCachingMultipoolAllocator::maxPooledBlockSize() const
+{
+    return d_multipool.maxPooledBlockSize();
+}
+
+inline
+int ThreadCachingMultipoolAllocator::numPools() const
+{
+    return d_multipool.numPools();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1312 @@
+// bdlma_threadcachingmultipoolallocator.t.cpp                        -*-C++-*-
+#include <bdlma_threadcachingmultipoolallocator.h>
+
+#include <bdlma_concurrentmultipool.h>
+#include <bdlma_concurrentmultipoolallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a managed allocator,
+// 'bdlma::ThreadCachingMultipoolAllocator', that places a cache of free blocks
+// for each thread in front of a 'bdlma::ConcurrentMultipool'.  We must verify
+// that pooled blocks are recycled through the cache of the calling thread up
+// to the configured capacity, that the statistics reflect this, that the
+// caches of exiting threads are returned to the shared pools, that 'release'
+// invalidates the caches of all threads, that all memory comes from the
+// supplied allocator and is returned on destruction (including when threads
+// having caches are still running, or are exiting), and that the allocator
+// can be used
+// concurrently, including with blocks deallocated by threads other than the
+// one that allocated them.
+//
+// In addition to positive test cases (run in the nightly builds), a negative
+// test case -1 can be run manually to compare the throughput of this allocator
+// with that of 'bdlma::ConcurrentMultipoolAllocator'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ThreadCachingMultipoolAllocator(bslma::Allocator *ba = 0);
+// [ 2] ThreadCachingMultipoolAllocator(int numPools, Allocator *ba = 0);
+// [ 2] ThreadCachingMultipoolAllocator(numPools, maxCached, ba = 0);
+// [ 2] ~ThreadCachingMultipoolAllocator();
+// [ 6] ~ThreadCachingMultipoolAllocator();  // with live threads
+// [ 7] ~ThreadCachingMultipoolAllocator();  // with exiting threads
+//
+// MANIPULATORS
+// [ 3] void *allocate(bsls::Types::size_type size);
+// [ 3] void deallocate(void *address);
+// [ 3] void flushThreadCache();
+// [ 5] void release();
+// [ 2] void reserveCapacity(bsls::Types::size_type size, int numObjects);
+//
+// ACCESSORS
+// [ 2] int maxCachedBlocks() const;
+// [ 2] bsls::Types::size_type maxPooledBlockSize() const;
+// [ 3] bsls::Types::Int64 numCacheHits() const;
+// [ 3] bsls::Types::Int64 numCacheMisses() const;
+// [ 3] bsls::Types::Int64 numCachedBlocks() const;
+// [ 2] int numPools() const;
+// [ 4] int numThreadCaches() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] THREAD EXIT
+// [ 8] CONCURRENCY
+// [ 9] CONCERN: No thread-specific storage key is available.
+// [10] USAGE EXAMPLE
+// [-1] PERFORMANCE: COMPARISON WITH 'bdlma::ConcurrentMultipoolAllocator'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::ThreadCachingMultipoolAllocator Obj;
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct AllocateAndFree {
+    // This 'struct' provides a functor that allocates and deallocates blocks
+    // of several sizes, in a pattern that is repeated identically by every
+    // invocation.
+
+    // DATA
+    bslma::Allocator *d_allocator_p;  // allocator under test
+    int               d_numRounds;    // number of rounds to run
+
+    // ACCESSORS
+    void operator()() const
+        // Allocate and then deallocate, 'd_numRounds' times, blocks of several
+        // sizes using 'd_allocator_p'.
+    {
+        void *blocks[40];
+        for (int round = 0; round < d_numRounds; ++round) {
+            for (int i = 0; i < 40; ++i) {
+                blocks[i] = d_allocator_p->allocate(8 + i * 13);
+                bsl::memset(blocks[i], i, 8 + i * 13);
+            }
+            for (int i = 0; i < 40; ++i) {
+                d_allocator_p->deallocate(blocks[i]);
+            }
+        }
+    }
+};
+
+struct UseAndWait {
+    // This 'struct' provides a functor that fills the cache of the calling
+    // thread, then waits on a barrier twice before, optionally, using the
+    // allocator again.
+
+    // DATA
+    Obj            *d_allocator_p;  // allocator under test
+    bslmt::Barrier *d_barrier_p;    // barrier shared with the main thread
+    bool            d_useAgain;     // use the allocator after the barriers
+    bsls::Types::Int64
+                   *d_hitsAfter_p;  // hits observed by the final allocation
+
+    // ACCESSORS
+    void operator()() const
+        // Allocate and deallocate several blocks, wait twice on the barrier,
+        // and, if 'd_useAgain', allocate and deallocate a block, loading into
+        // '*d_hitsAfter_p' the change in the number of cache hits.
+    {
+        void *blocks[8];
+        for (int i = 0; i < 8; ++i) {
+            blocks[i] = d_allocator_p->allocate(24);
+        }
+        for (int i = 0; i < 8; ++i) {
+            d_allocator_p->deallocate(blocks[i]);
+        }
+
+        d_barrier_p->wait();  // cache filled
+        d_barrier_p->wait();  // main thread done
+
+        if (d_useAgain) {
+            bsls::Types::Int64 hits = d_allocator_p->numCacheHits();
+            void *block = d_allocator_p->allocate(24);
+            *d_hitsAfter_p = d_allocator_p->numCacheHits() - hits;
+            d_allocator_p->deallocate(block);
+        }
+    }
+};
+
+class Exchanger {
+    // This class provides a functor that repeatedly allocates a block, fills
+    // it with a pattern derived from its size, and exchanges it with a block
+    // in a set of slots shared by all threads, then verifies and deallocates
+    // the block obtained from the slot.  Blocks are therefore frequently
+    // deallocated by a thread other than the one that allocated them.
+
+    // DATA
+    bslma::Allocator              *d_allocator_p;  // allocator under test
+    bsls::AtomicPointer<char>     *d_slots_p;      // shared slots
+    int                            d_numSlots;     // number of slots
+    int                            d_numIterations;
+    bsls::AtomicInt               *d_numErrors_p;  // corrupted blocks seen
+    unsigned int                   d_seed;         // initial random seed
+
+  public:
+    // CLASS METHODS
+    static bool check(const char *block)
+        // Return 'true' if the specified 'block' has the pattern written by
+        // 'fill', and 'false' otherwise.
+    {
+        const int size = static_cast<unsigned char>(block[0]) * 4 + 1;
+        for (int i = 1; i < size; ++i) {
+            if (block[i] != static_cast<char>(block[0] + i)) {
+                return false;                                         // RETURN
+            }
+        }
+        return true;
+    }
+
+    static void fill(char *block, int size)
+        // Fill the specified 'block' of the specified 'size' with a pattern
+        // that can be verified by 'check'.  The behavior is undefined unless
+        // 'size == 4 * n + 1' for some 'n' in '[0 .. 255]'.
+    {
+        block[0] = static_cast<char>((size - 1) / 4);
+        for (int i = 1; i < size; ++i) {
+            block[i] = static_cast<char>(block[0] + i);
+        }
+    }
+
+    // CREATORS
+    Exchanger(bslma::Allocator          *allocator,
+              bsls::AtomicPointer<char> *slots,
+              int                        numSlots,
+              int                        numIterations,
+              bsls::AtomicInt           *numErrors,
+              unsigned int               seed)
+        // Create a functor using the specified 'allocator', 'slots',
+        // 'numSlots', 'numIterations', 'numErrors', and 'seed'.
+    : d_allocator_p(allocator)
+    , d_slots_p(slots)
+    , d_numSlots(numSlots)
+    , d_numIterations(numIterations)
+    , d_numErrors_p(numErrors)
+    , d_seed(seed)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Run 'd_numIterations' exchanges.
+    {
+        unsigned int seed = d_seed;
+        for (int i = 0; i < d_numIterations; ++i) {
+            seed = seed * 1103515245 + 12345;
+            const int size = static_cast<int>((seed >> 8) & 0xff) * 4 + 1;
+            const int slot = static_cast<int>((seed >> 16) % d_numSlots);
+
+            char *block = static_cast<char *>(d_allocator_p->allocate(size));
+            fill(block, size);
+
+            char *old = d_slots_p[slot].swap(block);
+            if (old) {
+                if (!check(old)) {
+                    ++*d_numErrors_p;
+                }
+                d_allocator_p->deallocate(old);
+            }
+        }
+    }
+};
+
+struct BenchmarkWorker {
+    // This 'struct' provides a functor that measures allocation throughput by
+    // repeatedly allocating, and then deallocating, a batch of blocks.
+
+    // DATA
+    bslma::Allocator *d_allocator_p;  // allocator under test
+    int               d_numBatches;   // number of batches to run
+    bslmt::Barrier   *d_barrier_p;    // start barrier
+
+    // ACCESSORS
+    void operator()() const
+        // Wait on 'd_barrier_p', then run 'd_numBatches' batches.
+    {
+        enum { k_BATCH = 16 };
+        void *blocks[k_BATCH];
+
+        d_barrier_p->wait();
+        for (int i = 0; i < d_numBatches; ++i) {
+            for (int j = 0; j < k_BATCH; ++j) {
+                blocks[j] = d_allocator_p->allocate(16 + 16 * (j & 7));
+            }
+            for (int j = 0; j < k_BATCH; ++j) {
+                d_allocator_p->deallocate(blocks[j]);
+            }
+        }
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Messages in Worker Threads
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service processes each incoming message in one of a set of
+// worker threads, and that processing a message allocates and frees many
+// small, short-lived objects.  A 'bdlma::ThreadCachingMultipoolAllocator'
+// shared by the worker threads lets most of those operations complete within
+// the thread that performs them.
+//
+// First, we define a functor, run by each worker thread, that repeatedly
+// builds and discards a collection of small strings using the shared
+// allocator:
+//..
+    struct MessageProcessor {
+        // This 'struct' simulates the processing of messages by a worker
+        // thread.
+
+        // DATA
+        bslma::Allocator *d_allocator_p;  // allocator shared by the workers
+        int               d_numMessages;  // number of messages to process
+
+        // ACCESSORS
+        void operator()() const
+            // Simulate processing 'd_numMessages' messages using
+            // 'd_allocator_p' to supply memory.
+        {
+            for (int i = 0; i < d_numMessages; ++i) {
+                bsl::vector<bsl::string> fields(d_allocator_p);
+                for (int j = 0; j < 10; ++j) {
+                    fields.push_back(bsl::string(40, 'a', d_allocator_p));
+                }
+            }
+        }
+    };
+//..
+
+}  // close namespace usage
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 10: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+        using namespace usage;
+
+// Then, we create the allocator, allowing each thread to cache up to 16
+// blocks of each size:
+//..
+    bdlma::ThreadCachingMultipoolAllocator allocator(8, 16);
+//..
+// Next, we run several worker threads that share the allocator:
+//..
+    enum { k_NUM_THREADS = 4 };
+
+    MessageProcessor processor = { &allocator, 1000 };
+
+    bslmt::ThreadGroup workers;
+    workers.addThreads(processor, k_NUM_THREADS);
+    workers.joinAll();
+//..
+// Finally, we observe that nearly all of the allocations were satisfied from
+// the thread caches, and that the blocks cached by the worker threads were
+// returned to the shared pools when those threads exited:
+//..
+    ASSERT(allocator.numCacheHits() > 10 * allocator.numCacheMisses());
+    ASSERT(0 == allocator.numThreadCaches());
+    ASSERT(0 == allocator.numCachedBlocks());
+//..
+
+        if (veryVerbose) {
+            P_(allocator.numCacheHits()) P(allocator.numCacheMisses())
+        }
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // NO THREAD-SPECIFIC STORAGE KEY
+        //
+        // Concerns:
+        //: 1 An allocator constructed when no thread-specific storage key is
+        //:   available does not abort, and disables its thread caches.
+        //:
+        //: 2 Such an allocator allocates and deallocates blocks through the
+        //:   shared pools, and returns all memory on destruction.
+        //
+        // Plan:
+        //: 1 Create thread-specific storage keys until no more are available,
+        //:   then create an allocator, and verify that its 'maxCachedBlocks'
+        //:   is 0.  (C-1)
+        //:
+        //: 2 Allocate, deallocate, and flush, and verify that no thread cache
+        //:   is created, and that no memory remains in use in the test
+        //:   allocator after the allocator is destroyed.  Delete the keys.
+        //:   (C-2)
+        //
+        // Testing:
+        //   CONCERN: No thread-specific storage key is available.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nNO THREAD-SPECIFIC STORAGE KEY"
+                          << "\n==============================" << endl;
+
+        enum { k_MAX_KEYS = 1 << 16 };
+
+        bsl::vector<bslmt::ThreadUtil::Key> keys;
+        bool                                exhausted = false;
+        while (!exhausted && keys.size() < k_MAX_KEYS) {
+            bslmt::ThreadUtil::Key key;
+            if (0 == bslmt::ThreadUtil::createKey(&key, 0)) {
+                keys.push_back(key);
+            }
+            else {
+                exhausted = true;
+            }
+        }
+
+        if (veryVerbose) { T_ P_(exhausted) P(keys.size()) }
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            Obj mX(8, 16, &ta);  const Obj& X = mX;
+
+            if (exhausted) {
+                ASSERTV(X.maxCachedBlocks(), 0 == X.maxCachedBlocks());
+            }
+
+            void *blocks[10];
+            for (int i = 0; i < 10; ++i) {
+                blocks[i] = mX.allocate(8 << (i % 4));
+                ASSERT(blocks[i]);
+            }
+            for (int i = 0; i < 10; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            mX.flushThreadCache();
+
+            if (exhausted) {
+                ASSERTV(X.numThreadCaches(), 0 == X.numThreadCaches());
+                ASSERTV(X.numCachedBlocks(), 0 == X.numCachedBlocks());
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        for (bsl::size_t i = 0; i < keys.size(); ++i) {
+            bslmt::ThreadUtil::deleteKey(keys[i]);
+        }
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 The allocator can be used concurrently by many threads, with
+        //:   blocks frequently deallocated by a thread other than the one
+        //:   that allocated them, without any block being handed out twice
+        //:   (which would corrupt its contents).
+        //:
+        //: 2 All memory is returned to the supplied allocator on destruction.
+        //
+        // Plan:
+        //: 1 Run several threads that each repeatedly allocate a block of a
+        //:   pseudo-random size, fill it with a verifiable pattern, exchange
+        //:   it with a block held in a slot shared by all threads, and verify
+        //:   and deallocate the block obtained from the slot.  Use a small
+        //:   cache capacity so that caches are frequently flushed.  (C-1)
+        //:
+        //: 2 Verify that no memory remains in use in the test allocator after
+        //:   the allocator under test is destroyed.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCURRENCY"
+                          << "\n===========" << endl;
+
+        enum { k_NUM_THREADS = 8, k_NUM_SLOTS = 64, k_NUM_ITERATIONS = 50000 };
+
+        const int CAPACITIES[] = { 0, 1, 4, 32 };
+        const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+
+        for (int ti = 0; ti < NUM_CAPACITIES; ++ti) {
+            const int CAPACITY = CAPACITIES[ti];
+
+            if (veryVerbose) { T_ P(CAPACITY) }
+
+            bslma::TestAllocator ta("test", veryVeryVerbose);
+            {
+                Obj mX(8, CAPACITY, &ta);  const Obj& X = mX;
+
+                bsls::AtomicPointer<char> slots[k_NUM_SLOTS];
+                bsls::AtomicInt           numErrors(0);
+
+                bslmt::ThreadGroup group;
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    group.addThread(Exchanger(&mX,
+                                              slots,
+                                              k_NUM_SLOTS,
+                                              k_NUM_ITERATIONS,
+                                              &numErrors,
+                                              i * 7919 + 1));
+                }
+                group.joinAll();
+
+                for (int i = 0; i < k_NUM_SLOTS; ++i) {
+                    if (slots[i]) {
+                        ASSERTV(CAPACITY, i, Exchanger::check(slots[i]));
+                        mX.deallocate(slots[i]);
+                    }
+                }
+
+                ASSERTV(CAPACITY, numErrors, 0 == numErrors);
+                ASSERTV(CAPACITY, (CAPACITY ? 1 : 0) == X.numThreadCaches());
+                ASSERTV(CAPACITY, X.numCachedBlocks(),
+                        X.numCachedBlocks() <= 8 * CAPACITY);
+
+                mX.flushThreadCache();
+                ASSERTV(CAPACITY, 0 == X.numCachedBlocks());
+            }
+            ASSERTV(CAPACITY, 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // DESTRUCTOR WITH EXITING THREADS
+        //
+        // Concerns:
+        //: 1 The allocator can be destroyed while threads having caches are
+        //:   exiting, without either the destructor or the exiting threads
+        //:   accessing a destroyed cache or allocator.
+        //:
+        //: 2 All memory is returned to the supplied allocator on destruction,
+        //:   and the caches of the threads are destroyed when the threads
+        //:   exit.
+        //
+        // Plan:
+        //: 1 Install a test allocator as the global allocator.  Start threads
+        //:   that fill their caches, wait on a barrier, and exit.  As soon as
+        //:   the threads are released from the barrier, destroy the allocator
+        //:   from the main thread.  Join the threads, and verify that no
+        //:   memory remains in use in either test allocator.  Repeat many
+        //:   times, so that the destruction overlaps the exit of the threads
+        //:   at various points.  (C-1..2)
+        //
+        // Testing:
+        //   ~ThreadCachingMultipoolAllocator();  // with exiting threads
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nDESTRUCTOR WITH EXITING THREADS"
+                          << "\n===============================" << endl;
+
+        enum { k_NUM_THREADS = 8, k_NUM_ITERATIONS = 200 };
+
+        bslma::TestAllocator ga("global", veryVeryVerbose);
+        bslma::Default::setGlobalAllocator(&ga);
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+            bslmt::Barrier     barrier(k_NUM_THREADS + 1);
+            bslmt::ThreadGroup group;
+
+            Obj *mX = new (ta) Obj(&ta);
+
+            bsls::Types::Int64 dummy;
+            UseAndWait worker = { mX, &barrier, false, &dummy };
+            ASSERTV(i, k_NUM_THREADS == group.addThreads(worker,
+                                                         k_NUM_THREADS));
+
+            barrier.wait();
+            barrier.wait();
+
+            ta.deleteObject(mX);
+
+            group.joinAll();
+
+            ASSERTV(i, ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+            ASSERTV(i, ga.numBlocksInUse(), 0 == ga.numBlocksInUse());
+        }
+
+        bslma::Default::setGlobalAllocator(0);
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // DESTRUCTOR WITH LIVE THREADS
+        //
+        // Concerns:
+        //: 1 The allocator can be destroyed while threads having caches are
+        //:   still running, and all memory, including those caches, is
+        //:   returned to the supplied allocator.
+        //:
+        //: 2 Such threads can exit after the allocator is destroyed, and
+        //:   their caches are then destroyed.
+        //
+        // Plan:
+        //: 1 Install a test allocator as the global allocator.  Start threads
+        //:   that fill their caches and then wait on a barrier.  Destroy the
+        //:   allocator, and verify that no memory remains in use in the
+        //:   supplied test allocator.  Then let the threads exit, and verify
+        //:   that no memory remains in use in the global test allocator.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   ~ThreadCachingMultipoolAllocator();  // with live threads
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nDESTRUCTOR WITH LIVE THREADS"
+                          << "\n============================" << endl;
+
+        enum { k_NUM_THREADS = 3 };
+
+        bslma::TestAllocator ga("global", veryVeryVerbose);
+        bslma::Default::setGlobalAllocator(&ga);
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        bslmt::Barrier       barrier(k_NUM_THREADS + 1);
+        bslmt::ThreadGroup   group;
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bsls::Types::Int64 dummy;
+            UseAndWait worker = { &mX, &barrier, false, &dummy };
+            group.addThreads(worker, k_NUM_THREADS);
+
+            barrier.wait();
+
+            ASSERTV(X.numThreadCaches(), k_NUM_THREADS == X.numThreadCaches());
+            ASSERTV(X.numCachedBlocks(),
+                    8 * k_NUM_THREADS == X.numCachedBlocks());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        barrier.wait();
+        group.joinAll();
+
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(ga.numBlocksInUse(), 0 == ga.numBlocksInUse());
+
+        bslma::Default::setGlobalAllocator(0);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'release'
+        //
+        // Concerns:
+        //: 1 'release' returns all memory, including the blocks held in the
+        //:   caches of all threads, to the supplied allocator, other than the
+        //:   memory used by the allocator itself.
+        //:
+        //: 2 Blocks cached before 'release' are not handed out afterward, by
+        //:   the calling thread or by any other thread.
+        //:
+        //: 3 The allocator is fully usable after 'release'.
+        //
+        // Plan:
+        //: 1 Fill the cache of the main thread and of another thread, which
+        //:   then waits on a barrier.  Call 'release', and verify that the
+        //:   number of cached blocks is 0, and that the memory in use by the
+        //:   test allocator has dropped to that in use by an allocator that
+        //:   has never allocated a block (plus the caches themselves).  (C-1)
+        //:
+        //: 2 Allocate a block from each thread, and verify that neither was
+        //:   a cache hit.  (C-2)
+        //:
+        //: 3 Allocate and deallocate blocks again, and verify that they are
+        //:   cached.  (C-3)
+        //
+        // Testing:
+        //   void release();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\n'release'"
+                          << "\n=========" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        bslma::TestAllocator tb("baseline", veryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bslmt::Barrier     barrier(2);
+            bsls::Types::Int64 hitsAfter = -1;
+
+            UseAndWait worker = { &mX, &barrier, true, &hitsAfter };
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle, worker));
+
+            void *blocks[5];
+            for (int i = 0; i < 5; ++i) {
+                blocks[i] = mX.allocate(100);
+            }
+            for (int i = 0; i < 5; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            mX.deallocate(mX.allocate(10000));
+
+            barrier.wait();  // both caches filled
+
+            ASSERTV(X.numCachedBlocks(), 13 == X.numCachedBlocks());
+            ASSERT(2 == X.numThreadCaches());
+
+            bsls::Types::Int64 bytesInUse = ta.numBytesInUse();
+
+            mX.release();
+
+            ASSERTV(X.numCachedBlocks(), 0 == X.numCachedBlocks());
+            ASSERTV(bytesInUse, ta.numBytesInUse(),
+                    ta.numBytesInUse() < bytesInUse);
+            {
+                // After 'release', 'mX' should hold only what a new allocator
+                // holds, plus the caches of the two threads.
+
+                bslma::TestAllocator tc("cache", veryVeryVerbose);
+
+                Obj mY(&tb);
+                const bsls::Types::Int64 EMPTY = tb.numBytesInUse();
+
+                Obj mZ(&tc);
+                mZ.deallocate(mZ.allocate(8));
+                mZ.release();
+                const bsls::Types::Int64 CACHE = tc.numBytesInUse() - EMPTY;
+
+                ASSERTV(ta.numBytesInUse(), EMPTY, CACHE,
+                        EMPTY + 2 * CACHE == ta.numBytesInUse());
+            }
+
+            bsls::Types::Int64 hits = X.numCacheHits();
+            void *block = mX.allocate(100);
+            ASSERT(hits == X.numCacheHits());
+
+            barrier.wait();  // let the other thread proceed
+            bslmt::ThreadUtil::join(handle);
+
+            ASSERTV(hitsAfter, 0 == hitsAfter);
+
+            mX.deallocate(block);
+            ASSERT(block == mX.allocate(100));
+            ASSERT(hits + 1 == X.numCacheHits());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // THREAD EXIT
+        //
+        // Concerns:
+        //: 1 A thread's cache is created on its first use of the allocator
+        //:   and is destroyed when the thread exits.
+        //:
+        //: 2 The blocks held in the cache of an exiting thread are returned to
+        //:   the shared pools, and so are reused by other threads, rather
+        //:   than being leaked until the allocator is destroyed.
+        //:
+        //: 3 The statistics of exited threads are retained.
+        //
+        // Plan:
+        //: 1 In several rounds, run a thread that allocates and deallocates
+        //:   a fixed pattern of blocks, and join it.  After each round, verify
+        //:   that no thread caches or cached blocks remain, and that the
+        //:   number of cache hits keeps increasing.  (C-1, 3)
+        //:
+        //: 2 Verify that the memory obtained from the test allocator does not
+        //:   increase after the first round.  (C-2)
+        //:
+        //: 3 Run several such threads concurrently, and verify that no thread
+        //:   caches remain after they are joined.  (C-1)
+        //
+        // Testing:
+        //   int numThreadCaches() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTHREAD EXIT"
+                          << "\n===========" << endl;
+
+        enum { k_NUM_THREADS = 4, k_NUM_ROUNDS = 10 };
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            Obj mX(10, 8, &ta);  const Obj& X = mX;
+
+            bsls::Types::Int64 bytesAfterFirstRound = 0;
+            bsls::Types::Int64 hits                 = 0;
+
+            AllocateAndFree worker = { &mX, 50 };
+
+            for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+                bslmt::ThreadUtil::Handle handle;
+                ASSERTV(round, 0 == bslmt::ThreadUtil::create(&handle,
+                                                              worker));
+                bslmt::ThreadUtil::join(handle);
+
+                ASSERTV(round, 0 == X.numThreadCaches());
+                ASSERTV(round, 0 == X.numCachedBlocks());
+                ASSERTV(round, hits < X.numCacheHits());
+                hits = X.numCacheHits();
+
+                if (0 == round) {
+                    bytesAfterFirstRound = ta.numBytesInUse();
+                }
+                else {
+                    ASSERTV(round,
+                            bytesAfterFirstRound,
+                            ta.numBytesInUse(),
+                            bytesAfterFirstRound == ta.numBytesInUse());
+                }
+            }
+
+            bslmt::ThreadGroup group;
+            group.addThreads(worker, k_NUM_THREADS);
+            group.joinAll();
+
+            ASSERT(0 == X.numThreadCaches());
+            ASSERT(0 == X.numCachedBlocks());
+
+            mX.deallocate(mX.allocate(8));
+            ASSERT(1 == X.numThreadCaches());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE, DEALLOCATE, AND STATISTICS
+        //
+        // Concerns:
+        //: 1 Allocating 0 bytes returns 0, and deallocating 0 has no effect.
+        //:
+        //: 2 A pooled block deallocated by a thread is returned by the next
+        //:   allocation by that thread of a size served by the same pool, and
+        //:   blocks are reused in last-in, first-out order.
+        //:
+        //: 3 Each pooled allocation counts as either a cache hit or a cache
+        //:   miss, and 'numCachedBlocks' reflects the blocks held.
+        //:
+        //: 4 A cache never holds more than 'maxCachedBlocks()' blocks of each
+        //:   size; when it is full, half of its blocks of that size are
+        //:   returned to the shared pool.
+        //:
+        //: 5 Blocks larger than 'maxPooledBlockSize()' are never cached.
+        //:
+        //: 6 'flushThreadCache' empties the cache of the calling thread.
+        //:
+        //: 7 A capacity of 0 disables caching, and no cache is created.
+        //
+        // Plan:
+        //: 1 Exercise each concern directly in the main thread, checking the
+        //:   returned addresses and the statistics after each operation.
+        //:   (C-1..7)
+        //
+        // Testing:
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        //   void flushThreadCache();
+        //   bsls::Types::Int64 numCacheHits() const;
+        //   bsls::Types::Int64 numCacheMisses() const;
+        //   bsls::Types::Int64 numCachedBlocks() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nALLOCATE, DEALLOCATE, AND STATISTICS"
+                          << "\n====================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\nZero-sized and null blocks." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+
+            ASSERT(0 == X.numCacheHits());
+            ASSERT(0 == X.numCacheMisses());
+            ASSERT(0 == X.numThreadCaches());
+        }
+
+        if (verbose) cout << "\nReuse through the cache." << endl;
+        {
+            Obj mX(6, 4, &ta);  const Obj& X = mX;
+
+            const int MAX = static_cast<int>(X.maxPooledBlockSize());
+            ASSERT(256 == MAX);
+
+            for (int size = 1; size <= MAX; ++size) {
+                const bsls::Types::Int64 HITS   = X.numCacheHits();
+                const bsls::Types::Int64 MISSES = X.numCacheMisses();
+
+                void *p = mX.allocate(size);
+                bsl::memset(p, 0xa5, size);
+                mX.deallocate(p);
+                ASSERTV(size, 1 <= X.numCachedBlocks());
+
+                // The smallest and largest sizes served by the same pool.
+
+                int low = 8, high = 8;
+                while (high < size) {
+                    low   = high + 1;
+                    high *= 2;
+                }
+
+                ASSERTV(size, p == mX.allocate(low));
+                mX.deallocate(p);
+                ASSERTV(size, p == mX.allocate(high));
+                mX.deallocate(p);
+
+                ASSERTV(size, HITS + 2 <= X.numCacheHits());
+                ASSERTV(size, MISSES + 1 >= X.numCacheMisses());
+            }
+            ASSERT(1 == X.numThreadCaches());
+
+            mX.flushThreadCache();
+            ASSERT(0 == X.numCachedBlocks());
+
+            void *a = mX.allocate(20);
+            void *b = mX.allocate(20);
+            void *c = mX.allocate(20);
+            ASSERT(0 == X.numCachedBlocks());
+
+            mX.deallocate(a);
+            mX.deallocate(b);
+            mX.deallocate(c);
+            ASSERT(3 == X.numCachedBlocks());
+
+            const bsls::Types::Int64 HITS = X.numCacheHits();
+
+            ASSERT(c == mX.allocate(17));
+            ASSERT(b == mX.allocate(32));
+            ASSERT(a == mX.allocate(25));
+            ASSERT(HITS + 3 == X.numCacheHits());
+            ASSERT(0 == X.numCachedBlocks());
+
+            const bsls::Types::Int64 MISSES = X.numCacheMisses();
+            void *d = mX.allocate(20);
+            ASSERT(MISSES + 1 == X.numCacheMisses());
+
+            mX.deallocate(a);
+            mX.deallocate(b);
+            mX.deallocate(c);
+            mX.deallocate(d);
+        }
+
+        if (verbose) cout << "\nCapacity." << endl;
+        {
+            const int CAPACITIES[] = { 1, 2, 3, 4, 7, 32 };
+            const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+
+            for (int ti = 0; ti < NUM_CAPACITIES; ++ti) {
+                const int CAPACITY = CAPACITIES[ti];
+
+                Obj mX(4, CAPACITY, &ta);  const Obj& X = mX;
+                ASSERT(CAPACITY == X.maxCachedBlocks());
+
+                bsl::vector<void *> blocks;
+                for (int i = 0; i < 3 * CAPACITY + 5; ++i) {
+                    blocks.push_back(mX.allocate(12));
+                    blocks.push_back(mX.allocate(60));
+                }
+
+                bsls::Types::Int64 expected = 0;
+                int                count16  = 0;
+                int                count64  = 0;
+                for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                    int& count = i % 2 ? count64 : count16;
+                    if (count == CAPACITY) {
+                        expected -= (CAPACITY + 1) / 2;
+                        count    -= (CAPACITY + 1) / 2;
+                    }
+                    ++count;
+                    ++expected;
+
+                    mX.deallocate(blocks[i]);
+                    ASSERTV(CAPACITY, i, expected == X.numCachedBlocks());
+                    ASSERTV(CAPACITY, i,
+                            X.numCachedBlocks() <= 2 * CAPACITY);
+                }
+
+                // The most recently deallocated blocks were kept.
+
+                void *p = mX.allocate(60);
+                ASSERTV(CAPACITY, blocks.back() == p);
+                mX.deallocate(p);
+
+                mX.flushThreadCache();
+                ASSERT(0 == X.numCachedBlocks());
+                mX.flushThreadCache();
+                ASSERT(0 == X.numCachedBlocks());
+            }
+        }
+
+        if (verbose) cout << "\nUnpooled blocks." << endl;
+        {
+            Obj mX(4, 8, &ta);  const Obj& X = mX;
+
+            const bsls::Types::size_type MAX = X.maxPooledBlockSize();
+
+            void *p = mX.allocate(MAX + 1);
+            mX.deallocate(p);
+            ASSERT(0 == X.numCachedBlocks());
+            ASSERT(0 == X.numCacheHits());
+            ASSERT(0 == X.numCacheMisses());
+
+            void *q = mX.allocate(MAX);
+            mX.deallocate(q);
+            ASSERT(1 == X.numCachedBlocks());
+            ASSERT(1 == X.numCacheMisses());
+        }
+
+        if (verbose) cout << "\nCaching disabled." << endl;
+        {
+            Obj mX(4, 0, &ta);  const Obj& X = mX;
+
+            void *p = mX.allocate(8);
+            mX.deallocate(p);
+            p = mX.allocate(8);
+            mX.deallocate(p);
+            mX.flushThreadCache();
+
+            ASSERT(0 == X.numCachedBlocks());
+            ASSERT(0 == X.numCacheHits());
+            ASSERT(0 == X.numCacheMisses());
+            ASSERT(0 == X.numThreadCaches());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor configures the number of pools and the cache
+        //:   capacity as documented, using the implementation-defined
+        //:   defaults where unspecified.
+        //:
+        //: 2 All memory comes from the supplied allocator (or the default
+        //:   allocator, if none is supplied), and is returned on destruction.
+        //:
+        //: 3 'reserveCapacity' reserves memory in the shared pools.
+        //
+        // Plan:
+        //: 1 Construct objects with each constructor and verify the
+        //:   accessors.  Allocate and deallocate blocks, and verify the
+        //:   memory in use in the test and default allocators before and
+        //:   after destruction.  (C-1..2)
+        //:
+        //: 2 Reserve capacity, and verify that allocations of the reserved
+        //:   size do not draw further memory from the supplied allocator.
+        //:   (C-3)
+        //
+        // Testing:
+        //   ThreadCachingMultipoolAllocator(bslma::Allocator *ba = 0);
+        //   ThreadCachingMultipoolAllocator(int numPools, Allocator *ba = 0);
+        //   ThreadCachingMultipoolAllocator(numPools, maxCached, ba = 0);
+        //   ~ThreadCachingMultipoolAllocator();
+        //   void reserveCapacity(bsls::Types::size_type size, int numObjects);
+        //   int maxCachedBlocks() const;
+        //   bsls::Types::size_type maxPooledBlockSize() const;
+        //   int numPools() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCREATORS AND BASIC ACCESSORS"
+                          << "\n============================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        const int DEFAULT_NUM_POOLS =
+                                 bdlma::ConcurrentMultipool(&ta).numPools();
+
+        for (int ti = 0; ti < 6; ++ti) {
+            const int NUM_POOLS = ti < 3 ? DEFAULT_NUM_POOLS : 5;
+
+            Obj *objPtr = 0;
+            switch (ti) {
+              case 0: objPtr = new Obj();                           break;
+              case 1: objPtr = new Obj(&ta);                        break;
+              case 2: objPtr = new Obj(DEFAULT_NUM_POOLS, &ta);     break;
+              case 3: objPtr = new Obj(5, &ta);                     break;
+              case 4: objPtr = new Obj(5, 0, &ta);                  break;
+              case 5: objPtr = new Obj(5, 100, &ta);                break;
+            }
+            Obj& mX = *objPtr;  const Obj& X = mX;
+
+            bslma::TestAllocator& oa = 0 == ti ? defaultAllocator : ta;
+
+            ASSERTV(ti, NUM_POOLS == X.numPools());
+            ASSERTV(ti, (4 << NUM_POOLS) ==
+                                    static_cast<int>(X.maxPooledBlockSize()));
+            ASSERTV(ti, X.maxCachedBlocks(),
+                    4 == ti ? 0 == X.maxCachedBlocks()
+                  : 5 == ti ? 100 == X.maxCachedBlocks()
+                  :           0 < X.maxCachedBlocks());
+
+            ASSERTV(ti, 0 < oa.numBlocksInUse());
+
+            for (int size = 1; size < 1000; size += 7) {
+                mX.deallocate(mX.allocate(size));
+            }
+
+            delete objPtr;
+
+            ASSERTV(ti, 0 == ta.numBlocksInUse());
+            ASSERTV(ti, 0 == defaultAllocator.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting 'reserveCapacity'." << endl;
+        {
+            Obj mX(&ta);
+
+            mX.reserveCapacity(100, 50);
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            void *blocks[50];
+            for (int i = 0; i < 50; ++i) {
+                blocks[i] = mX.allocate(100);
+            }
+            for (int i = 0; i < 50; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+
+            // Only the cache of this thread is allocated.
+
+            ASSERTV(NUM_ALLOCATIONS, ta.numAllocations(),
+                    NUM_ALLOCATIONS + 1 == ta.numAllocations());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate, use, and deallocate blocks of several sizes, and check
+        //:   that deallocated blocks are reused.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            void *p = mX.allocate(10);
+            void *q = mX.allocate(100);
+            void *r = mX.allocate(100000);
+            bsl::memset(p, 1, 10);
+            bsl::memset(q, 2, 100);
+            bsl::memset(r, 3, 100000);
+
+            mX.deallocate(q);
+            ASSERT(q == mX.allocate(70));
+            ASSERT(1 == X.numCacheHits());
+
+            mX.deallocate(p);
+            mX.deallocate(q);
+            mX.deallocate(r);
+            ASSERT(2 == X.numCachedBlocks());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'bdlma::ConcurrentMultipoolAllocator'
+        //
+        // Concerns:
+        //: 1 With several threads allocating and deallocating small blocks,
+        //:   this allocator has a higher throughput than
+        //:   'bdlma::ConcurrentMultipoolAllocator'.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, and 8 threads, time each thread repeatedly
+        //:   allocating and deallocating batches of small blocks, using each
+        //:   allocator, and report the throughput in millions of operations
+        //:   (allocations plus deallocations) per second.
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH 'bdlma::ConcurrentMultipoolAllocator'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE"
+                          << "\n===========" << endl;
+
+        const int NUM_BATCHES = argc > 2 ? atoi(argv[2]) : 200000;
+
+        cout << "threads,concurrent Mops/s,thread-caching Mops/s" << endl;
+
+        for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            double rates[2];
+
+            for (int which = 0; which < 2; ++which) {
+                bdlma::ConcurrentMultipoolAllocator concurrent;
+                Obj                                 caching;
+
+                bslma::Allocator *allocator = 0 == which
+                                            ? static_cast<bslma::Allocator *>(
+                                                                  &concurrent)
+                                            : &caching;
+
+                bslmt::Barrier  barrier(numThreads + 1);
+                BenchmarkWorker worker = { allocator, NUM_BATCHES, &barrier };
+
+                bslmt::ThreadGroup group;
+                group.addThreads(worker, numThreads);
+
+                bsls::Stopwatch timer;
+                timer.start();
+                barrier.wait();
+                group.joinAll();
+                timer.stop();
+
+                rates[which] = 2.0 * 16 * NUM_BATCHES * numThreads
+                             / timer.elapsedTime() / 1.0e6;
+            }
+
+            cout << numThreads << ',' << rates[0] << ',' << rates[1] << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,643 @@
+// bdlmt_workstealingthreadpool.cpp                                   -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_workstealingthreadpool_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_platform.h>
+
+#include <bsls_assert.h>
+#include <bsls_systemclocktype.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_deque.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>              // sigfillset
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                     // ===================================
+                     // struct WorkStealingThreadPool_Queue
+                     // ===================================
+
+struct WorkStealingThreadPool_Queue {
+    // This component-private structure holds the queue of pending jobs owned
+    // by one processing thread of a 'WorkStealingThreadPool'.  The owning
+    // thread pushes and pops jobs at the back of 'd_jobs', while other
+    // threads steal jobs from the front.  The structure is padded so that
+    // distinct queues do not share a cache line.
+
+    // DATA
+    bslmt::Mutex                             d_mutex;   // guards 'd_jobs'
+
+    bsl::deque<WorkStealingThreadPool::Job>  d_jobs;    // pending jobs
+
+    WorkStealingThreadPool                  *d_pool_p;  // owning pool (held)
+
+    const int                                d_index;   // index of this queue
+                                                        // in the pool
+
+    bool                                     d_inUse;   // 'true' if owned by
+                                                        // a processing thread
+                                                        // (guarded by the
+                                                        // 'd_mutex' of the
+                                                        // pool)
+
+    const char                               d_pad[
+                                           bslmt::Platform::e_CACHE_LINE_SIZE];
+                                                        // padding to prevent
+                                                        // false sharing
+
+    // CREATORS
+    WorkStealingThreadPool_Queue(WorkStealingThreadPool *pool,
+                                 int                     index,
+                                 bslma::Allocator       *basicAllocator);
+        // Create an empty queue having the specified 'index' in the specified
+        // 'pool', using the specified 'basicAllocator' to supply memory.
+};
+
+                     // -----------------------------------
+                     // struct WorkStealingThreadPool_Queue
+                     // -----------------------------------
+
+// CREATORS
+WorkStealingThreadPool_Queue::WorkStealingThreadPool_Queue(
+                                       WorkStealingThreadPool *pool,
+                                       int                     index,
+                                       bslma::Allocator       *basicAllocator)
+: d_mutex()
+, d_jobs(basicAllocator)
+, d_pool_p(pool)
+, d_index(index)
+, d_inUse(false)
+, d_pad()
+{
+}
+
+                       // ---------------------------
+                       // WorkStealingThreadPoolEntry
+                       // ---------------------------
+
+extern "C" void *WorkStealingThreadPoolEntry(void *queue)
+    // Entry point for processing threads.
+{
+    WorkStealingThreadPool_Queue *ownQueue =
+                            static_cast<WorkStealingThreadPool_Queue *>(queue);
+
+    ownQueue->d_pool_p->workerThread(ownQueue);
+    return 0;
+}
+
+                       // ----------------------------
+                       // class WorkStealingThreadPool
+                       // ----------------------------
+
+// PRIVATE MANIPULATORS
+int WorkStealingThreadPool::afterEnqueue()
+{
+    // 'd_numPendingJobs' was incremented (sequentially consistently) before
+    // this method is called, and idle threads increment 'd_numWaiting' before
+    // checking 'd_numPendingJobs' (both under 'd_mutex'), so at least one of
+    // the two sides observes the other and the wake-up cannot be lost.
+
+    if (0 < d_numWaiting) {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        d_workCond.signal();
+    }
+
+    if (d_numPendingJobs + d_numActiveThreads > d_threadCount
+     && d_threadCount < d_maxThreads) {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_numPendingJobs + d_numActiveThreads > d_threadCount
+         && d_threadCount < d_maxThreads
+         && !d_terminateFlag) {
+            int rc = startNewThread();
+            (void)rc;  // Suppress unused variable warning.
+
+            if (0 == d_threadCount) {
+                // We are unable to spawn the first thread.  The enqueued job
+                // will never be processed.  Return error.
+
+                return -1;                                            // RETURN
+            }
+
+            // See 'bdlmt::ThreadPool::startThreadIfNeeded' for why a failure
+            // to create a thread is tolerated here.
+
+            BSLS_ASSERT_SAFE(0 == rc && "Client is not getting as many threads"
+                " as requested, check thread stack size.");
+        }
+    }
+    return 0;
+}
+
+void WorkStealingThreadPool::clearQueues()
+{
+    const int numQueues = static_cast<int>(d_queues.size());
+    for (int i = 0; i < numQueues; ++i) {
+        bsl::deque<Job> jobs(d_queues[i]->d_jobs.get_allocator());
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_queues[i]->d_mutex);
+            jobs.swap(d_queues[i]->d_jobs);
+        }
+        d_numPendingJobs.add(-static_cast<int>(jobs.size()));
+
+        // The jobs are destroyed when we are *not* holding the lock of the
+        // queue because they might have some objects bound with non-trivial
+        // destructors.
+    }
+}
+
+WorkStealingThreadPool::Queue *WorkStealingThreadPool::enqueueQueue()
+{
+    Queue *queue = static_cast<Queue *>(
+                                   bslmt::ThreadUtil::getSpecific(d_queueKey));
+    if (queue) {
+        // Jobs enqueued by a job are accepted until the processing threads
+        // are told to terminate, so that 'drain' and 'stop' wait for all the
+        // jobs spawned by the jobs that were pending when they were called.
+
+        return d_enabled || !d_terminateFlag ? queue : 0;             // RETURN
+    }
+
+    if (!d_enabled) {
+        return 0;                                                     // RETURN
+    }
+
+    unsigned int numQueues = d_numQueuesUsed;
+    if (0 == numQueues) {
+        numQueues = 1;
+    }
+    return d_queues[d_nextQueue.addRelaxed(1) % numQueues];
+}
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void WorkStealingThreadPool::initBlockSet()
+{
+    sigfillset(&d_blockSet);
+
+    static const int synchronousSignals[] = {
+        SIGBUS,
+        SIGFPE,
+        SIGILL,
+        SIGSEGV,
+        SIGSYS,
+        SIGABRT,
+        SIGTRAP,
+    #if !defined(BSLS_PLATFORM_OS_CYGWIN) || defined(SIGIOT)
+        SIGIOT
+    #endif
+    };
+    static const int SIZE =
+                        sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i = 0; i < SIZE; ++i) {
+        sigdelset(&d_blockSet, synchronousSignals[i]);
+    }
+}
+#endif
+
+bool WorkStealingThreadPool::popJob(Job *job, Queue *ownQueue)
+{
+    BSLS_ASSERT(job);
+    BSLS_ASSERT(ownQueue);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&ownQueue->d_mutex);
+        if (!ownQueue->d_jobs.empty()) {
+            *job = bslmf::MovableRefUtil::move(ownQueue->d_jobs.back());
+            ownQueue->d_jobs.pop_back();
+
+            // Increment the number of active threads before decrementing the
+            // number of pending jobs so that 'drain' never observes both
+            // counts at 0 while a job is in flight.
+
+            ++d_numActiveThreads;
+            --d_numPendingJobs;
+            return true;                                              // RETURN
+        }
+    }
+
+    if (0 == d_numPendingJobs) {
+        return false;                                                 // RETURN
+    }
+
+    // Steal from the other queues, starting with the queue following ours so
+    // that thieves spread over the victims.
+
+    const int numQueues = d_numQueuesUsed;
+
+    for (int i = 1; i <= numQueues; ++i) {
+        Queue *victim = d_queues[(ownQueue->d_index + i) % numQueues];
+        if (victim == ownQueue) {
+            continue;                                               // CONTINUE
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> lock(&victim->d_mutex);
+        if (!victim->d_jobs.empty()) {
+            *job = bslmf::MovableRefUtil::move(victim->d_jobs.front());
+            victim->d_jobs.pop_front();
+
+            ++d_numActiveThreads;
+            --d_numPendingJobs;
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+int WorkStealingThreadPool::startNewThread()
+{
+    // Find a queue not owned by a running thread; the lowest index is chosen
+    // so that the range of queues in use stays as small as possible.
+
+    const int numQueues = static_cast<int>(d_queues.size());
+    int       index     = 0;
+    while (index < numQueues && d_queues[index]->d_inUse) {
+        ++index;
+    }
+    BSLS_ASSERT(index < numQueues);
+
+    Queue *queue = d_queues[index];
+
+    // Publish the queue before the thread starts, so that the new thread
+    // observes its own queue within the range of queues it steals from.
+
+    const int numQueuesUsed = d_numQueuesUsed;
+    queue->d_inUse = true;
+    if (index >= numQueuesUsed) {
+        d_numQueuesUsed = index + 1;
+    }
+
+    bslmt::ThreadUtil::Handle handle;
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // block all asynchronous signals
+
+    sigset_t oldset;
+
+    pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
+#endif
+
+    int rc = bslmt::ThreadUtil::create(&handle,
+                                       d_threadAttributes,
+                                       WorkStealingThreadPoolEntry,
+                                       queue);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Restore the mask
+
+    pthread_sigmask(SIG_SETMASK, &oldset, &d_blockSet);
+#endif
+
+    if (0 == rc) {
+        ++d_threadCount;
+    }
+    else {
+        queue->d_inUse  = false;
+        d_numQueuesUsed = numQueuesUsed;
+        ++d_createFailures;
+    }
+    return rc;
+}
+
+void WorkStealingThreadPool::workerThread(Queue *ownQueue)
+{
+    bslmt::ThreadUtil::setSpecific(d_queueKey, ownQueue);
+
+    Job job;
+    while (1) {
+        if (popJob(&job, ownQueue)) {
+            // Run the callback and keep measurements.
+
+            bsls::Types::Int64 start  = bsls::TimeUtil::getTimer();
+            job();
+            bsls::Types::Int64 finish = bsls::TimeUtil::getTimer();
+            if (start < d_lastResetTime) {
+                d_callbackTime.add(finish - d_lastResetTime);
+            }
+            else {
+                d_callbackTime.add(finish - start);
+            }
+
+            // The job has to be cleared before this thread is no longer
+            // considered active, because it might have some objects bound
+            // with non-trivial destructors.
+
+            job = Job();
+            --d_numActiveThreads;
+            continue;                                               // CONTINUE
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (0 == d_numActiveThreads && 0 == d_numPendingJobs) {
+            d_drainCond.broadcast();
+        }
+
+        bool timedOut = false;
+
+        ++d_numWaiting;
+        if (d_threadCount > d_minThreads) {
+            // This thread should be removed if it times out.
+
+            bsls::TimeInterval endTime = bsls::SystemTime::nowMonotonicClock()
+                                               .addMilliseconds(d_maxIdleTime);
+            while (0 == d_numPendingJobs && !d_terminateFlag) {
+                if (d_workCond.timedWait(&d_mutex, endTime)
+                 || bsls::SystemTime::nowMonotonicClock() >= endTime) {
+                    timedOut = true;
+                    break;
+                }
+            }
+        }
+        else {
+            // This thread should not be subject to a timeout, in order to
+            // maintain the minimum number of threads.
+
+            while (0 == d_numPendingJobs && !d_terminateFlag) {
+                d_workCond.wait(&d_mutex);
+            }
+        }
+        --d_numWaiting;
+
+        if (!d_terminateFlag) {
+            if (!timedOut || d_threadCount <= d_minThreads) {
+                continue;                                           // CONTINUE
+            }
+
+            // Decrement the thread count *before* checking for pending jobs;
+            // 'afterEnqueue' increments the pending jobs before checking the
+            // thread count, so a job enqueued concurrently either is observed
+            // here or causes a new thread to be started.
+
+            --d_threadCount;
+            if (0 != d_numPendingJobs) {
+                ++d_threadCount;
+                continue;                                           // CONTINUE
+            }
+        }
+        else {
+            --d_threadCount;
+        }
+
+        // Any job still in 'ownQueue' will be stolen by the other threads,
+        // or processed by the thread that will next own 'ownQueue'.
+
+        ownQueue->d_inUse = false;
+        if (0 == d_threadCount) {
+            d_drainCond.broadcast();
+        }
+        return;                                                       // RETURN
+    }
+}
+
+// CREATORS
+WorkStealingThreadPool::WorkStealingThreadPool(
+                         const bslmt::ThreadAttributes&  threadAttributes,
+                         int                             minThreads,
+                         int                             maxThreads,
+                         int                             maxIdleTime,
+                         bslma::Allocator               *basicAllocator)
+: d_queues(basicAllocator)
+, d_numQueuesUsed(0)
+, d_nextQueue(0)
+, d_queueKey()
+, d_mutex()
+, d_workCond(bsls::SystemClockType::e_MONOTONIC)
+, d_drainCond()
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_maxThreads(maxThreads)
+, d_minThreads(minThreads)
+, d_maxIdleTime(maxIdleTime)
+, d_threadCount(0)
+, d_createFailures(0)
+, d_numPendingJobs(0)
+, d_numActiveThreads(0)
+, d_numWaiting(0)
+, d_enabled(0)
+, d_terminateFlag(false)
+, d_lastResetTime(bsls::TimeUtil::getTimer()) // now
+, d_callbackTime(0)
+{
+    BSLS_ASSERT(0          <= minThreads);
+    BSLS_ASSERT(minThreads <= maxThreads);
+    BSLS_ASSERT(0          <  maxThreads);
+    BSLS_ASSERT(0          <= maxIdleTime);
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    d_queues.reserve(maxThreads);
+    for (int i = 0; i < maxThreads; ++i) {
+        d_queues.push_back(new (*allocator) Queue(this, i, allocator));
+    }
+
+    int rc = bslmt::ThreadUtil::createKey(&d_queueKey, 0);
+    BSLS_ASSERT_OPT(0 == rc);
+    (void)rc;
+
+    // Force all threads to be detached.
+
+    d_threadAttributes.setDetachedState(
+                                   bslmt::ThreadAttributes::e_CREATE_DETACHED);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    initBlockSet();
+#endif
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    shutdown();
+
+    bslmt::ThreadUtil::deleteKey(d_queueKey);
+
+    bslma::Allocator *allocator = d_queues.get_allocator().mechanism();
+    for (bsl::size_t i = 0; i < d_queues.size(); ++i) {
+        allocator->deleteObjectRaw(d_queues[i]);
+    }
+}
+
+// MANIPULATORS
+void WorkStealingThreadPool::drain()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_enabled = 0;
+
+    while ((d_threadCount && d_numPendingJobs) || d_numActiveThreads) {
+        d_drainCond.wait(&d_mutex);
+    }
+}
+
+int WorkStealingThreadPool::enqueueJob(const Job& functor)
+{
+    if (!functor) {
+        // Abort here if the 'functor' is "unset".  This prevents a crash
+        // inside 'workerThread' (where the context of 'functor' would be
+        // lost).
+
+        BSLS_ASSERT(0);
+        bsl::abort();  // abort (for when 'assert' is removed by optimization)
+    }
+
+    Queue *queue = enqueueQueue();
+    if (!queue) {
+        return -1;                                                    // RETURN
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&queue->d_mutex);
+        queue->d_jobs.push_back(functor);
+    }
+    ++d_numPendingJobs;
+
+    return afterEnqueue();
+}
+
+int WorkStealingThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
+{
+    if (!bslmf::MovableRefUtil::access(functor)) {
+        // Abort here if the 'functor' is "unset".  This prevents a crash
+        // inside 'workerThread' (where the context of 'functor' would be
+        // lost).
+
+        BSLS_ASSERT(0);
+        bsl::abort();  // abort (for when 'assert' is removed by optimization)
+    }
+
+    Queue *queue = enqueueQueue();
+    if (!queue) {
+        return -1;                                                    // RETURN
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&queue->d_mutex);
+        queue->d_jobs.push_back(bslmf::MovableRefUtil::move(functor));
+    }
+    ++d_numPendingJobs;
+
+    return afterEnqueue();
+}
+
+double WorkStealingThreadPool::resetPercentBusy()
+{
+    bsls::Types::Int64 now           = bsls::TimeUtil::getTimer();
+    bsls::Types::Int64 lastResetTime = d_lastResetTime.swap(now);
+    const double callbackTime = static_cast<double>(d_callbackTime.swap(0));
+
+    // On some platforms, the "nanosecond" timers can be too coarse and no time
+    // is perceived to elapse; this sets the minimum elapsed time to 1ns.
+
+    double interval = static_cast<double>(now - lastResetTime);
+    interval = 0 != interval ? interval : 1;
+
+    return 100.0 / d_maxThreads * callbackTime / interval;
+}
+
+void WorkStealingThreadPool::shutdown()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_enabled       = 0;
+    d_terminateFlag = true;
+
+    clearQueues();
+
+    d_workCond.broadcast();
+    while (d_threadCount) {
+        d_drainCond.wait(&d_mutex);
+    }
+
+    // Discard the jobs that may have been accepted by an 'enqueueJob'
+    // concurrent with this call.
+
+    clearQueues();
+}
+
+int WorkStealingThreadPool::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_enabled       = 1;
+    d_terminateFlag = false;
+
+    while (d_threadCount < d_minThreads) {
+        if (0 != startNewThread()) {
+            lock.release()->unlock();
+            shutdown(); // terminate running threads.
+            return -1;                                                // RETURN
+        }
+    }
+
+    // Start threads for the jobs that were accepted while the pool was
+    // stopped, if any.
+
+    while (d_numPendingJobs > d_threadCount && d_threadCount < d_maxThreads) {
+        if (0 != startNewThread()) {
+            break;
+        }
+    }
+    d_workCond.broadcast();
+
+    return 0;
+}
+
+void WorkStealingThreadPool::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_enabled = 0;
+
+    while ((d_threadCount && d_numPendingJobs) || d_numActiveThreads) {
+        d_drainCond.wait(&d_mutex);
+    }
+
+    d_terminateFlag = true;
+    d_workCond.broadcast();
+    while (d_threadCount) {
+        d_drainCond.wait(&d_mutex);
+    }
+}
+
+// ACCESSORS
+double WorkStealingThreadPool::percentBusy() const
+{
+    bsls::Types::Int64 last = d_lastResetTime;
+    double interval = static_cast<double>(bsls::TimeUtil::getTimer() - last);
+
+    // On some platforms, the "nanosecond" timers can be too coarse and no time
+    // is perceived to elapse; this sets the minimum elapsed time to 1ns.
+
+    interval = 0 != interval ? interval : 1;
+
+    double ratio = static_cast<double>(d_callbackTime) / interval;
+
+    return 100.0 / d_maxThreads * ratio;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,537 @@
+// bdlmt_workstealingthreadpool.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+#define INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a dynamic thread pool with per-thread work-stealing queues.
+//
+//@CLASSES:
+//   bdlmt::WorkStealingThreadPool: dynamic pool of work-stealing threads
+//
+//@SEE_ALSO: bdlmt_threadpool, bdlmt_fixedthreadpool
+//
+//@DESCRIPTION: This component defines a thread pool,
+// 'bdlmt::WorkStealingThreadPool', that offers the same interface and the same
+// thread-management behavior as 'bdlmt::ThreadPool' -- a client-specified
+// minimum number of threads is always maintained, additional threads (up to a
+// client-specified maximum) are created on demand, and threads in excess of
+// the minimum are destroyed after remaining idle for a client-specified
+// maximum idle time -- but that distributes jobs using a *work-stealing*
+// scheduler rather than a single shared queue.
+//
+// Each processing thread of the pool owns a queue of pending jobs protected by
+// its own mutex:
+//
+//: o A job enqueued by a processing thread of the pool (e.g., a job that
+//:   "fans out" into sub-jobs) is pushed onto the queue owned by that thread.
+//:
+//: o A job enqueued by any other thread is pushed onto one of the queues of
+//:   the pool, chosen in a round-robin manner.
+//:
+//: o A processing thread looking for work first takes the most recently
+//:   enqueued job from its own queue and, if its own queue is empty, "steals"
+//:   the least recently enqueued job from the queue of another thread.
+//
+// Consequently, contention between threads is limited to the (rare) cases
+// where two threads access the same queue at the same time, instead of every
+// enqueue and dequeue operation contending on a single lock, as is the case
+// for 'bdlmt::ThreadPool'.  The global mutex of the pool is acquired only to
+// create or destroy threads, to put idle threads to sleep, and to wake them.
+// Note that, unlike 'bdlmt::ThreadPool', this pool does *not* process jobs in
+// the order in which they were enqueued; clients requiring FIFO processing
+// should use 'bdlmt::ThreadPool' or 'bdlmt::FixedThreadPool'.
+//
+// The 'drain', 'stop', 'shutdown', and 'start' methods have the same
+// semantics as their 'bdlmt::ThreadPool' counterparts, except that a job
+// enqueued by a processing thread of the pool (i.e., by another job) while the
+// pool is being drained or stopped is accepted, so that 'drain' and 'stop'
+// wait for all the jobs spawned, directly or indirectly, by the jobs that were
+// pending when they were called.  Also note that a job enqueued by an external
+// thread concurrently with a call to 'drain' or 'stop' may be accepted by the
+// pool even though it is not processed before 'drain' or 'stop' returns; such
+// a job is processed once the pool is re-started (or discarded by
+// 'shutdown').
+//
+///Thread Safety
+///-------------
+// The 'bdlmt::WorkStealingThreadPool' class is both *fully thread-safe* (i.e.,
+// all non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See 'bsldoc_glossary' for complete
+// definitions of *fully thread-safe* and *thread-enabled*.
+//
+///Synchronous Signals on Unix
+///---------------------------
+// As is the case for 'bdlmt::ThreadPool', on unix platforms all threads in
+// the pool block all asynchronous signals, that is all signals except
+// 'SIGBUS', 'SIGFPE', 'SIGILL', 'SIGSEGV', 'SIGSYS', 'SIGABRT', 'SIGTRAP', and
+// 'SIGIOT'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parallel Recursive Summation
+///- - - - - - - - - - - - - - - - - - - -
+// Work-stealing is well suited to divide-and-conquer algorithms, in which a
+// job splits its input and enqueues sub-jobs for the pieces.  In this example
+// we sum the elements of an array by recursively splitting the array until
+// the pieces are small enough to be summed directly.
+//
+// First, we define a job that either sums a small range directly, or splits
+// the range in two halves and enqueues a job for each half.  Because the
+// sub-jobs are enqueued from a processing thread of the pool, they are pushed
+// onto the queue of that thread, where they are likely to be processed by the
+// same thread (with warm caches) unless an idle thread steals them:
+//..
+//  struct SumJob {
+//      bdlmt::WorkStealingThreadPool *d_pool_p;
+//      const int                     *d_begin_p;
+//      const int                     *d_end_p;
+//      bsls::AtomicInt64             *d_sum_p;
+//
+//      void operator()() const
+//      {
+//          if (d_end_p - d_begin_p <= 1024) {
+//              bsls::Types::Int64 sum = 0;
+//              for (const int *p = d_begin_p; p != d_end_p; ++p) {
+//                  sum += *p;
+//              }
+//              d_sum_p->add(sum);
+//              return;                                               // RETURN
+//          }
+//
+//          const int *middle = d_begin_p + (d_end_p - d_begin_p) / 2;
+//
+//          SumJob lower = { d_pool_p, d_begin_p, middle,  d_sum_p };
+//          SumJob upper = { d_pool_p, middle,    d_end_p, d_sum_p };
+//
+//          d_pool_p->enqueueJob(lower);
+//          d_pool_p->enqueueJob(upper);
+//      }
+//  };
+//..
+// Then, we create and start a pool:
+//..
+//  bslmt::ThreadAttributes       attributes;
+//  bdlmt::WorkStealingThreadPool pool(attributes, 4, 8, 1000);
+//
+//  int rc = pool.start();
+//  assert(0 == rc);
+//..
+// Next, we create the data to be summed and enqueue the root job:
+//..
+//  bsl::vector<int> data(1 << 20, 1);
+//
+//  bsls::AtomicInt64 sum(0);
+//
+//  SumJob root = { &pool, data.data(), data.data() + data.size(), &sum };
+//
+//  pool.enqueueJob(root);
+//..
+// Finally, we wait for all jobs, including all the sub-jobs, to complete and
+// verify the result:
+//..
+//  pool.drain();
+//
+//  assert(static_cast<bsls::Types::Int64>(data.size()) == sum);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlmt_threadpool.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+
+#include <bsl_functional.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_csignal.h>              // sigset_t
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+struct WorkStealingThreadPool_Queue;
+
+extern "C" void *WorkStealingThreadPoolEntry(void *);
+    // Entry point for processing threads.
+
+                       // ============================
+                       // class WorkStealingThreadPool
+                       // ============================
+
+class WorkStealingThreadPool {
+    // This class implements a thread pool used for concurrently executing
+    // multiple user-defined functions ("jobs"), where each processing thread
+    // owns a queue of pending jobs and idle threads steal jobs from the
+    // queues of other threads.
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+  private:
+    // PRIVATE TYPES
+    typedef WorkStealingThreadPool_Queue Queue;
+
+    // DATA
+    bsl::vector<Queue *>    d_queues;          // one queue per potential
+                                               // processing thread (owned)
+
+    bsls::AtomicInt         d_numQueuesUsed;   // one past the highest index
+                                               // of a queue that has ever been
+                                               // owned by a processing thread
+
+    bsls::AtomicUint        d_nextQueue;       // round-robin index used to
+                                               // select the queue of a job
+                                               // enqueued by an external
+                                               // thread
+
+    bslmt::ThreadUtil::Key  d_queueKey;        // thread-specific key holding
+                                               // the address of the queue
+                                               // owned by the current
+                                               // processing thread
+
+    mutable bslmt::Mutex    d_mutex;           // mutex used to control the
+                                               // creation and destruction of
+                                               // threads, and the waiting of
+                                               // idle threads
+
+    bslmt::Condition        d_workCond;        // condition variable used to
+                                               // wake idle threads
+
+    bslmt::Condition        d_drainCond;       // condition variable used to
+                                               // signal that all the queues
+                                               // are drained and that all
+                                               // active jobs have completed
+
+    bslmt::ThreadAttributes d_threadAttributes;
+                                               // thread attributes to be used
+                                               // when constructing processing
+                                               // threads
+
+    const int               d_maxThreads;      // maximum number of processing
+                                               // threads
+
+    const int               d_minThreads;      // minimum number of processing
+                                               // threads
+
+    const int               d_maxIdleTime;     // maximum time (in
+                                               // milliseconds) that threads
+                                               // (in excess of the minimum
+                                               // number of threads) can
+                                               // remain idle before being shut
+                                               // down
+
+    bsls::AtomicInt         d_threadCount;     // current number of processing
+                                               // threads
+
+    bsls::AtomicInt         d_createFailures;  // number of thread create
+                                               // failures
+
+    bsls::AtomicInt         d_numPendingJobs;  // number of jobs in all the
+                                               // queues
+
+    bsls::AtomicInt         d_numActiveThreads;
+                                               // current number of threads
+                                               // that are actively processing
+                                               // a job
+
+    bsls::AtomicInt         d_numWaiting;      // number of threads currently
+                                               // blocked on 'd_workCond'
+
+    bsls::AtomicInt         d_enabled;         // indicates the enabled state
+                                               // of the pool; queuing is
+                                               // disabled when 0, enabled
+                                               // otherwise
+
+    bsls::AtomicBool        d_terminateFlag;   // 'true' if processing threads
+                                               // must exit (modified under
+                                               // 'd_mutex')
+
+    bsls::AtomicInt64       d_lastResetTime;   // last reset time of
+                                               // percent-busy metric in
+                                               // nanoseconds from some
+                                               // arbitrary but fixed point in
+                                               // time
+
+    bsls::AtomicInt64       d_callbackTime;    // the total time spent running
+                                               // jobs (callbacks) across all
+                                               // threads, in nanoseconds
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sigset_t                d_blockSet;        // set of signals to be blocked
+                                               // in managed threads
+#endif
+
+    // FRIENDS
+    friend void *WorkStealingThreadPoolEntry(void *);
+
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool(const WorkStealingThreadPool&);
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&);
+
+    // PRIVATE MANIPULATORS
+    int afterEnqueue();
+        // Wake an idle processing thread, if any, and start a new processing
+        // thread if the number of pending and active jobs exceeds the number
+        // of processing threads and the maximum number of threads is not yet
+        // running.  Return 0 if at least one thread is running, and a
+        // non-zero value otherwise.
+
+    void clearQueues();
+        // Remove (and destroy) all the jobs in the queues of this pool.
+
+    Queue *enqueueQueue();
+        // Return the address of the queue onto which a job enqueued by the
+        // calling thread must be pushed, or 0 if queuing is disabled for the
+        // calling thread.
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    void initBlockSet();
+        // Initialize the set of signals to be blocked in the managed threads.
+#endif
+
+    bool popJob(Job *job, Queue *ownQueue);
+        // Load into the specified 'job' a job taken from the specified
+        // 'ownQueue' or, if 'ownQueue' is empty, stolen from the queue of
+        // another thread, and increment the number of active threads.  Return
+        // 'true' if a job was loaded, and 'false' otherwise.
+
+    int startNewThread();
+        // Spawn a new processing thread owning a queue not owned by any other
+        // thread and increment the current count.  Return 0 on success, and a
+        // non-zero value otherwise.  The behavior is undefined unless
+        // 'd_mutex' is locked by the calling thread.
+
+    void workerThread(Queue *ownQueue);
+        // Processing thread function, where the specified 'ownQueue' is the
+        // queue owned by the calling thread.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(WorkStealingThreadPool,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    WorkStealingThreadPool(
+                         const bslmt::ThreadAttributes&  threadAttributes,
+                         int                             minThreads,
+                         int                             maxThreads,
+                         int                             maxIdleTime,
+                         bslma::Allocator               *basicAllocator = 0);
+        // Construct a work-stealing thread pool with the specified
+        // 'threadAttributes', the specified 'minThreads' minimum number of
+        // threads, the specified 'maxThreads' maximum number of threads, and
+        // the specified 'maxIdleTime' maximum idle time (in milliseconds).
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 <= minThreads',
+        // 'minThreads <= maxThreads', '0 < maxThreads', and
+        // '0 <= maxIdleTime'.
+
+    ~WorkStealingThreadPool();
+        // Call 'shutdown()' and destroy this thread pool.
+
+    // MANIPULATORS
+    void drain();
+        // Disable queuing on this thread pool and wait until all pending jobs
+        // complete.  Use 'start' to re-enable queuing.
+
+    int enqueueJob(const Job& functor);
+    int enqueueJob(bslmf::MovableRef<Job> functor);
+        // Enqueue the specified 'functor' to be executed by a thread of this
+        // pool.  If the calling thread is a processing thread of this pool,
+        // 'functor' is pushed onto the queue owned by the calling thread.
+        // Return 0 if enqueued successfully, and a non-zero value if queuing
+        // is currently disabled.  The behavior is undefined unless 'functor'
+        // is not "unset".  Note that queuing is disabled for the processing
+        // threads of this pool only while 'shutdown' or 'stop' is terminating
+        // them (see {Description}).  See 'bsl::function' for more information
+        // on functors.
+
+    int enqueueJob(ThreadPoolJobFunc function, void *userData);
+        // Enqueue the specified 'function' to be executed by a thread of this
+        // pool.  The specified 'userData' pointer will be passed to the
+        // function by the processing thread.  Return 0 if enqueued
+        // successfully, and a non-zero value if queuing is currently
+        // disabled.  Note that 'function' has the same type as the functions
+        // accepted by 'bdlmt::ThreadPool::enqueueJob'.
+
+    double resetPercentBusy();
+        // Atomically report the percentage of wall time spent by each thread
+        // of this thread pool executing jobs since the last reset time, and
+        // set the reset time to now.  The creation of the thread pool is
+        // considered a first reset time.  See 'percentBusy'.
+
+    void shutdown();
+        // Disable queuing on this thread pool, cancel all queued jobs, and
+        // shut down all processing threads (after all active jobs complete).
+
+    int start();
+        // Enable queuing on this thread pool and spawn 'minThreads()'
+        // processing threads.  Return 0 on success, and a non-zero value
+        // otherwise.  If 'minThreads()' threads were not successfully started,
+        // all threads are stopped.
+
+    void stop();
+        // Disable queuing on this thread pool and wait until all pending jobs
+        // complete, then shut down all processing threads.
+
+    // ACCESSORS
+    int enabled() const;
+        // Return the state (enabled or not) of the thread pool.
+
+    int maxIdleTime() const;
+        // Return the maximum amount of time (in milliseconds) a thread may
+        // remain idle before being shut down when there are more than min
+        // threads started.
+
+    int maxThreads() const;
+        // Return the maximum number of threads that are allowed to be running
+        // at given time.
+
+    int minThreads() const;
+        // Return the minimum number of threads that must be started at any
+        // given time.
+
+    int numActiveThreads() const;
+        // Return the number of threads that are currently processing a job.
+
+    int numPendingJobs() const;
+        // Return the number of jobs that are currently queued, but not yet
+        // being processed.
+
+    int numThreads() const;
+        // Return the number of processing threads currently started by this
+        // pool.
+
+    int numWaitingThreads() const;
+        // Return the number of threads that are currently waiting for a job.
+
+    double percentBusy() const;
+        // Return the percentage of wall time spent by each thread of this
+        // thread pool executing jobs since the last reset time.  The creation
+        // of the thread pool is considered a first reset time.  This value is
+        // calculated as
+        //..
+        //           sum(jobExecutionTime)       100%
+        //  P_busy = --------------------   x ----------
+        //            timeSinceLastReset      maxThreads
+        //..
+        // Note that this percentage reflects the wall time spent per thread,
+        // and not CPU time per thread, or not even CPU time per processor.
+
+    int threadFailures() const;
+        // Return the number of times that thread creation failed.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // class WorkStealingThreadPool
+                       // ----------------------------
+
+// MANIPULATORS
+inline
+int WorkStealingThreadPool::enqueueJob(ThreadPoolJobFunc  function,
+                                       void              *userData)
+{
+    return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
+}
+
+// ACCESSORS
+inline
+int WorkStealingThreadPool::enabled() const
+{
+    return d_enabled;
+}
+
+inline
+int WorkStealingThreadPool::maxIdleTime() const
+{
+    return d_maxIdleTime;
+}
+
+inline
+int WorkStealingThreadPool::maxThreads() const
+{
+    return d_maxThreads;
+}
+
+inline
+int WorkStealingThreadPool::minThreads() const
+{
+    return d_minThreads;
+}
+
+inline
+int WorkStealingThreadPool::numActiveThreads() const
+{
+    return d_numActiveThreads;
+}
+
+inline
+int WorkStealingThreadPool::numPendingJobs() const
+{
+    return d_numPendingJobs;
+}
+
+inline
+int WorkStealingThreadPool::numThreads() const
+{
+    return d_threadCount;
+}
+
+inline
+int WorkStealingThreadPool::numWaitingThreads() const
+{
+    return d_threadCount - d_numActiveThreads;
+}
+
+inline
+int WorkStealingThreadPool::threadFailures() const
+{
+    return d_createFailures;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
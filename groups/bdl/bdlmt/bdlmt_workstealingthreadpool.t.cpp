@@ -0,0 +1,1027 @@
+// bdlmt_workstealingthreadpool.t.cpp                                 -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlmt_threadpool.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_configuration.h>
+#include <bslmt_latch.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// A work-stealing thread pool distributes jobs onto per-thread queues and lets
+// idle threads steal jobs from the queues of other threads, while offering the
+// same interface and thread management as 'bdlmt::ThreadPool'.  We need to
+// verify that every accepted job is executed exactly once regardless of the
+// queue it lands on, that jobs enqueued from processing threads are executed,
+// that the number of threads grows and shrinks between the minimum and the
+// maximum, and that 'drain', 'stop', and 'shutdown' have the documented
+// semantics.
+//
+// In addition to positive test cases (run in the nightly builds), a negative
+// test case -1 can be run manually to compare the throughput of this pool
+// with that of 'bdlmt::ThreadPool' on a fan-out heavy workload.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] WorkStealingThreadPool(const ThreadAttributes&, int, int, int, *);
+// [ 2] ~WorkStealingThreadPool();
+//
+// MANIPULATORS
+// [ 3] void drain();
+// [ 2] int enqueueJob(const Job& functor);
+// [ 2] int enqueueJob(bslmf::MovableRef<Job> functor);
+// [ 2] int enqueueJob(ThreadPoolJobFunc function, void *);
+// [ 5] double resetPercentBusy();
+// [ 3] void shutdown();
+// [ 2] int start();
+// [ 3] void stop();
+//
+// ACCESSORS
+// [ 2] int enabled() const;
+// [ 2] int maxIdleTime() const;
+// [ 2] int maxThreads() const;
+// [ 2] int minThreads() const;
+// [ 3] int numActiveThreads() const;
+// [ 3] int numPendingJobs() const;
+// [ 4] int numThreads() const;
+// [ 3] int numWaitingThreads() const;
+// [ 5] double percentBusy() const;
+// [ 2] int threadFailures() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] JOBS ENQUEUING JOBS
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: COMPARISON WITH 'bdlmt::ThreadPool'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::WorkStealingThreadPool Obj;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+extern "C" void incrementCounter(void *counter)
+    // Increment the 'bsls::AtomicInt' at the specified 'counter' address.
+{
+    ++*static_cast<bsls::AtomicInt *>(counter);
+}
+
+struct BarrierJob {
+    // This 'struct' defines a job that waits on a barrier twice, so that the
+    // test driver can observe the pool while the job is active.
+
+    bslmt::Barrier *d_startBarrier_p;
+    bslmt::Barrier *d_stopBarrier_p;
+
+    void operator()() const
+    {
+        d_startBarrier_p->wait();
+        d_stopBarrier_p->wait();
+    }
+};
+
+struct FanOutJob {
+    // This 'struct' defines a job that, if its depth is positive, enqueues
+    // 'd_width' jobs of lower depth on the pool, and increments a counter
+    // otherwise.
+
+    Obj             *d_pool_p;
+    int              d_depth;
+    int              d_width;
+    bsls::AtomicInt *d_count_p;
+
+    void operator()() const
+    {
+        if (0 == d_depth) {
+            ++*d_count_p;
+            return;                                                   // RETURN
+        }
+        for (int i = 0; i < d_width; ++i) {
+            FanOutJob child = { d_pool_p, d_depth - 1, d_width, d_count_p };
+            int rc = d_pool_p->enqueueJob(child);
+            ASSERTV(rc, 0 == rc);
+        }
+    }
+};
+
+struct SpawnerJob {
+    // This 'struct' defines a job that enqueues 'd_count' 'BarrierJob' jobs
+    // using the specified barriers.
+
+    Obj            *d_pool_p;
+    bslmt::Barrier *d_start_p;
+    bslmt::Barrier *d_stop_p;
+    int             d_count;
+
+    void operator()() const
+    {
+        BarrierJob job = { d_start_p, d_stop_p };
+        for (int i = 0; i < d_count; ++i) {
+            d_pool_p->enqueueJob(job);
+        }
+    }
+};
+
+struct Releaser {
+    // This 'struct' defines a thread function that waits on a barrier once
+    // the pool has no pending jobs.
+
+    bslmt::Barrier *d_barrier_p;
+    const Obj      *d_pool_p;
+
+    void operator()() const
+    {
+        while (0 != d_pool_p->numPendingJobs()) {
+            bslmt::ThreadUtil::yield();
+        }
+        d_barrier_p->wait();
+    }
+};
+
+struct SleepJob {
+    // This 'struct' defines a job that sleeps for 'd_microseconds'.
+
+    int d_microseconds;
+
+    void operator()() const
+    {
+        bslmt::ThreadUtil::microSleep(d_microseconds);
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                           BENCHMARK SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace bench {
+
+template <class POOL>
+struct FanOutTask {
+    // This 'struct' defines a job that enqueues 'd_width' leaf jobs on a pool
+    // of the (template parameter) type 'POOL', each doing a small amount of
+    // busy work before arriving on a latch.
+
+    POOL         *d_pool_p;
+    int           d_width;
+    int           d_busyWork;
+    bslmt::Latch *d_latch_p;
+
+    void operator()() const
+    {
+        if (0 < d_width) {
+            FanOutTask leaf = { d_pool_p, 0, d_busyWork, d_latch_p };
+            for (int i = 0; i < d_width; ++i) {
+                d_pool_p->enqueueJob(leaf);
+            }
+            return;                                                   // RETURN
+        }
+        bslmt::ThroughputBenchmark::busyWork(d_busyWork);
+        d_latch_p->arrive();
+    }
+};
+
+template <class POOL>
+class FanOutBenchmark {
+    // This class provides the run function used by the threads of a
+    // 'bslmt::ThroughputBenchmark': each work unit enqueues 'numRoots' root
+    // jobs, each fanning out into 'width' leaf jobs, and waits for all the
+    // leaf jobs to complete.
+
+    // DATA
+    POOL *d_pool_p;
+    int   d_numRoots;
+    int   d_width;
+    int   d_busyWork;
+
+  public:
+    // CREATORS
+    FanOutBenchmark(POOL *pool, int numRoots, int width, int busyWork)
+    : d_pool_p(pool)
+    , d_numRoots(numRoots)
+    , d_width(width)
+    , d_busyWork(busyWork)
+    {
+    }
+
+    // MANIPULATORS
+    void run(int)
+    {
+        bslmt::Latch latch(d_numRoots * d_width);
+
+        FanOutTask<POOL> root = { d_pool_p, d_width, d_busyWork, &latch };
+        for (int i = 0; i < d_numRoots; ++i) {
+            d_pool_p->enqueueJob(root);
+        }
+        latch.wait();
+    }
+};
+
+template <class POOL>
+double measure(int numClients,
+               int numThreads,
+               int numRoots,
+               int width,
+               int busyWork,
+               int numMillis,
+               int numSamples)
+    // Return the median number of work units per second executed by the
+    // specified 'numClients' client threads on a pool of the (template
+    // parameter) type 'POOL' having the specified 'numThreads' threads, where
+    // each work unit consists of the specified 'numRoots' root jobs each
+    // fanning out into the specified 'width' leaf jobs doing the specified
+    // 'busyWork' amount of work, measured over the specified 'numSamples'
+    // samples of the specified 'numMillis' milliseconds.
+{
+    bslmt::ThreadAttributes attributes;
+    POOL                    pool(attributes, numThreads, numThreads, 1000);
+
+    BSLS_ASSERT_OPT(0 == pool.start());
+
+    FanOutBenchmark<POOL> benchmark(&pool, numRoots, width, busyWork);
+
+    bslmt::ThroughputBenchmark       tb;
+    bslmt::ThroughputBenchmarkResult result;
+
+    int groupId = tb.addThreadGroup(
+                        bdlf::BindUtil::bind(&FanOutBenchmark<POOL>::run,
+                                             &benchmark,
+                                             bdlf::PlaceHolders::_1),
+                        numClients,
+                        0);
+
+    tb.execute(&result, numMillis, numSamples);
+
+    pool.stop();
+
+    double median;
+    result.getMedian(&median, groupId);
+    return median;
+}
+
+}  // close namespace bench
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Example 1: Parallel Recursive Summation
+///- - - - - - - - - - - - - - - - - - - -
+// Work-stealing is well suited to divide-and-conquer algorithms, in which a
+// job splits its input and enqueues sub-jobs for the pieces.  In this example
+// we sum the elements of an array by recursively splitting the array until
+// the pieces are small enough to be summed directly.
+//
+// First, we define a job that either sums a small range directly, or splits
+// the range in two halves and enqueues a job for each half.  Because the
+// sub-jobs are enqueued from a processing thread of the pool, they are pushed
+// onto the queue of that thread, where they are likely to be processed by the
+// same thread (with warm caches) unless an idle thread steals them:
+//..
+    struct SumJob {
+        bdlmt::WorkStealingThreadPool *d_pool_p;
+        const int                     *d_begin_p;
+        const int                     *d_end_p;
+        bsls::AtomicInt64             *d_sum_p;
+
+        void operator()() const
+        {
+            if (d_end_p - d_begin_p <= 1024) {
+                bsls::Types::Int64 sum = 0;
+                for (const int *p = d_begin_p; p != d_end_p; ++p) {
+                    sum += *p;
+                }
+                d_sum_p->add(sum);
+                return;                                               // RETURN
+            }
+
+            const int *middle = d_begin_p + (d_end_p - d_begin_p) / 2;
+
+            SumJob lower = { d_pool_p, d_begin_p, middle,  d_sum_p };
+            SumJob upper = { d_pool_p, middle,    d_end_p, d_sum_p };
+
+            d_pool_p->enqueueJob(lower);
+            d_pool_p->enqueueJob(upper);
+        }
+    };
+//..
+
+}  // close namespace usage
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslmt::Configuration::setDefaultThreadStackSize(
+                    bslmt::Configuration::recommendedDefaultThreadStackSize());
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace usage;
+
+// Then, we create and start a pool:
+//..
+    bslmt::ThreadAttributes       attributes;
+    bdlmt::WorkStealingThreadPool pool(attributes, 4, 8, 1000);
+
+    int rc = pool.start();
+    ASSERT(0 == rc);
+//..
+// Next, we create the data to be summed and enqueue the root job:
+//..
+    bsl::vector<int> data(1 << 20, 1);
+
+    bsls::AtomicInt64 sum(0);
+
+    SumJob root = { &pool, data.data(), data.data() + data.size(), &sum };
+
+    pool.enqueueJob(root);
+//..
+// Finally, we wait for all jobs, including all the sub-jobs, to complete and
+// verify the result:
+//..
+    pool.drain();
+
+    ASSERT(static_cast<bsls::Types::Int64>(data.size()) == sum);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // JOBS ENQUEUING JOBS
+        //
+        // Concerns:
+        //: 1 Jobs enqueued by processing threads (which land on the queue of
+        //:   the enqueuing thread) are all executed exactly once.
+        //:
+        //: 2 'drain' waits for jobs enqueued by jobs.
+        //:
+        //: 3 Jobs enqueued on the queue of a busy thread are stolen by the
+        //:   other threads.
+        //
+        // Plan:
+        //: 1 Enqueue a tree of 'FanOutJob' jobs for various numbers of threads
+        //:   and verify, after 'drain', that every leaf was executed exactly
+        //:   once.  (C-1..2)
+        //:
+        //: 2 From a single job, enqueue blocking jobs that each wait on a
+        //:   barrier with the test thread; the barrier can be reached only if
+        //:   the other threads steal the jobs from the queue of the enqueuing
+        //:   thread.  (C-3)
+        //
+        // Testing:
+        //   JOBS ENQUEUING JOBS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "JOBS ENQUEUING JOBS" << endl
+                          << "===================" << endl;
+
+        const int THREADS[] = { 1, 2, 4, 8 };
+        const int NUM_THREADS = sizeof THREADS / sizeof *THREADS;
+
+        for (int ti = 0; ti < NUM_THREADS; ++ti) {
+            const int NT = THREADS[ti];
+
+            if (veryVerbose) { T_ P(NT) }
+
+            bslmt::ThreadAttributes attr;
+            Obj                     mX(attr, NT, NT, 100, &ta);
+
+            ASSERT(0 == mX.start());
+
+            bsls::AtomicInt count(0);
+            FanOutJob       root = { &mX, 4, 6, &count };  // 6^4 leaves
+
+            ASSERT(0 == mX.enqueueJob(root));
+
+            mX.drain();
+
+            ASSERTV(NT, count, 6 * 6 * 6 * 6 == count);
+            ASSERTV(NT, 0 == mX.numPendingJobs());
+            ASSERTV(NT, 0 == mX.numActiveThreads());
+        }
+
+        {
+            const int NT = 4;
+
+            bslmt::ThreadAttributes attr;
+            Obj                     mX(attr, NT, NT, 100, &ta);
+
+            ASSERT(0 == mX.start());
+
+            bslmt::Barrier startBarrier(NT);
+            bslmt::Barrier stopBarrier(NT);
+
+            // The job below runs on one thread, and pushes 'NT - 1' blocking
+            // jobs onto the queue of that thread.
+
+            SpawnerJob spawner = { &mX, &startBarrier, &stopBarrier, NT - 1 };
+
+            ASSERT(0 == mX.enqueueJob(spawner));
+
+            startBarrier.wait();  // reached only if the jobs were stolen
+
+            ASSERT(NT - 1 == mX.numActiveThreads());
+
+            stopBarrier.wait();
+
+            mX.drain();
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'percentBusy' AND 'resetPercentBusy'
+        //
+        // Concerns:
+        //: 1 'percentBusy' is 0 for an idle pool and positive after jobs ran.
+        //:
+        //: 2 'resetPercentBusy' resets the metric.
+        //
+        // Plan:
+        //: 1 Run sleeping jobs and verify the metric before and after a
+        //:   reset.  (C-1..2)
+        //
+        // Testing:
+        //   double percentBusy() const;
+        //   double resetPercentBusy();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'percentBusy' AND 'resetPercentBusy'"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        bslmt::ThreadAttributes attr;
+        Obj                     mX(attr, 2, 2, 100, &ta);
+
+        ASSERT(0 == mX.start());
+
+        ASSERTV(mX.percentBusy(), 0 == mX.percentBusy());
+
+        SleepJob job = { 50 * 1000 };
+        ASSERT(0 == mX.enqueueJob(job));
+        ASSERT(0 == mX.enqueueJob(job));
+
+        mX.drain();
+
+        const double busy = mX.resetPercentBusy();
+        ASSERTV(busy, 0 < busy);
+        ASSERTV(busy, 100.5 >= busy);
+
+        ASSERTV(mX.percentBusy(), 0 == mX.percentBusy());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING THREAD ELASTICITY
+        //
+        // Concerns:
+        //: 1 'start' spawns 'minThreads()' threads.
+        //:
+        //: 2 Threads are added, up to 'maxThreads()', when jobs are pending.
+        //:
+        //: 3 Threads in excess of 'minThreads()' exit once they have been idle
+        //:   for 'maxIdleTime()' milliseconds.
+        //
+        // Plan:
+        //: 1 Start a pool and verify 'numThreads'.  (C-1)
+        //:
+        //: 2 Enqueue 'maxThreads()' blocking jobs and verify, while they are
+        //:   active, that 'numThreads() == maxThreads()'.  (C-2)
+        //:
+        //: 3 Release the jobs, wait for longer than the idle time, and verify
+        //:   that 'numThreads() == minThreads()'.  (C-3)
+        //
+        // Testing:
+        //   int numThreads() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING THREAD ELASTICITY" << endl
+                          << "=========================" << endl;
+
+        const int MIN_THREADS = 2;
+        const int MAX_THREADS = 6;
+        const int IDLE_TIME   = 50;
+
+        bslmt::ThreadAttributes attr;
+        Obj                     mX(attr, MIN_THREADS, MAX_THREADS, IDLE_TIME,
+                                   &ta);
+        const Obj&              X = mX;
+
+        ASSERT(0 == X.numThreads());
+
+        ASSERT(0 == mX.start());
+
+        ASSERTV(X.numThreads(), MIN_THREADS == X.numThreads());
+
+        bslmt::Barrier startBarrier(MAX_THREADS + 1);
+        bslmt::Barrier stopBarrier(MAX_THREADS + 1);
+
+        BarrierJob job = { &startBarrier, &stopBarrier };
+        for (int i = 0; i < MAX_THREADS; ++i) {
+            ASSERT(0 == mX.enqueueJob(job));
+        }
+
+        startBarrier.wait();
+
+        ASSERTV(X.numThreads(),       MAX_THREADS == X.numThreads());
+        ASSERTV(X.numActiveThreads(), MAX_THREADS == X.numActiveThreads());
+
+        stopBarrier.wait();
+
+        for (int i = 0; i < 100 && MIN_THREADS != X.numThreads(); ++i) {
+            bslmt::ThreadUtil::microSleep(10 * IDLE_TIME * 1000);
+        }
+
+        ASSERTV(X.numThreads(), MIN_THREADS == X.numThreads());
+
+        // The remaining threads still process jobs.
+
+        bsls::AtomicInt count(0);
+        for (int i = 0; i < 100; ++i) {
+            ASSERT(0 == mX.enqueueJob(&incrementCounter, &count));
+        }
+        mX.drain();
+        ASSERTV(count, 100 == count);
+
+        // A pool with no minimum thread starts threads on demand.
+
+        Obj mY(attr, 0, 2, IDLE_TIME, &ta);
+        ASSERT(0 == mY.start());
+        ASSERT(0 == mY.numThreads());
+
+        count = 0;
+        for (int i = 0; i < 100; ++i) {
+            ASSERT(0 == mY.enqueueJob(&incrementCounter, &count));
+        }
+        mY.drain();
+        ASSERTV(count, 100 == count);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'drain', 'stop', AND 'shutdown'
+        //
+        // Concerns:
+        //: 1 'drain' disables queuing and waits for all queued and active jobs
+        //:   to complete, leaving the threads running.
+        //:
+        //: 2 'stop' disables queuing, waits for all queued and active jobs to
+        //:   complete, and stops all threads.
+        //:
+        //: 3 'shutdown' discards the queued jobs, waits for the active jobs to
+        //:   complete, and stops all threads.
+        //:
+        //: 4 The pool can be re-started after each of the above.
+        //
+        // Plan:
+        //: 1 Block all threads of a pool with barrier jobs, enqueue additional
+        //:   jobs, and verify the accessors and the effect of each method.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   void drain();
+        //   void stop();
+        //   void shutdown();
+        //   int numActiveThreads() const;
+        //   int numPendingJobs() const;
+        //   int numWaitingThreads() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'drain', 'stop', AND 'shutdown'" << endl
+                          << "=======================================" << endl;
+
+        const int NT = 3;
+
+        bslmt::ThreadAttributes attr;
+        Obj                     mX(attr, NT, NT, 100, &ta);
+        const Obj&              X = mX;
+
+        for (int method = 0; method < 3; ++method) {
+            if (veryVerbose) { T_ P(method) }
+
+            ASSERT(0 == mX.start());
+            ASSERT(1 == X.enabled());
+            ASSERTV(X.numThreads(), NT == X.numThreads());
+
+            bslmt::Barrier startBarrier(NT + 1);
+            bslmt::Barrier stopBarrier(NT + 1);
+
+            BarrierJob job = { &startBarrier, &stopBarrier };
+            for (int i = 0; i < NT; ++i) {
+                ASSERT(0 == mX.enqueueJob(job));
+            }
+            startBarrier.wait();
+
+            ASSERTV(X.numActiveThreads(),  NT == X.numActiveThreads());
+            ASSERTV(X.numWaitingThreads(), 0  == X.numWaitingThreads());
+
+            bsls::AtomicInt count(0);
+            for (int i = 0; i < 10; ++i) {
+                ASSERT(0 == mX.enqueueJob(&incrementCounter, &count));
+            }
+            ASSERTV(X.numPendingJobs(), 10 == X.numPendingJobs());
+
+            if (2 == method) {
+                // Release the barrier jobs once 'shutdown' has discarded the
+                // queued jobs.
+
+                Releaser releaser = { &stopBarrier, &X };
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle, releaser));
+
+                mX.shutdown();
+
+                bslmt::ThreadUtil::join(handle);
+
+                ASSERTV(count, 0 == count);
+                ASSERT(0 == X.numThreads());
+            }
+            else {
+                stopBarrier.wait();
+
+                if (0 == method) {
+                    mX.drain();
+                    ASSERTV(X.numThreads(), NT == X.numThreads());
+                }
+                else {
+                    mX.stop();
+                    ASSERT(0 == X.numThreads());
+                }
+                ASSERTV(count, 10 == count);
+            }
+
+            ASSERT(0 == X.enabled());
+            ASSERT(0 == X.numPendingJobs());
+            ASSERT(0 == X.numActiveThreads());
+            ASSERT(0 != mX.enqueueJob(&incrementCounter, &count));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS, 'start', AND 'enqueueJob'
+        //
+        // Concerns:
+        //: 1 The constructor arguments are reflected by the accessors.
+        //:
+        //: 2 The pool is created disabled, and 'enqueueJob' fails until
+        //:   'start' is called.
+        //:
+        //: 3 Each overload of 'enqueueJob' enqueues a job that is executed
+        //:   exactly once.
+        //:
+        //: 4 All memory is supplied by the specified allocator.
+        //
+        // Plan:
+        //: 1 Create pools for various arguments using a test allocator,
+        //:   enqueue jobs using each overload of 'enqueueJob', and verify the
+        //:   results.  (C-1..4)
+        //
+        // Testing:
+        //   WorkStealingThreadPool(const ThreadAttributes&, int, int, int, *);
+        //   ~WorkStealingThreadPool();
+        //   int enqueueJob(const Job& functor);
+        //   int enqueueJob(bslmf::MovableRef<Job> functor);
+        //   int enqueueJob(ThreadPoolJobFunc function, void *);
+        //   int start();
+        //   int enabled() const;
+        //   int maxIdleTime() const;
+        //   int maxThreads() const;
+        //   int minThreads() const;
+        //   int threadFailures() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS, 'start', AND 'enqueueJob'"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        static const struct {
+            int d_line;
+            int d_minThreads;
+            int d_maxThreads;
+            int d_maxIdleTime;
+        } DATA[] = {
+            //LINE  MIN  MAX  IDLE
+            //----  ---  ---  ----
+            { L_,     0,   1,    0 },
+            { L_,     1,   1,   10 },
+            { L_,     0,   4,  100 },
+            { L_,     2,   4, 1000 },
+            { L_,     8,   8,  100 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+            const int MIN  = DATA[ti].d_minThreads;
+            const int MAX  = DATA[ti].d_maxThreads;
+            const int IDLE = DATA[ti].d_maxIdleTime;
+
+            if (veryVerbose) { T_ P_(LINE) P_(MIN) P_(MAX) P(IDLE) }
+
+            {
+                bslmt::ThreadAttributes attr;
+                Obj                     mX(attr, MIN, MAX, IDLE, &ta);
+                const Obj&              X = mX;
+
+                ASSERTV(LINE, MIN  == X.minThreads());
+                ASSERTV(LINE, MAX  == X.maxThreads());
+                ASSERTV(LINE, IDLE == X.maxIdleTime());
+                ASSERTV(LINE, 0    == X.enabled());
+                ASSERTV(LINE, 0    == X.threadFailures());
+                ASSERTV(LINE, 0    <  ta.numBlocksInUse());
+
+                bsls::AtomicInt count(0);
+
+                ASSERTV(LINE, 0 != mX.enqueueJob(&incrementCounter, &count));
+
+                ASSERTV(LINE, 0 == mX.start());
+                ASSERTV(LINE, 1 == X.enabled());
+
+                const int NUM_JOBS = 300;
+                for (int i = 0; i < NUM_JOBS; ++i) {
+                    switch (i % 3) {
+                      case 0: {
+                        const bdlmt::ThreadPoolJobFunc function =
+                                                            &incrementCounter;
+
+                        ASSERTV(LINE, 0 == mX.enqueueJob(function, &count));
+                      } break;
+                      case 1: {
+                        const Obj::Job job = bdlf::BindUtil::bind(
+                                                             &incrementCounter,
+                                                             &count);
+                        ASSERTV(LINE, 0 == mX.enqueueJob(job));
+                      } break;
+                      default: {
+                        Obj::Job job = bdlf::BindUtil::bind(&incrementCounter,
+                                                            &count);
+                        ASSERTV(LINE, 0 == mX.enqueueJob(
+                                          bslmf::MovableRefUtil::move(job)));
+                      } break;
+                    }
+                }
+
+                mX.drain();
+
+                ASSERTV(LINE, count, NUM_JOBS == count);
+                ASSERTV(LINE, X.numThreads(), MAX >= X.numThreads());
+                ASSERTV(LINE, X.numThreads(), MIN <= X.numThreads());
+            }
+            ASSERTV(LINE, 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a pool, enqueue jobs, drain, and stop it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslmt::ThreadAttributes attr;
+        Obj                     mX(attr, 2, 4, 100, &ta);
+
+        ASSERT(0 == mX.start());
+
+        bsls::AtomicInt count(0);
+        for (int i = 0; i < 1000; ++i) {
+            ASSERT(0 == mX.enqueueJob(&incrementCounter, &count));
+        }
+
+        mX.drain();
+        ASSERTV(count, 1000 == count);
+
+        ASSERT(0 == mX.start());
+        for (int i = 0; i < 1000; ++i) {
+            ASSERT(0 == mX.enqueueJob(&incrementCounter, &count));
+        }
+
+        mX.stop();
+        ASSERTV(count, 2000 == count);
+        ASSERT(0 == mX.numThreads());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'bdlmt::ThreadPool'
+        //
+        // Concerns:
+        //: 1 On a fan-out heavy workload, the work-stealing pool sustains a
+        //:   higher throughput than 'bdlmt::ThreadPool', whose single queue is
+        //:   contended by all the threads.
+        //
+        // Plan:
+        //: 1 Using 'bslmt::ThroughputBenchmark', measure the number of work
+        //:   units per second, each work unit being a set of root jobs that
+        //:   fan out into leaf jobs, for both pools and for various numbers of
+        //:   pool threads.  Print the results in CSV format.
+        //:
+        //: 2 The test takes the following optional arguments:
+        //:   'numThreads' (comma-separated list of pool thread counts),
+        //:   'numClients', 'numRoots', 'width', 'busyWork', 'numMillis', and
+        //:   'numSamples'.
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH 'bdlmt::ThreadPool'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+               << "PERFORMANCE: COMPARISON WITH 'bdlmt::ThreadPool'" << endl
+               << "================================================" << endl;
+
+        bsl::vector<int> numThreads;
+        {
+            const char *spec = argc > 2 ? argv[2] : "1,2,4,8,16,32";
+            while (*spec) {
+                numThreads.push_back(atoi(spec));
+                while (*spec && ',' != *spec) {
+                    ++spec;
+                }
+                if (',' == *spec) {
+                    ++spec;
+                }
+            }
+        }
+        const int numClients = argc > 3 ? atoi(argv[3]) :    2;
+        const int numRoots   = argc > 4 ? atoi(argv[4]) :   16;
+        const int width      = argc > 5 ? atoi(argv[5]) :   64;
+        const int busyWork   = argc > 6 ? atoi(argv[6]) :   20;
+        const int numMillis  = argc > 7 ? atoi(argv[7]) :  500;
+        const int numSamples = argc > 8 ? atoi(argv[8]) :    5;
+
+        cout << "threads,ThreadPool,WorkStealingThreadPool,ratio\n";
+
+        for (bsl::size_t i = 0; i < numThreads.size(); ++i) {
+            const int NT = numThreads[i];
+
+            const double base = bench::measure<bdlmt::ThreadPool>(numClients,
+                                                                  NT,
+                                                                  numRoots,
+                                                                  width,
+                                                                  busyWork,
+                                                                  numMillis,
+                                                                  numSamples);
+            const double ws   = bench::measure<Obj>(numClients,
+                                                    NT,
+                                                    numRoots,
+                                                    width,
+                                                    busyWork,
+                                                    numMillis,
+                                                    numSamples);
+
+            cout << NT << ','
+                 << bsl::fixed << bsl::setprecision(0) << base << ','
+                 << ws << ','
+                 << bsl::setprecision(2) << (0 < base ? ws / base : 0.0)
+                 << '\n';
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
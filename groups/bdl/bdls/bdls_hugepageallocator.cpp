@@ -0,0 +1,411 @@
+// bdls_hugepageallocator.cpp                                         -*-C++-*-
+#include <bdls_hugepageallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdls_hugepageallocator_cpp,"$Id$ $CSID$")
+
+#include <bslmf_assert.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>      // 'BSLS_THROW'
+
+#include <bsl_cstring.h>             // 'bsl::memset'
+#include <bsl_new.h>                 // 'bsl::bad_alloc', placement 'new'
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Each region begins with a 'Region' header, linking it into a doubly-linked
+// list of all regions, followed by blocks.  Each block begins with a header of
+// 'k_BLOCK_HEADER_SIZE' bytes holding the size of the block (including the
+// header), so that 'deallocate' can find the free list of the block, followed
+// by the memory returned to the caller.  A free block holds, in place of its
+// size, the address of the next block on its free list.  All block sizes are
+// multiples of 'k_BLOCK_HEADER_SIZE', which is at least the maximum
+// alignment, so all blocks carved from a region are maximally aligned.
+//
+// A block whose size would exceed 'k_MAX_ARENA_BLOCK_SIZE' occupies a region
+// of its own, and its header records the size of that region, which is
+// necessarily greater than 'k_MAX_ARENA_BLOCK_SIZE'.  Such a block is
+// therefore recognized on deallocation by its size.
+//
+// Regions are reserved under the mutex, so that a burst of allocations from
+// several threads reserves a single region rather than one per thread.  This
+// is acceptable because the allocator is intended to supply relatively few,
+// relatively large, blocks to pooling allocators.
+
+namespace BloombergLP {
+namespace {
+
+typedef bsls::Types::size_type size_type;
+
+const size_type k_BLOCK_HEADER_SIZE    = 16;
+    // size of the header of each block
+
+const size_type k_REGION_HEADER_SIZE   = 32;
+    // size reserved for the header of each region
+
+const size_type k_MIN_BLOCK_SIZE       = 32;
+    // size of the smallest block
+
+const size_type k_MAX_SMALL_BLOCK_SIZE = 4096;
+    // size of the largest block rounded to a power of two; larger blocks are
+    // rounded to a multiple of 'k_GRANULE'
+
+const size_type k_GRANULE              = 4096;
+    // granularity of the sizes of blocks larger than 'k_MAX_SMALL_BLOCK_SIZE'
+
+const size_type k_MAX_ARENA_BLOCK_SIZE = 2 * 1024 * 1024;
+    // size of the largest block carved from a shared region
+
+const size_type k_MIN_REGION_SIZE      = 4 * k_MAX_ARENA_BLOCK_SIZE;
+    // minimum size of a shared region
+
+const size_type k_DEFAULT_REGION_SIZE  = 64 * 1024 * 1024;
+    // size of a shared region if none is specified
+
+BSLMF_ASSERT(bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT <= k_BLOCK_HEADER_SIZE);
+BSLMF_ASSERT(0 == k_REGION_HEADER_SIZE % k_BLOCK_HEADER_SIZE);
+
+struct FreeBlock {
+    // This 'struct' overlays a block on a free list.
+
+    // DATA
+    FreeBlock *d_next_p;  // next block on the same free list
+};
+
+size_type roundUp(size_type size, size_type granularity)
+    // Return the specified 'size' rounded up to a multiple of the specified
+    // 'granularity'.  The behavior is undefined unless 'granularity' is a
+    // power of two.
+{
+    return (size + granularity - 1) & ~(granularity - 1);
+}
+
+size_type blockSize(size_type size)
+    // Return the size of the block needed to hold the specified 'size' bytes,
+    // including the block header.  The behavior is undefined unless
+    // '0 < size <= k_MAX_ARENA_BLOCK_SIZE - k_BLOCK_HEADER_SIZE'.
+{
+    const size_type total = size + k_BLOCK_HEADER_SIZE;
+
+    if (total > k_MAX_SMALL_BLOCK_SIZE) {
+        return roundUp(total, k_GRANULE);                             // RETURN
+    }
+
+    size_type result = k_MIN_BLOCK_SIZE;
+    while (result < total) {
+        result <<= 1;
+    }
+    return result;
+}
+
+size_type largestBlockSize(size_type numBytes)
+    // Return the size of the largest block that fits in the specified
+    // 'numBytes'.  The behavior is undefined unless
+    // 'k_MIN_BLOCK_SIZE <= numBytes'.
+{
+    if (numBytes >= 2 * k_GRANULE) {
+        const size_type result = numBytes & ~(k_GRANULE - 1);
+        return result < k_MAX_ARENA_BLOCK_SIZE ? result
+                                               : k_MAX_ARENA_BLOCK_SIZE;
+                                                                      // RETURN
+    }
+
+    size_type result = k_MIN_BLOCK_SIZE;
+    while (2 * result <= numBytes) {
+        result <<= 1;
+    }
+    return result;
+}
+
+int sizeClass(size_type size)
+    // Return the index of the free list for blocks of the specified 'size'.
+    // The behavior is undefined unless 'size' is a value returned by
+    // 'blockSize' or 'largestBlockSize'.
+{
+    if (size > k_MAX_SMALL_BLOCK_SIZE) {
+        return static_cast<int>(size / k_GRANULE) + 6;                // RETURN
+    }
+
+    int result = 0;
+    while ((k_MIN_BLOCK_SIZE << result) < size) {
+        ++result;
+    }
+    return result;
+}
+
+}  // close unnamed namespace
+
+namespace bdls {
+
+                      // ================================
+                      // struct HugePageAllocator::Region
+                      // ================================
+
+struct HugePageAllocator::Region {
+    // This 'struct' defines the header of a region of memory reserved from the
+    // operating system.
+
+    // DATA
+    Region    *d_next_p;  // next region in the list
+    Region    *d_prev_p;  // previous region in the list
+    size_type  d_size;    // size of this region, including this header
+};
+
+                          // -----------------------
+                          // class HugePageAllocator
+                          // -----------------------
+
+// PRIVATE MANIPULATORS
+HugePageAllocator::Region *HugePageAllocator::allocateRegion(size_type size)
+{
+    BSLMF_ASSERT(sizeof(Region) <= k_REGION_HEADER_SIZE);
+
+    void *address = MemoryUtil::allocateRegion(size, d_hugePageMode);
+    if (!address) {
+        BSLS_THROW(bsl::bad_alloc());
+    }
+
+    const int node = k_NUMA_NODE_LOCAL == d_numaNode
+                   ? MemoryUtil::currentNumaNode()
+                   : d_numaNode;
+
+    if (0 <= node) {
+        // Binding must precede the first write to the region (here, of its
+        // header).  On failure, the region is simply left unbound.
+
+        MemoryUtil::bindToNumaNode(address, size, node);
+    }
+
+    Region *region = new (address) Region;
+    region->d_next_p = d_regions_p;
+    region->d_prev_p = 0;
+    region->d_size   = size;
+
+    if (d_regions_p) {
+        d_regions_p->d_prev_p = region;
+    }
+    d_regions_p = region;
+
+    d_numBytesReserved += size;
+
+    return region;
+}
+
+void HugePageAllocator::deallocateRegion(Region *region)
+{
+    BSLS_ASSERT(region);
+
+    if (region->d_prev_p) {
+        region->d_prev_p->d_next_p = region->d_next_p;
+    }
+    else {
+        d_regions_p = region->d_next_p;
+    }
+    if (region->d_next_p) {
+        region->d_next_p->d_prev_p = region->d_prev_p;
+    }
+
+    const size_type size = region->d_size;
+
+    d_numBytesReserved -= size;
+
+    int rc = MemoryUtil::deallocateRegion(region, size);
+    BSLS_ASSERT(0 == rc);
+    (void)rc;
+}
+
+void HugePageAllocator::retireCurrentRegion()
+{
+    while (static_cast<size_type>(d_end_p - d_cursor_p) >= k_MIN_BLOCK_SIZE) {
+        const size_type size  = largestBlockSize(d_end_p - d_cursor_p);
+        FreeBlock      *block = reinterpret_cast<FreeBlock *>(d_cursor_p);
+        void          **head  = &d_freeLists[sizeClass(size)];
+
+        block->d_next_p = static_cast<FreeBlock *>(*head);
+        *head           = block;
+
+        d_cursor_p += size;
+    }
+
+    d_cursor_p = 0;
+    d_end_p    = 0;
+}
+
+// CREATORS
+HugePageAllocator::HugePageAllocator(MemoryUtil::HugePageMode hugePageMode,
+                                     int                      numaNode,
+                                     size_type                regionSize)
+: d_hugePageMode(hugePageMode)
+, d_numaNode(numaNode)
+, d_regionSize(0)
+, d_regions_p(0)
+, d_cursor_p(0)
+, d_end_p(0)
+, d_numBytesInUse(0)
+, d_numBytesReserved(0)
+{
+    BSLS_ASSERT(k_NUMA_NODE_NONE <= numaNode);
+
+    if (0 == regionSize) {
+        regionSize = k_DEFAULT_REGION_SIZE;
+    }
+    if (regionSize < k_MIN_REGION_SIZE) {
+        regionSize = k_MIN_REGION_SIZE;
+    }
+
+    // The huge page size need not be a power of two on every platform.
+
+    const size_type hugePageSize = MemoryUtil::hugePageSize();
+    d_regionSize = (regionSize + hugePageSize - 1) / hugePageSize
+                                                                * hugePageSize;
+
+    bsl::memset(d_freeLists, 0, sizeof d_freeLists);
+}
+
+HugePageAllocator::~HugePageAllocator()
+{
+    release();
+}
+
+// MANIPULATORS
+void *HugePageAllocator::allocate(size_type size)
+{
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    if (size > k_MAX_ARENA_BLOCK_SIZE - k_BLOCK_HEADER_SIZE) {
+        // Give the block a region of its own.
+
+        const size_type hugePageSize = MemoryUtil::hugePageSize();
+        const size_type overhead     = k_REGION_HEADER_SIZE
+                                     + k_BLOCK_HEADER_SIZE;
+
+        if (size > ~size_type(0) - overhead - hugePageSize) {
+            BSLS_THROW(bsl::bad_alloc());
+        }
+
+        const size_type regionSize = (size + overhead + hugePageSize - 1)
+                                                / hugePageSize * hugePageSize;
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        char *block = reinterpret_cast<char *>(allocateRegion(regionSize))
+                    + k_REGION_HEADER_SIZE;
+
+        *reinterpret_cast<size_type *>(block) = regionSize;
+        d_numBytesInUse += regionSize;
+
+        return block + k_BLOCK_HEADER_SIZE;                           // RETURN
+    }
+
+    const size_type   rounded = blockSize(size);
+    void            **head    = &d_freeLists[sizeClass(rounded)];
+    char             *block;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (*head) {
+        FreeBlock *freeBlock = static_cast<FreeBlock *>(*head);
+        *head = freeBlock->d_next_p;
+        block = reinterpret_cast<char *>(freeBlock);
+    }
+    else {
+        if (static_cast<size_type>(d_end_p - d_cursor_p) < rounded) {
+            retireCurrentRegion();
+
+            char *region = reinterpret_cast<char *>(
+                                                 allocateRegion(d_regionSize));
+            d_cursor_p = region + k_REGION_HEADER_SIZE;
+            d_end_p    = region + d_regionSize;
+        }
+
+        block       = d_cursor_p;
+        d_cursor_p += rounded;
+    }
+
+    *reinterpret_cast<size_type *>(block) = rounded;
+    d_numBytesInUse += rounded;
+
+    return block + k_BLOCK_HEADER_SIZE;
+}
+
+void HugePageAllocator::deallocate(void *address)
+{
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    char            *block = static_cast<char *>(address)
+                           - k_BLOCK_HEADER_SIZE;
+    const size_type  size  = *reinterpret_cast<size_type *>(block);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_numBytesInUse -= size;
+
+    if (size > k_MAX_ARENA_BLOCK_SIZE) {
+        deallocateRegion(reinterpret_cast<Region *>(
+                                               block - k_REGION_HEADER_SIZE));
+        return;                                                       // RETURN
+    }
+
+    FreeBlock  *freeBlock = reinterpret_cast<FreeBlock *>(block);
+    void      **head      = &d_freeLists[sizeClass(size)];
+
+    freeBlock->d_next_p = static_cast<FreeBlock *>(*head);
+    *head               = freeBlock;
+}
+
+void HugePageAllocator::release()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    while (d_regions_p) {
+        deallocateRegion(d_regions_p);
+    }
+
+    d_cursor_p      = 0;
+    d_end_p         = 0;
+    d_numBytesInUse = 0;
+
+    bsl::memset(d_freeLists, 0, sizeof d_freeLists);
+}
+
+// ACCESSORS
+bsls::Types::Int64 HugePageAllocator::numBytesInUse() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numBytesInUse;
+}
+
+bsls::Types::Int64 HugePageAllocator::numBytesReserved() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numBytesReserved;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,381 @@
+// bdls_hugepageallocator.h                                           -*-C++-*-
+#ifndef INCLUDED_BDLS_HUGEPAGEALLOCATOR
+#define INCLUDED_BDLS_HUGEPAGEALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an arena allocator backed by huge pages on a NUMA node.
+//
+//@CLASSES:
+//  bdls::HugePageAllocator: huge-page-backed, NUMA-aware arena allocator
+//
+//@SEE_ALSO: bdls_memoryutil, bdlma_sequentialallocator, bdlma_multipool
+//
+//@DESCRIPTION: This component provides a thread-safe allocator,
+// 'bdls::HugePageAllocator', that implements the 'bdlma::ManagedAllocator'
+// protocol and obtains its memory directly from the operating system, in
+// large regions backed (where supported) by huge pages and bound to a NUMA
+// node:
+//..
+//   ,-----------------------.
+//  ( bdls::HugePageAllocator )
+//   `-----------------------'
+//               |        ctor/dtor
+//               |        hugePageMode
+//               |        numaNode
+//               |        numBytesInUse
+//               |        numBytesReserved
+//               |        regionSize
+//               V
+//   ,-----------------------.
+//  ( bdlma::ManagedAllocator )
+//   `-----------------------'
+//               |        release
+//               V
+//       ,----------------.
+//      ( bslma::Allocator )
+//       `----------------'
+//                        allocate
+//                        deallocate
+//..
+// A process having a large, long-lived heap spends a measurable share of its
+// cycles servicing TLB misses when that heap is backed by regular (e.g., 4KB)
+// pages.  Backing the heap with huge pages (e.g., 2MB on Linux/x86-64)
+// divides the number of TLB entries needed to map it by the ratio of the page
+// sizes.  On a multi-socket machine, keeping the heap of a thread on the
+// thread's own NUMA node additionally avoids the latency of remote memory
+// accesses.
+//
+// 'bdls::HugePageAllocator' is intended to be the upstream allocator of
+// allocators such as 'bdlma::SequentialAllocator' and 'bdlma::Multipool',
+// which request relatively few, relatively large, blocks of memory and carve
+// them into objects, so that all objects managed by those allocators reside on
+// huge pages.  It can also be used directly, but it is not optimized for
+// dispensing large numbers of small blocks.
+//
+///Regions and Blocks
+///------------------
+// The allocator reserves address space from the operating system in
+// *regions* of (at least) 'regionSize()' bytes, each aligned on a huge page
+// boundary, using 'bdls::MemoryUtil::allocateRegion'.  Physical memory is
+// committed to a region only as it is first written, so reserving a large
+// region is inexpensive.  Blocks are carved from the most recently reserved
+// region in sizes rounded up to a power of two (for small blocks) or to a
+// multiple of 4KB (for blocks of up to 2MB).  Deallocated blocks are kept on a
+// free list for their rounded size and reused by subsequent allocations of
+// that size; memory of a region is not returned to the operating system
+// until 'release' is called or the allocator is destroyed.  A block larger
+// than 2MB is given a region of its own, which is returned to the operating
+// system when the block is deallocated.
+//
+///Huge Pages
+///----------
+// The kind of pages backing each region is chosen by the
+// 'bdls::MemoryUtil::HugePageMode' supplied at construction:
+//
+//: 'k_HUGE_PAGES_TRANSPARENT' (the default):
+//:   Regions are marked as eligible for transparent huge pages, which the
+//:   operating system uses on a best-effort basis (on Linux, this requires
+//:   '/sys/kernel/mm/transparent_hugepage/enabled' to be 'always' or
+//:   'madvise').
+//:
+//: 'k_HUGE_PAGES_EXPLICIT':
+//:   Regions are obtained from the pool of explicit huge pages reserved by
+//:   the system administrator, falling back to transparent huge pages when
+//:   the pool is exhausted.
+//:
+//: 'k_HUGE_PAGES_NONE':
+//:   Regions are backed by regular pages.
+//
+///NUMA Binding
+///------------
+// The NUMA node supplied at construction determines where the physical
+// memory of each region is placed:
+//
+//: 'k_NUMA_NODE_LOCAL' (the default):
+//:   Each region is bound to the NUMA node of the processor running the thread
+//:   that causes the region to be reserved.  This is appropriate when each
+//:   allocator is used predominantly by a single thread (or by threads running
+//:   on a single node).
+//:
+//: 'k_NUMA_NODE_NONE':
+//:   Regions are not bound, and each page is placed by the operating system
+//:   according to the thread's memory policy (on Linux, by default, on the
+//:   node of the thread that first writes to it).
+//:
+//: A non-negative node index:
+//:   Each region is bound to the specified NUMA node.
+//
+// Binding sets the *preferred* node of the region: physical memory is taken
+// from other nodes if the preferred node is out of memory.  On platforms that
+// do not support NUMA binding, regions are not bound.
+//
+///Thread Safety
+///-------------
+// 'bdls::HugePageAllocator' is *fully thread-safe*, meaning any operation on
+// the same object can be safely invoked from any thread, except for 'release'
+// and destruction, which must not be called concurrently with other
+// operations on the same object.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Backing a Multipool with Huge Pages
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a process maintains a large order book, composed of many small
+// nodes allocated from a 'bdlma::Multipool'.  Accesses to the nodes are
+// scattered across the whole book, so that the process incurs a TLB miss on
+// nearly every access unless the book resides on huge pages.
+//
+// First, we create a 'bdls::HugePageAllocator' that reserves memory backed by
+// transparent huge pages on the NUMA node of the current thread (the
+// default):
+//..
+//  bdls::HugePageAllocator hugePageAllocator;
+//..
+// Then, we create a multipool that obtains its memory from
+// 'hugePageAllocator':
+//..
+//  bdlma::Multipool multipool(&hugePageAllocator);
+//..
+// Next, we allocate many small nodes from the multipool:
+//..
+//  bsl::vector<void *> nodes;
+//  for (int i = 0; i < 100000; ++i) {
+//      nodes.push_back(multipool.allocate(48));
+//  }
+//..
+// Now, we observe that the memory of the nodes was obtained from
+// 'hugePageAllocator', in regions whose total size is a multiple of the huge
+// page size:
+//..
+//  const bsls::Types::Int64 numBytesInUse = hugePageAllocator.numBytesInUse();
+//
+//  assert(numBytesInUse >= 100000 * 48);
+//  assert(0 == hugePageAllocator.numBytesReserved()
+//                                        % bdls::MemoryUtil::hugePageSize());
+//..
+// Finally, we release the nodes, returning their memory to
+// 'hugePageAllocator', which keeps its regions for reuse until it is
+// destroyed:
+//..
+//  multipool.release();
+//
+//  assert(hugePageAllocator.numBytesInUse() < numBytesInUse / 100);
+//  assert(hugePageAllocator.numBytesReserved() > 0);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdls_memoryutil.h>
+
+#include <bdlma_managedallocator.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdls {
+
+                          // =======================
+                          // class HugePageAllocator
+                          // =======================
+
+class HugePageAllocator : public bdlma::ManagedAllocator {
+    // This class implements the 'bdlma::ManagedAllocator' protocol to provide
+    // a thread-safe allocator that obtains memory directly from the operating
+    // system in large regions backed, where supported, by huge pages and bound
+    // to a NUMA node.
+
+  public:
+    // TYPES
+    enum {
+        k_NUMA_NODE_LOCAL = -1,  // bind each region to the node of the thread
+                                 // reserving it
+
+        k_NUMA_NODE_NONE  = -2   // do not bind regions
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Region;  // header of a region of memory obtained from the system
+
+    enum {
+        k_NUM_SIZE_CLASSES = 8 + 511  // powers of two from 32 to 4096 bytes,
+                                      // and multiples of 4096 bytes from 8192
+                                      // to 2MB
+    };
+
+    // DATA
+    MemoryUtil::HugePageMode  d_hugePageMode;      // kind of pages backing
+                                                   // regions
+
+    int                       d_numaNode;          // node to which regions
+                                                   // are bound, or a
+                                                   // 'k_NUMA_NODE_*' value
+
+    bsls::Types::size_type    d_regionSize;        // size of the regions
+                                                   // from which blocks are
+                                                   // carved
+
+    Region                   *d_regions_p;         // list of all regions
+
+    char                     *d_cursor_p;          // next free byte in the
+                                                   // current region
+
+    char                     *d_end_p;             // end of the current
+                                                   // region
+
+    void                     *d_freeLists[k_NUM_SIZE_CLASSES];
+                                                   // free blocks, by size
+
+    bsls::Types::Int64        d_numBytesInUse;     // bytes in allocated blocks
+
+    bsls::Types::Int64        d_numBytesReserved;  // bytes in regions
+
+    mutable bslmt::Mutex      d_mutex;             // protects all of the
+                                                   // above, other than the
+                                                   // configuration
+
+  private:
+    // NOT IMPLEMENTED
+    HugePageAllocator(const HugePageAllocator&);
+    HugePageAllocator& operator=(const HugePageAllocator&);
+
+    // PRIVATE MANIPULATORS
+    Region *allocateRegion(bsls::Types::size_type size);
+        // Reserve a region of the specified 'size' bytes from the operating
+        // system, bind it to the configured NUMA node, add it to the list of
+        // regions, and return its address.  Throw 'bsl::bad_alloc' if the
+        // region cannot be reserved.  The behavior is undefined unless 'size'
+        // is a multiple of 'MemoryUtil::hugePageSize()' and 'd_mutex' is
+        // locked.
+
+    void deallocateRegion(Region *region);
+        // Remove the specified 'region' from the list of regions and return it
+        // to the operating system.  The behavior is undefined unless 'd_mutex'
+        // is locked.
+
+    void retireCurrentRegion();
+        // Place the unused memory remaining in the current region on the free
+        // lists, leaving no current region.  The behavior is undefined unless
+        // 'd_mutex' is locked.
+
+  public:
+    // CREATORS
+    explicit
+    HugePageAllocator(
+          MemoryUtil::HugePageMode hugePageMode =
+                                          MemoryUtil::k_HUGE_PAGES_TRANSPARENT,
+          int                      numaNode     = k_NUMA_NODE_LOCAL,
+          bsls::Types::size_type   regionSize   = 0);
+        // Create a huge page allocator.  Optionally specify a 'hugePageMode'
+        // indicating the kind of pages backing the memory of this allocator;
+        // if 'hugePageMode' is not specified, transparent huge pages are used.
+        // Optionally specify a 'numaNode' indicating the NUMA node to which
+        // the memory is bound, or 'k_NUMA_NODE_LOCAL' to bind each region to
+        // the node of the thread reserving it, or 'k_NUMA_NODE_NONE' to not
+        // bind the memory; if 'numaNode' is not specified,
+        // 'k_NUMA_NODE_LOCAL' is used.  Optionally specify a 'regionSize',
+        // the minimum size of the regions reserved from the operating system;
+        // if 'regionSize' is not specified or is 0, an implementation-defined
+        // value is used.  The region size is rounded up to a multiple of
+        // 'MemoryUtil::hugePageSize()' and to an implementation-defined
+        // minimum.  The behavior is undefined unless
+        // 'k_NUMA_NODE_NONE <= numaNode'.
+
+    virtual ~HugePageAllocator();
+        // Destroy this allocator, and return all memory reserved by it to the
+        // operating system.
+
+    // MANIPULATORS
+    virtual void *allocate(bsls::Types::size_type size);
+        // Return the address of a contiguous block of maximally-aligned memory
+        // of (at least) the specified 'size' (in bytes).  If 'size' is 0, no
+        // memory is allocated and 0 is returned.  Throw 'bsl::bad_alloc' if
+        // the memory cannot be obtained from the operating system.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to this
+        // allocator.  If 'address' is 0, this method has no effect.  The
+        // behavior is undefined unless 'address' was allocated using this
+        // allocator object and has not already been deallocated.
+
+    virtual void release();
+        // Relinquish all memory currently allocated via this allocator, and
+        // return all regions to the operating system.
+
+    // ACCESSORS
+    MemoryUtil::HugePageMode hugePageMode() const;
+        // Return the kind of pages requested for the memory of this allocator.
+
+    int numaNode() const;
+        // Return the NUMA node to which the memory of this allocator is bound,
+        // 'k_NUMA_NODE_LOCAL' if each region is bound to the node of the
+        // thread reserving it, or 'k_NUMA_NODE_NONE' if the memory is not
+        // bound.
+
+    bsls::Types::Int64 numBytesInUse() const;
+        // Return the number of bytes in the blocks currently allocated from
+        // this allocator, including the rounding and bookkeeping overhead of
+        // each block.
+
+    bsls::Types::Int64 numBytesReserved() const;
+        // Return the number of bytes in the regions currently reserved from
+        // the operating system by this allocator.
+
+    bsls::Types::size_type regionSize() const;
+        // Return the minimum size of the regions reserved from the operating
+        // system by this allocator.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class HugePageAllocator
+                          // -----------------------
+
+// ACCESSORS
+inline
+MemoryUtil::HugePageMode HugePageAllocator::hugePageMode() const
+{
+    return d_hugePageMode;
+}
+
+inline
+int HugePageAllocator::numaNode() const
+{
+    return d_numaNode;
+}
+
+inline
+bsls::Types::size_type HugePageAllocator::regionSize() const
+{
+    return d_regionSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
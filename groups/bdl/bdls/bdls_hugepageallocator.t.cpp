@@ -0,0 +1,967 @@
+// bdls_hugepageallocator.t.cpp                                       -*-C++-*-
+#include <bdls_hugepageallocator.h>
+
+#include <bdls_memoryutil.h>
+
+#include <bdlma_multipool.h>
+#include <bdlma_sequentialallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadgroup.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a managed allocator,
+// 'bdls::HugePageAllocator', that carves blocks from large regions of memory
+// obtained from 'bdls::MemoryUtil::allocateRegion'.  We must verify that the
+// allocator is configured as specified at construction, that it dispenses
+// maximally-aligned, usable blocks of every size, that deallocated blocks
+// are reused, that blocks too large for a shared region are given regions of
+// their own that are returned to the system on deallocation, that the unused
+// tail of an exhausted region is reused for smaller blocks, that 'release'
+// and the destructor return all regions to the system, and that the allocator
+// can be used concurrently.  Whether the memory is actually backed by huge
+// pages, and on which NUMA node, depends on the configuration of the host and
+// cannot be verified portably; we verify only that each mode and binding
+// produces usable memory.
+//
+// In addition to positive test cases (run in the nightly builds), a negative
+// test case -1 can be run manually to measure the effect of huge pages on the
+// cost of random accesses to a large array.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] HugePageAllocator(mode = TRANSPARENT, numaNode = LOCAL, size = 0);
+// [ 6] ~HugePageAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(bsls::Types::size_type size);
+// [ 3] void deallocate(void *address);
+// [ 6] void release();
+//
+// ACCESSORS
+// [ 2] MemoryUtil::HugePageMode hugePageMode() const;
+// [ 2] int numaNode() const;
+// [ 3] bsls::Types::Int64 numBytesInUse() const;
+// [ 3] bsls::Types::Int64 numBytesReserved() const;
+// [ 2] bsls::Types::size_type regionSize() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] LARGE BLOCKS
+// [ 5] REGION EXHAUSTION
+// [ 7] HUGE PAGE MODES AND NUMA BINDING
+// [ 8] CONCURRENCY
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE: RANDOM ACCESS
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdls::HugePageAllocator Obj;
+typedef bdls::MemoryUtil        MU;
+typedef bsls::Types::size_type  size_type;
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+const size_type k_MB = 1024 * 1024;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bool isMaximallyAligned(const void *address)
+    // Return 'true' if the specified 'address' is maximally aligned, and
+    // 'false' otherwise.
+{
+    return 0 == reinterpret_cast<bsls::Types::UintPtr>(address)
+                                % bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+}
+
+size_type roundUpToHugePage(size_type size)
+    // Return the specified 'size' rounded up to a multiple of the huge page
+    // size.
+{
+    const size_type hugePageSize = MU::hugePageSize();
+    return (size + hugePageSize - 1) / hugePageSize * hugePageSize;
+}
+
+class Worker {
+    // This class provides a functor that repeatedly allocates blocks of
+    // pseudo-random sizes, fills them with a pattern, and verifies and
+    // deallocates them.
+
+    // DATA
+    Obj             *d_allocator_p;   // allocator under test
+    int              d_numIterations; // number of blocks to allocate
+    unsigned int     d_seed;          // initial random seed
+    bsls::AtomicInt *d_numErrors_p;   // number of corrupted blocks seen
+
+  public:
+    // CREATORS
+    Worker(Obj             *allocator,
+           int              numIterations,
+           unsigned int     seed,
+           bsls::AtomicInt *numErrors)
+        // Create a functor using the specified 'allocator', 'numIterations',
+        // 'seed', and 'numErrors'.
+    : d_allocator_p(allocator)
+    , d_numIterations(numIterations)
+    , d_seed(seed)
+    , d_numErrors_p(numErrors)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Run 'd_numIterations' iterations, keeping up to 16 blocks live.
+    {
+        enum { k_NUM_LIVE = 16 };
+
+        unsigned char *blocks[k_NUM_LIVE] = { 0 };
+        int            sizes[k_NUM_LIVE]  = { 0 };
+
+        unsigned int seed = d_seed;
+        for (int i = 0; i < d_numIterations; ++i) {
+            seed = seed * 1103515245 + 12345;
+
+            const int slot = static_cast<int>((seed >> 8) % k_NUM_LIVE);
+            if (blocks[slot]) {
+                for (int j = 0; j < sizes[slot]; ++j) {
+                    if (blocks[slot][j] != static_cast<unsigned char>(
+                                                           sizes[slot] + j)) {
+                        ++*d_numErrors_p;
+                        break;
+                    }
+                }
+                d_allocator_p->deallocate(blocks[slot]);
+            }
+
+            // Mostly small blocks, with the occasional large one.
+
+            const int size = 0 == (seed >> 20) % 64
+                           ? static_cast<int>((seed >> 12) % 65536) + 1
+                           : static_cast<int>((seed >> 12) % 512) + 1;
+
+            blocks[slot] = static_cast<unsigned char *>(
+                                               d_allocator_p->allocate(size));
+            sizes[slot]  = size;
+            for (int j = 0; j < size; ++j) {
+                blocks[slot][j] = static_cast<unsigned char>(size + j);
+            }
+        }
+
+        for (int i = 0; i < k_NUM_LIVE; ++i) {
+            d_allocator_p->deallocate(blocks[i]);
+        }
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // The allocator under test obtains no memory from the default allocator.
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Backing a Multipool with Huge Pages
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a process maintains a large order book, composed of many small
+// nodes allocated from a 'bdlma::Multipool'.  Accesses to the nodes are
+// scattered across the whole book, so that the process incurs a TLB miss on
+// nearly every access unless the book resides on huge pages.
+//
+// First, we create a 'bdls::HugePageAllocator' that reserves memory backed by
+// transparent huge pages on the NUMA node of the current thread (the
+// default):
+//..
+    bdls::HugePageAllocator hugePageAllocator;
+//..
+// Then, we create a multipool that obtains its memory from
+// 'hugePageAllocator':
+//..
+    bdlma::Multipool multipool(&hugePageAllocator);
+//..
+// Next, we allocate many small nodes from the multipool:
+//..
+    bsl::vector<void *> nodes;
+    for (int i = 0; i < 100000; ++i) {
+        nodes.push_back(multipool.allocate(48));
+    }
+//..
+// Now, we observe that the memory of the nodes was obtained from
+// 'hugePageAllocator', in regions whose total size is a multiple of the huge
+// page size:
+//..
+    const bsls::Types::Int64 numBytesInUse = hugePageAllocator.numBytesInUse();
+
+    ASSERT(numBytesInUse >= 100000 * 48);
+    ASSERT(0 == hugePageAllocator.numBytesReserved()
+                                          % bdls::MemoryUtil::hugePageSize());
+//..
+// Finally, we release the nodes, returning their memory to
+// 'hugePageAllocator', which keeps its regions for reuse until it is
+// destroyed:
+//..
+    multipool.release();
+
+    ASSERT(hugePageAllocator.numBytesInUse() < numBytesInUse / 100);
+    ASSERT(hugePageAllocator.numBytesReserved() > 0);
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 The allocator can be used concurrently by several threads,
+        //:   without any block being handed out twice (which would corrupt
+        //:   its contents).
+        //:
+        //: 2 All blocks are accounted for once the threads are done.
+        //
+        // Plan:
+        //: 1 Run several threads that each repeatedly allocate blocks of
+        //:   pseudo-random sizes, fill them with a pattern, and later verify
+        //:   and deallocate them.  (C-1)
+        //:
+        //: 2 Verify that no bytes are in use after the threads are joined.
+        //:   (C-2)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCURRENCY"
+                          << "\n===========" << endl;
+
+        enum { k_NUM_THREADS = 6, k_NUM_ITERATIONS = 20000 };
+
+        Obj mX;  const Obj& X = mX;
+
+        bsls::AtomicInt    numErrors(0);
+        bslmt::ThreadGroup group;
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            group.addThread(Worker(&mX, k_NUM_ITERATIONS, i * 7919 + 3,
+                                   &numErrors));
+        }
+        group.joinAll();
+
+        ASSERTV(numErrors, 0 == numErrors);
+        ASSERTV(X.numBytesInUse(), 0 == X.numBytesInUse());
+        ASSERT(0 < X.numBytesReserved());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // HUGE PAGE MODES AND NUMA BINDING
+        //
+        // Concerns:
+        //: 1 Every huge page mode yields usable memory, whether or not the
+        //:   host provides huge pages of that kind.
+        //:
+        //: 2 Every NUMA binding yields usable memory, whether or not the host
+        //:   supports NUMA binding.
+        //
+        // Plan:
+        //: 1 For each huge page mode and each of 'k_NUMA_NODE_LOCAL',
+        //:   'k_NUMA_NODE_NONE', and the node of the current thread (if
+        //:   known), create an allocator and write to every byte of a small
+        //:   and of a large block.  (C-1..2)
+        //
+        // Testing:
+        //   HUGE PAGE MODES AND NUMA BINDING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nHUGE PAGE MODES AND NUMA BINDING"
+                          << "\n================================" << endl;
+
+        const MU::HugePageMode MODES[] = { MU::k_HUGE_PAGES_NONE,
+                                           MU::k_HUGE_PAGES_TRANSPARENT,
+                                           MU::k_HUGE_PAGES_EXPLICIT };
+        const int NUM_MODES = sizeof MODES / sizeof *MODES;
+
+        const int currentNode = MU::currentNumaNode();
+        if (veryVerbose) { P_(MU::hugePageSize()) P(currentNode) }
+
+        const int NODES[] = { Obj::k_NUMA_NODE_LOCAL,
+                              Obj::k_NUMA_NODE_NONE,
+                              currentNode };
+        const int NUM_NODES = 0 <= currentNode ? 3 : 2;
+
+        for (int ti = 0; ti < NUM_MODES; ++ti) {
+            for (int tj = 0; tj < NUM_NODES; ++tj) {
+                const MU::HugePageMode MODE = MODES[ti];
+                const int              NODE = NODES[tj];
+
+                Obj mX(MODE, NODE);  const Obj& X = mX;
+
+                ASSERTV(ti, tj, MODE == X.hugePageMode());
+                ASSERTV(ti, tj, NODE == X.numaNode());
+
+                char *p = static_cast<char *>(mX.allocate(100000));
+                char *q = static_cast<char *>(mX.allocate(5 * k_MB));
+
+                bsl::memset(p, 'p', 100000);
+                bsl::memset(q, 'q', 5 * k_MB);
+
+                ASSERTV(ti, tj, 'p' == p[99999]);
+                ASSERTV(ti, tj, 'q' == q[5 * k_MB - 1]);
+
+                mX.deallocate(p);
+                mX.deallocate(q);
+            }
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'release' AND DESTRUCTOR
+        //
+        // Concerns:
+        //: 1 'release' returns all regions to the system, and leaves no bytes
+        //:   in use.
+        //:
+        //: 2 The allocator is fully usable after 'release'.
+        //:
+        //: 3 The destructor returns all regions to the system, whether or not
+        //:   blocks are still allocated.
+        //
+        // Plan:
+        //: 1 Allocate small and large blocks, call 'release', and verify the
+        //:   statistics.  (C-1)
+        //:
+        //: 2 Allocate blocks again, and verify that they are usable.  (C-2)
+        //:
+        //: 3 Destroy allocators with outstanding blocks.  The absence of leaks
+        //:   is verified by running the test case under a leak checker or by
+        //:   observing the address space of the process: the test case
+        //:   repeats the cycle enough times (reserving, in total, far more
+        //:   address space than a 32-bit process has) that a leak would cause
+        //:   allocation to fail.  (C-3)
+        //
+        // Testing:
+        //   void release();
+        //   ~HugePageAllocator();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\n'release' AND DESTRUCTOR"
+                          << "\n========================" << endl;
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            for (int i = 0; i < 100; ++i) {
+                mX.allocate(1000);
+            }
+            mX.allocate(10 * k_MB);
+            ASSERT(0 < X.numBytesInUse());
+            ASSERT(static_cast<bsls::Types::Int64>(
+                      X.regionSize() + roundUpToHugePage(10 * k_MB + 48))
+                                                      == X.numBytesReserved());
+
+            mX.release();
+            ASSERT(0 == X.numBytesInUse());
+            ASSERT(0 == X.numBytesReserved());
+
+            mX.release();
+            ASSERT(0 == X.numBytesInUse());
+            ASSERT(0 == X.numBytesReserved());
+
+            char *p = static_cast<char *>(mX.allocate(1000));
+            bsl::memset(p, 1, 1000);
+            ASSERT(X.regionSize() == static_cast<size_type>(
+                                                       X.numBytesReserved()));
+        }
+
+        for (int i = 0; i < 100; ++i) {
+            Obj mX(MU::k_HUGE_PAGES_TRANSPARENT,
+                   Obj::k_NUMA_NODE_NONE,
+                   64 * k_MB);
+
+            bsl::memset(mX.allocate(64), 1, 64);
+            bsl::memset(mX.allocate(3 * k_MB), 1, 64);
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // REGION EXHAUSTION
+        //
+        // Concerns:
+        //: 1 When the current region cannot hold a block, a new region is
+        //:   reserved.
+        //:
+        //: 2 The unused tail of the exhausted region is used to satisfy
+        //:   subsequent requests for smaller blocks, rather than being
+        //:   wasted.
+        //
+        // Plan:
+        //: 1 Using the minimum region size, allocate 2MB blocks until a second
+        //:   region is reserved.  (C-1)
+        //:
+        //: 2 Allocate blocks of decreasing sizes that together fill the tail
+        //:   of the first region, and verify that no further region is
+        //:   reserved.  (C-2)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nREGION EXHAUSTION"
+                          << "\n=================" << endl;
+
+        Obj mX(MU::k_HUGE_PAGES_TRANSPARENT, Obj::k_NUMA_NODE_NONE, 1);
+        const Obj& X = mX;
+
+        const size_type REGION_SIZE = X.regionSize();
+        if (veryVerbose) { P(REGION_SIZE) }
+
+        ASSERT(8 * k_MB <= REGION_SIZE);
+
+        // Each block occupies exactly 2MB, and the region header makes the
+        // last 2MB of the region unusable for such a block.
+
+        const size_type NUM_BLOCKS = REGION_SIZE / (2 * k_MB) - 1;
+
+        char *last = 0;
+        for (size_type i = 0; i < NUM_BLOCKS; ++i) {
+            char *p = static_cast<char *>(mX.allocate(2 * k_MB - 16));
+            ASSERTV(i, 0 == last || last + 2 * k_MB == p);
+            last = p;
+        }
+        ASSERT(REGION_SIZE == static_cast<size_type>(X.numBytesReserved()));
+
+        mX.allocate(2 * k_MB - 16);
+        ASSERT(2 * REGION_SIZE == static_cast<size_type>(
+                                                       X.numBytesReserved()));
+
+        // The tail is '2MB - 32' bytes: 511 pages, plus 4064 bytes, which hold
+        // blocks of 2048, 1024, 512, 256, 128, 64, and 32 bytes.  These blocks
+        // are carved in order from the tail of the first region, directly
+        // after the last 2MB block.
+
+        const size_type SIZES[] = {
+                                511 * 4096, 2048, 1024, 512, 256, 128, 64, 32
+                                  };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        char *expected = last + 2 * k_MB;
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            char *p = static_cast<char *>(mX.allocate(SIZES[i] - 16));
+            ASSERTV(i, expected == p);
+            bsl::memset(p, 0xff, SIZES[i] - 16);
+
+            expected = p + SIZES[i];
+        }
+        ASSERT(2 * REGION_SIZE == static_cast<size_type>(
+                                                       X.numBytesReserved()));
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // LARGE BLOCKS
+        //
+        // Concerns:
+        //: 1 A block too large to be carved from a shared region is given a
+        //:   region of its own, of the smallest sufficient multiple of the
+        //:   huge page size.
+        //:
+        //: 2 Such a block is usable, and maximally aligned.
+        //:
+        //: 3 Deallocating such a block returns its region to the system.
+        //
+        // Plan:
+        //: 1 Allocate blocks of sizes around the threshold and well above it,
+        //:   write to every byte, and verify the statistics after allocation
+        //:   and deallocation.  (C-1..3)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nLARGE BLOCKS"
+                          << "\n============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        const size_type SIZES[] = { 2 * k_MB - 16,
+                                    2 * k_MB - 15,
+                                    2 * k_MB,
+                                    4 * k_MB,
+                                    4 * k_MB - 48,
+                                    4 * k_MB - 47,
+                                    100 * k_MB + 1 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        // Reserve the shared region first.
+
+        mX.deallocate(mX.allocate(1));
+        const size_type SHARED = X.regionSize();
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const size_type SIZE  = SIZES[i];
+            const bool      OWN   = SIZE > 2 * k_MB - 16;
+            const size_type BYTES = OWN ? roundUpToHugePage(SIZE + 48)
+                                        : 2 * k_MB;
+
+            if (veryVerbose) { T_ P_(SIZE) P(BYTES) }
+
+            char *p = static_cast<char *>(mX.allocate(SIZE));
+            ASSERTV(i, isMaximallyAligned(p));
+            bsl::memset(p, 0x5a, SIZE);
+
+            ASSERTV(i, static_cast<bsls::Types::Int64>(BYTES) ==
+                                                          X.numBytesInUse());
+            ASSERTV(i, SHARED + (OWN ? BYTES : 0) ==
+                              static_cast<size_type>(X.numBytesReserved()));
+
+            mX.deallocate(p);
+
+            ASSERTV(i, 0 == X.numBytesInUse());
+            ASSERTV(i, SHARED == static_cast<size_type>(
+                                                       X.numBytesReserved()));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE, DEALLOCATE, AND STATISTICS
+        //
+        // Concerns:
+        //: 1 Allocating 0 bytes returns 0, and deallocating 0 has no effect.
+        //:
+        //: 2 Blocks of every size are maximally aligned, do not overlap, and
+        //:   are usable.
+        //:
+        //: 3 Each block occupies the documented rounded size, as reported by
+        //:   'numBytesInUse'.
+        //:
+        //: 4 A deallocated block is reused by the next allocation of the same
+        //:   rounded size.
+        //:
+        //: 5 A single region is reserved for all blocks that fit in it, and
+        //:   no memory is obtained from the default allocator.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate 0.  (C-1)
+        //:
+        //: 2 Allocate blocks of a range of sizes, filling each with a
+        //:   distinct value, and verify the alignment, the statistics, and,
+        //:   after all are allocated, the contents.  (C-2..3, 5)
+        //:
+        //: 3 Deallocate each block and allocate a block of a different size
+        //:   having the same rounded size, and verify the address.  (C-4)
+        //
+        // Testing:
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        //   bsls::Types::Int64 numBytesInUse() const;
+        //   bsls::Types::Int64 numBytesReserved() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nALLOCATE, DEALLOCATE, AND STATISTICS"
+                          << "\n====================================" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(0 == mX.allocate(0));
+        mX.deallocate(0);
+        ASSERT(0 == X.numBytesInUse());
+        ASSERT(0 == X.numBytesReserved());
+
+        struct {
+            int d_line;
+            int d_size;
+            int d_rounded;  // size of the block, including the header
+            int d_other;    // another size having the same rounded size
+        } DATA[] = {
+            //LINE    SIZE   ROUNDED    OTHER
+            //----  -------  -------  -------
+            { L_,         1,      32,      16 },
+            { L_,        16,      32,       8 },
+            { L_,        17,      64,      48 },
+            { L_,        48,      64,      33 },
+            { L_,        49,     128,     100 },
+            { L_,      1000,    1024,    1008 },
+            { L_,      4080,    4096,    2100 },
+            { L_,      4081,    8192,    8176 },
+            { L_,      8177,   12288,   12000 },
+            { L_,    100000,  102400,  100001 },
+            { L_,   2097136, 2097152, 2093057 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        char               *blocks[NUM_DATA];
+        bsls::Types::Int64  expected = 0;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE    = DATA[ti].d_line;
+            const int SIZE    = DATA[ti].d_size;
+            const int ROUNDED = DATA[ti].d_rounded;
+
+            blocks[ti] = static_cast<char *>(mX.allocate(SIZE));
+            expected  += ROUNDED;
+
+            ASSERTV(LINE, isMaximallyAligned(blocks[ti]));
+            ASSERTV(LINE, expected, X.numBytesInUse(),
+                    expected == X.numBytesInUse());
+            ASSERTV(LINE, X.regionSize() == static_cast<size_type>(
+                                                       X.numBytesReserved()));
+
+            bsl::memset(blocks[ti], ti, SIZE);
+        }
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+            const int SIZE = DATA[ti].d_size;
+
+            for (int i = 0; i < SIZE; ++i) {
+                if (ti != blocks[ti][i]) {
+                    ASSERTV(LINE, i, ti == blocks[ti][i]);
+                    break;
+                }
+            }
+        }
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE    = DATA[ti].d_line;
+            const int ROUNDED = DATA[ti].d_rounded;
+            const int OTHER   = DATA[ti].d_other;
+
+            mX.deallocate(blocks[ti]);
+            expected -= ROUNDED;
+            ASSERTV(LINE, expected == X.numBytesInUse());
+
+            void *p = mX.allocate(OTHER);
+            ASSERTV(LINE, blocks[ti] == p);
+            mX.deallocate(p);
+        }
+
+        ASSERT(0 == X.numBytesInUse());
+        ASSERT(0 == defaultAllocator.numAllocations());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructor uses the documented defaults.
+        //:
+        //: 2 The constructor stores the specified huge page mode and NUMA
+        //:   node.
+        //:
+        //: 3 The region size is rounded up to a multiple of the huge page size
+        //:   and to the minimum region size.
+        //:
+        //: 4 No memory is reserved until the first allocation.
+        //
+        // Plan:
+        //: 1 Create objects with various arguments, and verify the accessors.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   HugePageAllocator(mode = TRANSPARENT, numaNode = LOCAL, size = 0);
+        //   MemoryUtil::HugePageMode hugePageMode() const;
+        //   int numaNode() const;
+        //   bsls::Types::size_type regionSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCREATORS AND BASIC ACCESSORS"
+                          << "\n============================" << endl;
+
+        const size_type HUGE_PAGE_SIZE = MU::hugePageSize();
+        if (veryVerbose) { P(HUGE_PAGE_SIZE) }
+
+        ASSERT(0 == HUGE_PAGE_SIZE % MU::pageSize());
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(MU::k_HUGE_PAGES_TRANSPARENT == X.hugePageMode());
+            ASSERT(Obj::k_NUMA_NODE_LOCAL       == X.numaNode());
+            ASSERT(0 <  X.regionSize());
+            ASSERT(0 == X.regionSize() % HUGE_PAGE_SIZE);
+            ASSERT(0 == X.numBytesInUse());
+            ASSERT(0 == X.numBytesReserved());
+        }
+
+        const size_type SIZES[] = { 1,
+                                    8 * k_MB - 1,
+                                    8 * k_MB,
+                                    8 * k_MB + 1,
+                                    100 * k_MB,
+                                    1024 * k_MB };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const size_type SIZE     = SIZES[ti] < 8 * k_MB ? 8 * k_MB
+                                                            : SIZES[ti];
+            const size_type EXPECTED = roundUpToHugePage(SIZE);
+
+            Obj mX(MU::k_HUGE_PAGES_NONE, 3, SIZES[ti]);  const Obj& X = mX;
+
+            ASSERTV(ti, MU::k_HUGE_PAGES_NONE == X.hugePageMode());
+            ASSERTV(ti, 3                     == X.numaNode());
+            ASSERTV(ti, EXPECTED, X.regionSize(),
+                    EXPECTED == X.regionSize());
+            ASSERTV(ti, 0 == X.numBytesReserved());
+        }
+
+        {
+            Obj mX(MU::k_HUGE_PAGES_EXPLICIT, Obj::k_NUMA_NODE_NONE);
+            const Obj& X = mX;
+
+            ASSERT(MU::k_HUGE_PAGES_EXPLICIT == X.hugePageMode());
+            ASSERT(Obj::k_NUMA_NODE_NONE     == X.numaNode());
+        }
+
+        ASSERT(0 == defaultAllocator.numAllocations());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate, use, and deallocate blocks of several sizes, and use
+        //:   the allocator as the upstream allocator of a sequential
+        //:   allocator.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        void *p = mX.allocate(10);
+        void *q = mX.allocate(10000);
+        void *r = mX.allocate(10 * k_MB);
+        bsl::memset(p, 1, 10);
+        bsl::memset(q, 2, 10000);
+        bsl::memset(r, 3, 10 * k_MB);
+
+        mX.deallocate(q);
+        ASSERT(q == mX.allocate(10000));
+
+        mX.deallocate(p);
+        mX.deallocate(q);
+        mX.deallocate(r);
+        ASSERT(0 == X.numBytesInUse());
+
+        {
+            bdlma::SequentialAllocator sa(&mX);
+
+            bsl::vector<int> v(&sa);
+            for (int i = 0; i < 100000; ++i) {
+                v.push_back(i);
+            }
+            ASSERT(0 < X.numBytesInUse());
+        }
+        ASSERT(0 == X.numBytesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: RANDOM ACCESS
+        //
+        // Concerns:
+        //: 1 Random accesses to a large array are faster when the array is
+        //:   backed by huge pages.
+        //
+        // Plan:
+        //: 1 For each huge page mode, allocate an array (of 1GB, by default,
+        //:   or of the number of megabytes specified on the command line),
+        //:   touch every page, and time a long chain of dependent loads at
+        //:   pseudo-random positions in the array.  Report the average time
+        //:   per load.
+        //
+        // Testing:
+        //   PERFORMANCE: RANDOM ACCESS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE: RANDOM ACCESS"
+                          << "\n==========================" << endl;
+
+        const size_type NUM_MB = argc > 2 && atoi(argv[2]) > 0
+                                 ? atoi(argv[2])
+                                 : 1024;
+        const size_type NUM_ELEMENTS = NUM_MB * k_MB / sizeof(size_type);
+        const int       NUM_LOADS    = 20 * 1000 * 1000;
+
+        const MU::HugePageMode MODES[] = { MU::k_HUGE_PAGES_NONE,
+                                           MU::k_HUGE_PAGES_TRANSPARENT,
+                                           MU::k_HUGE_PAGES_EXPLICIT };
+        const char *NAMES[] = { "regular", "transparent", "explicit" };
+
+        cout << "pages,MB,ns/load" << endl;
+
+        for (int ti = 0; ti < 3; ++ti) {
+            Obj mX(MODES[ti]);
+
+            size_type *array = static_cast<size_type *>(
+                               mX.allocate(NUM_ELEMENTS * sizeof(size_type)));
+
+            // Build a single random cycle through the array (Sattolo's
+            // algorithm), so that each load depends on the previous one.
+
+            for (size_type i = 0; i < NUM_ELEMENTS; ++i) {
+                array[i] = i;
+            }
+            bsls::Types::Uint64 seed = 12345;
+            for (size_type i = NUM_ELEMENTS - 1; i > 0; --i) {
+                seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                const size_type j = static_cast<size_type>(seed >> 33) % i;
+                const size_type t = array[i];
+                array[i] = array[j];
+                array[j] = t;
+            }
+
+            bsls::Stopwatch timer;
+            timer.start();
+
+            size_type index = 0;
+            for (int i = 0; i < NUM_LOADS; ++i) {
+                index = array[index];
+            }
+
+            timer.stop();
+
+            cout << NAMES[ti] << ',' << NUM_MB << ','
+                 << timer.elapsedTime() * 1.0e9 / NUM_LOADS
+                 << (index == NUM_ELEMENTS ? "*" : "") << endl;
+
+            mX.deallocate(array);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
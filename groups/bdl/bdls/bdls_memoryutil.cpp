@@ -13,6 +13,7 @@
 BSLS_IDENT_RCSID(bdls_memoryutil_cpp,"$Id$ $CSID$")
 
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_platform.h>
 
 #ifdef BSLS_PLATFORM_OS_WINDOWS
@@ -28,6 +29,12 @@ BSLS_IDENT_RCSID(bdls_memoryutil_cpp,"$Id$ $CSID$")
 #include <bsl_c_stdlib.h>
 #endif
 
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <sys/syscall.h>
+#include <bsl_c_limits.h>
+#include <bsl_c_stdio.h>
+#endif
+
 namespace BloombergLP {
 
 #ifdef BSLS_PLATFORM_OS_WINDOWS
@@ -84,6 +91,83 @@ int MemoryUtil::deallocate(void *address)
 
     return VirtualFree(address, 0, MEM_RELEASE) ? 0 : -1;
 }
+
+bsls::Types::size_type MemoryUtil::hugePageSize()
+{
+    // Large pages are obtained directly from 'VirtualAlloc' and are aligned
+    // on a large-page boundary, but regular allocations are aligned only on
+    // an allocation-granularity boundary.
+
+    return pageSize();
+}
+
+void *MemoryUtil::allocateRegion(bsls::Types::size_type numBytes,
+                                 HugePageMode           mode)
+{
+    BSLS_ASSERT(0 < numBytes);
+    BSLS_ASSERT(0 == numBytes % hugePageSize());
+
+    if (k_HUGE_PAGES_EXPLICIT == mode) {
+        // Large pages require the "Lock pages in memory" privilege; without
+        // it the allocation fails and we fall back to regular pages.
+
+        const SIZE_T largePageSize = GetLargePageMinimum();
+        if (largePageSize && 0 == numBytes % largePageSize) {
+            void *address = VirtualAlloc(NULL,
+                                         numBytes,
+                                         MEM_RESERVE | MEM_COMMIT
+                                                     | MEM_LARGE_PAGES,
+                                         PAGE_READWRITE);
+            if (address) {
+                return address;                                       // RETURN
+            }
+        }
+    }
+
+    return VirtualAlloc(NULL,
+                        numBytes,
+                        MEM_RESERVE | MEM_COMMIT,
+                        PAGE_READWRITE);
+}
+
+int MemoryUtil::deallocateRegion(void                   *address,
+                                 bsls::Types::size_type  numBytes)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(0 < numBytes);
+
+    (void)numBytes;
+
+    return VirtualFree(address, 0, MEM_RELEASE) ? 0 : -1;
+}
+
+int MemoryUtil::currentNumaNode()
+{
+    UCHAR node;
+    if (!GetNumaProcessorNode(
+                        static_cast<UCHAR>(GetCurrentProcessorNumber()), &node)
+     || 0xff == node) {
+        return -1;                                                    // RETURN
+    }
+    return node;
+}
+
+int MemoryUtil::bindToNumaNode(void                   *address,
+                               bsls::Types::size_type  numBytes,
+                               int                     node)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(0 <= node);
+
+    // Windows supports choosing the preferred node of memory only when it is
+    // allocated (via 'VirtualAllocExNuma').
+
+    (void)address;
+    (void)numBytes;
+    (void)node;
+
+    return -1;
+}
 }  // close package namespace
 
 #else
@@ -132,6 +216,191 @@ int MemoryUtil::deallocate(void *address)
     ::free(address);
     return 0;
 }
+
+bsls::Types::size_type MemoryUtil::hugePageSize()
+{
+    static bsls::AtomicInt64 s_hugePageSize(0);
+
+    bsls::Types::Int64 size = s_hugePageSize.loadRelaxed();
+    if (size) {
+        return static_cast<bsls::Types::size_type>(size);             // RETURN
+    }
+
+    size = pageSize();
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+    // Prefer the size of the pages used for transparent huge pages (the PMD
+    // size); otherwise use the default size of explicit huge pages.  Both are
+    // typically 2MB on x86-64.  Concurrent first calls compute the same value,
+    // so the race on 's_hugePageSize' is benign.
+
+    static const char k_PMD_SIZE_FILE[] =
+                          "/sys/kernel/mm/transparent_hugepage/hpage_pmd_size";
+
+    unsigned long value = 0;
+
+    if (FILE *file = ::fopen(k_PMD_SIZE_FILE, "r")) {
+        if (1 != ::fscanf(file, "%lu", &value)) {
+            value = 0;
+        }
+        ::fclose(file);
+    }
+
+    if (0 == value) {
+        if (FILE *file = ::fopen("/proc/meminfo", "r")) {
+            char line[128];
+            while (::fgets(line, sizeof line, file)) {
+                if (1 == ::sscanf(line, "Hugepagesize: %lu kB", &value)) {
+                    value *= 1024;
+                    break;
+                }
+            }
+            ::fclose(file);
+        }
+    }
+
+    if (value > static_cast<unsigned long>(size)
+     && 0 == value % static_cast<unsigned long>(size)) {
+        size = value;
+    }
+#endif
+
+    s_hugePageSize.storeRelaxed(size);
+    return static_cast<bsls::Types::size_type>(size);
+}
+
+void *MemoryUtil::allocateRegion(bsls::Types::size_type numBytes,
+                                 HugePageMode           mode)
+{
+    BSLS_ASSERT(0 < numBytes);
+
+    const bsls::Types::size_type alignment = hugePageSize();
+
+    BSLS_ASSERT(0 == numBytes % alignment);
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(MAP_HUGETLB)
+    if (k_HUGE_PAGES_EXPLICIT == mode) {
+        // Explicit huge pages are reserved when the mapping is created, so
+        // this fails if the huge page pool is too small.
+
+        void *address = ::mmap(0,
+                               numBytes,
+                               PROT_READ | PROT_WRITE,
+                               MAP_ANON | MAP_PRIVATE | MAP_HUGETLB,
+                               -1,
+                               0);
+        if (MAP_FAILED != address) {
+            return address;                                           // RETURN
+        }
+    }
+#endif
+
+    // Over-allocate by 'alignment' bytes and unmap the unaligned ends.
+
+    const bsls::Types::size_type mapSize =
+                  static_cast<bsls::Types::size_type>(pageSize()) == alignment
+                  ? numBytes
+                  : numBytes + alignment;
+
+    void *base = ::mmap(0,
+                        mapSize,
+                        PROT_READ | PROT_WRITE,
+                        MAP_ANON | MAP_PRIVATE,
+                        -1,
+                        0);
+    if (MAP_FAILED == base) {
+        return 0;                                                     // RETURN
+    }
+
+    char *begin   = static_cast<char *>(base);
+    char *end     = begin + mapSize;
+    const bsls::Types::size_type offset =
+                     reinterpret_cast<bsls::Types::UintPtr>(begin) % alignment;
+    char *address = offset ? begin + (alignment - offset) : begin;
+
+    if (address != begin) {
+        ::munmap(begin, address - begin);
+    }
+    if (address + numBytes != end) {
+        ::munmap(address + numBytes, end - (address + numBytes));
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(MADV_HUGEPAGE)
+    if (k_HUGE_PAGES_NONE != mode) {
+        // Failure (e.g., if transparent huge pages are disabled) leaves the
+        // region backed by regular pages.
+
+        ::madvise(address, numBytes, MADV_HUGEPAGE);
+    }
+#else
+    (void)mode;
+#endif
+
+    return address;
+}
+
+int MemoryUtil::deallocateRegion(void                   *address,
+                                 bsls::Types::size_type  numBytes)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(0 < numBytes);
+
+    return ::munmap(static_cast<char *>(address), numBytes) ? -1 : 0;
+}
+
+int MemoryUtil::currentNumaNode()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(SYS_getcpu)
+    unsigned int cpu;
+    unsigned int node;
+    if (0 == ::syscall(SYS_getcpu, &cpu, &node, 0)) {
+        return static_cast<int>(node);                                // RETURN
+    }
+#endif
+    return -1;
+}
+
+int MemoryUtil::bindToNumaNode(void                   *address,
+                               bsls::Types::size_type  numBytes,
+                               int                     node)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(0 <= node);
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(SYS_mbind)
+    // Invoke 'mbind' directly rather than through 'libnuma', which would add
+    // a link-time dependency.  'MPOL_PREFERRED' (from '<linux/mempolicy.h>')
+    // falls back to other nodes when the preferred node is out of memory.
+
+    enum { k_MPOL_PREFERRED = 1, k_MASK_LENGTH = 16 };
+    const int k_BITS_PER_WORD = static_cast<int>(sizeof(unsigned long))
+                              * CHAR_BIT;
+
+    if (node >= k_MASK_LENGTH * k_BITS_PER_WORD) {
+        return -1;                                                    // RETURN
+    }
+
+    unsigned long mask[k_MASK_LENGTH] = { 0 };
+    mask[node / k_BITS_PER_WORD] = 1UL << (node % k_BITS_PER_WORD);
+
+    // The kernel ignores the last bit of 'maxnode'; 'libnuma' passes one more
+    // than the number of bits in the mask as well.
+
+    return ::syscall(SYS_mbind,
+                     address,
+                     numBytes,
+                     static_cast<int>(k_MPOL_PREFERRED),
+                     mask,
+                     k_MASK_LENGTH * k_BITS_PER_WORD + 1,
+                     0) ? -1 : 0;
+#else
+    (void)address;
+    (void)numBytes;
+    (void)node;
+
+    return -1;
+#endif
+}
 }  // close package namespace
 
 #endif
@@ -23,6 +23,22 @@ BSLS_IDENT("$Id: $")
 // for querying page size, allocating/deallocating page-aligned memory, and
 // utility to change memory protection.
 //
+// In addition, 'bdls::MemoryUtil' provides utilities for reserving large
+// regions of memory backed, where the platform supports it, by huge pages
+// (e.g., 2MB pages on Linux/x86-64), and for binding such regions to a NUMA
+// node.  Backing a large, long-lived heap with huge pages substantially
+// reduces the number of TLB misses incurred when accessing it.  Two
+// flavors of huge pages are supported (see 'HugePageMode'): *transparent*
+// huge pages, which the operating system substitutes for regular pages
+// on a best-effort basis, and *explicit* huge pages, which are drawn from a
+// pool that must be reserved by the system administrator (e.g., via
+// '/proc/sys/vm/nr_hugepages' on Linux).  'allocateRegion' falls back from
+// explicit to transparent huge pages, and from transparent huge pages to
+// regular pages, when the preferred kind is not available, so that the
+// allocation fails only if the memory itself is unavailable.  On platforms
+// that do not support huge pages or NUMA binding, these utilities degrade to
+// page-aligned allocation and a no-op that reports failure, respectively.
+//
 ///Usage
 ///-----
 // First, allocate one page of memory.
@@ -61,6 +77,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bsls_types.h>
+
 namespace BloombergLP {
 
 namespace bdls {
@@ -103,6 +121,13 @@ struct MemoryUtil {
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
     };
 
+    enum HugePageMode {
+        k_HUGE_PAGES_NONE,         // regular pages only
+        k_HUGE_PAGES_TRANSPARENT,  // transparent huge pages, if supported
+        k_HUGE_PAGES_EXPLICIT      // explicit huge pages, falling back to
+                                   // transparent huge pages
+    };
+
     // CLASS METHODS
     static int pageSize();
         // Return the memory page size of the platform.
@@ -137,6 +162,50 @@ struct MemoryUtil {
         // nonzero value otherwise.  The behavior is undefined if read or write
         // access to any memory in this area has been revoked and not restored.
         // Note that deallocating memory does not change memory protection.
+
+    static bsls::Types::size_type hugePageSize();
+        // Return the size of the huge pages used by 'allocateRegion' on this
+        // platform, or 'pageSize()' if the platform does not support huge
+        // pages.  Note that the returned value is a multiple of 'pageSize()'.
+
+    static void *allocateRegion(bsls::Types::size_type numBytes,
+                                HugePageMode           mode);
+        // Allocate a readable and writable region of memory of the specified
+        // 'numBytes', aligned on a 'hugePageSize()' boundary and backed, if
+        // possible, by pages of the kind indicated by the specified 'mode'.
+        // Return the address of the region on success, and a null pointer
+        // otherwise.  The behavior is undefined unless '0 < numBytes' and
+        // 'numBytes' is a multiple of 'hugePageSize()'.  Note that physical
+        // memory is typically not committed to the region until it is first
+        // written, and that the region must be deallocated using
+        // 'deallocateRegion'.
+
+    static int deallocateRegion(void                   *address,
+                                bsls::Types::size_type  numBytes);
+        // Deallocate the region of memory of the specified 'numBytes' at the
+        // specified 'address' previously allocated with 'allocateRegion'.
+        // Return 0 on success, and a nonzero value otherwise.  The behavior is
+        // undefined unless 'address' and 'numBytes' are the values supplied
+        // to, and returned by, a call to 'allocateRegion'.
+
+    static int currentNumaNode();
+        // Return the index of the NUMA node of the processor on which the
+        // calling thread is currently running, or a negative value if it
+        // cannot be determined.  Note that the returned value may be stale by
+        // the time it is used unless the thread is bound to that node.
+
+    static int bindToNumaNode(void                   *address,
+                              bsls::Types::size_type  numBytes,
+                              int                     node);
+        // Set the memory policy of the specified 'numBytes' at the specified
+        // 'address' so that physical pages for the region are preferentially
+        // obtained from the NUMA node having the specified 'node' index.
+        // Return 0 on success, and a nonzero value otherwise (in particular,
+        // if the platform does not support NUMA binding).  The behavior is
+        // undefined unless 'address' is aligned on a 'pageSize()' boundary
+        // and '0 <= node'.  Note that the policy applies only to pages
+        // committed after this call; it should therefore be called before
+        // the region is first written.
 };
 }  // close package namespace
 
@@ -15,6 +15,7 @@
 // TBD: this needs to test setting memory to executable
 
 #include <bsls_platform.h>
+#include <bsls_types.h>
 
 #include <bsl_iostream.h>
 
@@ -121,6 +122,92 @@ int main(int argc, char *argv[])
 #endif
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING HUGE PAGE REGIONS AND NUMA BINDING
+        //
+        // Concerns:
+        //: 1 'hugePageSize' returns a positive multiple of 'pageSize'.
+        //:
+        //: 2 'allocateRegion' returns a writable region aligned on a
+        //:   'hugePageSize' boundary for every 'HugePageMode', whether or not
+        //:   the host provides huge pages of that kind.
+        //:
+        //: 3 'deallocateRegion' succeeds for a region returned by
+        //:   'allocateRegion'.
+        //:
+        //: 4 'bindToNumaNode' succeeds for the node returned by
+        //:   'currentNumaNode', if that node is known, on platforms that
+        //:   support NUMA binding.
+        //
+        // Plan:
+        //: 1 For each mode and several region sizes, allocate a region, bind
+        //:   it to the current node (if known), verify its alignment, write
+        //:   to its first and last bytes, and deallocate it.  (C-1..4)
+        //
+        // Testing:
+        //   bsls::Types::size_type hugePageSize();
+        //   void *allocateRegion(size_type numBytes, HugePageMode mode);
+        //   int deallocateRegion(void *address, size_type numBytes);
+        //   int currentNumaNode();
+        //   int bindToNumaNode(void *address, size_type numBytes, int node);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING HUGE PAGE REGIONS AND NUMA BINDING"
+                          << "\n=========================================="
+                          << bsl::endl;
+
+        typedef bdls::MemoryUtil       Util;
+        typedef bsls::Types::size_type size_type;
+
+        const size_type HUGE_PAGE_SIZE = Util::hugePageSize();
+        const int       NODE           = Util::currentNumaNode();
+
+        if (verbose) {
+            P_(Util::pageSize()) P_(HUGE_PAGE_SIZE) P(NODE)
+        }
+
+        ASSERT(0 < HUGE_PAGE_SIZE);
+        ASSERT(0 == HUGE_PAGE_SIZE % Util::pageSize());
+        ASSERT(HUGE_PAGE_SIZE == Util::hugePageSize());
+
+        const Util::HugePageMode MODES[] = { Util::k_HUGE_PAGES_NONE,
+                                             Util::k_HUGE_PAGES_TRANSPARENT,
+                                             Util::k_HUGE_PAGES_EXPLICIT };
+        const int NUM_MODES = sizeof MODES / sizeof *MODES;
+
+        for (int ti = 0; ti < NUM_MODES; ++ti) {
+            for (size_type numPages = 1; numPages <= 5; numPages += 2) {
+                const size_type SIZE = numPages * HUGE_PAGE_SIZE;
+
+                char *region = static_cast<char *>(
+                                       Util::allocateRegion(SIZE, MODES[ti]));
+                ASSERTV(ti, numPages, region);
+                if (!region) {
+                    continue;                                       // CONTINUE
+                }
+
+                ASSERTV(ti, numPages, 0 ==
+                        reinterpret_cast<bsls::Types::UintPtr>(region)
+                                                            % HUGE_PAGE_SIZE);
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+                if (0 <= NODE) {
+                    ASSERTV(ti, numPages,
+                            0 == Util::bindToNumaNode(region, SIZE, NODE));
+                }
+#endif
+
+                region[0]        = 'a';
+                region[SIZE - 1] = 'z';
+                ASSERTV(ti, numPages, 'a' == region[0]);
+                ASSERTV(ti, numPages, 'z' == region[SIZE - 1]);
+
+                ASSERTV(ti, numPages,
+                        0 == Util::deallocateRegion(region, SIZE));
+            }
+        }
+      } break;
       case 2: {
         // ---------------------------------------------------------------
         // Concern: functionality of protect()
@@ -99,6 +99,44 @@ BSLS_IDENT("$Id$ $CSID$")
 //  fill<void *>(1) - exp memcpy : 0.016115   0.090540   0.055150
 //..
 //
+///Vectorized kernels
+///------------------
+// On x86 platforms with SSE2 (i.e., all x86-64 platforms), 'bitwiseSwapRanges'
+// uses explicit 16-byte loads and stores, unrolled by four so that 64 bytes
+// are swapped per iteration, and 'bitwiseFillN' uses non-temporal stores for
+// fills of at least 'k_NON_TEMPORAL_STORE_THRESHOLD' bytes.
+//
+// Below that threshold, 'bitwiseFillN' keeps using the exponential 'memcpy':
+// measurements (see 'benchmarks/containers/sequencebench.m.cpp') showed an
+// explicit SSE2 store loop to be *slower* than 'memcpy' for fills that fit in
+// the cache, since the C library selects wider (e.g., AVX) stores at run time,
+// and the setup of the pattern registers is not amortized on small ranges.
+// Above the threshold, the fill is bound by memory bandwidth, and streaming
+// stores, which do not first read each destination cache line and do not
+// evict the working set, more than double the throughput.  The streaming
+// kernel first fills 'lcm(numBytesInitialized, 64)' bytes past the first
+// 16-byte aligned address with 'memcpy', then repeatedly streams that
+// (cache-resident) block to the rest of the range; since the length of the
+// block is a multiple of both the pattern and the vector size, every store is
+// aligned and in phase with the pattern.  The loop is followed by an
+// '_mm_sfence' so that the streamed data is ordered before any subsequent
+// store.
+//
+// 'bitwiseRotate' follows the 'gcd(length, numElements)' cycles of the
+// permutation, moving up to 'k_INPLACE_BUFFER_SIZE' cycles at a time.  When
+// there are fewer cycles than that (in the worst, and common, case, a single
+// one) this moves very few characters per step along a stride of
+// 'numElements' characters, which is extremely slow (less than 1 GB/s in our
+// measurements).  In that case we use the Gries-Mills block-swap algorithm
+// instead: the shorter of the two sides is swapped with the adjacent end of
+// the longer side, which puts it in its final position and leaves a smaller
+// rotation of the same kind.  Every pass is a call to the (vectorized)
+// 'bitwiseSwapRanges' over contiguous memory, and the loop ends with a single
+// 'memmove' as soon as the shorter side fits in the in-place buffer.  The
+// cycle algorithm is kept when there are many cycles, since it then moves
+// every character only once, whereas block swaps move up to twice as many
+// bytes when one side is much shorter than the other.
+//
 ///A note on the usage of 'bslmf::EnableIf'
 ///---------------------------------------
 // This is what it would look like in bslalg::ArrayPrimitives if we had used
@@ -118,13 +156,158 @@ BSLS_IDENT("$Id$ $CSID$")
 
 #include <bsls_alignmentutil.h>
 #include <bsls_assert.h>
+#include <bsls_platform.h>
 #include <bsls_types.h>
 
 #include <cstring>
 
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ || (defined(BSLS_PLATFORM_CPU_X86)                                           \
+  && (defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+#define BSLALG_ARRAYPRIMITIVES_SSE2 1
+#include <emmintrin.h>
+#endif
+
 namespace BloombergLP {
 namespace bslalg {
 
+namespace {
+namespace u {
+
+inline
+void exponentialFill(char        *begin,
+                     std::size_t  numBytesInitialized,
+                     std::size_t  numBytes)
+    // Fill the specified 'numBytes' starting at the specified 'begin' address
+    // with copies of the specified 'numBytesInitialized' bytes found at
+    // 'begin', by copying the destination onto itself, doubling size at every
+    // iteration.  The behavior is undefined unless
+    // '0 < numBytesInitialized <= numBytes'.
+{
+    char *end = begin + numBytesInitialized;
+    numBytes -= numBytesInitialized;            // bytes remaining to be copied
+
+    while (numBytesInitialized <= numBytes) {
+        std::memcpy(end, begin, numBytesInitialized);
+        end += numBytesInitialized;
+        numBytes -= numBytesInitialized;
+        numBytesInitialized *= 2;
+    }
+    if (0 < numBytes) {
+        std::memcpy(end, begin, numBytes);   // finish copying end of the range
+    }
+}
+
+#ifdef BSLALG_ARRAYPRIMITIVES_SSE2
+enum {
+    k_VECTOR_SIZE = 16,                 // bytes in one SSE2 register
+    k_BLOCK_SIZE  = 4 * k_VECTOR_SIZE   // bytes per unrolled iteration
+};
+
+inline
+void streamingFill(char        *begin,
+                   std::size_t  patternSize,
+                   std::size_t  numBytes)
+    // Fill the specified 'numBytes' starting at the specified 'begin' address
+    // with copies of the specified 'patternSize' bytes found at 'begin', using
+    // non-temporal stores for all but a block at the start of the range.  The
+    // behavior is undefined unless
+    // '0 < patternSize <= ArrayPrimitives_Imp::k_INPLACE_BUFFER_SIZE' and
+    // 'ArrayPrimitives_Imp::k_NON_TEMPORAL_STORE_THRESHOLD <= numBytes'.
+{
+    // The length of the source block, 'lcm(patternSize, k_BLOCK_SIZE)', is a
+    // multiple of both sizes.
+
+    std::size_t gcd       = k_BLOCK_SIZE;
+    std::size_t remainder = patternSize;
+    while (remainder != 0) {
+        std::size_t tmp = gcd % remainder;
+        gcd             = remainder;
+        remainder       = tmp;
+    }
+    const std::size_t sourceSize = patternSize / gcd * k_BLOCK_SIZE;
+
+    const std::size_t head = (k_VECTOR_SIZE
+                        - reinterpret_cast<bsls::Types::UintPtr>(begin)
+                                                       % k_VECTOR_SIZE)
+                           % k_VECTOR_SIZE;
+
+    BSLS_ASSERT_SAFE(head + 2 * sourceSize <= numBytes);
+
+    // Fill the head and the source block with regular (cached) stores.
+
+    exponentialFill(begin, patternSize, head + sourceSize);
+
+    const char  *source    = begin + head;
+    char        *cursor    = begin + head + sourceSize;
+    std::size_t  remaining = numBytes - head - sourceSize;
+
+    for (; sourceSize <= remaining; remaining -= sourceSize) {
+        for (std::size_t offset = 0; offset < sourceSize;
+                                                     offset += k_BLOCK_SIZE) {
+            const __m128i *input  = reinterpret_cast<const __m128i *>(
+                                                             source + offset);
+            __m128i       *output = reinterpret_cast<__m128i *>(cursor);
+
+            const __m128i v0 = _mm_load_si128(input);
+            const __m128i v1 = _mm_load_si128(input + 1);
+            const __m128i v2 = _mm_load_si128(input + 2);
+            const __m128i v3 = _mm_load_si128(input + 3);
+
+            _mm_stream_si128(output,     v0);
+            _mm_stream_si128(output + 1, v1);
+            _mm_stream_si128(output + 2, v2);
+            _mm_stream_si128(output + 3, v3);
+
+            cursor += k_BLOCK_SIZE;
+        }
+    }
+    _mm_sfence();
+
+    // Since 'cursor - source' is a multiple of 'patternSize', the pattern is
+    // in phase for the tail.
+
+    std::memcpy(cursor, source, remaining);
+}
+
+inline
+std::size_t vectorSwapRanges(char *first, char *second, std::size_t numBytes)
+    // Swap the contents of the largest multiple of 'k_BLOCK_SIZE' bytes not
+    // exceeding the specified 'numBytes' starting at the specified 'first'
+    // and 'second' addresses, and return the number of bytes swapped.  The
+    // behavior is undefined unless the two ranges of 'numBytes' bytes do not
+    // overlap.
+{
+    std::size_t numSwapped = 0;
+    for (; numSwapped + k_BLOCK_SIZE <= numBytes; numSwapped += k_BLOCK_SIZE) {
+        __m128i *lhs = reinterpret_cast<__m128i *>(first  + numSwapped);
+        __m128i *rhs = reinterpret_cast<__m128i *>(second + numSwapped);
+
+        const __m128i a0 = _mm_loadu_si128(lhs);
+        const __m128i a1 = _mm_loadu_si128(lhs + 1);
+        const __m128i a2 = _mm_loadu_si128(lhs + 2);
+        const __m128i a3 = _mm_loadu_si128(lhs + 3);
+        const __m128i b0 = _mm_loadu_si128(rhs);
+        const __m128i b1 = _mm_loadu_si128(rhs + 1);
+        const __m128i b2 = _mm_loadu_si128(rhs + 2);
+        const __m128i b3 = _mm_loadu_si128(rhs + 3);
+
+        _mm_storeu_si128(lhs,     b0);
+        _mm_storeu_si128(lhs + 1, b1);
+        _mm_storeu_si128(lhs + 2, b2);
+        _mm_storeu_si128(lhs + 3, b3);
+        _mm_storeu_si128(rhs,     a0);
+        _mm_storeu_si128(rhs + 1, a1);
+        _mm_storeu_si128(rhs + 2, a2);
+        _mm_storeu_si128(rhs + 3, a3);
+    }
+    return numSwapped;
+}
+#endif
+
+}  // close namespace u
+}  // close unnamed namespace
+
 // CLASS METHODS
 void ArrayPrimitives_Imp::uninitializedFillN(
                       short                                       *begin,
@@ -385,21 +568,23 @@ void ArrayPrimitives_Imp::bitwiseFillN(char      *begin,
 {
     BSLS_ASSERT_SAFE(begin || 0 == numBytes);
     BSLS_ASSERT(numBytesInitialized <= numBytes);
+    BSLS_ASSERT(0 < numBytesInitialized || 0 == numBytes);
 
-    // Copy the destination onto itself, doubling size at every iteration.
-
-    char *end = begin + numBytesInitialized;
-    numBytes -= numBytesInitialized;            // bytes remaining to be copied
+    if (0 == numBytesInitialized) {
+        // Nothing to do, and 'exponentialFill' would not terminate.
 
-    while (numBytesInitialized <= numBytes) {
-        std::memcpy(end, begin, numBytesInitialized);
-        end += numBytesInitialized;
-        numBytes -= numBytesInitialized;
-        numBytesInitialized *= 2;
+        return;                                                       // RETURN
     }
-    if (0 < numBytes) {
-        std::memcpy(end, begin, numBytes);   // finish copying end of the range
+
+#ifdef BSLALG_ARRAYPRIMITIVES_SSE2
+    if (k_NON_TEMPORAL_STORE_THRESHOLD <= numBytes
+     && numBytesInitialized <= k_INPLACE_BUFFER_SIZE) {
+        u::streamingFill(begin, numBytesInitialized, numBytes);
+        return;                                                       // RETURN
     }
+#endif
+
+    u::exponentialFill(begin, numBytesInitialized, numBytes);
 }
 
                            // *** bitwiseRotate: ***
@@ -444,7 +629,6 @@ void ArrayPrimitives_Imp::bitwiseRotate(char *begin,
         return;                                                       // RETURN
     }
 
-    // This algorithm proceeds exactly like the template version, char-by-char.
     // First we compute the 'gcd(end - begin, numElements)' which is the number
     // of cycles in the rotation.
 
@@ -456,7 +640,56 @@ void ArrayPrimitives_Imp::bitwiseRotate(char *begin,
         remainder       = tmp;
     }
 
-    // However, this version proceeds by executing the 'numCycles' in parallel
+    if (numCycles < k_INPLACE_BUFFER_SIZE) {
+        // Following the cycles would move fewer than 'k_INPLACE_BUFFER_SIZE'
+        // (and possibly only one) characters at a time, so use block swaps
+        // instead.  Each iteration of this loop swaps the shorter side with
+        // the adjacent end of the longer side, which puts the shorter side in
+        // its final position and leaves a rotation of the remainder of the
+        // longer side with the swapped-in block (see the implementation note
+        // above).
+
+        while (true) {
+            const std::size_t leftBytes  = middle - begin;
+            const std::size_t rightBytes = end - middle;
+
+            if (leftBytes == rightBytes) {
+                bitwiseSwapRanges(begin, middle, end);
+                return;                                               // RETURN
+            }
+            if (leftBytes <= k_INPLACE_BUFFER_SIZE) {
+                bitwiseRotateBackward(begin, middle, end);
+                return;                                               // RETURN
+            }
+            if (rightBytes <= k_INPLACE_BUFFER_SIZE) {
+                bitwiseRotateForward(begin, middle, end);
+                return;                                               // RETURN
+            }
+
+            if (leftBytes < rightBytes) {
+                //..
+                //  [A | B1 B2] => [B1 | A B2], then rotate '[A | B2]'
+                //..
+
+                bitwiseSwapRanges(begin, middle, middle + leftBytes);
+                begin   = middle;
+                middle += leftBytes;
+            }
+            else {
+                //..
+                //  [A1 A2 | B] => [A1 B | A2], then rotate '[A1 | B]'
+                //..
+
+                bitwiseSwapRanges(middle - rightBytes, middle, end);
+                end     = middle;
+                middle -= rightBytes;
+            }
+        }
+    }
+
+    // Otherwise, this algorithm proceeds exactly like the template version,
+    // char-by-char, along the 'numCycles' cycles of the permutation.  However,
+    // this version proceeds by executing the 'numCycles' in parallel
     // (as much as possible) by moving 'min(numCycles, k_INPLACE_BUFFER_SIZE)'
     // characters at the same time.
 
@@ -633,11 +866,20 @@ void ArrayPrimitives_Imp::bitwiseSwapRanges(char *begin,
     BSLS_ASSERT_SAFE(begin  <= middle);
     BSLS_ASSERT_SAFE(middle <= end);
 
-    std::ptrdiff_t numBytes = static_cast<int>(middle - begin);
+    std::ptrdiff_t numBytes = middle - begin;
     BSLS_ASSERT(numBytes == end - middle);
 
     (void) end;
 
+#ifdef BSLALG_ARRAYPRIMITIVES_SSE2
+    const std::ptrdiff_t numSwapped = u::vectorSwapRanges(begin,
+                                                          middle,
+                                                          numBytes);
+    begin    += numSwapped;
+    middle   += numSwapped;
+    numBytes -= numSwapped;
+#endif
+
     union {
         char                                d_buffer[k_INPLACE_BUFFER_SIZE];
         bsls::AlignmentUtil::MaxAlignedType d_align;
@@ -35,7 +35,9 @@ BSLS_IDENT("$Id$ $CSID$")
 //  uninitializedFillN            Copy construct from value for each element in
 //                                the target range, or 'std::memset' if value
 //                                is all 0s or 1s bits, and type is bit-wise
-//                                copyable
+//                                copyable, or exponential 'std::memcpy' (or
+//                                non-temporal stores for very large ranges)
+//                                otherwise if type is bit-wise copyable
 //
 //  copyConstruct                 Copy construct from each element in the
 //                                original range to the corresponding element
@@ -82,8 +84,10 @@ BSLS_IDENT("$Id$ $CSID$")
 //
 //  rotate                        'destructiveMove' to move elements into a
 //                                shifting hole along parallel cyclic
-//                                permutations, or 'std::memmove' for small
-//                                rotations if type is bit-wise moveable
+//                                permutations, or, if type is bit-wise
+//                                moveable, 'std::memmove' for small rotations
+//                                and vectorized block swaps for rotations with
+//                                few cycles
 //..
 // The traits under consideration by this component are:
 //..
@@ -103,6 +107,25 @@ BSLS_IDENT("$Id$ $CSID$")
 //                                                "TYPE is bit-wise moveable"
 //..
 //
+///Vectorized Bit-Wise Kernels
+///---------------------------
+// When the element type is bit-wise copyable, 'uninitializedFillN' (and the
+// algorithms, such as 'insert' and 'defaultConstruct', that fill a range from
+// a single value) replicate the value with 'std::memcpy' on ranges that fit in
+// the cache.  Fills of at least
+// 'ArrayPrimitives_Imp::k_NON_TEMPORAL_STORE_THRESHOLD' bytes instead use
+// non-temporal ("streaming") SIMD stores on platforms that support them
+// (currently, x86 with SSE2), which bypass the cache, so that filling a very
+// large buffer neither reads each destination cache line first nor evicts the
+// working set of the calling thread.
+//
+// When the element type is bit-wise moveable, 'rotate' (used, for example, by
+// 'bsl::vector' to insert a range of input iterators) swaps blocks of
+// contiguous memory using SIMD loads and stores whenever following the cycles
+// of the permutation would move only a few bytes at a time (i.e., whenever the
+// greatest common divisor of the lengths of the two sides, in bytes, is
+// small).
+//
 ///Aliasing
 ///--------
 // There are some aliasing concerns in this component, due to the presence of
@@ -1848,6 +1871,15 @@ struct ArrayPrimitives_Imp {
         k_INPLACE_BUFFER_SIZE = 16 * bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT
     };
 
+    enum {
+        // Number of bytes from which 'bitwiseFillN' uses non-temporal stores,
+        // if supported by the platform.  This is chosen to be larger than the
+        // last-level cache of a typical core, so that only fills whose result
+        // could not remain in the cache anyway bypass it.
+
+        k_NON_TEMPORAL_STORE_THRESHOLD = 4 * 1024 * 1024
+    };
+
     // CLASS METHODS
     static void bitwiseFillN(char      *begin,
                              size_type  numBytesInitialized,
@@ -1856,9 +1888,12 @@ struct ArrayPrimitives_Imp {
         // 'begin' address, as if by bit-wise copying the specified
         // 'numBytesInitialized' at every offset that is a multiple of
         // 'numBytesInitialized' within the output array.  The behavior is
-        // undefined unless 'numBytesInitialized <= numBytes'.  Note that
-        // 'numBytes' usually is, but does not have to be, a multiple of
-        // 'numBytesInitialized'.
+        // undefined unless 'numBytesInitialized <= numBytes' and
+        // '0 < numBytesInitialized || 0 == numBytes'.  Note that 'numBytes'
+        // usually is, but does not have to be, a multiple of
+        // 'numBytesInitialized'.  Also note that non-temporal SIMD stores are
+        // used for at least 'k_NON_TEMPORAL_STORE_THRESHOLD' bytes if
+        // supported by the platform (see {Vectorized Bit-Wise Kernels}).
 
     static void uninitializedFillN(
                       bool                                        *begin,
@@ -2977,7 +3012,8 @@ struct ArrayPrimitives_Imp {
         // address and ending immediately before the specified 'middle' address
         // with the array of the same length starting at the 'middle' address
         // and ending at the specified 'last' address.  The behavior is
-        // undefined unless 'middle - begin == end - middle'.
+        // undefined unless 'middle - begin == end - middle'.  Note that SIMD
+        // loads and stores are used if supported by the platform.
 
     template <class FORWARD_ITERATOR>
     static bool isInvalidRange(FORWARD_ITERATOR begin, FORWARD_ITERATOR end);
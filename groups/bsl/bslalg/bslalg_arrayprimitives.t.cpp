@@ -75,9 +75,14 @@ using namespace BloombergLP;
 // [ 5] void moveInsert(T *dstB, T *dstE, T **srcEp, srcB, srcE, ne, *a);
 // [ 8] void rotate(T *first, T *middle, T *last);
 // [ 2] void uninitializedFillN(T *dstB, size_type ne, const T& v, *a);
+//
+// bslalg::ArrayPrimitives_Imp 'bitwise' methods:
+// [12] void bitwiseFillN(char *begin, size_type nbi, size_type nb);
+// [12] void bitwiseRotate(char *begin, char *middle, char *end);
+// [12] void bitwiseSwapRanges(char *begin, char *middle, char *end);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
 // [11] Hyman's first test case
 
 // ============================================================================
@@ -1585,6 +1590,15 @@ char getValue(const Attrib5& c)
 //                  GLOBAL HELPER FUNCTIONS FOR TESTING
 //-----------------------------------------------------------------------------
 
+char hashByte(size_t index)
+    // Return a pseudo-random byte determined by the specified 'index'.  Note
+    // that, unlike 'static_cast<char>(index)', this does not repeat with a
+    // period that is a power of two, so that a range that is displaced by a
+    // multiple of 256 bytes from its expected position is detected.
+{
+    return static_cast<char>((index * 2654435761u) >> 13);
+}
+
 template <class TYPE>
 class CleanupGuard {
     // This proctor is responsible to create, in an array specified at
@@ -4597,7 +4611,7 @@ int main(int argc, char *argv[])
     Z = &testAllocator;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -4642,6 +4656,284 @@ int main(int argc, char *argv[])
             ASSERT(u[i] == DATA[i]);
         }
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING VECTORIZED BIT-WISE KERNELS
+        //
+        // Concerns:
+        //: 1 'bitwiseFillN' replicates the initialized pattern for every
+        //:   pattern size, for every alignment of 'begin', and for every
+        //:   total size, including sizes that are not a multiple of the
+        //:   pattern size.
+        //:
+        //: 2 'bitwiseFillN' does not write outside of the specified range.
+        //:
+        //: 3 Fills of at least 'k_NON_TEMPORAL_STORE_THRESHOLD' bytes, which
+        //:   use non-temporal stores for pattern sizes up to
+        //:   'k_INPLACE_BUFFER_SIZE', produce the same result for pattern
+        //:   sizes that do and do not divide the 64 bytes stored per
+        //:   iteration of the streaming loop, and for pattern sizes that are
+        //:   too large for that loop.
+        //:
+        //: 4 'bitwiseSwapRanges' swaps ranges of every length, at every
+        //:   alignment, without writing outside of either range.
+        //:
+        //: 5 'bitwiseRotate' rotates ranges in which both sides are longer
+        //:   than 'k_INPLACE_BUFFER_SIZE', whether the lengths of the sides
+        //:   have a small greatest common divisor (i.e., the range is rotated
+        //:   by block swaps) or not (i.e., the range is rotated along the
+        //:   cycles of the permutation), and ranges that are larger than the
+        //:   cache.
+        //
+        // Plan:
+        //: 1 For a set of pattern sizes, every offset in '[0 .. 16)' from a
+        //:   maximally aligned address, and a set of total sizes, surround
+        //:   the target range with guard bytes, initialize the pattern, call
+        //:   'bitwiseFillN', and verify every byte of the range and of the
+        //:   guards.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 for a few pattern sizes and offsets with a total size
+        //:   just above 'k_NON_TEMPORAL_STORE_THRESHOLD'.  (C-3)
+        //:
+        //: 3 For every length in '[0 .. 300)' and a few offsets, fill two
+        //:   adjacent ranges with distinct pseudo-random bytes, swap them,
+        //:   and verify both ranges and the guards.  (C-4)
+        //:
+        //: 4 For a set of range lengths, including one of several megabytes,
+        //:   and a set of positions near the boundaries of the in-place buffer
+        //:   and at simple fractions of the range, fill the range with
+        //:   pseudo-random bytes, rotate it, and verify the result against the
+        //:   expected permutation.  (C-5)
+        //
+        // Testing:
+        //   void bitwiseFillN(char *begin, size_type nbi, size_type nb);
+        //   void bitwiseRotate(char *begin, char *middle, char *end);
+        //   void bitwiseSwapRanges(char *begin, char *middle, char *end);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING VECTORIZED BIT-WISE KERNELS"
+                            "\n===================================\n");
+
+        typedef bslalg::ArrayPrimitives_Imp Imp;
+
+        enum {
+            k_GUARD      = 64,  // guard bytes on either side of a range
+            k_MAX_OFFSET = 16   // range of misalignments of 'begin'
+        };
+
+        const char GUARD_BYTE = static_cast<char>(0xA5);
+
+        if (verbose) printf("\nTesting 'bitwiseFillN'.\n");
+        {
+            static const size_t PATTERN_SIZES[] = {
+                1, 2, 3, 4, 5, 7, 8, 12, 16, 24, 32, 48, 64, 72, 128
+            };
+            const int NUM_PATTERN_SIZES = sizeof  PATTERN_SIZES
+                                        / sizeof *PATTERN_SIZES;
+
+            static const size_t SIZES[] = {
+                0, 1, 15, 16, 17, 63, 64, 65, 127, 128, 129, 143, 144, 191,
+                192, 193, 255, 256, 257, 1000, 4109
+            };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            const size_t MAX_SIZE  = 4109;
+            const size_t RAW_SIZE  = 2 * k_GUARD + k_MAX_OFFSET + MAX_SIZE;
+            char        *raw       = static_cast<char *>(
+                                                      Z->allocate(RAW_SIZE));
+
+            for (int ti = 0; ti < NUM_PATTERN_SIZES; ++ti) {
+                const size_t PATTERN_SIZE = PATTERN_SIZES[ti];
+
+                if (veryVerbose) { T_ P(PATTERN_SIZE) }
+
+                for (int tj = 0; tj < NUM_SIZES; ++tj) {
+                    const size_t SIZE = SIZES[tj];
+
+                    if (SIZE < PATTERN_SIZE && 0 != SIZE) {
+                        continue;                                   // CONTINUE
+                    }
+
+                    const size_t NUM_INITIALIZED = SIZE ? PATTERN_SIZE : 0;
+
+                    for (int offset = 0; offset < k_MAX_OFFSET; ++offset) {
+                        memset(raw, GUARD_BYTE, RAW_SIZE);
+
+                        char *begin = raw + k_GUARD + offset;
+                        for (size_t i = 0; i < NUM_INITIALIZED; ++i) {
+                            begin[i] = hashByte(i + PATTERN_SIZE);
+                        }
+
+                        Imp::bitwiseFillN(begin, NUM_INITIALIZED, SIZE);
+
+                        for (size_t i = 0; i < SIZE; ++i) {
+                            const char EXP = hashByte(i % PATTERN_SIZE
+                                                             + PATTERN_SIZE);
+                            if (EXP != begin[i]) {
+                                ASSERTV(PATTERN_SIZE, SIZE, offset, i,
+                                        EXP == begin[i]);
+                                break;
+                            }
+                        }
+                        for (char *p = raw; p < begin; ++p) {
+                            ASSERTV(PATTERN_SIZE, SIZE, offset,
+                                    GUARD_BYTE == *p);
+                        }
+                        for (char *p = begin + SIZE; p < raw + RAW_SIZE; ++p) {
+                            ASSERTV(PATTERN_SIZE, SIZE, offset,
+                                    GUARD_BYTE == *p);
+                        }
+                    }
+                }
+            }
+
+            Z->deallocate(raw);
+        }
+
+        if (verbose) printf("\nTesting 'bitwiseFillN' with non-temporal"
+                            " stores.\n");
+        {
+            static const size_t PATTERN_SIZES[] = {
+                1, 8, 12, 16, 24, 100, Imp::k_INPLACE_BUFFER_SIZE,
+                Imp::k_INPLACE_BUFFER_SIZE + 8
+            };
+            const int NUM_PATTERN_SIZES = sizeof  PATTERN_SIZES
+                                        / sizeof *PATTERN_SIZES;
+
+            static const int OFFSETS[] = { 0, 3, 8 };
+            const int NUM_OFFSETS = sizeof OFFSETS / sizeof *OFFSETS;
+
+            const size_t SIZE     = Imp::k_NON_TEMPORAL_STORE_THRESHOLD + 77;
+            const size_t RAW_SIZE = 2 * k_GUARD + k_MAX_OFFSET + SIZE;
+            char        *raw      = static_cast<char *>(
+                                                      Z->allocate(RAW_SIZE));
+
+            for (int ti = 0; ti < NUM_PATTERN_SIZES; ++ti) {
+                const size_t PATTERN_SIZE = PATTERN_SIZES[ti];
+
+                for (int tj = 0; tj < NUM_OFFSETS; ++tj) {
+                    const int OFFSET = OFFSETS[tj];
+
+                    if (veryVerbose) { T_ P_(PATTERN_SIZE) P(OFFSET) }
+
+                    memset(raw, GUARD_BYTE, RAW_SIZE);
+
+                    char *begin = raw + k_GUARD + OFFSET;
+                    for (size_t i = 0; i < PATTERN_SIZE; ++i) {
+                        begin[i] = hashByte(i);
+                    }
+
+                    Imp::bitwiseFillN(begin, PATTERN_SIZE, SIZE);
+
+                    size_t numErrors = 0;
+                    for (size_t i = 0; i < SIZE; ++i) {
+                        numErrors += hashByte(i % PATTERN_SIZE) != begin[i];
+                    }
+                    ASSERTV(PATTERN_SIZE, OFFSET, numErrors, 0 == numErrors);
+
+                    ASSERTV(PATTERN_SIZE, OFFSET, GUARD_BYTE == begin[-1]);
+                    ASSERTV(PATTERN_SIZE, OFFSET, GUARD_BYTE == begin[SIZE]);
+                }
+            }
+
+            Z->deallocate(raw);
+        }
+
+        if (verbose) printf("\nTesting 'bitwiseSwapRanges'.\n");
+        {
+            const size_t MAX_SIZE = 300;
+            const size_t RAW_SIZE = 2 * k_GUARD + k_MAX_OFFSET + 2 * MAX_SIZE;
+            char        *raw      = static_cast<char *>(
+                                                      Z->allocate(RAW_SIZE));
+
+            static const int OFFSETS[] = { 0, 1, 8, 15 };
+            const int NUM_OFFSETS = sizeof OFFSETS / sizeof *OFFSETS;
+
+            for (size_t size = 0; size < MAX_SIZE; ++size) {
+                for (int ti = 0; ti < NUM_OFFSETS; ++ti) {
+                    const int OFFSET = OFFSETS[ti];
+
+                    memset(raw, GUARD_BYTE, RAW_SIZE);
+
+                    char *begin  = raw + k_GUARD + OFFSET;
+                    char *middle = begin + size;
+                    char *end    = middle + size;
+                    for (size_t i = 0; i < size; ++i) {
+                        begin[i]  = hashByte(i);
+                        middle[i] = hashByte(i + MAX_SIZE);
+                    }
+
+                    Imp::bitwiseSwapRanges(begin, middle, end);
+
+                    for (size_t i = 0; i < size; ++i) {
+                        ASSERTV(size, OFFSET, i,
+                                hashByte(i + MAX_SIZE) == begin[i]);
+                        ASSERTV(size, OFFSET, i, hashByte(i) == middle[i]);
+                    }
+                    ASSERTV(size, OFFSET, GUARD_BYTE == begin[-1]);
+                    ASSERTV(size, OFFSET, GUARD_BYTE == *end);
+                }
+            }
+
+            Z->deallocate(raw);
+        }
+
+        if (verbose) printf("\nTesting 'bitwiseRotate'.\n");
+        {
+            const size_t BUF = Imp::k_INPLACE_BUFFER_SIZE;
+
+            static const size_t SIZES[] = {
+                2 * BUF + 1, 3 * BUF, 1000, 4099, 65536, 6 * 1024 * 1024 + 7
+            };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            for (int ti = 0; ti < NUM_SIZES; ++ti) {
+                const size_t SIZE = SIZES[ti];
+
+                const size_t MIDDLES[] = {
+                    0, 1, BUF - 1, BUF, BUF + 1, 2 * BUF - 1, SIZE / 7,
+                    SIZE / 3, SIZE / 2, SIZE / 2 + 1, SIZE - SIZE / 3,
+                    SIZE - 2 * BUF + 1, SIZE - BUF - 1, SIZE - BUF,
+                    SIZE - BUF + 1, SIZE - 1, SIZE
+                };
+                const int NUM_MIDDLES = sizeof MIDDLES / sizeof *MIDDLES;
+
+                const bool   IS_LARGE = 1024 * 1024 < SIZE;
+                const size_t RAW_SIZE = 2 * k_GUARD + SIZE;
+                char        *raw      = static_cast<char *>(
+                                                      Z->allocate(RAW_SIZE));
+                char        *begin    = raw + k_GUARD;
+
+                for (int tj = 0; tj < NUM_MIDDLES; ++tj) {
+                    const size_t MIDDLE = MIDDLES[tj];
+
+                    if (SIZE < MIDDLE || (IS_LARGE && tj % 3)) {
+                        continue;                                   // CONTINUE
+                    }
+
+                    if (veryVerbose) { T_ P_(SIZE) P(MIDDLE) }
+
+                    memset(raw, GUARD_BYTE, RAW_SIZE);
+                    for (size_t i = 0; i < SIZE; ++i) {
+                        begin[i] = hashByte(i);
+                    }
+
+                    Imp::bitwiseRotate(begin, begin + MIDDLE, begin + SIZE);
+
+                    size_t numErrors = 0;
+                    for (size_t i = 0; i < SIZE; ++i) {
+                        numErrors += hashByte((i + MIDDLE) % SIZE) != begin[i];
+                    }
+                    ASSERTV(SIZE, MIDDLE, numErrors, 0 == numErrors);
+
+                    ASSERTV(SIZE, MIDDLE, GUARD_BYTE == begin[-1]);
+                    ASSERTV(SIZE, MIDDLE, GUARD_BYTE == begin[SIZE]);
+                }
+
+                Z->deallocate(raw);
+            }
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING HYMAN'S TEST CASE 1
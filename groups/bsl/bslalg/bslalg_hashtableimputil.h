@@ -719,6 +719,29 @@ struct HashTableImpUtil {
         //                  const KEY_CONFIG::KeyType& key2)
         //..
 
+    template <class KEY_CONFIG, class LOOKUP_KEY, class KEY_EQUAL>
+    static BidirectionalLink *findTransparent(
+                                       const HashTableAnchor& anchor,
+                                       const LOOKUP_KEY&      key,
+                                       const KEY_EQUAL&       equalityFunctor,
+                                       native_std::size_t     hashCode);
+        // Return the address of the first link in the list element of the
+        // specified 'anchor', having a key that is equivalent (according to
+        // the specified 'equalityFunctor') to the specified 'key' of the
+        // (template parameter) type 'LOOKUP_KEY' in the bucket that holds
+        // elements with the specified 'hashCode' if such a link exists, and
+        // return 0 otherwise.  The behavior is undefined unless, for the
+        // provided 'KEY_CONFIG' and some transparent hash function, 'HASHER',
+        // 'anchor' is well-formed (see 'isWellFormed') and 'HASHER(key)'
+        // returns 'hashCode'.  'KEY_EQUAL' shall be a functor that can be
+        // called as if it had the following signature:
+        //..
+        //  bool operator()(const LOOKUP_KEY&          key1,
+        //                  const KEY_CONFIG::KeyType& key2)
+        //..
+        // Note that, unlike 'find', 'key' is not converted to
+        // 'KEY_CONFIG::KeyType', so no temporary key object is created.
+
     template <class KEY_CONFIG, class HASHER>
     static void rehash(HashTableAnchor   *newAnchor,
                        BidirectionalLink *elementList,
@@ -842,6 +865,31 @@ BidirectionalLink *HashTableImpUtil::find(
     return 0;
 }
 
+template <class KEY_CONFIG, class LOOKUP_KEY, class KEY_EQUAL>
+inline
+BidirectionalLink *HashTableImpUtil::findTransparent(
+                                       const HashTableAnchor& anchor,
+                                       const LOOKUP_KEY&      key,
+                                       const KEY_EQUAL&       equalityFunctor,
+                                       native_std::size_t     hashCode)
+{
+    BSLS_ASSERT_SAFE(anchor.bucketArrayAddress());
+    BSLS_ASSERT_SAFE(anchor.bucketArraySize());
+
+    const HashTableBucket *bucket = findBucketForHashCode(anchor, hashCode);
+    BSLS_ASSERT_SAFE(bucket);
+
+    for (BidirectionalLink *cursor     = bucket->first(),
+                           * const end = bucket->end();
+                                 end != cursor; cursor = cursor->nextLink() ) {
+        if (equalityFunctor(key, extractKey<KEY_CONFIG>(cursor))) {
+            return cursor;                                            // RETURN
+        }
+    }
+
+    return 0;
+}
+
 template <class KEY_CONFIG, class HASHER>
 void HashTableImpUtil::rehash(HashTableAnchor   *newAnchor,
                               BidirectionalLink *elementList,
@@ -6,9 +6,28 @@ BSLS_IDENT("$Id$ $CSID$")
 
 #include <bslma_allocator.h>            // for testing only
 #include <bsls_assert.h>
+#include <bsls_platform.h>
+
+// The thread default allocator is held in compiler-supported thread-local
+// storage, as 'bslma' may not depend on a threading library.  This macro is
+// private to this file, and is undefined at its end.
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#define BSLMA_DEFAULT_THREAD_LOCAL __declspec(thread)
+#else
+#define BSLMA_DEFAULT_THREAD_LOCAL __thread
+#endif
 
 namespace BloombergLP {
 
+namespace {
+
+BSLMA_DEFAULT_THREAD_LOCAL bslma::Allocator *s_threadDefaultAllocator_p = 0;
+    // The thread default allocator of the current thread, or 0 if none is
+    // installed.
+
+}  // close unnamed namespace
+
 namespace bslma {
 
 class Allocator;
@@ -24,6 +43,8 @@ class Allocator;
 bsls::AtomicOperations::AtomicTypes::Pointer
                                     Default::s_requestedDefaultAllocator = {0};
 bsls::AtomicOperations::AtomicTypes::Pointer Default::s_defaultAllocator = {0};
+bsls::AtomicOperations::AtomicTypes::Int
+                                   Default::s_numThreadDefaultAllocators = {0};
 
                         // *** global allocator ***
 
@@ -114,6 +135,32 @@ void Default::setDefaultAllocatorRaw(Allocator *basicAllocator)
     bsls::AtomicOperations::setPtr(&s_defaultAllocator, basicAllocator);
 }
 
+Allocator *Default::setThreadDefaultAllocator(Allocator *basicAllocator)
+{
+    Allocator *previous = s_threadDefaultAllocator_p;
+
+    // Count this thread before installing its allocator, and uncount it only
+    // after uninstalling, so that 'defaultAllocator' on this thread never
+    // skips an installed thread default allocator.
+
+    if (!previous && basicAllocator) {
+        bsls::AtomicOperations::incrementInt(&s_numThreadDefaultAllocators);
+    }
+
+    s_threadDefaultAllocator_p = basicAllocator;
+
+    if (previous && !basicAllocator) {
+        bsls::AtomicOperations::decrementInt(&s_numThreadDefaultAllocators);
+    }
+
+    return previous;
+}
+
+Allocator *Default::threadDefaultAllocator()
+{
+    return s_threadDefaultAllocator_p;
+}
+
                         // *** global allocator ***
 
 Allocator *Default::setGlobalAllocator(Allocator *basicAllocator)
@@ -130,6 +177,8 @@ Allocator *Default::setGlobalAllocator(Allocator *basicAllocator)
 
 }  // close enterprise namespace
 
+#undef BSLMA_DEFAULT_THREAD_LOCAL
+
 // ----------------------------------------------------------------------------
 // Copyright 2013 Bloomberg Finance L.P.
 //
@@ -98,6 +98,35 @@ BSLS_IDENT("$Id: $")
 // at most once.  If called, it should be invoked in 'main' before starting any
 // threads and before initializing singletons.
 //
+///Thread Default Allocator
+///------------------------
+// In addition to the process-wide default allocator, each thread may install
+// a *thread* default allocator using
+// 'bslma::Default::setThreadDefaultAllocator' (typically by way of a
+// 'bslma::ThreadDefaultAllocatorGuard').  While a thread default allocator is
+// installed, 'bslma::Default::defaultAllocator' and
+// 'bslma::Default::allocator' (the latter when called with no argument, or an
+// explicit 0) return it, rather than the process-wide default allocator, *on*
+// *that* *thread* *only*.  In particular, objects (e.g., containers and
+// strings) created on that thread without an explicitly supplied allocator
+// obtain their memory from the thread default allocator.  This allows, for
+// example, all of the incidental allocations made while processing a request
+// to be directed to an arena, such as a 'bdlma::SequentialAllocator', that is
+// released in one shot once the request is complete.
+//
+// The thread default allocator is initially 0 (i.e., not installed) on every
+// thread.  It is never locked, and neither installing nor using it affects
+// the process-wide default allocator (in particular, 'defaultAllocator' does
+// not lock the process-wide default allocator when it returns the thread
+// default allocator).  'bslma::Default::threadDefaultAllocator' returns the
+// thread default allocator of the calling thread, or 0 if none is installed.
+//
+// Note that an object retains the allocator with which it was created:
+// objects created while a thread default allocator is installed continue to
+// use it after it is uninstalled, and must be destroyed (or must not use
+// their allocator) before it is destroyed.  Also note that a thread default
+// allocator should be uninstalled before the thread that installed it exits.
+//
 ///Usage
 ///-----
 // The following sequence of usage examples illustrate recommended use of the
@@ -640,6 +669,7 @@ BSLS_IDENT("$Id: $")
 #include <bslscm_version.h>
 
 #include <bsls_atomicoperations.h>
+#include <bsls_performancehint.h>
 
 #include <bslma_newdeleteallocator.h>
 
@@ -693,6 +723,12 @@ struct Default {
         // be '0' before it is accessed unless *for* *testing* *only*
         // 'setDefaultAllocatorRaw' is used.
 
+    static bsls::AtomicOperations::AtomicTypes::Int
+                                                 s_numThreadDefaultAllocators;
+        // The number of threads that currently have a thread default
+        // allocator installed.  While this value is 0, 'defaultAllocator'
+        // need not consult thread-local storage.
+
                         // *** global allocator ***
 
     static bsls::AtomicOperations::AtomicTypes::Pointer s_globalAllocator;
@@ -752,13 +788,14 @@ struct Default {
         // disabled by this method.
 
     static Allocator *defaultAllocator();
-        // Return the address of the default allocator and disable all
-        // subsequent calls to the 'setDefaultAllocator' method.  Note that
-        // prior to the first call to 'setDefaultAllocator' or
-        // 'setDefaultAllocatorRaw' methods, the address of the default
-        // allocator is that of the 'NewDeleteAllocator' singleton.  Also note
-        // that subsequent calls to 'setDefaultAllocatorRaw' method are *not*
-        // disabled by this method.
+        // Return the address of the thread default allocator of the calling
+        // thread if one is installed.  Otherwise, return the address of the
+        // default allocator and disable all subsequent calls to the
+        // 'setDefaultAllocator' method.  Note that prior to the first call to
+        // 'setDefaultAllocator' or 'setDefaultAllocatorRaw' methods, the
+        // address of the default allocator is that of the
+        // 'NewDeleteAllocator' singleton.  Also note that subsequent calls to
+        // 'setDefaultAllocatorRaw' method are *not* disabled by this method.
 
     static Allocator *allocator(Allocator *basicAllocator = 0);
         // Return the allocator returned by 'defaultAllocator' and disable all
@@ -766,6 +803,25 @@ struct Default {
         // optionally-specified 'basicAllocator' is 0; return 'basicAllocator'
         // otherwise.
 
+    static Allocator *setThreadDefaultAllocator(Allocator *basicAllocator);
+        // Install the specified 'basicAllocator' as the thread default
+        // allocator of the calling thread, or uninstall the thread default
+        // allocator of the calling thread if 'basicAllocator' is 0.  Return
+        // the thread default allocator of the calling thread in effect
+        // immediately before calling this method, or 0 if none was installed.
+        // The behavior is undefined unless 'basicAllocator' is 0 or is the
+        // address of an allocator that outlives its installation and every
+        // object created using it.  Note that this method never affects the
+        // process-wide default allocator, nor the thread default allocator of
+        // any other thread.  Also note that
+        // 'bslma::ThreadDefaultAllocatorGuard' is the preferred means of
+        // installing a thread default allocator.
+
+    static Allocator *threadDefaultAllocator();
+        // Return the address of the thread default allocator of the calling
+        // thread, or 0 if none is installed.  Note that this method has no
+        // side-effects.
+
                         // *** global allocator ***
 
     static Allocator *globalAllocator(Allocator *basicAllocator = 0);
@@ -813,6 +869,18 @@ void Default::lockDefaultAllocator()
 inline
 Allocator *Default::defaultAllocator()
 {
+    // A thread that has installed a thread default allocator has itself
+    // incremented 's_numThreadDefaultAllocators', so a relaxed load suffices.
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+             bsls::AtomicOperations::getIntRelaxed(
+                                             &s_numThreadDefaultAllocators))) {
+        Allocator *threadAllocator = threadDefaultAllocator();
+        if (threadAllocator) {
+            return threadAllocator;                                   // RETURN
+        }
+    }
+
     void *alloc = bsls::AtomicOperations::getPtrRelaxed(&s_defaultAllocator);
     return alloc ? static_cast<Allocator *>(alloc)
                  : determineAndReturnDefaultAllocator();
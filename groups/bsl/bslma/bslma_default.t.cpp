@@ -36,7 +36,10 @@ using namespace BloombergLP;
 // accessor); case 3 tests 'setDefaultAllocator' and 'lockDefaultAllocator';
 // and case 4 tests 'allocator'.  The side-effects of 'defaultAllocator' and
 // 'allocator' are then tested in cases specifically targeted at them (cases 5
-// and 6 for 'defaultAllocator', and cases 7 and 8 for 'allocator').
+// and 6 for 'defaultAllocator', and cases 7 and 8 for 'allocator').  The
+// thread default allocator, and its effect on 'defaultAllocator' and
+// 'allocator', are tested in case 10 (its isolation between threads is tested
+// in 'bslma_threaddefaultallocatorguard').
 //-----------------------------------------------------------------------------
 // [ 3] int setDefaultAllocator(*ba);
 // [ 2] void setDefaultAllocatorRaw(*ba);
@@ -45,12 +48,14 @@ using namespace BloombergLP;
 // [ 4] bslma::Allocator *allocator(*ba = 0);
 // [ 9] bslma::Allocator *globalAllocator(*ba = 0);
 // [ 9] bslma::Allocator *setGlobalAllocator(*ba);
+// [10] bslma::Allocator *setThreadDefaultAllocator(*ba);
+// [10] bslma::Allocator *threadDefaultAllocator();
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] BOOTSTRAP TEST
-// [10] USAGE EXAMPLE 1
-// [11] USAGE EXAMPLE 2
-// [12] USAGE EXAMPLE 3
+// [11] USAGE EXAMPLE 1
+// [12] USAGE EXAMPLE 2
+// [13] USAGE EXAMPLE 3
 
 // ============================================================================
 //                     STANDARD BSL ASSERT TEST FUNCTION
@@ -519,7 +524,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 3
         //
@@ -576,7 +581,7 @@ int main(int argc, char *argv[])
 //..
 
       } break;
-      case 11: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         //
@@ -668,7 +673,7 @@ int main(int argc, char *argv[])
 // invocations (i.e., even with correct code).
 
       } break;
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         //
@@ -742,6 +747,65 @@ int main(int argc, char *argv[])
     ASSERT(1 == defaultCountingAllocator.numBlocksTotal());
 //..
 
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING THREAD DEFAULT ALLOCATOR
+        //
+        // Concerns:
+        //   1) Initially, no thread default allocator is installed.
+        //   2) 'setThreadDefaultAllocator' installs (or, given 0, uninstalls)
+        //      the thread default allocator and returns the one previously in
+        //      effect, or 0.
+        //   3) While a thread default allocator is installed,
+        //      'defaultAllocator' and 'allocator' (with no argument or 0)
+        //      return it, and 'allocator' with a non-zero argument returns
+        //      that argument.
+        //   4) Installing and using a thread default allocator neither changes
+        //      nor locks the default allocator, which is again returned once
+        //      the thread default allocator is uninstalled.
+        //
+        // Plan:
+        //   Install, replace, and uninstall thread default allocators,
+        //   verifying the values returned by 'setThreadDefaultAllocator',
+        //   'threadDefaultAllocator', 'defaultAllocator', and 'allocator'
+        //   after each step.  Then verify that 'setDefaultAllocator' succeeds,
+        //   and that the default allocator it sets is returned once the
+        //   thread default allocator is uninstalled.
+        //
+        // Testing:
+        //   bslma::Allocator *setThreadDefaultAllocator(*ba);
+        //   bslma::Allocator *threadDefaultAllocator();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING THREAD DEFAULT ALLOCATOR"
+                            "\n================================\n");
+
+        ASSERT(0 == Obj::threadDefaultAllocator());
+
+        ASSERT(0 == Obj::setThreadDefaultAllocator(U));
+        ASSERT(U == Obj::threadDefaultAllocator());
+        ASSERT(U == Obj::defaultAllocator());
+        ASSERT(U == Obj::allocator());
+        ASSERT(U == Obj::allocator(0));
+        ASSERT(V == Obj::allocator(V));
+
+        ASSERT(U == Obj::setThreadDefaultAllocator(V));
+        ASSERT(V == Obj::threadDefaultAllocator());
+        ASSERT(V == Obj::defaultAllocator());
+
+        ASSERT(0 == Obj::setDefaultAllocator(U));
+        ASSERT(V == Obj::defaultAllocator());
+
+        ASSERT(V == Obj::setThreadDefaultAllocator(0));
+        ASSERT(0 == Obj::threadDefaultAllocator());
+        ASSERT(U == Obj::defaultAllocator());
+        ASSERT(U == Obj::allocator());
+
+        ASSERT(0 != Obj::setDefaultAllocator(V));
+        ASSERT(0 == Obj::setThreadDefaultAllocator(0));
+        ASSERT(U == Obj::defaultAllocator());
+
       } break;
       case 9: {
         // --------------------------------------------------------------------
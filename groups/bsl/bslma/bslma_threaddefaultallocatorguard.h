@@ -0,0 +1,184 @@
+// bslma_threaddefaultallocatorguard.h                                -*-C++-*-
+#ifndef INCLUDED_BSLMA_THREADDEFAULTALLOCATORGUARD
+#define INCLUDED_BSLMA_THREADDEFAULTALLOCATORGUARD
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide scoped guard to install a default allocator for one thread.
+//
+//@CLASSES:
+//  bslma::ThreadDefaultAllocatorGuard: thread default-allocator scoped guard
+//
+//@SEE_ALSO: bslma_default, bslma_defaultallocatorguard
+//
+//@DESCRIPTION: This component provides an object,
+// 'bslma::ThreadDefaultAllocatorGuard', that serves as a "scoped guard" to
+// install an allocator as the *thread* default allocator of the calling thread
+// (see {'bslma_default'|Thread Default Allocator}).  While the guard is in
+// scope, 'bslma::Default::defaultAllocator' (and hence every object created
+// on that thread without an explicitly supplied allocator) uses the guarded
+// allocator; other threads, and the process-wide default allocator, are
+// unaffected.
+//
+// The guard object takes as its constructor argument the address of an object
+// of a class derived from 'bslma::Allocator'.  The thread default allocator of
+// the calling thread at the time of guard construction (possibly none) is held
+// by the guard, and the constructor-argument allocator is installed in its
+// place (via 'bslma::Default::setThreadDefaultAllocator').  Upon destruction
+// of the guard object, its held allocator is reinstalled.  Guards may
+// therefore be nested, provided that they are destroyed on the thread that
+// created them, in the reverse order of their creation.
+//
+// Unlike 'bslma::DefaultAllocatorGuard', which is intended for testing only,
+// this guard is suitable for use in production code, e.g., to direct all of
+// the allocations made while processing a request into an arena.  Note that
+// objects created while the guard is in scope retain the guarded allocator
+// after the guard is destroyed; such objects must be destroyed before the
+// allocator is.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Directing Incidental Allocations to a Request Arena
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server processes each request on one thread, and that the
+// processing creates many short-lived objects (strings, containers, etc.)
+// that do not take an allocator explicitly.  We would like all of that memory
+// to come from an arena that is released in one shot once the request is
+// complete, without changing the default allocator of the other threads.
+//
+// First, we define a type, 'my_Message', that uses the default allocator when
+// none is supplied, as is typical of allocator-aware types:
+//..
+//  class my_Message {
+//      // This class holds a fixed-size message body.
+//
+//      // DATA
+//      bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+//      char             *d_body_p;       // message body (owned)
+//
+//    private:
+//      // NOT IMPLEMENTED
+//      my_Message(const my_Message&);
+//      my_Message& operator=(const my_Message&);
+//
+//    public:
+//      // CREATORS
+//      explicit my_Message(bslma::Allocator *basicAllocator = 0)
+//      : d_allocator_p(bslma::Default::allocator(basicAllocator))
+//      , d_body_p(static_cast<char *>(d_allocator_p->allocate(64)))
+//      {
+//      }
+//
+//      ~my_Message()
+//      {
+//          d_allocator_p->deallocate(d_body_p);
+//      }
+//
+//      // ACCESSORS
+//      bslma::Allocator *allocator() const
+//      {
+//          return d_allocator_p;
+//      }
+//  };
+//..
+// Then, we write a function that processes a request.  In production, the
+// arena would typically be a 'bdlma::SequentialAllocator'; here we use a
+// 'bslma::TestAllocator' so that we can observe its use:
+//..
+//  void processRequest(bslma::TestAllocator *arena)
+//      // Process a request, obtaining all of the memory allocated by default
+//      // on this thread from the specified 'arena'.
+//  {
+//      bslma::ThreadDefaultAllocatorGuard guard(arena);
+//
+//      my_Message request;
+//      my_Message response;
+//
+//      assert(arena == request.allocator());
+//      assert(arena == response.allocator());
+//      assert(2     == arena->numBlocksInUse());
+//  }
+//..
+// Finally, we process a request and observe that the default allocator is
+// restored afterwards:
+//..
+//  bslma::Allocator     *original = bslma::Default::defaultAllocator();
+//  bslma::TestAllocator  arena;
+//
+//  processRequest(&arena);
+//
+//  assert(2        == arena.numBlocksTotal());
+//  assert(0        == arena.numBlocksInUse());
+//  assert(original == bslma::Default::defaultAllocator());
+//  assert(0        == bslma::Default::threadDefaultAllocator());
+//..
+
+#include <bslscm_version.h>
+
+namespace BloombergLP {
+
+namespace bslma {
+
+class Allocator;
+
+                      // =================================
+                      // class ThreadDefaultAllocatorGuard
+                      // =================================
+
+class ThreadDefaultAllocatorGuard {
+    // Upon construction, an object of this class saves the thread default
+    // allocator of the calling thread and installs the user-specified
+    // allocator as the thread default allocator.  On destruction, the original
+    // thread default allocator (possibly none) is reinstalled.  The behavior
+    // is undefined unless an object of this class is destroyed on the thread
+    // that created it.
+
+    Allocator *d_original_p;  // original (to be restored at destruction), or
+                              // 0 if none
+
+    // NOT IMPLEMENTED
+    ThreadDefaultAllocatorGuard(const ThreadDefaultAllocatorGuard&);
+    ThreadDefaultAllocatorGuard& operator=(
+                                           const ThreadDefaultAllocatorGuard&);
+
+  public:
+    // CREATORS
+    explicit
+    ThreadDefaultAllocatorGuard(Allocator *temporary);
+        // Create a scoped guard that installs the specified 'temporary'
+        // allocator as the thread default allocator of the calling thread.
+        // The behavior is undefined unless 'temporary' outlives this guard
+        // and every object created using it.  Note that the thread default
+        // allocator is automatically restored to the original allocator (or
+        // uninstalled, if there was none) on destruction.
+
+    ~ThreadDefaultAllocatorGuard();
+        // Restore the thread default allocator that was in place when this
+        // scoped guard was created (or uninstall the thread default allocator,
+        // if there was none) and destroy this guard.
+};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
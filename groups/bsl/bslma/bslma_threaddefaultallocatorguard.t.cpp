@@ -0,0 +1,490 @@
+// bslma_threaddefaultallocatorguard.t.cpp                            -*-C++-*-
+
+#include <bslma_threaddefaultallocatorguard.h>
+
+#include <bslma_allocator.h>               // for testing only
+#include <bslma_default.h>                 // for testing only
+#include <bslma_newdeleteallocator.h>      // for testing only
+#include <bslma_testallocator.h>           // for testing only
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi'
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test "guards" the thread default allocator of the
+// calling thread, which is to say that an instance of this object saves the
+// thread default allocator (possibly none) in a data member and installs a new
+// thread default allocator (from the constructor argument) on construction,
+// and reinstalls the original on destruction.
+//
+// In addition to the single-threaded concerns (installation, nesting, and
+// restoration), we must verify that a guard affects only the thread on which
+// it is created, and never affects the process-wide default allocator.  We
+// create native threads for the latter, as 'bslma' may not depend on a
+// threading library.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] bslma::ThreadDefaultAllocatorGuard(bslma::Allocator *temporary);
+// [ 2] ~bslma::ThreadDefaultAllocatorGuard();
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] USAGE EXAMPLE
+//=============================================================================
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslma::ThreadDefaultAllocatorGuard Obj;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+extern "C" {
+    typedef void *(*ThreadFunction)(void *arg);
+}
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+namespace TestCase2 {
+
+struct ThreadInfo {
+    bslma::Allocator *d_threadAllocator_p;   // to install, or 0
+    bslma::Allocator *d_observedBefore_p;    // 'defaultAllocator' on entry
+    bslma::Allocator *d_observedDuring_p;    // 'defaultAllocator' when guarded
+    bslma::Allocator *d_observedAfter_p;     // 'defaultAllocator' on exit
+};
+
+extern "C" void *threadFunction(void *arg)
+    // Record the default allocator observed by this thread before, while,
+    // and after installing the thread allocator specified by 'arg' (if any).
+{
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+
+    info->d_observedBefore_p = bslma::Default::defaultAllocator();
+
+    if (info->d_threadAllocator_p) {
+        Obj guard(info->d_threadAllocator_p);
+
+        info->d_observedDuring_p = bslma::Default::defaultAllocator();
+    }
+    else {
+        info->d_observedDuring_p = bslma::Default::defaultAllocator();
+    }
+
+    info->d_observedAfter_p = bslma::Default::defaultAllocator();
+
+    return 0;
+}
+
+}  // close namespace TestCase2
+
+//=============================================================================
+//                  CLASSES FOR TESTING USAGE EXAMPLES
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Directing Incidental Allocations to a Request Arena
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server processes each request on one thread, and that the
+// processing creates many short-lived objects (strings, containers, etc.)
+// that do not take an allocator explicitly.  We would like all of that memory
+// to come from an arena that is released in one shot once the request is
+// complete, without changing the default allocator of the other threads.
+//
+// First, we define a type, 'my_Message', that uses the default allocator when
+// none is supplied, as is typical of allocator-aware types:
+//..
+    class my_Message {
+        // This class holds a fixed-size message body.
+
+        // DATA
+        bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+        char             *d_body_p;       // message body (owned)
+
+      private:
+        // NOT IMPLEMENTED
+        my_Message(const my_Message&);
+        my_Message& operator=(const my_Message&);
+
+      public:
+        // CREATORS
+        explicit my_Message(bslma::Allocator *basicAllocator = 0)
+        : d_allocator_p(bslma::Default::allocator(basicAllocator))
+        , d_body_p(static_cast<char *>(d_allocator_p->allocate(64)))
+        {
+        }
+
+        ~my_Message()
+        {
+            d_allocator_p->deallocate(d_body_p);
+        }
+
+        // ACCESSORS
+        bslma::Allocator *allocator() const
+        {
+            return d_allocator_p;
+        }
+    };
+//..
+// Then, we write a function that processes a request.  In production, the
+// arena would typically be a 'bdlma::SequentialAllocator'; here we use a
+// 'bslma::TestAllocator' so that we can observe its use:
+//..
+    void processRequest(bslma::TestAllocator *arena)
+        // Process a request, obtaining all of the memory allocated by default
+        // on this thread from the specified 'arena'.
+    {
+        bslma::ThreadDefaultAllocatorGuard guard(arena);
+
+        my_Message request;
+        my_Message response;
+
+        ASSERT(arena == request.allocator());
+        ASSERT(arena == response.allocator());
+        ASSERT(2     == arena->numBlocksInUse());
+    }
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;           // suppress unused variable warning
+    (void)veryVeryVerbose;       // suppress unused variable warning
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove
+        //   leading comment characters, and replace 'assert' with
+        //   'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Finally, we process a request and observe that the default allocator is
+// restored afterwards:
+//..
+    bslma::Allocator     *original = bslma::Default::defaultAllocator();
+    bslma::TestAllocator  arena(veryVeryVeryVerbose);
+
+    processRequest(&arena);
+
+    ASSERT(2        == arena.numBlocksTotal());
+    ASSERT(0        == arena.numBlocksInUse());
+    ASSERT(original == bslma::Default::defaultAllocator());
+    ASSERT(0        == bslma::Default::threadDefaultAllocator());
+//..
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CTOR AND DTOR
+        //
+        // Concerns:
+        //: 1 The guard installs the supplied allocator as the thread default
+        //:   allocator, so that 'bslma::Default::defaultAllocator' and
+        //:   'bslma::Default::allocator(0)' return it.
+        //:
+        //: 2 On destruction, the guard restores the thread default allocator
+        //:   in effect at its construction, or uninstalls it if there was
+        //:   none.
+        //:
+        //: 3 Guards nest.
+        //:
+        //: 4 The guard does not change, or lock, the process-wide default
+        //:   allocator.
+        //:
+        //: 5 The guard affects only the thread that created it.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create nested guards, and verify the default allocator and the
+        //:   thread default allocator in each scope.  (C-1..3)
+        //:
+        //: 2 Set the process-wide default allocator after the guards are
+        //:   destroyed, and verify that the call succeeds.  (C-4)
+        //:
+        //: 3 While a guard is installed on the main thread, create threads
+        //:   with and without guards of their own, and verify the default
+        //:   allocator observed by each.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null allocator.  (C-6)
+        //
+        // Testing:
+        //   bslma::ThreadDefaultAllocatorGuard(bslma::Allocator *temporary);
+        //   ~bslma::ThreadDefaultAllocatorGuard();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCTOR AND DTOR"
+                            "\n=============\n");
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator ta("thread",   veryVeryVeryVerbose);
+        bslma::TestAllocator ua("thread 2", veryVeryVeryVerbose);
+        bslma::TestAllocator va("thread 3", veryVeryVeryVerbose);
+
+        if (verbose) printf("\nInstalling, nesting, and restoring.\n");
+        {
+            ASSERT(0 == bslma::Default::threadDefaultAllocator());
+            {
+                Obj outer(&ta);
+
+                ASSERT(&ta == bslma::Default::threadDefaultAllocator());
+                ASSERT(&ta == bslma::Default::defaultAllocator());
+                ASSERT(&ta == bslma::Default::allocator());
+                ASSERT(&ta == bslma::Default::allocator(0));
+                ASSERT(&ua == bslma::Default::allocator(&ua));
+                {
+                    Obj inner(&ua);
+
+                    ASSERT(&ua == bslma::Default::threadDefaultAllocator());
+                    ASSERT(&ua == bslma::Default::defaultAllocator());
+                }
+                ASSERT(&ta == bslma::Default::threadDefaultAllocator());
+                ASSERT(&ta == bslma::Default::defaultAllocator());
+            }
+            ASSERT(0 == bslma::Default::threadDefaultAllocator());
+        }
+
+        if (verbose) printf("\nProcess-wide default is not locked.\n");
+        {
+            ASSERT(0 == bslma::Default::setDefaultAllocator(&da));
+            ASSERT(&da == bslma::Default::defaultAllocator());
+            ASSERT(0 != bslma::Default::setDefaultAllocator(&ta));
+        }
+
+        if (verbose) printf("\nIsolation between threads.\n");
+        {
+            Obj guard(&ta);
+
+            TestCase2::ThreadInfo unguarded = { 0,   0, 0, 0 };
+            TestCase2::ThreadInfo guardedU  = { &ua, 0, 0, 0 };
+            TestCase2::ThreadInfo guardedV  = { &va, 0, 0, 0 };
+
+            ThreadId id1 = createThread(&TestCase2::threadFunction,
+                                        &unguarded);
+            ThreadId id2 = createThread(&TestCase2::threadFunction,
+                                        &guardedU);
+            ThreadId id3 = createThread(&TestCase2::threadFunction,
+                                        &guardedV);
+            joinThread(id1);
+            joinThread(id2);
+            joinThread(id3);
+
+            ASSERT(&da == unguarded.d_observedBefore_p);
+            ASSERT(&da == unguarded.d_observedDuring_p);
+            ASSERT(&da == unguarded.d_observedAfter_p);
+
+            ASSERT(&da == guardedU.d_observedBefore_p);
+            ASSERT(&ua == guardedU.d_observedDuring_p);
+            ASSERT(&da == guardedU.d_observedAfter_p);
+
+            ASSERT(&da == guardedV.d_observedBefore_p);
+            ASSERT(&va == guardedV.d_observedDuring_p);
+            ASSERT(&da == guardedV.d_observedAfter_p);
+
+            ASSERT(&ta == bslma::Default::defaultAllocator());
+        }
+        ASSERT(&da == bslma::Default::defaultAllocator());
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS((Obj(&ta)));
+            ASSERT_FAIL((Obj(0)));
+        }
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //   1. A guard installs its allocator as the default allocator of the
+        //      calling thread.
+        //   2. On destruction, the process-wide default allocator is again
+        //      the default allocator of the calling thread.
+        //
+        // Plan:
+        //   Create a guard in an inner scope, and verify the default
+        //   allocator inside and after that scope.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        {
+            bslma::NewDeleteAllocator *na =
+                                      &bslma::NewDeleteAllocator::singleton();
+            ASSERT(na == bslma::Default::defaultAllocator());
+
+            {
+                bslma::TestAllocator testAllocator(veryVeryVeryVerbose);
+                Obj                  guard(&testAllocator);
+
+                ASSERT(&testAllocator == bslma::Default::defaultAllocator());
+
+                void *p = bslma::Default::allocator()->allocate(10);
+                ASSERT(1 == testAllocator.numBlocksInUse());
+                bslma::Default::allocator()->deallocate(p);
+            }
+            ASSERT(na == bslma::Default::defaultAllocator());
+        }
+      } break;
+
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
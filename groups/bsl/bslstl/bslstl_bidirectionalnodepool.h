@@ -237,6 +237,9 @@ class BidirectionalNodePool {
     typedef typename AllocatorTraits::size_type size_type;
         // Alias for the 'size_type' of the allocator defined by 'SimplePool'.
 
+    typedef typename Pool::Arena Arena;
+        // Alias for the arena type defined by 'SimplePool'.
+
   public:
     // CREATORS
     explicit BidirectionalNodePool(const ALLOCATOR& allocator);
@@ -260,6 +263,29 @@ class BidirectionalNodePool {
         // nodes are explicitly destroyed via the 'destroyNode' method.
 
     // MANIPULATORS
+    Arena *acquireArena();
+        // Return the address of the arena of the memory pool maintained by
+        // this object, creating it if necessary, with a reference added on
+        // behalf of the caller.  Nodes allocated from this object remain valid
+        // until that reference is released, even if this object is destroyed
+        // first.  See 'bslstl_simplepool'.
+
+    void joinArena(Arena *arena);
+        // Make the memory pool maintained by this object a member of the same
+        // group as the specified 'arena', so that nodes allocated from a pool
+        // belonging to 'arena' may be deleted by this object.  This method
+        // does not allocate memory.  The behavior is undefined unless the
+        // caller holds a reference to 'arena', and this object uses an
+        // allocator equal to that of the pools belonging to 'arena'.  See
+        // 'bslstl_simplepool'.
+
+    void shareArena(BidirectionalNodePool& other);
+        // Make the memory pools maintained by this object and the specified
+        // 'other' object members of the same group, so that nodes allocated
+        // from either object may be deleted by the other.  The behavior is
+        // undefined unless 'allocator() == other.allocator()'.  See
+        // 'bslstl_simplepool'.
+
     void adopt(bslmf::MovableRef<BidirectionalNodePool> pool);
         // Adopt all outstanding memory allocations associated with the
         // specified node 'pool'.  The behavior is undefined unless this pool
@@ -533,6 +559,29 @@ BidirectionalNodePool<VALUE, ALLOCATOR>::BidirectionalNodePool(
 }
 
 // MANIPULATORS
+template <class VALUE, class ALLOCATOR>
+inline
+typename SimplePool<bslalg::BidirectionalNode<VALUE>, ALLOCATOR>::Arena *
+BidirectionalNodePool<VALUE, ALLOCATOR>::acquireArena()
+{
+    return d_pool.acquireArena();
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+void BidirectionalNodePool<VALUE, ALLOCATOR>::joinArena(Arena *arena)
+{
+    d_pool.joinArena(arena);
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+void BidirectionalNodePool<VALUE, ALLOCATOR>::shareArena(
+                                                  BidirectionalNodePool& other)
+{
+    d_pool.shareArena(other.d_pool);
+}
+
 template <class VALUE, class ALLOCATOR>
 inline
 void BidirectionalNodePool<VALUE, ALLOCATOR>::adopt(
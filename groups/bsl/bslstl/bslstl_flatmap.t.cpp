@@ -0,0 +1,1103 @@
+// bslstl_flatmap.t.cpp                                               -*-C++-*-
+#include <bslstl_flatmap.h>
+
+#include <bslstl_pair.h>
+#include <bslstl_stdexceptutil.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+
+#include <functional>   // 'std::less', 'std::greater'
+#include <stdexcept>    // 'std::out_of_range'
+
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi'
+#include <string.h>     // 'strlen'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a value-semantic container adapter whose
+// algorithms are provided (and thoroughly tested) by 'bslstl_flattree'.  The
+// concerns of this test driver are therefore that each method of 'flat_map'
+// forwards to the correct method of the tree with "unique" semantics, that
+// the allocator is propagated as documented, and that the interface matches
+// that of 'bsl::map' (including 'operator[]' and 'at').
+//
+// We use 'flat_map<int, int>' for most tests, describing a value with a
+// string of characters each denoting a key, whose mapped value is derived
+// from the key, and 'flat_map<bsl::string, bsl::string>' where the allocator
+// propagated to the elements is of concern.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_map();
+// [ 2] flat_map(const COMPARATOR&, const ALLOCATOR&);
+// [ 2] flat_map(const ALLOCATOR&);
+// [ 6] flat_map(const flat_map&);
+// [ 6] flat_map(MovableRef<flat_map>);
+// [ 6] flat_map(const flat_map&, const ALLOCATOR&);
+// [ 6] flat_map(MovableRef<flat_map>, const ALLOCATOR&);
+// [ 2] flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const COMPARATOR&, ...);
+// [ 2] flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const ALLOCATOR&);
+// [ 2] flat_map(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR, ...);
+// [ 2] flat_map(initializer_list<value_type>, ...);
+//
+// MANIPULATORS
+// [ 6] flat_map& operator=(const flat_map&);
+// [ 6] flat_map& operator=(MovableRef<flat_map>);
+// [ 3] VALUE& operator[](const key_type&);
+// [ 3] VALUE& operator[](MovableRef<key_type>);
+// [ 3] VALUE& at(const key_type&);
+// [ 4] pair<iterator, bool> insert(const value_type&);
+// [ 4] pair<iterator, bool> insert(MovableRef<value_type>);
+// [ 4] iterator insert(const_iterator, const value_type&);
+// [ 4] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 4] void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 4] void insert(initializer_list<value_type>);
+// [ 4] pair<iterator, bool> emplace(Args&&...);
+// [ 4] iterator emplace_hint(const_iterator, Args&&...);
+// [ 5] iterator erase(const_iterator);
+// [ 5] size_type erase(const key_type&);
+// [ 5] iterator erase(const_iterator, const_iterator);
+// [ 6] void swap(flat_map&);
+// [ 1] void clear();
+// [ 1] void reserve(size_type);
+// [ 1] void shrink_to_fit();
+//
+// ACCESSORS
+// [ 3] const VALUE& at(const key_type&) const;
+// [ 5] const_iterator find(const key_type&) const;
+// [ 5] size_type count(const key_type&) const;
+// [ 5] bool contains(const key_type&) const;
+// [ 5] const_iterator lower_bound(const key_type&) const;
+// [ 5] const_iterator upper_bound(const key_type&) const;
+// [ 5] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 5] iterator find(const LOOKUP_KEY&);
+// [ 5] iterator lower_bound(const LOOKUP_KEY&);
+// [ 5] iterator upper_bound(const LOOKUP_KEY&);
+// [ 5] pair<iterator, iterator> equal_range(const LOOKUP_KEY&);
+// [ 5] const_iterator find(const LOOKUP_KEY&) const;
+// [ 5] size_type count(const LOOKUP_KEY&) const;
+// [ 5] bool contains(const LOOKUP_KEY&) const;
+// [ 5] const_iterator lower_bound(const LOOKUP_KEY&) const;
+// [ 5] const_iterator upper_bound(const LOOKUP_KEY&) const;
+// [ 5] pair<const_iterator, ...> equal_range(const LOOKUP_KEY&) const;
+// [ 2] key_compare key_comp() const;
+// [ 2] value_compare value_comp() const;
+//
+// FREE OPERATORS
+// [ 6] bool operator==(const flat_map&, const flat_map&);
+// [ 6] bool operator!=(const flat_map&, const flat_map&);
+// [ 6] bool operator< (const flat_map&, const flat_map&);
+// [ 6] void swap(flat_map&, flat_map&);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] TYPE TRAITS
+// [ 7] USAGE EXAMPLE
+//=============================================================================
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::flat_map<int, int>                   Obj;
+typedef Obj::value_type                           Value;
+
+typedef bsl::flat_map<bsl::string, bsl::string>   StringObj;
+typedef StringObj::value_type                     StringValue;
+
+typedef bslmf::MovableRefUtil                     MoveUtil;
+
+//=============================================================================
+//                       GLOBAL CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct Decade {
+    // This 'struct' denotes the range of integers '[10 * d_value .. 10 *
+    // d_value + 9]', and is used as a lookup key equivalent to every key in
+    // that range.
+
+    int d_value;  // integer divided by 10
+};
+
+struct TransparentLess {
+    // This 'struct' provides a transparent comparator ordering 'int' keys and
+    // 'Decade' lookup keys.
+
+    typedef void is_transparent;
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' is less than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs < rhs;
+    }
+
+    bool operator()(int lhs, const Decade& rhs) const
+        // Return 'true' if the specified 'lhs' is ordered before every
+        // integer in the specified 'rhs' range, and 'false' otherwise.
+    {
+        return lhs / 10 < rhs.d_value;
+    }
+
+    bool operator()(const Decade& lhs, int rhs) const
+        // Return 'true' if the specified 'rhs' is ordered after every integer
+        // in the specified 'lhs' range, and 'false' otherwise.
+    {
+        return lhs.d_value < rhs / 10;
+    }
+};
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+bsl::vector<Value> toValues(const char *spec)
+    // Return the sequence of values described by the specified 'spec', in
+    // which each character 'c' denotes the value '(c - 'A', 10 * (c - 'A'))'.
+{
+    bsl::vector<Value> result;
+    for (; *spec; ++spec) {
+        result.push_back(Value(*spec - 'A', 10 * (*spec - 'A')));
+    }
+    return result;
+}
+
+Obj& gg(Obj *object, const char *spec)
+    // Insert into the specified 'object' the values described by the
+    // specified 'spec', and return a reference providing modifiable access to
+    // 'object'.
+{
+    const bsl::vector<Value> values = toValues(spec);
+    object->insert(values.begin(), values.end());
+    return *object;
+}
+
+bool isSpec(const Obj& object, const char *spec)
+    // Return 'true' if the specified 'object' holds exactly the sequence of
+    // values described by the specified 'spec', and 'false' otherwise.
+{
+    Obj::const_iterator it = object.begin();
+    for (; *spec; ++spec, ++it) {
+        if (object.end() == it
+         || Value(*spec - 'A', 10 * (*spec - 'A')) != *it) {
+            return false;                                             // RETURN
+        }
+    }
+    return object.end() == it;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;       // suppress unused variable warning
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator         defaultAllocator("default",
+                                                  veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove
+        //   leading comment characters, and replace 'assert' with
+        //   'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        bslma::TestAllocator         ua("usage", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard usageGuard(&ua);
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Symbol Table Built Once and Queried Often
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a table mapping ticker symbols to their instrument
+// identifiers.  The table is loaded at startup and then queried on every
+// incoming message, so lookup speed matters far more than update speed.
+//
+// First, we define the type of the table:
+//..
+    typedef bsl::flat_map<bsl::string, int> SymbolTable;
+//..
+// Then, we load the table from a list of entries, with a single range
+// construction so that the entries are sorted once rather than inserted one
+// by one:
+//..
+    typedef bsl::pair<bsl::string, int> Entry;
+
+    bsl::vector<Entry> entries;
+    entries.push_back(Entry("MSFT", 1003));
+    entries.push_back(Entry("AAPL", 1001));
+    entries.push_back(Entry("IBM",  1002));
+
+    SymbolTable table(entries.begin(), entries.end());
+
+    ASSERT(3 == table.size());
+//..
+// Next, we query the table:
+//..
+    SymbolTable::const_iterator it = table.find("IBM");
+    ASSERT(table.end() != it);
+    ASSERT(1002        == it->second);
+
+    ASSERT(!table.contains("GOOG"));
+//..
+// Now, we add an entry after the initial load, which is fine when done
+// rarely:
+//..
+    table["GOOG"] = 1004;
+    ASSERT(4 == table.size());
+//..
+// Finally, we observe that iteration visits the entries in key order:
+//..
+    ASSERT("AAPL" == table.begin()->first);
+    ASSERT("MSFT" == table.rbegin()->first);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 The copy constructor and copy-assignment operator reproduce the
+        //:   value of the source, using the default allocator, the supplied
+        //:   allocator, or the allocator of the target, respectively.
+        //:
+        //: 2 Moves between objects having equal allocators allocate no
+        //:   memory, and moves between objects having unequal allocators
+        //:   reproduce the value using the allocator of the target.
+        //:
+        //: 3 'swap' (member and free) exchanges values, and allocates no
+        //:   memory if the allocators are equal.
+        //:
+        //: 4 The equality and relational operators compare the ordered
+        //:   sequences of key-value pairs.
+        //
+        // Plan:
+        //: 1 Perform each operation on objects of known value created with
+        //:   test allocators, and verify the values, allocators, and
+        //:   allocations of the results.  (C-1..3)
+        //:
+        //: 2 Compare objects created from a table of specifications with
+        //:   every other such object.  (C-4)
+        //
+        // Testing:
+        //   flat_map(const flat_map&);
+        //   flat_map(MovableRef<flat_map>);
+        //   flat_map(const flat_map&, const ALLOCATOR&);
+        //   flat_map(MovableRef<flat_map>, const ALLOCATOR&);
+        //   flat_map& operator=(const flat_map&);
+        //   flat_map& operator=(MovableRef<flat_map>);
+        //   void swap(flat_map&);
+        //   bool operator==(const flat_map&, const flat_map&);
+        //   bool operator!=(const flat_map&, const flat_map&);
+        //   bool operator< (const flat_map&, const flat_map&);
+        //   void swap(flat_map&, flat_map&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, MOVE, SWAP, AND COMPARISON"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        if (verbose) printf("\tCopy.\n");
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+            mX["alpha"] = "a value long enough to allocate memory";
+            mX["beta"]  = "b";
+
+            StringObj mY(X, &za);  const StringObj& Y = mY;
+            ASSERT(X == Y);
+            ASSERT(&za == Y.get_allocator());
+            ASSERT(&za == Y.begin()->second.get_allocator());
+
+            StringObj mZ(&oa);  const StringObj& Z = mZ;
+            mZ = Y;
+            ASSERT(X == Z);
+            ASSERT(&oa == Z.get_allocator());
+            ASSERT(&oa == Z.begin()->second.get_allocator());
+
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+            {
+                StringObj mW(X);  const StringObj& W = mW;
+                ASSERT(X == W);
+                ASSERT(&defaultAllocator == W.get_allocator());
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tMove.\n");
+        {
+            Obj mX(&oa);  const Obj& X = gg(&mX, "ABC");
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            Obj mY(MoveUtil::move(mX));  const Obj& Y = mY;
+            ASSERT(isSpec(Y, "ABC"));
+            ASSERT(&oa == Y.get_allocator());
+
+            Obj mZ(MoveUtil::move(mY), &oa);  const Obj& Z = mZ;
+            ASSERT(isSpec(Z, "ABC"));
+
+            mX = MoveUtil::move(mZ);
+            ASSERT(isSpec(X, "ABC"));
+            ASSERT(oam.isTotalSame());
+
+            Obj mW(MoveUtil::move(mX), &za);  const Obj& W = mW;
+            ASSERT(isSpec(W, "ABC"));
+            ASSERT(&za == W.get_allocator());
+            ASSERT(oam.isTotalSame());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tSwap.\n");
+        {
+            Obj mX(&oa);  const Obj& X = gg(&mX, "ABC");
+            Obj mY(&oa);  const Obj& Y = gg(&mY, "D");
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.swap(mY);
+            ASSERT(isSpec(X, "D"));
+            ASSERT(isSpec(Y, "ABC"));
+
+            swap(mX, mY);
+            ASSERT(isSpec(X, "ABC"));
+            ASSERT(isSpec(Y, "D"));
+            ASSERT(oam.isTotalSame());
+
+            Obj mZ(&za);  const Obj& Z = gg(&mZ, "EF");
+
+            mX.swap(mZ);
+            ASSERT(isSpec(X, "EF"));
+            ASSERT(isSpec(Z, "ABC"));
+            ASSERT(&oa == X.get_allocator());
+            ASSERT(&za == Z.get_allocator());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tComparison.\n");
+        {
+            static const char *SPECS[] = {
+                "", "A", "AB", "ABC", "ABD", "B", "BC", "C"
+            };  // in increasing order
+            const int NUM_SPECS = static_cast<int>(sizeof SPECS
+                                                   / sizeof *SPECS);
+
+            for (int i = 0; i < NUM_SPECS; ++i) {
+                Obj mX(&oa);  const Obj& X = gg(&mX, SPECS[i]);
+
+                for (int j = 0; j < NUM_SPECS; ++j) {
+                    Obj mY(&oa);  const Obj& Y = gg(&mY, SPECS[j]);
+
+                    if (veryVerbose) { T_ P_(SPECS[i]) P(SPECS[j]) }
+
+                    ASSERTV(i, j, (i == j) == (X == Y));
+                    ASSERTV(i, j, (i != j) == (X != Y));
+                    ASSERTV(i, j, (i <  j) == (X <  Y));
+                    ASSERTV(i, j, (i >  j) == (X >  Y));
+                    ASSERTV(i, j, (i <= j) == (X <= Y));
+                    ASSERTV(i, j, (i >= j) == (X >= Y));
+                }
+            }
+
+            // Equal keys, different mapped values.
+
+            Obj mX(&oa);  const Obj& X = gg(&mX, "AB");
+            Obj mY(&oa);  const Obj& Y = gg(&mY, "AB");
+            mY[1] = 0;
+            ASSERT(X != Y);
+            ASSERT(Y <  X);
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ERASE AND LOOKUP
+        //
+        // Concerns:
+        //: 1 Each 'erase' method removes the designated elements and returns
+        //:   the documented result.
+        //:
+        //: 2 The lookup methods report the positions of the element having a
+        //:   key, whether or not such an element is present, in both 'const'
+        //:   and non-'const' objects.
+        //:
+        //: 3 If the comparator is transparent, the lookup methods accept any
+        //:   key type the comparator supports, without converting it to
+        //:   'key_type', and report all the elements equivalent to that key.
+        //
+        // Plan:
+        //: 1 For each key of a small range, verify the results of the lookup
+        //:   methods on an object of known value, then erase the key using
+        //:   each 'erase' method and verify the result.  (C-1..2)
+        //:
+        //: 2 Using a transparent comparator, for which a lookup key may be
+        //:   equivalent to several keys, verify the results of the lookup
+        //:   methods for lookup keys equivalent to none, one, and several
+        //:   elements of an object of known value.  (C-3)
+        //
+        // Testing:
+        //   iterator erase(const_iterator);
+        //   size_type erase(const key_type&);
+        //   iterator erase(const_iterator, const_iterator);
+        //   const_iterator find(const key_type&) const;
+        //   size_type count(const key_type&) const;
+        //   bool contains(const key_type&) const;
+        //   const_iterator lower_bound(const key_type&) const;
+        //   const_iterator upper_bound(const key_type&) const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        //   iterator find(const LOOKUP_KEY&);
+        //   iterator lower_bound(const LOOKUP_KEY&);
+        //   iterator upper_bound(const LOOKUP_KEY&);
+        //   pair<iterator, iterator> equal_range(const LOOKUP_KEY&);
+        //   const_iterator find(const LOOKUP_KEY&) const;
+        //   size_type count(const LOOKUP_KEY&) const;
+        //   bool contains(const LOOKUP_KEY&) const;
+        //   const_iterator lower_bound(const LOOKUP_KEY&) const;
+        //   const_iterator upper_bound(const LOOKUP_KEY&) const;
+        //   pair<const_iterator, ...> equal_range(const LOOKUP_KEY&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nERASE AND LOOKUP"
+                            "\n================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const char SPEC[]   = "BDF";
+        const int  NUM_KEYS = 7;    // keys 'A' .. 'G'
+
+        for (int key = 0; key < NUM_KEYS; ++key) {
+            Obj mX(&oa);  const Obj& X = gg(&mX, SPEC);
+
+            const bool           FOUND = 1 == (key % 2);
+            const Obj::size_type NUM   = FOUND ? 1 : 0;
+            const Obj::size_type LOWER = key / 2;
+            const Obj::size_type UPPER = LOWER + NUM;
+
+            if (veryVerbose) { T_ P_(key) P_(FOUND) P(LOWER) }
+
+            ASSERTV(key, FOUND == X.contains(key));
+            ASSERTV(key, NUM   == X.count(key));
+            ASSERTV(key, (FOUND ? X.begin() + LOWER : X.end()) == X.find(key));
+            ASSERTV(key, X.begin() + LOWER == X.lower_bound(key));
+            ASSERTV(key, X.begin() + UPPER == X.upper_bound(key));
+            ASSERTV(key, X.begin() + LOWER == X.equal_range(key).first);
+            ASSERTV(key, X.begin() + UPPER == X.equal_range(key).second);
+
+            ASSERTV(key, mX.begin() + LOWER == mX.lower_bound(key));
+            ASSERTV(key, mX.begin() + UPPER == mX.upper_bound(key));
+            ASSERTV(key, (FOUND ? mX.begin() + LOWER : mX.end())
+                                                            == mX.find(key));
+
+            Obj mY(X, &oa);  const Obj& Y = mY;
+            ASSERTV(key, NUM   == mY.erase(key));
+            ASSERTV(key, X.size() - NUM == Y.size());
+            ASSERTV(key, !Y.contains(key));
+
+            if (FOUND) {
+                Obj mZ(X, &oa);  const Obj& Z = mZ;
+                Obj::iterator it = mZ.erase(mZ.find(key));
+                ASSERTV(key, Z == Y);
+                ASSERTV(key, Z.begin() + LOWER == it);
+            }
+
+            Obj mW(X, &oa);  const Obj& W = mW;
+            Obj::iterator it = mW.erase(mW.lower_bound(key),
+                                        mW.upper_bound(key));
+            ASSERTV(key, W == Y);
+            ASSERTV(key, W.begin() + LOWER == it);
+        }
+
+        {
+            Obj mX(&oa);  const Obj& X = gg(&mX, "ABCDE");
+            Obj::iterator it = mX.erase(X.begin() + 1, X.end() - 1);
+            ASSERT(isSpec(X, "AE"));
+            ASSERT(X.begin() + 1 == it);
+        }
+
+        if (verbose) printf("\tTransparent lookup.\n");
+        {
+            typedef bsl::flat_map<int, int, TransparentLess> TransparentObj;
+
+            TransparentObj mX(&oa);  const TransparentObj& X = mX;
+            const int KEYS[] = { 1, 5, 12, 15, 17, 30 };
+            for (int i = 0; i < 6; ++i) {
+                mX[KEYS[i]] = i;
+            }
+
+            static const struct {
+                int d_line;
+                int d_decade;  // lookup key
+                int d_lower;   // index of the first equivalent element
+                int d_num;     // number of equivalent elements
+            } DATA[] = {
+                //LINE  DECADE  LOWER  NUM
+                //----  ------  -----  ---
+                { L_,   0,      0,     2   },
+                { L_,   1,      2,     3   },
+                { L_,   2,      5,     0   },
+                { L_,   3,      5,     1   },
+                { L_,   4,      6,     0   },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int    LINE  = DATA[ti].d_line;
+                const Decade KEY   = { DATA[ti].d_decade };
+                const int    LOWER = DATA[ti].d_lower;
+                const int    UPPER = LOWER + DATA[ti].d_num;
+                const bool   FOUND = 0 < DATA[ti].d_num;
+
+                if (veryVerbose) { T_ P_(LINE) P_(KEY.d_value) P(LOWER) }
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                ASSERTV(LINE, FOUND == X.contains(KEY));
+                ASSERTV(LINE, UPPER - LOWER ==
+                                          static_cast<int>(X.count(KEY)));
+                ASSERTV(LINE, (FOUND ? X.begin() + LOWER : X.end())
+                                                             == X.find(KEY));
+                ASSERTV(LINE, X.begin() + LOWER == X.lower_bound(KEY));
+                ASSERTV(LINE, X.begin() + UPPER == X.upper_bound(KEY));
+                ASSERTV(LINE, X.begin() + LOWER == X.equal_range(KEY).first);
+                ASSERTV(LINE, X.begin() + UPPER == X.equal_range(KEY).second);
+
+                ASSERTV(LINE, (FOUND ? mX.begin() + LOWER : mX.end())
+                                                            == mX.find(KEY));
+                ASSERTV(LINE, mX.begin() + LOWER == mX.lower_bound(KEY));
+                ASSERTV(LINE, mX.begin() + UPPER == mX.upper_bound(KEY));
+                ASSERTV(LINE, mX.begin() + LOWER
+                                              == mX.equal_range(KEY).first);
+                ASSERTV(LINE, mX.begin() + UPPER
+                                             == mX.equal_range(KEY).second);
+
+                ASSERTV(LINE, oam.isTotalSame());
+            }
+
+            // Lookup by 'key_type' is unaffected.
+
+            ASSERT(1 == X.count(12));
+            ASSERT(X.begin() + 2 == X.find(12));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // INSERTION
+        //
+        // Concerns:
+        //: 1 The single-value 'insert' and 'emplace' methods insert a value
+        //:   only if its key is not present, and report the position of the
+        //:   element having that key and whether the value was inserted.
+        //:
+        //: 2 The hinted methods produce the same value whether or not the
+        //:   hint is correct.
+        //:
+        //: 3 The range methods insert each value whose key is neither
+        //:   present nor that of an earlier value of the range.
+        //:
+        //: 4 An inserted value is moved, rather than copied, when supplied
+        //:   as a 'MovableRef'.
+        //:
+        //: 5 Elements are created with the allocator of the container.
+        //
+        // Plan:
+        //: 1 Using a table of initial values and inserted values, perform
+        //:   each insertion and verify the resulting value.  (C-1..3)
+        //:
+        //: 2 Insert a 'bsl::string' key-value pair by move, and verify that
+        //:   the source was moved from and the element uses the allocator of
+        //:   the container.  (C-4..5)
+        //
+        // Testing:
+        //   pair<iterator, bool> insert(const value_type&);
+        //   pair<iterator, bool> insert(MovableRef<value_type>);
+        //   iterator insert(const_iterator, const value_type&);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(initializer_list<value_type>);
+        //   pair<iterator, bool> emplace(Args&&...);
+        //   iterator emplace_hint(const_iterator, Args&&...);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINSERTION"
+                            "\n=========\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        static const struct {
+            int         d_line;
+            const char *d_initial_p;   // initial value
+            const char *d_range_p;     // inserted values
+            const char *d_result_p;    // expected value
+        } DATA[] = {
+            //LINE  INITIAL  RANGE     RESULT
+            //----  -------  -----     ------
+            { L_,   "",      "",       ""         },
+            { L_,   "",      "A",      "A"        },
+            { L_,   "A",     "A",      "A"        },
+            { L_,   "B",     "CA",     "ABC"      },
+            { L_,   "BD",    "EDCA",   "ABCDE"    },
+            { L_,   "ACE",   "BBDD",   "ABCDE"    },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            const char *const INITIAL = DATA[ti].d_initial_p;
+            const char *const RANGE   = DATA[ti].d_range_p;
+            const char *const RESULT  = DATA[ti].d_result_p;
+
+            if (veryVerbose) { T_ P_(LINE) P_(INITIAL) P(RANGE) }
+
+            const bsl::vector<Value> values = toValues(RANGE);
+
+            {
+                Obj mX(&oa);  const Obj& X = gg(&mX, INITIAL);
+                mX.insert(values.begin(), values.end());
+                ASSERTV(LINE, isSpec(X, RESULT));
+            }
+            {
+                Obj mX(&oa);  const Obj& X = gg(&mX, INITIAL);
+                for (size_t i = 0; i < values.size(); ++i) {
+                    const bool PRESENT = X.contains(values[i].first);
+
+                    bsl::pair<Obj::iterator, bool> result =
+                                                        mX.insert(values[i]);
+                    ASSERTV(LINE, i, PRESENT != result.second);
+                    ASSERTV(LINE, i, values[i] == *result.first);
+                }
+                ASSERTV(LINE, isSpec(X, RESULT));
+            }
+            {
+                Obj mX(&oa);  const Obj& X = gg(&mX, INITIAL);
+                for (size_t i = 0; i < values.size(); ++i) {
+                    // Use a hint that is usually wrong.
+
+                    Obj::iterator it = mX.insert(X.begin(), values[i]);
+                    ASSERTV(LINE, i, values[i] == *it);
+                }
+                ASSERTV(LINE, isSpec(X, RESULT));
+            }
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+            {
+                Obj mX(&oa);  const Obj& X = gg(&mX, INITIAL);
+                for (size_t i = 0; i < values.size(); ++i) {
+                    const bool PRESENT = X.contains(values[i].first);
+
+                    bsl::pair<Obj::iterator, bool> result =
+                              mX.emplace(values[i].first, values[i].second);
+                    ASSERTV(LINE, i, PRESENT != result.second);
+                    ASSERTV(LINE, i, values[i] == *result.first);
+
+                    Obj::iterator it = mX.emplace_hint(X.end(), values[i]);
+                    ASSERTV(LINE, i, result.first == it);
+                }
+                ASSERTV(LINE, isSpec(X, RESULT));
+            }
+#endif
+        }
+
+        if (verbose) printf("\tSorted and initializer-list insertion.\n");
+        {
+            const bsl::vector<Value> values = toValues("ACE");
+
+            Obj mX(&oa);  const Obj& X = gg(&mX, "BC");
+            mX.insert(bsl::sorted_unique, values.begin(), values.end());
+            ASSERT(isSpec(X, "ABCE"));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX.insert({ Value(3, 30), Value(5, 50), Value(3, 99) });
+            ASSERT(isSpec(X, "ABCDEF"));
+
+            mX.insert(bsl::sorted_unique, { Value(6, 60), Value(7, 70) });
+            ASSERT(isSpec(X, "ABCDEFGH"));
+#endif
+        }
+
+        if (verbose) printf("\tInsertion by move.\n");
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+
+            bslma::TestAllocator sa("source", veryVeryVeryVerbose);
+
+            StringValue value(
+                       bsl::string("a key long enough to allocate", &sa),
+                       bsl::string("a value long enough to allocate", &sa),
+                       &oa);
+
+            bsl::pair<StringObj::iterator, bool> result =
+                                              mX.insert(MoveUtil::move(value));
+            ASSERT(result.second);
+            ASSERT(&oa == result.first->first.get_allocator());
+            ASSERT(&oa == result.first->second.get_allocator());
+            ASSERT(value.second.empty());
+            ASSERT(1 == X.size());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ELEMENT ACCESS
+        //
+        // Concerns:
+        //: 1 'operator[]' returns a reference to the mapped value of the
+        //:   element having the supplied key, inserting an element having a
+        //:   value-initialized mapped value if the key is absent.
+        //:
+        //: 2 'operator[]' moves a key supplied as a 'MovableRef'.
+        //:
+        //: 3 'at' returns a reference to the mapped value of the element
+        //:   having the supplied key, and throws 'std::out_of_range' if the
+        //:   key is absent.
+        //
+        // Plan:
+        //: 1 Access present and absent keys of an object of known value with
+        //:   each method, and verify the results.  (C-1..3)
+        //
+        // Testing:
+        //   VALUE& operator[](const key_type&);
+        //   VALUE& operator[](MovableRef<key_type>);
+        //   VALUE& at(const key_type&);
+        //   const VALUE& at(const key_type&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nELEMENT ACCESS"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = gg(&mX, "BD");
+
+            ASSERT(10 == mX[1]);
+            ASSERT(2  == X.size());
+
+            ASSERT(0  == mX[2]);
+            ASSERT(3  == X.size());
+
+            mX[2] = 20;
+            ASSERT(isSpec(X, "BCD"));
+
+            ASSERT(30 == X.at(3));
+            mX.at(3) = 31;
+            ASSERT(31 == X.at(3));
+
+#if defined(BDE_BUILD_TARGET_EXC)
+            bool caught = false;
+            try {
+                X.at(4);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(3 == X.size());
+#endif
+        }
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+
+            bsl::string key("a key long enough to allocate memory", &oa);
+            mX[MoveUtil::move(key)] = "value";
+
+            ASSERT(1 == X.size());
+            ASSERT("a key long enough to allocate memory" ==
+                                                           X.begin()->first);
+            ASSERT("value" == X.begin()->second);
+            ASSERT(&oa == X.begin()->first.get_allocator());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND TYPE TRAITS
+        //
+        // Concerns:
+        //: 1 Each constructor creates an object having the documented value,
+        //:   comparator, and allocator.
+        //:
+        //: 2 The range constructors discard values whose key is that of an
+        //:   earlier value of the range, and the 'sorted_unique' constructors
+        //:   accept a sorted range as is.
+        //:
+        //: 3 'flat_map' declares the 'bslma::UsesBslmaAllocator' and
+        //:   'bslalg::HasStlIterators' traits.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor, and verify their value,
+        //:   comparator, and allocator.  (C-1..2)
+        //:
+        //: 2 Verify the traits.  (C-3)
+        //
+        // Testing:
+        //   flat_map();
+        //   flat_map(const COMPARATOR&, const ALLOCATOR&);
+        //   flat_map(const ALLOCATOR&);
+        //   flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const COMPARATOR&, ...);
+        //   flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const ALLOCATOR&);
+        //   flat_map(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR, ...);
+        //   flat_map(initializer_list<value_type>, ...);
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   TYPE TRAITS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTORS AND TYPE TRAITS"
+                            "\n============================\n");
+
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        ASSERT(bslalg::HasStlIterators<Obj>::value);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const bsl::vector<Value> unsorted = toValues("CABAC");
+        const bsl::vector<Value> sorted   = toValues("ABC");
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(&defaultAllocator == X.get_allocator());
+        }
+        {
+            typedef bsl::flat_map<int, int, std::greater<int> > GreaterObj;
+
+            GreaterObj mX(std::greater<int>(), &oa);  const GreaterObj& X = mX;
+            mX.insert(unsorted.begin(), unsorted.end());
+            ASSERT(3 == X.size());
+            ASSERT(2 == X.begin()->first);
+            ASSERT(&oa == X.get_allocator());
+            ASSERT(X.key_comp()(2, 1));
+            ASSERT(X.value_comp()(Value(2, 0), Value(1, 0)));
+        }
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(&oa == X.get_allocator());
+        }
+        {
+            Obj mX(unsorted.begin(), unsorted.end());  const Obj& X = mX;
+            ASSERT(isSpec(X, "ABC"));
+            ASSERT(&defaultAllocator == X.get_allocator());
+        }
+        {
+            Obj mX(unsorted.begin(), unsorted.end(), &oa);  const Obj& X = mX;
+            ASSERT(isSpec(X, "ABC"));
+            ASSERT(&oa == X.get_allocator());
+        }
+        {
+            Obj mX(bsl::sorted_unique, sorted.begin(), sorted.end(), &oa);
+            const Obj& X = mX;
+            ASSERT(isSpec(X, "ABC"));
+            ASSERT(&oa == X.get_allocator());
+        }
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            Obj mX({ Value(2, 20), Value(0, 0), Value(2, 99) }, &oa);
+            const Obj& X = mX;
+            ASSERT(isSpec(X, "AC"));
+            ASSERT(&oa == X.get_allocator());
+
+            mX = { Value(1, 10) };
+            ASSERT(isSpec(X, "B"));
+        }
+#endif
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a map, insert elements one at a time and in bulk, look
+        //:   them up, iterate over them, and erase them.
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   void clear();
+        //   void reserve(size_type);
+        //   void shrink_to_fit();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(X.empty());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.cbegin() == X.cend());
+            ASSERT(X.rbegin() == X.rend());
+
+            ASSERT(mX.insert(Value(3, 30)).second);
+            ASSERT(mX.insert(Value(1, 10)).second);
+            ASSERT(!mX.insert(Value(3, 99)).second);
+            ASSERT(30 == X.at(3));
+
+            mX[2] = 20;
+            ASSERT(isSpec(X, "BCD"));
+
+            ASSERT(1 == X.begin()->first);
+            ASSERT(3 == X.rbegin()->first);
+            ASSERT(3 == X.crbegin()->first);
+
+            mX.reserve(64);
+            ASSERT(64 <= X.capacity());
+            ASSERT(isSpec(X, "BCD"));
+
+            mX.shrink_to_fit();
+            ASSERT(isSpec(X, "BCD"));
+
+            ASSERT(1 == mX.erase(2));
+            ASSERT(isSpec(X, "BD"));
+
+            mX.clear();
+            ASSERT(X.empty());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
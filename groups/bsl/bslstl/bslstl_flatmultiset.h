@@ -0,0 +1,1477 @@
+// bslstl_flatmultiset.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATMULTISET
+#define INCLUDED_BSLSTL_FLATMULTISET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered multiset stored as a sorted vector.
+//
+//@CLASSES:
+//   bsl::flat_multiset: ordered set of keys held in contiguous storage
+//
+//@SEE_ALSO: bslstl_flatset, bslstl_flatmultimap, bslstl_multiset
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_multiset', implementing an ordered associative container holding
+// keys (of a template parameter type, 'KEY'), where several keys may be
+// equivalent to each other.  The interface of 'flat_multiset' follows that of
+// 'bsl::multiset' and of the 'std::flat_multiset' of the C++23 standard, but
+// its keys are held in a single 'bsl::vector', in sorted order, rather than
+// in a tree of separately allocated nodes.  Equivalent keys are held in the
+// order in which they were inserted, except as noted for range insertion in
+// {'bslstl_flattree'|Bulk Insertion}.
+//
+// An instantiation of 'flat_multiset' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of keys) and the
+// ordered sequence of keys the multiset contains.
+//
+// 'flat_multiset' trades the performance of single insertions and erasures
+// (which have linear complexity) for that of lookups and iteration (which
+// operate on contiguous memory) exactly as 'bsl::flat_map' does; see
+// {'bslstl_flatmap'|'flat_map' versus 'map'}.  A 'flat_multiset' should be
+// built with a single range insertion, which has 'O[N * log(N)]' complexity
+// (or 'O[N]' complexity if the range is already sorted and tagged with
+// 'bsl::sorted_equivalent').
+//
+// As for 'bsl::multiset', both 'iterator' and 'const_iterator' provide only
+// non-modifiable access to the keys of a 'flat_multiset'.
+//
+///Requirements on 'KEY'
+///---------------------
+// A 'flat_multiset' is a fully value-semantic type only if the supplied 'KEY'
+// template parameter is itself fully value-semantic.  In addition, inserting
+// into or erasing from a 'flat_multiset' requires 'KEY' to be
+// move-insertable and move-assignable.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a 'flat_multiset''s 'ALLOCATOR' template parameter
+// determines how that multiset will allocate memory, exactly as for
+// 'bsl::multiset'.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Latency Percentiles
+/// - - - - - - - - - - - - - - -
+// Suppose we collect the latencies (in microseconds) of a batch of requests,
+// and want to report the median and the worst of them, as well as the number
+// of requests that took exactly one particular time.
+//
+// First, we load the (unsorted) batch, which sorts it in 'O[N * log(N)]'
+// time, retaining duplicates:
+//..
+//  const int latencies[] = { 120, 95, 300, 95, 150, 95, 210 };
+//  const int numLatencies = sizeof latencies / sizeof *latencies;
+//
+//  bsl::flat_multiset<int> sample(latencies, latencies + numLatencies);
+//
+//  assert(7 == sample.size());
+//..
+// Then, since the keys are held contiguously, we can index into the sorted
+// sequence directly to find the median and the maximum:
+//..
+//  assert(120 == sample.begin()[sample.size() / 2]);
+//  assert(300 == *sample.rbegin());
+//..
+// Finally, we count the requests that took 95 microseconds:
+//..
+//  assert(3 == sample.count(95));
+//..
+
+#if defined(BSL_OVERRIDES_STD) && !defined(BOS_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "include <bsl_flat_set.h> instead of <bslstl_flatmultiset.h> in \
+BSL_OVERRIDES_STD mode"
+#endif
+#include <bslscm_version.h>
+
+#include <bslstl_flattree.h>
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+
+#include <bslalg_rangecompare.h>
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslma_allocatortraits.h>
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_istransparentpredicate.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+
+#include <functional>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace bsl {
+
+                            // ===================
+                            // class flat_multiset
+                            // ===================
+
+template <class KEY,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = allocator<KEY> >
+class flat_multiset {
+    // This class template implements a value-semantic container type holding
+    // a sorted sequence of keys (of the template parameter type, 'KEY'),
+    // possibly including equivalent keys, stored contiguously.  The (template
+    // parameter) type 'COMPARATOR' must provide a 'const' function-call
+    // operator.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for BDEX serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::UnorderedSetKeyConfiguration<KEY> KeyConfig;
+        // This typedef is an alias for the (identity) configuration
+        // extracting the key of a value.
+
+    typedef BloombergLP::bslstl::FlatTree<KeyConfig, COMPARATOR, ALLOCATOR>
+                                                               Tree;
+        // This typedef is an alias for the sorted vector holding the keys of
+        // this multiset.
+
+    typedef bsl::allocator_traits<ALLOCATOR>                   AllocatorTraits;
+        // This typedef is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef BloombergLP::bslmf::MovableRefUtil                 MoveUtil;
+        // This typedef is a convenient alias for the utility associated with
+        // movable references.
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef KEY                                        value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef COMPARATOR                                 value_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename Tree::const_iterator              iterator;
+    typedef typename Tree::const_iterator              const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+  private:
+    // DATA
+    Tree d_tree;  // sorted vector of keys
+
+  public:
+    // CREATORS
+    flat_multiset();
+    explicit flat_multiset(const COMPARATOR& comparator,
+                           const ALLOCATOR&  basicAllocator = ALLOCATOR())
+        // Create an empty multiset.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is 'bsl::allocator'
+        // (the default), then 'basicAllocator', if supplied, shall be
+        // convertible to 'bslma::Allocator *'.  If the type 'ALLOCATOR' is
+        // 'bsl::allocator' and 'basicAllocator' is not supplied, the currently
+        // installed default allocator is used.
+    : d_tree(comparator, basicAllocator)
+    {
+        // The implementation is placed here in the class definition to work
+        // around an AIX compiler bug, where the constructor can fail to
+        // compile because it is unable to find the definition of the default
+        // argument.  This occurs when a templatized class wraps around the
+        // container and the comparator is defined after the new class.
+    }
+
+    explicit flat_multiset(const ALLOCATOR& basicAllocator);
+        // Create an empty multiset that uses the specified 'basicAllocator' to
+        // supply memory.  Use a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order the keys contained in this
+        // multiset.  Note that a 'bslma::Allocator *' can be supplied for
+        // 'basicAllocator' if the (template parameter) 'ALLOCATOR' is
+        // 'bsl::allocator' (the default).
+
+    flat_multiset(const flat_multiset& original);
+        // Create a multiset having the same value as the specified 'original'
+        // object.  Use a copy of 'original.key_comp()' to order the keys
+        // contained in this multiset.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.
+
+    flat_multiset(BloombergLP::bslmf::MovableRef<flat_multiset> original);
+                                                                    // IMPLICIT
+        // Create a multiset having the same value as the specified 'original'
+        // object by moving (in constant time) the contents of 'original' to
+        // the new multiset.  Use a copy of 'original.key_comp()' to order the
+        // keys contained in this multiset.  The allocator associated with
+        // 'original' is propagated for use in the newly-created multiset.
+        // 'original' is left in a valid but unspecified state.
+
+    flat_multiset(const flat_multiset& original,
+                  const ALLOCATOR&     basicAllocator);
+        // Create a multiset having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+        // Use a copy of 'original.key_comp()' to order the keys contained in
+        // this multiset.
+
+    flat_multiset(
+                 BloombergLP::bslmf::MovableRef<flat_multiset> original,
+                 const ALLOCATOR&                              basicAllocator);
+        // Create a multiset having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+        // The contents of 'original' are moved (in constant time) to the new
+        // multiset if 'basicAllocator == original.get_allocator()', and are
+        // move-inserted (in linear time) using 'basicAllocator' otherwise.
+        // 'original' is left in a valid but unspecified state.
+
+    template <class INPUT_ITERATOR>
+    flat_multiset(INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const COMPARATOR& comparator     = COMPARATOR(),
+                  const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_multiset(INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const ALLOCATOR&  basicAllocator);
+        // Create a multiset, and insert each 'value_type' object in the
+        // sequence starting at the specified 'first' element, and ending
+        // immediately before the specified 'last' element.  Optionally specify
+        // a 'comparator' used to order keys contained in this object.  If
+        // 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'ALLOCATOR' is used.  This method has
+        // 'O[N * log(N)]' complexity, where 'N' is the number of elements in
+        // the sequence.  The (template parameter) type 'INPUT_ITERATOR' shall
+        // meet the requirements of an input iterator defined in the C++11
+        // standard [input.iterators] providing access to values of a type
+        // convertible to 'value_type'.  The behavior is undefined unless
+        // 'first' and 'last' refer to a sequence of valid values where 'last'
+        // is at a position at or after 'first'.
+
+    template <class INPUT_ITERATOR>
+    flat_multiset(sorted_equivalent_t,
+                  INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const COMPARATOR& comparator     = COMPARATOR(),
+                  const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_multiset(sorted_equivalent_t,
+                  INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const ALLOCATOR&  basicAllocator);
+        // Create a multiset holding the keys in the sequence starting at the
+        // specified 'first' element, and ending immediately before the
+        // specified 'last' element, in linear time.  Optionally specify a
+        // 'comparator' and a 'basicAllocator', exactly as for the unsorted
+        // range constructors.  The behavior is undefined unless the sequence
+        // is sorted according to the comparator of this multiset.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_multiset(std::initializer_list<KEY> values,
+                  const COMPARATOR&          comparator     = COMPARATOR(),
+                  const ALLOCATOR&           basicAllocator = ALLOCATOR());
+    flat_multiset(std::initializer_list<KEY> values,
+                  const ALLOCATOR&           basicAllocator);
+        // Create a multiset, and insert each 'value_type' object in the
+        // specified 'values' initializer list.  Optionally specify a
+        // 'comparator' and a 'basicAllocator', exactly as for the range
+        // constructors.
+
+    flat_multiset(sorted_equivalent_t,
+                  std::initializer_list<KEY> values,
+                  const COMPARATOR&          comparator     = COMPARATOR(),
+                  const ALLOCATOR&           basicAllocator = ALLOCATOR());
+    flat_multiset(sorted_equivalent_t,
+                  std::initializer_list<KEY> values,
+                  const ALLOCATOR&           basicAllocator);
+        // Create a multiset holding the keys in the specified 'values'
+        // initializer list, in linear time.  Optionally specify a
+        // 'comparator' and a 'basicAllocator', exactly as for the range
+        // constructors.  The behavior is undefined unless 'values' is sorted.
+#endif
+
+    //! ~flat_multiset() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_multiset& operator=(const flat_multiset& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if the
+        // 'ALLOCATOR' type has trait 'propagate_on_container_copy_assignment',
+        // and return a reference providing modifiable access to this object.
+
+    flat_multiset& operator=(BloombergLP::bslmf::MovableRef<flat_multiset> rhs)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if the
+        // 'ALLOCATOR' type has trait 'propagate_on_container_move_assignment',
+        // and return a reference providing modifiable access to this object.
+        // The contents of 'rhs' are moved (in constant time) to this multiset
+        // if the allocators of the multisets are (then) equal, and are
+        // move-inserted (in linear time) otherwise.  'rhs' is left in a valid
+        // but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_multiset& operator=(std::initializer_list<KEY> values);
+        // Assign to this object the value resulting from first clearing this
+        // multiset and then inserting each 'value_type' object in the
+        // specified 'values' initializer list, and return a reference
+        // providing modifiable access to this object.
+#endif
+
+    iterator begin() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this multiset, or the 'end' iterator if this multiset
+        // is empty.
+
+    iterator end() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type'
+        // objects maintained by this multiset.
+
+    reverse_iterator rbegin() BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this multiset, or 'rend' if this multiset is
+        // empty.
+
+    reverse_iterator rend() BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this multiset.
+
+    iterator insert(const value_type& value);
+    iterator insert(BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this multiset (moving it, if
+        // supplied as a 'MovableRef'), after any keys equivalent to 'value'
+        // that are already present, and return an iterator referring to the
+        // newly inserted 'value_type' object.  This method has linear
+        // complexity in the number of keys following the inserted one.
+
+    iterator insert(const_iterator hint, const value_type& value);
+    iterator insert(const_iterator                             hint,
+                    BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this multiset (moving it, if
+        // supplied as a 'MovableRef') as close as possible to the position
+        // just prior to the specified 'hint', and return an iterator referring
+        // to the newly inserted 'value_type' object.  If 'hint' is a valid
+        // immediate successor to 'value', the search for the position of
+        // 'value' has constant complexity.  The behavior is undefined unless
+        // 'hint' is an iterator in the range '[begin() .. end()]' (both
+        // endpoints included).
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this multiset the value of each 'value_type' object in
+        // the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator.  This method has
+        // 'O[N + M * log(M)]' complexity, where 'N' is the size of this
+        // multiset and 'M' the length of the range.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'last' is at a position at or after 'first'.
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_equivalent_t,
+                INPUT_ITERATOR      first,
+                INPUT_ITERATOR      last);
+        // Insert into this multiset the value of each 'value_type' object in
+        // the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, in 'O[N + M]'
+        // time, where 'N' is the size of this multiset and 'M' the length of
+        // the range.  The behavior is undefined unless the range is sorted
+        // according to the comparator of this multiset.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(std::initializer_list<KEY> values);
+        // Insert into this multiset the value of each 'value_type' object in
+        // the specified 'values' initializer list.
+
+    void insert(sorted_equivalent_t, std::initializer_list<KEY> values);
+        // Insert into this multiset the value of each 'value_type' object in
+        // the specified 'values' initializer list, in linear time.  The
+        // behavior is undefined unless 'values' is sorted.
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... Args>
+    iterator emplace(Args&&... args);
+        // Insert into this multiset a newly-created 'value_type' object,
+        // constructed by forwarding 'get_allocator()' (if required) and the
+        // specified (variable number of) 'args' to the corresponding
+        // constructor of 'value_type', after any equivalent keys already
+        // present, and return an iterator referring to the newly created and
+        // inserted object.
+
+    template <class... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args);
+        // Insert into this multiset a newly-created 'value_type' object,
+        // constructed by forwarding 'get_allocator()' (if required) and the
+        // specified (variable number of) 'args' to the corresponding
+        // constructor of 'value_type', as close as possible to the position
+        // just prior to the specified 'hint', and return an iterator referring
+        // to the newly created and inserted object.  If 'hint' is a valid
+        // immediate successor to the new object, the search for its position
+        // has constant complexity.  The behavior is undefined unless 'hint' is
+        // an iterator in the range '[begin() .. end()]' (both endpoints
+        // included).
+#endif
+
+    iterator erase(const_iterator position);
+        // Remove from this multiset the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last element in the
+        // sequence of elements maintained by this multiset.  The behavior is
+        // undefined unless 'position' refers to a 'value_type' object in this
+        // multiset.
+
+    size_type erase(const key_type& key);
+        // Remove from this multiset all 'value_type' objects that are
+        // equivalent to the specified 'key', if such entries exist, and return
+        // the number of objects erased; otherwise, if there are no
+        // 'value_type' objects equivalent to 'key', return 0 with no other
+        // effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this multiset the 'value_type' objects starting at the
+        // specified 'first' position up to, but not including, the specified
+        // 'last' position, and return 'last'.  The behavior is undefined
+        // unless 'first' and 'last' either refer to elements in this multiset
+        // or are the 'end' iterator, and the 'first' position is at or before
+        // the 'last' position in the ordered sequence provided by this
+        // container.
+
+    void swap(flat_multiset& other)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object; also exchange the allocator of this object
+        // with that of 'other' if the (template parameter) type 'ALLOCATOR'
+        // has the 'propagate_on_container_swap' trait, and do not modify
+        // either allocator otherwise.  This method provides the no-throw
+        // exception-safety guarantee, *unless* swapping the (user-supplied)
+        // comparator objects can throw, and has constant complexity if either
+        // 'ALLOCATOR' has the 'propagate_on_container_swap' trait or the
+        // allocators of the multisets are equal; otherwise, the contents of
+        // the multisets are move-inserted into one another (using the
+        // allocator of their destination), in linear time.
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Remove all entries from this multiset.  Note that the multiset is
+        // empty after this call, but allocated memory may be retained for
+        // future use.
+
+    void reserve(size_type numElements);
+        // Increase the capacity of this multiset, if necessary, so that at
+        // least the specified 'numElements' keys can be held without
+        // reallocation.  Note that this method has no effect on the value of
+        // this multiset.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this multiset to its size, if possible.  Note
+        // that this method has no effect on the value of this multiset.
+
+    // ACCESSORS
+    allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // multiset.
+
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this multiset, or the 'end' iterator if this multiset
+        // is empty.
+
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type'
+        // objects maintained by this multiset.
+
+    const_reverse_iterator rbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this multiset, or 'rend' if this multiset is
+        // empty.
+
+    const_reverse_iterator rend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this multiset.
+
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this multiset, or the 'cend' iterator if this multiset
+        // is empty.
+
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type'
+        // objects maintained by this multiset.
+
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this multiset, or 'crend' if this multiset is
+        // empty.
+
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this multiset.
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this multiset contains a 'value_type' object that
+        // is equivalent to the specified 'key', and 'false' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this multiset contains a 'value_type' object that
+        // is equivalent to the specified 'key', and 'false' otherwise.
+        //
+        // This overload participates in overload resolution only if
+        // 'COMPARATOR' is transparent (see 'bslmf_istransparentpredicate').
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.find(key) != end();
+    }
+
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this multiset contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements in this multiset.
+
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this multiset could possibly hold.  Note that there is no
+        // guarantee that the multiset can successfully grow to the returned
+        // size, or even close to that size without running out of resources.
+
+    size_type capacity() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements this multiset can hold without
+        // reallocating its storage.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by this
+        // multiset; if a comparator was supplied at construction, return its
+        // value; otherwise, return a default constructed 'key_compare' object.
+        // Note that this comparator compares objects of type 'KEY', which is
+        // the type of the 'value_type' objects contained in this multiset.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects using
+        // 'key_comp()'.  Note that since 'value_type' and 'key_type' are the
+        // same for a multiset, 'value_comp()' returns the same value as
+        // 'key_comp()'.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this multiset that is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this multiset that is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+        //
+        // This overload participates in overload resolution only if
+        // 'COMPARATOR' is transparent (see 'bslmf_istransparentpredicate').
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.find(key);
+    }
+
+    size_type count(const key_type& key) const;
+        // Return the number of 'value_type' objects within this multiset that
+        // are equivalent to the specified 'key'.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects within this multiset that
+        // are equivalent to the specified 'key'.
+        //
+        // This overload participates in overload resolution only if
+        // 'COMPARATOR' is transparent (see 'bslmf_istransparentpredicate').
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.count(key);
+    }
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multiset that is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this multiset does not contain a 'value_type' object
+        // greater-than or equal-to 'key'.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    lower_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multiset that is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this multiset does not contain a 'value_type' object
+        // greater-than or equal-to 'key'.
+        //
+        // This overload participates in overload resolution only if
+        // 'COMPARATOR' is transparent (see 'bslmf_istransparentpredicate').
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.lowerBound(key);
+    }
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multiset that is
+        // greater than the specified 'key', and the past-the-end iterator if
+        // this multiset does not contain a 'value_type' object greater-than
+        // 'key'.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    upper_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multiset that is
+        // greater than the specified 'key', and the past-the-end iterator if
+        // this multiset does not contain a 'value_type' object greater-than
+        // 'key'.
+        //
+        // This overload participates in overload resolution only if
+        // 'COMPARATOR' is transparent (see 'bslmf_istransparentpredicate').
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.upperBound(key);
+    }
+
+    pair<const_iterator, const_iterator> equal_range(const key_type& key)
+                                                                         const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this multiset that are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this multiset
+        // contains no 'value_type' object equivalent to 'key', then the two
+        // iterators in the pair are equal.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this multiset that are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this multiset
+        // contains no 'value_type' object equivalent to 'key', then the two
+        // iterators in the pair are equal.
+        //
+        // This overload participates in overload resolution only if
+        // 'COMPARATOR' is transparent (see 'bslmf_istransparentpredicate').
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.equalRange(key);
+    }
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_multiset' objects have the
+    // same value if they have the same number of keys, and each key in the
+    // ordered sequence of keys of one object compares equal to the key at the
+    // same position in the ordered sequence of keys of the other object.
+    // This method requires that the (template parameter) type 'KEY' be
+    // 'equality-comparable'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_multiset' objects do not
+    // have the same value if they do not have the same number of keys, or
+    // some key in the ordered sequence of keys of one object does not compare
+    // equal to the key at the same position in the ordered sequence of keys
+    // of the other object.  This method requires that the (template
+    // parameter) type 'KEY' be 'equality-comparable'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator< (const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multiset is
+    // lexicographically less than that of the specified 'rhs' multiset, and
+    // 'false' otherwise.  Given iterators 'i' and 'j' over the respective
+    // sequences '[lhs.begin() .. lhs.end())' and '[rhs.begin() .. rhs.end())',
+    // the value of multiset 'lhs' is lexicographically less than that of
+    // multiset 'rhs' if 'true == *i < *j' for the first pair of corresponding
+    // iterator positions where '*i' and '*j' differ, or if
+    // 'rhs.size() > lhs.size()' when no such pair exists.  This method
+    // requires that 'operator<', inducing a total order, be defined for
+    // 'value_type'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator> (const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multiset is
+    // lexicographically greater than that of the specified 'rhs' multiset,
+    // and 'false' otherwise.  See 'operator<' for the definition of
+    // lexicographical ordering.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multiset is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // multiset, and 'false' otherwise.  See 'operator<' for the definition of
+    // lexicographical ordering.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multiset is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // multiset, and 'false' otherwise.  See 'operator<' for the definition of
+    // lexicographical ordering.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void swap(flat_multiset<KEY, COMPARATOR, ALLOCATOR>& a,
+          flat_multiset<KEY, COMPARATOR, ALLOCATOR>& b)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+    // Exchange the value and comparator of the specified 'a' object with the
+    // value and comparator of the specified 'b' object.  Additionally, if
+    // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+    // 'true', then exchange the allocator of 'a' with that of 'b'.  See
+    // 'flat_multiset::swap' for the complexity and exception-safety
+    // guarantees.
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class flat_multiset
+                            // -------------------
+
+// CREATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset()
+: d_tree(COMPARATOR(), ALLOCATOR())
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                               const ALLOCATOR& basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                                 const flat_multiset& original)
+: d_tree(original.d_tree,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                   original.get_allocator()))
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                        BloombergLP::bslmf::MovableRef<flat_multiset> original)
+: d_tree(MoveUtil::move(MoveUtil::access(original).d_tree))
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                          const flat_multiset& original,
+                                          const ALLOCATOR&     basicAllocator)
+: d_tree(original.d_tree, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                BloombergLP::bslmf::MovableRef<flat_multiset> original,
+                const ALLOCATOR&                              basicAllocator)
+: d_tree(MoveUtil::move(MoveUtil::access(original).d_tree), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insertRangeMulti(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const ALLOCATOR&  basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insertRangeMulti(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                            sorted_equivalent_t,
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insertSortedMulti(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                            sorted_equivalent_t,
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const ALLOCATOR&  basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insertSortedMulti(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                   std::initializer_list<KEY> values,
+                                   const COMPARATOR&          comparator,
+                                   const ALLOCATOR&           basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insertRangeMulti(values.begin(), values.end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                   std::initializer_list<KEY> values,
+                                   const ALLOCATOR&           basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insertRangeMulti(values.begin(), values.end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                   sorted_equivalent_t,
+                                   std::initializer_list<KEY> values,
+                                   const COMPARATOR&          comparator,
+                                   const ALLOCATOR&           basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insertSortedMulti(values.begin(), values.end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                   sorted_equivalent_t,
+                                   std::initializer_list<KEY> values,
+                                   const ALLOCATOR&           basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insertSortedMulti(values.begin(), values.end());
+}
+#endif
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>&
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::operator=(const flat_multiset& rhs)
+{
+    d_tree = rhs.d_tree;
+    return *this;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>&
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::operator=(
+                             BloombergLP::bslmf::MovableRef<flat_multiset> rhs)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    flat_multiset& lvalue = rhs;
+
+    d_tree = MoveUtil::move(lvalue.d_tree);
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>&
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::operator=(
+                                             std::initializer_list<KEY> values)
+{
+    clear();
+    d_tree.insertRangeMulti(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::begin() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::end() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::rbegin() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::rend() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    return d_tree.insertMulti(value);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    return d_tree.insertMulti(MoveUtil::move(value));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                                  const value_type& value)
+{
+    return d_tree.insertMulti(hint, value);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(
+                              const_iterator                             hint,
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    return d_tree.insertMulti(hint, MoveUtil::move(value));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                       INPUT_ITERATOR last)
+{
+    d_tree.insertRangeMulti(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(
+                                                   sorted_equivalent_t,
+                                                   INPUT_ITERATOR      first,
+                                                   INPUT_ITERATOR      last)
+{
+    d_tree.insertSortedMulti(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(
+                                             std::initializer_list<KEY> values)
+{
+    d_tree.insertRangeMulti(values.begin(), values.end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(
+                                             sorted_equivalent_t,
+                                             std::initializer_list<KEY> values)
+{
+    d_tree.insertSortedMulti(values.begin(), values.end());
+}
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class... Args>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::emplace(Args&&... args)
+{
+    return d_tree.emplaceMulti(BSLS_COMPILERFEATURES_FORWARD(Args, args)...);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class... Args>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(const_iterator hint,
+                                                        Args&&...      args)
+{
+    return d_tree.emplaceMultiHint(
+                                 hint,
+                                 BSLS_COMPILERFEATURES_FORWARD(Args, args)...);
+}
+#endif
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    return d_tree.erase(position);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    return d_tree.eraseKey(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                 const_iterator last)
+{
+    return d_tree.erase(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::swap(flat_multiset& other)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    d_tree.swap(other.d_tree);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::clear() BSLS_KEYWORD_NOEXCEPT
+{
+    d_tree.clear();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::reserve(size_type numElements)
+{
+    d_tree.reserve(numElements);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::shrink_to_fit()
+{
+    d_tree.shrinkToFit();
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::allocator_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::get_allocator() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.allocator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::begin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::end() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::rbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::rend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::cbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::cend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::crbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return rbegin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::crend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return rend();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_multiset<KEY, COMPARATOR, ALLOCATOR>::contains(
+                                                     const key_type& key) const
+{
+    return d_tree.find(key) != end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_multiset<KEY, COMPARATOR, ALLOCATOR>::empty() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.empty();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::max_size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.maxSize();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::capacity() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.capacity();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::key_compare
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::value_compare
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return d_tree.find(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return d_tree.count(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                     const key_type& key) const
+{
+    return d_tree.lowerBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                     const key_type& key) const
+{
+    return d_tree.upperBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator,
+     typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator>
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::equal_range(
+                                                     const key_type& key) const
+{
+    return d_tree.equalRange(key);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& b)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *ordered* containers:
+//: o An ordered container defines STL iterators.
+//: o An ordered container uses 'bslma' allocators if the (template parameter)
+//:   type 'ALLOCATOR' is convertible from 'bslma::Allocator *'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1225 @@
+// bslstl_flatmultiset.t.cpp                                          -*-C++-*-
+#include <bslstl_flatmultiset.h>
+
+#include <bslstl_pair.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+
+#include <functional>   // 'std::less', 'std::greater'
+
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi'
+#include <string.h>     // 'strlen'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a value-semantic container adapter whose
+// algorithms are provided (and thoroughly tested) by 'bslstl_flattree'.  The
+// concerns of this test driver are therefore that each method of
+// 'flat_multiset' forwards to the correct method of the tree with "multi"
+// semantics, that the transparent lookup methods are enabled by a transparent
+// comparator, that the allocator is propagated as documented, and that the
+// exception guarantees of the tree are preserved.
+//
+// We use 'flat_multiset<int>' for most tests, describing a value with a
+// string of characters each denoting a key, 'flat_multiset<int, DecadeLess>'
+// where the relative order of equivalent keys is of concern, and
+// 'flat_multiset<bsl::string>' where the allocator propagated to the
+// elements, or exceptions thrown by it, are of concern.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_multiset();
+// [ 2] flat_multiset(const COMPARATOR&, const ALLOCATOR&);
+// [ 2] flat_multiset(const ALLOCATOR&);
+// [ 5] flat_multiset(const flat_multiset&);
+// [ 5] flat_multiset(MovableRef<flat_multiset>);
+// [ 5] flat_multiset(const flat_multiset&, const ALLOCATOR&);
+// [ 5] flat_multiset(MovableRef<flat_multiset>, const ALLOCATOR&);
+// [ 2] flat_multiset(INPUT_ITERATOR, INPUT_ITERATOR, const COMPARATOR&, ...);
+// [ 2] flat_multiset(INPUT_ITERATOR, INPUT_ITERATOR, const ALLOCATOR&);
+// [ 2] flat_multiset(sorted_equivalent_t, INPUT_ITER, INPUT_ITER, ...);
+// [ 2] flat_multiset(initializer_list<KEY>, ...);
+//
+// MANIPULATORS
+// [ 5] flat_multiset& operator=(const flat_multiset&);
+// [ 5] flat_multiset& operator=(MovableRef<flat_multiset>);
+// [ 3] iterator insert(const value_type&);
+// [ 3] iterator insert(MovableRef<value_type>);
+// [ 3] iterator insert(const_iterator, const value_type&);
+// [ 3] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(sorted_equivalent_t, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(initializer_list<KEY>);
+// [ 3] iterator emplace(Args&&...);
+// [ 3] iterator emplace_hint(const_iterator, Args&&...);
+// [ 4] iterator erase(const_iterator);
+// [ 4] size_type erase(const key_type&);
+// [ 4] iterator erase(const_iterator, const_iterator);
+// [ 5] void swap(flat_multiset&);
+// [ 1] void clear();
+// [ 1] void reserve(size_type);
+// [ 1] void shrink_to_fit();
+//
+// ACCESSORS
+// [ 4] const_iterator find(const key_type&) const;
+// [ 4] size_type count(const key_type&) const;
+// [ 4] bool contains(const key_type&) const;
+// [ 4] const_iterator lower_bound(const key_type&) const;
+// [ 4] const_iterator upper_bound(const key_type&) const;
+// [ 4] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 4] const_iterator find(const LOOKUP_KEY&) const;
+// [ 4] size_type count(const LOOKUP_KEY&) const;
+// [ 4] bool contains(const LOOKUP_KEY&) const;
+// [ 4] const_iterator lower_bound(const LOOKUP_KEY&) const;
+// [ 4] const_iterator upper_bound(const LOOKUP_KEY&) const;
+// [ 4] pair<const_iterator, ...> equal_range(const LOOKUP_KEY&) const;
+// [ 2] key_compare key_comp() const;
+// [ 2] value_compare value_comp() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const flat_multiset&, const flat_multiset&);
+// [ 5] bool operator!=(const flat_multiset&, const flat_multiset&);
+// [ 5] bool operator< (const flat_multiset&, const flat_multiset&);
+// [ 5] void swap(flat_multiset&, flat_multiset&);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] TYPE TRAITS
+// [ 6] EXCEPTION SAFETY
+// [ 7] USAGE EXAMPLE
+//=============================================================================
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::flat_multiset<int>           Obj;
+typedef Obj::value_type              Value;
+
+typedef bsl::flat_multiset<bsl::string>   StringObj;
+
+typedef bslmf::MovableRefUtil        MoveUtil;
+
+//=============================================================================
+//                       GLOBAL CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct Decade {
+    // This 'struct' denotes the range of integers '[10 * d_value .. 10 *
+    // d_value + 9]', and is used as a lookup key equivalent to every key in
+    // that range.
+
+    int d_value;  // integer divided by 10
+};
+
+struct TransparentLess {
+    // This 'struct' provides a transparent comparator ordering 'int' keys and
+    // 'Decade' lookup keys.
+
+    typedef void is_transparent;
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' is less than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs < rhs;
+    }
+
+    bool operator()(int lhs, const Decade& rhs) const
+        // Return 'true' if the specified 'lhs' is ordered before every
+        // integer in the specified 'rhs' range, and 'false' otherwise.
+    {
+        return lhs / 10 < rhs.d_value;
+    }
+
+    bool operator()(const Decade& lhs, int rhs) const
+        // Return 'true' if the specified 'rhs' is ordered after every integer
+        // in the specified 'lhs' range, and 'false' otherwise.
+    {
+        return lhs.d_value < rhs / 10;
+    }
+};
+
+struct DecadeLess {
+    // This 'struct' provides a comparator under which two integers are
+    // equivalent if they have the same quotient when divided by 10, making
+    // the relative order of equivalent keys observable.
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the decade of the specified 'lhs' is less than
+        // that of the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs / 10 < rhs / 10;
+    }
+};
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+bsl::vector<Value> toValues(const char *spec)
+    // Return the sequence of values described by the specified 'spec', in
+    // which each character 'c' denotes the value 'c - 'A''.
+{
+    bsl::vector<Value> result;
+    for (; *spec; ++spec) {
+        result.push_back(*spec - 'A');
+    }
+    return result;
+}
+
+Obj& gg(Obj *object, const char *spec)
+    // Insert into the specified 'object' the values described by the
+    // specified 'spec', and return a reference providing modifiable access to
+    // 'object'.
+{
+    const bsl::vector<Value> values = toValues(spec);
+    object->insert(values.begin(), values.end());
+    return *object;
+}
+
+bool isSpec(const Obj& object, const char *spec)
+    // Return 'true' if the specified 'object' holds exactly the sequence of
+    // values described by the specified 'spec', and 'false' otherwise.
+{
+    Obj::const_iterator it = object.begin();
+    for (; *spec; ++spec, ++it) {
+        if (object.end() == it || *spec - 'A' != *it) {
+            return false;                                             // RETURN
+        }
+    }
+    return object.end() == it;
+}
+
+bool isOrdered(const StringObj& object)
+    // Return 'true' if the keys of the specified 'object' are in
+    // non-decreasing order, and 'false' otherwise.
+{
+    for (StringObj::const_iterator it = object.begin();
+         it != object.end() && it + 1 != object.end();
+         ++it) {
+        if (*(it + 1) < *it) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;       // suppress unused variable warning
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator         defaultAllocator("default",
+                                                  veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove
+        //   leading comment characters, and replace 'assert' with
+        //   'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        bslma::TestAllocator         ua("usage", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard usageGuard(&ua);
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Latency Percentiles
+/// - - - - - - - - - - - - - - -
+// Suppose we collect the latencies (in microseconds) of a batch of requests,
+// and want to report the median and the worst of them, as well as the number
+// of requests that took exactly one particular time.
+//
+// First, we load the (unsorted) batch, which sorts it in 'O[N * log(N)]'
+// time, retaining duplicates:
+//..
+    const int latencies[] = { 120, 95, 300, 95, 150, 95, 210 };
+    const int numLatencies = sizeof latencies / sizeof *latencies;
+
+    bsl::flat_multiset<int> sample(latencies, latencies + numLatencies);
+
+    ASSERT(7 == sample.size());
+//..
+// Then, since the keys are held contiguously, we can index into the sorted
+// sequence directly to find the median and the maximum:
+//..
+    ASSERT(120 == sample.begin()[sample.size() / 2]);
+    ASSERT(300 == *sample.rbegin());
+//..
+// Finally, we count the requests that took 95 microseconds:
+//..
+    ASSERT(3 == sample.count(95));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If an exception is thrown by the allocator during a single-value
+        //:   insertion, the multiset is left unchanged.
+        //:
+        //: 2 If an exception is thrown by the allocator during a range
+        //:   insertion (sorted or not), the multiset is left holding keys in
+        //:   order, none of which occurs more often than in the initial value
+        //:   and the range combined.
+        //:
+        //: 3 If an exception is thrown by the allocator during a copy
+        //:   construction, no memory is leaked.
+        //:
+        //: 4 Once no exception is thrown, each operation produces the same
+        //:   value as it does without exceptions.
+        //
+        // Plan:
+        //: 1 Perform each operation on a multiset of strings long enough to
+        //:   allocate, in the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' loop,
+        //:   verifying the value of the multiset at the start of each
+        //:   iteration and after the loop, and that the test allocator holds
+        //:   no memory once the multiset is destroyed.  (C-1..4)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXCEPTION SAFETY"
+                            "\n================\n");
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        // Make the strings long enough to allocate.
+
+        const bsl::string PREFIX(40, 'x', &sa);
+
+        static const struct {
+            int         d_line;
+            const char *d_initial_p;   // initial value (sorted)
+            const char *d_range_p;     // inserted values
+            bool        d_isSorted;    // range is sorted
+            const char *d_result_p;    // expected value
+        } DATA[] = {
+            //LINE  INITIAL  RANGE     SORTED  RESULT
+            //----  -------  -----     ------  ------
+            { L_,   "",      "DBCAB",  false,  "ABBCD"     },
+            { L_,   "AB",    "DCED",   false,  "ABCDDE"    },
+            { L_,   "ACE",   "EDCBA",  false,  "AABCCDEE"  },
+            { L_,   "BDF",   "ABDG",   true,   "ABBDDFG"   },
+            { L_,   "ABC",   "CDD",    true,   "ABCCDD"    },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            const char *const INITIAL = DATA[ti].d_initial_p;
+            const char *const RANGE   = DATA[ti].d_range_p;
+            const bool        SORTED  = DATA[ti].d_isSorted;
+            const char *const RESULT  = DATA[ti].d_result_p;
+
+            if (veryVerbose) { T_ P_(LINE) P_(INITIAL) P_(RANGE) P(SORTED) }
+
+            StringObj mI(&sa);  const StringObj& I = mI;
+            for (const char *p = INITIAL; *p; ++p) {
+                mI.insert(PREFIX + *p);
+            }
+            bsl::vector<bsl::string> range(&sa);
+            for (const char *p = RANGE; *p; ++p) {
+                range.push_back(PREFIX + *p);
+            }
+            StringObj mE(&sa);  const StringObj& E = mE;
+            for (const char *p = RESULT; *p; ++p) {
+                mE.insert(PREFIX + *p);
+            }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            if (veryVerbose) printf("\t\tSingle-value insertion.\n");
+            {
+                StringObj mX(I, &oa);  const StringObj& X = mX;
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(LINE, I == X);
+
+                    mX.insert(range.front());
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE, I.count(range.front()) + 1
+                                                   == X.count(range.front()));
+                ASSERTV(LINE, I.size() + 1 == X.size());
+            }
+            ASSERTV(LINE, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+            if (veryVerbose) printf("\t\tRange insertion.\n");
+            {
+                StringObj mX(&oa);  const StringObj& X = mX;
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(LINE, isOrdered(X));
+                    for (StringObj::const_iterator it = X.begin();
+                         it != X.end();
+                         ++it) {
+                        ASSERTV(LINE, it->c_str(),
+                                X.count(*it) <= E.count(*it));
+                    }
+
+                    // Restore the initial value, which a prior attempt may
+                    // have altered.
+
+                    mX = I;
+
+                    if (SORTED) {
+                        mX.insert(bsl::sorted_equivalent,
+                                  range.begin(),
+                                  range.end());
+                    }
+                    else {
+                        mX.insert(range.begin(), range.end());
+                    }
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(LINE, E == X);
+            }
+            ASSERTV(LINE, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+            if (veryVerbose) printf("\t\tCopy construction.\n");
+            {
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    StringObj mX(E, &oa);  const StringObj& X = mX;
+                    ASSERTV(LINE, E == X);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            }
+            ASSERTV(LINE, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 The copy constructor and copy-assignment operator reproduce the
+        //:   value of the source, using the default allocator, the supplied
+        //:   allocator, or the allocator of the target, respectively, and
+        //:   propagate that allocator to the elements.
+        //:
+        //: 2 Moves between objects having equal allocators allocate no
+        //:   memory, and moves between objects having unequal allocators
+        //:   reproduce the value using the allocator of the target.
+        //:
+        //: 3 'swap' (member and free) exchanges values, and allocates no
+        //:   memory if the allocators are equal.
+        //:
+        //: 4 The equality and relational operators compare the ordered
+        //:   sequences of keys.
+        //
+        // Plan:
+        //: 1 Perform each operation on objects of known value created with
+        //:   test allocators, and verify the values, allocators, and
+        //:   allocations of the results.  (C-1..3)
+        //:
+        //: 2 Compare objects created from a table of specifications with
+        //:   every other such object.  (C-4)
+        //
+        // Testing:
+        //   flat_multiset(const flat_multiset&);
+        //   flat_multiset(MovableRef<flat_multiset>);
+        //   flat_multiset(const flat_multiset&, const ALLOCATOR&);
+        //   flat_multiset(MovableRef<flat_multiset>, const ALLOCATOR&);
+        //   flat_multiset& operator=(const flat_multiset&);
+        //   flat_multiset& operator=(MovableRef<flat_multiset>);
+        //   void swap(flat_multiset&);
+        //   bool operator==(const flat_multiset&, const flat_multiset&);
+        //   bool operator!=(const flat_multiset&, const flat_multiset&);
+        //   bool operator< (const flat_multiset&, const flat_multiset&);
+        //   void swap(flat_multiset&, flat_multiset&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, MOVE, SWAP, AND COMPARISON"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        if (verbose) printf("\tCopy.\n");
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+            mX.insert("a key long enough to allocate memory");
+            mX.insert("b");
+
+            StringObj mY(X, &za);  const StringObj& Y = mY;
+            ASSERT(X == Y);
+            ASSERT(&za == Y.get_allocator());
+            ASSERT(&za == Y.begin()->get_allocator());
+
+            StringObj mZ(&oa);  const StringObj& Z = mZ;
+            mZ = Y;
+            ASSERT(X == Z);
+            ASSERT(&oa == Z.get_allocator());
+            ASSERT(&oa == Z.begin()->get_allocator());
+
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+            {
+                StringObj mW(X);  const StringObj& W = mW;
+                ASSERT(X == W);
+                ASSERT(&defaultAllocator == W.get_allocator());
+                ASSERT(&defaultAllocator == W.begin()->get_allocator());
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tMove.\n");
+        {
+            Obj mX(&oa);  const Obj& X = gg(&mX, "AAB");
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            Obj mY(MoveUtil::move(mX));  const Obj& Y = mY;
+            ASSERT(isSpec(Y, "AAB"));
+            ASSERT(&oa == Y.get_allocator());
+
+            Obj mZ(MoveUtil::move(mY), &oa);  const Obj& Z = mZ;
+            ASSERT(isSpec(Z, "AAB"));
+
+            mX = MoveUtil::move(mZ);
+            ASSERT(isSpec(X, "AAB"));
+            ASSERT(oam.isTotalSame());
+
+            Obj mW(MoveUtil::move(mX), &za);  const Obj& W = mW;
+            ASSERT(isSpec(W, "AAB"));
+            ASSERT(&za == W.get_allocator());
+            ASSERT(oam.isTotalSame());
+        }
+        {
+            StringObj mX(&oa);
+            mX.insert("a key long enough to allocate memory");
+
+            StringObj mY(MoveUtil::move(mX), &za);  const StringObj& Y = mY;
+            ASSERT(1   == Y.size());
+            ASSERT(&za == Y.begin()->get_allocator());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tSwap.\n");
+        {
+            Obj mX(&oa);  const Obj& X = gg(&mX, "AAB");
+            Obj mY(&oa);  const Obj& Y = gg(&mY, "D");
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.swap(mY);
+            ASSERT(isSpec(X, "D"));
+            ASSERT(isSpec(Y, "AAB"));
+
+            swap(mX, mY);
+            ASSERT(isSpec(X, "AAB"));
+            ASSERT(isSpec(Y, "D"));
+            ASSERT(oam.isTotalSame());
+
+            Obj mZ(&za);  const Obj& Z = gg(&mZ, "EE");
+
+            mX.swap(mZ);
+            ASSERT(isSpec(X, "EE"));
+            ASSERT(isSpec(Z, "AAB"));
+            ASSERT(&oa == X.get_allocator());
+            ASSERT(&za == Z.get_allocator());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tComparison.\n");
+        {
+            static const char *SPECS[] = {
+                "", "A", "AA", "AAB", "AB", "ABB", "B", "BB"
+            };  // in increasing order
+            const int NUM_SPECS = static_cast<int>(sizeof SPECS
+                                                   / sizeof *SPECS);
+
+            for (int i = 0; i < NUM_SPECS; ++i) {
+                Obj mX(&oa);  const Obj& X = gg(&mX, SPECS[i]);
+
+                for (int j = 0; j < NUM_SPECS; ++j) {
+                    Obj mY(&oa);  const Obj& Y = gg(&mY, SPECS[j]);
+
+                    if (veryVerbose) { T_ P_(SPECS[i]) P(SPECS[j]) }
+
+                    ASSERTV(i, j, (i == j) == (X == Y));
+                    ASSERTV(i, j, (i != j) == (X != Y));
+                    ASSERTV(i, j, (i <  j) == (X <  Y));
+                    ASSERTV(i, j, (i >  j) == (X >  Y));
+                    ASSERTV(i, j, (i <= j) == (X <= Y));
+                    ASSERTV(i, j, (i >= j) == (X >= Y));
+                }
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ERASE AND LOOKUP
+        //
+        // Concerns:
+        //: 1 Each 'erase' method removes the designated elements and returns
+        //:   the documented result.
+        //:
+        //: 2 The lookup methods report the position of the element equal to
+        //:   a key, whether or not such an element is present.
+        //:
+        //: 3 If the comparator is transparent, the lookup methods accept any
+        //:   key type the comparator supports, without converting it to
+        //:   'key_type', and report all the elements equivalent to that key.
+        //
+        // Plan:
+        //: 1 For each key of a small range, verify the results of the lookup
+        //:   methods on an object of known value, then erase the key using
+        //:   each 'erase' method and verify the result.  (C-1..2)
+        //:
+        //: 2 Using a transparent comparator, for which a lookup key may be
+        //:   equivalent to several keys, verify the results of the lookup
+        //:   methods for lookup keys equivalent to none, one, and several
+        //:   elements of an object of known value.  (C-3)
+        //
+        // Testing:
+        //   iterator erase(const_iterator);
+        //   size_type erase(const key_type&);
+        //   iterator erase(const_iterator, const_iterator);
+        //   const_iterator find(const key_type&) const;
+        //   size_type count(const key_type&) const;
+        //   bool contains(const key_type&) const;
+        //   const_iterator lower_bound(const key_type&) const;
+        //   const_iterator upper_bound(const key_type&) const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        //   const_iterator find(const LOOKUP_KEY&) const;
+        //   size_type count(const LOOKUP_KEY&) const;
+        //   bool contains(const LOOKUP_KEY&) const;
+        //   const_iterator lower_bound(const LOOKUP_KEY&) const;
+        //   const_iterator upper_bound(const LOOKUP_KEY&) const;
+        //   pair<const_iterator, ...> equal_range(const LOOKUP_KEY&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nERASE AND LOOKUP"
+                            "\n================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const char SPEC[]   = "BDDFFF";
+        const int  NUM_KEYS = 7;    // keys 'A' .. 'G'
+
+        for (int key = 0; key < NUM_KEYS; ++key) {
+            Obj mX(&oa);  const Obj& X = gg(&mX, SPEC);
+
+            Obj::size_type LOWER = 0;   // number of keys less than 'key'
+            Obj::size_type NUM   = 0;   // number of keys equal to 'key'
+            for (const char *p = SPEC; *p; ++p) {
+                LOWER += *p - 'A' <  key;
+                NUM   += *p - 'A' == key;
+            }
+            const Obj::size_type UPPER = LOWER + NUM;
+            const bool           FOUND = 0 < NUM;
+
+            if (veryVerbose) { T_ P_(key) P_(NUM) P(LOWER) }
+
+            ASSERTV(key, FOUND == X.contains(key));
+            ASSERTV(key, NUM   == X.count(key));
+            ASSERTV(key, (FOUND ? X.begin() + LOWER : X.end()) == X.find(key));
+            ASSERTV(key, X.begin() + LOWER == X.lower_bound(key));
+            ASSERTV(key, X.begin() + UPPER == X.upper_bound(key));
+            ASSERTV(key, X.begin() + LOWER == X.equal_range(key).first);
+            ASSERTV(key, X.begin() + UPPER == X.equal_range(key).second);
+
+            Obj mY(X, &oa);  const Obj& Y = mY;
+            ASSERTV(key, NUM   == mY.erase(key));
+            ASSERTV(key, X.size() - NUM == Y.size());
+            ASSERTV(key, !Y.contains(key));
+
+            if (FOUND) {
+                // Erasing by position removes only one of the equivalent
+                // keys.
+
+                Obj mZ(X, &oa);  const Obj& Z = mZ;
+                Obj::iterator it = mZ.erase(Z.find(key));
+                ASSERTV(key, NUM - 1 == Z.count(key));
+                ASSERTV(key, X.size() - 1 == Z.size());
+                ASSERTV(key, Z.begin() + LOWER == it);
+            }
+
+            Obj mW(X, &oa);  const Obj& W = mW;
+            Obj::iterator it = mW.erase(W.lower_bound(key),
+                                        W.upper_bound(key));
+            ASSERTV(key, W == Y);
+            ASSERTV(key, W.begin() + LOWER == it);
+        }
+
+        {
+            Obj mX(&oa);  const Obj& X = gg(&mX, "ABBCE");
+            Obj::iterator it = mX.erase(X.begin() + 1, X.end() - 1);
+            ASSERT(isSpec(X, "AE"));
+            ASSERT(X.begin() + 1 == it);
+        }
+
+        if (verbose) printf("\tTransparent lookup.\n");
+        {
+            typedef bsl::flat_multiset<int, TransparentLess> TransparentObj;
+
+            const int KEYS[] = { 1, 5, 12, 12, 17, 30 };
+
+            TransparentObj mX(KEYS, KEYS + 6, &oa);
+            const TransparentObj& X = mX;
+
+            static const struct {
+                int d_line;
+                int d_decade;  // lookup key
+                int d_lower;   // index of the first equivalent element
+                int d_num;     // number of equivalent elements
+            } DATA[] = {
+                //LINE  DECADE  LOWER  NUM
+                //----  ------  -----  ---
+                { L_,   0,      0,     2   },
+                { L_,   1,      2,     3   },
+                { L_,   2,      5,     0   },
+                { L_,   3,      5,     1   },
+                { L_,   4,      6,     0   },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int    LINE  = DATA[ti].d_line;
+                const Decade KEY   = { DATA[ti].d_decade };
+                const int    LOWER = DATA[ti].d_lower;
+                const int    UPPER = LOWER + DATA[ti].d_num;
+                const bool   FOUND = 0 < DATA[ti].d_num;
+
+                if (veryVerbose) { T_ P_(LINE) P_(KEY.d_value) P(LOWER) }
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                ASSERTV(LINE, FOUND == X.contains(KEY));
+                ASSERTV(LINE, UPPER - LOWER ==
+                                          static_cast<int>(X.count(KEY)));
+                ASSERTV(LINE, (FOUND ? X.begin() + LOWER : X.end())
+                                                             == X.find(KEY));
+                ASSERTV(LINE, X.begin() + LOWER == X.lower_bound(KEY));
+                ASSERTV(LINE, X.begin() + UPPER == X.upper_bound(KEY));
+                ASSERTV(LINE, X.begin() + LOWER == X.equal_range(KEY).first);
+                ASSERTV(LINE, X.begin() + UPPER == X.equal_range(KEY).second);
+
+                ASSERTV(LINE, oam.isTotalSame());
+            }
+
+            // Lookup by 'key_type' is unaffected.
+
+            ASSERT(2 == X.count(12));
+            ASSERT(X.begin() + 2 == X.find(12));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERTION
+        //
+        // Concerns:
+        //: 1 The single-value 'insert' and 'emplace' methods always insert a
+        //:   value, after any equivalent keys, and return its position.
+        //:
+        //: 2 The hinted methods produce a sorted value whether or not the
+        //:   hint is correct, inserting the value as close as possible to the
+        //:   position just prior to the hint.
+        //:
+        //: 3 The range methods insert every value of the range, after any
+        //:   equivalent keys already present, and the 'sorted_equivalent'
+        //:   range method does so for a sorted range, retaining the relative
+        //:   order of its equivalent keys.
+        //:
+        //: 4 An inserted value is moved, rather than copied, when supplied
+        //:   as a 'MovableRef'.
+        //:
+        //: 5 Elements are created with the allocator of the container.
+        //
+        // Plan:
+        //: 1 Using a table of initial values and inserted values, perform
+        //:   each insertion and verify the resulting value.  (C-1..3)
+        //:
+        //: 2 Using a comparator under which distinct keys are equivalent,
+        //:   verify the relative order of equivalent keys after each kind of
+        //:   insertion.  (C-1..3)
+        //:
+        //: 3 Insert a 'bsl::string' by move, and verify that the element
+        //:   uses the allocator of the container.  (C-4..5)
+        //
+        // Testing:
+        //   iterator insert(const value_type&);
+        //   iterator insert(MovableRef<value_type>);
+        //   iterator insert(const_iterator, const value_type&);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(sorted_equivalent_t, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(initializer_list<KEY>);
+        //   iterator emplace(Args&&...);
+        //   iterator emplace_hint(const_iterator, Args&&...);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINSERTION"
+                            "\n=========\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        static const struct {
+            int         d_line;
+            const char *d_initial_p;   // initial value
+            const char *d_range_p;     // inserted values
+            const char *d_result_p;    // expected value
+        } DATA[] = {
+            //LINE  INITIAL  RANGE     RESULT
+            //----  -------  -----     ------
+            { L_,   "",      "",       ""          },
+            { L_,   "",      "A",      "A"         },
+            { L_,   "A",     "A",      "AA"        },
+            { L_,   "B",     "CA",     "ABC"       },
+            { L_,   "BD",    "EDCA",   "ABCDDE"    },
+            { L_,   "ACE",   "BBDD",   "ABBCDDE"   },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            const char *const INITIAL = DATA[ti].d_initial_p;
+            const char *const RANGE   = DATA[ti].d_range_p;
+            const char *const RESULT  = DATA[ti].d_result_p;
+
+            if (veryVerbose) { T_ P_(LINE) P_(INITIAL) P(RANGE) }
+
+            const bsl::vector<Value> values = toValues(RANGE);
+
+            {
+                Obj mX(&oa);  const Obj& X = gg(&mX, INITIAL);
+                mX.insert(values.begin(), values.end());
+                ASSERTV(LINE, isSpec(X, RESULT));
+            }
+            {
+                Obj mX(&oa);  const Obj& X = gg(&mX, INITIAL);
+                for (size_t i = 0; i < values.size(); ++i) {
+                    Obj::iterator it = mX.insert(values[i]);
+                    ASSERTV(LINE, i, values[i] == *it);
+                    ASSERTV(LINE, i, X.upper_bound(values[i]) == it + 1);
+                }
+                ASSERTV(LINE, isSpec(X, RESULT));
+            }
+            {
+                Obj mX(&oa);  const Obj& X = gg(&mX, INITIAL);
+                for (size_t i = 0; i < values.size(); ++i) {
+                    // Use a hint that is usually wrong.
+
+                    Obj::iterator it = mX.insert(X.begin(), values[i]);
+                    ASSERTV(LINE, i, values[i] == *it);
+                }
+                ASSERTV(LINE, isSpec(X, RESULT));
+            }
+            {
+                // Insert the range sorted.
+
+                Obj mS(&oa);  const Obj& S = gg(&mS, RANGE);
+
+                Obj mX(&oa);  const Obj& X = gg(&mX, INITIAL);
+                mX.insert(bsl::sorted_equivalent, S.begin(), S.end());
+                ASSERTV(LINE, isSpec(X, RESULT));
+            }
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+            {
+                Obj mX(&oa);  const Obj& X = gg(&mX, INITIAL);
+                for (size_t i = 0; i < values.size(); ++i) {
+                    Obj::iterator it = mX.emplace(values[i]);
+                    ASSERTV(LINE, i, values[i] == *it);
+                    ASSERTV(LINE, i, X.upper_bound(values[i]) == it + 1);
+                }
+                ASSERTV(LINE, isSpec(X, RESULT));
+            }
+            {
+                Obj mX(&oa);  const Obj& X = gg(&mX, INITIAL);
+                for (size_t i = 0; i < values.size(); ++i) {
+                    Obj::iterator it = mX.emplace_hint(X.end(), values[i]);
+                    ASSERTV(LINE, i, values[i] == *it);
+                }
+                ASSERTV(LINE, isSpec(X, RESULT));
+            }
+#endif
+        }
+
+        if (verbose) printf("\tRelative order of equivalent keys.\n");
+        {
+            typedef bsl::flat_multiset<int, DecadeLess> DecadeObj;
+
+            const int INITIAL[] = { 12, 17, 25 };
+
+            {
+                DecadeObj mX(INITIAL, INITIAL + 3, &oa);
+                const DecadeObj& X = mX;
+
+                DecadeObj::iterator it = mX.insert(15);
+                ASSERT(X.begin() + 2 == it);
+
+                it = mX.insert(X.begin(), 13);
+                ASSERT(X.begin() == it);
+
+                it = mX.insert(X.end(), 14);
+                ASSERT(X.begin() + 4 == it);
+
+                it = mX.insert(X.begin() + 2, 21);
+                ASSERT(X.begin() + 5 == it);
+
+                const int EXPECTED[] = { 13, 12, 17, 15, 14, 21, 25 };
+                ASSERT(7 == X.size());
+                for (int i = 0; i < 7; ++i) {
+                    ASSERTV(i, X.begin()[i], EXPECTED[i] == X.begin()[i]);
+                }
+            }
+            {
+                // Keys already present precede the equivalent keys of an
+                // unsorted range, whose own relative order is unspecified.
+
+                const int RANGE[] = { 31, 15, 11 };
+
+                DecadeObj mX(INITIAL, INITIAL + 2, &oa);
+                const DecadeObj& X = mX;
+
+                mX.insert(RANGE, RANGE + 3);
+                ASSERT(5  == X.size());
+                ASSERT(12 == X.begin()[0]);
+                ASSERT(17 == X.begin()[1]);
+                ASSERT(26 == X.begin()[2] + X.begin()[3]);
+                ASSERT(31 == X.begin()[4]);
+            }
+            {
+                // A sorted range retains the relative order of its equivalent
+                // keys.
+
+                const int RANGE[]    = { 15, 11, 19, 31 };
+                const int EXPECTED[] = { 12, 17, 15, 11, 19, 25, 31 };
+
+                DecadeObj mX(INITIAL, INITIAL + 3, &oa);
+                const DecadeObj& X = mX;
+
+                mX.insert(bsl::sorted_equivalent, RANGE, RANGE + 4);
+                ASSERT(7 == X.size());
+                for (int i = 0; i < 7; ++i) {
+                    ASSERTV(i, X.begin()[i], EXPECTED[i] == X.begin()[i]);
+                }
+            }
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        if (verbose) printf("\tInitializer-list insertion.\n");
+        {
+            Obj mX(&oa);  const Obj& X = gg(&mX, "BC");
+
+            mX.insert({ 3, 0, 3 });
+            ASSERT(isSpec(X, "ABCDD"));
+
+            mX.insert(bsl::sorted_equivalent, { 0, 4 });
+            ASSERT(isSpec(X, "AABCDDE"));
+        }
+#endif
+
+        if (verbose) printf("\tInsertion by move.\n");
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+
+            bslma::TestAllocator sa("source", veryVeryVeryVerbose);
+
+            bsl::string value("a key long enough to allocate memory", &sa);
+
+            StringObj::iterator it = mX.insert(MoveUtil::move(value));
+            ASSERT(&oa == it->get_allocator());
+            ASSERT("a key long enough to allocate memory" == *it);
+            ASSERT(1 == X.size());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND TYPE TRAITS
+        //
+        // Concerns:
+        //: 1 Each constructor creates an object having the documented value,
+        //:   comparator, and allocator.
+        //:
+        //: 2 The range constructors retain every value of the range, and the
+        //:   'sorted_equivalent' constructors accept a sorted range as is.
+        //:
+        //: 3 'flat_multiset' declares the 'bslma::UsesBslmaAllocator' and
+        //:   'bslalg::HasStlIterators' traits.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor, and verify their value,
+        //:   comparator, and allocator.  (C-1..2)
+        //:
+        //: 2 Verify the traits.  (C-3)
+        //
+        // Testing:
+        //   flat_multiset();
+        //   flat_multiset(const COMPARATOR&, const ALLOCATOR&);
+        //   flat_multiset(const ALLOCATOR&);
+        //   flat_multiset(INPUT_ITERATOR, INPUT_ITERATOR, const COMP&, ...);
+        //   flat_multiset(INPUT_ITERATOR, INPUT_ITERATOR, const ALLOCATOR&);
+        //   flat_multiset(sorted_equivalent_t, INPUT_ITER, INPUT_ITER, ...);
+        //   flat_multiset(initializer_list<KEY>, ...);
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   TYPE TRAITS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTORS AND TYPE TRAITS"
+                            "\n============================\n");
+
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        ASSERT(bslalg::HasStlIterators<Obj>::value);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const bsl::vector<Value> unsorted = toValues("CABAC");
+        const bsl::vector<Value> sorted   = toValues("AABCC");
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(&defaultAllocator == X.get_allocator());
+        }
+        {
+            typedef bsl::flat_multiset<int, std::greater<int> > GreaterObj;
+
+            GreaterObj mX(std::greater<int>(), &oa);  const GreaterObj& X = mX;
+            mX.insert(unsorted.begin(), unsorted.end());
+            ASSERT(5 == X.size());
+            ASSERT(2 == *X.begin());
+            ASSERT(0 == *X.rbegin());
+            ASSERT(&oa == X.get_allocator());
+            ASSERT(X.key_comp()(2, 1));
+            ASSERT(X.value_comp()(2, 1));
+        }
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(&oa == X.get_allocator());
+        }
+        {
+            Obj mX(unsorted.begin(), unsorted.end());  const Obj& X = mX;
+            ASSERT(isSpec(X, "AABCC"));
+            ASSERT(&defaultAllocator == X.get_allocator());
+        }
+        {
+            Obj mX(unsorted.begin(), unsorted.end(), &oa);  const Obj& X = mX;
+            ASSERT(isSpec(X, "AABCC"));
+            ASSERT(&oa == X.get_allocator());
+        }
+        {
+            Obj mX(bsl::sorted_equivalent, sorted.begin(), sorted.end(), &oa);
+            const Obj& X = mX;
+            ASSERT(isSpec(X, "AABCC"));
+            ASSERT(&oa == X.get_allocator());
+        }
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            Obj mX({ 2, 0, 2 }, &oa);  const Obj& X = mX;
+            ASSERT(isSpec(X, "ACC"));
+            ASSERT(&oa == X.get_allocator());
+
+            mX = { 1, 1 };
+            ASSERT(isSpec(X, "BB"));
+        }
+#endif
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a multiset, insert keys one at a time and in bulk, look
+        //:   them up, iterate over them, and erase them.
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   void clear();
+        //   void reserve(size_type);
+        //   void shrink_to_fit();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(X.empty());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.cbegin() == X.cend());
+            ASSERT(X.rbegin() == X.rend());
+
+            ASSERT(3 == *mX.insert(3));
+            ASSERT(1 == *mX.insert(1));
+            ASSERT(3 == *mX.insert(3));
+            ASSERT(2 == X.count(3));
+
+            const Value VALUES[] = { 2, 1 };
+            mX.insert(VALUES, VALUES + 2);
+            ASSERT(isSpec(X, "BBCDD"));
+
+            ASSERT(1 == *X.begin());
+            ASSERT(3 == *X.rbegin());
+            ASSERT(3 == *X.crbegin());
+
+            mX.reserve(64);
+            ASSERT(64 <= X.capacity());
+            ASSERT(isSpec(X, "BBCDD"));
+
+            mX.shrink_to_fit();
+            ASSERT(isSpec(X, "BBCDD"));
+
+            ASSERT(2 == mX.erase(1));
+            ASSERT(isSpec(X, "CDD"));
+
+            mX.clear();
+            ASSERT(X.empty());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
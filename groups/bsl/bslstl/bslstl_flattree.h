@@ -0,0 +1,1452 @@
+// bslstl_flattree.h                                                  -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATTREE
+#define INCLUDED_BSLSTL_FLATTREE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a sorted-vector implementation of associative containers.
+//
+//@CLASSES:
+//  bsl::sorted_unique_t: tag indicating a range is sorted with unique keys
+//  bsl::sorted_equivalent_t: tag indicating a range is sorted
+//  bslstl::FlatTree: sorted vector of values supporting key-based lookup
+//
+//@SEE_ALSO: bslstl_flatmap, bslstl_flatmultimap, bslstl_flatset,
+//           bslstl_flatmultiset
+//
+//@DESCRIPTION: This component defines a class template, 'bslstl::FlatTree',
+// that provides the storage and the algorithms shared by the "flat" ordered
+// associative containers ('bsl::flat_map', 'bsl::flat_multimap',
+// 'bsl::flat_set', and 'bsl::flat_multiset').  A 'FlatTree' holds its values
+// in a single 'bsl::vector', kept sorted by the keys of the values according
+// to a comparator supplied at construction.  Lookups are binary searches over
+// contiguous memory, and iteration is a linear scan, so both are several
+// times faster than the corresponding operations on a node-based tree.  On
+// the other hand, inserting or erasing a single value moves every value after
+// it, and so has linear complexity.
+//
+// The (template parameter) type 'KEY_CONFIG' describes the values held by a
+// 'FlatTree' and how to obtain the key of a value: it provides the types
+// 'KeyType' and 'ValueType', and a class method 'extractKey' that returns a
+// reference to the key of a value.  The configurations
+// 'bslstl::UnorderedMapKeyConfiguration' and
+// 'bslstl::UnorderedSetKeyConfiguration' are suitable for maps and sets,
+// respectively.
+//
+// Each insertion method of a 'FlatTree' comes in a "unique" and a "multi"
+// form: the former inserts a value only if no value having an equivalent key
+// is present, and the latter always inserts, after any values having an
+// equivalent key.  A container uses only the forms matching its semantics.
+//
+// The lookup methods of a 'FlatTree' are templates on the type of the key
+// they are passed, so that a container can offer lookup by any type that its
+// (transparent) comparator can compare with 'KeyType' (see
+// 'bslmf_istransparentpredicate'), without converting it to 'KeyType'.
+//
+///Bulk Insertion
+///--------------
+// Inserting a range of 'M' values into a 'FlatTree' of 'N' values appends the
+// range to the vector, sorts the appended values (unless the caller asserts
+// that they are already sorted by passing 'bsl::sorted_unique' or
+// 'bsl::sorted_equivalent'), and merges the two sorted sequences.  A range
+// insertion therefore has 'O[N + M * log(M)]' complexity, or 'O[N + M]'
+// complexity for a sorted range, rather than the 'O[M * N]' complexity of
+// inserting the values one at a time.  In particular, building a 'FlatTree'
+// from a sorted range has linear complexity.  Note that if several values of
+// an unsorted range have equivalent keys, which of them is retained by a
+// "unique" insertion is unspecified, as is their relative order after a
+// "multi" insertion; the values already present always precede (and, for a
+// "unique" insertion, take precedence over) the inserted values.
+//
+///Usage
+///-----
+// There is no usage example for this component since it is not meant for
+// direct client use.
+
+#include <bslscm_version.h>
+
+#include <bslstl_pair.h>
+#include <bslstl_vector.h>
+
+#include <bslalg_swaputil.h>
+
+#include <bslma_allocatortraits.h>
+#include <bslma_destructorguard.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_performancehint.h>
+
+#include <algorithm>
+
+namespace bsl {
+
+                          // ======================
+                          // struct sorted_unique_t
+                          // ======================
+
+struct sorted_unique_t {
+    // This tag type indicates that a range of values supplied to a flat
+    // associative container is sorted by key, according to the comparator of
+    // the container, and holds no two values having equivalent keys.
+};
+
+static const sorted_unique_t sorted_unique = { };
+    // Value of type 'sorted_unique_t' used as actual argument to functions
+    // that take a sorted range of values having unique keys.
+
+                        // ==========================
+                        // struct sorted_equivalent_t
+                        // ==========================
+
+struct sorted_equivalent_t {
+    // This tag type indicates that a range of values supplied to a flat
+    // associative container is sorted by key, according to the comparator of
+    // the container.
+};
+
+static const sorted_equivalent_t sorted_equivalent = { };
+    // Value of type 'sorted_equivalent_t' used as actual argument to functions
+    // that take a sorted range of values.
+
+}  // close namespace bsl
+
+namespace BloombergLP {
+namespace bslstl {
+
+                               // ==============
+                               // class FlatTree
+                               // ==============
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+class FlatTree {
+    // This class template implements a sorted sequence of values (of the type
+    // 'KEY_CONFIG::ValueType'), stored contiguously in a 'bsl::vector' using
+    // the (template parameter) type 'ALLOCATOR', and ordered by their keys (of
+    // the type 'KEY_CONFIG::KeyType') according to the (template parameter)
+    // type 'COMPARATOR', whose function-call operator must be
+    // 'const'-qualified.  Note that the invariant of this class (that the
+    // values are sorted) holds only if the clients of this class do not
+    // modify the keys of the values through the iterators it provides.
+
+  public:
+    // PUBLIC TYPES
+    typedef typename KEY_CONFIG::KeyType            KeyType;
+    typedef typename KEY_CONFIG::ValueType          ValueType;
+    typedef bsl::vector<ValueType, ALLOCATOR>       Storage;
+    typedef typename Storage::size_type             size_type;
+    typedef typename Storage::iterator              iterator;
+    typedef typename Storage::const_iterator        const_iterator;
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::allocator_traits<ALLOCATOR>        AllocatorTraits;
+    typedef bslmf::MovableRefUtil                   MoveUtil;
+
+    class ValueLess {
+        // This functor orders values by their keys, using the comparator of a
+        // 'FlatTree'.
+
+        // DATA
+        const FlatTree *d_tree_p;  // tree whose comparator is used
+
+      public:
+        // CREATORS
+        explicit ValueLess(const FlatTree *tree);
+            // Create a functor that orders values using the comparator of the
+            // specified 'tree'.
+
+        // ACCESSORS
+        bool operator()(const ValueType& lhs, const ValueType& rhs) const;
+            // Return 'true' if the key of the specified 'lhs' is ordered
+            // before the key of the specified 'rhs', and 'false' otherwise.
+    };
+
+    class TailProctor {
+        // This class implements a proctor that, unless released, erases the
+        // values of a vector from a position supplied at construction to the
+        // end of the vector when the proctor is destroyed.
+
+        // DATA
+        Storage   *d_values_p;  // guarded vector, or 0 if released
+        size_type  d_position;  // position of the first guarded value
+
+      private:
+        // NOT IMPLEMENTED
+        TailProctor(const TailProctor&);
+        TailProctor& operator=(const TailProctor&);
+
+      public:
+        // CREATORS
+        TailProctor(Storage *values, size_type position);
+            // Create a proctor guarding the values at and after the specified
+            // 'position' in the specified 'values'.
+
+        ~TailProctor();
+            // Erase the guarded values, unless this proctor was released, and
+            // destroy this proctor.
+
+        // MANIPULATORS
+        void release();
+            // Release the guarded values from management by this proctor.
+    };
+
+    // DATA
+    Storage    d_values;      // values, sorted by key
+    COMPARATOR d_comparator;  // orders keys
+
+    // PRIVATE MANIPULATORS
+    template <class INPUT_ITERATOR>
+    void insertRange(INPUT_ITERATOR first,
+                     INPUT_ITERATOR last,
+                     bool           isSorted,
+                     bool           isUnique);
+        // Insert the values in the range starting at the specified 'first'
+        // and ending immediately before the specified 'last' into this tree,
+        // sorting them first unless the specified 'isSorted' is 'true', and
+        // discarding each value whose key is equivalent to that of a value
+        // already present or earlier in the sorted range if the specified
+        // 'isUnique' is 'true'.  If 'isSorted' is 'true', the behavior is
+        // undefined unless the range is sorted and, if 'isUnique' is also
+        // 'true', holds no two values having equivalent keys.
+
+    void mergeTail(size_type numSorted, bool isUnique);
+        // Merge the sorted values at and after the specified 'numSorted'
+        // position of the vector of this tree into the (sorted) values before
+        // that position, discarding each value of the former sequence whose
+        // key is equivalent to that of a value of the latter sequence, or to
+        // that of an earlier value of the former sequence, if the specified
+        // 'isUnique' is 'true'.  If an exception is thrown, this tree is left
+        // in a valid but unspecified state.
+
+    // PRIVATE ACCESSORS
+    template <class LOOKUP_KEY>
+    bool isKeyLess(const LOOKUP_KEY& key, const ValueType& value) const;
+        // Return 'true' if the specified 'key' is ordered before the key of
+        // the specified 'value', and 'false' otherwise.
+
+    bool isOrdered(const_iterator first,
+                   const_iterator last,
+                   bool           isUnique) const;
+        // Return 'true' if the values in the range starting at the specified
+        // 'first' and ending immediately before the specified 'last' are
+        // sorted by key and, if the specified 'isUnique' is 'true', no two of
+        // them have equivalent keys, and 'false' otherwise.
+
+    template <class LOOKUP_KEY>
+    bool isValueLess(const ValueType& value, const LOOKUP_KEY& key) const;
+        // Return 'true' if the key of the specified 'value' is ordered before
+        // the specified 'key', and 'false' otherwise.
+
+    template <class LOOKUP_KEY>
+    size_type lowerBoundIndex(const LOOKUP_KEY& key,
+                              size_type         first,
+                              size_type         last) const;
+        // Return the position of the first value, among those at positions
+        // '[first .. last)', whose key is not ordered before the specified
+        // 'key', or 'last' if there is no such value.
+
+    template <class LOOKUP_KEY>
+    size_type upperBoundIndex(const LOOKUP_KEY& key,
+                              size_type         first,
+                              size_type         last) const;
+        // Return the position of the first value, among those at positions
+        // '[first .. last)', whose key is ordered after the specified 'key',
+        // or 'last' if there is no such value.
+
+    size_type uniqueHintIndex(const_iterator hint, const KeyType& key) const;
+        // Return the position at which a value having the specified 'key'
+        // should be inserted into this tree of unique keys, using the
+        // specified 'hint' if it is the correct position (in constant time),
+        // and a binary search otherwise.  If a value having a key equivalent
+        // to 'key' is present, return its position.
+
+    size_type multiHintIndex(const_iterator hint, const KeyType& key) const;
+        // Return the position, as close as possible to the specified 'hint',
+        // at which a value having the specified 'key' may be inserted into
+        // this tree without violating its ordering.
+
+  public:
+    // CREATORS
+    FlatTree(const COMPARATOR& comparator, const ALLOCATOR& basicAllocator);
+        // Create an empty tree that orders its values using a copy of the
+        // specified 'comparator' and uses the specified 'basicAllocator' to
+        // supply memory.
+
+    FlatTree(const FlatTree& original, const ALLOCATOR& basicAllocator);
+        // Create a tree having the same values and comparator as the
+        // specified 'original' tree, using the specified 'basicAllocator' to
+        // supply memory.
+
+    FlatTree(bslmf::MovableRef<FlatTree> original);                 // IMPLICIT
+        // Create a tree having the same values and comparator as the
+        // specified 'original' tree by moving (in constant time) the contents
+        // of 'original' to the new tree, and using the allocator of
+        // 'original'.  'original' is left in a valid but unspecified state.
+
+    FlatTree(bslmf::MovableRef<FlatTree> original,
+             const ALLOCATOR&            basicAllocator);
+        // Create a tree having the same values and comparator as the
+        // specified 'original' tree, using the specified 'basicAllocator' to
+        // supply memory.  The contents of 'original' are moved (in constant
+        // time) if 'basicAllocator' is the allocator of 'original', and are
+        // move-inserted (in linear time) otherwise.  'original' is left in a
+        // valid but unspecified state.
+
+    //! ~FlatTree() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatTree& operator=(const FlatTree& rhs);
+        // Assign to this object the values and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    FlatTree& operator=(bslmf::MovableRef<FlatTree> rhs);
+        // Assign to this object the values and comparator of the specified
+        // 'rhs' object, moving the contents of 'rhs' (in constant time) if
+        // both objects use the same allocator, and return a reference
+        // providing modifiable access to this object.  'rhs' is left in a
+        // valid but unspecified state.
+
+    iterator begin();
+        // Return an iterator to the first value of this tree, or 'end()' if
+        // this tree is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this tree.
+
+    void clear();
+        // Remove all values from this tree, retaining its capacity.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... ARGS>
+    bsl::pair<iterator, bool> emplaceUnique(ARGS&&... arguments);
+        // Insert into this tree a value constructed from the specified
+        // 'arguments', if no value having an equivalent key is present.
+        // Return a pair whose 'first' member is an iterator to the (possibly
+        // newly inserted) value having the key, and whose 'second' member is
+        // 'true' if a value was inserted, and 'false' otherwise.
+
+    template <class... ARGS>
+    iterator emplaceUniqueHint(const_iterator hint, ARGS&&... arguments);
+        // Insert into this tree a value constructed from the specified
+        // 'arguments', if no value having an equivalent key is present, using
+        // the specified 'hint' as the position to try first.  Return an
+        // iterator to the (possibly newly inserted) value having the key.
+
+    template <class... ARGS>
+    iterator emplaceMulti(ARGS&&... arguments);
+        // Insert into this tree, after any values having an equivalent key, a
+        // value constructed from the specified 'arguments'.  Return an
+        // iterator to the inserted value.
+
+    template <class... ARGS>
+    iterator emplaceMultiHint(const_iterator hint, ARGS&&... arguments);
+        // Insert into this tree, as close as possible before the specified
+        // 'hint', a value constructed from the specified 'arguments'.  Return
+        // an iterator to the inserted value.
+#endif
+
+    template <class LOOKUP_KEY>
+    bsl::pair<iterator, iterator> equalRange(const LOOKUP_KEY& key);
+        // Return a pair of iterators delimiting the values of this tree whose
+        // keys are equivalent to the specified 'key'.
+
+    iterator erase(const_iterator position);
+        // Remove the value at the specified 'position' from this tree, and
+        // return an iterator to the value that followed it.  The behavior is
+        // undefined unless 'position' refers to a value of this tree.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove the values in the range starting at the specified 'first' and
+        // ending immediately before the specified 'last' from this tree, and
+        // return an iterator to the value that followed them.  The behavior
+        // is undefined unless 'first' and 'last' delimit a range of values of
+        // this tree.
+
+    size_type eraseKey(const KeyType& key);
+        // Remove the values whose keys are equivalent to the specified 'key'
+        // from this tree, and return the number of values removed.
+
+    template <class LOOKUP_KEY>
+    iterator find(const LOOKUP_KEY& key);
+        // Return an iterator to the first value of this tree whose key is
+        // equivalent to the specified 'key', or 'end()' if there is none.
+
+    bsl::pair<iterator, bool> insertUnique(const ValueType& value);
+    bsl::pair<iterator, bool> insertUnique(
+                                         bslmf::MovableRef<ValueType> value);
+        // Insert the specified 'value' into this tree if no value having an
+        // equivalent key is present.  Return a pair whose 'first' member is
+        // an iterator to the (possibly newly inserted) value having the key,
+        // and whose 'second' member is 'true' if 'value' was inserted, and
+        // 'false' otherwise.
+
+    iterator insertUnique(const_iterator hint, const ValueType& value);
+    iterator insertUnique(const_iterator               hint,
+                          bslmf::MovableRef<ValueType> value);
+        // Insert the specified 'value' into this tree if no value having an
+        // equivalent key is present, using the specified 'hint' as the
+        // position to try first, and return an iterator to the (possibly
+        // newly inserted) value having the key.  The insertion position is
+        // found in constant time if 'hint' refers to the value that would
+        // follow 'value'.
+
+    iterator insertMulti(const ValueType& value);
+    iterator insertMulti(bslmf::MovableRef<ValueType> value);
+        // Insert the specified 'value' into this tree, after any values having
+        // an equivalent key, and return an iterator to the inserted value.
+
+    iterator insertMulti(const_iterator hint, const ValueType& value);
+    iterator insertMulti(const_iterator               hint,
+                         bslmf::MovableRef<ValueType> value);
+        // Insert the specified 'value' into this tree as close as possible
+        // before the specified 'hint', and return an iterator to the inserted
+        // value.  The insertion position is found in constant time if 'hint'
+        // is a correct position for 'value'.
+
+    template <class INPUT_ITERATOR>
+    void insertRangeUnique(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this tree each value in the range starting at the
+        // specified 'first' and ending immediately before the specified
+        // 'last' whose key is not equivalent to that of a value already
+        // present or of another value of the range that is retained.  See
+        // {Bulk Insertion}.
+
+    template <class INPUT_ITERATOR>
+    void insertRangeMulti(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this tree each value in the range starting at the
+        // specified 'first' and ending immediately before the specified
+        // 'last'.  See {Bulk Insertion}.
+
+    template <class INPUT_ITERATOR>
+    void insertSortedUnique(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this tree, in linear time, each value in the range
+        // starting at the specified 'first' and ending immediately before the
+        // specified 'last' whose key is not equivalent to that of a value
+        // already present.  The behavior is undefined unless the range is
+        // sorted by key and no two of its values have equivalent keys.
+
+    template <class INPUT_ITERATOR>
+    void insertSortedMulti(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this tree, in linear time, each value in the range
+        // starting at the specified 'first' and ending immediately before the
+        // specified 'last'.  The behavior is undefined unless the range is
+        // sorted by key.
+
+    template <class LOOKUP_KEY>
+    iterator lowerBound(const LOOKUP_KEY& key);
+        // Return an iterator to the first value of this tree whose key is not
+        // ordered before the specified 'key', or 'end()' if there is none.
+
+    void reserve(size_type numValues);
+        // Increase the capacity of this tree, if necessary, so that at least
+        // the specified 'numValues' values can be held without reallocation.
+
+    void shrinkToFit();
+        // Reduce the capacity of this tree to its size, if possible.
+
+    void swap(FlatTree& other);
+        // Exchange the values and comparator of this object with those of the
+        // specified 'other' object.  Additionally, if
+        // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+        // 'true', exchange the allocators of the objects.  This method
+        // provides the no-throw guarantee, unless swapping the comparators
+        // throws, if the allocators are exchanged or are equal; otherwise,
+        // the values are copied (using the allocator of their destination),
+        // and this method provides the basic guarantee.
+
+    template <class LOOKUP_KEY>
+    iterator upperBound(const LOOKUP_KEY& key);
+        // Return an iterator to the first value of this tree whose key is
+        // ordered after the specified 'key', or 'end()' if there is none.
+
+    // ACCESSORS
+    ALLOCATOR allocator() const;
+        // Return (a copy of) the allocator used by this tree.
+
+    const_iterator begin() const;
+        // Return an iterator to the first value of this tree, or 'end()' if
+        // this tree is empty.
+
+    size_type capacity() const;
+        // Return the number of values this tree can hold without
+        // reallocation.
+
+    const COMPARATOR& comparator() const;
+        // Return a reference providing non-modifiable access to the
+        // comparator of this tree.
+
+    template <class LOOKUP_KEY>
+    size_type count(const LOOKUP_KEY& key) const;
+        // Return the number of values of this tree whose keys are equivalent
+        // to the specified 'key'.
+
+    bool empty() const;
+        // Return 'true' if this tree holds no values, and 'false' otherwise.
+
+    const_iterator end() const;
+        // Return the past-the-end iterator of this tree.
+
+    template <class LOOKUP_KEY>
+    bsl::pair<const_iterator, const_iterator> equalRange(
+                                                  const LOOKUP_KEY& key) const;
+        // Return a pair of iterators delimiting the values of this tree whose
+        // keys are equivalent to the specified 'key'.
+
+    template <class LOOKUP_KEY>
+    const_iterator find(const LOOKUP_KEY& key) const;
+        // Return an iterator to the first value of this tree whose key is
+        // equivalent to the specified 'key', or 'end()' if there is none.
+
+    template <class LOOKUP_KEY>
+    const_iterator lowerBound(const LOOKUP_KEY& key) const;
+        // Return an iterator to the first value of this tree whose key is not
+        // ordered before the specified 'key', or 'end()' if there is none.
+
+    size_type maxSize() const;
+        // Return the maximum number of values this tree could hold.
+
+    size_type size() const;
+        // Return the number of values in this tree.
+
+    template <class LOOKUP_KEY>
+    const_iterator upperBound(const LOOKUP_KEY& key) const;
+        // Return an iterator to the first value of this tree whose key is
+        // ordered after the specified 'key', or 'end()' if there is none.
+
+    const Storage& values() const;
+        // Return a reference providing non-modifiable access to the (sorted)
+        // vector of values of this tree.
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                         // -------------------------
+                         // class FlatTree::ValueLess
+                         // -------------------------
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ValueLess::ValueLess(
+                                                        const FlatTree *tree)
+: d_tree_p(tree)
+{
+}
+
+// ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+bool FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::ValueLess::operator()(
+                                                  const ValueType& lhs,
+                                                  const ValueType& rhs) const
+{
+    return d_tree_p->d_comparator(KEY_CONFIG::extractKey(lhs),
+                                  KEY_CONFIG::extractKey(rhs));
+}
+
+                        // ---------------------------
+                        // class FlatTree::TailProctor
+                        // ---------------------------
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::TailProctor::TailProctor(
+                                                       Storage   *values,
+                                                       size_type  position)
+: d_values_p(values)
+, d_position(position)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::TailProctor::~TailProctor()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_values_p)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        d_values_p->erase(d_values_p->begin() + d_position,
+                          d_values_p->end());
+    }
+}
+
+// MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::TailProctor::release()
+{
+    d_values_p = 0;
+}
+
+                               // --------------
+                               // class FlatTree
+                               // --------------
+
+// PRIVATE MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertRange(
+                                                 INPUT_ITERATOR first,
+                                                 INPUT_ITERATOR last,
+                                                 bool           isSorted,
+                                                 bool           isUnique)
+{
+    const size_type numSorted = d_values.size();
+
+    // Until the merge, the values of this tree are those before 'numSorted',
+    // so the appended values are erased should the insertion (which may leave
+    // some of them in place), the sort, or an assertion handler throw.
+
+    TailProctor proctor(&d_values, numSorted);
+
+    d_values.insert(d_values.end(), first, last);
+
+    if (numSorted == d_values.size()) {
+        proctor.release();
+        return;                                                       // RETURN
+    }
+
+    if (isSorted) {
+        BSLS_ASSERT_SAFE(isOrdered(d_values.begin() + numSorted,
+                                   d_values.end(),
+                                   isUnique));
+    }
+    else {
+        std::sort(d_values.begin() + numSorted,
+                  d_values.end(),
+                  ValueLess(this));
+    }
+
+    proctor.release();
+
+    mergeTail(numSorted, isUnique);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::mergeTail(
+                                                   size_type numSorted,
+                                                   bool      isUnique)
+{
+    BSLS_ASSERT_SAFE(numSorted <= d_values.size());
+
+    const iterator middle = d_values.begin() + numSorted;
+    const iterator end    = d_values.end();
+
+    if (middle == end) {
+        return;                                                       // RETURN
+    }
+
+    const ValueLess less(this);
+
+    if (0 == numSorted
+     || (isUnique ? less(*(middle - 1), *middle)
+                  : !less(*middle, *(middle - 1)))) {
+        // The appended values all follow the values already present, which
+        // is the common case of a tree built from sorted input; only the
+        // duplicates within the appended values need be discarded.
+
+        if (isUnique) {
+            TailProctor proctor(&d_values, numSorted);
+
+            iterator last = middle;
+            for (iterator it = middle + 1; it != end; ++it) {
+                if (less(*last, *it)) {
+                    ++last;
+                    if (last != it) {
+                        *last = MoveUtil::move(*it);
+                    }
+                }
+            }
+
+            proctor.release();
+
+            d_values.erase(last + 1, end);
+        }
+        return;                                                       // RETURN
+    }
+
+    // Merge into a new vector, supplied by the same allocator, which provides
+    // linear complexity without requiring the values to be move-assignable.
+    // Should an exception be thrown, the (partially moved-from) values of this
+    // tree are discarded.
+
+    Storage merged(d_values.get_allocator());
+    {
+        // Should the allocation fail, the appended values are discarded.
+
+        TailProctor tailProctor(&d_values, numSorted);
+        merged.reserve(d_values.size());
+        tailProctor.release();
+    }
+
+    TailProctor proctor(&d_values, 0);
+
+    iterator lhs = d_values.begin();
+    iterator rhs = middle;
+
+    while (lhs != middle && rhs != end) {
+        if (less(*rhs, *lhs)) {
+            if (!isUnique || merged.empty() || less(merged.back(), *rhs)) {
+                merged.push_back(MoveUtil::move(*rhs));
+            }
+            ++rhs;
+        }
+        else {
+            merged.push_back(MoveUtil::move(*lhs));
+            ++lhs;
+        }
+    }
+
+    for (; lhs != middle; ++lhs) {
+        merged.push_back(MoveUtil::move(*lhs));
+    }
+
+    for (; rhs != end; ++rhs) {
+        if (!isUnique || less(merged.back(), *rhs)) {
+            merged.push_back(MoveUtil::move(*rhs));
+        }
+    }
+
+    proctor.release();
+
+    d_values.swap(merged);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+bool FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::isKeyLess(
+                                                 const LOOKUP_KEY& key,
+                                                 const ValueType&  value) const
+{
+    return d_comparator(key, KEY_CONFIG::extractKey(value));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+bool FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::isValueLess(
+                                                 const ValueType&  value,
+                                                 const LOOKUP_KEY& key) const
+{
+    return d_comparator(KEY_CONFIG::extractKey(value), key);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bool FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::isOrdered(
+                                                 const_iterator first,
+                                                 const_iterator last,
+                                                 bool           isUnique) const
+{
+    const ValueLess less(this);
+
+    if (first == last) {
+        return true;                                                  // RETURN
+    }
+
+    for (const_iterator next = first + 1; next != last; ++first, ++next) {
+        if (isUnique ? !less(*first, *next) : less(*next, *first)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::size_type
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBoundIndex(
+                                             const LOOKUP_KEY& key,
+                                             size_type         first,
+                                             size_type         last) const
+{
+    size_type count = last - first;
+
+    while (count > 0) {
+        const size_type half = count / 2;
+
+        if (isValueLess(d_values[first + half], key)) {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else {
+            count = half;
+        }
+    }
+    return first;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::size_type
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBoundIndex(
+                                             const LOOKUP_KEY& key,
+                                             size_type         first,
+                                             size_type         last) const
+{
+    size_type count = last - first;
+
+    while (count > 0) {
+        const size_type half = count / 2;
+
+        if (!isKeyLess(key, d_values[first + half])) {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else {
+            count = half;
+        }
+    }
+    return first;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::size_type
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::uniqueHintIndex(
+                                                const_iterator hint,
+                                                const KeyType& key) const
+{
+    const size_type position = hint - d_values.begin();
+    const size_type size     = d_values.size();
+
+    if ((position == size || isKeyLess(key, d_values[position]))
+     && (0 == position || isValueLess(d_values[position - 1], key))) {
+        return position;                                              // RETURN
+    }
+
+    return lowerBoundIndex(key, 0, size);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::size_type
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::multiHintIndex(
+                                                const_iterator hint,
+                                                const KeyType& key) const
+{
+    const size_type position = hint - d_values.begin();
+    const size_type size     = d_values.size();
+
+    if (position != size && isValueLess(d_values[position], key)) {
+        // 'key' belongs after 'hint': use the first valid position after it.
+
+        return lowerBoundIndex(key, position + 1, size);              // RETURN
+    }
+
+    if (0 != position && isKeyLess(key, d_values[position - 1])) {
+        // 'key' belongs before 'hint': use the last valid position before it.
+
+        return upperBoundIndex(key, 0, position - 1);                 // RETURN
+    }
+
+    return position;
+}
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                           const COMPARATOR& comparator,
+                                           const ALLOCATOR&  basicAllocator)
+: d_values(basicAllocator)
+, d_comparator(comparator)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                             const FlatTree&  original,
+                                             const ALLOCATOR& basicAllocator)
+: d_values(original.d_values, basicAllocator)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                          bslmf::MovableRef<FlatTree> original)
+: d_values(MoveUtil::move(MoveUtil::access(original).d_values))
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                 bslmf::MovableRef<FlatTree> original,
+                                 const ALLOCATOR&            basicAllocator)
+: d_values(MoveUtil::move(MoveUtil::access(original).d_values),
+           basicAllocator)
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+// MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>&
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::operator=(const FlatTree& rhs)
+{
+    d_values     = rhs.d_values;
+    d_comparator = rhs.d_comparator;
+    return *this;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>&
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::operator=(
+                                               bslmf::MovableRef<FlatTree> rhs)
+{
+    FlatTree& lvalue = rhs;
+
+    d_values     = MoveUtil::move(lvalue.d_values);
+    d_comparator = lvalue.d_comparator;
+    return *this;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::begin()
+{
+    return d_values.begin();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::end()
+{
+    return d_values.end();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_values.clear();
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+bsl::pair<typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator, bool>
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::emplaceUnique(
+                                                         ARGS&&... arguments)
+{
+    bsls::ObjectBuffer<ValueType> buffer;
+    ALLOCATOR                     alloc = d_values.get_allocator();
+
+    AllocatorTraits::construct(
+                            alloc,
+                            buffer.address(),
+                            BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+    bslma::DestructorGuard<ValueType> guard(buffer.address());
+
+    return insertUnique(MoveUtil::move(buffer.object()));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::emplaceUniqueHint(
+                                                const_iterator hint,
+                                                ARGS&&...      arguments)
+{
+    bsls::ObjectBuffer<ValueType> buffer;
+    ALLOCATOR                     alloc = d_values.get_allocator();
+
+    AllocatorTraits::construct(
+                            alloc,
+                            buffer.address(),
+                            BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+    bslma::DestructorGuard<ValueType> guard(buffer.address());
+
+    return insertUnique(hint, MoveUtil::move(buffer.object()));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::emplaceMulti(ARGS&&... arguments)
+{
+    bsls::ObjectBuffer<ValueType> buffer;
+    ALLOCATOR                     alloc = d_values.get_allocator();
+
+    AllocatorTraits::construct(
+                            alloc,
+                            buffer.address(),
+                            BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+    bslma::DestructorGuard<ValueType> guard(buffer.address());
+
+    return insertMulti(MoveUtil::move(buffer.object()));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class... ARGS>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::emplaceMultiHint(
+                                                const_iterator hint,
+                                                ARGS&&...      arguments)
+{
+    bsls::ObjectBuffer<ValueType> buffer;
+    ALLOCATOR                     alloc = d_values.get_allocator();
+
+    AllocatorTraits::construct(
+                            alloc,
+                            buffer.address(),
+                            BSLS_COMPILERFEATURES_FORWARD(ARGS, arguments)...);
+    bslma::DestructorGuard<ValueType> guard(buffer.address());
+
+    return insertMulti(hint, MoveUtil::move(buffer.object()));
+}
+#endif
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+bsl::pair<typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator,
+          typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator>
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::equalRange(const LOOKUP_KEY& key)
+{
+    const size_type first = lowerBoundIndex(key, 0, d_values.size());
+    const size_type last  = upperBoundIndex(key, first, d_values.size());
+
+    return bsl::pair<iterator, iterator>(d_values.begin() + first,
+                                         d_values.begin() + last);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(d_values.begin() <= position);
+    BSLS_ASSERT_SAFE(position < d_values.end());
+
+    return d_values.erase(position);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                   const_iterator last)
+{
+    BSLS_ASSERT_SAFE(d_values.begin() <= first);
+    BSLS_ASSERT_SAFE(first <= last);
+    BSLS_ASSERT_SAFE(last <= d_values.end());
+
+    return d_values.erase(first, last);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::size_type
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::eraseKey(const KeyType& key)
+{
+    const bsl::pair<iterator, iterator> range = equalRange(key);
+    const size_type                     count = range.second - range.first;
+
+    d_values.erase(range.first, range.second);
+    return count;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::find(const LOOKUP_KEY& key)
+{
+    const iterator it = lowerBound(key);
+
+    return it == d_values.end() || isKeyLess(key, *it) ? d_values.end() : it;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator, bool>
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertUnique(
+                                                       const ValueType& value)
+{
+    const KeyType&  key      = KEY_CONFIG::extractKey(value);
+    const size_type position = lowerBoundIndex(key, 0, d_values.size());
+
+    if (position != d_values.size() && !isKeyLess(key, d_values[position])) {
+        return bsl::pair<iterator, bool>(d_values.begin() + position,
+                                         false);                      // RETURN
+    }
+
+    return bsl::pair<iterator, bool>(
+                        d_values.insert(d_values.begin() + position, value),
+                        true);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator, bool>
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertUnique(
+                                           bslmf::MovableRef<ValueType> value)
+{
+    ValueType&      lvalue   = value;
+    const KeyType&  key      = KEY_CONFIG::extractKey(lvalue);
+    const size_type position = lowerBoundIndex(key, 0, d_values.size());
+
+    if (position != d_values.size() && !isKeyLess(key, d_values[position])) {
+        return bsl::pair<iterator, bool>(d_values.begin() + position,
+                                         false);                      // RETURN
+    }
+
+    return bsl::pair<iterator, bool>(
+                         d_values.insert(d_values.begin() + position,
+                                         MoveUtil::move(lvalue)),
+                         true);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertUnique(
+                                                 const_iterator   hint,
+                                                 const ValueType& value)
+{
+    const KeyType&  key      = KEY_CONFIG::extractKey(value);
+    const size_type position = uniqueHintIndex(hint, key);
+
+    if (position != d_values.size() && !isKeyLess(key, d_values[position])) {
+        return d_values.begin() + position;                           // RETURN
+    }
+
+    return d_values.insert(d_values.begin() + position, value);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertUnique(
+                                     const_iterator               hint,
+                                     bslmf::MovableRef<ValueType> value)
+{
+    ValueType&      lvalue   = value;
+    const KeyType&  key      = KEY_CONFIG::extractKey(lvalue);
+    const size_type position = uniqueHintIndex(hint, key);
+
+    if (position != d_values.size() && !isKeyLess(key, d_values[position])) {
+        return d_values.begin() + position;                           // RETURN
+    }
+
+    return d_values.insert(d_values.begin() + position,
+                           MoveUtil::move(lvalue));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertMulti(
+                                                       const ValueType& value)
+{
+    return d_values.insert(d_values.begin()
+                               + upperBoundIndex(KEY_CONFIG::extractKey(value),
+                                                 0,
+                                                 d_values.size()),
+                           value);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertMulti(
+                                           bslmf::MovableRef<ValueType> value)
+{
+    ValueType& lvalue = value;
+
+    return d_values.insert(
+                         d_values.begin()
+                             + upperBoundIndex(KEY_CONFIG::extractKey(lvalue),
+                                               0,
+                                               d_values.size()),
+                         MoveUtil::move(lvalue));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertMulti(
+                                                 const_iterator   hint,
+                                                 const ValueType& value)
+{
+    return d_values.insert(
+               d_values.begin()
+                   + multiHintIndex(hint, KEY_CONFIG::extractKey(value)),
+               value);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertMulti(
+                                     const_iterator               hint,
+                                     bslmf::MovableRef<ValueType> value)
+{
+    ValueType& lvalue = value;
+
+    return d_values.insert(
+               d_values.begin()
+                   + multiHintIndex(hint, KEY_CONFIG::extractKey(lvalue)),
+               MoveUtil::move(lvalue));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertRangeUnique(
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    insertRange(first, last, false, true);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertRangeMulti(
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    insertRange(first, last, false, false);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertSortedUnique(
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    insertRange(first, last, true, true);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertSortedMulti(
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    insertRange(first, last, true, false);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBound(const LOOKUP_KEY& key)
+{
+    return d_values.begin() + lowerBoundIndex(key, 0, d_values.size());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::reserve(size_type numValues)
+{
+    d_values.reserve(numValues);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::shrinkToFit()
+{
+    d_values.shrink_to_fit();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::swap(FlatTree& other)
+{
+    if (AllocatorTraits::propagate_on_container_swap::value
+     || BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+               d_values.get_allocator() == other.d_values.get_allocator())) {
+        d_values.swap(other.d_values);
+        bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        FlatTree toOtherCopy(MoveUtil::move(*this),
+                             other.d_values.get_allocator());
+        FlatTree toThisCopy(MoveUtil::move(other), d_values.get_allocator());
+
+        d_values.swap(toThisCopy.d_values);
+        bslalg::SwapUtil::swap(&d_comparator, &toThisCopy.d_comparator);
+
+        other.d_values.swap(toOtherCopy.d_values);
+        bslalg::SwapUtil::swap(&other.d_comparator,
+                               &toOtherCopy.d_comparator);
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBound(const LOOKUP_KEY& key)
+{
+    return d_values.begin() + upperBoundIndex(key, 0, d_values.size());
+}
+
+// ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+ALLOCATOR FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::allocator() const
+{
+    return d_values.get_allocator();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::const_iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_values.begin();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::size_type
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_values.capacity();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+const COMPARATOR&
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::comparator() const
+{
+    return d_comparator;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::size_type
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::count(const LOOKUP_KEY& key) const
+{
+    const bsl::pair<const_iterator, const_iterator> range = equalRange(key);
+
+    return range.second - range.first;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+bool FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return d_values.empty();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::const_iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_values.end();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+bsl::pair<
+       typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::const_iterator,
+       typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::const_iterator>
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::equalRange(
+                                                  const LOOKUP_KEY& key) const
+{
+    const size_type first = lowerBoundIndex(key, 0, d_values.size());
+    const size_type last  = upperBoundIndex(key, first, d_values.size());
+
+    return bsl::pair<const_iterator, const_iterator>(d_values.begin() + first,
+                                                     d_values.begin() + last);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::const_iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::find(const LOOKUP_KEY& key) const
+{
+    const const_iterator it = lowerBound(key);
+
+    return it == d_values.end() || isKeyLess(key, *it) ? d_values.end() : it;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::const_iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBound(
+                                                  const LOOKUP_KEY& key) const
+{
+    return d_values.begin() + lowerBoundIndex(key, 0, d_values.size());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::size_type
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::maxSize() const
+{
+    return d_values.max_size();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::size_type
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_values.size();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::const_iterator
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBound(
+                                                  const LOOKUP_KEY& key) const
+{
+    return d_values.begin() + upperBoundIndex(key, 0, d_values.size());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+const typename FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Storage&
+FlatTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::values() const
+{
+    return d_values;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,970 @@
+// bslstl_flattree.t.cpp                                              -*-C++-*-
+#include <bslstl_flattree.h>
+
+#include <bslstl_pair.h>
+#include <bslstl_string.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_stdallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+
+#include <algorithm>    // 'std::sort', 'std::unique'
+#include <functional>   // 'std::less'
+
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi'
+#include <string.h>     // 'strlen'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides the sorted-vector implementation shared
+// by the flat associative containers.  A 'FlatTree' is not itself a
+// value-semantic type; its observable state is the sequence of values held by
+// its vector, which must at all times be sorted by key (and, for a tree used
+// with the "unique" methods, free of equivalent keys).
+//
+// We use 'int' values with the identity key configuration for most tests, as
+// the ordering is then easy to specify with a string of characters.  We use
+// 'bsl::pair<int, int>' values with the map key configuration to observe the
+// relative order of values having equivalent keys, and 'bsl::string' values
+// (long enough to allocate) to test exception safety, which is the principal
+// concern of the bulk insertion methods, as they first append the inserted
+// values to the vector and then sort and merge them in place.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 6] FlatTree(const COMPARATOR&, const ALLOCATOR&);
+// [ 6] FlatTree(const FlatTree&, const ALLOCATOR&);
+// [ 6] FlatTree(MovableRef<FlatTree>);
+// [ 6] FlatTree(MovableRef<FlatTree>, const ALLOCATOR&);
+//
+// MANIPULATORS
+// [ 6] FlatTree& operator=(const FlatTree&);
+// [ 6] FlatTree& operator=(MovableRef<FlatTree>);
+// [ 2] pair<iterator, bool> emplaceUnique(ARGS&&...);
+// [ 2] iterator emplaceMulti(ARGS&&...);
+// [ 4] iterator erase(const_iterator);
+// [ 4] iterator erase(const_iterator, const_iterator);
+// [ 4] size_type eraseKey(const KeyType&);
+// [ 2] pair<iterator, bool> insertUnique(const ValueType&);
+// [ 2] iterator insertUnique(const_iterator, const ValueType&);
+// [ 2] iterator insertMulti(const ValueType&);
+// [ 2] iterator insertMulti(const_iterator, const ValueType&);
+// [ 3] void insertRangeUnique(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insertRangeMulti(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insertSortedUnique(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insertSortedMulti(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 1] void reserve(size_type);
+// [ 1] void shrinkToFit();
+// [ 6] void swap(FlatTree&);
+//
+// ACCESSORS
+// [ 2] size_type count(const KeyType&) const;
+// [ 2] pair<const_iterator, const_iterator> equalRange(const KeyType&) const;
+// [ 2] const_iterator find(const KeyType&) const;
+// [ 2] const_iterator lowerBound(const KeyType&) const;
+// [ 2] const_iterator upperBound(const KeyType&) const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] EXCEPTION SAFETY OF BULK INSERTION
+//=============================================================================
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::UnorderedSetKeyConfiguration<int>           IntConfig;
+typedef bslstl::FlatTree<IntConfig,
+                         std::less<int>,
+                         bsl::allocator<int> >              Obj;
+
+typedef bsl::pair<int, int>                                 Pair;
+typedef bslstl::UnorderedMapKeyConfiguration<int, Pair>     PairConfig;
+typedef bslstl::FlatTree<PairConfig,
+                         std::less<int>,
+                         bsl::allocator<Pair> >             PairObj;
+
+typedef bslstl::UnorderedSetKeyConfiguration<bsl::string>   StringConfig;
+typedef bslstl::FlatTree<StringConfig,
+                         std::less<bsl::string>,
+                         bsl::allocator<bsl::string> >      StringObj;
+
+typedef bslmf::MovableRefUtil                               MoveUtil;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+bsl::vector<int> toValues(const char *spec)
+    // Return the sequence of values described by the specified 'spec', in
+    // which each character 'c' denotes the value 'c - 'A''.
+{
+    bsl::vector<int> result;
+    for (; *spec; ++spec) {
+        result.push_back(*spec - 'A');
+    }
+    return result;
+}
+
+Obj& gg(Obj *object, const char *spec)
+    // Insert into the specified 'object', one at a time and using the "multi"
+    // form, the values described by the specified 'spec', and return a
+    // reference providing modifiable access to 'object'.
+{
+    for (; *spec; ++spec) {
+        object->insertMulti(*spec - 'A');
+    }
+    return *object;
+}
+
+bool isSpec(const Obj& object, const char *spec)
+    // Return 'true' if the specified 'object' holds exactly the sequence of
+    // values described by the specified 'spec', and 'false' otherwise.
+{
+    if (object.size() != strlen(spec)) {
+        return false;                                                 // RETURN
+    }
+    for (Obj::const_iterator it = object.begin(); it != object.end(); ++it) {
+        if (*it != *spec++ - 'A') {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class TREE>
+bool isOrdered(const TREE& object, bool isUnique)
+    // Return 'true' if the values held by the specified 'object' are sorted by
+    // key and, if the specified 'isUnique' is 'true', have no equivalent keys,
+    // and 'false' otherwise.
+{
+    typedef typename TREE::const_iterator Iterator;
+
+    if (object.empty()) {
+        return true;                                                  // RETURN
+    }
+
+    const typename TREE::Storage& values = object.values();
+    for (Iterator it = values.begin() + 1; it != values.end(); ++it) {
+        const bool less = object.comparator()(*(it - 1), *it);
+        const bool more = object.comparator()(*it, *(it - 1));
+        if (more || (isUnique && !less)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bool isOrdered(const PairObj& object)
+    // Return 'true' if the values held by the specified 'object' are sorted by
+    // their 'first' member, and 'false' otherwise.
+{
+    const PairObj::Storage& values = object.values();
+    for (size_t i = 1; i < values.size(); ++i) {
+        if (values[i].first < values[i - 1].first) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator         defaultAllocator("default",
+                                                  veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, AND SWAP
+        //
+        // Concerns:
+        //: 1 Copy construction and copy assignment reproduce the values and
+        //:   comparator of the source, using the supplied (or the target's)
+        //:   allocator.
+        //:
+        //: 2 Moving between objects having equal allocators allocates no
+        //:   memory; moving between objects having unequal allocators copies
+        //:   the values using the allocator of the target.
+        //:
+        //: 3 'swap' of objects having equal allocators allocates no memory,
+        //:   and 'swap' of objects having unequal allocators exchanges their
+        //:   values without exchanging their allocators.
+        //:
+        //: 4 No memory is obtained from the default allocator.
+        //
+        // Plan:
+        //: 1 Using objects created with test allocators, perform each
+        //:   operation and verify the resulting values, allocators, and
+        //:   allocations.  (C-1..4)
+        //
+        // Testing:
+        //   FlatTree(const COMPARATOR&, const ALLOCATOR&);
+        //   FlatTree(const FlatTree&, const ALLOCATOR&);
+        //   FlatTree(MovableRef<FlatTree>);
+        //   FlatTree(MovableRef<FlatTree>, const ALLOCATOR&);
+        //   FlatTree& operator=(const FlatTree&);
+        //   FlatTree& operator=(MovableRef<FlatTree>);
+        //   void swap(FlatTree&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, MOVE, AND SWAP"
+                            "\n====================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        if (verbose) printf("\tCopy construction and assignment.\n");
+        {
+            Obj mX(std::less<int>(), &oa);  const Obj& X = gg(&mX, "ACEG");
+
+            Obj mY(X, &za);  const Obj& Y = mY;
+            ASSERT(isSpec(Y, "ACEG"));
+            ASSERT(&za == Y.allocator());
+            ASSERT(isSpec(X, "ACEG"));
+
+            Obj mZ(std::less<int>(), &za);  const Obj& Z = gg(&mZ, "BD");
+            mZ = X;
+            ASSERT(isSpec(Z, "ACEG"));
+            ASSERT(&za == Z.allocator());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tMove with equal allocators.\n");
+        {
+            Obj mX(std::less<int>(), &oa);  const Obj& X = gg(&mX, "ACEG");
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            Obj mY(MoveUtil::move(mX));  const Obj& Y = mY;
+            ASSERT(isSpec(Y, "ACEG"));
+            ASSERT(&oa == Y.allocator());
+
+            Obj mZ(MoveUtil::move(mY), &oa);  const Obj& Z = mZ;
+            ASSERT(isSpec(Z, "ACEG"));
+
+            mX = MoveUtil::move(mZ);
+            ASSERT(isSpec(X, "ACEG"));
+
+            ASSERT(oam.isTotalSame());
+        }
+
+        if (verbose) printf("\tMove with unequal allocators.\n");
+        {
+            Obj mX(std::less<int>(), &oa);  gg(&mX, "ACEG");
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            Obj mY(MoveUtil::move(mX), &za);  const Obj& Y = mY;
+            ASSERT(isSpec(Y, "ACEG"));
+            ASSERT(&za == Y.allocator());
+            ASSERT(oam.isTotalSame());
+
+            Obj mZ(std::less<int>(), &oa);  const Obj& Z = mZ;
+            mZ = MoveUtil::move(mY);
+            ASSERT(isSpec(Z, "ACEG"));
+            ASSERT(&oa == Z.allocator());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tSwap.\n");
+        {
+            Obj mX(std::less<int>(), &oa);  const Obj& X = gg(&mX, "ACEG");
+            Obj mY(std::less<int>(), &oa);  const Obj& Y = gg(&mY, "BD");
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.swap(mY);
+            ASSERT(isSpec(X, "BD"));
+            ASSERT(isSpec(Y, "ACEG"));
+            ASSERT(oam.isTotalSame());
+
+            Obj mZ(std::less<int>(), &za);  const Obj& Z = gg(&mZ, "F");
+
+            mX.swap(mZ);
+            ASSERT(isSpec(X, "F"));
+            ASSERT(isSpec(Z, "BD"));
+            ASSERT(&oa == X.allocator());
+            ASSERT(&za == Z.allocator());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY OF BULK INSERTION
+        //
+        // Concerns:
+        //: 1 If an exception is thrown during a bulk insertion, the tree is
+        //:   left sorted (and, for a "unique" insertion, free of equivalent
+        //:   keys), and holds no value it did not hold before the call,
+        //:   other than values of the inserted range.
+        //:
+        //: 2 No memory is leaked, whether or not an exception is thrown.
+        //:
+        //: 3 Once no exception is thrown, the result is the same as that of
+        //:   the insertion performed without exceptions.
+        //
+        // Plan:
+        //: 1 Using a table of initial and inserted sequences, exercising both
+        //:   the in-place (appended values follow the existing ones) and the
+        //:   merging strategies, perform each bulk insertion in the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' loop on a tree of strings
+        //:   long enough to allocate, and verify the invariants after each
+        //:   exception and the final value afterwards.  (C-1..3)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY OF BULK INSERTION
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXCEPTION SAFETY OF BULK INSERTION"
+                            "\n==================================\n");
+
+        static const struct {
+            int         d_line;
+            const char *d_initial_p;   // initial contents (sorted, unique)
+            const char *d_range_p;     // inserted values
+            bool        d_isSorted;    // range is sorted and unique
+            const char *d_unique_p;    // expected result, "unique" insertion
+            const char *d_multi_p;     // expected result, "multi" insertion
+        } DATA[] = {
+            //LINE  INITIAL  RANGE     SORTED  UNIQUE       MULTI
+            //----  -------  -----     ------  ------       -----
+            { L_,   "",      "DBCAB",  false,  "ABCD",      "ABBCD"        },
+            { L_,   "AB",    "DCED",   false,  "ABCDE",     "ABCDDE"       },
+            { L_,   "ACE",   "EDCBA",  false,  "ABCDE",     "AABCCDEE"     },
+            { L_,   "BDF",   "ACEG",   true,   "ABCDEFG",   "ABCDEFG"      },
+            { L_,   "ABC",   "DEF",    true,   "ABCDEF",    "ABCDEF"       },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            const char *const INITIAL = DATA[ti].d_initial_p;
+            const char *const RANGE   = DATA[ti].d_range_p;
+            const bool        SORTED  = DATA[ti].d_isSorted;
+
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            // Make the strings long enough to allocate.
+
+            const bsl::string PREFIX(40, 'x', &sa);
+
+            bsl::vector<bsl::string> initial(&sa);
+            for (const char *p = INITIAL; *p; ++p) {
+                initial.push_back(PREFIX + *p);
+            }
+            bsl::vector<bsl::string> range(&sa);
+            for (const char *p = RANGE; *p; ++p) {
+                range.push_back(PREFIX + *p);
+            }
+
+            for (int isUnique = 0; isUnique < 2; ++isUnique) {
+                const char *const EXP = isUnique ? DATA[ti].d_unique_p
+                                                 : DATA[ti].d_multi_p;
+
+                if (veryVerbose) {
+                    T_ P_(LINE) P_(INITIAL) P_(RANGE) P_(isUnique) P(EXP)
+                }
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+                {
+                    StringObj mX(std::less<bsl::string>(), &oa);
+                    const StringObj& X = mX;
+
+                    mX.insertSortedUnique(initial.begin(), initial.end());
+
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                        ASSERTV(LINE, isOrdered(X, isUnique));
+                        ASSERTV(LINE, X.size() <= strlen(EXP));
+
+                        // Restore the initial value, which a prior attempt
+                        // may have altered.
+
+                        mX.clear();
+                        mX.insertSortedUnique(initial.begin(), initial.end());
+
+                        if (isUnique && SORTED) {
+                            mX.insertSortedUnique(range.begin(), range.end());
+                        }
+                        else if (isUnique) {
+                            mX.insertRangeUnique(range.begin(), range.end());
+                        }
+                        else if (SORTED) {
+                            mX.insertSortedMulti(range.begin(), range.end());
+                        }
+                        else {
+                            mX.insertRangeMulti(range.begin(), range.end());
+                        }
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                    ASSERTV(LINE, X.size(), strlen(EXP) == X.size());
+                    ASSERTV(LINE, isOrdered(X, isUnique));
+
+                    const char *expected = EXP;
+                    for (StringObj::const_iterator it = X.begin();
+                         it != X.end();
+                         ++it, ++expected) {
+                        ASSERTV(LINE, it->c_str(), PREFIX + *expected == *it);
+                    }
+                }
+                ASSERTV(LINE, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ERASE
+        //
+        // Concerns:
+        //: 1 'erase' removes the value (or the range of values) at the
+        //:   supplied position, preserving the order of the others, and
+        //:   returns an iterator to the value following those removed.
+        //:
+        //: 2 'eraseKey' removes every value having the supplied key and
+        //:   returns their number, which may be 0.
+        //
+        // Plan:
+        //: 1 Using a table of initial values and keys to erase, verify the
+        //:   result of each method.  (C-1..2)
+        //
+        // Testing:
+        //   iterator erase(const_iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        //   size_type eraseKey(const KeyType&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nERASE"
+                            "\n=====\n");
+
+        static const struct {
+            int         d_line;
+            const char *d_initial_p;  // initial contents
+            char        d_key;        // key to erase
+            int         d_count;      // number of values having 'd_key'
+            const char *d_result_p;   // contents after erasing 'd_key'
+        } DATA[] = {
+            //LINE  INITIAL    KEY  COUNT  RESULT
+            //----  -------    ---  -----  ------
+            { L_,   "",        'A',     0, ""       },
+            { L_,   "A",       'A',     1, ""       },
+            { L_,   "A",       'B',     0, "A"      },
+            { L_,   "ABC",     'A',     1, "BC"     },
+            { L_,   "ABC",     'B',     1, "AC"     },
+            { L_,   "ABC",     'C',     1, "AB"     },
+            { L_,   "ABBBC",   'B',     3, "AC"     },
+            { L_,   "AACC",    'B',     0, "AACC"   },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            const char *const INITIAL = DATA[ti].d_initial_p;
+            const int         KEY     = DATA[ti].d_key - 'A';
+            const int         COUNT   = DATA[ti].d_count;
+            const char *const RESULT  = DATA[ti].d_result_p;
+
+            {
+                Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+                gg(&mX, INITIAL);
+
+                ASSERTV(LINE, COUNT == static_cast<int>(mX.eraseKey(KEY)));
+                ASSERTV(LINE, isSpec(X, RESULT));
+            }
+            {
+                Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+                gg(&mX, INITIAL);
+
+                bsl::pair<Obj::iterator, Obj::iterator> range =
+                                                          mX.equalRange(KEY);
+                const size_t offset = range.first - X.begin();
+
+                Obj::iterator it = mX.erase(range.first, range.second);
+                ASSERTV(LINE, isSpec(X, RESULT));
+                ASSERTV(LINE, X.begin() + offset == it);
+
+                if (COUNT) {
+                    gg(&mX, INITIAL);
+                    mX.eraseKey(KEY);
+                    gg(&mX, INITIAL);
+
+                    const Obj::iterator found = mX.find(KEY);
+                    it = mX.erase(found);
+                    ASSERTV(LINE, found == it);
+                    ASSERTV(LINE, COUNT - 1 == static_cast<int>(X.count(KEY)));
+                }
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // BULK INSERTION
+        //
+        // Concerns:
+        //: 1 The "unique" bulk insertions insert each value whose key is
+        //:   equivalent neither to that of a value already present nor to
+        //:   that of a value retained earlier from the range.
+        //:
+        //: 2 The "multi" bulk insertions insert every value of the range.
+        //:
+        //: 3 The result is sorted whether the inserted values precede,
+        //:   follow, or interleave those already present, and whether or not
+        //:   the range is sorted.
+        //:
+        //: 4 The values already present precede the inserted values having
+        //:   equivalent keys.
+        //:
+        //: 5 Inserting an empty range has no effect.
+        //:
+        //: 6 In appropriate build modes, inserting a range that is not sorted
+        //:   (or has equivalent keys) through a "sorted" method is detected.
+        //
+        // Plan:
+        //: 1 Using a table of initial values and inserted ranges, perform
+        //:   each bulk insertion on a tree of 'int' values and verify the
+        //:   result.  (C-1..3, 5)
+        //:
+        //: 2 Using a tree of pairs keyed on their 'first' member, verify the
+        //:   relative order of values having equivalent keys.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for unsorted input to the "sorted" methods.  (C-6)
+        //
+        // Testing:
+        //   void insertRangeUnique(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insertRangeMulti(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insertSortedUnique(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insertSortedMulti(INPUT_ITERATOR, INPUT_ITERATOR);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBULK INSERTION"
+                            "\n==============\n");
+
+        static const struct {
+            int         d_line;
+            const char *d_initial_p;   // initial contents (sorted, unique)
+            const char *d_range_p;     // inserted values
+            const char *d_unique_p;    // expected result, "unique" insertion
+            const char *d_multi_p;     // expected result, "multi" insertion
+        } DATA[] = {
+            //LINE  INITIAL  RANGE       UNIQUE        MULTI
+            //----  -------  -----       ------        -----
+            { L_,   "",      "",         "",           ""                 },
+            { L_,   "AB",    "",         "AB",         "AB"               },
+            { L_,   "",      "A",        "A",          "A"                },
+            { L_,   "",      "BA",       "AB",         "AB"               },
+            { L_,   "",      "AA",       "A",          "AA"               },
+            { L_,   "",      "CABCA",    "ABC",        "AABCC"            },
+            { L_,   "ABC",   "DEF",      "ABCDEF",     "ABCDEF"           },
+            { L_,   "ABC",   "FED",      "ABCDEF",     "ABCDEF"           },
+            { L_,   "ABC",   "CDD",      "ABCD",       "ABCCDD"           },
+            { L_,   "DEF",   "ABC",      "ABCDEF",     "ABCDEF"           },
+            { L_,   "BDF",   "GECA",     "ABCDEFG",    "ABCDEFG"          },
+            { L_,   "BDF",   "FDB",      "BDF",        "BBDDFF"           },
+            { L_,   "BDF",   "ABCDEFG",  "ABCDEFG",    "ABBCDDEFFG"       },
+            { L_,   "ACE",   "EEBBA",    "ABCE",       "AABBCEEE"         },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            const char *const INITIAL = DATA[ti].d_initial_p;
+            const char *const RANGE   = DATA[ti].d_range_p;
+            const char *const UNIQUE  = DATA[ti].d_unique_p;
+            const char *const MULTI   = DATA[ti].d_multi_p;
+
+            if (veryVerbose) { T_ P_(LINE) P_(INITIAL) P(RANGE) }
+
+            const bsl::vector<int> initial = toValues(INITIAL);
+            const bsl::vector<int> range   = toValues(RANGE);
+
+            {
+                Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+                mX.insertSortedUnique(initial.begin(), initial.end());
+                mX.insertRangeUnique(range.begin(), range.end());
+                ASSERTV(LINE, isSpec(X, UNIQUE));
+            }
+            {
+                Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+                mX.insertSortedUnique(initial.begin(), initial.end());
+                mX.insertRangeMulti(range.begin(), range.end());
+                ASSERTV(LINE, isSpec(X, MULTI));
+            }
+
+            // Sort the range to exercise the "sorted" methods.
+
+            bsl::vector<int> sorted(range, &oa);
+            std::sort(sorted.begin(), sorted.end());
+            {
+                Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+                mX.insertSortedUnique(initial.begin(), initial.end());
+                mX.insertSortedMulti(sorted.begin(), sorted.end());
+                ASSERTV(LINE, isSpec(X, MULTI));
+            }
+
+            sorted.erase(std::unique(sorted.begin(), sorted.end()),
+                         sorted.end());
+            {
+                Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+                mX.insertSortedUnique(initial.begin(), initial.end());
+                mX.insertSortedUnique(sorted.begin(), sorted.end());
+                ASSERTV(LINE, isSpec(X, UNIQUE));
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tRelative order of equivalent keys.\n");
+        {
+            PairObj mX(std::less<int>(), &oa);  const PairObj& X = mX;
+
+            mX.insertMulti(Pair(1, 0));
+            mX.insertMulti(Pair(3, 0));
+
+            const Pair SORTED[] = { Pair(1, 1), Pair(1, 2), Pair(3, 1) };
+            mX.insertSortedMulti(SORTED, SORTED + 3);
+
+            const Pair UNSORTED[] = { Pair(2, 1), Pair(1, 3), Pair(0, 1) };
+            mX.insertRangeMulti(UNSORTED, UNSORTED + 3);
+
+            ASSERT(isOrdered(X));
+            ASSERTV(X.size(), 8 == X.size());
+
+            const Pair EXP[] = { Pair(0, 1), Pair(1, 0), Pair(1, 1),
+                                 Pair(1, 2), Pair(1, 3), Pair(2, 1),
+                                 Pair(3, 0), Pair(3, 1) };
+            for (size_t i = 0; i < X.size(); ++i) {
+                ASSERTV(i, EXP[i] == X.values()[i]);
+            }
+
+            // A "unique" insertion retains the values already present.
+
+            const Pair NEW[] = { Pair(3, 9), Pair(4, 9) };
+            mX.insertRangeUnique(NEW, NEW + 2);
+            ASSERT(Pair(3, 0) == X.values()[6]);
+            ASSERT(Pair(4, 9) == X.values()[8]);
+        }
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const int UNSORTED[]  = { 2, 1 };
+            const int DUPLICATE[] = { 1, 1 };
+            const int SORTED[]    = { 1, 2 };
+
+            Obj mX(std::less<int>(), &oa);
+
+            ASSERT_SAFE_FAIL(mX.insertSortedUnique(UNSORTED, UNSORTED + 2));
+            ASSERT_SAFE_FAIL(mX.insertSortedUnique(DUPLICATE, DUPLICATE + 2));
+            ASSERT_SAFE_FAIL(mX.insertSortedMulti(UNSORTED, UNSORTED + 2));
+            ASSERT_SAFE_PASS(mX.insertSortedMulti(DUPLICATE, DUPLICATE + 2));
+            ASSERT_SAFE_PASS(mX.insertSortedUnique(SORTED, SORTED + 2));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SINGLE-VALUE INSERTION AND LOOKUP
+        //
+        // Concerns:
+        //: 1 'insertUnique' inserts a value only if no value having an
+        //:   equivalent key is present, and returns the position of the value
+        //:   having that key.
+        //:
+        //: 2 'insertMulti' inserts a value after those having equivalent keys
+        //:   and returns its position.
+        //:
+        //: 3 The hinted forms produce the same result as the unhinted forms,
+        //:   whether or not the hint is correct, except that a "multi"
+        //:   insertion places the value as close to a correct hint as
+        //:   possible.
+        //:
+        //: 4 The lookup methods report the positions of the values having a
+        //:   key, whether or not such values are present.
+        //:
+        //: 5 The 'emplace' methods behave as the corresponding 'insert'
+        //:   methods.
+        //
+        // Plan:
+        //: 1 For each key of a small range, insert into trees of known value
+        //:   with every possible hint, and verify the results.  (C-1..3)
+        //:
+        //: 2 Verify the results of the lookup methods for present and absent
+        //:   keys.  (C-4)
+        //:
+        //: 3 Repeat P-1 using the 'emplace' methods.  (C-5)
+        //
+        // Testing:
+        //   pair<iterator, bool> insertUnique(const ValueType&);
+        //   iterator insertUnique(const_iterator, const ValueType&);
+        //   iterator insertMulti(const ValueType&);
+        //   iterator insertMulti(const_iterator, const ValueType&);
+        //   pair<iterator, bool> emplaceUnique(ARGS&&...);
+        //   iterator emplaceMulti(ARGS&&...);
+        //   size_type count(const KeyType&) const;
+        //   pair<const_iterator, const_iterator> equalRange(const KeyType&);
+        //   const_iterator find(const KeyType&) const;
+        //   const_iterator lowerBound(const KeyType&) const;
+        //   const_iterator upperBound(const KeyType&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSINGLE-VALUE INSERTION AND LOOKUP"
+                            "\n=================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const char SPEC[] = "BDDF";
+        const int  NUM_KEYS = 7;  // keys 'A' .. 'G'
+
+        for (int key = 0; key < NUM_KEYS; ++key) {
+            Obj mW(std::less<int>(), &oa);  const Obj& W = gg(&mW, SPEC);
+
+            const size_t LOWER = W.lowerBound(key) - W.begin();
+            const size_t UPPER = W.upperBound(key) - W.begin();
+            const size_t COUNT = UPPER - LOWER;
+
+            if (veryVerbose) { T_ P_(key) P_(LOWER) P(UPPER) }
+
+            ASSERTV(key, COUNT == W.count(key));
+            ASSERTV(key, W.equalRange(key).first  == W.begin() + LOWER);
+            ASSERTV(key, W.equalRange(key).second == W.begin() + UPPER);
+            ASSERTV(key, (COUNT ? W.begin() + LOWER : W.end()) == W.find(key));
+
+            {
+                Obj mX(std::less<int>(), &oa);  const Obj& X = gg(&mX, SPEC);
+
+                bsl::pair<Obj::iterator, bool> result = mX.insertUnique(key);
+                ASSERTV(key, (0 == COUNT) == result.second);
+                ASSERTV(key, X.begin() + LOWER == result.first);
+                ASSERTV(key, key == *result.first);
+                ASSERTV(key, W.size() + (0 == COUNT) == X.size());
+                ASSERTV(key, isOrdered(X, false));
+
+                Obj::iterator it = mX.insertMulti(key);
+                ASSERTV(key, X.begin() + UPPER + (0 == COUNT) == it);
+                ASSERTV(key, isOrdered(X, false));
+            }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+            {
+                Obj mX(std::less<int>(), &oa);  const Obj& X = gg(&mX, SPEC);
+
+                bsl::pair<Obj::iterator, bool> result = mX.emplaceUnique(key);
+                ASSERTV(key, (0 == COUNT) == result.second);
+                ASSERTV(key, X.begin() + LOWER == result.first);
+
+                Obj::iterator it = mX.emplaceMulti(key);
+                ASSERTV(key, X.begin() + UPPER + (0 == COUNT) == it);
+                ASSERTV(key, isOrdered(X, false));
+            }
+#endif
+
+            for (size_t hint = 0; hint <= W.size(); ++hint) {
+                if (veryVeryVerbose) { T_ T_ P(hint) }
+
+                Obj mX(std::less<int>(), &oa);  const Obj& X = gg(&mX, SPEC);
+
+                Obj::iterator it = mX.insertUnique(X.begin() + hint, key);
+                ASSERTV(key, hint, X.begin() + LOWER == it);
+                ASSERTV(key, hint, W.size() + (0 == COUNT) == X.size());
+
+                Obj mY(std::less<int>(), &oa);  const Obj& Y = gg(&mY, SPEC);
+
+                it = mY.insertMulti(Y.begin() + hint, key);
+                const size_t position = it - Y.begin();
+                ASSERTV(key, hint, isOrdered(Y, false));
+                ASSERTV(key, hint, W.size() + 1 == Y.size());
+                ASSERTV(key, hint, LOWER <= position);
+                ASSERTV(key, hint, position <= UPPER);
+                if (LOWER <= hint && hint <= UPPER) {
+                    ASSERTV(key, hint, position, hint == position);
+                }
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a tree, insert values one at a time and in bulk, look
+        //:   them up, and erase them.
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   void reserve(size_type);
+        //   void shrinkToFit();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+            ASSERT(&oa == X.allocator());
+
+            ASSERT( mX.insertUnique(3).second);
+            ASSERT( mX.insertUnique(1).second);
+            ASSERT(!mX.insertUnique(3).second);
+            ASSERT(isSpec(X, "BD"));
+
+            const int VALUES[] = { 5, 0, 2, 4, 6, 2 };
+            mX.insertRangeUnique(VALUES, VALUES + 6);
+            ASSERTV(X.size(), 7 == X.size());
+            ASSERT(isOrdered(X, true));
+
+            ASSERT(X.find(4) != X.end());
+            ASSERT(X.find(7) == X.end());
+            ASSERT(1 == X.count(6));
+
+            mX.reserve(100);
+            ASSERT(100 <= X.capacity());
+            ASSERT(7   == X.size());
+
+            mX.shrinkToFit();
+            ASSERT(7 == X.size());
+
+            ASSERT(1 == mX.eraseKey(0));
+            ASSERT(0 == mX.eraseKey(0));
+            ASSERT(1 == *X.begin());
+
+            mX.clear();
+            ASSERT(X.empty());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -1501,6 +1501,7 @@ BSLS_IDENT("$Id: $")
 #include <bslscm_version.h>
 
 #include <bslstl_bidirectionalnodepool.h>
+#include <bslstl_simplepool.h>
 
 #include <bslalg_bidirectionallink.h>
 #include <bslalg_bidirectionalnode.h>
@@ -1517,9 +1518,11 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_addlvaluereference.h>
 #include <bslmf_assert.h>
 #include <bslmf_conditional.h>
+#include <bslmf_enableif.h>
 #include <bslmf_isbitwisemoveable.h>
 #include <bslmf_isfunction.h>
 #include <bslmf_ispointer.h>
+#include <bslmf_istransparentpredicate.h>
 #include <bslmf_movableref.h>
 
 #include <bsls_assert.h>
@@ -1892,6 +1895,7 @@ class HashTable {
     typedef typename KEY_CONFIG::ValueType         ValueType;
     typedef bslalg::BidirectionalNode<ValueType>   NodeType;
     typedef typename AllocatorTraits::size_type    SizeType;
+    typedef SimplePool_Arena                       NodeArena;
 
   private:
     // PRIVATE TYPES
@@ -1934,6 +1938,10 @@ class HashTable {
                                          // 'd_maxLoadFactor')
     float               d_maxLoadFactor; // maximum permitted load factor
 
+    // FRIENDS
+    template <class, class, class, class>
+    friend class HashTable;
+
   private:
     // PRIVATE MANIPULATORS
     void copyDataStructure(bslalg::BidirectionalLink *cursor);
@@ -2790,6 +2798,95 @@ class HashTable {
         // only to ensure backward compatibility with existing clients; use the
         // 'emplaceWithHint' method instead.
 
+    NodeArena *acquireNodeArena();
+        // Return the address of the arena of the node pool of this hash
+        // table, creating it if necessary, with a reference added on behalf
+        // of the caller.  Nodes allocated by this hash table remain valid
+        // until that reference is released, even if this hash table is
+        // destroyed first (see 'bslstl_simplepool').
+
+    bslalg::BidirectionalLink *extractNode(bslalg::BidirectionalLink *node);
+        // Unlink the specified 'node' from this hash table, without destroying
+        // or deallocating it, and return the address of the node immediately
+        // after 'node' in this hash table (prior to its removal), or a null
+        // pointer value if 'node' is the last node in the table.  The caller
+        // becomes responsible for 'node', which must be kept valid by a
+        // reference to the arena of this hash table (see 'acquireNodeArena').
+        // This method invalidates only iterators and references to the
+        // extracted node and previously saved values of the 'end()' iterator.
+        // The behavior is undefined unless 'node' refers to a node in this
+        // hash table.
+
+    bslalg::BidirectionalLink *insertNode(
+                                     bslalg::BidirectionalLink *node,
+                                     NodeArena                 *arena,
+                                     bslalg::BidirectionalLink *hint = 0);
+        // Link the specified 'node', allocated by a node pool belonging to the
+        // specified 'arena', into this hash table, and return 'node'.  If the
+        // optionally specified 'hint' is not null and the key of the node
+        // pointed to by 'hint' is equivalent to that of 'node', insert 'node'
+        // immediately before 'hint'; otherwise, if a key equivalent to that of
+        // 'node' already exists in this hash table, insert 'node' immediately
+        // before the first such element.  The node pool of this hash table
+        // joins 'arena', so that this hash table may later delete 'node'.
+        // Additional buckets are allocated, as needed, to preserve the
+        // invariant 'loadFactor <= maxLoadFactor', but no node is allocated.
+        // If an exception is thrown, 'node' is not linked into this hash
+        // table.  The behavior is undefined unless 'node' holds a valid value
+        // and is not linked into any container, the caller holds a reference
+        // to 'arena', and the nodes of 'arena' were allocated using an
+        // allocator equal to that of this hash table.
+
+    bslalg::BidirectionalLink *insertNodeIfMissing(
+                                     bool                      *isInsertedFlag,
+                                     bslalg::BidirectionalLink *node,
+                                     NodeArena                 *arena);
+        // Link the specified 'node', allocated by a node pool belonging to the
+        // specified 'arena', into this hash table if a key equivalent to that
+        // of 'node' does not already exist in this hash table.  Return the
+        // address of 'node' if it was linked, and of the first element whose
+        // key is equivalent to that of 'node' otherwise.  Load 'true' into the
+        // specified 'isInsertedFlag' if 'node' was linked, and 'false'
+        // otherwise.  If 'node' is linked, the node pool of this hash table
+        // joins 'arena'.  Additional buckets are allocated, as needed, to
+        // preserve the invariant 'loadFactor <= maxLoadFactor', but no node
+        // is allocated.  If an exception is thrown, 'node' is not linked into
+        // this hash table.  The behavior is undefined unless 'node' holds a
+        // valid value and is not linked into any container, the caller holds
+        // a reference to 'arena', and the nodes of 'arena' were allocated
+        // using an allocator equal to that of this hash table.
+
+    template <class SOURCE_HASHER, class SOURCE_COMPARATOR>
+    void mergeAll(HashTable<KEY_CONFIG,
+                            SOURCE_HASHER,
+                            SOURCE_COMPARATOR,
+                            ALLOCATOR> *source);
+        // Relink every node of the specified 'source' hash table into this
+        // hash table, leaving 'source' empty, without allocating, moving, or
+        // copying any element.  Nodes having a key equivalent to that of an
+        // element already in this hash table are inserted immediately before
+        // the first such element.  Buckets sufficient for the combined number
+        // of elements are allocated before any node is relinked.  If an
+        // exception is thrown, the nodes already relinked remain in this hash
+        // table, and the others remain in 'source'.  The behavior is
+        // undefined unless 'source' uses an allocator equal to that of this
+        // hash table.
+
+    template <class SOURCE_HASHER, class SOURCE_COMPARATOR>
+    void mergeUnique(HashTable<KEY_CONFIG,
+                               SOURCE_HASHER,
+                               SOURCE_COMPARATOR,
+                               ALLOCATOR> *source);
+        // Relink into this hash table, without allocating, moving, or copying
+        // any element, each node of the specified 'source' hash table whose
+        // key is not equivalent to that of an element of this hash table (or
+        // of a node relinked before it), leaving the other nodes in 'source'.
+        // Additional buckets are allocated, as needed, to preserve the
+        // invariant 'loadFactor <= maxLoadFactor'.  If an exception is thrown,
+        // the nodes already relinked remain in this hash table, and the others
+        // remain in 'source'.  The behavior is undefined unless 'source' uses
+        // an allocator equal to that of this hash table.
+
     void rehashForNumBuckets(SizeType newNumBuckets);
         // Re-organize this hash-table to have at least the specified
         // 'newNumBuckets', preserving the invariant
@@ -2898,6 +2995,35 @@ class HashTable {
         // first such element (from the contiguous sequence of elements having
         // the same key).
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASHER,
+                                                   LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        bslalg::BidirectionalLink *>::type
+    find(const LOOKUP_KEY& key) const
+        // Return the address of a link whose key is equivalent to the
+        // specified 'key' (according to this hash-table's 'comparator'), and a
+        // null pointer value if no such link exists.  If this hash-table
+        // contains more than one element having a key equivalent to 'key',
+        // return the first such element (from the contiguous sequence of
+        // elements having the same key).  This method participates in
+        // overload resolution only if both 'HASHER' and 'COMPARATOR' are
+        // transparent, and 'key' is hashed and compared as is, without being
+        // converted to 'KeyType'.  The behavior is undefined unless the hash
+        // code that 'hasher' computes for 'key' equals the one it computes
+        // for every equivalent 'KeyType' object.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return bslalg::HashTableImpUtil::findTransparent<KEY_CONFIG>(
+                                            d_anchor,
+                                            key,
+                                            d_parameters.comparator(),
+                                            d_parameters.hashCodeForKey(key));
+    }
+
     bslalg::BidirectionalLink *findEndOfRange(
                                        bslalg::BidirectionalLink *first) const;
         // Return the address of the first node after any nodes holding a value
@@ -2922,6 +3048,39 @@ class HashTable {
         // the element following the range).  Also note that this hash-table
         // ensures all elements having the same key form a contiguous sequence.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASHER,
+                                                   LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value>::type
+    findRange(bslalg::BidirectionalLink **first,
+              bslalg::BidirectionalLink **last,
+              const LOOKUP_KEY&           key) const
+        // Load into the specified 'first' and 'last' pointers the respective
+        // addresses of the first and last link (in the list of elements owned
+        // by this hash table) where the contained elements have a key that is
+        // equivalent to the specified 'key' using the 'comparator' of this
+        // hash-table, and null pointers values if there are no elements
+        // matching 'key'.  This method participates in overload resolution
+        // only if both 'HASHER' and 'COMPARATOR' are transparent.  Note that
+        // the output values have the same meaning as for the overload taking
+        // a 'KeyType'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        BSLS_ASSERT_SAFE(first);
+        BSLS_ASSERT_SAFE(last);
+
+        *first = this->find(key);
+        *last  = *first;
+        while (*last && d_parameters.comparator()(
+                   key,
+                   bslalg::HashTableImpUtil::extractKey<KEY_CONFIG>(*last))) {
+            *last = (*last)->nextLink();
+        }
+    }
+
     bool hasSameValue(const HashTable& other) const;
         // Return 'true' if the specified 'other' has the same value as this
         // object, and 'false' otherwise.  Two 'HashTable' objects have the
@@ -6783,6 +6942,204 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
                            BSLS_COMPILERFEATURES_FORWARD(SOURCE_TYPE, value));
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+typename HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::NodeArena *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::acquireNodeArena()
+{
+    return d_parameters.nodeFactory().acquireArena();
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::extractNode(
+                                               bslalg::BidirectionalLink *node)
+{
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(node->previousLink()
+                  || d_anchor.listRootAddress() == node);
+
+    bslalg::BidirectionalLink *result = node->nextLink();
+
+    bslalg::HashTableImpUtil::remove(&d_anchor,
+                                     node,
+                                     hashCodeForNode(node));
+    --d_size;
+
+    return result;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertNode(
+                                         bslalg::BidirectionalLink *node,
+                                         NodeArena                 *arena,
+                                         bslalg::BidirectionalLink *hint)
+{
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(arena);
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    // Rehash (if appropriate) first, as that is the only operation that may
+    // allocate.
+
+    if (d_size >= d_capacity) {
+        this->rehashForNumBuckets(numBuckets() * 2);
+    }
+
+    const KeyType& key = ImpUtil::extractKey<KEY_CONFIG>(node);
+    size_t hashCode = this->d_parameters.hashCodeForKey(key);
+
+    if (!hint
+     || !d_parameters.comparator()(key,
+                                   ImpUtil::extractKey<KEY_CONFIG>(hint))) {
+        hint = this->find(key, hashCode);
+    }
+
+    d_parameters.nodeFactory().joinArena(arena);
+
+    if (!hint) {
+        ImpUtil::insertAtFrontOfBucket(&d_anchor, node, hashCode);
+    }
+    else {
+        ImpUtil::insertAtPosition(&d_anchor, node, hashCode, hint);
+    }
+    ++d_size;
+
+    return node;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertNodeIfMissing(
+                                     bool                      *isInsertedFlag,
+                                     bslalg::BidirectionalLink *node,
+                                     NodeArena                 *arena)
+{
+    BSLS_ASSERT_SAFE(isInsertedFlag);
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(arena);
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    const KeyType& key = ImpUtil::extractKey<KEY_CONFIG>(node);
+    size_t hashCode = this->d_parameters.hashCodeForKey(key);
+
+    bslalg::BidirectionalLink *position = this->find(key, hashCode);
+
+    *isInsertedFlag = !position;
+
+    if (!position) {
+        if (d_size >= d_capacity) {
+            this->rehashForNumBuckets(numBuckets() * 2);
+        }
+
+        d_parameters.nodeFactory().joinArena(arena);
+
+        ImpUtil::insertAtFrontOfBucket(&d_anchor, node, hashCode);
+        ++d_size;
+
+        position = node;
+    }
+    return position;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class SOURCE_HASHER, class SOURCE_COMPARATOR>
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::mergeAll(
+                                  HashTable<KEY_CONFIG,
+                                            SOURCE_HASHER,
+                                            SOURCE_COMPARATOR,
+                                            ALLOCATOR> *source)
+{
+    BSLS_ASSERT(source);
+    BSLS_ASSERT(allocator() == source->allocator());
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    if (static_cast<void *>(source) == static_cast<void *>(this)
+     || 0 == source->d_size) {
+        return;                                                       // RETURN
+    }
+
+    // Allocate the arena (if neither table has one yet) and the buckets for
+    // the combined elements up front.  The nodes themselves are relinked, and
+    // each rehash of this table relinks its nodes into the new buckets, so no
+    // node is ever allocated.
+
+    d_parameters.nodeFactory().shareArena(
+                                         source->d_parameters.nodeFactory());
+    reserveForNumElements(d_size + source->d_size);
+
+    bslalg::BidirectionalLink *node = source->d_anchor.listRootAddress();
+    while (node) {
+        const KeyType& key = ImpUtil::extractKey<KEY_CONFIG>(node);
+        size_t hashCode = this->d_parameters.hashCodeForKey(key);
+
+        bslalg::BidirectionalLink *position = this->find(key, hashCode);
+        bslalg::BidirectionalLink *next     = source->extractNode(node);
+
+        if (!position) {
+            ImpUtil::insertAtFrontOfBucket(&d_anchor, node, hashCode);
+        }
+        else {
+            ImpUtil::insertAtPosition(&d_anchor, node, hashCode, position);
+        }
+        ++d_size;
+
+        node = next;
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class SOURCE_HASHER, class SOURCE_COMPARATOR>
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::mergeUnique(
+                                  HashTable<KEY_CONFIG,
+                                            SOURCE_HASHER,
+                                            SOURCE_COMPARATOR,
+                                            ALLOCATOR> *source)
+{
+    BSLS_ASSERT(source);
+    BSLS_ASSERT(allocator() == source->allocator());
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    if (static_cast<void *>(source) == static_cast<void *>(this)
+     || 0 == source->d_size) {
+        return;                                                       // RETURN
+    }
+
+    d_parameters.nodeFactory().shareArena(
+                                         source->d_parameters.nodeFactory());
+
+    bslalg::BidirectionalLink *node = source->d_anchor.listRootAddress();
+    while (node) {
+        const KeyType& key = ImpUtil::extractKey<KEY_CONFIG>(node);
+        size_t hashCode = this->d_parameters.hashCodeForKey(key);
+
+        if (this->find(key, hashCode)) {
+            node = node->nextLink();
+            continue;
+        }
+
+        // Rehash before unlinking 'node', so that 'node' remains in 'source'
+        // if the rehash throws.
+
+        if (d_size >= d_capacity) {
+            this->rehashForNumBuckets(numBuckets() * 2);
+        }
+
+        bslalg::BidirectionalLink *next = source->extractNode(node);
+
+        ImpUtil::insertAtFrontOfBucket(&d_anchor, node, hashCode);
+        ++d_size;
+
+        node = next;
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::rehashForNumBuckets(
@@ -235,7 +235,7 @@
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [41] USAGE EXAMPLE
+// [42] USAGE EXAMPLE
 //
 // TEST APPARATUS
 // [ 3] int ggg(map *object, const char *spec, bool verbose = true);
@@ -255,6 +255,12 @@
 // [39] CONCERN: 'lower_bound' properly handles transparent comparators.
 // [39] CONCERN: 'upper_bound' properly handles transparent comparators.
 // [39] CONCERN: 'equal_range' properly handles transparent comparators.
+// [41] node_type extract(const_iterator position);
+// [41] node_type extract(const key_type& key);
+// [41] insert_return_type insert(node_type&& node);
+// [41] iterator insert(const_iterator hint, node_type&& node);
+// [41] void merge(map<K, V, C2, A>& source);
+// [41] void merge(multimap<K, V, C2, A>& source);
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -3872,7 +3878,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 41: {
+      case 42: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -3918,6 +3924,7 @@ int main(int argc, char *argv[])
             ASSERT(0 <  objectAllocator.numBytesInUse());
         }
       } break;
+      case 41: // falls through
       case 40: // falls through
       case 39: // falls through
       case 38: // falls through
@@ -216,7 +216,7 @@ using bsls::NameOf;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [40] USAGE EXAMPLE
+// [42] USAGE EXAMPLE
 //
 // TEST APPARATUS
 // [ 3] int ggg(map *object, const char *spec, bool verbose = true);
@@ -241,6 +241,12 @@ using bsls::NameOf;
 // [40] CONCERN: 'lower_bound' properly handles multi-value comparators.
 // [40] CONCERN: 'upper_bound' properly handles multi-value comparators.
 // [40] CONCERN: 'equal_range' properly handles multi-value comparators.
+// [41] node_type extract(const_iterator position);
+// [41] node_type extract(const key_type& key);
+// [41] insert_return_type insert(node_type&& node);
+// [41] iterator insert(const_iterator hint, node_type&& node);
+// [41] void merge(map<K, V, C2, A>& source);
+// [41] void merge(multimap<K, V, C2, A>& source);
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -1539,11 +1545,12 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 41: {
+      case 42: {
         if (verbose) printf(
                   "\nUSAGE EXAMPLE TEST IS HANDLED BY PRIMARY TEST DRIVER'"
                   "\n=====================================================\n");
       } break;
+      case 41: // falls through
       case 40: // falls through
       case 39: // falls through
       case 38: // falls through
@@ -532,6 +532,7 @@ BSL_OVERRIDES_STD mode"
 
 #include <bslstl_iteratorutil.h>
 #include <bslstl_mapcomparator.h>
+#include <bslstl_nodehandle.h>
 #include <bslstl_pair.h>
 #include <bslstl_stdexceptutil.h>
 #include <bslstl_treeiterator.h>
@@ -568,6 +569,9 @@ BSL_OVERRIDES_STD mode"
 
 namespace bsl {
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+class map;
+
                              // ==============
                              // class multimap
                              // ==============
@@ -696,6 +700,9 @@ class multimap {
     typedef bsl::reverse_iterator<iterator>            reverse_iterator;
     typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
 
+    typedef BloombergLP::bslstl::MapNodeHandle<Node, ALLOCATOR>
+                                                                     node_type;
+
     class value_compare {
         // This nested class defines a mechanism for comparing two objects of
         // 'value_type' by adapting an object of (template parameter) type
@@ -756,6 +763,13 @@ class multimap {
     };
 
   private:
+    // FRIENDS
+    template <class, class, class, class>
+    friend class multimap;
+
+    template <class, class, class, class>
+    friend class map;
+
     // PRIVATE CLASS METHODS
     static Node *toNode(BloombergLP::bslalg::RbTreeNode *node);
         // Return an address providing modifiable access to the specified
@@ -768,6 +782,13 @@ class multimap {
         // 'Node' object.
 
     // PRIVATE MANIPULATORS
+    void mergeTree(BloombergLP::bslalg::RbTreeAnchor *sourceTree,
+                   NodeFactory&                       sourceNodeFactory);
+        // Relink into this multimap every node of the specified 'sourceTree',
+        // allocated from the specified 'sourceNodeFactory', leaving
+        // 'sourceTree' empty.  The behavior is undefined unless
+        // 'sourceNodeFactory' uses the same allocator as this multimap.
+
     Comparator& comparator();
         // Return a reference providing modifiable access to the comparator for
         // this multimap.
@@ -1236,6 +1257,62 @@ class multimap {
         // empty after this call, but allocated memory may be retained for
         // future use.
 
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+    node_type extract(const_iterator position);
+        // Unlink from this multimap the element at the specified 'position',
+        // and return a node handle owning that element.  The element is
+        // neither copied, moved, nor reallocated, and references to it remain
+        // valid (referring to the element owned by the returned handle).  This
+        // method invalidates only iterators to the extracted element and
+        // previously saved values of the 'end()' iterator.  The behavior is
+        // undefined unless 'position' refers to an element in this multimap.
+
+    node_type extract(const key_type& key);
+        // Unlink from this multimap the first element whose key is equivalent
+        // to the specified 'key', if such an element exists, and return a node
+        // handle owning that element; otherwise, return an empty node handle.
+        // The element is neither copied, moved, nor reallocated.
+
+    iterator insert(BloombergLP::bslmf::MovableRef<node_type> node);
+        // Insert the element owned by the specified 'node' handle into this
+        // multimap, after any elements having an equivalent key, without
+        // copying, moving, or allocating, if 'node' is not empty, and leave
+        // 'node' empty.  Return an iterator referring to the inserted element,
+        // or 'end()' if 'node' is empty.  The behavior is undefined unless
+        // 'node' is empty or uses the same allocator as this multimap.
+
+    iterator insert(const_iterator                            hint,
+                    BloombergLP::bslmf::MovableRef<node_type> node);
+        // Insert the element owned by the specified 'node' handle into this
+        // multimap (in amortized constant time if the specified 'hint' is a
+        // valid immediate successor to the key of the element), without
+        // copying, moving, or allocating, if 'node' is not empty, and leave
+        // 'node' empty.  Return an iterator referring to the inserted element,
+        // or 'end()' if 'node' is empty.  The behavior is undefined unless
+        // 'hint' is an iterator in the range '[begin() .. end()]' (both
+        // endpoints included), and 'node' is empty or uses the same allocator
+        // as this multimap.
+#endif
+
+    template <class OTHER_COMPARATOR>
+    void merge(multimap<KEY, VALUE, OTHER_COMPARATOR, ALLOCATOR>& source);
+    template <class OTHER_COMPARATOR>
+    void merge(map<KEY, VALUE, OTHER_COMPARATOR, ALLOCATOR>& source);
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+    template <class OTHER_COMPARATOR>
+    void merge(multimap<KEY, VALUE, OTHER_COMPARATOR, ALLOCATOR>&& source);
+    template <class OTHER_COMPARATOR>
+    void merge(map<KEY, VALUE, OTHER_COMPARATOR, ALLOCATOR>&& source);
+#endif
+        // Relink every element of the specified 'source' into this multimap,
+        // after any elements having an equivalent key, leaving 'source' empty.
+        // The relinked elements are neither copied, moved, nor reallocated,
+        // and iterators and references to them remain valid, now referring
+        // into this multimap.  The behavior is undefined unless
+        // 'source.get_allocator() == get_allocator()'.  Note that memory is
+        // allocated only the first time this multimap exchanges elements with
+        // another container (see 'bslstl_simplepool').
+
     // Turn off complaints about necessarily class-defined methods.
     // BDE_VERIFY pragma: push
     // BDE_VERIFY pragma: -CD01
@@ -1836,6 +1913,44 @@ multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::comparator()
     return d_compAndAlloc;
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::mergeTree(
+                         BloombergLP::bslalg::RbTreeAnchor *sourceTree,
+                         NodeFactory&                       sourceNodeFactory)
+{
+    BSLS_ASSERT(nodeFactory().allocator() == sourceNodeFactory.allocator());
+
+    if (sourceTree == &d_tree || 0 == sourceTree->numNodes()) {
+        return;                                                       // RETURN
+    }
+
+    // Sharing the arena allocates (only) if neither pool has an arena yet, so
+    // it is done before any node is relinked.
+
+    nodeFactory().shareArena(sourceNodeFactory);
+
+    BloombergLP::bslalg::RbTreeNode *node = sourceTree->firstNode();
+    while (node != sourceTree->sentinel()) {
+        BloombergLP::bslalg::RbTreeNode *next =
+                                   BloombergLP::bslalg::RbTreeUtil::next(node);
+
+        bool leftChild;
+        BloombergLP::bslalg::RbTreeNode *insertLocation =
+            BloombergLP::bslalg::RbTreeUtil::findInsertLocation(
+                               &leftChild,
+                               &d_tree,
+                               this->comparator(),
+                               static_cast<const Node *>(node)->value().first);
+
+        BloombergLP::bslalg::RbTreeUtil::remove(sourceTree, node);
+        BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                                  insertLocation,
+                                                  leftChild,
+                                                  node);
+        node = next;
+    }
+}
+
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
 typename multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::NodeFactory&
@@ -2717,6 +2832,119 @@ void multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear() BSLS_KEYWORD_NOEXCEPT
 #endif
 }
 
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::node_type
+multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::extract(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    // Acquire the arena, which may allocate, before modifying the tree.
+
+    typename NodeFactory::Arena *arena = nodeFactory().acquireArena();
+
+    BloombergLP::bslalg::RbTreeNode *node =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(position.node());
+    BloombergLP::bslalg::RbTreeUtil::remove(&d_tree, node);
+    return node_type(static_cast<Node *>(node),
+                     arena,
+                     nodeFactory().allocator());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::node_type
+multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::extract(const key_type& key)
+{
+    const_iterator position = find(key);
+    if (position == end()) {
+        return node_type();                                           // RETURN
+    }
+    return extract(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                BloombergLP::bslmf::MovableRef<node_type> node)
+{
+    return insert(end(), MoveUtil::move(node));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                const_iterator                            hint,
+                                BloombergLP::bslmf::MovableRef<node_type> node)
+{
+    node_type& handle = node;
+
+    if (handle.empty()) {
+        return end();                                                 // RETURN
+    }
+
+    BSLS_ASSERT(handle.get_allocator() == get_allocator());
+
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                    const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    bool leftChild;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findInsertLocation(
+                                                  &leftChild,
+                                                  &d_tree,
+                                                  this->comparator(),
+                                                  handle.node()->value().first,
+                                                  hintNode);
+
+    nodeFactory().joinArena(handle.arena());
+
+    BloombergLP::bslalg::RbTreeNode *newNode = handle.release();
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              leftChild,
+                                              newNode);
+    return iterator(newNode);
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class OTHER_COMPARATOR>
+inline
+void multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::merge(
+                     multimap<KEY, VALUE, OTHER_COMPARATOR, ALLOCATOR>& source)
+{
+    mergeTree(&source.d_tree, source.nodeFactory());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class OTHER_COMPARATOR>
+inline
+void multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::merge(
+                          map<KEY, VALUE, OTHER_COMPARATOR, ALLOCATOR>& source)
+{
+    mergeTree(&source.d_tree, source.nodeFactory());
+}
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class OTHER_COMPARATOR>
+inline
+void multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::merge(
+                    multimap<KEY, VALUE, OTHER_COMPARATOR, ALLOCATOR>&& source)
+{
+    mergeTree(&source.d_tree, source.nodeFactory());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class OTHER_COMPARATOR>
+inline
+void multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::merge(
+                         map<KEY, VALUE, OTHER_COMPARATOR, ALLOCATOR>&& source)
+{
+    mergeTree(&source.d_tree, source.nodeFactory());
+}
+#endif
+
 // ACCESSORS
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
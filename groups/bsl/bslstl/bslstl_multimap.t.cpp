@@ -175,7 +175,7 @@
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [37] USAGE EXAMPLE
+// [38] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(multimap *object, const char *spec, int verbose = 1);
@@ -193,6 +193,12 @@
 // [36] CONCERN: 'lower_bound' properly handles transparent comparators.
 // [36] CONCERN: 'upper_bound' properly handles transparent comparators.
 // [36] CONCERN: 'equal_range' properly handles transparent comparators.
+// [37] node_type extract(const_iterator position);
+// [37] node_type extract(const key_type& key);
+// [37] iterator insert(node_type&& node);
+// [37] iterator insert(const_iterator hint, node_type&& node);
+// [37] void merge(multimap<K, V, C2, A>& source);
+// [37] void merge(map<K, V, C2, A>& source);
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -3928,7 +3934,7 @@ int main(int argc, char *argv[])
     }
 
     switch (test) { case 0:
-      case 37: {
+      case 38: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -4003,6 +4009,7 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 37: // falls through
       case 36: // falls through
       case 35: // falls through
       case 34: // falls through
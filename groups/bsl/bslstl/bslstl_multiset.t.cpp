@@ -169,7 +169,7 @@
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [35] USAGE EXAMPLE
+// [36] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(multiset *object, const char *spec, int verbose = 1);
@@ -184,6 +184,12 @@
 // [34] CONCERN: 'lower_bound' properly handles transparent comparators.
 // [34] CONCERN: 'upper_bound' properly handles transparent comparators.
 // [34] CONCERN: 'equal_range' properly handles transparent comparators.
+// [35] node_type extract(const_iterator position);
+// [35] node_type extract(const key_type& key);
+// [35] iterator insert(node_type&& node);
+// [35] iterator insert(const_iterator hint, node_type&& node);
+// [35] void merge(multiset<K, C2, A>& source);
+// [35] void merge(set<K, C2, A>& source);
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -3846,7 +3852,7 @@ int main(int argc, char *argv[])
     }
 
     switch (test) { case 0:
-      case 35: {
+      case 36: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -3892,6 +3898,7 @@ int main(int argc, char *argv[])
             ASSERT(0 < objectAllocator.numBytesInUse());
         }
       } break;
+      case 35: // falls through
       case 34: // falls through
       case 33: // falls through
       case 32: // falls through
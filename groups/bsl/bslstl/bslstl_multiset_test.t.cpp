@@ -6,6 +6,7 @@
 #include <bslstl_multiset.h>
 #include <bslstl_pair.h>
 #include <bslstl_randomaccessiterator.h>
+#include <bslstl_set.h>
 
 #include <bslalg_rangecompare.h>
 
@@ -169,7 +170,7 @@
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [35] USAGE EXAMPLE
+// [36] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(multiset *object, const char *spec, int verbose = 1);
@@ -184,6 +185,12 @@
 // [34] CONCERN: 'lower_bound' properly handles transparent comparators.
 // [34] CONCERN: 'upper_bound' properly handles transparent comparators.
 // [34] CONCERN: 'equal_range' properly handles transparent comparators.
+// [35] node_type extract(const_iterator position);
+// [35] node_type extract(const key_type& key);
+// [35] iterator insert(node_type&& node);
+// [35] iterator insert(const_iterator hint, node_type&& node);
+// [35] void merge(multiset<K, C2, A>& source);
+// [35] void merge(set<K, C2, A>& source);
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -7903,6 +7910,167 @@ int main(int argc, char *argv[])
     }
 
     switch (test) { case 0:
+      case 35: {
+        // --------------------------------------------------------------------
+        // TESTING NODE HANDLES AND 'merge'
+        //
+        // Concerns:
+        //: 1 'extract' unlinks an element and hands it to a node handle
+        //:   without copying, moving, or reallocating it.
+        //:
+        //: 2 Inserting a node handle relinks its element without allocating,
+        //:   next to any elements having an equivalent key.
+        //:
+        //: 3 A node handle keeps its element valid after the source container
+        //:   is destroyed, and the element is destroyed and its memory
+        //:   reclaimed when the handle is destroyed.
+        //:
+        //: 4 'merge' relinks every element of a container of the same kind,
+        //:   or of the counterpart kind, without copying or reallocating
+        //:   them, leaving the source empty.
+        //:
+        //: 5 Only the first exchange of elements between two containers
+        //:   allocates memory.
+        //:
+        //: 6 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Extract elements by key and by position, and verify the address
+        //:   of each extracted element and the sizes of the containers.
+        //:   (C-1)
+        //:
+        //: 2 Insert the handles into another container, with and without a
+        //:   hint, and verify the result and that no memory is allocated.
+        //:   (C-2)
+        //:
+        //: 3 Extract an element from a container that is then destroyed, and
+        //:   verify the value of the element owned by the handle.  (C-3)
+        //:
+        //: 4 Merge containers of both kinds into an object, and verify the
+        //:   sizes of both containers, the address of a relinked element, and
+        //:   the number of allocations.  (C-4..5)
+        //:
+        //: 5 Verify that all memory is returned to the allocator.  (C-6)
+        //
+        // Testing:
+        //   node_type extract(const_iterator position);
+        //   node_type extract(const key_type& key);
+        //   iterator insert(node_type&& node);
+        //   iterator insert(const_iterator hint, node_type&& node);
+        //   void merge(multiset<K, C2, A>& source);
+        //   void merge(set<K, C2, A>& source);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING NODE HANDLES AND 'merge'"
+                            "\n================================\n");
+
+        typedef bsl::multiset<int> Obj;
+        typedef bsl::set<int>      OtherObj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        if (verbose) printf("\tTesting 'extract' and 'insert'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            Obj mY(&oa);  const Obj& Y = mY;
+
+            for (int i = 0; i < 8; ++i) {
+                mX.insert(i);
+                mY.insert(i + 4);
+            }
+
+            const int *ADDRESS = &*X.find(2);
+
+            Obj::node_type mN = mX.extract(2);  const Obj::node_type& N = mN;
+
+            ASSERT(!N.empty());
+            ASSERT(ADDRESS == &N.value());
+            ASSERT(7       == X.size());
+            ASSERT(X.end() == X.find(2));
+
+            ASSERT(N.get_allocator() == X.get_allocator());
+            ASSERT(mX.extract(100).empty());
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            Obj::iterator it = mY.insert(MoveUtil::move(mN));
+
+            ASSERT(N.empty());
+            ASSERT(ADDRESS == &*it);
+            ASSERT(9       == Y.size());
+
+            mN = mX.extract(X.find(5));
+            it = mY.insert(Y.find(5), MoveUtil::move(mN));
+
+            ASSERT(N.empty());
+            ASSERT(5  == *it);
+            ASSERT(2  == Y.count(5));
+            ASSERT(10 == Y.size());
+            ASSERT(6  == X.size());
+
+            ASSERT(NUM_ALLOCATIONS == oa.numAllocations());
+
+            {
+                Obj mZ(&oa);
+                mZ.insert(100);
+                mN = mZ.extract(mZ.begin());
+            }
+            ASSERT(100 == N.value());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+#endif
+
+        if (verbose) printf("\tTesting 'merge'.\n");
+        {
+            Obj      mX(&oa);  const Obj&      X = mX;
+            Obj      mY(&oa);  const Obj&      Y = mY;
+            OtherObj mZ(&oa);  const OtherObj& Z = mZ;
+
+            for (int i = 0; i < 8; ++i) {
+                mX.insert(i);
+                mY.insert(i + 4);
+                mZ.insert(i % 4);
+            }
+
+            const int *ADDRESS = &*Y.find(11);
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            mX.merge(mY);
+
+            ASSERT(16      == X.size());
+            ASSERT(0       == Y.size());
+            ASSERT(ADDRESS == &*X.find(11));
+
+            mX.merge(mZ);
+
+            ASSERT(20 == X.size());
+            ASSERT(0  == Z.size());
+
+            mX.merge(mX);
+
+            ASSERT(20 == X.size());
+
+            // Only sharing the first arena allocated.
+
+            ASSERT(NUM_ALLOCATIONS + 1 == oa.numAllocations());
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+            OtherObj mW(&oa);  const OtherObj& W = mW;
+            mW.insert(100);
+
+            mX.merge(bslmf::MovableRefUtil::move(mW));
+
+            ASSERT(21 == X.size());
+            ASSERT(0  == W.size());
+            ASSERT(1  == X.count(100));
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
       case 34: {
         // --------------------------------------------------------------------
         // TESTING TRANSPARENT COMPARATOR
@@ -0,0 +1,553 @@
+// bslstl_nodehandle.h                                                -*-C++-*-
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#define INCLUDED_BSLSTL_NODEHANDLE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide node handles for relinking nodes between containers.
+//
+//@CLASSES:
+//  bslstl::NodeHandle: owner of a node extracted from a node-based container
+//  bslstl::MapNodeHandle: node handle giving access to a key and mapped value
+//  bslstl::NodeInsertReturnType: result of inserting a node handle
+//
+//@SEE_ALSO: bslstl_simplepool, bslstl_treenodepool, bslstl_map
+//
+//@DESCRIPTION: This component provides the 'node_type' and
+// 'insert_return_type' types of the node-based associative containers
+// ('bsl::map', 'bsl::set', 'bsl::unordered_map', 'bsl::unordered_set', and
+// their multi variants).  A node handle owns a single node that has been
+// extracted from a container, together with the value held by that node, and
+// may be used to insert the node into another container of a compatible type
+// without copying or moving the value and without allocating or deallocating
+// memory.
+//
+// The nodes of a container are allocated from a 'bslstl::SimplePool' that
+// returns its memory to the allocator wholesale on destruction.  A node
+// handle therefore holds a reference to the 'bslstl::SimplePool_Arena' of the
+// pool from which its node was allocated, which keeps the node valid after
+// the originating container is destroyed.  A container that adopts a node
+// joins the arena of that node, so that the node may later be deleted into
+// the pool of the adopting container (see 'bslstl_simplepool').
+//
+// 'bslstl::NodeHandle' is used as the 'node_type' of set containers and
+// 'bslstl::MapNodeHandle', which additionally provides the 'key' and 'mapped'
+// accessors, as the 'node_type' of map containers.  A node may be moved only
+// between containers having the same value type and equal allocators.
+//
+// The constructor taking a node, and the 'node', 'arena', and 'release'
+// methods, are for use by the containers only.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Changing the Key of a Map Entry
+/// - - - - - - - - - - - - - - - - - - - - -
+// A node handle is obtained from a container's 'extract' method.  Suppose a
+// map from order identifiers to quantities needs an entry to be re-keyed
+// without reallocating the entry:
+//..
+//  bsl::map<int, int> orders;
+//  orders[1] = 100;
+//  orders[2] = 200;
+//
+//  bsl::map<int, int>::node_type node = orders.extract(1);
+//  assert(node);
+//  assert(1   == node.key());
+//  assert(100 == node.mapped());
+//  assert(1   == orders.size());
+//..
+// The key of the extracted entry may be modified, and the node inserted back:
+//..
+//  node.key() = 3;
+//
+//  typedef bslmf::MovableRefUtil MoveUtil;
+//  bsl::map<int, int>::insert_return_type result =
+//                                        orders.insert(MoveUtil::move(node));
+//  assert(result.inserted);
+//  assert(3   == result.position->first);
+//  assert(100 == result.position->second);
+//  assert(!result.node);
+//  assert(!node);
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BOS_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "<bslstl_nodehandle.h> header can't be included directly in \
+BSL_OVERRIDES_STD mode"
+#endif
+#include <bslscm_version.h>
+
+#include <bslstl_simplepool.h>
+
+#include <bslma_allocatortraits.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_removeconst.h>
+
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
+#include <bsls_util.h>
+
+#include <algorithm>  // swap (C++03)
+
+namespace BloombergLP {
+namespace bslstl {
+
+                       // ================
+                       // class NodeHandle
+                       // ================
+
+template <class NODE, class ALLOCATOR>
+class NodeHandle {
+    // This move-only class owns a node of the (template parameter) type
+    // 'NODE', which must provide a 'ValueType' type and a 'value' manipulator,
+    // allocated from a 'SimplePool<NODE, ALLOCATOR>', or is empty.  The node
+    // and the value it holds are destroyed with the handle, unless ownership
+    // of the node is released to a container.
+
+    // PRIVATE TYPES
+    typedef SimplePool<NODE, ALLOCATOR>  Pool;
+    typedef typename Pool::AllocatorType NodeAllocator;
+    typedef bsl::allocator_traits<NodeAllocator>
+                                         NodeAllocatorTraits;
+    typedef bslmf::MovableRefUtil        MoveUtil;
+
+  public:
+    // TYPES
+    typedef typename NODE::ValueType value_type;
+    typedef ALLOCATOR                allocator_type;
+
+    typedef typename Pool::Arena     Arena;
+        // Alias for the memory shared by the pools of containers exchanging
+        // nodes.
+
+  private:
+    // DATA
+    NODE          *d_node_p;     // owned node, or 0 if empty
+    Arena         *d_arena_p;    // arena keeping 'd_node_p' valid (held
+                                 // reference), or 0 if empty
+    NodeAllocator  d_allocator;  // allocator of the pool of 'd_node_p'
+
+  private:
+    // NOT IMPLEMENTED
+    NodeHandle(const NodeHandle&);
+    NodeHandle& operator=(const NodeHandle&);
+
+    // PRIVATE MANIPULATORS
+    void reset();
+        // Destroy the node held by this object, if any, and leave this object
+        // empty.
+
+  public:
+    // CREATORS
+    NodeHandle();
+        // Create an empty node handle.
+
+    NodeHandle(NODE                 *node,
+               Arena                *arena,
+               const NodeAllocator&  allocator);
+        // Create a node handle owning the specified 'node' and the reference
+        // to the specified 'arena' held by the caller, where 'node' was
+        // allocated by a pool belonging to 'arena' that uses the specified
+        // 'allocator'.  The behavior is undefined unless 'node' holds a valid
+        // value and is not linked into any container.  Note that this
+        // constructor is for use by containers only.
+
+    NodeHandle(bslmf::MovableRef<NodeHandle> original);
+        // Create a node handle owning the node, if any, owned by the specified
+        // 'original' node handle, and leave 'original' empty.
+
+    ~NodeHandle();
+        // Destroy this object, and the node it owns, if any.
+
+    // MANIPULATORS
+    NodeHandle& operator=(bslmf::MovableRef<NodeHandle> rhs);
+        // Destroy the node owned by this object, if any, transfer ownership of
+        // the node owned by the specified 'rhs', if any, to this object, and
+        // leave 'rhs' empty.  Return a reference providing modifiable access
+        // to this object.
+
+    NODE *release();
+        // Relinquish ownership of the node held by this object, and the arena
+        // reference held for it, and return the address of that node, leaving
+        // this object empty.  The behavior is undefined unless this object is
+        // not empty and the node has been linked into a container whose pool
+        // has joined the arena of this object (see 'SimplePool::joinArena').
+        // Note that this method is for use by containers only.
+
+    void swap(NodeHandle& other);
+        // Exchange the nodes, and allocators, of this object and the specified
+        // 'other' object.
+
+    // ACCESSORS
+    BSLS_KEYWORD_EXPLICIT operator bool() const;
+        // Return 'true' if this object owns a node, and 'false' otherwise.
+
+    Arena *arena() const;
+        // Return the address of the arena keeping the node held by this object
+        // valid, or 0 if this object is empty.  Note that this method is for
+        // use by containers only.
+
+    bool empty() const;
+        // Return 'true' if this object does not own a node, and 'false'
+        // otherwise.
+
+    allocator_type get_allocator() const;
+        // Return the allocator used to allocate the node owned by this object.
+        // The behavior is undefined if this object is empty.
+
+    NODE *node() const;
+        // Return the address of the node held by this object, or 0 if this
+        // object is empty.  Note that this method is for use by containers
+        // only.
+
+    value_type& value() const;
+        // Return a reference providing modifiable access to the value held by
+        // the node owned by this object.  The behavior is undefined if this
+        // object is empty.
+};
+
+// FREE FUNCTIONS
+template <class NODE, class ALLOCATOR>
+void swap(NodeHandle<NODE, ALLOCATOR>& a, NodeHandle<NODE, ALLOCATOR>& b);
+    // Exchange the nodes, and allocators, of the specified 'a' and 'b'
+    // objects.
+
+                       // ===================
+                       // class MapNodeHandle
+                       // ===================
+
+template <class NODE, class ALLOCATOR>
+class MapNodeHandle : public NodeHandle<NODE, ALLOCATOR> {
+    // This move-only class is a 'NodeHandle' for nodes holding a 'bsl::pair'
+    // whose 'first' member is a 'const' key, and provides modifiable access to
+    // the key.
+
+    // PRIVATE TYPES
+    typedef NodeHandle<NODE, ALLOCATOR> Base;
+    typedef bslmf::MovableRefUtil       MoveUtil;
+
+  public:
+    // TYPES
+    typedef typename bsl::remove_const<
+                   typename Base::value_type::first_type>::type key_type;
+    typedef typename Base::value_type::second_type               mapped_type;
+
+  private:
+    // NOT IMPLEMENTED
+    MapNodeHandle(const MapNodeHandle&);
+    MapNodeHandle& operator=(const MapNodeHandle&);
+
+  public:
+    // CREATORS
+    MapNodeHandle();
+        // Create an empty node handle.
+
+    MapNodeHandle(NODE                                *node,
+                  typename Base::Arena                *arena,
+                  const typename SimplePool<NODE, ALLOCATOR>::AllocatorType&
+                                                       allocator);
+        // Create a node handle owning the specified 'node' and the reference
+        // to the specified 'arena' held by the caller, where 'node' was
+        // allocated by a pool belonging to 'arena' that uses the specified
+        // 'allocator'.  The behavior is undefined unless 'node' holds a valid
+        // value and is not linked into any container.  Note that this
+        // constructor is for use by containers only.
+
+    MapNodeHandle(bslmf::MovableRef<MapNodeHandle> original);
+        // Create a node handle owning the node, if any, owned by the specified
+        // 'original' node handle, and leave 'original' empty.
+
+    //! ~MapNodeHandle() = default;
+        // Destroy this object, and the node it owns, if any.
+
+    // MANIPULATORS
+    MapNodeHandle& operator=(bslmf::MovableRef<MapNodeHandle> rhs);
+        // Destroy the node owned by this object, if any, transfer ownership of
+        // the node owned by the specified 'rhs', if any, to this object, and
+        // leave 'rhs' empty.  Return a reference providing modifiable access
+        // to this object.
+
+    // ACCESSORS
+    key_type& key() const;
+        // Return a reference providing modifiable access to the key held by
+        // the node owned by this object.  The behavior is undefined if this
+        // object is empty.
+
+    mapped_type& mapped() const;
+        // Return a reference providing modifiable access to the mapped value
+        // held by the node owned by this object.  The behavior is undefined if
+        // this object is empty.
+};
+
+                       // ===========================
+                       // struct NodeInsertReturnType
+                       // ===========================
+
+template <class ITERATOR, class NODE_HANDLE>
+struct NodeInsertReturnType {
+    // This 'struct' describes the result of inserting a node handle into a
+    // container having unique keys.
+
+    // PUBLIC DATA
+    ITERATOR    position;  // position of the inserted node, or of the element
+                           // preventing insertion, or 'end()' if the inserted
+                           // handle was empty
+
+    bool        inserted;  // 'true' if the node was inserted
+
+    NODE_HANDLE node;      // the node that was not inserted, if any
+};
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                       // ----------------
+                       // class NodeHandle
+                       // ----------------
+
+// PRIVATE MANIPULATORS
+template <class NODE, class ALLOCATOR>
+void NodeHandle<NODE, ALLOCATOR>::reset()
+{
+    if (d_node_p) {
+        NodeAllocatorTraits::destroy(
+                                   d_allocator,
+                                   bsls::Util::addressOf(d_node_p->value()));
+        Pool::releaseArena(d_arena_p, d_node_p, d_allocator);
+
+        d_node_p  = 0;
+        d_arena_p = 0;
+    }
+}
+
+// CREATORS
+template <class NODE, class ALLOCATOR>
+inline
+NodeHandle<NODE, ALLOCATOR>::NodeHandle()
+: d_node_p(0)
+, d_arena_p(0)
+, d_allocator()
+{
+}
+
+template <class NODE, class ALLOCATOR>
+inline
+NodeHandle<NODE, ALLOCATOR>::NodeHandle(NODE                 *node,
+                                        Arena                *arena,
+                                        const NodeAllocator&  allocator)
+: d_node_p(node)
+, d_arena_p(arena)
+, d_allocator(allocator)
+{
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(arena);
+}
+
+template <class NODE, class ALLOCATOR>
+inline
+NodeHandle<NODE, ALLOCATOR>::NodeHandle(
+                                        bslmf::MovableRef<NodeHandle> original)
+: d_node_p(MoveUtil::access(original).d_node_p)
+, d_arena_p(MoveUtil::access(original).d_arena_p)
+, d_allocator(MoveUtil::access(original).d_allocator)
+{
+    NodeHandle& lvalue = original;
+    lvalue.d_node_p  = 0;
+    lvalue.d_arena_p = 0;
+}
+
+template <class NODE, class ALLOCATOR>
+inline
+NodeHandle<NODE, ALLOCATOR>::~NodeHandle()
+{
+    reset();
+}
+
+// MANIPULATORS
+template <class NODE, class ALLOCATOR>
+NodeHandle<NODE, ALLOCATOR>&
+NodeHandle<NODE, ALLOCATOR>::operator=(bslmf::MovableRef<NodeHandle> rhs)
+{
+    NodeHandle& lvalue = rhs;
+
+    if (this != &lvalue) {
+        reset();
+
+        d_node_p    = lvalue.d_node_p;
+        d_arena_p   = lvalue.d_arena_p;
+        d_allocator = lvalue.d_allocator;
+
+        lvalue.d_node_p  = 0;
+        lvalue.d_arena_p = 0;
+    }
+    return *this;
+}
+
+template <class NODE, class ALLOCATOR>
+NODE *NodeHandle<NODE, ALLOCATOR>::release()
+{
+    BSLS_ASSERT(d_node_p);
+
+    NODE *node = d_node_p;
+    Pool::releaseArena(d_arena_p, 0, d_allocator);
+
+    d_node_p  = 0;
+    d_arena_p = 0;
+    return node;
+}
+
+template <class NODE, class ALLOCATOR>
+inline
+void NodeHandle<NODE, ALLOCATOR>::swap(NodeHandle& other)
+{
+    using std::swap;
+
+    swap(d_node_p,    other.d_node_p);
+    swap(d_arena_p,   other.d_arena_p);
+    swap(d_allocator, other.d_allocator);
+}
+
+// ACCESSORS
+template <class NODE, class ALLOCATOR>
+inline
+NodeHandle<NODE, ALLOCATOR>::operator bool() const
+{
+    return d_node_p;
+}
+
+template <class NODE, class ALLOCATOR>
+inline
+typename NodeHandle<NODE, ALLOCATOR>::Arena *
+NodeHandle<NODE, ALLOCATOR>::arena() const
+{
+    return d_arena_p;
+}
+
+template <class NODE, class ALLOCATOR>
+inline
+bool NodeHandle<NODE, ALLOCATOR>::empty() const
+{
+    return !d_node_p;
+}
+
+template <class NODE, class ALLOCATOR>
+inline
+ALLOCATOR NodeHandle<NODE, ALLOCATOR>::get_allocator() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    return ALLOCATOR(d_allocator);
+}
+
+template <class NODE, class ALLOCATOR>
+inline
+NODE *NodeHandle<NODE, ALLOCATOR>::node() const
+{
+    return d_node_p;
+}
+
+template <class NODE, class ALLOCATOR>
+inline
+typename NodeHandle<NODE, ALLOCATOR>::value_type&
+NodeHandle<NODE, ALLOCATOR>::value() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    return d_node_p->value();
+}
+
+                       // -------------------
+                       // class MapNodeHandle
+                       // -------------------
+
+// CREATORS
+template <class NODE, class ALLOCATOR>
+inline
+MapNodeHandle<NODE, ALLOCATOR>::MapNodeHandle()
+: Base()
+{
+}
+
+template <class NODE, class ALLOCATOR>
+inline
+MapNodeHandle<NODE, ALLOCATOR>::MapNodeHandle(
+               NODE                                                *node,
+               typename Base::Arena                                *arena,
+               const typename SimplePool<NODE, ALLOCATOR>::AllocatorType&
+                                                                    allocator)
+: Base(node, arena, allocator)
+{
+}
+
+template <class NODE, class ALLOCATOR>
+inline
+MapNodeHandle<NODE, ALLOCATOR>::MapNodeHandle(
+                                     bslmf::MovableRef<MapNodeHandle> original)
+: Base(MoveUtil::move(static_cast<Base&>(MoveUtil::access(original))))
+{
+}
+
+// MANIPULATORS
+template <class NODE, class ALLOCATOR>
+inline
+MapNodeHandle<NODE, ALLOCATOR>&
+MapNodeHandle<NODE, ALLOCATOR>::operator=(
+                                          bslmf::MovableRef<MapNodeHandle> rhs)
+{
+    Base::operator=(MoveUtil::move(static_cast<Base&>(MoveUtil::access(rhs))));
+    return *this;
+}
+
+// ACCESSORS
+template <class NODE, class ALLOCATOR>
+inline
+typename MapNodeHandle<NODE, ALLOCATOR>::key_type&
+MapNodeHandle<NODE, ALLOCATOR>::key() const
+{
+    return const_cast<key_type&>(this->value().first);
+}
+
+template <class NODE, class ALLOCATOR>
+inline
+typename MapNodeHandle<NODE, ALLOCATOR>::mapped_type&
+MapNodeHandle<NODE, ALLOCATOR>::mapped() const
+{
+    return this->value().second;
+}
+
+}  // close package namespace
+
+// FREE FUNCTIONS
+template <class NODE, class ALLOCATOR>
+inline
+void bslstl::swap(NodeHandle<NODE, ALLOCATOR>& a,
+                  NodeHandle<NODE, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
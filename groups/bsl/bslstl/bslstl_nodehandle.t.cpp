@@ -0,0 +1,425 @@
+// bslstl_nodehandle.t.cpp                                            -*-C++-*-
+#include <bslstl_nodehandle.h>
+
+#include <bslstl_map.h>
+#include <bslstl_simplepool.h>
+#include <bslstl_treenode.h>
+
+#include <bslma_stdallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_util.h>
+
+#include <new>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+using namespace bslstl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The components under test are move-only handles owning a node allocated
+// from a 'SimplePool' together with a reference to the arena of that pool.
+// The nodes are allocated, and the arena references acquired, directly from a
+// 'SimplePool' in the manner of a container.  We verify that the handles give
+// access to the value held by the node, transfer ownership on move and swap,
+// and destroy the value and return the node when destroyed, even if the
+// originating pool was destroyed first.
+//-----------------------------------------------------------------------------
+// NodeHandle
+// [ 1] NodeHandle();
+// [ 1] NodeHandle(NODE *node, Arena *arena, const NodeAllocator& allocator);
+// [ 1] NodeHandle(MovableRef<NodeHandle> original);
+// [ 1] ~NodeHandle();
+// [ 1] NodeHandle& operator=(MovableRef<NodeHandle> rhs);
+// [ 1] NODE *release();
+// [ 1] void swap(NodeHandle& other);
+// [ 1] operator bool() const;
+// [ 1] Arena *arena() const;
+// [ 1] bool empty() const;
+// [ 1] allocator_type get_allocator() const;
+// [ 1] NODE *node() const;
+// [ 1] value_type& value() const;
+// [ 1] void swap(NodeHandle& a, NodeHandle& b);
+//
+// MapNodeHandle
+// [ 2] MapNodeHandle();
+// [ 2] MapNodeHandle(NODE *, Arena *, const NodeAllocator&);
+// [ 2] MapNodeHandle(MovableRef<MapNodeHandle> original);
+// [ 2] MapNodeHandle& operator=(MovableRef<MapNodeHandle> rhs);
+// [ 2] key_type& key() const;
+// [ 2] mapped_type& mapped() const;
+// ----------------------------------------------------------------------------
+// [ 3] USAGE EXAMPLE
+// [ 1] CONCERN: A handle keeps its node valid after the pool is destroyed.
+//-----------------------------------------------------------------------------
+//=============================================================================
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslmf::MovableRefUtil                         MoveUtil;
+
+typedef TreeNode<int>                                 IntNode;
+typedef bsl::allocator<int>                           IntAllocator;
+typedef SimplePool<IntNode, IntAllocator>             IntPool;
+typedef NodeHandle<IntNode, IntAllocator>             Obj;
+
+typedef bsl::pair<const int, int>                     PairType;
+typedef TreeNode<PairType>                            PairNode;
+typedef bsl::allocator<PairType>                      PairAllocator;
+typedef SimplePool<PairNode, PairAllocator>           PairPool;
+typedef MapNodeHandle<PairNode, PairAllocator>        MapObj;
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Changing the Key of a Map Entry
+/// - - - - - - - - - - - - - - - - - - - - -
+// A node handle is obtained from a container's 'extract' method.  Suppose a
+// map from order identifiers to quantities needs an entry to be re-keyed
+// without reallocating the entry:
+//..
+    bsl::map<int, int> orders;
+    orders[1] = 100;
+    orders[2] = 200;
+
+    bsl::map<int, int>::node_type node = orders.extract(1);
+    ASSERT(node);
+    ASSERT(1   == node.key());
+    ASSERT(100 == node.mapped());
+    ASSERT(1   == orders.size());
+//..
+// The key of the extracted entry may be modified, and the node inserted back:
+//..
+    node.key() = 3;
+
+    typedef bslmf::MovableRefUtil MoveUtil;
+    bsl::map<int, int>::insert_return_type result =
+                                          orders.insert(MoveUtil::move(node));
+    ASSERT(result.inserted);
+    ASSERT(3   == result.position->first);
+    ASSERT(100 == result.position->second);
+    ASSERT(!result.node);
+    ASSERT(!node);
+//..
+#endif
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // MAP NODE HANDLE
+        //
+        // Concerns:
+        //: 1 'key' and 'mapped' provide modifiable access to the members of
+        //:   the value held by the node.
+        //:
+        //: 2 Move construction and move assignment transfer ownership of the
+        //:   node, leaving the source empty.
+        //:
+        //: 3 The value is destroyed, and the node returned, when the handle is
+        //:   destroyed.
+        //
+        // Plan:
+        //: 1 Allocate a node from a pool, construct a 'pair' in it, and pass
+        //:   it to a handle together with a reference to the arena of the
+        //:   pool.  Modify the key and mapped value through the handle.  (C-1)
+        //:
+        //: 2 Move the handle by construction and by assignment, and check the
+        //:   source and destination.  (C-2)
+        //:
+        //: 3 Destroy the handle and the pool, and verify that no memory is in
+        //:   use.  (C-3)
+        //
+        // Testing:
+        //   MapNodeHandle();
+        //   MapNodeHandle(NODE *, Arena *, const NodeAllocator&);
+        //   MapNodeHandle(MovableRef<MapNodeHandle> original);
+        //   MapNodeHandle& operator=(MovableRef<MapNodeHandle> rhs);
+        //   key_type& key() const;
+        //   mapped_type& mapped() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMAP NODE HANDLE"
+                            "\n===============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            PairAllocator allocator(&oa);
+            PairPool      pool(allocator);
+
+            PairPool::Arena *arena = pool.acquireArena();
+            PairNode        *node  = pool.allocate();
+            ::new (bsls::Util::addressOf(node->value())) PairType(1, 10);
+
+            MapObj mX(node, arena, pool.allocator());  const MapObj& X = mX;
+
+            ASSERT(!X.empty());
+            ASSERT(node == X.node());
+            ASSERT(1    == X.key());
+            ASSERT(10   == X.mapped());
+
+            mX.key()    = 2;
+            mX.mapped() = 20;
+            ASSERT(2  == node->value().first);
+            ASSERT(20 == node->value().second);
+
+            MapObj mY(MoveUtil::move(mX));  const MapObj& Y = mY;
+            ASSERT(X.empty());
+            ASSERT(node == Y.node());
+            ASSERT(2    == Y.key());
+
+            MapObj mZ;  const MapObj& Z = mZ;
+            ASSERT(Z.empty());
+
+            mZ = MoveUtil::move(mY);
+            ASSERT(Y.empty());
+            ASSERT(node == Z.node());
+            ASSERT(20   == Z.mapped());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 A handle provides access to the value held by its node.
+        //:
+        //: 2 Ownership of the node is transferred by move and swap, and
+        //:   relinquished by 'release'.
+        //:
+        //: 3 A handle keeps its node valid after the pool that allocated the
+        //:   node is destroyed, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 Allocate nodes from a pool, and pass them to handles together
+        //:   with references to the arena of the pool.  Exercise the
+        //:   accessors, move, swap, and 'release'.  (C-1..2)
+        //:
+        //: 2 Destroy the pool before a handle, access the value through the
+        //:   handle, and verify that no memory is in use once the handle is
+        //:   destroyed.  (C-3)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\nAccessors, move, and swap.\n");
+        {
+            IntAllocator allocator(&oa);
+            IntPool      pool(allocator);
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(!X);
+            ASSERT(0 == X.node());
+            ASSERT(0 == X.arena());
+
+            IntNode *nodeA = pool.allocate();
+            nodeA->value() = 1;
+            Obj mA(nodeA, pool.acquireArena(), pool.allocator());
+            const Obj& A = mA;
+
+            ASSERT(!A.empty());
+            ASSERT(A);
+            ASSERT(nodeA == A.node());
+            ASSERT(0     != A.arena());
+            ASSERT(1     == A.value());
+            ASSERT(&oa   == A.get_allocator().mechanism());
+
+            IntNode *nodeB = pool.allocate();
+            nodeB->value() = 2;
+            Obj mB(nodeB, pool.acquireArena(), pool.allocator());
+            const Obj& B = mB;
+            ASSERT(A.arena() == B.arena());
+
+            mA.swap(mB);
+            ASSERT(nodeB == A.node());
+            ASSERT(nodeA == B.node());
+
+            swap(mA, mB);
+            ASSERT(nodeA == A.node());
+            ASSERT(nodeB == B.node());
+
+            mX = MoveUtil::move(mA);
+            ASSERT(A.empty());
+            ASSERT(nodeA == X.node());
+            ASSERT(1     == X.value());
+
+            Obj mY(MoveUtil::move(mB));  const Obj& Y = mY;
+            ASSERT(B.empty());
+            ASSERT(nodeB == Y.node());
+
+            // Hand the node back to the pool, as a container adopting it
+            // would.
+
+            pool.joinArena(mY.arena());
+
+            IntNode *node = mY.release();
+            ASSERT(Y.empty());
+            ASSERT(0     == Y.arena());
+            ASSERT(nodeB == node);
+
+            pool.deallocate(node);
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nHandle outliving its pool.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+            {
+                IntAllocator allocator(&oa);
+                IntPool      pool(allocator);
+
+                IntNode *node = pool.allocate();
+                node->value() = 5;
+
+                Obj mT(node, pool.acquireArena(), pool.allocator());
+                mX = MoveUtil::move(mT);
+            }
+            ASSERT(0 < oa.numBlocksInUse());
+            ASSERT(5 == X.value());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -517,6 +517,7 @@ BSL_OVERRIDES_STD mode"
 
 #include <bslstl_iterator.h>
 #include <bslstl_iteratorutil.h>
+#include <bslstl_nodehandle.h>
 #include <bslstl_pair.h>
 #include <bslstl_setcomparator.h>
 #include <bslstl_stdexceptutil.h>
@@ -552,6 +553,9 @@ BSL_OVERRIDES_STD mode"
 
 namespace bsl {
 
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+class multiset;
+
                              // =========
                              // class set
                              // =========
@@ -673,12 +677,32 @@ class set {
     typedef bsl::reverse_iterator<iterator>            reverse_iterator;
     typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
 
+    typedef BloombergLP::bslstl::NodeHandle<Node, ALLOCATOR>
+                                                                     node_type;
+    typedef BloombergLP::bslstl::NodeInsertReturnType<iterator, node_type>
+                                                            insert_return_type;
+
   private:
+    // FRIENDS
+    template <class, class, class>
+    friend class set;
+
+    template <class, class, class>
+    friend class multiset;
+
     // PRIVATE MANIPULATORS
     NodeFactory& nodeFactory();
         // Return a reference providing modifiable access to the node-allocator
         // for this tree.
 
+    void mergeTree(BloombergLP::bslalg::RbTreeAnchor *sourceTree,
+                   NodeFactory&                       sourceNodeFactory);
+        // Relink into this set each node of the specified 'sourceTree',
+        // allocated from the specified 'sourceNodeFactory', whose value is not
+        // equivalent to that of an element of this set, leaving the other
+        // nodes in 'sourceTree'.  The behavior is undefined unless
+        // 'sourceNodeFactory' uses the same allocator as this set.
+
     Comparator& comparator();
         // Return a reference providing modifiable access to the comparator for
         // this tree.
@@ -1353,6 +1377,70 @@ class set {
         // Remove all entries from this set.  Note that the set is empty after
         // this call, but allocated memory may be retained for future use.
 
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+    node_type extract(const_iterator position);
+        // Unlink from this set the element at the specified 'position', and
+        // return a node handle owning that element.  The element is neither
+        // copied, moved, nor reallocated, and references to it remain valid
+        // (referring to the element owned by the returned handle).  This
+        // method invalidates only iterators to the extracted element and
+        // previously saved values of the 'end()' iterator.  The behavior is
+        // undefined unless 'position' refers to an element in this set.
+
+    node_type extract(const key_type& key);
+        // Unlink from this set the element whose key is equivalent to the
+        // specified 'key', if such an element exists, and return a node handle
+        // owning that element; otherwise, return an empty node handle.  The
+        // element is neither copied, moved, nor reallocated.
+
+    insert_return_type insert(BloombergLP::bslmf::MovableRef<node_type> node);
+        // Insert the element owned by the specified 'node' handle into this
+        // set, without copying, moving, or allocating, if 'node' is not empty
+        // and this set does not already contain an element whose key is
+        // equivalent to that of the element; 'node' is left empty if the
+        // element is inserted.  Return an 'insert_return_type' whose
+        // 'position' refers to the inserted element, to the element that
+        // prevented insertion, or is 'end()' if 'node' is empty; whose
+        // 'inserted' member is 'true' if the element was inserted and 'false'
+        // otherwise; and whose 'node' member owns the element if it was not
+        // inserted.  The behavior is undefined unless 'node' is empty or uses
+        // the same allocator as this set.
+
+    iterator insert(const_iterator                            hint,
+                    BloombergLP::bslmf::MovableRef<node_type> node);
+        // Insert the element owned by the specified 'node' handle into this
+        // set (in amortized constant time if the specified 'hint' is a valid
+        // immediate successor to the key of the element), without copying,
+        // moving, or allocating, if 'node' is not empty and this set does not
+        // already contain an element whose key is equivalent to that of the
+        // element; 'node' is left empty if the element is inserted, and is not
+        // modified otherwise.  Return an iterator referring to the inserted
+        // element, to the element that prevented insertion, or 'end()' if
+        // 'node' is empty.  The behavior is undefined unless 'hint' is an
+        // iterator in the range '[begin() .. end()]' (both endpoints
+        // included), and 'node' is empty or uses the same allocator as this
+        // set.
+#endif
+
+    template <class OTHER_COMPARATOR>
+    void merge(set<KEY, OTHER_COMPARATOR, ALLOCATOR>& source);
+    template <class OTHER_COMPARATOR>
+    void merge(multiset<KEY, OTHER_COMPARATOR, ALLOCATOR>& source);
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+    template <class OTHER_COMPARATOR>
+    void merge(set<KEY, OTHER_COMPARATOR, ALLOCATOR>&& source);
+    template <class OTHER_COMPARATOR>
+    void merge(multiset<KEY, OTHER_COMPARATOR, ALLOCATOR>&& source);
+#endif
+        // Relink into this set each element of the specified 'source' whose
+        // key is not equivalent to that of an element of this set, leaving the
+        // other elements in 'source'.  The relinked elements are neither
+        // copied, moved, nor reallocated, and iterators and references to them
+        // remain valid, now referring into this set.  The behavior is
+        // undefined unless 'source.get_allocator() == get_allocator()'.  Note
+        // that memory is allocated only the first time this set exchanges
+        // elements with another container (see 'bslstl_simplepool').
+
     // Turn off complaints about necessarily class-defined methods.
     // BDE_VERIFY pragma: push
     // BDE_VERIFY pragma: -CD01
@@ -1953,6 +2041,45 @@ set<KEY, COMPARATOR, ALLOCATOR>::comparator()
     return d_compAndAlloc;
 }
 
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void set<KEY, COMPARATOR, ALLOCATOR>::mergeTree(
+                         BloombergLP::bslalg::RbTreeAnchor *sourceTree,
+                         NodeFactory&                       sourceNodeFactory)
+{
+    BSLS_ASSERT(nodeFactory().allocator() == sourceNodeFactory.allocator());
+
+    if (sourceTree == &d_tree || 0 == sourceTree->numNodes()) {
+        return;                                                       // RETURN
+    }
+
+    // Sharing the arena allocates (only) if neither pool has an arena yet, so
+    // it is done before any node is relinked.
+
+    nodeFactory().shareArena(sourceNodeFactory);
+
+    BloombergLP::bslalg::RbTreeNode *node = sourceTree->firstNode();
+    while (node != sourceTree->sentinel()) {
+        BloombergLP::bslalg::RbTreeNode *next =
+                                   BloombergLP::bslalg::RbTreeUtil::next(node);
+
+        int comparisonResult;
+        BloombergLP::bslalg::RbTreeNode *insertLocation =
+            BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                     &comparisonResult,
+                                     &d_tree,
+                                     this->comparator(),
+                                     static_cast<const Node *>(node)->value());
+        if (comparisonResult) {
+            BloombergLP::bslalg::RbTreeUtil::remove(sourceTree, node);
+            BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                                      insertLocation,
+                                                      comparisonResult < 0,
+                                                      node);
+        }
+        node = next;
+    }
+}
+
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
 void set<KEY, COMPARATOR, ALLOCATOR>::quickSwapExchangeAllocators(set& other)
@@ -3599,6 +3726,153 @@ void set<KEY, COMPARATOR, ALLOCATOR>::clear() BSLS_KEYWORD_NOEXCEPT
 #endif
 }
 
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename set<KEY, COMPARATOR, ALLOCATOR>::node_type
+set<KEY, COMPARATOR, ALLOCATOR>::extract(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    // Acquire the arena, which may allocate, before modifying the tree.
+
+    typename NodeFactory::Arena *arena = nodeFactory().acquireArena();
+
+    BloombergLP::bslalg::RbTreeNode *node =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(position.node());
+    BloombergLP::bslalg::RbTreeUtil::remove(&d_tree, node);
+    return node_type(static_cast<Node *>(node),
+                     arena,
+                     nodeFactory().allocator());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename set<KEY, COMPARATOR, ALLOCATOR>::node_type
+set<KEY, COMPARATOR, ALLOCATOR>::extract(const key_type& key)
+{
+    const_iterator position = find(key);
+    if (position == end()) {
+        return node_type();                                           // RETURN
+    }
+    return extract(position);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename set<KEY, COMPARATOR, ALLOCATOR>::insert_return_type
+set<KEY, COMPARATOR, ALLOCATOR>::insert(
+                                BloombergLP::bslmf::MovableRef<node_type> node)
+{
+    node_type& handle = node;
+
+    if (handle.empty()) {
+        insert_return_type result = { end(), false, node_type() };
+        return result;                                                // RETURN
+    }
+
+    BSLS_ASSERT(handle.get_allocator() == get_allocator());
+
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                   &comparisonResult,
+                                                   &d_tree,
+                                                   this->comparator(),
+                                                   handle.node()->value());
+    if (!comparisonResult) {
+        insert_return_type result = { iterator(insertLocation),
+                                      false,
+                                      MoveUtil::move(handle) };
+        return result;                                                // RETURN
+    }
+
+    nodeFactory().joinArena(handle.arena());
+
+    BloombergLP::bslalg::RbTreeNode *newNode = handle.release();
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              newNode);
+    insert_return_type result = { iterator(newNode), true, node_type() };
+    return result;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename set<KEY, COMPARATOR, ALLOCATOR>::iterator
+set<KEY, COMPARATOR, ALLOCATOR>::insert(
+                                const_iterator                            hint,
+                                BloombergLP::bslmf::MovableRef<node_type> node)
+{
+    node_type& handle = node;
+
+    if (handle.empty()) {
+        return end();                                                 // RETURN
+    }
+
+    BSLS_ASSERT(handle.get_allocator() == get_allocator());
+
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                    const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                   &comparisonResult,
+                                                   &d_tree,
+                                                   this->comparator(),
+                                                   handle.node()->value(),
+                                                   hintNode);
+    if (!comparisonResult) {
+        return iterator(insertLocation);                              // RETURN
+    }
+
+    nodeFactory().joinArena(handle.arena());
+
+    BloombergLP::bslalg::RbTreeNode *newNode = handle.release();
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              newNode);
+    return iterator(newNode);
+}
+#endif
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class OTHER_COMPARATOR>
+inline
+void set<KEY, COMPARATOR, ALLOCATOR>::merge(
+                                 set<KEY, OTHER_COMPARATOR, ALLOCATOR>& source)
+{
+    mergeTree(&source.d_tree, source.nodeFactory());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class OTHER_COMPARATOR>
+inline
+void set<KEY, COMPARATOR, ALLOCATOR>::merge(
+                            multiset<KEY, OTHER_COMPARATOR, ALLOCATOR>& source)
+{
+    mergeTree(&source.d_tree, source.nodeFactory());
+}
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class OTHER_COMPARATOR>
+inline
+void set<KEY, COMPARATOR, ALLOCATOR>::merge(
+                                set<KEY, OTHER_COMPARATOR, ALLOCATOR>&& source)
+{
+    mergeTree(&source.d_tree, source.nodeFactory());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class OTHER_COMPARATOR>
+inline
+void set<KEY, COMPARATOR, ALLOCATOR>::merge(
+                           multiset<KEY, OTHER_COMPARATOR, ALLOCATOR>&& source)
+{
+    mergeTree(&source.d_tree, source.nodeFactory());
+}
+#endif
+
 // ACCESSORS
 template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
@@ -4,6 +4,7 @@
 #include <bslstl_forwarditerator.h>
 #include <bslstl_iterator.h>
 #include <bslstl_map.h>
+#include <bslstl_multiset.h>
 #include <bslstl_pair.h>
 #include <bslstl_randomaccessiterator.h>
 #include <bslstl_set.h>
@@ -176,7 +177,7 @@
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [35] USAGE EXAMPLE
+// [37] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(set<T,A> *object, const char *spec, int verbose = 1);
@@ -196,6 +197,12 @@
 // [35] CONCERN: 'lower_bound' properly handles multi-value comparators.
 // [35] CONCERN: 'upper_bound' properly handles multi-value comparators.
 // [35] CONCERN: 'equal_range' properly handles multi-value comparators.
+// [36] node_type extract(const_iterator position);
+// [36] node_type extract(const key_type& key);
+// [36] insert_return_type insert(node_type&& node);
+// [36] iterator insert(const_iterator hint, node_type&& node);
+// [36] void merge(set<K, C2, A>& source);
+// [36] void merge(multiset<K, C2, A>& source);
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -7711,6 +7718,177 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
+      case 36: {
+        // --------------------------------------------------------------------
+        // TESTING NODE HANDLES AND 'merge'
+        //
+        // Concerns:
+        //: 1 'extract' unlinks an element and hands it to a node handle
+        //:   without copying, moving, or reallocating it.
+        //:
+        //: 2 Inserting a node handle relinks its element without allocating.
+        //:   A unique container leaves the handle owning an element that
+        //:   duplicates an element already present.
+        //:
+        //: 3 A node handle keeps its element valid after the source container
+        //:   is destroyed, and the element is destroyed and its memory
+        //:   reclaimed when the handle is destroyed.
+        //:
+        //: 4 'merge' relinks the elements of a container of the same kind, or
+        //:   of the counterpart kind, without copying or reallocating them,
+        //:   and leaves duplicates in the source.
+        //:
+        //: 5 Only the first exchange of elements between two containers
+        //:   allocates memory.
+        //:
+        //: 6 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Extract elements by key and by position, and verify the address
+        //:   of each extracted element and the sizes of the containers.
+        //:   (C-1)
+        //:
+        //: 2 Insert the handles into another container, with and without a
+        //:   hint, and verify the result and that no memory is allocated.
+        //:   (C-2)
+        //:
+        //: 3 Extract an element from a container that is then destroyed, and
+        //:   verify the value of the element owned by the handle.  (C-3)
+        //:
+        //: 4 Merge containers of both kinds into an object, and verify the
+        //:   sizes of both containers, the address of a relinked element, and
+        //:   the number of allocations.  (C-4..5)
+        //:
+        //: 5 Verify that all memory is returned to the allocator.  (C-6)
+        //
+        // Testing:
+        //   node_type extract(const_iterator position);
+        //   node_type extract(const key_type& key);
+        //   insert_return_type insert(node_type&& node);
+        //   iterator insert(const_iterator hint, node_type&& node);
+        //   void merge(set<K, C2, A>& source);
+        //   void merge(multiset<K, C2, A>& source);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING NODE HANDLES AND 'merge'"
+                            "\n================================\n");
+
+        typedef bsl::set<int>      Obj;
+        typedef bsl::multiset<int> OtherObj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        if (verbose) printf("\tTesting 'extract' and 'insert'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            Obj mY(&oa);  const Obj& Y = mY;
+
+            for (int i = 0; i < 8; ++i) {
+                mX.insert(i);
+                mY.insert(i + 4);
+            }
+
+            const int *ADDRESS = &*X.find(2);
+
+            Obj::node_type mN = mX.extract(2);  const Obj::node_type& N = mN;
+
+            ASSERT(!N.empty());
+            ASSERT(ADDRESS == &N.value());
+            ASSERT(7       == X.size());
+            ASSERT(X.end() == X.find(2));
+
+            ASSERT(N.get_allocator() == X.get_allocator());
+            ASSERT(mX.extract(100).empty());
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            Obj::insert_return_type result = mY.insert(MoveUtil::move(mN));
+
+            ASSERT(N.empty());
+            ASSERT(result.inserted);
+            ASSERT(result.node.empty());
+            ASSERT(ADDRESS == &*result.position);
+            ASSERT(9       == Y.size());
+
+            mN = mX.extract(X.find(5));
+
+            Obj::insert_return_type duplicate = mY.insert(MoveUtil::move(mN));
+
+            ASSERT(!duplicate.inserted);
+            ASSERT(Y.find(5) == duplicate.position);
+            ASSERT(5         == duplicate.node.value());
+            ASSERT(9         == Y.size());
+
+            Obj::iterator it = mX.insert(X.begin(),
+                                         MoveUtil::move(duplicate.node));
+
+            ASSERT(duplicate.node.empty());
+            ASSERT(X.find(5) == it);
+            ASSERT(7         == X.size());
+
+            ASSERT(NUM_ALLOCATIONS == oa.numAllocations());
+
+            {
+                Obj mZ(&oa);
+                mZ.insert(100);
+                mN = mZ.extract(mZ.begin());
+            }
+            ASSERT(100 == N.value());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+#endif
+
+        if (verbose) printf("\tTesting 'merge'.\n");
+        {
+            Obj      mX(&oa);  const Obj&      X = mX;
+            Obj      mY(&oa);  const Obj&      Y = mY;
+            OtherObj mZ(&oa);  const OtherObj& Z = mZ;
+
+            for (int i = 0; i < 8; ++i) {
+                mX.insert(i);
+                mY.insert(i + 4);
+                mZ.insert(i % 4);
+            }
+
+            const int *ADDRESS = &*Y.find(11);
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            mX.merge(mY);
+
+            ASSERT(12      == X.size());
+            ASSERT(4       == Y.size());
+            ASSERT(ADDRESS == &*X.find(11));
+
+            mX.merge(mZ);
+
+            ASSERT(12 == X.size());
+            ASSERT(8  == Z.size());
+
+            mX.merge(mX);
+
+            ASSERT(12 == X.size());
+
+            // Only sharing the first arena allocated.
+
+            ASSERT(NUM_ALLOCATIONS + 1 == oa.numAllocations());
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+            OtherObj mW(&oa);  const OtherObj& W = mW;
+            mW.insert(100);
+
+            mX.merge(bslmf::MovableRefUtil::move(mW));
+
+            ASSERT(13 == X.size());
+            ASSERT(0  == W.size());
+            ASSERT(1  == X.count(100));
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
       case 35: {
         // --------------------------------------------------------------------
         // TESTING TRANSPARENT COMPARATORS WITH MULTI-VALUE EQUAL RANGES
@@ -4,6 +4,82 @@
 #include <bsls_ident.h>
 BSLS_IDENT("$Id$ $CSID$")
 
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bslstl {
+
+                       // -----------------------
+                       // struct SimplePool_Arena
+                       // -----------------------
+
+// CLASS METHODS
+SimplePool_Arena *SimplePool_Arena::lockRoot(SimplePool_Arena *arena)
+{
+    BSLS_ASSERT_SAFE(arena);
+
+    // 'd_forward_p' of an arena is set only while its lock is held, so a
+    // locked arena having no 'd_forward_p' is a root.  Otherwise, the arena
+    // was merged between the two steps, and the search is repeated.
+
+    for (;;) {
+        SimplePool_Arena *candidate = root(arena);
+        candidate->d_lock.lock();
+        if (!candidate->d_forward_p) {
+            return candidate;                                         // RETURN
+        }
+        candidate->d_lock.unlock();
+    }
+}
+
+void SimplePool_Arena::lockRoots(SimplePool_Arena **first,
+                                 SimplePool_Arena **second)
+{
+    BSLS_ASSERT_SAFE(first);
+    BSLS_ASSERT_SAFE(*first);
+    BSLS_ASSERT_SAFE(second);
+    BSLS_ASSERT_SAFE(*second);
+
+    for (;;) {
+        SimplePool_Arena *firstRoot  = root(*first);
+        SimplePool_Arena *secondRoot = root(*second);
+
+        if (firstRoot == secondRoot) {
+            firstRoot->d_lock.lock();
+            if (!firstRoot->d_forward_p) {
+                *first  = firstRoot;
+                *second = firstRoot;
+                return;                                               // RETURN
+            }
+            firstRoot->d_lock.unlock();
+            continue;
+        }
+
+        // Lock in order of address, so that two threads merging the same two
+        // groups in opposite directions cannot deadlock.
+
+        const bool firstIsLower =
+                         reinterpret_cast<bsls::Types::UintPtr>(firstRoot)
+                       < reinterpret_cast<bsls::Types::UintPtr>(secondRoot);
+
+        SimplePool_Arena *lower  = firstIsLower ? firstRoot  : secondRoot;
+        SimplePool_Arena *higher = firstIsLower ? secondRoot : firstRoot;
+        lower->d_lock.lock();
+        higher->d_lock.lock();
+        if (!lower->d_forward_p && !higher->d_forward_p) {
+            *first  = firstRoot;
+            *second = secondRoot;
+            return;                                                   // RETURN
+        }
+        higher->d_lock.unlock();
+        lower->d_lock.unlock();
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
 // ----------------------------------------------------------------------------
 // Copyright 2019 Bloomberg Finance L.P.
 //
@@ -9,6 +9,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bslstl::SimplePool: memory manager that allocates memory blocks for a type
+//  bslstl::SimplePool_Arena: memory jointly owned by pools sharing blocks
 //
 //@SEE_ALSO: bslstl_treenodepool, bdema_pool
 //
@@ -40,6 +41,35 @@ BSLS_IDENT("$Id: $")
 // each time a chunk is allocated up to an implementation defined maximum
 // number of blocks.
 //
+///Sharing Blocks Between Pools
+///----------------------------
+// A block is normally deallocated only into the pool that allocated it,
+// because a pool returns all of its chunks to the allocator when it is
+// destroyed.  Node-based containers that relink nodes into other containers
+// (see 'bslstl_nodehandle') need a block to remain valid after the pool that
+// allocated it is gone.  To that end, pools that exchange blocks join a
+// reference-counted 'SimplePool_Arena'.  A pool that belongs to an arena
+// donates its chunks to the arena, instead of deallocating them, when it is
+// released, and the arena deallocates every chunk donated to it when the last
+// pool or block owner that refers to it releases its reference.
+//
+// 'acquireArena' returns the arena of a pool (creating it on first use) with
+// an added reference, which is held by the owner of a block that has left the
+// pool.  'joinArena' makes a pool a member of the same arena, after which
+// blocks allocated by any member may be deallocated into it.
+// 'releaseArena' releases a reference, optionally handing a block back to the
+// arena for reuse by its members.  'shareArena' makes two pools members of
+// the same arena directly.
+//
+// Each arena carries its own lock, and only the root of a group of merged
+// arenas is ever locked, so pools (and the containers built on them) that do
+// not share an arena never contend with one another.  A pool takes a lock
+// only when it replenishes from, donates to, or merges arenas, and never on
+// the 'allocate' and 'deallocate' fast paths.
+//
+// Pools that never exchange blocks never create an arena, and pay nothing for
+// this facility beyond the 'd_arena_p' pointer, which remains 0.
+//
 ///Comparison with 'bdema_Pool'
 ///----------------------------
 // There are a few differences between 'bslstl::SimplePool' and 'bdema_Pool':
@@ -207,9 +237,12 @@ BSL_OVERRIDES_STD mode"
 #include <bsls_alignmentfromtype.h>
 #include <bsls_alignmentutil.h>
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_platform.h>
+#include <bsls_spinlock.h>
 
 #include <algorithm>  // swap (C++03)
+#include <new>        // placement 'new'
 #include <utility>    // swap (C++17)
 
 namespace BloombergLP {
@@ -236,6 +269,69 @@ struct SimplePool_Type {
         // 'bsls::AlignmentUtil::MaxAlignedType'.
 };
 
+                       // =======================
+                       // struct SimplePool_Arena
+                       // =======================
+
+struct SimplePool_Arena {
+    // For use only by 'bslstl::SimplePool' and the node handles built on it.
+    // This 'struct' holds the memory owned jointly by a group of 'SimplePool'
+    // objects that have exchanged blocks.  Each arena is reference counted
+    // and, once merged into another arena, refers to that arena through
+    // 'd_forward_p', so that the arenas of a group form a tree in which only
+    // the root holds donated chunks and orphaned blocks.  The lists of an
+    // arena are accessed, and its 'd_forward_p' is set, only while its
+    // 'd_lock' is held, so an arena that is locked and has no 'd_forward_p'
+    // is a root and remains one until it is unlocked.
+
+    // DATA
+    bsls::SpinLock         d_lock;          // guards the lists of this arena,
+                                            // and the setting of
+                                            // 'd_forward_p'
+
+    bsls::AtomicInt        d_refCount;      // number of pools, block owners,
+                                            // and merged arenas referring to
+                                            // this arena
+
+    bsls::AtomicPointer<SimplePool_Arena>
+                           d_forward_p;     // arena this arena was merged
+                                            // into, or 0 for a root
+
+    void                  *d_chunkList_p;   // chunks donated by released
+                                            // pools
+
+    void                  *d_orphanList_p;  // free blocks available to any
+                                            // member pool
+
+    // CLASS METHODS
+    static SimplePool_Arena *lockRoot(SimplePool_Arena *arena);
+        // Lock the root of the tree of arenas containing the specified
+        // 'arena', and return its address.  The caller is responsible for
+        // unlocking the returned arena.  The behavior is undefined unless
+        // the calling thread holds a reference to 'arena' and does not hold
+        // the lock of any arena.
+
+    static void lockRoots(SimplePool_Arena **first,
+                          SimplePool_Arena **second);
+        // Lock the roots of the trees of arenas containing the specified
+        // '*first' and '*second' arenas, and load the addresses of those
+        // roots into 'first' and 'second' respectively.  If both arenas
+        // belong to the same tree, its root is locked once; otherwise the two
+        // roots are locked in order of address.  The caller is responsible
+        // for unlocking each distinct root.  The behavior is undefined
+        // unless the calling thread holds a reference to both arenas and does
+        // not hold the lock of any arena.
+
+    static SimplePool_Arena *root(SimplePool_Arena *arena);
+        // Return the address of the root of the tree of arenas containing the
+        // specified 'arena'.  Note that, unless its lock is held, the
+        // returned arena may be merged into another arena at any time.
+
+    // CREATORS
+    SimplePool_Arena();
+        // Create an empty root arena having a reference count of 1.
+};
+
                        // ================
                        // class SimplePool
                        // ================
@@ -280,6 +376,15 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
                           // ensure each block is correctly aligned
     };
 
+    enum {
+        // Number of max-aligned objects occupied by a 'SimplePool_Arena'.
+
+        k_ARENA_NUM_MAX_ALIGNED_TYPE =
+            (sizeof(SimplePool_Arena) + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT
+                                                                          - 1)
+                                      / bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT
+    };
+
   public:
     // TYPES
     typedef VALUE ValueType;
@@ -295,6 +400,9 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
 
     typedef typename AllocatorTraits::size_type size_type;
 
+    typedef SimplePool_Arena Arena;
+        // Alias for the memory shared by pools that exchange blocks.
+
   private:
     // DATA
     Chunk *d_chunkList_p;     // linked list of "chunks" of memory
@@ -303,6 +411,9 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
 
     int    d_blocksPerChunk;  // current chunk size (in blocks-per-chunk)
 
+    Arena *d_arena_p;         // arena shared with pools with which blocks
+                              // have been exchanged (held reference), or 0
+
   private:
     // NOT IMPLEMENTED
     SimplePool& operator=(bslmf::MovableRef<SimplePool>);
@@ -319,9 +430,32 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
     void replenish();
         // Dynamically allocate a new chunk using the pool's underlying growth
         // strategy, and use the chunk to replenish the free memory list of
-        // this pool.
+        // this pool.  If this pool belongs to an arena holding orphaned
+        // blocks, take those blocks instead.
+
+    // PRIVATE CLASS METHODS
+    static void donate(Arena *root, Chunk *chunkList, Block *blockList);
+        // Prepend the specified 'chunkList' and 'blockList' to the respective
+        // chunk and orphaned block lists of the specified 'root' arena.  The
+        // behavior is undefined unless the calling thread holds the lock of
+        // 'root' and 'root' is the root of its tree of arenas.
 
   public:
+    // CLASS METHODS
+    static void releaseArena(Arena         *arena,
+                             void          *block,
+                             AllocatorType& allocator);
+        // Release a reference to the specified 'arena', first handing the
+        // specified 'block', if not 0, back to 'arena' for reuse by the pools
+        // belonging to it.  If that was the last reference, deallocate every
+        // chunk donated to 'arena', and 'arena' itself, using the specified
+        // 'allocator', and release the reference 'arena' holds to the arena
+        // it was merged into, if any.  The behavior is undefined unless the
+        // caller holds a reference to 'arena', 'block' (if not 0) was
+        // allocated by a pool belonging to 'arena' and is not in use, and
+        // 'allocator' compares equal to the allocator of those pools.
+
+
     // CREATORS
     explicit SimplePool(const ALLOCATOR& allocator);
         // Create a memory pool that returns blocks of contiguous memory of the
@@ -344,6 +478,28 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
         // underlying allocator.
 
     // MANIPULATORS
+    Arena *acquireArena();
+        // Return the address of the arena this pool belongs to, creating one
+        // if this pool does not belong to an arena, with a reference added on
+        // behalf of the caller.  Blocks allocated by this pool remain valid
+        // until that reference is released (see 'releaseArena'), even if this
+        // pool is destroyed first.
+
+    void joinArena(Arena *arena);
+        // Make this pool a member of the same group as the specified 'arena',
+        // so that blocks allocated by a pool belonging to 'arena' may be
+        // deallocated into this pool, and blocks allocated by this pool
+        // remain valid as long as that group is referenced.  This method does
+        // not allocate memory.  The behavior is undefined unless the caller
+        // holds a reference to 'arena', and the allocator of this pool
+        // compares equal to the allocator of the pools belonging to 'arena'.
+
+    void shareArena(SimplePool& other);
+        // Make this pool and the specified 'other' pool members of the same
+        // group, creating an arena if neither belongs to one, so that blocks
+        // allocated by either pool may be deallocated into the other.  The
+        // behavior is undefined unless 'allocator() == other.allocator()'.
+
     void adopt(bslmf::MovableRef<SimplePool> pool);
         // Adopt all outstanding memory allocations associated with the
         // specfied memory 'pool'.  The behavior is undefined unless this pool
@@ -374,7 +530,10 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
         // unless '0 < numBlocks'.
 
     void release();
-        // Relinquish all memory currently allocated via this pool object.
+        // Relinquish all memory currently allocated via this pool object.  If
+        // this pool belongs to an arena, donate its chunks and free blocks to
+        // that arena (which releases them with its last reference) and leave
+        // the arena.
 
     void swap(SimplePool& other);
         // Efficiently exchange the memory blocks of this object with those of
@@ -408,6 +567,37 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
 //                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
 // ============================================================================
 
+                       // -----------------------
+                       // struct SimplePool_Arena
+                       // -----------------------
+
+// CLASS METHODS
+inline
+SimplePool_Arena *SimplePool_Arena::root(SimplePool_Arena *arena)
+{
+    BSLS_ASSERT_SAFE(arena);
+
+    while (SimplePool_Arena *forward = arena->d_forward_p) {
+        arena = forward;
+    }
+    return arena;
+}
+
+// CREATORS
+inline
+SimplePool_Arena::SimplePool_Arena()
+: d_lock(bsls::SpinLock::s_unlocked)
+, d_refCount(1)
+, d_forward_p(0)
+, d_chunkList_p(0)
+, d_orphanList_p(0)
+{
+}
+
+                       // ----------------
+                       // class SimplePool
+                       // ----------------
+
 // PRIVATE MANIPULATORS
 template <class VALUE, class ALLOCATOR>
 typename SimplePool<VALUE, ALLOCATOR>::Block *
@@ -437,6 +627,18 @@ template <class VALUE, class ALLOCATOR>
 inline
 void SimplePool<VALUE, ALLOCATOR>::replenish()
 {
+    if (d_arena_p) {
+        Arena *root = Arena::lockRoot(d_arena_p);
+
+        d_freeList_p         = static_cast<Block *>(root->d_orphanList_p);
+        root->d_orphanList_p = 0;
+        root->d_lock.unlock();
+
+        if (d_freeList_p) {
+            return;                                                   // RETURN
+        }
+    }
+
     reserve(d_blocksPerChunk);
 
     enum { MAX_BLOCKS_PER_CHUNK = 32 };
@@ -446,6 +648,87 @@ void SimplePool<VALUE, ALLOCATOR>::replenish()
     }
 }
 
+// PRIVATE CLASS METHODS
+template <class VALUE, class ALLOCATOR>
+void SimplePool<VALUE, ALLOCATOR>::donate(Arena *root,
+                                          Chunk *chunkList,
+                                          Block *blockList)
+{
+    BSLS_ASSERT_SAFE(root);
+    BSLS_ASSERT_SAFE(!root->d_forward_p);
+
+    if (chunkList) {
+        Chunk *last = chunkList;
+        while (last->d_next_p) {
+            last = last->d_next_p;
+        }
+        last->d_next_p      = static_cast<Chunk *>(root->d_chunkList_p);
+        root->d_chunkList_p = chunkList;
+    }
+
+    if (blockList) {
+        Block *last = blockList;
+        while (last->d_next_p) {
+            last = last->d_next_p;
+        }
+        last->d_next_p       = static_cast<Block *>(root->d_orphanList_p);
+        root->d_orphanList_p = blockList;
+    }
+}
+
+// CLASS METHODS
+template <class VALUE, class ALLOCATOR>
+void SimplePool<VALUE, ALLOCATOR>::releaseArena(Arena         *arena,
+                                                void          *block,
+                                                AllocatorType& allocator)
+{
+    BSLS_ASSERT(arena);
+
+    if (block) {
+        Block *orphan = static_cast<Block *>(block);
+        orphan->d_next_p = 0;
+
+        Arena *root = Arena::lockRoot(arena);
+        donate(root, 0, orphan);
+        root->d_lock.unlock();
+    }
+
+    // The chunks, like those in 'release', were allocated as arrays of the
+    // max-aligned type.
+
+#ifdef BSLS_PLATFORM_HAS_PRAGMA_GCC_DIAGNOSTIC
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-align"
+#endif
+
+    // A reference count of zero means that no pool, block owner, or arena
+    // refers to 'arena', so it can no longer be reached by another thread.
+
+    while (arena && 0 == --arena->d_refCount) {
+        Chunk *chunk = static_cast<Chunk *>(arena->d_chunkList_p);
+        while (chunk) {
+            typename AllocatorTraits::value_type *lastChunk =
+                      reinterpret_cast<typename AllocatorTraits::value_type *>(
+                                                                        chunk);
+            chunk = chunk->d_next_p;
+            AllocatorTraits::deallocate(allocator, lastChunk, 1);
+        }
+
+        Arena *forward = arena->d_forward_p;
+        arena->~Arena();
+        AllocatorTraits::deallocate(
+                      allocator,
+                      reinterpret_cast<typename AllocatorTraits::value_type *>(
+                                                                        arena),
+                      k_ARENA_NUM_MAX_ALIGNED_TYPE);
+        arena = forward;
+    }
+
+#ifdef BSLS_PLATFORM_HAS_PRAGMA_GCC_DIAGNOSTIC
+#pragma GCC diagnostic pop
+#endif
+}
+
 // CREATORS
 template <class VALUE, class ALLOCATOR>
 inline
@@ -454,6 +737,7 @@ SimplePool<VALUE, ALLOCATOR>::SimplePool(const ALLOCATOR& allocator)
 , d_chunkList_p(0)
 , d_freeList_p(0)
 , d_blocksPerChunk(1)
+, d_arena_p(0)
 {
 }
 
@@ -465,11 +749,13 @@ SimplePool<VALUE, ALLOCATOR>::SimplePool(
 , d_chunkList_p(bslmf::MovableRefUtil::access(original).d_chunkList_p)
 , d_freeList_p(bslmf::MovableRefUtil::access(original).d_freeList_p)
 , d_blocksPerChunk(bslmf::MovableRefUtil::access(original).d_blocksPerChunk)
+, d_arena_p(bslmf::MovableRefUtil::access(original).d_arena_p)
 {
     SimplePool& lvalue = original;
     lvalue.d_chunkList_p = 0;
     lvalue.d_freeList_p = 0;
     lvalue.d_blocksPerChunk = 1;
+    lvalue.d_arena_p = 0;
 }
 
 template <class VALUE, class ALLOCATOR>
@@ -480,6 +766,83 @@ SimplePool<VALUE, ALLOCATOR>::~SimplePool()
 }
 
 // MANIPULATORS
+template <class VALUE, class ALLOCATOR>
+typename SimplePool<VALUE, ALLOCATOR>::Arena *
+SimplePool<VALUE, ALLOCATOR>::acquireArena()
+{
+    if (!d_arena_p) {
+        void *memory = AllocatorTraits::allocate(allocator(),
+                                                 k_ARENA_NUM_MAX_ALIGNED_TYPE);
+        d_arena_p = ::new (memory) Arena();
+    }
+
+    ++d_arena_p->d_refCount;
+    return d_arena_p;
+}
+
+template <class VALUE, class ALLOCATOR>
+void SimplePool<VALUE, ALLOCATOR>::joinArena(Arena *arena)
+{
+    BSLS_ASSERT(arena);
+
+    if (d_arena_p == arena) {
+        return;                                                       // RETURN
+    }
+
+    Arena *previous = d_arena_p;
+
+    if (!previous) {
+        // The reference held by the caller keeps every arena between 'arena'
+        // and its root alive, so no lock is needed to join the group.
+
+        d_arena_p = Arena::root(arena);
+        ++d_arena_p->d_refCount;
+        return;                                                       // RETURN
+    }
+
+    Arena *root    = arena;
+    Arena *ownRoot = previous;
+    Arena::lockRoots(&root, &ownRoot);
+
+    if (ownRoot != root) {
+        // Merge the group of this pool into that of 'arena'.  The merged root
+        // keeps a reference to its new root.
+
+        donate(root,
+               static_cast<Chunk *>(ownRoot->d_chunkList_p),
+               static_cast<Block *>(ownRoot->d_orphanList_p));
+        ownRoot->d_chunkList_p  = 0;
+        ownRoot->d_orphanList_p = 0;
+        ownRoot->d_forward_p    = root;
+        ++root->d_refCount;
+        ownRoot->d_lock.unlock();
+    }
+
+    ++root->d_refCount;
+    d_arena_p = root;
+    root->d_lock.unlock();
+
+    releaseArena(previous, 0, allocator());
+}
+
+template <class VALUE, class ALLOCATOR>
+void SimplePool<VALUE, ALLOCATOR>::shareArena(SimplePool& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    if (d_arena_p) {
+        other.joinArena(d_arena_p);
+    }
+    else if (other.d_arena_p) {
+        joinArena(other.d_arena_p);
+    }
+    else {
+        Arena *arena = acquireArena();
+        other.joinArena(arena);
+        releaseArena(arena, 0, allocator());
+    }
+}
+
 template <class VALUE, class ALLOCATOR>
 inline
 void
@@ -487,6 +850,7 @@ SimplePool<VALUE, ALLOCATOR>::adopt(bslmf::MovableRef<SimplePool> pool)
 {
     BSLS_ASSERT_SAFE(0 == d_chunkList_p);
     BSLS_ASSERT_SAFE(0 == d_freeList_p);
+    BSLS_ASSERT_SAFE(0 == d_arena_p);
     BSLS_ASSERT_SAFE(allocator()
                            == bslmf::MovableRefUtil::access(pool).allocator());
 
@@ -494,10 +858,12 @@ SimplePool<VALUE, ALLOCATOR>::adopt(bslmf::MovableRef<SimplePool> pool)
     d_chunkList_p = lvalue.d_chunkList_p;
     d_freeList_p = lvalue.d_freeList_p;
     d_blocksPerChunk = lvalue.d_blocksPerChunk;
+    d_arena_p = lvalue.d_arena_p;
 
     lvalue.d_chunkList_p = 0;
     lvalue.d_freeList_p = 0;
     lvalue.d_blocksPerChunk = 1;
+    lvalue.d_arena_p = 0;
 }
 
 template <class VALUE, class ALLOCATOR>
@@ -539,6 +905,7 @@ void SimplePool<VALUE, ALLOCATOR>::swap(SimplePool<VALUE, ALLOCATOR>& other)
     std::swap(d_blocksPerChunk, other.d_blocksPerChunk);
     std::swap(d_freeList_p, other.d_freeList_p);
     std::swap(d_chunkList_p, other.d_chunkList_p);
+    std::swap(d_arena_p, other.d_arena_p);
 }
 
 template <class VALUE, class ALLOCATOR>
@@ -559,6 +926,7 @@ void SimplePool<VALUE, ALLOCATOR>::quickSwapExchangeAllocators(
     swap(d_blocksPerChunk,  other.d_blocksPerChunk);
     swap(d_freeList_p,      other.d_freeList_p);
     swap(d_chunkList_p,     other.d_chunkList_p);
+    swap(d_arena_p,         other.d_arena_p);
 }
 
 template <class VALUE, class ALLOCATOR>
@@ -580,6 +948,19 @@ void SimplePool<VALUE, ALLOCATOR>::reserve(size_type numBlocks)
 template <class VALUE, class ALLOCATOR>
 void SimplePool<VALUE, ALLOCATOR>::release()
 {
+    if (d_arena_p) {
+        Arena *root = Arena::lockRoot(d_arena_p);
+        donate(root, d_chunkList_p, d_freeList_p);
+        root->d_lock.unlock();
+
+        releaseArena(d_arena_p, 0, allocator());
+
+        d_arena_p     = 0;
+        d_chunkList_p = 0;
+        d_freeList_p  = 0;
+        return;                                                       // RETURN
+    }
+
     // The values in 'd_chunkList_p' are allocated using
     // 'AllocatorTraits::allocate' for max-aligned type (see
     // 'allocateChunk'). Casting from 'Chunk *' back to that type
@@ -37,6 +37,10 @@ using namespace bslstl;
 // memory blocks from a memory pool.  The main concerns are memory is allocated
 // only when expected and the allocated memory is aligned correctly
 //-----------------------------------------------------------------------------
+// CLASS METHODS
+// [15] SimplePool_Arena::lockRoots(Arena **first, Arena **second);
+// [14] static void releaseArena(Arena *, void *, AllocatorType&);
+//
 // CREATORS
 // [ 2] explicit SimplePool(const ALLOCATOR& allocator);
 // [10] explicit SimplePool(MovableRef<SimplePool> original);
@@ -44,6 +48,9 @@ using namespace bslstl;
 //
 // MANIPULATORS
 // [11] SimplePool& operator=(MovableRef<SimplePool> rhs);
+// [14] Arena *acquireArena();
+// [14] void joinArena(Arena *arena);
+// [14] void shareArena(SimplePool& other);
 // [ 4] AllocatorType& allocator();
 // [ 2] VALUE *allocate();
 // [ 5] void deallocate(void *address);
@@ -59,6 +66,8 @@ using namespace bslstl;
 // [12] USAGE EXAMPLE
 // [ 9] CONCERN: Standard allocator can be used
 // [ 3] TEST APPARATUS
+// [14] CONCERN: Released pools donate their memory to their arena.
+// [14] CONCERN: Blocks can move between pools, as node handles do.
 
 //=============================================================================
 //                  STANDARD BDE ASSERT TEST MACRO
@@ -260,6 +269,12 @@ class TestDriver {
 
   public:
     // TEST CASES
+    static void testCase15();
+        // Test 'SimplePool_Arena::lockRoots'.
+
+    static void testCase14();
+        // Test sharing blocks between pools.
+
     static void testCase13();
         // Test other accessors.
 
@@ -354,6 +369,313 @@ void TestDriver<VALUE>::createFreeBlocks(Obj *result, int numBlocks)
     }
 }
 
+template<class VALUE>
+void TestDriver<VALUE>::testCase15()
+{
+    // ------------------------------------------------------------------------
+    // 'SimplePool_Arena::lockRoots'
+    //
+    // Concerns:
+    //: 1 'lockRoots' loads the roots of the arenas of its arguments into the
+    //:   corresponding arguments, whatever the order of their addresses.
+    //:
+    //: 2 If the arenas are distinct roots, both are left locked.
+    //:
+    //: 3 If both arenas belong to the same tree (as do those of two pools
+    //:   sharing an arena, or of two groups that were merged), its root is
+    //:   loaded into both arguments and locked exactly once, so that the
+    //:   caller does not deadlock and a single 'unlock' releases it.
+    //
+    // Plan:
+    //: 1 Create two pools in distinct arenas, and call 'lockRoots' with the
+    //:   arenas in both orders.  Verify the loaded roots, and that each root
+    //:   is locked (using 'tryLock'), then unlock both.  (C-1..2)
+    //:
+    //: 2 Make the two pools share an arena, merging the arena of one into
+    //:   that of the other.  Call 'lockRoots' with every combination of the
+    //:   two arenas, and verify that the root is loaded into both arguments,
+    //:   and that, after one 'unlock', it is no longer locked.  (C-3)
+    //
+    // Testing:
+    //   SimplePool_Arena::lockRoots(Arena **first, Arena **second);
+    // ------------------------------------------------------------------------
+
+    if (verbose) printf("\n'SimplePool_Arena::lockRoots'"
+                        "\n=============================\n");
+
+    typedef typename Obj::Arena Arena;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+    {
+        Obj mX(&oa);
+        Obj mY(&oa);
+
+        Arena *arenaX = mX.acquireArena();
+        Arena *arenaY = mY.acquireArena();
+        ASSERT(arenaX != arenaY);
+
+        if (verbose) printf("\nDistinct roots.\n");
+
+        for (int order = 0; order < 2; ++order) {
+            Arena *first  = order ? arenaY : arenaX;
+            Arena *second = order ? arenaX : arenaY;
+
+            Arena *firstRoot  = first;
+            Arena *secondRoot = second;
+            Arena::lockRoots(&firstRoot, &secondRoot);
+
+            ASSERTV(order, first  == firstRoot);
+            ASSERTV(order, second == secondRoot);
+            ASSERTV(order, 0 != firstRoot->d_lock.tryLock());
+            ASSERTV(order, 0 != secondRoot->d_lock.tryLock());
+
+            firstRoot->d_lock.unlock();
+            secondRoot->d_lock.unlock();
+        }
+
+        if (verbose) printf("\nShared root.\n");
+
+        mX.shareArena(mY);
+
+        Arena *root = Arena::root(arenaX);
+        ASSERT(root == Arena::root(arenaY));
+        ASSERT(root == arenaX || root == arenaY);
+
+        for (int order = 0; order < 4; ++order) {
+            Arena *firstRoot  = order & 1 ? arenaY : arenaX;
+            Arena *secondRoot = order & 2 ? arenaY : arenaX;
+            Arena::lockRoots(&firstRoot, &secondRoot);
+
+            ASSERTV(order, root == firstRoot);
+            ASSERTV(order, root == secondRoot);
+            ASSERTV(order, 0 != root->d_lock.tryLock());
+
+            root->d_lock.unlock();
+
+            ASSERTV(order, 0 == root->d_lock.tryLock());
+            root->d_lock.unlock();
+        }
+
+        Obj::releaseArena(arenaX, 0, mX.allocator());
+        Obj::releaseArena(arenaY, 0, mY.allocator());
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+}
+
+template<class VALUE>
+void TestDriver<VALUE>::testCase14()
+{
+    // ------------------------------------------------------------------------
+    // SHARING BLOCKS BETWEEN POOLS
+    //
+    // Concerns:
+    //: 1 'shareArena' allocates a single arena for two pools belonging to
+    //:   none, and nothing if they already share one.
+    //:
+    //: 2 A block allocated by one pool can be deallocated into another pool
+    //:   sharing its arena, and is then reused by that pool.
+    //:
+    //: 3 A pool belonging to an arena donates its chunks to the arena when
+    //:   it is released, so that its blocks held by other members remain
+    //:   valid, and all memory is returned when the last member is gone.
+    //:
+    //: 4 A block handed back to an arena by 'releaseArena' is reused by the
+    //:   next member pool that replenishes, without allocating.
+    //:
+    //: 5 A block whose owner holds a reference to the arena of its pool (as
+    //:   does a node handle) remains valid after that pool is destroyed, and
+    //:   may be deallocated into a pool that joins the arena (as does a
+    //:   container into which the node handle is inserted).
+    //:
+    //: 6 Joining the arena of another group merges the two groups, so that
+    //:   blocks can be exchanged between any of their members, and all memory
+    //:   is returned when every member of both groups is gone.
+    //
+    // Plan:
+    //: 1 Make two pools share an arena, and verify the number of blocks in
+    //:   use in the object allocator before and after, and after sharing
+    //:   again.  (C-1)
+    //:
+    //: 2 Allocate a block from one pool and deallocate it into the other, and
+    //:   verify that the other pool returns it from 'allocate' without
+    //:   allocating.  Release the allocating pool, write to the block, and
+    //:   destroy the other pool, verifying the memory in use at each step.
+    //:   (C-2..3)
+    //:
+    //: 3 Acquire a reference to the arena of two sharing pools, hand a block
+    //:   allocated by one back through 'releaseArena', and verify that the
+    //:   other pool, having no free block, returns it from 'allocate' without
+    //:   allocating.  (C-4)
+    //:
+    //: 4 Allocate a block from a pool, acquire a reference to its arena, and
+    //:   destroy the pool.  Write to the block, make another pool join the
+    //:   arena, release the reference, and deallocate the block into that
+    //:   pool; verify that the block is reused, and that all memory is
+    //:   returned.  Repeat, moving the block between two pools that already
+    //:   share an arena.  (C-5)
+    //:
+    //: 5 Create two groups of two pools, and allocate a block from a member
+    //:   of each.  Make a member of one group join the arena of the other,
+    //:   and deallocate each block into a member of the other group.  Destroy
+    //:   the allocating pools first, and verify that all memory is returned
+    //:   once every pool is destroyed.  (C-6)
+    //
+    // Testing:
+    //   Arena *acquireArena();
+    //   void joinArena(Arena *arena);
+    //   void shareArena(SimplePool& other);
+    //   static void releaseArena(Arena *, void *, AllocatorType&);
+    //   CONCERN: Released pools donate their memory to their arena.
+    //   CONCERN: Blocks can move between pools, as node handles do.
+    // ------------------------------------------------------------------------
+
+    if (verbose) printf("\nSHARING BLOCKS BETWEEN POOLS"
+                        "\n============================\n");
+
+    typedef typename Obj::Arena Arena;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    if (verbose) printf("\nSharing an arena, and donating on release.\n");
+    {
+        Obj mX(&oa);
+        Obj mY(&oa);
+
+        VALUE *block = mX.allocate();
+
+        const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+        mX.shareArena(mY);
+        ASSERTV(oa.numBlocksInUse(), NUM_BLOCKS + 1 == oa.numBlocksInUse());
+
+        mY.shareArena(mX);
+        mX.shareArena(mY);
+        ASSERTV(oa.numBlocksInUse(), NUM_BLOCKS + 1 == oa.numBlocksInUse());
+
+        ASSERT(!mY.hasFreeBlocks());
+
+        mY.deallocate(block);
+        ASSERT(mY.hasFreeBlocks());
+        ASSERT(block == mY.allocate());
+        ASSERTV(oa.numBlocksInUse(), NUM_BLOCKS + 1 == oa.numBlocksInUse());
+
+        mX.release();
+        ASSERTV(oa.numBlocksInUse(), NUM_BLOCKS + 1 == oa.numBlocksInUse());
+
+        memset(static_cast<void *>(block), 0xa5, sizeof(VALUE));
+        mY.deallocate(block);
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (verbose) printf("\nReusing orphaned blocks.\n");
+    {
+        Obj mX(&oa);
+        Obj mY(&oa);
+        mX.shareArena(mY);
+
+        VALUE *block = mX.allocate();
+        ASSERT(!mX.hasFreeBlocks());
+
+        Arena *arena = mX.acquireArena();
+        Obj::releaseArena(arena, block, mX.allocator());
+
+        const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+        ASSERT(!mY.hasFreeBlocks());
+        ASSERT(block == mY.allocate());
+        ASSERTV(oa.numBlocksInUse(), NUM_BLOCKS == oa.numBlocksInUse());
+
+        mY.deallocate(block);
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (verbose) printf("\nMoving a block to a pool joining its arena.\n");
+    {
+        Obj    mY(&oa);
+        VALUE *block;
+        Arena *arena;
+        {
+            Obj mX(&oa);
+            block = mX.allocate();
+            arena = mX.acquireArena();
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 < oa.numBlocksInUse());
+
+        memset(static_cast<void *>(block), 0xa5, sizeof(VALUE));
+
+        mY.joinArena(arena);
+        Obj::releaseArena(arena, 0, mY.allocator());
+
+        mY.deallocate(block);
+
+        const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+        ASSERT(block == mY.allocate());
+        ASSERTV(oa.numBlocksInUse(), NUM_BLOCKS == oa.numBlocksInUse());
+
+        mY.deallocate(block);
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (verbose) printf("\nMoving a block between sharing pools.\n");
+    {
+        Obj    mY(&oa);
+        VALUE *block;
+        Arena *arena;
+        {
+            Obj mX(&oa);
+            mX.shareArena(mY);
+
+            block = mX.allocate();
+            arena = mX.acquireArena();
+        }
+
+        const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+        memset(static_cast<void *>(block), 0xa5, sizeof(VALUE));
+
+        mY.joinArena(arena);
+        Obj::releaseArena(arena, 0, mY.allocator());
+        ASSERTV(oa.numBlocksInUse(), NUM_BLOCKS == oa.numBlocksInUse());
+
+        mY.deallocate(block);
+        ASSERT(block == mY.allocate());
+        mY.deallocate(block);
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    if (verbose) printf("\nMerging groups.\n");
+    {
+        Obj mC(&oa);
+        Obj mD(&oa);
+        mC.shareArena(mD);
+
+        VALUE *blockA;
+        VALUE *blockC = mC.allocate();
+        {
+            Obj mA(&oa);
+            Obj mB(&oa);
+            mA.shareArena(mB);
+
+            blockA = mA.allocate();
+
+            Arena *arena = mC.acquireArena();
+            mB.joinArena(arena);
+            Obj::releaseArena(arena, 0, mC.allocator());
+
+            mB.deallocate(blockC);
+            blockC = mB.allocate();
+        }
+
+        memset(static_cast<void *>(blockA), 0xa5, sizeof(VALUE));
+        memset(static_cast<void *>(blockC), 0x5a, sizeof(VALUE));
+
+        mD.deallocate(blockA);
+        mD.deallocate(blockC);
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+}
+
 template<class VALUE>
 void TestDriver<VALUE>::testCase13()
 {
@@ -1605,6 +1927,20 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
+      case 15: {
+        // --------------------------------------------------------------------
+        // 'SimplePool_Arena::lockRoots'
+        // --------------------------------------------------------------------
+
+        RUN_EACH_TYPE(TestDriver, testCase15, TEST_TYPES);
+      } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // SHARING BLOCKS BETWEEN POOLS
+        // --------------------------------------------------------------------
+
+        RUN_EACH_TYPE(TestDriver, testCase14, TEST_TYPES);
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // OTHER ACCESSORS
@@ -363,6 +363,10 @@ class TreeNode : public bslalg::RbTreeNode {
     ~TreeNode();                           // Declared but not defined
 
   public:
+    // TYPES
+    typedef VALUE ValueType;
+        // Alias for the type of the payload value.
+
     // MANIPULATORS
     VALUE& value();
         // Return a reference providing modifiable access to the 'value' of
@@ -270,6 +270,9 @@ class TreeNodePool {
     typedef typename AllocatorTraits::size_type size_type;
         // Alias for the 'size_type' of the allocator defined by 'SimplePool'.
 
+    typedef typename Pool::Arena Arena;
+        // Alias for the arena type defined by 'SimplePool'.
+
   public:
     // CREATORS
     explicit TreeNodePool(const ALLOCATOR& allocator);
@@ -284,6 +287,29 @@ class TreeNodePool {
         // unspecified state.
 
     // MANIPULATORS
+    Arena *acquireArena();
+        // Return the address of the arena of the memory pool maintained by
+        // this object, creating it if necessary, with a reference added on
+        // behalf of the caller.  Nodes allocated from this object remain valid
+        // until that reference is released, even if this object is destroyed
+        // first.  See 'bslstl_simplepool'.
+
+    void joinArena(Arena *arena);
+        // Make the memory pool maintained by this object a member of the same
+        // group as the specified 'arena', so that nodes allocated from a pool
+        // belonging to 'arena' may be deleted by this object.  This method
+        // does not allocate memory.  The behavior is undefined unless the
+        // caller holds a reference to 'arena', and this object uses an
+        // allocator equal to that of the pools belonging to 'arena'.  See
+        // 'bslstl_simplepool'.
+
+    void shareArena(TreeNodePool& other);
+        // Make the memory pools maintained by this object and the specified
+        // 'other' object members of the same group, so that nodes allocated
+        // from either object may be deleted by the other.  The behavior is
+        // undefined unless 'allocator() == other.allocator()'.  See
+        // 'bslstl_simplepool'.
+
     void adopt(bslmf::MovableRef<TreeNodePool> pool);
         // Adopt all outstanding memory allocations associated with the
         // specified node 'pool'.  The behavior is undefined unless this pool
@@ -536,6 +562,28 @@ TreeNodePool<VALUE, ALLOCATOR>::TreeNodePool(
 }
 
 // MANIPULATORS
+template <class VALUE, class ALLOCATOR>
+inline
+typename SimplePool<TreeNode<VALUE>, ALLOCATOR>::Arena *
+TreeNodePool<VALUE, ALLOCATOR>::acquireArena()
+{
+    return d_pool.acquireArena();
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+void TreeNodePool<VALUE, ALLOCATOR>::joinArena(Arena *arena)
+{
+    d_pool.joinArena(arena);
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+void TreeNodePool<VALUE, ALLOCATOR>::shareArena(TreeNodePool& other)
+{
+    d_pool.shareArena(other.d_pool);
+}
+
 template <class VALUE, class ALLOCATOR>
 inline
 void
@@ -947,6 +947,7 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_hashtablebucketiterator.h>
 #include <bslstl_hashtableiterator.h>
 #include <bslstl_iteratorutil.h>
+#include <bslstl_nodehandle.h>
 #include <bslstl_pair.h>
 #include <bslstl_stdexceptutil.h>
 #include <bslstl_unorderedmapkeyconfiguration.h>
@@ -965,6 +966,7 @@ BSL_OVERRIDES_STD mode"
 #include <bslmf_enableif.h>
 #include <bslmf_isbitwisemoveable.h>
 #include <bslmf_isconvertible.h>
+#include <bslmf_istransparentpredicate.h>
 #include <bslmf_movableref.h>
 #include <bslmf_nestedtraitdeclaration.h>
 
@@ -981,6 +983,9 @@ BSL_OVERRIDES_STD mode"
 
 namespace bsl {
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+class unordered_multimap;
+
                            // ===================
                            // class unordered_map
                            // ===================
@@ -1049,6 +1054,12 @@ class unordered_map {
                 const unordered_map<KEY2, VALUE2, HASH2, EQUAL2, ALLOCATOR2>&,
                 const unordered_map<KEY2, VALUE2, HASH2, EQUAL2, ALLOCATOR2>&);
 
+    template <class, class, class, class, class>
+    friend class unordered_map;
+
+    template <class, class, class, class, class>
+    friend class unordered_multimap;
+
   public:
     // TRAITS
 
@@ -1077,6 +1088,11 @@ class unordered_map {
     typedef BloombergLP::bslstl::HashTableBucketIterator<
                        const value_type, difference_type> const_local_iterator;
 
+    typedef BloombergLP::bslstl::MapNodeHandle<
+                            typename HashTable::NodeType, ALLOCATOR> node_type;
+    typedef BloombergLP::bslstl::NodeInsertReturnType<iterator, node_type>
+                                                            insert_return_type;
+
   private:
     // DATA
     HashTable d_impl;  // underlying hash table used by this unordered map
@@ -1358,6 +1374,82 @@ class unordered_map {
         // unordered map will be empty after calling this method, but allocated
         // memory may be retained for future use.
 
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+    node_type extract(const_iterator position);
+        // Unlink from this unordered map the element at the specified
+        // 'position', and return a node handle owning that element.  The
+        // element is neither copied, moved, nor reallocated, and references to
+        // it remain valid (referring to the element owned by the returned
+        // handle).  This method invalidates only iterators to the extracted
+        // element and previously saved values of the 'end()' iterator, and
+        // preserves the relative order of the elements not extracted.  The
+        // behavior is undefined unless 'position' refers to an element in this
+        // unordered map.
+
+    node_type extract(const key_type& key);
+        // Unlink from this unordered map the element whose key is equivalent
+        // to the specified 'key', if such an element exists, and return a node
+        // handle owning that element; otherwise, return an empty node handle.
+        // The element is neither copied, moved, nor reallocated.
+
+    insert_return_type insert(BloombergLP::bslmf::MovableRef<node_type> node);
+        // Insert the element owned by the specified 'node' handle into this
+        // unordered map, without copying, moving, or allocating the element,
+        // if 'node' is not empty and this unordered map does not already
+        // contain an element whose key is equivalent to that of the element;
+        // 'node' is left empty if the element is inserted.  Return an
+        // 'insert_return_type' whose 'position' refers to the inserted
+        // element, to the element that prevented insertion, or is 'end()' if
+        // 'node' is empty; whose 'inserted' member is 'true' if the element
+        // was inserted and 'false' otherwise; and whose 'node' member owns the
+        // element if it was not inserted.  Additional buckets are allocated,
+        // as needed, to preserve the invariant
+        // 'load_factor() <= max_load_factor()'.  The behavior is undefined
+        // unless 'node' is empty or uses the same allocator as this unordered
+        // map.
+
+    iterator insert(const_iterator                            hint,
+                    BloombergLP::bslmf::MovableRef<node_type> node);
+        // Insert the element owned by the specified 'node' handle into this
+        // unordered map, without copying, moving, or allocating the element,
+        // if 'node' is not empty and this unordered map does not already
+        // contain an element whose key is equivalent to that of the element;
+        // 'node' is left empty if the element is inserted, and is not modified
+        // otherwise.  Return an iterator referring to the inserted element, to
+        // the element that prevented insertion, or 'end()' if 'node' is empty.
+        // Additional buckets are allocated, as needed, to preserve the
+        // invariant 'load_factor() <= max_load_factor()'.  The behavior is
+        // undefined unless the specified 'hint' is an iterator in the range
+        // '[begin() .. end()]' (both endpoints included), and 'node' is empty
+        // or uses the same allocator as this unordered map.  Note that 'hint'
+        // is ignored (other than possibly asserting its validity in some build
+        // modes).
+#endif
+
+    template <class HASH2, class EQUAL2>
+    void merge(unordered_map<KEY, VALUE, HASH2, EQUAL2, ALLOCATOR>& source);
+    template <class HASH2, class EQUAL2>
+    void merge(
+             unordered_multimap<KEY, VALUE, HASH2, EQUAL2, ALLOCATOR>& source);
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+    template <class HASH2, class EQUAL2>
+    void merge(unordered_map<KEY, VALUE, HASH2, EQUAL2, ALLOCATOR>&& source);
+    template <class HASH2, class EQUAL2>
+    void merge(
+            unordered_multimap<KEY, VALUE, HASH2, EQUAL2, ALLOCATOR>&& source);
+#endif
+        // Relink into this unordered map each element of the specified
+        // 'source' whose key is not equivalent to that of an element of this
+        // unordered map, leaving the other elements in 'source'.  The relinked
+        // elements are neither copied, moved, nor reallocated, and references
+        // (but not iterators) to them remain valid, now referring into this
+        // unordered map.  Additional buckets are allocated, as needed, to
+        // preserve the invariant 'load_factor() <= max_load_factor()'.  The
+        // behavior is undefined unless
+        // 'source.get_allocator() == get_allocator()'.  Note that, apart from
+        // buckets, memory is allocated only the first time this unordered map
+        // exchanges elements with another container (see 'bslstl_simplepool').
+
 #if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
     template <class... Args>
     pair<iterator, bool> emplace(Args&&... args);
@@ -1460,6 +1552,38 @@ class unordered_map {
         // 'end()' iterator, and preserves the relative order of the elements
         // not removed.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value &&
+        !is_convertible<const LOOKUP_KEY&, iterator>::value &&
+        !is_convertible<const LOOKUP_KEY&, const_iterator>::value,
+        size_type>::type
+    erase(const LOOKUP_KEY& key)
+        // Remove from this unordered map the 'value_type' objects having a key
+        // equivalent to the specified 'key', and return the number of objects
+        // removed.  This method participates in overload resolution only if
+        // both 'HASH' and 'EQUAL' are transparent and 'LOOKUP_KEY' is not
+        // convertible to 'iterator' or 'const_iterator'; no 'key_type' object
+        // is created.  This method invalidates only iterators and references
+        // to the removed elements and previously saved values of the 'end()'
+        // iterator, and preserves the relative order of the elements not
+        // removed.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findRange(&first, &last, key);
+
+        size_type result = 0;
+        while (first != last) {
+            first = d_impl.remove(first);
+            ++result;
+        }
+        return result;
+    }
+
     iterator erase(const_iterator first, const_iterator last);
         // Remove from this unordered map the 'value_type' objects starting at
         // the specified 'first' position up to, but not including, the
@@ -1478,6 +1602,24 @@ class unordered_map {
         // 'key', if such an entry exists, and the past-the-end iterator
         // ('end') otherwise.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in this unordered map having a key equivalent to
+        // the specified 'key', if such an entry exists, and the past-the-end
+        // iterator ('end') otherwise.  This method participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent; no
+        // 'key_type' object is created.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return iterator(d_impl.find(key));
+    }
+
     pair<iterator, bool> insert(const value_type& value);
         // Insert the specified 'value' into this unordered map if the key (the
         // 'first' element) of the object referred to by 'value' does not
@@ -1634,6 +1776,32 @@ class unordered_map {
         // value, 'end()'.  Note that since an unordered map maintains unique
         // keys, the range will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this unordered map having a key
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this unordered map
+        // contains no such object, then the two returned iterators will have
+        // the same value, 'end()'.  This method participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent; no
+        // 'key_type' object is created.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        typedef pair<iterator, iterator> ResultType;
+
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findRange(&first, &last, key);
+        return ResultType(iterator(first), iterator(last));
+    }
+
     void max_load_factor(float newMaxLoadFactor);
         // Set the maximum load factor of this unordered map to the specified
         // 'newMaxLoadFactor'.  If 'newMaxLoadFactor < loadFactor()', this
@@ -1739,6 +1907,30 @@ class unordered_map {
         // unordered map maintains unique keys, the returned value will be
         // either 0 or 1.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects contained within this
+        // unordered map having a key equivalent to the specified 'key'.  This
+        // method participates in overload resolution only if both 'HASH' and
+        // 'EQUAL' are transparent; no 'key_type' object is created.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findRange(&first, &last, key);
+
+        size_type result = 0;
+        for (; first != last; first = first->nextLink()) {
+            ++result;
+        }
+        return result;
+    }
+
     bool empty() const BSLS_KEYWORD_NOEXCEPT;
         // Return 'true' if this unordered map contains no elements, and
         // 'false' otherwise.
@@ -1754,12 +1946,56 @@ class unordered_map {
         // value, 'end()'.  Note that since an unordered map maintains unique
         // keys, the range will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this unordered map having a key
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this unordered map
+        // contains no such object, then the two returned iterators will have
+        // the same value, 'end()'.  This method participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent; no
+        // 'key_type' object is created.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        typedef pair<const_iterator, const_iterator> ResultType;
+
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findRange(&first, &last, key);
+        return ResultType(const_iterator(first), const_iterator(last));
+    }
+
     const_iterator find(const key_type& key) const;
         // Return an iterator providing non-modifiable access to the
         // 'value_type' object in this unordered map with a key equivalent to
         // the specified 'key', if such an entry exists, and the past-the-end
         // iterator ('end') otherwise.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this unordered map having a key equivalent to
+        // the specified 'key', if such an entry exists, and the past-the-end
+        // iterator ('end') otherwise.  This method participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent; no
+        // 'key_type' object is created.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return const_iterator(d_impl.find(key));
+    }
+
     allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
         // Return (a copy of) the allocator used for memory allocation by this
         // unordered map.
@@ -2203,6 +2439,132 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::clear()
     d_impl.removeAll();
 }
 
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::node_type
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::extract(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != this->end());
+
+    // Acquire the arena, which may allocate, before modifying the table.
+
+    typename HashTable::NodeArena *arena = d_impl.acquireNodeArena();
+
+    HashTableLink *node = position.node();
+    d_impl.extractNode(node);
+    return node_type(static_cast<typename HashTable::NodeType *>(node),
+                     arena,
+                     d_impl.allocator());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::node_type
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::extract(const key_type& key)
+{
+    HashTableLink *node = d_impl.find(key);
+    if (!node) {
+        return node_type();                                           // RETURN
+    }
+    return extract(const_iterator(node));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert_return_type
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert(
+                                BloombergLP::bslmf::MovableRef<node_type> node)
+{
+    node_type& handle = node;
+
+    if (handle.empty()) {
+        insert_return_type result = { end(), false, node_type() };
+        return result;                                                // RETURN
+    }
+
+    BSLS_ASSERT(handle.get_allocator() == get_allocator());
+
+    bool isInsertedFlag = false;
+    HashTableLink *position = d_impl.insertNodeIfMissing(&isInsertedFlag,
+                                                         handle.node(),
+                                                         handle.arena());
+    if (!isInsertedFlag) {
+        insert_return_type result = { iterator(position),
+                                      false,
+                                      MoveUtil::move(handle) };
+        return result;                                                // RETURN
+    }
+
+    handle.release();
+    insert_return_type result = { iterator(position), true, node_type() };
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert(
+                                const_iterator                            hint,
+                                BloombergLP::bslmf::MovableRef<node_type> node)
+{
+    node_type& handle = node;
+
+    (void)hint;
+
+    if (handle.empty()) {
+        return end();                                                 // RETURN
+    }
+
+    BSLS_ASSERT(handle.get_allocator() == get_allocator());
+
+    bool isInsertedFlag = false;
+    HashTableLink *position = d_impl.insertNodeIfMissing(&isInsertedFlag,
+                                                         handle.node(),
+                                                         handle.arena());
+    if (isInsertedFlag) {
+        handle.release();
+    }
+    return iterator(position);
+}
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class HASH2, class EQUAL2>
+inline
+void unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::merge(
+                   unordered_map<KEY, VALUE, HASH2, EQUAL2, ALLOCATOR>& source)
+{
+    d_impl.mergeUnique(&source.d_impl);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class HASH2, class EQUAL2>
+inline
+void unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::merge(
+              unordered_multimap<KEY, VALUE, HASH2, EQUAL2, ALLOCATOR>& source)
+{
+    d_impl.mergeUnique(&source.d_impl);
+}
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class HASH2, class EQUAL2>
+inline
+void unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::merge(
+                  unordered_map<KEY, VALUE, HASH2, EQUAL2, ALLOCATOR>&& source)
+{
+    d_impl.mergeUnique(&source.d_impl);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class HASH2, class EQUAL2>
+inline
+void unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::merge(
+             unordered_multimap<KEY, VALUE, HASH2, EQUAL2, ALLOCATOR>&& source)
+{
+    d_impl.mergeUnique(&source.d_impl);
+}
+#endif
+
 #if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 template <class... Args>
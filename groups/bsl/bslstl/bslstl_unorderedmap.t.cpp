@@ -225,7 +225,7 @@ using bsl::pair;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [40] USAGE EXAMPLE
+// [42] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int  ggg(Obj *, const char *, bool verbose = true);
@@ -241,6 +241,16 @@ using bsl::pair;
 // [36] CONCERN: 'unordered_map' supports incomplete types.
 // [38] CONCERN: 'erase' overload is deduced correctly.
 // [39] CONCERN: Simple test case fails to compile on MSVC.
+// [40] CONCERN: 'find'        properly handles transparent predicates.
+// [40] CONCERN: 'count'       properly handles transparent predicates.
+// [40] CONCERN: 'equal_range' properly handles transparent predicates.
+// [40] CONCERN: 'erase'       properly handles transparent predicates.
+// [41] node_type extract(const_iterator position);
+// [41] node_type extract(const key_type& key);
+// [41] insert_return_type insert(node_type&& node);
+// [41] iterator insert(const_iterator hint, node_type&& node);
+// [41] void merge(unordered_map<K, V, H2, E2, A>& source);
+// [41] void merge(unordered_multimap<K, V, H2, E2, A>& source);
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -10436,7 +10446,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 40: {
+      case 42: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -10456,6 +10466,8 @@ int main(int argc, char *argv[])
                             "\n=============\n");
         usage();
       } break;
+      case 41: // falls through
+      case 40: // falls through
       case 39: // falls through
       case 38: // falls through
       case 37: // falls through
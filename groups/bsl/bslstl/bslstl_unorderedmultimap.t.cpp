@@ -190,7 +190,7 @@ using bsls::NameOf;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] default construction (only)
-// [38] USAGE EXAMPLE
+// [40] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(unordered_multimap *object, const char *s, int verbose);
@@ -203,6 +203,10 @@ using bsls::NameOf;
 // [35] CONCERN: 'unordered_multimap' supports incomplete types
 // [36] CONCERN: Methods qualifed 'noexcept' in standard are so implemented.
 // [37] CONCERN: 'erase' overload is deduced correctly.
+// [38] CONCERN: 'find'        properly handles transparent predicates.
+// [38] CONCERN: 'count'       properly handles transparent predicates.
+// [38] CONCERN: 'equal_range' properly handles transparent predicates.
+// [38] CONCERN: 'erase'       properly handles transparent predicates.
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
 // ----------------------------------------------------------------------------
@@ -223,6 +227,12 @@ void aSsErT(bool condition, const char *message, int line)
 }
 
 }  // close unnamed namespace
+// [39] node_type extract(const_iterator position);
+// [39] node_type extract(const key_type& key);
+// [39] iterator insert(node_type&& node);
+// [39] iterator insert(const_iterator hint, node_type&& node);
+// [39] void merge(unordered_multimap<K, V, H2, E2, A>& source);
+// [39] void merge(unordered_map<K, V, H2, E2, A>& source);
 
 // ============================================================================
 //               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
@@ -5653,7 +5663,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 38: {
+      case 40: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -5676,6 +5686,8 @@ int main(int argc, char *argv[])
             usage();
         }
       } break;
+      case 39: // falls through
+      case 38: // falls through
       case 37: // falls through
       case 36: // falls through
       case 35: // falls through
@@ -645,6 +645,7 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_hashtablebucketiterator.h>
 #include <bslstl_hashtableiterator.h>
 #include <bslstl_iteratorutil.h>
+#include <bslstl_nodehandle.h>
 #include <bslstl_pair.h>  // result type of 'equal_range' method
 #include <bslstl_unorderedsetkeyconfiguration.h>
 
@@ -657,7 +658,10 @@ BSL_OVERRIDES_STD mode"
                                        // but not very user friendly
 #include <bslma_usesbslmaallocator.h>
 
+#include <bslmf_enableif.h>
 #include <bslmf_isbitwisemoveable.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_istransparentpredicate.h>
 #include <bslmf_nestedtraitdeclaration.h>
 
 #include <bsls_assert.h>
@@ -673,6 +677,9 @@ BSL_OVERRIDES_STD mode"
 
 namespace bsl {
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+class unordered_set;
+
                         // ========================
                         // class unordered_multiset
                         // ========================
@@ -736,6 +743,12 @@ class unordered_multiset
                    const unordered_multiset<KEY2, HASH2, EQUAL2, ALLOCATOR2>&,
                    const unordered_multiset<KEY2, HASH2, EQUAL2, ALLOCATOR2>&);
 
+    template <class, class, class, class>
+    friend class unordered_multiset;
+
+    template <class, class, class, class>
+    friend class unordered_set;
+
   public:
     // PUBLIC TYPES
     typedef KEY                                        key_type;
@@ -760,6 +773,9 @@ class unordered_multiset
     typedef iterator                                   const_iterator;
     typedef local_iterator                             const_local_iterator;
 
+    typedef ::BloombergLP::bslstl::NodeHandle<
+                            typename HashTable::NodeType, ALLOCATOR> node_type;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION_IF(
@@ -1021,6 +1037,70 @@ class unordered_multiset
         // container is empty after this call, but allocated memory may be
         // retained for future use.
 
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+    node_type extract(const_iterator position);
+        // Unlink from this unordered multiset the element at the specified
+        // 'position', and return a node handle owning that element.  The
+        // element is neither copied, moved, nor reallocated, and references to
+        // it remain valid (referring to the element owned by the returned
+        // handle).  This method invalidates only iterators to the extracted
+        // element and previously saved values of the 'end()' iterator, and
+        // preserves the relative order of the elements not extracted.  The
+        // behavior is undefined unless 'position' refers to an element in this
+        // unordered multiset.
+
+    node_type extract(const key_type& key);
+        // Unlink from this unordered multiset the first element equivalent to
+        // the specified 'key', if such an element exists, and return a node
+        // handle owning that element; otherwise, return an empty node handle.
+        // The element is neither copied, moved, nor reallocated.
+
+    iterator insert(BloombergLP::bslmf::MovableRef<node_type> node);
+        // Insert the element owned by the specified 'node' handle into this
+        // unordered multiset, without copying, moving, or allocating the
+        // element, if 'node' is not empty, leaving 'node' empty.  Return an
+        // iterator referring to the inserted element, or 'end()' if 'node' is
+        // empty.  Additional buckets are allocated, as needed, to preserve the
+        // invariant 'load_factor() <= max_load_factor()'.  The behavior is
+        // undefined unless 'node' is empty or uses the same allocator as this
+        // unordered multiset.
+
+    iterator insert(const_iterator                            hint,
+                    BloombergLP::bslmf::MovableRef<node_type> node);
+        // Insert the element owned by the specified 'node' handle into this
+        // unordered multiset (in constant time if the specified 'hint' refers
+        // to an element in this unordered multiset equivalent to the element),
+        // without copying, moving, or allocating the element, if 'node' is not
+        // empty, leaving 'node' empty.  Return an iterator referring to the
+        // inserted element, or 'end()' if 'node' is empty.  Additional buckets
+        // are allocated, as needed, to preserve the invariant
+        // 'load_factor() <= max_load_factor()'.  The behavior is undefined
+        // unless 'hint' is an iterator in the range '[begin() .. end()]' (both
+        // endpoints included), and 'node' is empty or uses the same allocator
+        // as this unordered multiset.
+#endif
+
+    template <class HASH2, class EQUAL2>
+    void merge(unordered_multiset<KEY, HASH2, EQUAL2, ALLOCATOR>& source);
+    template <class HASH2, class EQUAL2>
+    void merge(unordered_set<KEY, HASH2, EQUAL2, ALLOCATOR>& source);
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+    template <class HASH2, class EQUAL2>
+    void merge(unordered_multiset<KEY, HASH2, EQUAL2, ALLOCATOR>&& source);
+    template <class HASH2, class EQUAL2>
+    void merge(unordered_set<KEY, HASH2, EQUAL2, ALLOCATOR>&& source);
+#endif
+        // Relink every element of the specified 'source' into this unordered
+        // multiset, leaving 'source' empty.  The relinked elements are neither
+        // copied, moved, nor reallocated, and references (but not iterators)
+        // to them remain valid, now referring into this unordered multiset.
+        // Buckets sufficient for the elements of both containers are allocated
+        // before any element is relinked.  The behavior is undefined unless
+        // 'source.get_allocator() == get_allocator()'.  Note that, apart from
+        // buckets, memory is allocated only the first time this unordered
+        // multiset exchanges elements with another container (see
+        // 'bslstl_simplepool').
+
     pair<iterator, iterator> equal_range(const key_type& key);
         // Return a pair of iterators providing modifiable access to the
         // sequence of 'value_type' objects in this unordered multiset
@@ -1030,6 +1110,32 @@ class unordered_multiset
         // multiset contains no 'value_type' objects equivalent to the 'key',
         // then the two returned iterators will have the same value.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this unordered multiset having a key
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this unordered multiset
+        // contains no such object, then the two returned iterators will have
+        // the same value, 'end()'.  This method participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent; no
+        // 'key_type' object is created.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        typedef pair<iterator, iterator> ResultType;
+
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findRange(&first, &last, key);
+        return ResultType(iterator(first), iterator(last));
+    }
+
     size_type erase(const key_type& key);
         // Remove from this unordered multiset all 'value_type' objects that
         // are equivalent to the specified 'key', if they exist, and return the
@@ -1039,6 +1145,38 @@ class unordered_multiset
         // element and previously saved values of the 'end()' iterator, and
         // preserves the relative order of the elements not removed.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value &&
+        !is_convertible<const LOOKUP_KEY&, iterator>::value &&
+        !is_convertible<const LOOKUP_KEY&, const_iterator>::value,
+        size_type>::type
+    erase(const LOOKUP_KEY& key)
+        // Remove from this unordered multiset the 'value_type' objects having a key
+        // equivalent to the specified 'key', and return the number of objects
+        // removed.  This method participates in overload resolution only if
+        // both 'HASH' and 'EQUAL' are transparent and 'LOOKUP_KEY' is not
+        // convertible to 'iterator' or 'const_iterator'; no 'key_type' object
+        // is created.  This method invalidates only iterators and references
+        // to the removed elements and previously saved values of the 'end()'
+        // iterator, and preserves the relative order of the elements not
+        // removed.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findRange(&first, &last, key);
+
+        size_type result = 0;
+        while (first != last) {
+            first = d_impl.remove(first);
+            ++result;
+        }
+        return result;
+    }
+
     iterator erase(const_iterator position);
         // Remove from this unordered multiset the 'value_type' object at the
         // specified 'position', and return an iterator referring to the
@@ -1069,6 +1207,24 @@ class unordered_multiset
         // this unordered multiset equivalent to the specified 'key', if such
         // entries exist, and the past-the-end ('end') iterator otherwise.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in this unordered multiset having a key equivalent to
+        // the specified 'key', if such an entry exists, and the past-the-end
+        // iterator ('end') otherwise.  This method participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent; no
+        // 'key_type' object is created.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return iterator(d_impl.find(key));
+    }
+
     iterator insert(const value_type& value);
         // Insert the specified 'value' into this unordered multiset.  If one
         // or more keys equivalent to 'value' already exist in this unordered
@@ -1538,10 +1694,52 @@ class unordered_multiset
         // this unordered multiset equivalent to the specified 'key', if such
         // entries exist, and the past-the-end ('end') iterator otherwise.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this unordered multiset having a key equivalent to
+        // the specified 'key', if such an entry exists, and the past-the-end
+        // iterator ('end') otherwise.  This method participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent; no
+        // 'key_type' object is created.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return const_iterator(d_impl.find(key));
+    }
+
     size_type count(const key_type& key) const;
         // Return the number of 'value_type' objects within this unordered
         // multiset that are equivalent to the specified 'key'.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects contained within this
+        // unordered multiset having a key equivalent to the specified 'key'.  This
+        // method participates in overload resolution only if both 'HASH' and
+        // 'EQUAL' are transparent; no 'key_type' object is created.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findRange(&first, &last, key);
+
+        size_type result = 0;
+        for (; first != last; first = first->nextLink()) {
+            ++result;
+        }
+        return result;
+    }
+
     pair<const_iterator, const_iterator> equal_range(
                                                     const key_type& key) const;
         // Return a pair of iterators providing non-modifiable access to the
@@ -1552,6 +1750,32 @@ class unordered_multiset
         // multiset contains no 'value_type' objects equivalent to the 'key',
         // then the two returned iterators will have the same value.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this unordered multiset having a key
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this unordered multiset
+        // contains no such object, then the two returned iterators will have
+        // the same value, 'end()'.  This method participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent; no
+        // 'key_type' object is created.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        typedef pair<const_iterator, const_iterator> ResultType;
+
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findRange(&first, &last, key);
+        return ResultType(const_iterator(first), const_iterator(last));
+    }
+
     const_local_iterator begin(size_type index) const;
     const_local_iterator cbegin(size_type index) const;
         // Return a local iterator providing non-modifiable access to the first
@@ -2543,6 +2767,107 @@ unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::clear() BSLS_KEYWORD_NOEXCEPT
     d_impl.removeAll();
 }
 
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::node_type
+unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::extract(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != this->end());
+
+    // Acquire the arena, which may allocate, before modifying the table.
+
+    typename HashTable::NodeArena *arena = d_impl.acquireNodeArena();
+
+    HashTableLink *node = position.node();
+    d_impl.extractNode(node);
+    return node_type(static_cast<typename HashTable::NodeType *>(node),
+                     arena,
+                     d_impl.allocator());
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::node_type
+unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::extract(const key_type& key)
+{
+    HashTableLink *node = d_impl.find(key);
+    if (!node) {
+        return node_type();                                           // RETURN
+    }
+    return extract(const_iterator(node));
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::insert(
+                                BloombergLP::bslmf::MovableRef<node_type> node)
+{
+    node_type& handle = node;
+    return insert(end(), MoveUtil::move(handle));
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::insert(
+                                const_iterator                            hint,
+                                BloombergLP::bslmf::MovableRef<node_type> node)
+{
+    node_type& handle = node;
+
+    if (handle.empty()) {
+        return end();                                                 // RETURN
+    }
+
+    BSLS_ASSERT(handle.get_allocator() == get_allocator());
+
+    HashTableLink *position = d_impl.insertNode(handle.node(),
+                                                handle.arena(),
+                                                hint.node());
+    handle.release();
+    return iterator(position);
+}
+#endif
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class HASH2, class EQUAL2>
+inline
+void unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::merge(
+                     unordered_multiset<KEY, HASH2, EQUAL2, ALLOCATOR>& source)
+{
+    d_impl.mergeAll(&source.d_impl);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class HASH2, class EQUAL2>
+inline
+void unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::merge(
+                          unordered_set<KEY, HASH2, EQUAL2, ALLOCATOR>& source)
+{
+    d_impl.mergeAll(&source.d_impl);
+}
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class HASH2, class EQUAL2>
+inline
+void unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::merge(
+                    unordered_multiset<KEY, HASH2, EQUAL2, ALLOCATOR>&& source)
+{
+    d_impl.mergeAll(&source.d_impl);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class HASH2, class EQUAL2>
+inline
+void unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::merge(
+                         unordered_set<KEY, HASH2, EQUAL2, ALLOCATOR>&& source)
+{
+    d_impl.mergeAll(&source.d_impl);
+}
+#endif
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 typename unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::iterator
 unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
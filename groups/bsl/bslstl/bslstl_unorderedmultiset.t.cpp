@@ -195,7 +195,7 @@ using bsls::NameOf;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] default construction (only)
-// [36] USAGE EXAMPLE
+// [38] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(unordered_multiset *object, const char *s, int verbose);
@@ -205,6 +205,16 @@ using bsls::NameOf;
 // [23] CONCERN: The object has the necessary type traits
 // [27] CONCERN: The values are spread into different buckets.
 // [35] CONCERN: Methods qualifed 'noexcept' in standard are so implemented.
+// [36] CONCERN: 'find'        properly handles transparent predicates.
+// [36] CONCERN: 'count'       properly handles transparent predicates.
+// [36] CONCERN: 'equal_range' properly handles transparent predicates.
+// [36] CONCERN: 'erase'       properly handles transparent predicates.
+// [37] node_type extract(const_iterator position);
+// [37] node_type extract(const key_type& key);
+// [37] iterator insert(node_type&& node);
+// [37] iterator insert(const_iterator hint, node_type&& node);
+// [37] void merge(unordered_multiset<K, H2, E2, A>& source);
+// [37] void merge(unordered_set<K, H2, E2, A>& source);
 
 // ============================================================================
 //                     STANDARD BSL ASSERT TEST FUNCTION
@@ -4651,7 +4661,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 36: {
+      case 38: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -4804,6 +4814,8 @@ int main(int argc, char *argv[])
 // See the material in {'bslstl_unorderedmap'|Example 2}.
 
       } break;
+      case 37: // falls through
+      case 36: // falls through
       case 35: // falls through
       case 34: // falls through
       case 33: // falls through
@@ -577,6 +577,7 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_hashtablebucketiterator.h>
 #include <bslstl_hashtableiterator.h>
 #include <bslstl_iteratorutil.h>
+#include <bslstl_nodehandle.h>
 #include <bslstl_pair.h>  // result type of 'equal_range' method
 #include <bslstl_unorderedsetkeyconfiguration.h>
 
@@ -588,7 +589,10 @@ BSL_OVERRIDES_STD mode"
                                  // not very user friendly
 #include <bslma_usesbslmaallocator.h>
 
+#include <bslmf_enableif.h>
 #include <bslmf_isbitwisemoveable.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_istransparentpredicate.h>
 #include <bslmf_nestedtraitdeclaration.h>
 
 #include <bsls_assert.h>
@@ -603,6 +607,9 @@ BSL_OVERRIDES_STD mode"
 
 namespace bsl {
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+class unordered_multiset;
+
                         // ===================
                         // class unordered_set
                         // ===================
@@ -664,6 +671,12 @@ class unordered_set {
                         const unordered_set<KEY2, HASH2, EQUAL2, ALLOCATOR2>&,
                         const unordered_set<KEY2, HASH2, EQUAL2, ALLOCATOR2>&);
 
+    template <class, class, class, class>
+    friend class unordered_set;
+
+    template <class, class, class, class>
+    friend class unordered_multiset;
+
   public:
     // PUBLIC TYPES
     typedef KEY                                        key_type;
@@ -686,6 +699,11 @@ class unordered_set {
     typedef iterator                                   const_iterator;
     typedef local_iterator                             const_local_iterator;
 
+    typedef ::BloombergLP::bslstl::NodeHandle<
+                            typename HashTable::NodeType, ALLOCATOR> node_type;
+    typedef ::BloombergLP::bslstl::NodeInsertReturnType<iterator, node_type>
+                                                            insert_return_type;
+
 
   public:
     // TRAITS
@@ -1358,6 +1376,38 @@ class unordered_set {
         // values of the 'end()' iterator, and preserves the relative order of
         // the elements not removed.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value &&
+        !is_convertible<const LOOKUP_KEY&, iterator>::value &&
+        !is_convertible<const LOOKUP_KEY&, const_iterator>::value,
+        size_type>::type
+    erase(const LOOKUP_KEY& key)
+        // Remove from this unordered set the 'value_type' objects having a key
+        // equivalent to the specified 'key', and return the number of objects
+        // removed.  This method participates in overload resolution only if
+        // both 'HASH' and 'EQUAL' are transparent and 'LOOKUP_KEY' is not
+        // convertible to 'iterator' or 'const_iterator'; no 'key_type' object
+        // is created.  This method invalidates only iterators and references
+        // to the removed elements and previously saved values of the 'end()'
+        // iterator, and preserves the relative order of the elements not
+        // removed.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findRange(&first, &last, key);
+
+        size_type result = 0;
+        while (first != last) {
+            first = d_impl.remove(first);
+            ++result;
+        }
+        return result;
+    }
+
     iterator erase(const_iterator first, const_iterator last);
         // Remove from this set the 'value_type' objects starting at the
         // specified 'first' position up to, but including the specified 'last'
@@ -1386,12 +1436,103 @@ class unordered_set {
         // empty after this call, but allocated memory may be retained for
         // future use.
 
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+    node_type extract(const_iterator position);
+        // Unlink from this unordered set the element at the specified
+        // 'position', and return a node handle owning that element.  The
+        // element is neither copied, moved, nor reallocated, and references to
+        // it remain valid (referring to the element owned by the returned
+        // handle).  This method invalidates only iterators to the extracted
+        // element and previously saved values of the 'end()' iterator, and
+        // preserves the relative order of the elements not extracted.  The
+        // behavior is undefined unless 'position' refers to an element in this
+        // unordered set.
+
+    node_type extract(const key_type& key);
+        // Unlink from this unordered set the element equivalent to the
+        // specified 'key', if such an element exists, and return a node handle
+        // owning that element; otherwise, return an empty node handle.  The
+        // element is neither copied, moved, nor reallocated.
+
+    insert_return_type insert(BloombergLP::bslmf::MovableRef<node_type> node);
+        // Insert the element owned by the specified 'node' handle into this
+        // unordered set, without copying, moving, or allocating the element,
+        // if 'node' is not empty and this unordered set does not already
+        // contain an element equivalent to the element; 'node' is left empty
+        // if the element is inserted.  Return an 'insert_return_type' whose
+        // 'position' refers to the inserted element, to the element that
+        // prevented insertion, or is 'end()' if 'node' is empty; whose
+        // 'inserted' member is 'true' if the element was inserted and 'false'
+        // otherwise; and whose 'node' member owns the element if it was not
+        // inserted.  Additional buckets are allocated, as needed, to preserve
+        // the invariant 'load_factor() <= max_load_factor()'.  The behavior is
+        // undefined unless 'node' is empty or uses the same allocator as this
+        // unordered set.
+
+    iterator insert(const_iterator                            hint,
+                    BloombergLP::bslmf::MovableRef<node_type> node);
+        // Insert the element owned by the specified 'node' handle into this
+        // unordered set, without copying, moving, or allocating the element,
+        // if 'node' is not empty and this unordered set does not already
+        // contain an element equivalent to the element; 'node' is left empty
+        // if the element is inserted, and is not modified otherwise.  Return
+        // an iterator referring to the inserted element, to the element that
+        // prevented insertion, or 'end()' if 'node' is empty.  Additional
+        // buckets are allocated, as needed, to preserve the invariant
+        // 'load_factor() <= max_load_factor()'.  The behavior is undefined
+        // unless the specified 'hint' is an iterator in the range
+        // '[begin() .. end()]' (both endpoints included), and 'node' is empty
+        // or uses the same allocator as this unordered set.  Note that 'hint'
+        // is ignored (other than possibly asserting its validity in some build
+        // modes).
+#endif
+
+    template <class HASH2, class EQUAL2>
+    void merge(unordered_set<KEY, HASH2, EQUAL2, ALLOCATOR>& source);
+    template <class HASH2, class EQUAL2>
+    void merge(unordered_multiset<KEY, HASH2, EQUAL2, ALLOCATOR>& source);
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+    template <class HASH2, class EQUAL2>
+    void merge(unordered_set<KEY, HASH2, EQUAL2, ALLOCATOR>&& source);
+    template <class HASH2, class EQUAL2>
+    void merge(unordered_multiset<KEY, HASH2, EQUAL2, ALLOCATOR>&& source);
+#endif
+        // Relink into this unordered set each element of the specified
+        // 'source' that is not equivalent to an element of this unordered set,
+        // leaving the other elements in 'source'.  The relinked elements are
+        // neither copied, moved, nor reallocated, and references (but not
+        // iterators) to them remain valid, now referring into this unordered
+        // set.  Additional buckets are allocated, as needed, to preserve the
+        // invariant 'load_factor() <= max_load_factor()'.  The behavior is
+        // undefined unless 'source.get_allocator() == get_allocator()'.  Note
+        // that, apart from buckets, memory is allocated only the first time
+        // this unordered set exchanges elements with another container (see
+        // 'bslstl_simplepool').
+
     iterator find(const key_type& key);
         // Return an iterator providing modifiable access to the 'value_type'
         // object in this set that is equivalent to the specified 'key', if
         // such an entry exists, and the past-the-end ('end') iterator
         // otherwise.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in this unordered set having a key equivalent to
+        // the specified 'key', if such an entry exists, and the past-the-end
+        // iterator ('end') otherwise.  This method participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent; no
+        // 'key_type' object is created.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return iterator(d_impl.find(key));
+    }
+
     pair<iterator, iterator> equal_range(const key_type& key);
         // Return a pair of iterators providing modifiable access to the
         // sequence of 'value_type' objects in this unordered set that are
@@ -1402,6 +1543,32 @@ class unordered_set {
         // returned iterators will have the same value.  Note that since a set
         // maintains unique keys, the range will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this unordered set having a key
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this unordered set
+        // contains no such object, then the two returned iterators will have
+        // the same value, 'end()'.  This method participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent; no
+        // 'key_type' object is created.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        typedef pair<iterator, iterator> ResultType;
+
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findRange(&first, &last, key);
+        return ResultType(iterator(first), iterator(last));
+    }
+
     void max_load_factor(float newLoadFactor);
         // Set the maximum load factor of this container to the specified
         // 'newLoadFactor'.
@@ -1477,11 +1644,53 @@ class unordered_set {
         // 'key', if such an entry exists, and the past-the-end ('end')
         // iterator otherwise.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this unordered set having a key equivalent to
+        // the specified 'key', if such an entry exists, and the past-the-end
+        // iterator ('end') otherwise.  This method participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent; no
+        // 'key_type' object is created.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return const_iterator(d_impl.find(key));
+    }
+
     size_type count(const key_type& key) const;
         // Return the number of 'value_type' objects within this set that are
         // equivalent to the specified 'key'.  Note that since an unordered set
         // maintains unique keys, the returned value will be either 0 or 1.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects contained within this
+        // unordered set having a key equivalent to the specified 'key'.  This
+        // method participates in overload resolution only if both 'HASH' and
+        // 'EQUAL' are transparent; no 'key_type' object is created.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findRange(&first, &last, key);
+
+        size_type result = 0;
+        for (; first != last; first = first->nextLink()) {
+            ++result;
+        }
+        return result;
+    }
+
     pair<const_iterator, const_iterator> equal_range(
                                                     const key_type& key) const;
         // Return a pair of iterators providing non-modifiable access to the
@@ -1493,6 +1702,32 @@ class unordered_set {
         // have the same value.  Note that since a set maintains unique keys,
         // the range will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value &&
+        BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this unordered set having a key
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this unordered set
+        // contains no such object, then the two returned iterators will have
+        // the same value, 'end()'.  This method participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent; no
+        // 'key_type' object is created.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        typedef pair<const_iterator, const_iterator> ResultType;
+
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findRange(&first, &last, key);
+        return ResultType(const_iterator(first), const_iterator(last));
+    }
+
     size_type bucket_count() const BSLS_KEYWORD_NOEXCEPT;
         // Return the number of buckets in the array of buckets maintained by
         // this set.
@@ -1893,6 +2128,131 @@ void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::clear() BSLS_KEYWORD_NOEXCEPT
     d_impl.removeAll();
 }
 
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::node_type
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::extract(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != this->end());
+
+    // Acquire the arena, which may allocate, before modifying the table.
+
+    typename HashTable::NodeArena *arena = d_impl.acquireNodeArena();
+
+    HashTableLink *node = position.node();
+    d_impl.extractNode(node);
+    return node_type(static_cast<typename HashTable::NodeType *>(node),
+                     arena,
+                     d_impl.allocator());
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::node_type
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::extract(const key_type& key)
+{
+    HashTableLink *node = d_impl.find(key);
+    if (!node) {
+        return node_type();                                           // RETURN
+    }
+    return extract(const_iterator(node));
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::insert_return_type
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(
+                                BloombergLP::bslmf::MovableRef<node_type> node)
+{
+    node_type& handle = node;
+
+    if (handle.empty()) {
+        insert_return_type result = { end(), false, node_type() };
+        return result;                                                // RETURN
+    }
+
+    BSLS_ASSERT(handle.get_allocator() == get_allocator());
+
+    bool isInsertedFlag = false;
+    HashTableLink *position = d_impl.insertNodeIfMissing(&isInsertedFlag,
+                                                         handle.node(),
+                                                         handle.arena());
+    if (!isInsertedFlag) {
+        insert_return_type result = { iterator(position),
+                                      false,
+                                      MoveUtil::move(handle) };
+        return result;                                                // RETURN
+    }
+
+    handle.release();
+    insert_return_type result = { iterator(position), true, node_type() };
+    return result;
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(
+                                const_iterator                            hint,
+                                BloombergLP::bslmf::MovableRef<node_type> node)
+{
+    node_type& handle = node;
+
+    (void)hint;
+
+    if (handle.empty()) {
+        return end();                                                 // RETURN
+    }
+
+    BSLS_ASSERT(handle.get_allocator() == get_allocator());
+
+    bool isInsertedFlag = false;
+    HashTableLink *position = d_impl.insertNodeIfMissing(&isInsertedFlag,
+                                                         handle.node(),
+                                                         handle.arena());
+    if (isInsertedFlag) {
+        handle.release();
+    }
+    return iterator(position);
+}
+#endif
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class HASH2, class EQUAL2>
+inline
+void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::merge(
+                          unordered_set<KEY, HASH2, EQUAL2, ALLOCATOR>& source)
+{
+    d_impl.mergeUnique(&source.d_impl);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class HASH2, class EQUAL2>
+inline
+void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::merge(
+                     unordered_multiset<KEY, HASH2, EQUAL2, ALLOCATOR>& source)
+{
+    d_impl.mergeUnique(&source.d_impl);
+}
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class HASH2, class EQUAL2>
+inline
+void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::merge(
+                         unordered_set<KEY, HASH2, EQUAL2, ALLOCATOR>&& source)
+{
+    d_impl.mergeUnique(&source.d_impl);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class HASH2, class EQUAL2>
+inline
+void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::merge(
+                    unordered_multiset<KEY, HASH2, EQUAL2, ALLOCATOR>&& source)
+{
+    d_impl.mergeUnique(&source.d_impl);
+}
+#endif
+
 #if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 template <class... Args>
@@ -198,7 +198,7 @@ using bsls::NameOf;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] default construction (only)
-// [34] USAGE EXAMPLE
+// [36] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 //*[ 3] int ggg(unordered_set<K,H,E,A> *object, const char *spec, int verbose);
@@ -210,6 +210,16 @@ using bsls::NameOf;
 //*[23] TBD: Not yet working for all types.
 //*[  ] CONCERN: The type provides the full interface defined by the standard.
 // [33] CONCERN: Methods qualifed 'noexcept' in standard are so implemented.
+// [34] CONCERN: 'find'        properly handles transparent predicates.
+// [34] CONCERN: 'count'       properly handles transparent predicates.
+// [34] CONCERN: 'equal_range' properly handles transparent predicates.
+// [34] CONCERN: 'erase'       properly handles transparent predicates.
+// [35] node_type extract(const_iterator position);
+// [35] node_type extract(const key_type& key);
+// [35] insert_return_type insert(node_type&& node);
+// [35] iterator insert(const_iterator hint, node_type&& node);
+// [35] void merge(unordered_set<K, H2, E2, A>& source);
+// [35] void merge(unordered_multiset<K, H2, E2, A>& source);
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -4699,7 +4709,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 34: {
+      case 36: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -4854,6 +4864,8 @@ if (verbose) {
 // See the material in {'bslstl_unorderedmap'|Example 2}.
 
       } break;
+      case 35: // falls through
+      case 34: // falls through
       case 33: // falls through
       case 32: // falls through
       case 31: // falls through
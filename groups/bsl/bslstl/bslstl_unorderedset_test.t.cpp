@@ -3,6 +3,7 @@
 #include <bslstl_unorderedset_test.h>
 
 #include <bslstl_pair.h>
+#include <bslstl_unorderedmultiset.h>
 #include <bslstl_unorderedset.h>
 
 #include <bslalg_rangecompare.h>
@@ -204,7 +205,7 @@ using bsls::NameOf;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] default construction (only)
-// [34] USAGE EXAMPLE
+// [36] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 //*[ 3] int ggg(unordered_set<K,H,E,A> *object, const char *spec, int verbose);
@@ -216,6 +217,16 @@ using bsls::NameOf;
 //*[23] TBD: Not yet working for all types.
 //*[  ] CONCERN: The type provides the full interface defined by the standard.
 // [33] CONCERN: Methods qualifed 'noexcept' in standard are so implemented.
+// [34] CONCERN: 'find'        properly handles transparent predicates.
+// [34] CONCERN: 'count'       properly handles transparent predicates.
+// [34] CONCERN: 'equal_range' properly handles transparent predicates.
+// [34] CONCERN: 'erase'       properly handles transparent predicates.
+// [35] node_type extract(const_iterator position);
+// [35] node_type extract(const key_type& key);
+// [35] insert_return_type insert(node_type&& node);
+// [35] iterator insert(const_iterator hint, node_type&& node);
+// [35] void merge(unordered_set<K, H2, E2, A>& source);
+// [35] void merge(unordered_multiset<K, H2, E2, A>& source);
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -7641,6 +7652,212 @@ void TestDriver<KEY, HASH, EQUAL, ALLOC>::testCase12()
     }
 }
 
+                      // =============================
+                      // class TransparentlyComparable
+                      // =============================
+
+class TransparentlyComparable {
+    // DATA
+    int d_conversionCount;  // number of times 'operator int' has been called
+    int d_value;            // the value
+
+  private:
+    // NOT IMPLEMENTED
+    TransparentlyComparable(const TransparentlyComparable&);  // = delete
+
+  public:
+    // CREATORS
+    explicit TransparentlyComparable(int value)
+        // Create an object having the specified 'value'.
+    : d_conversionCount(0)
+    , d_value(value)
+    {
+    }
+
+    // MANIPULATORS
+    operator int()
+        // Return the current value of this object.
+    {
+        ++d_conversionCount;
+        return d_value;
+    }
+
+    // ACCESSORS
+    int conversionCount() const
+        // Return the number of times 'operator int' has been called.
+    {
+        return d_conversionCount;
+    }
+
+    int value() const
+        // Return the current value of this object.
+    {
+        return d_value;
+    }
+
+    friend bool operator==(const TransparentlyComparable& lhs, int rhs)
+        // Return 'true' if the value of the specified 'lhs' is equal to the
+        // specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.d_value == rhs;
+    }
+
+    friend bool operator==(int lhs, const TransparentlyComparable& rhs)
+        // Return 'true' if the specified 'lhs' is equal to the value of the
+        // specified 'rhs', and 'false' otherwise.
+    {
+        return lhs == rhs.d_value;
+    }
+};
+
+                        // ========================
+                        // struct TransparentHasher
+                        // ========================
+
+struct TransparentHasher {
+    // This class can be used as a hash functor for unordered containers of
+    // 'int'.  It has a nested type 'is_transparent', so it is classified as
+    // transparent by the 'bslmf::IsTransparentPredicate' metafunction and can
+    // be used for heterogeneous lookup.
+
+    typedef void is_transparent;
+
+    native_std::size_t operator()(int key) const
+        // Return the hash of the specified 'key'.
+    {
+        return bsl::hash<int>()(key);
+    }
+
+    native_std::size_t operator()(const TransparentlyComparable& key) const
+        // Return the hash of the value of the specified 'key'.
+    {
+        return bsl::hash<int>()(key.value());
+    }
+};
+
+                        // =======================
+                        // struct TransparentEqual
+                        // =======================
+
+struct TransparentEqual {
+    // This class can be used as a key-equality functor for unordered
+    // containers.  It has a nested type 'is_transparent', so it is classified
+    // as transparent by the 'bslmf::IsTransparentPredicate' metafunction and
+    // can be used for heterogeneous lookup.
+
+    typedef void is_transparent;
+
+    template <class LHS, class RHS>
+    bool operator()(const LHS& lhs, const RHS& rhs) const
+        // Return 'true' if the specified 'lhs' is equal to the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs == rhs;
+    }
+};
+
+template <class CONTAINER>
+void testTransparentLookup(CONTAINER& container,
+                           bool       isTransparent,
+                           int        initKeyValue,
+                           int        expectedCount)
+    // Search for a key equal to the specified 'initKeyValue' in the specified
+    // 'container', which is expected to hold the specified 'expectedCount'
+    // elements having that key, and count the number of conversions expected
+    // based on the specified 'isTransparent'.  Note that 'CONTAINER' may
+    // resolve to a 'const'-qualified type, so that both the 'const'-qualified
+    // and the non-'const'-qualified overloads are tested.
+{
+    typedef typename CONTAINER::const_iterator Iterator;
+    typedef typename CONTAINER::size_type      Count;
+
+    const Count EXPECTED_COUNT = static_cast<Count>(expectedCount);
+
+    int expectedConversionCount = 0;
+
+    TransparentlyComparable existingKey(initKeyValue);
+    TransparentlyComparable nonExistingKey(-100 - initKeyValue);
+
+    // Testing 'find'.
+
+    const Iterator EXISTING_F = container.find(existingKey);
+    if (!isTransparent) {
+        ++expectedConversionCount;
+    }
+
+    ASSERT(container.end()               != EXISTING_F);
+    ASSERT(existingKey.value()           == *EXISTING_F);
+    ASSERT(existingKey.conversionCount() == expectedConversionCount);
+
+    const Iterator NON_EXISTING_F = container.find(nonExistingKey);
+    ASSERT(container.end()                  == NON_EXISTING_F);
+    ASSERT(nonExistingKey.conversionCount() == expectedConversionCount);
+
+    // Testing 'count'.
+
+    const Count EXISTING_C = container.count(existingKey);
+    if (!isTransparent) {
+        ++expectedConversionCount;
+    }
+
+    ASSERT(EXPECTED_COUNT          == EXISTING_C);
+    ASSERT(expectedConversionCount == existingKey.conversionCount());
+
+    const Count NON_EXISTING_C = container.count(nonExistingKey);
+    ASSERT(0                       == NON_EXISTING_C);
+    ASSERT(expectedConversionCount == nonExistingKey.conversionCount());
+
+    // Testing 'equal_range'.
+
+    const bsl::pair<Iterator, Iterator> EXISTING_ER =
+                                            container.equal_range(existingKey);
+    if (!isTransparent) {
+        ++expectedConversionCount;
+    }
+
+    ASSERT(EXISTING_F              == EXISTING_ER.first);
+    ASSERT(expectedCount           == bsl::distance(EXISTING_ER.first,
+                                                    EXISTING_ER.second));
+    ASSERT(expectedConversionCount == existingKey.conversionCount());
+
+    const bsl::pair<Iterator, Iterator> NON_EXISTING_ER =
+                                         container.equal_range(nonExistingKey);
+
+    ASSERT(container.end()         == NON_EXISTING_ER.first);
+    ASSERT(container.end()         == NON_EXISTING_ER.second);
+    ASSERT(expectedConversionCount == nonExistingKey.conversionCount());
+}
+
+template <class CONTAINER>
+void testTransparentErase(const CONTAINER& original,
+                          bool             isTransparent,
+                          int              initKeyValue,
+                          int              expectedCount)
+    // Erase the elements having a key equal to the specified 'initKeyValue'
+    // from a copy of the specified 'original' container, which is expected to
+    // hold the specified 'expectedCount' such elements, and count the number
+    // of conversions expected based on the specified 'isTransparent'.
+{
+    typedef typename CONTAINER::size_type Count;
+
+    const Count EXPECTED_COUNT = static_cast<Count>(expectedCount);
+    const int   EXPECTED_CONV  = isTransparent ? 0 : 1;
+
+    CONTAINER mX(original);  const CONTAINER& X = mX;
+
+    TransparentlyComparable existingKey(initKeyValue);
+    TransparentlyComparable nonExistingKey(-100 - initKeyValue);
+
+    ASSERT(0               == mX.erase(nonExistingKey));
+    ASSERT(original.size() == X.size());
+    ASSERT(EXPECTED_CONV   == nonExistingKey.conversionCount());
+
+    ASSERT(EXPECTED_COUNT                   == mX.erase(existingKey));
+    ASSERT(original.size() - EXPECTED_COUNT == X.size());
+    ASSERT(X.end()                          == X.find(initKeyValue));
+    ASSERT(EXPECTED_CONV                    == existingKey.conversionCount());
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -7662,6 +7879,257 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
+      case 35: {
+        // --------------------------------------------------------------------
+        // TESTING NODE HANDLES AND 'merge'
+        //
+        // Concerns:
+        //: 1 'extract' unlinks an element and hands it to a node handle
+        //:   without copying, moving, or reallocating it.
+        //:
+        //: 2 Inserting a node handle relinks its element without allocating.
+        //:   A unique container leaves the handle owning an element that
+        //:   duplicates an element already present.
+        //:
+        //: 3 A node handle keeps its element valid after the source container
+        //:   is destroyed, and the element is destroyed and its memory
+        //:   reclaimed when the handle is destroyed.
+        //:
+        //: 4 'merge' relinks the elements of a container of the same kind, or
+        //:   of the counterpart kind, without copying or reallocating them,
+        //:   and leaves duplicates in the source.
+        //:
+        //: 5 Only the first exchange of elements between two containers
+        //:   allocates memory.
+        //:
+        //: 6 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Extract elements by key and by position, and verify the address
+        //:   of each extracted element and the sizes of the containers.
+        //:   (C-1)
+        //:
+        //: 2 Insert the handles into another container, with and without a
+        //:   hint, and verify the result and that no memory is allocated.
+        //:   (C-2)
+        //:
+        //: 3 Extract an element from a container that is then destroyed, and
+        //:   verify the value of the element owned by the handle.  (C-3)
+        //:
+        //: 4 Merge containers of both kinds into an object, and verify the
+        //:   sizes of both containers, the address of a relinked element, and
+        //:   the number of allocations.  (C-4..5)
+        //:
+        //: 5 Verify that all memory is returned to the allocator.  (C-6)
+        //
+        // Testing:
+        //   node_type extract(const_iterator position);
+        //   node_type extract(const key_type& key);
+        //   insert_return_type insert(node_type&& node);
+        //   iterator insert(const_iterator hint, node_type&& node);
+        //   void merge(unordered_set<K, H2, E2, A>& source);
+        //   void merge(unordered_multiset<K, H2, E2, A>& source);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING NODE HANDLES AND 'merge'"
+                            "\n================================\n");
+
+        typedef bsl::unordered_set<int>      Obj;
+        typedef bsl::unordered_multiset<int> OtherObj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        if (verbose) printf("\tTesting 'extract' and 'insert'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            Obj mY(&oa);  const Obj& Y = mY;
+
+            mX.reserve(64);
+            mY.reserve(64);
+
+            for (int i = 0; i < 8; ++i) {
+                mX.insert(i);
+                mY.insert(i + 4);
+            }
+
+            const int *ADDRESS = &*X.find(2);
+
+            Obj::node_type mN = mX.extract(2);  const Obj::node_type& N = mN;
+
+            ASSERT(!N.empty());
+            ASSERT(ADDRESS == &N.value());
+            ASSERT(7       == X.size());
+            ASSERT(X.end() == X.find(2));
+
+            ASSERT(N.get_allocator() == X.get_allocator());
+            ASSERT(mX.extract(100).empty());
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            Obj::insert_return_type result = mY.insert(MoveUtil::move(mN));
+
+            ASSERT(N.empty());
+            ASSERT(result.inserted);
+            ASSERT(result.node.empty());
+            ASSERT(ADDRESS == &*result.position);
+            ASSERT(9       == Y.size());
+
+            mN = mX.extract(X.find(5));
+
+            Obj::insert_return_type duplicate = mY.insert(MoveUtil::move(mN));
+
+            ASSERT(!duplicate.inserted);
+            ASSERT(Y.find(5) == duplicate.position);
+            ASSERT(5         == duplicate.node.value());
+            ASSERT(9         == Y.size());
+
+            Obj::iterator it = mX.insert(X.begin(),
+                                         MoveUtil::move(duplicate.node));
+
+            ASSERT(duplicate.node.empty());
+            ASSERT(X.find(5) == it);
+            ASSERT(7         == X.size());
+
+            ASSERT(NUM_ALLOCATIONS == oa.numAllocations());
+
+            {
+                Obj mZ(&oa);
+                mZ.insert(100);
+                mN = mZ.extract(mZ.begin());
+            }
+            ASSERT(100 == N.value());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+#endif
+
+        if (verbose) printf("\tTesting 'merge'.\n");
+        {
+            Obj      mX(&oa);  const Obj&      X = mX;
+            Obj      mY(&oa);  const Obj&      Y = mY;
+            OtherObj mZ(&oa);  const OtherObj& Z = mZ;
+            mX.reserve(64);
+
+            for (int i = 0; i < 8; ++i) {
+                mX.insert(i);
+                mY.insert(i + 4);
+                mZ.insert(i % 4);
+            }
+
+            const int *ADDRESS = &*Y.find(11);
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            mX.merge(mY);
+
+            ASSERT(12      == X.size());
+            ASSERT(4       == Y.size());
+            ASSERT(ADDRESS == &*X.find(11));
+
+            mX.merge(mZ);
+
+            ASSERT(12 == X.size());
+            ASSERT(8  == Z.size());
+
+            mX.merge(mX);
+
+            ASSERT(12 == X.size());
+
+            // Only sharing the first arena allocated.
+
+            ASSERT(NUM_ALLOCATIONS + 1 == oa.numAllocations());
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+            OtherObj mW(&oa);  const OtherObj& W = mW;
+            mW.insert(100);
+
+            mX.merge(bslmf::MovableRefUtil::move(mW));
+
+            ASSERT(13 == X.size());
+            ASSERT(0  == W.size());
+            ASSERT(1  == X.count(100));
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 34: {
+        // --------------------------------------------------------------------
+        // TESTING TRANSPARENT LOOKUP
+        //
+        // Concerns:
+        //: 1 'unordered_set' does not have a transparent set of lookup functions
+        //:   unless both the hasher and the key-equality comparator are
+        //:   transparent.
+        //:
+        //: 2 'unordered_set' has a transparent set of lookup functions if both
+        //:   the hasher and the key-equality comparator are transparent.
+        //:
+        //: 3 The transparent 'erase' removes every element having a key
+        //:   equivalent to its argument, and returns the number of elements
+        //:   removed.
+        //
+        // Plan:
+        //: 1 Construct a non-transparent 'unordered_set' and call the lookup
+        //:   functions with a type that is convertible to the 'key_type'.
+        //:   There should be exactly one conversion per call to a lookup
+        //:   function.  (C-1)
+        //:
+        //: 2 Construct a transparent 'unordered_set' and call the lookup
+        //:   functions with a type that is convertible to the 'key_type'.
+        //:   There should be no conversions.  (C-2..3)
+        //
+        // Testing:
+        //   CONCERN: 'find'        properly handles transparent predicates.
+        //   CONCERN: 'count'       properly handles transparent predicates.
+        //   CONCERN: 'equal_range' properly handles transparent predicates.
+        //   CONCERN: 'erase'       properly handles transparent predicates.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n" "TESTING TRANSPARENT LOOKUP" "\n"
+                                 "==========================" "\n");
+
+        typedef bsl::unordered_set<int> NonTransparent;
+        typedef bsl::unordered_set<int,
+                                   TransparentHasher,
+                                   TransparentEqual> Transparent;
+
+        const int DATA[] = { 0, 1, 2, 3, 4 };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+        const int MULT = 1;  // number of elements having each key
+
+        NonTransparent        mXNT;
+        const NonTransparent& XNT = mXNT;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            for (int j = 0; j < MULT; ++j) {
+                mXNT.insert(DATA[i]);
+            }
+        }
+
+        Transparent        mXT(mXNT.begin(), mXNT.end());
+        const Transparent& XT = mXT;
+
+        ASSERT(NUM_DATA * MULT == XNT.size());
+        ASSERT(NUM_DATA * MULT == XT.size() );
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const int VALUE = DATA[i];
+            if (veryVerbose) {
+                printf("Testing transparent lookup with a value of %d\n",
+                       VALUE);
+            }
+
+            testTransparentLookup( XNT, false, VALUE, MULT);
+            testTransparentLookup(mXNT, false, VALUE, MULT);
+            testTransparentLookup( XT,  true,  VALUE, MULT);
+            testTransparentLookup(mXT,  true,  VALUE, MULT);
+
+            testTransparentErase(XNT, false, VALUE, MULT);
+            testTransparentErase(XT,  true,  VALUE, MULT);
+        }
+      } break;
       case 33: {
         // --------------------------------------------------------------------
         // 'noexcept' SPECIFICATION